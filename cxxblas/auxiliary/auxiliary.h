@@ -39,9 +39,11 @@
 #include <cxxblas/auxiliary/debugmacro.h>
 #include <cxxblas/auxiliary/fakeuse.h>
 #include <cxxblas/auxiliary/iscomplex.h>
+#include <cxxblas/auxiliary/isieeefloat.h>
 #include <cxxblas/auxiliary/ismpfrreal.h>
 #include <cxxblas/auxiliary/issame.h>
 #include <cxxblas/auxiliary/pow.h>
+#include <cxxblas/auxiliary/profiler.h>
 #include <cxxblas/auxiliary/restrictto.h>
 
 #endif // CXXBLAS_AUXILIARY_AUXILIARY_H
@@ -36,5 +36,6 @@
 #include <cxxblas/auxiliary/complex.tcc>
 #include <cxxblas/auxiliary/cuda.tcc>
 #include <cxxblas/auxiliary/pow.tcc>
+#include <cxxblas/auxiliary/profiler.tcc>
 
 #endif // CXXBLAS_AUXILIARY_AUXILIARY_TCC
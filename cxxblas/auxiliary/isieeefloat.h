@@ -0,0 +1,58 @@
+/*
+ *   Copyright (c) 2014, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef CXXBLAS_AUXILIARY_ISIEEEFLOAT_H
+#define CXXBLAS_AUXILIARY_ISIEEEFLOAT_H 1
+
+#include <cxxstd/limits.h>
+#include <cxxblas/auxiliary/issame.h>
+
+namespace cxxblas {
+
+//
+//  True for the built-in IEEE floating point types.  Checking
+//  numeric_limits<T>::is_iec559 alone is not sufficient as the QD library
+//  derives numeric_limits<dd_real> and numeric_limits<qd_real> from
+//  numeric_limits<double>.
+//
+template <typename T>
+struct IsIEEEFloat
+{
+    static const bool value = std::numeric_limits<T>::is_iec559
+                           && (IsSame<T, float>::value
+                            || IsSame<T, double>::value
+                            || IsSame<T, long double>::value);
+};
+
+} // namespace cxxblas
+
+#endif // CXXBLAS_AUXILIARY_ISIEEEFLOAT_H
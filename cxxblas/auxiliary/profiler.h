@@ -0,0 +1,219 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef CXXBLAS_AUXILIARY_PROFILER_H
+#define CXXBLAS_AUXILIARY_PROFILER_H 1
+
+#include <cxxstd/chrono.h>
+#include <cxxstd/iostream.h>
+#include <cxxstd/map.h>
+#include <cxxstd/mutex.h>
+#include <cxxstd/string.h>
+#include <cxxstd/vector.h>
+
+//
+//  Lightweight per-kernel profiling.  If CXXBLAS_PROFILE is defined the
+//  instrumented cxxblas kernels record for each (routine, backend) pair
+//
+//      - number of calls, flop count, byte count and wall time,
+//      - calls and wall time per problem size bucket (powers of 4),
+//
+//  and, if tracing is switched on, one event per call that can be exported
+//  in the Chrome trace format (chrome://tracing, Perfetto).  The closure
+//  switches of FLENS also count how often a temporary had to be created.
+//
+//  Only the outermost instrumented call is recorded, e.g. the gemv calls
+//  issued by the generic gemm are accounted to gemm.
+//
+//  Counters are kept per thread, so recording does not need any locking.
+//  Profiler::summary(...) and Profiler::writeChromeTrace(...) merge the data
+//  of all threads and should be called while no other thread is inside an
+//  instrumented kernel.
+//
+//  On program exit a summary is written to the file given by the
+//  environment variable CXXBLAS_PROFILE_SUMMARY ("-" for stderr) and a trace
+//  to the file given by CXXBLAS_PROFILE_TRACE (which also enables tracing).
+//
+//  Without CXXBLAS_PROFILE the macros below expand to nothing.
+//
+
+namespace cxxblas {
+
+enum ProfileBackend {
+    ProfileGeneric    = 0,
+    ProfileIntrinsics = 1,
+    ProfileCblas      = 2,
+    ProfileCublas     = 3,
+    ProfileTemporary  = 4
+};
+
+struct ProfileCounters
+{
+    static const int numBuckets = 16;
+
+    ProfileCounters();
+
+    void
+    operator+=(const ProfileCounters &rhs);
+
+    long    calls;
+    double  flops, bytes, seconds;
+    long    bucketCalls[numBuckets];
+    double  bucketSeconds[numBuckets];
+};
+
+struct ProfileEvent
+{
+    const char      *routine;
+    ProfileBackend  backend;
+    long            size;
+    double          start, duration;
+};
+
+class Profiler
+{
+    public:
+        typedef std::chrono::steady_clock   Clock;
+
+        static const int numBackends = 5;
+
+        static void
+        record(const char *routine, ProfileBackend backend, long size,
+               double flops, double bytes,
+               const Clock::time_point &start, const Clock::time_point &end);
+
+        static void
+        temporary(const char *routine);
+
+        static bool
+        enter();
+
+        static void
+        leave();
+
+        static void
+        setTracing(bool enable, std::size_t maxEventsPerThread = 1<<20);
+
+        static bool
+        tracing();
+
+        static void
+        reset();
+
+        static const char *
+        name(ProfileBackend backend);
+
+        static int
+        bucket(long size);
+
+        static void
+        summary(std::ostream &out);
+
+        static bool
+        writeChromeTrace(const char *filename);
+
+    private:
+        typedef std::pair<const char *, int>             Key;
+        typedef std::map<Key, ProfileCounters>           LocalCounters;
+        typedef std::pair<std::string, int>              MergedKey;
+        typedef std::map<MergedKey, ProfileCounters>     MergedCounters;
+
+        struct ThreadData
+        {
+            int                         id;
+            int                         depth;
+            LocalCounters               counters;
+            std::vector<ProfileEvent>   events;
+        };
+
+        struct State
+        {
+            State();
+
+            std::mutex                  mutex;
+            std::vector<ThreadData *>   threads;
+            Clock::time_point           origin;
+            bool                        tracing;
+            std::size_t                 maxEvents;
+        };
+
+        static State &
+        state_();
+
+        static bool
+        init_();
+
+        static ThreadData &
+        threadData_();
+
+        static ThreadData *
+        registerThread_();
+
+        static void
+        merge_(MergedCounters &merged);
+
+        static void
+        atExit_();
+};
+
+class ProfileScope
+{
+    public:
+        ProfileScope(const char *routine, ProfileBackend backend, long size,
+                     double flops, double bytes);
+
+        ~ProfileScope();
+
+    private:
+        const char                  *routine_;
+        ProfileBackend              backend_;
+        long                        size_;
+        double                      flops_, bytes_;
+        bool                        outermost_;
+        Profiler::Clock::time_point start_;
+};
+
+} // namespace cxxblas
+
+//-- CXXBLAS_PROFILE_SCOPE, CXXBLAS_PROFILE_TEMPORARY --------------------------
+#ifdef CXXBLAS_PROFILE
+#   define CXXBLAS_PROFILE_SCOPE(routine, backend, size, flops, bytes)       \
+        cxxblas::ProfileScope  cxxblasProfileScope_(routine, backend,        \
+                                                     size, flops, bytes)
+#   define CXXBLAS_PROFILE_TEMPORARY(routine)                                \
+        cxxblas::Profiler::temporary(routine)
+#else
+#   define CXXBLAS_PROFILE_SCOPE(routine, backend, size, flops, bytes)
+#   define CXXBLAS_PROFILE_TEMPORARY(routine)
+#endif // CXXBLAS_PROFILE
+
+#endif // CXXBLAS_AUXILIARY_PROFILER_H
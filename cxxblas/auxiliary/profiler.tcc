@@ -0,0 +1,360 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef CXXBLAS_AUXILIARY_PROFILER_TCC
+#define CXXBLAS_AUXILIARY_PROFILER_TCC 1
+
+#include <cxxstd/cstdio.h>
+#include <cxxstd/cstdlib.h>
+#include <cxxstd/fstream.h>
+#include <cxxstd/iomanip.h>
+#include <cxxstd/string.h>
+#include <cxxblas/auxiliary/profiler.h>
+
+namespace cxxblas {
+
+//-- ProfileCounters -----------------------------------------------------------
+
+inline
+ProfileCounters::ProfileCounters()
+    : calls(0), flops(0), bytes(0), seconds(0)
+{
+    for (int b=0; b<numBuckets; ++b) {
+        bucketCalls[b]   = 0;
+        bucketSeconds[b] = 0;
+    }
+}
+
+inline void
+ProfileCounters::operator+=(const ProfileCounters &rhs)
+{
+    calls   += rhs.calls;
+    flops   += rhs.flops;
+    bytes   += rhs.bytes;
+    seconds += rhs.seconds;
+    for (int b=0; b<numBuckets; ++b) {
+        bucketCalls[b]   += rhs.bucketCalls[b];
+        bucketSeconds[b] += rhs.bucketSeconds[b];
+    }
+}
+
+//-- Profiler ------------------------------------------------------------------
+
+inline void
+Profiler::record(const char *routine, ProfileBackend backend, long size,
+                 double flops, double bytes,
+                 const Clock::time_point &start, const Clock::time_point &end)
+{
+    ThreadData &data   = threadData_();
+    const double time  = std::chrono::duration<double>(end-start).count();
+    const int    b     = bucket(size);
+
+    ProfileCounters &counters = data.counters[Key(routine, backend)];
+    ++counters.calls;
+    counters.flops            += flops;
+    counters.bytes            += bytes;
+    counters.seconds          += time;
+    ++counters.bucketCalls[b];
+    counters.bucketSeconds[b] += time;
+
+    State &state = state_();
+    if (state.tracing && data.events.size()<state.maxEvents) {
+        ProfileEvent event;
+        event.routine  = routine;
+        event.backend  = backend;
+        event.size     = size;
+        event.start    = std::chrono::duration<double>(start
+                                                       -state.origin).count();
+        event.duration = time;
+        data.events.push_back(event);
+    }
+}
+
+inline void
+Profiler::temporary(const char *routine)
+{
+    ++threadData_().counters[Key(routine, ProfileTemporary)].calls;
+}
+
+inline bool
+Profiler::enter()
+{
+    return threadData_().depth++==0;
+}
+
+inline void
+Profiler::leave()
+{
+    --threadData_().depth;
+}
+
+inline void
+Profiler::setTracing(bool enable, std::size_t maxEventsPerThread)
+{
+    State &state    = state_();
+    state.tracing   = enable;
+    state.maxEvents = maxEventsPerThread;
+}
+
+inline bool
+Profiler::tracing()
+{
+    return state_().tracing;
+}
+
+inline void
+Profiler::reset()
+{
+    State &state = state_();
+    std::lock_guard<std::mutex> lock(state.mutex);
+
+    for (std::size_t i=0; i<state.threads.size(); ++i) {
+        state.threads[i]->counters.clear();
+        state.threads[i]->events.clear();
+    }
+    state.origin = Clock::now();
+}
+
+inline const char *
+Profiler::name(ProfileBackend backend)
+{
+    static const char *names[numBackends] = { "generic", "intrinsics",
+                                              "cblas", "cublas",
+                                              "temporary" };
+    return names[backend];
+}
+
+inline int
+Profiler::bucket(long size)
+{
+    int b = 0;
+    while (size>=4 && b<ProfileCounters::numBuckets-1) {
+        size /= 4;
+        ++b;
+    }
+    return b;
+}
+
+inline void
+Profiler::summary(std::ostream &out)
+{
+    MergedCounters merged;
+    merge_(merged);
+
+    out << std::left << std::setw(24) << "routine"
+        << std::setw(12) << "backend"
+        << std::right << std::setw(12) << "calls"
+        << std::setw(14) << "time [s]"
+        << std::setw(12) << "GFlop/s"
+        << std::setw(12) << "GB/s" << std::endl;
+
+    MergedCounters::const_iterator it;
+    for (it=merged.begin(); it!=merged.end(); ++it) {
+        const ProfileCounters &c = it->second;
+        const double          t  = (c.seconds>0) ? c.seconds : 1;
+
+        out << std::left << std::setw(24) << it->first.first
+            << std::setw(12) << name(ProfileBackend(it->first.second))
+            << std::right << std::setw(12) << c.calls
+            << std::setw(14) << c.seconds
+            << std::setw(12) << c.flops/t*1e-9
+            << std::setw(12) << c.bytes/t*1e-9 << std::endl;
+
+        if (it->first.second==ProfileTemporary) {
+            continue;
+        }
+        for (int b=0; b<ProfileCounters::numBuckets; ++b) {
+            if (c.bucketCalls[b]==0) {
+                continue;
+            }
+            long lower = 1;
+            for (int k=0; k<b; ++k) {
+                lower *= 4;
+            }
+            out << "    size >= " << std::left << std::setw(24) << lower
+                << std::right << std::setw(12) << c.bucketCalls[b]
+                << std::setw(14) << c.bucketSeconds[b] << std::endl;
+        }
+    }
+}
+
+inline bool
+Profiler::writeChromeTrace(const char *filename)
+{
+    std::ofstream out(filename);
+    if (!out) {
+        return false;
+    }
+
+    State &state = state_();
+    std::lock_guard<std::mutex> lock(state.mutex);
+
+    out << "{\"traceEvents\":[" << std::endl;
+    bool first = true;
+    for (std::size_t i=0; i<state.threads.size(); ++i) {
+        const ThreadData &data = *state.threads[i];
+        for (std::size_t k=0; k<data.events.size(); ++k) {
+            const ProfileEvent &event = data.events[k];
+            if (!first) {
+                out << "," << std::endl;
+            }
+            first = false;
+            out << "{\"name\":\"" << event.routine << "\""
+                << ",\"cat\":\"" << name(event.backend) << "\""
+                << ",\"ph\":\"X\""
+                << ",\"ts\":" << event.start*1e6
+                << ",\"dur\":" << event.duration*1e6
+                << ",\"pid\":0"
+                << ",\"tid\":" << data.id
+                << ",\"args\":{\"size\":" << event.size << "}}";
+        }
+    }
+    out << std::endl << "]}" << std::endl;
+    return true;
+}
+
+inline
+Profiler::State::State()
+    : origin(Clock::now()), tracing(false), maxEvents(1<<20)
+{
+    if (std::getenv("CXXBLAS_PROFILE_TRACE")) {
+        tracing = true;
+    }
+}
+
+//
+//  atExit_ gets registered after state was constructed, so it runs before
+//  state gets destroyed.
+//
+inline Profiler::State &
+Profiler::state_()
+{
+    static State state;
+    static bool  initialized = init_();
+
+    FAKE_USE(initialized);
+    return state;
+}
+
+inline bool
+Profiler::init_()
+{
+    if (std::getenv("CXXBLAS_PROFILE_TRACE")
+     || std::getenv("CXXBLAS_PROFILE_SUMMARY"))
+    {
+        std::atexit(atExit_);
+    }
+    return true;
+}
+
+inline Profiler::ThreadData &
+Profiler::threadData_()
+{
+    static thread_local ThreadData *data = registerThread_();
+    return *data;
+}
+
+//
+//  Thread data is owned by the registry and never released, so counters of
+//  finished threads still show up in the summary.
+//
+inline Profiler::ThreadData *
+Profiler::registerThread_()
+{
+    State &state = state_();
+    std::lock_guard<std::mutex> lock(state.mutex);
+
+    ThreadData *data = new ThreadData();
+    data->id    = int(state.threads.size());
+    data->depth = 0;
+    state.threads.push_back(data);
+    return data;
+}
+
+inline void
+Profiler::merge_(MergedCounters &merged)
+{
+    State &state = state_();
+    std::lock_guard<std::mutex> lock(state.mutex);
+
+    for (std::size_t i=0; i<state.threads.size(); ++i) {
+        const LocalCounters &counters = state.threads[i]->counters;
+
+        LocalCounters::const_iterator it;
+        for (it=counters.begin(); it!=counters.end(); ++it) {
+            merged[MergedKey(it->first.first, it->first.second)] += it->second;
+        }
+    }
+}
+
+inline void
+Profiler::atExit_()
+{
+    const char *summaryFile = std::getenv("CXXBLAS_PROFILE_SUMMARY");
+    if (summaryFile) {
+        if (std::string(summaryFile)=="-") {
+            summary(std::cerr);
+        } else {
+            std::ofstream out(summaryFile);
+            summary(out);
+        }
+    }
+    const char *traceFile = std::getenv("CXXBLAS_PROFILE_TRACE");
+    if (traceFile) {
+        writeChromeTrace(traceFile);
+    }
+}
+
+//-- ProfileScope --------------------------------------------------------------
+
+inline
+ProfileScope::ProfileScope(const char *routine, ProfileBackend backend,
+                           long size, double flops, double bytes)
+    : routine_(routine), backend_(backend), size_(size),
+      flops_(flops), bytes_(bytes), outermost_(Profiler::enter()),
+      start_(Profiler::Clock::now())
+{
+}
+
+inline
+ProfileScope::~ProfileScope()
+{
+    if (outermost_) {
+        Profiler::record(routine_, backend_, size_, flops_, bytes_,
+                         start_, Profiler::Clock::now());
+    }
+    Profiler::leave();
+}
+
+} // namespace cxxblas
+
+#endif // CXXBLAS_AUXILIARY_PROFILER_TCC
@@ -52,4 +52,7 @@
 #include <cxxblas/tinylevel1/tinylevel1.h>
 #include <cxxblas/tinylevel2/tinylevel2.h>
 
+#include <cxxblas/qd/qd.h>
+#include <cxxblas/mpfr/mpfr.h>
+
 #endif // CXXBLAS_CXXBLAS_H
@@ -50,4 +50,7 @@
 #include <cxxblas/tinylevel1/tinylevel1.tcc>
 #include <cxxblas/tinylevel2/tinylevel2.tcc>
 
+#include <cxxblas/qd/qd.tcc>
+#include <cxxblas/mpfr/mpfr.tcc>
+
 #endif // CXXBLAS_CXXBLAS_TCC
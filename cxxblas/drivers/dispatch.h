@@ -0,0 +1,110 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef CXXBLAS_DRIVERS_DISPATCH_H
+#define CXXBLAS_DRIVERS_DISPATCH_H 1
+
+//
+//  Runtime dispatch between the generic cxxblas kernels and an external
+//  BLAS.  For each routine a threshold on the problem size is kept (n for
+//  axpy and dot, m*n for gemv, m*n*k for gemm).  Below the threshold the
+//  generic kernel is used, from the threshold on the external BLAS.  A
+//  negative threshold disables the external BLAS for that routine.
+//
+//  Thresholds can be changed with BlasDispatch::setThreshold(...) or read
+//  from a config file with BlasDispatch::load(...).  On first use the
+//  environment is consulted:
+//
+//      CXXBLAS_DISPATCH_CONFIG=<file>   config file to load
+//      CXXBLAS_DISPATCH_GEMM=<size>     (also _AXPY, _DOT, _GEMV) overrides
+//
+//  A config file contains lines "<routine> <threshold>", '#' starts a
+//  comment.  flens/examples/blas-dispatch-calibrate.cc measures the
+//  crossover points on the target machine and writes such a file.
+//
+//  Dispatching can be switched off at compile time by defining
+//  CXXBLAS_NO_RUNTIME_DISPATCH, then the external BLAS is always used (if
+//  available).
+//
+
+namespace cxxblas {
+
+enum DispatchRoutine {
+    DispatchAxpy = 0,
+    DispatchDot  = 1,
+    DispatchGemv = 2,
+    DispatchGemm = 3
+};
+
+class BlasDispatch
+{
+    public:
+        static const int numRoutines = 4;
+
+        static long
+        threshold(DispatchRoutine routine);
+
+        static void
+        setThreshold(DispatchRoutine routine, long size);
+
+        static void
+        reset();
+
+        static const char *
+        name(DispatchRoutine routine);
+
+        static bool
+        load(const char *filename);
+
+        static bool
+        save(const char *filename);
+
+        static bool
+        useExternal(DispatchRoutine routine, long size);
+
+    private:
+        static long *
+        thresholds_();
+
+        static bool
+        init_(long *thresholds);
+
+        static void
+        setDefaults_(long *thresholds);
+
+        static bool
+        read_(const char *filename, long *thresholds);
+};
+
+} // namespace cxxblas
+
+#endif // CXXBLAS_DRIVERS_DISPATCH_H
@@ -0,0 +1,179 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef CXXBLAS_DRIVERS_DISPATCH_TCC
+#define CXXBLAS_DRIVERS_DISPATCH_TCC 1
+
+#include <cxxstd/cstdlib.h>
+#include <cxxstd/fstream.h>
+#include <cxxstd/sstream.h>
+#include <cxxstd/string.h>
+#include <cxxblas/drivers/dispatch.h>
+
+namespace cxxblas {
+
+inline long
+BlasDispatch::threshold(DispatchRoutine routine)
+{
+    return thresholds_()[routine];
+}
+
+inline void
+BlasDispatch::setThreshold(DispatchRoutine routine, long size)
+{
+    thresholds_()[routine] = size;
+}
+
+inline void
+BlasDispatch::reset()
+{
+    setDefaults_(thresholds_());
+}
+
+inline const char *
+BlasDispatch::name(DispatchRoutine routine)
+{
+    static const char *names[numRoutines] = { "axpy", "dot", "gemv", "gemm" };
+    return names[routine];
+}
+
+inline bool
+BlasDispatch::load(const char *filename)
+{
+    return read_(filename, thresholds_());
+}
+
+inline bool
+BlasDispatch::save(const char *filename)
+{
+    std::ofstream out(filename);
+    if (!out) {
+        return false;
+    }
+    out << "# cxxblas runtime dispatch thresholds" << std::endl;
+    for (int r=0; r<numRoutines; ++r) {
+        out << name(DispatchRoutine(r)) << " "
+            << threshold(DispatchRoutine(r)) << std::endl;
+    }
+    return true;
+}
+
+inline bool
+BlasDispatch::useExternal(DispatchRoutine routine, long size)
+{
+#   ifdef CXXBLAS_NO_RUNTIME_DISPATCH
+    FAKE_USE(routine);
+    FAKE_USE(size);
+    return true;
+#   else
+    const long t = thresholds_()[routine];
+    return (t>=0) && (size>=t);
+#   endif
+}
+
+inline long *
+BlasDispatch::thresholds_()
+{
+    static long thresholds[numRoutines];
+    static bool initialized = init_(thresholds);
+
+    FAKE_USE(initialized);
+    return thresholds;
+}
+
+inline bool
+BlasDispatch::init_(long *thresholds)
+{
+    setDefaults_(thresholds);
+
+    const char *config = std::getenv("CXXBLAS_DISPATCH_CONFIG");
+    if (config) {
+        read_(config, thresholds);
+    }
+
+    static const char *vars[numRoutines] = { "CXXBLAS_DISPATCH_AXPY",
+                                             "CXXBLAS_DISPATCH_DOT",
+                                             "CXXBLAS_DISPATCH_GEMV",
+                                             "CXXBLAS_DISPATCH_GEMM" };
+    for (int r=0; r<numRoutines; ++r) {
+        const char *value = std::getenv(vars[r]);
+        if (value) {
+            thresholds[r] = std::atol(value);
+        }
+    }
+    return true;
+}
+
+inline void
+BlasDispatch::setDefaults_(long *thresholds)
+{
+//
+//  Below these sizes call overhead (and thread spin-up inside the external
+//  BLAS) usually dominates.
+//
+    thresholds[DispatchAxpy] = 256;
+    thresholds[DispatchDot]  = 256;
+    thresholds[DispatchGemv] = 64*64;
+    thresholds[DispatchGemm] = 32*32*32;
+}
+
+inline bool
+BlasDispatch::read_(const char *filename, long *thresholds)
+{
+    std::ifstream in(filename);
+    if (!in) {
+        return false;
+    }
+
+    std::string line;
+    while (std::getline(in, line)) {
+        line = line.substr(0, line.find('#'));
+
+        std::istringstream  fields(line);
+        std::string         routine;
+        long                size;
+
+        if (!(fields >> routine >> size)) {
+            continue;
+        }
+        for (int r=0; r<numRoutines; ++r) {
+            if (routine==name(DispatchRoutine(r))) {
+                thresholds[r] = size;
+            }
+        }
+    }
+    return true;
+}
+
+} // namespace cxxblas
+
+#endif // CXXBLAS_DRIVERS_DISPATCH_TCC
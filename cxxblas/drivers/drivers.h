@@ -65,6 +65,8 @@
 #include <cxxblas/drivers/sparseblas.h>
 #endif
 
+#include <cxxblas/drivers/dispatch.h>
+#include <cxxblas/drivers/reproducible.h>
 #include <cxxblas/typedefs.h>
 
 namespace cxxblas {
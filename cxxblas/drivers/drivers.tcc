@@ -34,6 +34,8 @@
 #define CXXBLAS_DRIVERS_DRIVERS_TCC 1
 
 #include <cxxblas/auxiliary/auxiliary.h>
+#include <cxxblas/drivers/dispatch.tcc>
+#include <cxxblas/drivers/reproducible.tcc>
 #include <cxxblas/drivers/drivers.h>
 
 #ifndef BLAS_IMPL
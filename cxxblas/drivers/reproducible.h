@@ -0,0 +1,91 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef CXXBLAS_DRIVERS_REPRODUCIBLE_H
+#define CXXBLAS_DRIVERS_REPRODUCIBLE_H 1
+
+//
+//  Global switch for the reproducible reductions.  If enabled, dot, dotu,
+//  asum, nrm2 (including the scaled sums of squares used by lassq and lan)
+//  and sum are computed by the *_reproducible kernels of
+//  cxxblas/level1extensions/reproducible.h instead of the generic,
+//  intrinsics or external BLAS kernels.  Results then are bitwise identical
+//  for any number of threads, vector width or chunking of the data.
+//
+//  Single calls can use the *_reproducible kernels directly.  A
+//  ReproducibleScope switches the mode on for its lifetime and restores the
+//  previous mode afterwards.  On first use the environment is consulted:
+//
+//      CXXBLAS_REPRODUCIBLE=1           enables the mode
+//
+//  The switch is global, i.e. it is shared by all threads.
+//
+
+namespace cxxblas {
+
+class Reproducible
+{
+    public:
+        static bool
+        enabled();
+
+        static void
+        setEnabled(bool enable);
+
+    private:
+        static bool &
+        enabled_();
+
+        static bool
+        init_();
+};
+
+class ReproducibleScope
+{
+    public:
+        explicit
+        ReproducibleScope(bool enable = true);
+
+        ~ReproducibleScope();
+
+    private:
+        ReproducibleScope(const ReproducibleScope &);
+
+        ReproducibleScope &
+        operator=(const ReproducibleScope &);
+
+        bool  previous_;
+};
+
+} // namespace cxxblas
+
+#endif // CXXBLAS_DRIVERS_REPRODUCIBLE_H
@@ -0,0 +1,86 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef CXXBLAS_DRIVERS_REPRODUCIBLE_TCC
+#define CXXBLAS_DRIVERS_REPRODUCIBLE_TCC 1
+
+#include <cxxstd/cstdlib.h>
+#include <cxxblas/drivers/reproducible.h>
+
+namespace cxxblas {
+
+//-- Reproducible --------------------------------------------------------------
+
+inline bool
+Reproducible::enabled()
+{
+    return enabled_();
+}
+
+inline void
+Reproducible::setEnabled(bool enable)
+{
+    enabled_() = enable;
+}
+
+inline bool &
+Reproducible::enabled_()
+{
+    static bool enabled = init_();
+    return enabled;
+}
+
+inline bool
+Reproducible::init_()
+{
+    const char *value = std::getenv("CXXBLAS_REPRODUCIBLE");
+    return value && std::atoi(value)!=0;
+}
+
+//-- ReproducibleScope ---------------------------------------------------------
+
+inline
+ReproducibleScope::ReproducibleScope(bool enable)
+    : previous_(Reproducible::enabled())
+{
+    Reproducible::setEnabled(enable);
+}
+
+inline
+ReproducibleScope::~ReproducibleScope()
+{
+    Reproducible::setEnabled(previous_);
+}
+
+} // namespace cxxblas
+
+#endif // CXXBLAS_DRIVERS_REPRODUCIBLE_TCC
@@ -57,6 +57,10 @@ template <typename IndexType, typename X, typename T>
 void
 asum(IndexType n, const X *x, IndexType incX, T &absSum)
 {
+    if (Reproducible::enabled()) {
+        asum_reproducible(n, x, incX, absSum);
+        return;
+    }
     if (incX<0) {
         x -= incX*(n-1);
     }
@@ -70,6 +74,11 @@ template <typename IndexType>
 typename If<IndexType>::isBlasCompatibleInteger
 asum(IndexType n, const float *x, IndexType incX, float &absSum)
 {
+    if (Reproducible::enabled()) {
+        asum_reproducible(n, x, incX, absSum);
+        return;
+    }
+
     CXXBLAS_DEBUG_OUT("[" BLAS_IMPL "] cblas_sasum");
 
     absSum = cblas_sasum(n, x, incX);
@@ -80,6 +89,11 @@ template <typename IndexType>
 typename If<IndexType>::isBlasCompatibleInteger
 asum(IndexType n, const double *x, IndexType incX, double &absSum)
 {
+    if (Reproducible::enabled()) {
+        asum_reproducible(n, x, incX, absSum);
+        return;
+    }
+
     CXXBLAS_DEBUG_OUT("[" BLAS_IMPL "] cblas_dasum");
 
     absSum = cblas_dasum(n, x, incX);
@@ -90,6 +104,11 @@ template <typename IndexType>
 typename If<IndexType>::isBlasCompatibleInteger
 asum(IndexType n, const ComplexFloat *x, IndexType incX, float &absSum)
 {
+    if (Reproducible::enabled()) {
+        asum_reproducible(n, x, incX, absSum);
+        return;
+    }
+
     CXXBLAS_DEBUG_OUT("[" BLAS_IMPL "] cblas_scasum");
 
     absSum = cblas_scasum(n, reinterpret_cast<const float *>(x), incX);
@@ -100,6 +119,11 @@ template <typename IndexType>
 typename If<IndexType>::isBlasCompatibleInteger
 asum(IndexType n, const ComplexDouble *x, IndexType incX, double &absSum)
 {
+    if (Reproducible::enabled()) {
+        asum_reproducible(n, x, incX, absSum);
+        return;
+    }
+
     CXXBLAS_DEBUG_OUT("[" BLAS_IMPL "] cblas_dzasum");
 
     absSum = cblas_dzasum(n, reinterpret_cast<const double *>(x), incX);
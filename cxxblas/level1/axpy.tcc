@@ -55,6 +55,9 @@ void
 axpy(IndexType n, const ALPHA &alpha, const X *x,
      IndexType incX, Y *y, IndexType incY)
 {
+    CXXBLAS_PROFILE_SCOPE("axpy", ProfileGeneric, n,
+                          (IsComplex<Y>::value ? 8. : 2.)*n,
+                          3.*n*sizeof(Y));
     if (incX<0) {
         x -= incX*(n-1);
     }
@@ -72,8 +75,22 @@ typename If<IndexType>::isBlasCompatibleInteger
 axpy(IndexType n, const float &alpha, const float *x, IndexType incX,
      float *y, IndexType incY)
 {
+    if (!BlasDispatch::useExternal(DispatchAxpy, n)) {
+        CXXBLAS_PROFILE_SCOPE("axpy", ProfileGeneric, n, 2.*n,
+                              3.*n*sizeof(float));
+        if (incX<0) {
+            x -= incX*(n-1);
+        }
+        if (incY<0) {
+            y -= incY*(n-1);
+        }
+        axpy_generic(n, alpha, x, incX, y, incY);
+        return;
+    }
+
     CXXBLAS_DEBUG_OUT("[" BLAS_IMPL "] cblas_saxpy");
 
+    CXXBLAS_PROFILE_SCOPE("axpy", ProfileCblas, n, 2.*n, 3.*n*sizeof(float));
     cblas_saxpy(n, alpha, x, incX, y, incY);
 }
 
@@ -83,8 +100,22 @@ typename If<IndexType>::isBlasCompatibleInteger
 axpy(IndexType n, const double &alpha, const double *x, IndexType incX,
      double *y, IndexType incY)
 {
+    if (!BlasDispatch::useExternal(DispatchAxpy, n)) {
+        CXXBLAS_PROFILE_SCOPE("axpy", ProfileGeneric, n, 2.*n,
+                              3.*n*sizeof(double));
+        if (incX<0) {
+            x -= incX*(n-1);
+        }
+        if (incY<0) {
+            y -= incY*(n-1);
+        }
+        axpy_generic(n, alpha, x, incX, y, incY);
+        return;
+    }
+
     CXXBLAS_DEBUG_OUT("[" BLAS_IMPL "] cblas_daxpy");
 
+    CXXBLAS_PROFILE_SCOPE("axpy", ProfileCblas, n, 2.*n, 3.*n*sizeof(double));
     cblas_daxpy(n, alpha, x, incX, y, incY);
 }
 
@@ -95,8 +126,23 @@ axpy(IndexType n, const ComplexFloat &alpha,
      const ComplexFloat *x, IndexType incX,
      ComplexFloat *y, IndexType incY)
 {
+    if (!BlasDispatch::useExternal(DispatchAxpy, n)) {
+        CXXBLAS_PROFILE_SCOPE("axpy", ProfileGeneric, n, 8.*n,
+                              3.*n*sizeof(ComplexFloat));
+        if (incX<0) {
+            x -= incX*(n-1);
+        }
+        if (incY<0) {
+            y -= incY*(n-1);
+        }
+        axpy_generic(n, alpha, x, incX, y, incY);
+        return;
+    }
+
     CXXBLAS_DEBUG_OUT("[" BLAS_IMPL "] cblas_caxpy");
 
+    CXXBLAS_PROFILE_SCOPE("axpy", ProfileCblas, n, 8.*n,
+                          3.*n*sizeof(ComplexFloat));
     cblas_caxpy(n, reinterpret_cast<const float *>(&alpha),
                    reinterpret_cast<const float *>(x), incX,
                    reinterpret_cast<float *>(y), incY);
@@ -109,8 +155,23 @@ axpy(IndexType n, const ComplexDouble &alpha,
      const ComplexDouble *x, IndexType incX,
      ComplexDouble *y, IndexType incY)
 {
+    if (!BlasDispatch::useExternal(DispatchAxpy, n)) {
+        CXXBLAS_PROFILE_SCOPE("axpy", ProfileGeneric, n, 8.*n,
+                              3.*n*sizeof(ComplexDouble));
+        if (incX<0) {
+            x -= incX*(n-1);
+        }
+        if (incY<0) {
+            y -= incY*(n-1);
+        }
+        axpy_generic(n, alpha, x, incX, y, incY);
+        return;
+    }
+
     CXXBLAS_DEBUG_OUT("[" BLAS_IMPL "] cblas_zaxpy");
 
+    CXXBLAS_PROFILE_SCOPE("axpy", ProfileCblas, n, 8.*n,
+                          3.*n*sizeof(ComplexDouble));
     cblas_zaxpy(n, reinterpret_cast<const double *>(&alpha),
                    reinterpret_cast<const double *>(x), incX,
                    reinterpret_cast<double *>(y), incY);
@@ -74,6 +74,13 @@ dotu(IndexType n,
      const X *x, IndexType incX, const Y *y, IndexType incY,
      Result &result)
 {
+    CXXBLAS_PROFILE_SCOPE("dot", ProfileGeneric, n,
+                          (IsComplex<Result>::value ? 8. : 2.)*n,
+                          2.*n*sizeof(Result));
+    if (Reproducible::enabled()) {
+        dotu_reproducible(n, x, incX, y, incY, result);
+        return;
+    }
     if (incX<0) {
         x -= incX*(n-1);
     }
@@ -89,6 +96,13 @@ dot(IndexType n,
     const X *x, IndexType incX, const Y *y, IndexType incY,
     Result &result)
 {
+    CXXBLAS_PROFILE_SCOPE("dot", ProfileGeneric, n,
+                          (IsComplex<Result>::value ? 8. : 2.)*n,
+                          2.*n*sizeof(Result));
+    if (Reproducible::enabled()) {
+        dot_reproducible(n, x, incX, y, incY, result);
+        return;
+    }
     if (incX<0) {
         x -= incX*(n-1);
     }
@@ -121,6 +135,11 @@ dot(IndexType n,
     const float *y, IndexType incY,
     double &result)
 {
+    if (Reproducible::enabled()) {
+        dot_reproducible(n, x, incX, y, incY, result);
+        return;
+    }
+
     CXXBLAS_DEBUG_OUT("[" BLAS_IMPL "] cblas_dsdot");
 
     result = cblas_dsdot(n, x, incX, y, incY);
@@ -134,8 +153,27 @@ dot(IndexType n,
     const float  *y, IndexType incY,
     float &result)
 {
+    if (Reproducible::enabled()) {
+        dot_reproducible(n, x, incX, y, incY, result);
+        return;
+    }
+
+    if (!BlasDispatch::useExternal(DispatchDot, n)) {
+        CXXBLAS_PROFILE_SCOPE("dot", ProfileGeneric, n, 2.*n,
+                              2.*n*sizeof(float));
+        if (incX<0) {
+            x -= incX*(n-1);
+        }
+        if (incY<0) {
+            y -= incY*(n-1);
+        }
+        dot_generic(n, x, incX, y, incY, result);
+        return;
+    }
+
     CXXBLAS_DEBUG_OUT("[" BLAS_IMPL "] cblas_sdot");
 
+    CXXBLAS_PROFILE_SCOPE("dot", ProfileCblas, n, 2.*n, 2.*n*sizeof(float));
     result = cblas_sdot(n, x, incX, y, incY);
 }
 
@@ -147,8 +185,27 @@ dot(IndexType n,
     const double *y, IndexType incY,
     double &result)
 {
+    if (Reproducible::enabled()) {
+        dot_reproducible(n, x, incX, y, incY, result);
+        return;
+    }
+
+    if (!BlasDispatch::useExternal(DispatchDot, n)) {
+        CXXBLAS_PROFILE_SCOPE("dot", ProfileGeneric, n, 2.*n,
+                              2.*n*sizeof(double));
+        if (incX<0) {
+            x -= incX*(n-1);
+        }
+        if (incY<0) {
+            y -= incY*(n-1);
+        }
+        dot_generic(n, x, incX, y, incY, result);
+        return;
+    }
+
     CXXBLAS_DEBUG_OUT("[" BLAS_IMPL "] cblas_ddot");
 
+    CXXBLAS_PROFILE_SCOPE("dot", ProfileCblas, n, 2.*n, 2.*n*sizeof(double));
     result = cblas_ddot(n, x, incX, y, incY);
 }
 
@@ -160,8 +217,28 @@ dotu(IndexType n,
      const ComplexFloat  *y, IndexType incY,
      ComplexFloat &result)
 {
+    if (Reproducible::enabled()) {
+        dotu_reproducible(n, x, incX, y, incY, result);
+        return;
+    }
+
+    if (!BlasDispatch::useExternal(DispatchDot, n)) {
+        CXXBLAS_PROFILE_SCOPE("dot", ProfileGeneric, n, 8.*n,
+                              2.*n*sizeof(ComplexFloat));
+        if (incX<0) {
+            x -= incX*(n-1);
+        }
+        if (incY<0) {
+            y -= incY*(n-1);
+        }
+        dotu_generic(n, x, incX, y, incY, result);
+        return;
+    }
+
     CXXBLAS_DEBUG_OUT("[" BLAS_IMPL "] cblas_cdotu_sub");
 
+    CXXBLAS_PROFILE_SCOPE("dot", ProfileCblas, n, 8.*n,
+                          2.*n*sizeof(ComplexFloat));
     cblas_cdotu_sub(n, reinterpret_cast<const float *>(x), incX,
                        reinterpret_cast<const float *>(y), incY,
                        reinterpret_cast<float *>(&result));
@@ -176,8 +253,28 @@ dot(IndexType n,
     const ComplexFloat  *y, IndexType incY,
     ComplexFloat &result)
 {
+    if (Reproducible::enabled()) {
+        dot_reproducible(n, x, incX, y, incY, result);
+        return;
+    }
+
+    if (!BlasDispatch::useExternal(DispatchDot, n)) {
+        CXXBLAS_PROFILE_SCOPE("dot", ProfileGeneric, n, 8.*n,
+                              2.*n*sizeof(ComplexFloat));
+        if (incX<0) {
+            x -= incX*(n-1);
+        }
+        if (incY<0) {
+            y -= incY*(n-1);
+        }
+        dot_generic(n, x, incX, y, incY, result);
+        return;
+    }
+
     CXXBLAS_DEBUG_OUT("[" BLAS_IMPL "] cblas_cdotc_sub");
 
+    CXXBLAS_PROFILE_SCOPE("dot", ProfileCblas, n, 8.*n,
+                          2.*n*sizeof(ComplexFloat));
     cblas_cdotc_sub(n, reinterpret_cast<const float *>(x), incX,
                        reinterpret_cast<const float *>(y), incY,
                        reinterpret_cast<float *>(&result));
@@ -191,8 +288,28 @@ dotu(IndexType n,
      const ComplexDouble *y, IndexType incY,
      ComplexDouble &result)
 {
+    if (Reproducible::enabled()) {
+        dotu_reproducible(n, x, incX, y, incY, result);
+        return;
+    }
+
+    if (!BlasDispatch::useExternal(DispatchDot, n)) {
+        CXXBLAS_PROFILE_SCOPE("dot", ProfileGeneric, n, 8.*n,
+                              2.*n*sizeof(ComplexDouble));
+        if (incX<0) {
+            x -= incX*(n-1);
+        }
+        if (incY<0) {
+            y -= incY*(n-1);
+        }
+        dotu_generic(n, x, incX, y, incY, result);
+        return;
+    }
+
     CXXBLAS_DEBUG_OUT("[" BLAS_IMPL "] cblas_zdotu_sub");
 
+    CXXBLAS_PROFILE_SCOPE("dot", ProfileCblas, n, 8.*n,
+                          2.*n*sizeof(ComplexDouble));
     cblas_zdotu_sub(n, reinterpret_cast<const double *>(x), incX,
                        reinterpret_cast<const double *>(y), incY,
                        reinterpret_cast<double *>(&result));
@@ -206,8 +323,28 @@ dot(IndexType n,
     const ComplexDouble *y, IndexType incY,
     ComplexDouble &result)
 {
+    if (Reproducible::enabled()) {
+        dot_reproducible(n, x, incX, y, incY, result);
+        return;
+    }
+
+    if (!BlasDispatch::useExternal(DispatchDot, n)) {
+        CXXBLAS_PROFILE_SCOPE("dot", ProfileGeneric, n, 8.*n,
+                              2.*n*sizeof(ComplexDouble));
+        if (incX<0) {
+            x -= incX*(n-1);
+        }
+        if (incY<0) {
+            y -= incY*(n-1);
+        }
+        dot_generic(n, x, incX, y, incY, result);
+        return;
+    }
+
     CXXBLAS_DEBUG_OUT("[" BLAS_IMPL "] cblas_zdotc_sub");
 
+    CXXBLAS_PROFILE_SCOPE("dot", ProfileCblas, n, 8.*n,
+                          2.*n*sizeof(ComplexDouble));
     cblas_zdotc_sub(n, reinterpret_cast<const double *>(x), incX,
                        reinterpret_cast<const double *>(y), incY,
                        reinterpret_cast<double *>(&result));
@@ -33,17 +33,103 @@
 #ifndef CXXBLAS_LEVEL1_NRM2_H
 #define CXXBLAS_LEVEL1_NRM2_H 1
 
+#include <cxxstd/limits.h>
+#include <cxxblas/auxiliary/isieeefloat.h>
+#include <cxxblas/auxiliary/restrictto.h>
 #include <cxxblas/drivers/drivers.h>
 #include <cxxblas/typedefs.h>
 
 #define HAVE_CXXBLAS_NRM2 1
 
+//
+//  Number of independent partial sums in the generic nrm2.  They hide the
+//  latency of the floating point additions.
+//
+#ifndef NRM2_LANES
+#define NRM2_LANES          8
+#endif
+
+//
+//  With OpenMP contiguous vectors of at least this length get split among
+//  the threads
+//
+#ifndef NRM2_PARALLEL_MIN
+#define NRM2_PARALLEL_MIN   65536
+#endif
+
 namespace cxxblas {
 
 template <typename IndexType, typename X, typename T>
     void
     nrm2(IndexType n, const X *x, IndexType incX, T &norm);
 
+//
+//  Blue's algorithm:  The squares of the entries are summed up in three
+//  accumulators for small, medium and big entries.  Small and big entries
+//  get scaled by a power of the radix before they are squared, so neither
+//  underflow nor overflow can occur.  Unlike the classic scaling of LAPACK's
+//  xLASSQ there is no division and no data dependent branch per entry.
+//
+template <typename T>
+struct Nrm2Blue
+{
+    typedef std::numeric_limits<T>  Limits;
+
+    // entries below tsml get scaled by ssml, entries above tbig by sbig
+    static T
+    tsml();
+
+    static T
+    tbig();
+
+    static T
+    ssml();
+
+    static T
+    sbig();
+
+    static T
+    power(const T &exponent);
+};
+
+//
+//  Adds the squares of x[0], x[incX], ..., x[(n-1)*incX] to the accumulators
+//  asml, amed and abig.  Vectorized backends overload this kernel.
+//
+template <typename IndexType, typename X, typename T>
+    void
+    nrm2_blue(IndexType n, const X *x, IndexType incX,
+              T &asml, T &amed, T &abig);
+
+//
+//  Updates scale and sumsq such that on exit
+//
+//      scale^2 * sumsq = x^H*x + scale_in^2 * sumsq_in
+//
+//  like LAPACK's xLASSQ.  For IEEE types Blue's algorithm is used.
+//
+template <typename IndexType, typename X, typename T>
+    typename RestrictTo<IsIEEEFloat<T>::value,
+             void>::Type
+    nrm2_sumsq(IndexType n, const X *x, IndexType incX, T &scale, T &sumsq);
+
+template <typename IndexType, typename X, typename T>
+    typename RestrictTo<IsIEEEFloat<T>::value,
+             void>::Type
+    nrm2_sumsq(IndexType n, const Complex<X> *x, IndexType incX,
+               T &scale, T &sumsq);
+
+template <typename IndexType, typename X, typename T>
+    typename RestrictTo<!IsIEEEFloat<T>::value,
+             void>::Type
+    nrm2_sumsq(IndexType n, const X *x, IndexType incX, T &scale, T &sumsq);
+
+template <typename IndexType, typename X, typename T>
+    typename RestrictTo<!IsIEEEFloat<T>::value,
+             void>::Type
+    nrm2_sumsq(IndexType n, const Complex<X> *x, IndexType incX,
+               T &scale, T &sumsq);
+
 #ifdef HAVE_CBLAS
 
 // snrm2
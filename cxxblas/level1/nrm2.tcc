@@ -33,94 +33,347 @@
 #ifndef CXXBLAS_LEVEL1_NRM2_TCC
 #define CXXBLAS_LEVEL1_NRM2_TCC 1
 
+#include <cxxstd/algorithm.h>
+#include <cxxstd/cmath.h>
+#include <cxxstd/limits.h>
 #include <cxxblas/cxxblas.h>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 namespace cxxblas {
 
+//-- Nrm2Blue ------------------------------------------------------------------
+//
+//  Thresholds and scaling factors are the ones of LAPACK 3.10 (la_constants)
+//
+template <typename T>
+T
+Nrm2Blue<T>::tsml()
+{
+    using std::ceil;
+    return power(ceil(T(Limits::min_exponent-1)/2));
+}
+
+template <typename T>
+T
+Nrm2Blue<T>::tbig()
+{
+    using std::floor;
+    return power(floor(T(Limits::max_exponent-Limits::digits+1)/2));
+}
+
+template <typename T>
+T
+Nrm2Blue<T>::ssml()
+{
+    using std::floor;
+    return power(-floor(T(Limits::min_exponent-Limits::digits)/2));
+}
+
+template <typename T>
+T
+Nrm2Blue<T>::sbig()
+{
+    using std::ceil;
+    return power(-ceil(T(Limits::max_exponent+Limits::digits-1)/2));
+}
+
+template <typename T>
+T
+Nrm2Blue<T>::power(const T &exponent)
+{
+    return std::pow(T(Limits::radix), exponent);
+}
+
+//-- nrm2 ----------------------------------------------------------------------
+
+//
+//  For incX==1 the squares get summed up in NRM2_LANES independent partial
+//  sums.  Branches are well predictable as usually almost all entries are
+//  medium sized.  NaNs end up in the medium accumulator.
+//
 template <typename IndexType, typename X, typename T>
 void
-nrm2_generic(IndexType n, const X *x, IndexType incX, T &norm)
+nrm2_blue(IndexType n, const X *x, IndexType incX,
+          T &asml, T &amed, T &abig)
 {
-    CXXBLAS_DEBUG_OUT("nrm2_generic");
-
     using std::abs;
-    using cxxblas::pow;
+
+    const int  L = NRM2_LANES;
+    const T    Zero(0);
+
+    const T tsml = Nrm2Blue<T>::tsml(), tbig = Nrm2Blue<T>::tbig();
+    const T ssml = Nrm2Blue<T>::ssml(), sbig = Nrm2Blue<T>::sbig();
+
+    T sml[L], med[L], big[L];
+
+    for (int l=0; l<L; ++l) {
+        sml[l] = med[l] = big[l] = Zero;
+    }
+
+    IndexType i = 0;
+    if (incX==1) {
+        for (; i+L<=n; i+=L) {
+            for (int l=0; l<L; ++l) {
+                const T ax = abs(x[i+l]);
+
+                if (ax<tsml) {
+                    sml[l] += (ax*ssml)*(ax*ssml);
+                } else if (ax>tbig) {
+                    big[l] += (ax*sbig)*(ax*sbig);
+                } else {
+                    med[l] += ax*ax;
+                }
+            }
+        }
+    }
+    for (; i<n; ++i) {
+        const T ax = abs(x[i*incX]);
+
+        if (ax<tsml) {
+            sml[0] += (ax*ssml)*(ax*ssml);
+        } else if (ax>tbig) {
+            big[0] += (ax*sbig)*(ax*sbig);
+        } else {
+            med[0] += ax*ax;
+        }
+    }
+    for (int l=0; l<L; ++l) {
+        asml += sml[l];
+        amed += med[l];
+        abig += big[l];
+    }
+}
+
+//
+//  Like nrm2_blue but long contiguous vectors get split among the threads.
+//  Partial sums of the accumulators just get added up.
+//
+template <typename IndexType, typename X, typename T>
+void
+nrm2_blue_parallel(IndexType n, const X *x, IndexType incX,
+                   T &asml, T &amed, T &abig)
+{
+#   ifdef _OPENMP
+    if (incX==1 && n>=NRM2_PARALLEL_MIN
+     && !omp_in_parallel() && omp_get_max_threads()>1)
+    {
+        T sml = T(0), med = T(0), big = T(0);
+
+#       pragma omp parallel reduction(+:sml,med,big)
+        {
+            const IndexType p = omp_get_num_threads();
+            const IndexType t = omp_get_thread_num();
+            const IndexType i0 = (n*t)/p;
+            const IndexType i1 = (n*(t+1))/p;
+
+            nrm2_blue(i1-i0, x+i0, IndexType(1), sml, med, big);
+        }
+        asml += sml;
+        amed += med;
+        abig += big;
+        return;
+    }
+#   endif
+    nrm2_blue(n, x, incX, asml, amed, abig);
+}
+
+//
+//  Merges (scale, sumsq) with the accumulators and returns the result again
+//  as scale^2*sumsq (see LAPACK 3.10, la_lassq)
+//
+template <typename T>
+void
+nrm2_blue_combine(T asml, T amed, T abig, T &scale, T &sumsq)
+{
+    using std::isnan;
     using std::sqrt;
 
-    const T  Zero(0), One(1);
+    const T Zero(0), One(1);
 
-    if (n<1) {
-        norm = Zero;
-    } else if (n==1) {
-        norm = abs(*x);
-    } else {
-        T scale = 0;
-        T ssq = 1;
-//      The following loop is equivalent to this call to the LAPACK
-//      auxiliary routine:
-//      CALL DLASSQ( N, X, INCX, SCALE, SSQ )
+    const T tsml = Nrm2Blue<T>::tsml(), tbig = Nrm2Blue<T>::tbig();
+    const T ssml = Nrm2Blue<T>::ssml(), sbig = Nrm2Blue<T>::sbig();
+
+    if (isnan(scale) || isnan(sumsq)) {
+        return;
+    }
+    if (sumsq==Zero) {
+        scale = One;
+    }
+    if (scale==Zero) {
+        scale = One;
+        sumsq = Zero;
+    }
 //
-        for (IndexType i=0, iX=0; i<n; ++i, iX+=incX) {
-            if (x[iX]!=Zero) {
-                T absXi = abs(x[iX]);
-                if (scale<absXi) {
-                    ssq = One + ssq * pow(scale/absXi, 2);
-                    scale = absXi;
+//  Put the existing sum of squares into the respective accumulator
+//
+    if (sumsq>Zero) {
+        const T ax = scale*sqrt(sumsq);
+
+        if (ax>tbig) {
+            if (scale>One) {
+                const T s = scale*sbig;
+                abig += s*(s*sumsq);
+            } else {
+                abig += scale*(scale*(sbig*(sbig*sumsq)));
+            }
+        } else if (ax<tsml) {
+            if (abig==Zero) {
+                if (scale<One) {
+                    const T s = scale*ssml;
+                    asml += s*(s*sumsq);
                 } else {
-                    ssq += pow(absXi/scale, 2);
+                    asml += scale*(scale*(ssml*(ssml*sumsq)));
                 }
             }
+        } else {
+            amed += scale*(scale*sumsq);
+        }
+    }
+//
+//  Combine abig and amed or amed and asml if more than one accumulator
+//  was used
+//
+    if (abig>Zero) {
+        if (amed>Zero || isnan(amed)) {
+            abig += (amed*sbig)*sbig;
+        }
+        scale = One/sbig;
+        sumsq = abig;
+    } else if (asml>Zero) {
+        if (amed>Zero || isnan(amed)) {
+            const T ymed = sqrt(amed);
+            const T ysml = sqrt(asml)/ssml;
+            const T ymin = (ysml>ymed) ? ymed : ysml;
+            const T ymax = (ysml>ymed) ? ysml : ymed;
+
+            scale = One;
+            sumsq = ymax*ymax*(One+(ymin/ymax)*(ymin/ymax));
+        } else {
+            scale = One/ssml;
+            sumsq = asml;
+        }
+    } else {
+        scale = One;
+        sumsq = amed;
+    }
+}
+
+//
+//  Classic scaling of LAPACK's xLASSQ for types without IEEE arithmetic
+//  (e.g. mpfr).
+//
+template <typename X, typename T>
+void
+nrm2_lassq_update(const X &x, T &scale, T &sumsq)
+{
+    using std::abs;
+    using cxxblas::pow;
+
+    if (x!=X(0)) {
+        const T absX = abs(x);
+        if (scale<absX) {
+            sumsq = T(1) + sumsq*pow(scale/absX, 2);
+            scale = absX;
+        } else {
+            sumsq += pow(absX/scale, 2);
         }
-        norm = scale*sqrt(ssq);
+    }
+}
+
+template <typename IndexType, typename X, typename T>
+typename RestrictTo<IsIEEEFloat<T>::value,
+         void>::Type
+nrm2_sumsq(IndexType n, const X *x, IndexType incX, T &scale, T &sumsq)
+{
+    CXXBLAS_DEBUG_OUT("nrm2_sumsq [Blue]");
+
+    if (Reproducible::enabled()) {
+        nrm2_sumsq_reproducible(n, x, incX, scale, sumsq);
+        return;
+    }
+
+    T asml(0), amed(0), abig(0);
+
+    nrm2_blue_parallel(n, x, incX, asml, amed, abig);
+    nrm2_blue_combine(asml, amed, abig, scale, sumsq);
+}
+
+template <typename IndexType, typename X, typename T>
+typename RestrictTo<IsIEEEFloat<T>::value,
+         void>::Type
+nrm2_sumsq(IndexType n, const Complex<X> *x, IndexType incX,
+           T &scale, T &sumsq)
+{
+    CXXBLAS_DEBUG_OUT("nrm2_sumsq [Blue, complex]");
+
+    if (Reproducible::enabled()) {
+        nrm2_sumsq_reproducible(n, x, incX, scale, sumsq);
+        return;
+    }
+
+    T asml(0), amed(0), abig(0);
+
+    const X *xr = reinterpret_cast<const X *>(x);
+
+    if (incX==1) {
+        nrm2_blue_parallel(2*n, xr, IndexType(1), asml, amed, abig);
+    } else {
+        nrm2_blue(n, xr, 2*incX, asml, amed, abig);
+        nrm2_blue(n, xr+1, 2*incX, asml, amed, abig);
+    }
+    nrm2_blue_combine(asml, amed, abig, scale, sumsq);
+}
+
+template <typename IndexType, typename X, typename T>
+typename RestrictTo<!IsIEEEFloat<T>::value,
+         void>::Type
+nrm2_sumsq(IndexType n, const X *x, IndexType incX, T &scale, T &sumsq)
+{
+    CXXBLAS_DEBUG_OUT("nrm2_sumsq");
+
+    for (IndexType i=0, iX=0; i<n; ++i, iX+=incX) {
+        nrm2_lassq_update(x[iX], scale, sumsq);
+    }
+}
+
+template <typename IndexType, typename X, typename T>
+typename RestrictTo<!IsIEEEFloat<T>::value,
+         void>::Type
+nrm2_sumsq(IndexType n, const Complex<X> *x, IndexType incX,
+           T &scale, T &sumsq)
+{
+    CXXBLAS_DEBUG_OUT("nrm2_sumsq [complex]");
+
+    using std::imag;
+    using std::real;
+
+    for (IndexType i=0, iX=0; i<n; ++i, iX+=incX) {
+        nrm2_lassq_update(real(x[iX]), scale, sumsq);
+        nrm2_lassq_update(imag(x[iX]), scale, sumsq);
     }
 }
 
 template <typename IndexType, typename X, typename T>
 void
-nrm2_generic(IndexType n, const Complex<X> *x, IndexType incX, T &norm)
+nrm2_generic(IndexType n, const X *x, IndexType incX, T &norm)
 {
     CXXBLAS_DEBUG_OUT("nrm2_generic");
 
     using std::abs;
-    using std::imag;
-    using std::pow;
-    using std::real;
     using std::sqrt;
 
-    const T  Zero(0), One(1);
-
     if (n<1) {
-        norm = Zero;
+        norm = T(0);
     } else if (n==1) {
         norm = abs(*x);
     } else {
-        T scale = 0;
-        T ssq = 1;
-//      The following loop is equivalent to this call to the LAPACK
-//      auxiliary routine:
-//      CALL DLASSQ( N, X, INCX, SCALE, SSQ )
-//
-        for (IndexType i=0, iX=0; i<n; ++i, iX+=incX) {
-            if (real(x[iX]) != Zero) {
-                T absXi = abs(real(x[iX]));
-                if (scale<absXi) {
-                    ssq = One + ssq * pow(scale/absXi, 2);
-                    scale = absXi;
-                } else {
-                    ssq += pow(absXi/scale, 2);
-                }
-            }
-            if (imag(x[iX]) != Zero) {
-                T absXi = abs(imag(x[iX]));
-                if (scale<absXi) {
-                    ssq = One + ssq * pow(scale/absXi, 2);
-                    scale = absXi;
-                } else {
-                    ssq += pow(absXi/scale, 2);
-                }
-            }
-        }
-        norm = scale*sqrt(ssq);
+        T scale(0), sumsq(1);
+
+        nrm2_sumsq(n, x, incX, scale, sumsq);
+        norm = scale*sqrt(sumsq);
     }
 }
 
@@ -128,6 +381,10 @@ template <typename IndexType, typename X, typename T>
 void
 nrm2(IndexType n, const X *x, IndexType incX, T &norm)
 {
+    if (Reproducible::enabled()) {
+        nrm2_reproducible(n, x, incX, norm);
+        return;
+    }
     if (incX<0) {
         x -= incX*(n-1);
     }
@@ -141,6 +398,11 @@ template <typename IndexType>
 typename If<IndexType>::isBlasCompatibleInteger
 nrm2(IndexType n, const float *x, IndexType incX, float &norm)
 {
+    if (Reproducible::enabled()) {
+        nrm2_reproducible(n, x, incX, norm);
+        return;
+    }
+
     CXXBLAS_DEBUG_OUT("[" BLAS_IMPL "] cblas_snrm2");
 
     norm = cblas_snrm2(n, x, incX);
@@ -151,6 +413,11 @@ template <typename IndexType>
 typename If<IndexType>::isBlasCompatibleInteger
 nrm2(IndexType n, const double *x, IndexType incX, double &norm)
 {
+    if (Reproducible::enabled()) {
+        nrm2_reproducible(n, x, incX, norm);
+        return;
+    }
+
     CXXBLAS_DEBUG_OUT("[" BLAS_IMPL "] cblas_dnrm2");
 
     norm = cblas_dnrm2(n, x, incX);
@@ -161,6 +428,11 @@ template <typename IndexType>
 typename If<IndexType>::isBlasCompatibleInteger
 nrm2(IndexType n, const ComplexFloat *x, IndexType incX, float &norm)
 {
+    if (Reproducible::enabled()) {
+        nrm2_reproducible(n, x, incX, norm);
+        return;
+    }
+
     CXXBLAS_DEBUG_OUT("[" BLAS_IMPL "] cblas_scnrm2");
 
     norm = cblas_scnrm2(n, reinterpret_cast<const float *>(x), incX);
@@ -171,6 +443,11 @@ template <typename IndexType>
 typename If<IndexType>::isBlasCompatibleInteger
 nrm2(IndexType n, const ComplexDouble *x, IndexType incX, double &norm)
 {
+    if (Reproducible::enabled()) {
+        nrm2_reproducible(n, x, incX, norm);
+        return;
+    }
+
     CXXBLAS_DEBUG_OUT("[" BLAS_IMPL "] cblas_dznrm2");
 
     norm = cblas_dznrm2(n, reinterpret_cast<const double *>(x), incX);
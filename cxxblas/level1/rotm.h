@@ -36,14 +36,19 @@
 #include <cxxblas/drivers/drivers.h>
 #include <cxxblas/typedefs.h>
 
+#define HAVE_CXXBLAS_ROTM   1
+
 namespace cxxblas {
 
+template <typename IndexType, typename X, typename Y, typename T>
+    void
+    rotm(IndexType n, X *x, IndexType incX, Y *y, IndexType incY,
+         const T *p);
 
 #ifdef HAVE_CBLAS
 
-// TODO: provide generic implementation of rotm, rotmg
+// TODO: provide generic implementation of rotmg
 #define HAVE_CXXBLAS_ROTMG  1
-#define HAVE_CXXBLAS_ROTM   1
 
 // srotm
 template <typename IndexType>
@@ -38,6 +38,71 @@
 
 namespace cxxblas {
 
+/*
+ *  Note: The generic variant of function rotm is based on
+
+      SUBROUTINE DROTM(N,DX,INCX,DY,INCY,DPARAM)
+ *
+ *  -- Reference BLAS level1 routine (version 3.4.0) --
+ *  -- Reference BLAS is a software package provided by Univ. of Tennessee,
+ *  -- Univ. of California Berkeley, Univ. of Colorado Denver and NAG Ltd..--
+ *     November 2011
+ */
+template <typename IndexType, typename X, typename Y, typename T>
+void
+rotm_generic(IndexType n, X *x, IndexType incX, Y *y, IndexType incY,
+             const T *p)
+{
+    CXXBLAS_DEBUG_OUT("rotm_generic");
+
+    const T flag = p[0];
+
+    if (n<=0 || flag==T(-2)) {
+        return;
+    }
+    if (flag<T(0)) {
+        const T h11 = p[1], h21 = p[2], h12 = p[3], h22 = p[4];
+
+        for (IndexType i=0, iX=0, iY=0; i<n; ++i, iX+=incX, iY+=incY) {
+            const X w = x[iX];
+            const Y z = y[iY];
+            x[iX] = w*h11 + z*h12;
+            y[iY] = w*h21 + z*h22;
+        }
+    } else if (flag==T(0)) {
+        const T h21 = p[2], h12 = p[3];
+
+        for (IndexType i=0, iX=0, iY=0; i<n; ++i, iX+=incX, iY+=incY) {
+            const X w = x[iX];
+            const Y z = y[iY];
+            x[iX] = w + z*h12;
+            y[iY] = w*h21 + z;
+        }
+    } else {
+        const T h11 = p[1], h22 = p[4];
+
+        for (IndexType i=0, iX=0, iY=0; i<n; ++i, iX+=incX, iY+=incY) {
+            const X w = x[iX];
+            const Y z = y[iY];
+            x[iX] = w*h11 + z;
+            y[iY] = -w + h22*z;
+        }
+    }
+}
+
+template <typename IndexType, typename X, typename Y, typename T>
+void
+rotm(IndexType n, X *x, IndexType incX, Y *y, IndexType incY, const T *p)
+{
+    if (incX<0) {
+        x -= incX*(n-1);
+    }
+    if (incY<0) {
+        y -= incY*(n-1);
+    }
+    rotm_generic(n, x, incX, y, incY, p);
+}
+
 #ifdef HAVE_CBLAS
 
 // srotm
@@ -47,6 +47,11 @@ dotu(IndexType n,
      const Complex<float> *y, IndexType incY,
      Complex<float> &result)
 {
+    if (Reproducible::enabled()) {
+        dotu_reproducible(n, x, incX, y, incY, result);
+        return;
+    }
+
     CXXBLAS_DEBUG_OUT("[" BLAS_IMPL "] cblas_cdotu [extension] [real,complex]");
 
     const float *yr = reinterpret_cast<const float *>(y);
@@ -64,6 +69,11 @@ dotu(IndexType n,
      const float *y, IndexType incY,
      Complex<float> &result)
 {
+    if (Reproducible::enabled()) {
+        dotu_reproducible(n, x, incX, y, incY, result);
+        return;
+    }
+
     CXXBLAS_DEBUG_OUT("[" BLAS_IMPL "] cblas_cdotu [extension] [complex,real]");
 
     dotu(n, y, incY, x, incX, result);
@@ -77,6 +87,11 @@ dotu(IndexType n,
      const Complex<double> *y, IndexType incY,
      Complex<double> &result)
 {
+    if (Reproducible::enabled()) {
+        dotu_reproducible(n, x, incX, y, incY, result);
+        return;
+    }
+
     CXXBLAS_DEBUG_OUT("[" BLAS_IMPL "] cblas_zdotu [extension] [real,complex]");
 
     const double *yr = reinterpret_cast<const double *>(y);
@@ -94,6 +109,11 @@ dotu(IndexType n,
      const double *y, IndexType incY,
      Complex<double> &result)
 {
+    if (Reproducible::enabled()) {
+        dotu_reproducible(n, x, incX, y, incY, result);
+        return;
+    }
+
     CXXBLAS_DEBUG_OUT("[" BLAS_IMPL "] cblas_zdotu [extension] [complex,real]");
 
     dotu(n, y, incY, x, incX, result);
@@ -106,6 +126,11 @@ dot(IndexType n,
     const Complex<float> *y, IndexType incY,
     Complex<float> &result)
 {
+    if (Reproducible::enabled()) {
+        dot_reproducible(n, x, incX, y, incY, result);
+        return;
+    }
+
     CXXBLAS_DEBUG_OUT("[" BLAS_IMPL "] cblas_cdot [extension] [real,complex]");
 
     dotu(n, x, incX, y, incY, result);
@@ -118,6 +143,11 @@ dot(IndexType n,
     const float *y, IndexType incY,
     Complex<float> &result)
 {
+    if (Reproducible::enabled()) {
+        dot_reproducible(n, x, incX, y, incY, result);
+        return;
+    }
+
     CXXBLAS_DEBUG_OUT("[" BLAS_IMPL "] cblas_cdot [extension] [complex,real]");
 
     const float *xr = reinterpret_cast<const float *>(x);
@@ -135,6 +165,11 @@ dot(IndexType n,
     const Complex<double> *y, IndexType incY,
     Complex<double> &result)
 {
+    if (Reproducible::enabled()) {
+        dot_reproducible(n, x, incX, y, incY, result);
+        return;
+    }
+
     CXXBLAS_DEBUG_OUT("[" BLAS_IMPL "] cblas_zdot [extension] [real, complex]");
 
     dotu(n, x, incX, y, incY, result);
@@ -147,6 +182,11 @@ dot(IndexType n,
     const double *y, IndexType incY,
     Complex<double> &result)
 {
+    if (Reproducible::enabled()) {
+        dot_reproducible(n, x, incX, y, incY, result);
+        return;
+    }
+
     CXXBLAS_DEBUG_OUT("[" BLAS_IMPL "] cblas_zdot [extension] [complex, real]");
 
     const double *xr = reinterpret_cast<const double *>(x);
@@ -58,6 +58,7 @@
 #include <cxxblas/level1extensions/syscal.h>
 #include <cxxblas/level1extensions/racxpy.h>
 #include <cxxblas/level1extensions/raxpy.h>
+#include <cxxblas/level1extensions/reproducible.h>
 #include <cxxblas/level1extensions/rscal.h>
 #include <cxxblas/level1extensions/traxpby.h>
 #include <cxxblas/level1extensions/traxpy.h>
@@ -58,6 +58,7 @@
 #include <cxxblas/level1extensions/syscal.tcc>
 #include <cxxblas/level1extensions/racxpy.tcc>
 #include <cxxblas/level1extensions/raxpy.tcc>
+#include <cxxblas/level1extensions/reproducible.tcc>
 #include <cxxblas/level1extensions/rscal.tcc>
 #include <cxxblas/level1extensions/traxpby.tcc>
 #include <cxxblas/level1extensions/traxpy.tcc>
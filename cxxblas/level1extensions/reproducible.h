@@ -0,0 +1,169 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef CXXBLAS_LEVEL1EXTENSIONS_REPRODUCIBLE_H
+#define CXXBLAS_LEVEL1EXTENSIONS_REPRODUCIBLE_H 1
+
+#include <cxxstd/limits.h>
+#include <cxxblas/auxiliary/isieeefloat.h>
+#include <cxxblas/auxiliary/restrictto.h>
+#include <cxxblas/drivers/drivers.h>
+#include <cxxblas/typedefs.h>
+
+//
+//  Number of extraction levels (folds).  Each fold captures about
+//  digits-log2(n)-2 bits of the sum, with three folds the result of a
+//  reproducible double sum is usually as accurate as the one of a
+//  conventional summation.
+//
+#ifndef REPRO_FOLDS
+#define REPRO_FOLDS         3
+#endif
+
+//
+//  Number of independent partial sums per fold
+//
+#ifndef REPRO_LANES
+#define REPRO_LANES         8
+#endif
+
+//
+//  With OpenMP vectors of at least this length get split among the threads
+//
+#ifndef REPRO_PARALLEL_MIN
+#define REPRO_PARALLEL_MIN  65536
+#endif
+
+//
+//  Reproducible reductions.  Summands get pre-rounded as proposed by Demmel
+//  and Nguyen (and used in ReproBLAS):  In a first pass the maximum M of
+//  the absolute values is determined.  Depending only on M and n a sequence
+//  of extractors E_1 > E_2 > ... is chosen such that
+//
+//      q = (E_k + r) - E_k,    r -= q
+//
+//  splits off the leading bits of a summand r on a fixed grid and all sums
+//  of such q are exact.  Hence the partial sums of each fold do not depend
+//  on the order of summation, i.e. on the number of threads, the number of
+//  lanes or the vector width.  Only the folds are finally added in a fixed
+//  order.
+//
+//  Requirements:  IEEE arithmetic with rounding to nearest and no
+//  reassociation by the compiler (-ffast-math).  Bitwise identical results
+//  are guaranteed for the same executable.  Different builds agree as long
+//  as products are not contracted to FMAs (GCC in ISO mode, e.g.
+//  -std=c++11, uses -ffp-contract=off).
+//
+//  Sums of float get accumulated in double.  For types without IEEE
+//  arithmetic (e.g. mpfr) the reductions are plain sequential loops.  Inf
+//  and NaN entries are summed up sequentially.
+//
+
+namespace cxxblas {
+
+template <typename T>
+struct ReproAccumulator
+{
+    typedef T   Type;
+};
+
+template <>
+struct ReproAccumulator<float>
+{
+    typedef double  Type;
+};
+
+//
+//  Returns op(0) + ... + op(n-1)
+//
+template <typename T, typename IndexType, typename Op>
+    typename RestrictTo<IsIEEEFloat<T>::value,
+             T>::Type
+    reprosum(IndexType n, const Op &op);
+
+template <typename T, typename IndexType, typename Op>
+    typename RestrictTo<!IsIEEEFloat<T>::value,
+             T>::Type
+    reprosum(IndexType n, const Op &op);
+
+//
+//  Returns max |op(i)|, NaN if some op(i) is Inf or NaN
+//
+template <typename T, typename IndexType, typename Op>
+    T
+    repromax(IndexType n, const Op &op);
+
+//
+//  Reproducible variants of the level 1 reductions.  Arguments are the
+//  same as for sum, asum, dotu, dot and nrm2.
+//
+template <typename IndexType, typename X, typename T>
+    void
+    sum_reproducible(IndexType n, const X *x, IndexType incX, T &sum);
+
+template <typename IndexType, typename X, typename T>
+    void
+    sum_reproducible(IndexType n, const Complex<X> *x, IndexType incX,
+                     Complex<T> &sum);
+
+template <typename IndexType, typename X, typename T>
+    void
+    asum_reproducible(IndexType n, const X *x, IndexType incX, T &absSum);
+
+template <typename IndexType, typename X, typename Y, typename Result>
+    void
+    dotu_reproducible(IndexType n,
+                      const X *x, IndexType incX, const Y *y, IndexType incY,
+                      Result &result);
+
+template <typename IndexType, typename X, typename Y, typename Result>
+    void
+    dot_reproducible(IndexType n,
+                     const X *x, IndexType incX, const Y *y, IndexType incY,
+                     Result &result);
+
+template <typename IndexType, typename X, typename T>
+    void
+    nrm2_reproducible(IndexType n, const X *x, IndexType incX, T &norm);
+
+//
+//  Reproducible variant of nrm2_sumsq (updates scale and sumsq like
+//  LAPACK's xLASSQ)
+//
+template <typename IndexType, typename X, typename T>
+    void
+    nrm2_sumsq_reproducible(IndexType n, const X *x, IndexType incX,
+                            T &scale, T &sumsq);
+
+} // namespace cxxblas
+
+#endif // CXXBLAS_LEVEL1EXTENSIONS_REPRODUCIBLE_H
@@ -0,0 +1,733 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef CXXBLAS_LEVEL1EXTENSIONS_REPRODUCIBLE_TCC
+#define CXXBLAS_LEVEL1EXTENSIONS_REPRODUCIBLE_TCC 1
+
+#include <cxxstd/algorithm.h>
+#include <cxxstd/cmath.h>
+#include <cxxstd/limits.h>
+#include <cxxblas/cxxblas.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace cxxblas {
+
+//-- summands ------------------------------------------------------------------
+
+//
+//  Strides known at compile time.  For contiguous vectors the summands get
+//  instantiated with ReproStride<1> (or ReproStride<2> for the parts of a
+//  complex vector), so the compiler can vectorize the loops.
+//
+template <int Inc>
+struct ReproStride
+{
+};
+
+template <typename IndexType, typename Inc>
+IndexType
+reproIndex(IndexType i, const Inc &inc)
+{
+    return i*inc;
+}
+
+template <typename IndexType, int Inc>
+IndexType
+reproIndex(IndexType i, const ReproStride<Inc> &)
+{
+    return i*Inc;
+}
+
+// x[i*incX]
+template <typename T, typename X, typename IncX>
+struct ReproValue
+{
+    ReproValue(const X *x_, const IncX &incX_)
+        : x(x_), incX(incX_)
+    {
+    }
+
+    template <typename IndexType>
+        T
+        operator()(IndexType i) const
+        {
+            return T(x[reproIndex(i, incX)]);
+        }
+
+    const X  *x;
+    IncX     incX;
+};
+
+// |real(x[i*incX])| + |imag(x[i*incX])|
+template <typename T, typename X, typename IncX>
+struct ReproAbsSum
+{
+    ReproAbsSum(const X *x_, const IncX &incX_)
+        : x(x_), incX(incX_)
+    {
+    }
+
+    template <typename IndexType>
+        T
+        operator()(IndexType i) const
+        {
+            using std::abs;
+
+            const X &xi = x[reproIndex(i, incX)];
+            return abs(cxxblas::real(xi)) + abs(cxxblas::imag(xi));
+        }
+
+    const X  *x;
+    IncX     incX;
+};
+
+// |s*x[i*incX]|^2
+template <typename T, typename X, typename IncX>
+struct ReproSquare
+{
+    ReproSquare(const X *x_, const IncX &incX_, const T &s_)
+        : x(x_), incX(incX_), s(s_)
+    {
+    }
+
+    template <typename IndexType>
+        T
+        operator()(IndexType i) const
+        {
+            const X &xi = x[reproIndex(i, incX)];
+            const T re  = s*cxxblas::real(xi);
+            const T im  = s*cxxblas::imag(xi);
+            return re*re + im*im;
+        }
+
+    const X  *x;
+    IncX     incX;
+    T        s;
+};
+
+// x[i*incX]*y[i*incY], x gets conjugated if Conj is true
+template <typename T, typename X, typename IncX, typename Y, typename IncY,
+          bool Conj>
+struct ReproProduct
+{
+    ReproProduct(const X *x_, const IncX &incX_,
+                 const Y *y_, const IncY &incY_)
+        : x(x_), incX(incX_), y(y_), incY(incY_)
+    {
+    }
+
+    template <typename IndexType>
+        T
+        operator()(IndexType i) const
+        {
+            const X &xi = x[reproIndex(i, incX)];
+            const Y &yi = y[reproIndex(i, incY)];
+            return (Conj ? T(conjugate(xi)) : T(xi))*T(yi);
+        }
+
+    const X  *x;
+    IncX     incX;
+    const Y  *y;
+    IncY     incY;
+};
+
+// real and imaginary part of op(i)
+template <typename T, typename Op>
+struct ReproReal
+{
+    ReproReal(const Op &op_)
+        : op(op_)
+    {
+    }
+
+    template <typename IndexType>
+        T
+        operator()(IndexType i) const
+        {
+            return cxxblas::real(op(i));
+        }
+
+    const Op  &op;
+};
+
+template <typename T, typename Op>
+struct ReproImag
+{
+    ReproImag(const Op &op_)
+        : op(op_)
+    {
+    }
+
+    template <typename IndexType>
+        T
+        operator()(IndexType i) const
+        {
+            return cxxblas::imag(op(i));
+        }
+
+    const Op  &op;
+};
+
+//-- repromax ------------------------------------------------------------------
+
+//
+//  NaN is sticky, apart from that this is max(a, b)
+//
+template <typename T>
+T
+repromax_update(const T &m, const T &a)
+{
+    using std::isnan;
+    return (a>m || isnan(a)) ? a : m;
+}
+
+//
+//  The test for Inf and NaN is kept out of the comparisons, so the loop can
+//  be vectorized:  a-a is zero for finite a and NaN otherwise.
+//
+template <typename T, typename IndexType, typename Op>
+T
+repromax_kernel(IndexType i0, IndexType i1, const Op &op)
+{
+    using std::abs;
+
+    const int L = REPRO_LANES;
+
+    T m[L], nonFinite[L];
+
+    for (int l=0; l<L; ++l) {
+        m[l] = nonFinite[l] = T(0);
+    }
+
+    IndexType i = i0;
+    for (; i+L<=i1; i+=L) {
+        for (int l=0; l<L; ++l) {
+            const T a = abs(op(i+l));
+
+            m[l] = (a>m[l]) ? a : m[l];
+            nonFinite[l] += a-a;
+        }
+    }
+
+    T mt = T(0), nonFiniteT = T(0);
+    for (; i<i1; ++i) {
+        const T a = abs(op(i));
+
+        mt = (a>mt) ? a : mt;
+        nonFiniteT += a-a;
+    }
+    for (int l=0; l<L; ++l) {
+        mt = repromax_update(mt, m[l]);
+        nonFiniteT += nonFinite[l];
+    }
+    return mt + nonFiniteT;
+}
+
+template <typename T, typename IndexType, typename Op>
+T
+repromax(IndexType n, const Op &op)
+{
+#   ifdef _OPENMP
+    if (n>=REPRO_PARALLEL_MIN
+     && !omp_in_parallel() && omp_get_max_threads()>1)
+    {
+        T maxAbs = T(0);
+
+#       pragma omp parallel
+        {
+            const IndexType p = omp_get_num_threads();
+            const IndexType t = omp_get_thread_num();
+            const IndexType i0 = (n*t)/p;
+            const IndexType i1 = (n*(t+1))/p;
+
+            const T m = repromax_kernel<T>(i0, i1, op);
+
+#           pragma omp critical (cxxblas_repromax)
+            maxAbs = repromax_update(maxAbs, m);
+        }
+        return maxAbs;
+    }
+#   endif
+    return repromax_kernel<T>(IndexType(0), n, op);
+}
+
+//-- reprosum ------------------------------------------------------------------
+
+//
+//  Extractors for n summands bounded by maxAbs.  Each fold captures
+//  W = digits-L-2 bits where 2^L >= n.  So neither the extractors nor the
+//  partial sums overflow and all extractors are normalized numbers the
+//  summands get scaled by 2^shift.
+//
+template <typename A, typename IndexType>
+void
+reprosum_extractors(const A &maxAbs, IndexType n, A *extractor, int &shift)
+{
+    typedef std::numeric_limits<A>  Limits;
+
+    using std::frexp;
+    using std::ldexp;
+
+    const int F = REPRO_FOLDS;
+
+    int L = 0;
+    for (IndexType k=n-1; k>0; k/=2) {
+        ++L;
+    }
+    const int W = Limits::digits - L - 2;
+    ASSERT(W>0);
+
+    int m;
+    frexp(maxAbs, &m);
+
+    const int e1 = m + L + 1;
+    const int eF = e1 - (F-1)*W;
+
+    shift = 0;
+    if (e1>Limits::max_exponent-2) {
+        shift = Limits::max_exponent-2 - e1;
+    } else if (eF<Limits::min_exponent-1) {
+        shift = Limits::min_exponent-1 - eF;
+    }
+    for (int k=0; k<F; ++k) {
+        extractor[k] = ldexp(A(1.5), e1+shift-k*W);
+    }
+}
+
+//
+//  Adds the pre-rounded summands op(i0), ..., op(i1-1) to the folds.  All
+//  additions to s[k][l] are exact.
+//
+template <typename A, typename IndexType, typename Op>
+void
+reprosum_deposit(IndexType i0, IndexType i1, const Op &op,
+                 const A *extractor, const A &scale, A *sum)
+{
+    const int L = REPRO_LANES;
+    const int F = REPRO_FOLDS;
+
+    A E[F], s[F][L];
+
+    for (int k=0; k<F; ++k) {
+        E[k] = extractor[k];
+        for (int l=0; l<L; ++l) {
+            s[k][l] = A(0);
+        }
+    }
+
+    IndexType i = i0;
+    for (; i+L<=i1; i+=L) {
+        for (int l=0; l<L; ++l) {
+            A r = A(op(i+l))*scale;
+            for (int k=0; k<F; ++k) {
+                const A q = (E[k]+r)-E[k];
+                s[k][l] += q;
+                r -= q;
+            }
+        }
+    }
+    for (; i<i1; ++i) {
+        A r = A(op(i))*scale;
+        for (int k=0; k<F; ++k) {
+            const A q = (E[k]+r)-E[k];
+            s[k][0] += q;
+            r -= q;
+        }
+    }
+    for (int k=0; k<F; ++k) {
+        for (int l=0; l<L; ++l) {
+            sum[k] += s[k][l];
+        }
+    }
+}
+
+//
+//  Like reprosum_deposit but long vectors get split among the threads.  As
+//  the partial sums are exact they can be merged in any order.
+//
+template <typename A, typename IndexType, typename Op>
+void
+reprosum_deposit_parallel(IndexType n, const Op &op,
+                          const A *extractor, const A &scale, A *sum)
+{
+#   ifdef _OPENMP
+    if (n>=REPRO_PARALLEL_MIN
+     && !omp_in_parallel() && omp_get_max_threads()>1)
+    {
+        const int F = REPRO_FOLDS;
+
+#       pragma omp parallel
+        {
+            const IndexType p = omp_get_num_threads();
+            const IndexType t = omp_get_thread_num();
+            const IndexType i0 = (n*t)/p;
+            const IndexType i1 = (n*(t+1))/p;
+
+            A part[F];
+            for (int k=0; k<F; ++k) {
+                part[k] = A(0);
+            }
+            reprosum_deposit(i0, i1, op, extractor, scale, part);
+
+#           pragma omp critical (cxxblas_reprosum)
+            for (int k=0; k<F; ++k) {
+                sum[k] += part[k];
+            }
+        }
+        return;
+    }
+#   endif
+    reprosum_deposit(IndexType(0), n, op, extractor, scale, sum);
+}
+
+template <typename T, typename IndexType, typename Op>
+typename RestrictTo<IsIEEEFloat<T>::value,
+         T>::Type
+reprosum(IndexType n, const Op &op)
+{
+    typedef typename ReproAccumulator<T>::Type  A;
+
+    using std::isfinite;
+    using std::ldexp;
+
+    const int F = REPRO_FOLDS;
+
+    const T maxAbs = repromax<T>(n, op);
+
+    if (maxAbs==T(0)) {
+        return T(0);
+    }
+    if (!isfinite(maxAbs)) {
+        A sum = A(0);
+        for (IndexType i=0; i<n; ++i) {
+            sum += A(op(i));
+        }
+        return T(sum);
+    }
+
+    A   extractor[F], sum[F];
+    int shift;
+
+    reprosum_extractors(A(maxAbs), n, extractor, shift);
+    for (int k=0; k<F; ++k) {
+        sum[k] = A(0);
+    }
+    reprosum_deposit_parallel(n, op, extractor, ldexp(A(1), shift), sum);
+
+//
+//  Add up the folds in a fixed order, the smallest first
+//
+    A result = sum[F-1];
+    for (int k=F-2; k>=0; --k) {
+        result += sum[k];
+    }
+    return T(ldexp(result, -shift));
+}
+
+template <typename T, typename IndexType, typename Op>
+typename RestrictTo<!IsIEEEFloat<T>::value,
+         T>::Type
+reprosum(IndexType n, const Op &op)
+{
+    T sum = T(0);
+    for (IndexType i=0; i<n; ++i) {
+        sum += op(i);
+    }
+    return sum;
+}
+
+//-- sum -----------------------------------------------------------------------
+
+template <typename IndexType, typename X, typename T>
+void
+sum_reproducible(IndexType n, const X *x, IndexType incX, T &sum)
+{
+    CXXBLAS_DEBUG_OUT("sum_reproducible");
+
+    typedef ReproStride<1>  Unit;
+
+    if (incX<0) {
+        x -= incX*(n-1);
+    }
+    if (incX==1) {
+        sum = reprosum<T>(n, ReproValue<T, X, Unit>(x, Unit()));
+    } else {
+        sum = reprosum<T>(n, ReproValue<T, X, IndexType>(x, incX));
+    }
+}
+
+template <typename IndexType, typename X, typename T>
+void
+sum_reproducible(IndexType n, const Complex<X> *x, IndexType incX,
+                 Complex<T> &sum)
+{
+    CXXBLAS_DEBUG_OUT("sum_reproducible [complex]");
+
+    typedef ReproStride<2>  Two;
+
+    if (incX<0) {
+        x -= incX*(n-1);
+    }
+
+    const X *xr = reinterpret_cast<const X *>(x);
+
+    T re, im;
+    if (incX==1) {
+        re = reprosum<T>(n, ReproValue<T, X, Two>(xr, Two()));
+        im = reprosum<T>(n, ReproValue<T, X, Two>(xr+1, Two()));
+    } else {
+        re = reprosum<T>(n, ReproValue<T, X, IndexType>(xr, 2*incX));
+        im = reprosum<T>(n, ReproValue<T, X, IndexType>(xr+1, 2*incX));
+    }
+    sum = Complex<T>(re, im);
+}
+
+//-- asum ----------------------------------------------------------------------
+
+template <typename IndexType, typename X, typename T>
+void
+asum_reproducible(IndexType n, const X *x, IndexType incX, T &absSum)
+{
+    CXXBLAS_DEBUG_OUT("asum_reproducible");
+
+    typedef ReproStride<1>  Unit;
+
+    if (incX<0) {
+        x -= incX*(n-1);
+    }
+    if (incX==1) {
+        absSum = reprosum<T>(n, ReproAbsSum<T, X, Unit>(x, Unit()));
+    } else {
+        absSum = reprosum<T>(n, ReproAbsSum<T, X, IndexType>(x, incX));
+    }
+}
+
+//-- dotu, dot -----------------------------------------------------------------
+
+template <bool Conj, typename IndexType, typename X, typename IncX,
+          typename Y, typename IncY, typename Result>
+typename RestrictTo<!IsComplex<Result>::value,
+         void>::Type
+reprodot(IndexType n,
+         const X *x, const IncX &incX, const Y *y, const IncY &incY,
+         Result &result)
+{
+    typedef ReproProduct<Result, X, IncX, Y, IncY, Conj>  Product;
+
+    result = reprosum<Result>(n, Product(x, incX, y, incY));
+}
+
+template <bool Conj, typename IndexType, typename X, typename IncX,
+          typename Y, typename IncY, typename Result>
+typename RestrictTo<IsComplex<Result>::value,
+         void>::Type
+reprodot(IndexType n,
+         const X *x, const IncX &incX, const Y *y, const IncY &incY,
+         Result &result)
+{
+    typedef typename ComplexTrait<Result>::PrimitiveType    PT;
+    typedef ReproProduct<Result, X, IncX, Y, IncY, Conj>    Product;
+
+    const Product product(x, incX, y, incY);
+
+    const PT re = reprosum<PT>(n, ReproReal<PT, Product>(product));
+    const PT im = reprosum<PT>(n, ReproImag<PT, Product>(product));
+
+    result = Result(re, im);
+}
+
+template <typename IndexType, typename X, typename Y, typename Result>
+void
+dotu_reproducible(IndexType n,
+                  const X *x, IndexType incX, const Y *y, IndexType incY,
+                  Result &result)
+{
+    CXXBLAS_DEBUG_OUT("dotu_reproducible");
+
+    typedef ReproStride<1>  Unit;
+
+    if (incX<0) {
+        x -= incX*(n-1);
+    }
+    if (incY<0) {
+        y -= incY*(n-1);
+    }
+    if (incX==1 && incY==1) {
+        reprodot<false>(n, x, Unit(), y, Unit(), result);
+    } else {
+        reprodot<false>(n, x, incX, y, incY, result);
+    }
+}
+
+template <typename IndexType, typename X, typename Y, typename Result>
+void
+dot_reproducible(IndexType n,
+                 const X *x, IndexType incX, const Y *y, IndexType incY,
+                 Result &result)
+{
+    CXXBLAS_DEBUG_OUT("dot_reproducible");
+
+    typedef ReproStride<1>  Unit;
+
+    if (incX<0) {
+        x -= incX*(n-1);
+    }
+    if (incY<0) {
+        y -= incY*(n-1);
+    }
+    if (incX==1 && incY==1) {
+        reprodot<true>(n, x, Unit(), y, Unit(), result);
+    } else {
+        reprodot<true>(n, x, incX, y, incY, result);
+    }
+}
+
+//-- nrm2 ----------------------------------------------------------------------
+
+//
+//  Entries get scaled by a power of two such that the largest one is of
+//  order one.  Then the squares neither overflow nor do relevant ones
+//  underflow.  The reproducible sum of squares gets merged with (scale,
+//  sumsq) by the classic scaling of xLASSQ.  Vectors with Inf or NaN
+//  entries are handled by the classic sequential update.
+//
+template <typename IndexType, typename X, typename IncX, typename T>
+typename RestrictTo<IsIEEEFloat<T>::value,
+         void>::Type
+reprosumsq(IndexType n, const X *x, const IncX &incX, T &scale, T &sumsq)
+{
+    typedef std::numeric_limits<T>  Limits;
+
+    using std::frexp;
+    using std::isfinite;
+    using std::isnan;
+    using std::ldexp;
+    using std::max;
+    using std::min;
+
+    const T Zero(0);
+
+    if (isnan(scale) || isnan(sumsq)) {
+        return;
+    }
+
+    const T maxAbs = repromax<T>(n, ReproAbsSum<T, X, IncX>(x, incX));
+
+    if (maxAbs==Zero) {
+        return;
+    }
+    if (!isfinite(maxAbs)) {
+        for (IndexType i=0; i<n; ++i) {
+            const X &xi = x[reproIndex(i, incX)];
+
+            nrm2_lassq_update(cxxblas::real(xi), scale, sumsq);
+            nrm2_lassq_update(cxxblas::imag(xi), scale, sumsq);
+        }
+        return;
+    }
+
+    int e;
+    frexp(maxAbs, &e);
+    e = max(min(e, Limits::max_exponent-1), 1-Limits::max_exponent);
+
+    const T s   = ldexp(T(1), -e);
+    const T sc  = ldexp(T(1), e);
+    const T ssq = reprosum<T>(n, ReproSquare<T, X, IncX>(x, incX, s));
+
+    if (scale==Zero || sumsq==Zero) {
+        scale = sc;
+        sumsq = ssq;
+    } else if (scale>=sc) {
+        sumsq += ssq*((sc/scale)*(sc/scale));
+    } else {
+        sumsq = ssq + sumsq*((scale/sc)*(scale/sc));
+        scale = sc;
+    }
+}
+
+template <typename IndexType, typename X, typename IncX, typename T>
+typename RestrictTo<!IsIEEEFloat<T>::value,
+         void>::Type
+reprosumsq(IndexType n, const X *x, const IncX &incX, T &scale, T &sumsq)
+{
+    for (IndexType i=0; i<n; ++i) {
+        const X &xi = x[reproIndex(i, incX)];
+
+        nrm2_lassq_update(cxxblas::real(xi), scale, sumsq);
+        nrm2_lassq_update(cxxblas::imag(xi), scale, sumsq);
+    }
+}
+
+template <typename IndexType, typename X, typename T>
+void
+nrm2_sumsq_reproducible(IndexType n, const X *x, IndexType incX,
+                        T &scale, T &sumsq)
+{
+    CXXBLAS_DEBUG_OUT("nrm2_sumsq_reproducible");
+
+    if (incX==1) {
+        reprosumsq(n, x, ReproStride<1>(), scale, sumsq);
+    } else {
+        reprosumsq(n, x, incX, scale, sumsq);
+    }
+}
+
+template <typename IndexType, typename X, typename T>
+void
+nrm2_reproducible(IndexType n, const X *x, IndexType incX, T &norm)
+{
+    CXXBLAS_DEBUG_OUT("nrm2_reproducible");
+
+    using std::abs;
+    using std::sqrt;
+
+    if (incX<0) {
+        x -= incX*(n-1);
+    }
+    if (n<1) {
+        norm = T(0);
+    } else if (n==1) {
+        norm = abs(*x);
+    } else {
+        T scale(0), sumsq(1);
+
+        nrm2_sumsq_reproducible(n, x, incX, scale, sumsq);
+        norm = scale*sqrt(sumsq);
+    }
+}
+
+} // namespace cxxblas
+
+#endif // CXXBLAS_LEVEL1EXTENSIONS_REPRODUCIBLE_TCC
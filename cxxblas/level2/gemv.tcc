@@ -63,7 +63,13 @@ gemv_generic(StorageOrder order, Transpose transA, Transpose conjX,
             y -= incY*(m-1);
         }
 
-        scal_generic(m, beta, y, incY);
+        if (beta==BETA(0)) {
+            for (IndexType i=0, iY=0; i<m; ++i, iY+=incY) {
+                y[iY] = VY(0);
+            }
+        } else {
+            scal_generic(m, beta, y, incY);
+        }
         if (conjX==NoTrans) {
             if (transA==Conj) {
                 for (IndexType i=0, iY=0; i<m; ++i, iY+=incY) {
@@ -101,7 +107,13 @@ gemv_generic(StorageOrder order, Transpose transA, Transpose conjX,
             y -= incY*(n-1);
         }
 
-        scal_generic(n, beta, y, incY);
+        if (beta==BETA(0)) {
+            for (IndexType i=0, iY=0; i<n; ++i, iY+=incY) {
+                y[iY] = VY(0);
+            }
+        } else {
+            scal_generic(n, beta, y, incY);
+        }
         if (conjX==NoTrans) {
             if (transA==ConjTrans) {
                 for (IndexType i=0, iY=0; i<n; ++i, iY+=incY) {
@@ -152,6 +164,9 @@ gemv(StorageOrder order, Transpose trans,
     if ((m==0) || (n==0)) {
         return;
     }
+    CXXBLAS_PROFILE_SCOPE("gemv", ProfileGeneric, long(m)*n,
+                          (IsComplex<VY>::value ? 8. : 2.)*m*n,
+                          (double(m)*n+m+n)*sizeof(VY));
     gemv_generic(order, trans, NoTrans, m, n,
                  alpha, A, ldA, x, incX,
                  beta, y, incY);
@@ -170,8 +185,19 @@ gemv(StorageOrder order, Transpose trans,
      float beta,
      float *y, IndexType incY)
 {
+    if (!BlasDispatch::useExternal(DispatchGemv, long(m)*n)) {
+        CXXBLAS_PROFILE_SCOPE("gemv", ProfileGeneric, long(m)*n, 2.*m*n,
+                              (double(m)*n+m+n)*sizeof(float));
+        gemv_generic(order, trans, NoTrans, m, n,
+                     alpha, A, ldA, x, incX,
+                     beta, y, incY);
+        return;
+    }
+
     CXXBLAS_DEBUG_OUT("[" BLAS_IMPL "] cblas_sgemv");
 
+    CXXBLAS_PROFILE_SCOPE("gemv", ProfileCblas, long(m)*n, 2.*m*n,
+                          (double(m)*n+m+n)*sizeof(float));
     cblas_sgemv(CBLAS::getCblasType(order), CBLAS::getCblasType(trans),
                 m,  n,
                 alpha,
@@ -192,8 +218,19 @@ gemv(StorageOrder order, Transpose trans,
      double beta,
      double *y, IndexType incY)
 {
+    if (!BlasDispatch::useExternal(DispatchGemv, long(m)*n)) {
+        CXXBLAS_PROFILE_SCOPE("gemv", ProfileGeneric, long(m)*n, 2.*m*n,
+                              (double(m)*n+m+n)*sizeof(double));
+        gemv_generic(order, trans, NoTrans, m, n,
+                     alpha, A, ldA, x, incX,
+                     beta, y, incY);
+        return;
+    }
+
     CXXBLAS_DEBUG_OUT("[" BLAS_IMPL "] cblas_dgemv");
 
+    CXXBLAS_PROFILE_SCOPE("gemv", ProfileCblas, long(m)*n, 2.*m*n,
+                          (double(m)*n+m+n)*sizeof(double));
     cblas_dgemv(CBLAS::getCblasType(order), CBLAS::getCblasType(trans),
                 m,  n,
                 alpha,
@@ -214,6 +251,15 @@ gemv(StorageOrder order, Transpose trans,
      const ComplexFloat &beta,
      ComplexFloat *y, IndexType incY)
 {
+    if (!BlasDispatch::useExternal(DispatchGemv, long(m)*n)) {
+        CXXBLAS_PROFILE_SCOPE("gemv", ProfileGeneric, long(m)*n, 8.*m*n,
+                              (double(m)*n+m+n)*sizeof(ComplexFloat));
+        gemv_generic(order, trans, NoTrans, m, n,
+                     alpha, A, ldA, x, incX,
+                     beta, y, incY);
+        return;
+    }
+
     CXXBLAS_DEBUG_OUT("[" BLAS_IMPL "] cblas_cgemv");
 
     if (trans==Conj) {
@@ -226,6 +272,8 @@ gemv(StorageOrder order, Transpose trans,
 #   ifdef CXXBLAS_NO_TEMPORARY
     if (order==RowMajor && trans==ConjTrans) {
         CXXBLAS_DEBUG_OUT("gemv_generic");
+        CXXBLAS_PROFILE_SCOPE("gemv", ProfileGeneric, long(m)*n, 8.*m*n,
+                              (double(m)*n+m+n)*sizeof(ComplexFloat));
         gemv_generic(order, trans, NoTrans, m, n,
                      alpha, A, ldA, x, incX,
                      beta, y, incY);
@@ -233,6 +281,8 @@ gemv(StorageOrder order, Transpose trans,
     }
 #   endif
 
+    CXXBLAS_PROFILE_SCOPE("gemv", ProfileCblas, long(m)*n, 8.*m*n,
+                          (double(m)*n+m+n)*sizeof(ComplexFloat));
     cblas_cgemv(CBLAS::getCblasType(order), CBLAS::getCblasType(trans),
                 m,  n,
                 reinterpret_cast<const float *>(&alpha),
@@ -253,6 +303,15 @@ gemv(StorageOrder order, Transpose trans,
      const ComplexDouble &beta,
      ComplexDouble *y, IndexType incY)
 {
+    if (!BlasDispatch::useExternal(DispatchGemv, long(m)*n)) {
+        CXXBLAS_PROFILE_SCOPE("gemv", ProfileGeneric, long(m)*n, 8.*m*n,
+                              (double(m)*n+m+n)*sizeof(ComplexDouble));
+        gemv_generic(order, trans, NoTrans, m, n,
+                     alpha, A, ldA, x, incX,
+                     beta, y, incY);
+        return;
+    }
+
     CXXBLAS_DEBUG_OUT("[" BLAS_IMPL "] cblas_zgemv");
 
     if (trans==Conj) {
@@ -265,6 +324,8 @@ gemv(StorageOrder order, Transpose trans,
 #   ifdef CXXBLAS_NO_TEMPORARY
     if (order==RowMajor && trans==ConjTrans) {
         CXXBLAS_DEBUG_OUT("gemv_generic");
+        CXXBLAS_PROFILE_SCOPE("gemv", ProfileGeneric, long(m)*n, 8.*m*n,
+                              (double(m)*n+m+n)*sizeof(ComplexDouble));
         gemv_generic(order, trans, NoTrans, m, n,
                      alpha, A, ldA, x, incX,
                      beta, y, incY);
@@ -272,6 +333,8 @@ gemv(StorageOrder order, Transpose trans,
     }
 #   endif
 
+    CXXBLAS_PROFILE_SCOPE("gemv", ProfileCblas, long(m)*n, 8.*m*n,
+                          (double(m)*n+m+n)*sizeof(ComplexDouble));
     cblas_zgemv(CBLAS::getCblasType(order), CBLAS::getCblasType(trans),
                 m,  n,
                 reinterpret_cast<const double *>(&alpha),
@@ -63,7 +63,19 @@ gemm_generic(StorageOrder order,
         return;
     }
 
-    gescal(order, m, n, beta, C, ldC);
+//
+//  With beta==0 the content of C is not referenced (C might be
+//  uninitialized), so it gets overwritten instead of scaled.
+//
+    if (beta==BETA(0)) {
+        for (IndexType i=0; i<m; ++i) {
+            for (IndexType j=0; j<n; ++j) {
+                C[i*ldC+j] = MC(0);
+            }
+        }
+    } else {
+        gescal(order, m, n, beta, C, ldC);
+    }
     if (alpha==ALPHA(0)) {
         return;
     }
@@ -95,7 +107,7 @@ gemm_generic(StorageOrder order,
 
     if ((transA==Conj) && (transB==NoTrans)) {
         for (IndexType l=0; l<n; ++l) {
-            gemv(order, NoTrans, m, k, alpha, A, ldA, B+l, ldB,
+            gemv(order, Conj, m, k, alpha, A, ldA, B+l, ldB,
                  BETA(1), C+l, ldC);
         }
     }
@@ -152,7 +164,7 @@ gemm_generic(StorageOrder order,
     }
     if ((transA==ConjTrans) && (transB==Conj)) {
         for (IndexType l=0; l<n; ++l) {
-            gemv(order, ConjTrans, k, m, alpha, A, ldA, B+l, ldB,
+            gemv(order, ConjTrans, Conj, k, m, alpha, A, ldA, B+l, ldB,
                  BETA(1), C+l, ldC);
         }
     }
@@ -183,6 +195,9 @@ gemm(StorageOrder order,
      const BETA &beta,
      MC *C, IndexType ldC)
 {
+    CXXBLAS_PROFILE_SCOPE("gemm", ProfileGeneric, long(m)*n*k,
+                          (IsComplex<MC>::value ? 8. : 2.)*m*n*k,
+                          (double(k)*(m+n)+2.*m*n)*sizeof(MC));
     gemm_generic(order, transA, transB, m, n, k,
                  alpha, A, ldA, B, ldB,
                  beta,
@@ -203,8 +218,20 @@ gemm(StorageOrder order,
      float beta,
      float *C, IndexType ldC)
 {
+    if (!BlasDispatch::useExternal(DispatchGemm, long(m)*n*k)) {
+        CXXBLAS_PROFILE_SCOPE("gemm", ProfileGeneric, long(m)*n*k, 2.*m*n*k,
+                              (double(k)*(m+n)+2.*m*n)*sizeof(float));
+        gemm_generic(order, transA, transB, m, n, k,
+                     alpha, A, ldA, B, ldB,
+                     beta,
+                     C, ldC);
+        return;
+    }
+
     CXXBLAS_DEBUG_OUT("[" BLAS_IMPL "] cblas_sgemm");
 
+    CXXBLAS_PROFILE_SCOPE("gemm", ProfileCblas, long(m)*n*k, 2.*m*n*k,
+                          (double(k)*(m+n)+2.*m*n)*sizeof(float));
     cblas_sgemm(CBLAS::getCblasType(order),
                 CBLAS::getCblasType(transA), CBLAS::getCblasType(transB),
                 m, n, k,
@@ -227,8 +254,20 @@ gemm(StorageOrder order,
      double beta,
      double *C, IndexType ldC)
 {
+    if (!BlasDispatch::useExternal(DispatchGemm, long(m)*n*k)) {
+        CXXBLAS_PROFILE_SCOPE("gemm", ProfileGeneric, long(m)*n*k, 2.*m*n*k,
+                              (double(k)*(m+n)+2.*m*n)*sizeof(double));
+        gemm_generic(order, transA, transB, m, n, k,
+                     alpha, A, ldA, B, ldB,
+                     beta,
+                     C, ldC);
+        return;
+    }
+
     CXXBLAS_DEBUG_OUT("[" BLAS_IMPL "] cblas_dgemm");
 
+    CXXBLAS_PROFILE_SCOPE("gemm", ProfileCblas, long(m)*n*k, 2.*m*n*k,
+                          (double(k)*(m+n)+2.*m*n)*sizeof(double));
     cblas_dgemm(CBLAS::getCblasType(order),
                 CBLAS::getCblasType(transA), CBLAS::getCblasType(transB),
                 m, n, k,
@@ -251,10 +290,22 @@ gemm(StorageOrder order,
      const ComplexFloat &beta,
      ComplexFloat *C, IndexType ldC)
 {
+    if (!BlasDispatch::useExternal(DispatchGemm, long(m)*n*k)) {
+        CXXBLAS_PROFILE_SCOPE("gemm", ProfileGeneric, long(m)*n*k, 8.*m*n*k,
+                              (double(k)*(m+n)+2.*m*n)*sizeof(ComplexFloat));
+        gemm_generic(order, transA, transB, m, n, k,
+                     alpha, A, ldA, B, ldB,
+                     beta,
+                     C, ldC);
+        return;
+    }
+
     CXXBLAS_DEBUG_OUT("[" BLAS_IMPL "] cblas_cgemm");
 
     if (transA==Conj || transB==Conj) {
         CXXBLAS_DEBUG_OUT("gemm_generic");
+        CXXBLAS_PROFILE_SCOPE("gemm", ProfileGeneric, long(m)*n*k, 8.*m*n*k,
+                              (double(k)*(m+n)+2.*m*n)*sizeof(ComplexFloat));
         gemm_generic(order, transA, transB, m, n, k,
                     alpha, A, ldA, B, ldB,
                     beta,
@@ -262,6 +313,8 @@ gemm(StorageOrder order,
         return;
     }
 
+    CXXBLAS_PROFILE_SCOPE("gemm", ProfileCblas, long(m)*n*k, 8.*m*n*k,
+                          (double(k)*(m+n)+2.*m*n)*sizeof(ComplexFloat));
     cblas_cgemm(CBLAS::getCblasType(order),
                 CBLAS::getCblasType(transA), CBLAS::getCblasType(transB),
                 m, n, k,
@@ -284,10 +337,22 @@ gemm(StorageOrder order,
      const ComplexDouble &beta,
      ComplexDouble *C, IndexType ldC)
 {
+    if (!BlasDispatch::useExternal(DispatchGemm, long(m)*n*k)) {
+        CXXBLAS_PROFILE_SCOPE("gemm", ProfileGeneric, long(m)*n*k, 8.*m*n*k,
+                              (double(k)*(m+n)+2.*m*n)*sizeof(ComplexDouble));
+        gemm_generic(order, transA, transB, m, n, k,
+                     alpha, A, ldA, B, ldB,
+                     beta,
+                     C, ldC);
+        return;
+    }
+
     CXXBLAS_DEBUG_OUT("[" BLAS_IMPL "] cblas_zgemm");
 
     if (transA==Conj || transB==Conj) {
         CXXBLAS_DEBUG_OUT("gemm_generic");
+        CXXBLAS_PROFILE_SCOPE("gemm", ProfileGeneric, long(m)*n*k, 8.*m*n*k,
+                              (double(k)*(m+n)+2.*m*n)*sizeof(ComplexDouble));
         gemm_generic(order, transA, transB, m, n, k,
                     alpha, A, ldA, B, ldB,
                     beta,
@@ -295,6 +360,8 @@ gemm(StorageOrder order,
         return;
     }
 
+    CXXBLAS_PROFILE_SCOPE("gemm", ProfileCblas, long(m)*n*k, 8.*m*n*k,
+                          (double(k)*(m+n)+2.*m*n)*sizeof(ComplexDouble));
     cblas_zgemm(CBLAS::getCblasType(order),
                 CBLAS::getCblasType(transA), CBLAS::getCblasType(transB),
                 m, n, k,
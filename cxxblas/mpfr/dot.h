@@ -0,0 +1,71 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef CXXBLAS_MPFR_DOT_H
+#define CXXBLAS_MPFR_DOT_H 1
+
+#include <cxxblas/mpfr/mpfrarith.h>
+#include <cxxblas/typedefs.h>
+
+namespace cxxblas {
+
+#ifdef MPFR_REAL_HPP
+
+//
+//  acc = x^T*y for vectors with non-negative increments
+//
+template <typename IndexType, mpfr::real_prec_t prec_, mpfr::real_rnd_t rnd_>
+    void
+    mpfr_dot_kernel(IndexType n,
+                    const mpfr::real<prec_,rnd_> *x, IndexType incX,
+                    const mpfr::real<prec_,rnd_> *y, IndexType incY,
+                    mpfr_ptr acc);
+
+template <typename IndexType, mpfr::real_prec_t prec_, mpfr::real_rnd_t rnd_>
+    void
+    dotu(IndexType n,
+         const mpfr::real<prec_,rnd_> *x, IndexType incX,
+         const mpfr::real<prec_,rnd_> *y, IndexType incY,
+         mpfr::real<prec_,rnd_> &result);
+
+template <typename IndexType, mpfr::real_prec_t prec_, mpfr::real_rnd_t rnd_>
+    void
+    dot(IndexType n,
+        const mpfr::real<prec_,rnd_> *x, IndexType incX,
+        const mpfr::real<prec_,rnd_> *y, IndexType incY,
+        mpfr::real<prec_,rnd_> &result);
+
+#endif // MPFR_REAL_HPP
+
+} // namespace cxxblas
+
+#endif // CXXBLAS_MPFR_DOT_H
@@ -0,0 +1,111 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef CXXBLAS_MPFR_DOT_TCC
+#define CXXBLAS_MPFR_DOT_TCC 1
+
+#include <cxxblas/cxxblas.h>
+#include <cxxblas/mpfr/dot.h>
+#include <cxxblas/mpfr/mpfrarith.h>
+
+namespace cxxblas {
+
+#ifdef MPFR_REAL_HPP
+
+template <typename IndexType, mpfr::real_prec_t prec_, mpfr::real_rnd_t rnd_>
+void
+mpfr_dot_kernel(IndexType n,
+                const mpfr::real<prec_,rnd_> *x, IndexType incX,
+                const mpfr::real<prec_,rnd_> *y, IndexType incY,
+                mpfr_ptr acc)
+{
+    mpfr_set_zero(acc, 1);
+    for (IndexType i=0, iX=0, iY=0; i<n; ++i, iX+=incX, iY+=incY) {
+        mpfr_fma(acc, x[iX].x_, y[iY].x_, acc, MPFR_RNDN);
+    }
+}
+
+template <typename IndexType, mpfr::real_prec_t prec_, mpfr::real_rnd_t rnd_>
+void
+dotu(IndexType n,
+     const mpfr::real<prec_,rnd_> *x, IndexType incX,
+     const mpfr::real<prec_,rnd_> *y, IndexType incY,
+     mpfr::real<prec_,rnd_> &result)
+{
+    CXXBLAS_PROFILE_SCOPE("dot", ProfileGeneric, n, 2.*n,
+                          2.*n*sizeof(mpfr::real<prec_,rnd_>));
+    CXXBLAS_DEBUG_OUT("dotu [mpfr]");
+
+    if (incX<0) {
+        x -= incX*(n-1);
+    }
+    if (incY<0) {
+        y -= incY*(n-1);
+    }
+
+    const int  numThreads = mpfr_blas_num_threads(n, n);
+    mpfr_ptr   acc = MpfrPool<MpfrAccPrec<prec_>::value>::get(numThreads);
+
+//
+//  Partial sums get added in a fixed order, so the result does not depend
+//  on the scheduling.
+//
+#   ifdef _OPENMP
+#   pragma omp parallel for num_threads(numThreads)
+#   endif
+    for (int t=0; t<numThreads; ++t) {
+        const IndexType i0 = (IndexType(t)*n)/numThreads;
+        const IndexType i1 = (IndexType(t+1)*n)/numThreads;
+
+        mpfr_dot_kernel(i1-i0, x+i0*incX, incX, y+i0*incY, incY, acc+t);
+    }
+    for (int t=1; t<numThreads; ++t) {
+        mpfr_add(acc, acc, acc+t, MPFR_RNDN);
+    }
+    mpfr_set(result.x_, acc, rnd_);
+}
+
+template <typename IndexType, mpfr::real_prec_t prec_, mpfr::real_rnd_t rnd_>
+void
+dot(IndexType n,
+    const mpfr::real<prec_,rnd_> *x, IndexType incX,
+    const mpfr::real<prec_,rnd_> *y, IndexType incY,
+    mpfr::real<prec_,rnd_> &result)
+{
+    dotu(n, x, incX, y, incY, result);
+}
+
+#endif // MPFR_REAL_HPP
+
+} // namespace cxxblas
+
+#endif // CXXBLAS_MPFR_DOT_TCC
@@ -0,0 +1,121 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef CXXBLAS_MPFR_GEMM_H
+#define CXXBLAS_MPFR_GEMM_H 1
+
+#include <cxxblas/mpfr/mpfrarith.h>
+#include <cxxblas/typedefs.h>
+
+//
+//  Blocked, multi-threaded gemm for mpfr::real:
+//
+//    for each mc x nc block of C                           (parallel)
+//        acc = 0                                           (mc x nc)
+//        for pc (kc columns of op(A), kc rows of op(B))
+//            for jr, ir: micro kernel on acc(ir, jr)       (MR x NR)
+//        C(block) = beta*C(block) + alpha*acc
+//
+//  Entries are not packed, copying an mpfr number costs about as much as a
+//  multiply-add.  The block sizes depend on the precision: an element
+//  needs sizeof(mpfr::real) bytes plus its limbs, and kc is chosen such
+//  that a kc x NR sliver of op(B) stays in the L1 cache and mc (and nc)
+//  such that an mc x kc block of op(A) stays in the L2 cache.
+//
+#ifndef MPFR_BLAS_GEMM_MR
+#define MPFR_BLAS_GEMM_MR       4
+#endif
+
+#ifndef MPFR_BLAS_GEMM_NR
+#define MPFR_BLAS_GEMM_NR       4
+#endif
+
+#ifndef MPFR_BLAS_L1_CACHE
+#define MPFR_BLAS_L1_CACHE      (32*1024)
+#endif
+
+#ifndef MPFR_BLAS_L2_CACHE
+#define MPFR_BLAS_L2_CACHE      (256*1024)
+#endif
+
+namespace cxxblas {
+
+#ifdef MPFR_REAL_HPP
+
+//
+//  Block sizes for mpfr::real<prec_, rnd_>
+//
+template <typename IndexType, mpfr::real_prec_t prec_, mpfr::real_rnd_t rnd_>
+    void
+    mpfr_gemm_blocking(const mpfr::real<prec_,rnd_> *,
+                       IndexType &mc, IndexType &nc, IndexType &kc);
+
+//
+//  acc(0:mr-1, 0:nr-1) += A(0:mr-1, 0:kb-1)*B(0:kb-1, 0:nr-1)
+//
+template <typename IndexType, mpfr::real_prec_t prec_, mpfr::real_rnd_t rnd_>
+    void
+    mpfr_gemm_micro_kernel(IndexType kb, IndexType mr, IndexType nr,
+                           const mpfr::real<prec_,rnd_> *A,
+                           IndexType incRowA, IndexType incColA,
+                           const mpfr::real<prec_,rnd_> *B,
+                           IndexType incRowB, IndexType incColB,
+                           mpfr_ptr acc, IndexType ldAcc);
+
+//
+//  C = beta*C + alpha*op(A)*op(B) for ColMajor matrices
+//
+template <typename IndexType, mpfr::real_prec_t prec_, mpfr::real_rnd_t rnd_>
+    void
+    mpfr_gemm_driver(Transpose transA, Transpose transB,
+                     IndexType m, IndexType n, IndexType k,
+                     const mpfr::real<prec_,rnd_> &alpha,
+                     const mpfr::real<prec_,rnd_> *A, IndexType ldA,
+                     const mpfr::real<prec_,rnd_> *B, IndexType ldB,
+                     const mpfr::real<prec_,rnd_> &beta,
+                     mpfr::real<prec_,rnd_> *C, IndexType ldC);
+
+template <typename IndexType, mpfr::real_prec_t prec_, mpfr::real_rnd_t rnd_>
+    void
+    gemm(StorageOrder order, Transpose transA, Transpose transB,
+         IndexType m, IndexType n, IndexType k,
+         const mpfr::real<prec_,rnd_> &alpha,
+         const mpfr::real<prec_,rnd_> *A, IndexType ldA,
+         const mpfr::real<prec_,rnd_> *B, IndexType ldB,
+         const mpfr::real<prec_,rnd_> &beta,
+         mpfr::real<prec_,rnd_> *C, IndexType ldC);
+
+#endif // MPFR_REAL_HPP
+
+} // namespace cxxblas
+
+#endif // CXXBLAS_MPFR_GEMM_H
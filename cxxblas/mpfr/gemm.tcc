@@ -0,0 +1,220 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef CXXBLAS_MPFR_GEMM_TCC
+#define CXXBLAS_MPFR_GEMM_TCC 1
+
+#include <cxxstd/algorithm.h>
+#include <cxxblas/cxxblas.h>
+#include <cxxblas/mpfr/gemm.h>
+#include <cxxblas/mpfr/mpfrarith.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace cxxblas {
+
+#ifdef MPFR_REAL_HPP
+
+template <typename IndexType, mpfr::real_prec_t prec_, mpfr::real_rnd_t rnd_>
+void
+mpfr_gemm_blocking(const mpfr::real<prec_,rnd_> *,
+                   IndexType &mc, IndexType &nc, IndexType &kc)
+{
+    using std::max;
+    using std::min;
+
+    const IndexType MR = MPFR_BLAS_GEMM_MR;
+    const IndexType NR = MPFR_BLAS_GEMM_NR;
+
+    const IndexType bytes = sizeof(mpfr::real<prec_,rnd_>)
+                          + mpfr_custom_get_size(prec_);
+
+    kc = min(IndexType(1024),
+             max(IndexType(16), IndexType(MPFR_BLAS_L1_CACHE/(NR*bytes))));
+    mc = max(IndexType(1), IndexType(MPFR_BLAS_L2_CACHE/(kc*bytes*MR)))*MR;
+    nc = max(IndexType(1), IndexType(MPFR_BLAS_L2_CACHE/(kc*bytes*NR)))*NR;
+}
+
+template <typename IndexType, mpfr::real_prec_t prec_, mpfr::real_rnd_t rnd_>
+void
+mpfr_gemm_micro_kernel(IndexType kb, IndexType mr, IndexType nr,
+                       const mpfr::real<prec_,rnd_> *A,
+                       IndexType incRowA, IndexType incColA,
+                       const mpfr::real<prec_,rnd_> *B,
+                       IndexType incRowB, IndexType incColB,
+                       mpfr_ptr acc, IndexType ldAcc)
+{
+    for (IndexType l=0; l<kb; ++l) {
+        const mpfr::real<prec_,rnd_> *a = A + l*incColA;
+        const mpfr::real<prec_,rnd_> *b = B + l*incRowB;
+
+        for (IndexType c=0; c<nr; ++c) {
+            mpfr_ptr abc = acc + c*ldAcc;
+
+            for (IndexType r=0; r<mr; ++r) {
+                mpfr_fma(abc+r, a[r*incRowA].x_, b[c*incColB].x_, abc+r,
+                         MPFR_RNDN);
+            }
+        }
+    }
+}
+
+template <typename IndexType, mpfr::real_prec_t prec_, mpfr::real_rnd_t rnd_>
+void
+mpfr_gemm_driver(Transpose transA, Transpose transB,
+                 IndexType m, IndexType n, IndexType k,
+                 const mpfr::real<prec_,rnd_> &alpha,
+                 const mpfr::real<prec_,rnd_> *A, IndexType ldA,
+                 const mpfr::real<prec_,rnd_> *B, IndexType ldB,
+                 const mpfr::real<prec_,rnd_> &beta,
+                 mpfr::real<prec_,rnd_> *C, IndexType ldC)
+{
+    using std::min;
+
+    const IndexType MR = MPFR_BLAS_GEMM_MR;
+    const IndexType NR = MPFR_BLAS_GEMM_NR;
+
+    IndexType mc, nc, kc;
+    mpfr_gemm_blocking(A, mc, nc, kc);
+
+    mc = min(mc, ((m+MR-1)/MR)*MR);
+    nc = min(nc, ((n+NR-1)/NR)*NR);
+    kc = min(kc, k);
+
+    const IndexType incRowA = (transA & Trans) ? ldA : 1;
+    const IndexType incColA = (transA & Trans) ? 1 : ldA;
+    const IndexType incRowB = (transB & Trans) ? ldB : 1;
+    const IndexType incColB = (transB & Trans) ? 1 : ldB;
+
+    const IndexType numBlocksM = (m+mc-1)/mc;
+    const IndexType numBlocksN = (n+nc-1)/nc;
+    const IndexType numTasks   = numBlocksM*numBlocksN;
+
+    const int  numThreads = mpfr_blas_num_threads(double(m)*n*k, numTasks);
+    mpfr_ptr   accAll = MpfrPool<MpfrAccPrec<prec_>::value>::get(
+                                                    numThreads*mc*nc);
+
+#   ifdef _OPENMP
+#   pragma omp parallel num_threads(numThreads)
+#   endif
+    {
+        int thread = 0;
+#       ifdef _OPENMP
+        thread = omp_get_thread_num();
+#       endif
+        mpfr_ptr acc = accAll + thread*mc*nc;
+
+#       ifdef _OPENMP
+#       pragma omp for schedule(dynamic)
+#       endif
+        for (IndexType task=0; task<numTasks; ++task) {
+            const IndexType i  = (task%numBlocksM)*mc;
+            const IndexType j  = (task/numBlocksM)*nc;
+            const IndexType mb = min(mc, m-i);
+            const IndexType nb = min(nc, n-j);
+
+            for (IndexType c=0; c<nb; ++c) {
+                for (IndexType r=0; r<mb; ++r) {
+                    mpfr_set_zero(acc+r+c*mc, 1);
+                }
+            }
+
+            for (IndexType p=0; p<k; p+=kc) {
+                const IndexType kb = min(kc, k-p);
+
+                for (IndexType jr=0; jr<nb; jr+=NR) {
+                    for (IndexType ir=0; ir<mb; ir+=MR) {
+                        mpfr_gemm_micro_kernel(kb,
+                                               min(MR, mb-ir), min(NR, nb-jr),
+                                               A + (i+ir)*incRowA + p*incColA,
+                                               incRowA, incColA,
+                                               B + p*incRowB + (j+jr)*incColB,
+                                               incRowB, incColB,
+                                               acc+ir+jr*mc, mc);
+                    }
+                }
+            }
+
+            for (IndexType c=0; c<nb; ++c) {
+                for (IndexType r=0; r<mb; ++r) {
+                    mpfr_axpby(alpha, acc+r+c*mc, beta, C[(i+r)+(j+c)*ldC]);
+                }
+            }
+        }
+    }
+}
+
+template <typename IndexType, mpfr::real_prec_t prec_, mpfr::real_rnd_t rnd_>
+void
+gemm(StorageOrder order, Transpose transA, Transpose transB,
+     IndexType m, IndexType n, IndexType k,
+     const mpfr::real<prec_,rnd_> &alpha,
+     const mpfr::real<prec_,rnd_> *A, IndexType ldA,
+     const mpfr::real<prec_,rnd_> *B, IndexType ldB,
+     const mpfr::real<prec_,rnd_> &beta,
+     mpfr::real<prec_,rnd_> *C, IndexType ldC)
+{
+    CXXBLAS_PROFILE_SCOPE("gemm", ProfileGeneric, long(m)*n*k,
+                          2.*m*n*k,
+                          (double(m)*k+double(k)*n+2.*m*n)
+                          *sizeof(mpfr::real<prec_,rnd_>));
+    CXXBLAS_DEBUG_OUT("gemm [mpfr]");
+
+//
+//  C^T = op(B)^T*op(A)^T, i.e. RowMajor is handled by swapping the operands
+//
+    if (order==RowMajor) {
+        gemm(ColMajor, transB, transA, n, m, k, alpha, B, ldB, A, ldA,
+             beta, C, ldC);
+        return;
+    }
+
+    if (m==0 || n==0) {
+        return;
+    }
+    if (k==0 || mpfr_zero_p(alpha.x_)) {
+        for (IndexType j=0; j<n; ++j) {
+            mpfr_scal_kernel(m, beta, C+j*ldC, IndexType(1));
+        }
+        return;
+    }
+    mpfr_gemm_driver(transA, transB, m, n, k, alpha, A, ldA, B, ldB,
+                     beta, C, ldC);
+}
+
+#endif // MPFR_REAL_HPP
+
+} // namespace cxxblas
+
+#endif // CXXBLAS_MPFR_GEMM_TCC
@@ -0,0 +1,112 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef CXXBLAS_MPFR_GEMV_TCC
+#define CXXBLAS_MPFR_GEMV_TCC 1
+
+#include <cxxblas/cxxblas.h>
+#include <cxxblas/mpfr/dot.h>
+#include <cxxblas/mpfr/gemv.h>
+#include <cxxblas/mpfr/mpfrarith.h>
+
+namespace cxxblas {
+
+#ifdef MPFR_REAL_HPP
+
+template <typename IndexType, mpfr::real_prec_t prec_, mpfr::real_rnd_t rnd_>
+void
+gemv(StorageOrder order, Transpose trans,
+     IndexType m, IndexType n,
+     const mpfr::real<prec_,rnd_> &alpha,
+     const mpfr::real<prec_,rnd_> *A, IndexType ldA,
+     const mpfr::real<prec_,rnd_> *x, IndexType incX,
+     const mpfr::real<prec_,rnd_> &beta,
+     mpfr::real<prec_,rnd_> *y, IndexType incY)
+{
+    CXXBLAS_PROFILE_SCOPE("gemv", ProfileGeneric, long(m)*n, 2.*m*n,
+                          (double(m)*n+m+n)*sizeof(mpfr::real<prec_,rnd_>));
+    CXXBLAS_DEBUG_OUT("gemv [mpfr]");
+
+//
+//  A RowMajor matrix is the transposed of a ColMajor matrix.  For a real
+//  type conjugation has no effect.
+//
+    if (order==RowMajor) {
+        gemv(ColMajor, Transpose(trans^Trans), n, m, alpha, A, ldA,
+             x, incX, beta, y, incY);
+        return;
+    }
+
+    const bool      noTrans = !(trans & Trans);
+    const IndexType lenX    = noTrans ? n : m;
+    const IndexType lenY    = noTrans ? m : n;
+
+    if (incX<0) {
+        x -= incX*(lenX-1);
+    }
+    if (incY<0) {
+        y -= incY*(lenY-1);
+    }
+
+    if (lenX==0 || mpfr_zero_p(alpha.x_)) {
+        mpfr_scal_kernel(lenY, beta, y, incY);
+        return;
+    }
+
+//
+//  Entry i of y is the dot product of row i of op(A) and x
+//
+    const IndexType incRowA = noTrans ? IndexType(1) : ldA;
+    const IndexType incColA = noTrans ? ldA : IndexType(1);
+
+    const int  numThreads = mpfr_blas_num_threads(double(m)*n, lenY);
+    mpfr_ptr   acc = MpfrPool<MpfrAccPrec<prec_>::value>::get(numThreads);
+
+#   ifdef _OPENMP
+#   pragma omp parallel for num_threads(numThreads)
+#   endif
+    for (int t=0; t<numThreads; ++t) {
+        const IndexType i0 = (IndexType(t)*lenY)/numThreads;
+        const IndexType i1 = (IndexType(t+1)*lenY)/numThreads;
+
+        for (IndexType i=i0; i<i1; ++i) {
+            mpfr_dot_kernel(lenX, A+i*incRowA, incColA, x, incX, acc+t);
+            mpfr_axpby(alpha, acc+t, beta, y[i*incY]);
+        }
+    }
+}
+
+#endif // MPFR_REAL_HPP
+
+} // namespace cxxblas
+
+#endif // CXXBLAS_MPFR_GEMV_TCC
@@ -0,0 +1,98 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef CXXBLAS_MPFR_GER_TCC
+#define CXXBLAS_MPFR_GER_TCC 1
+
+#include <cxxblas/cxxblas.h>
+#include <cxxblas/mpfr/ger.h>
+#include <cxxblas/mpfr/mpfrarith.h>
+
+namespace cxxblas {
+
+#ifdef MPFR_REAL_HPP
+
+template <typename IndexType, mpfr::real_prec_t prec_, mpfr::real_rnd_t rnd_>
+void
+ger(StorageOrder order,
+    IndexType m, IndexType n,
+    const mpfr::real<prec_,rnd_> &alpha,
+    const mpfr::real<prec_,rnd_> *x, IndexType incX,
+    const mpfr::real<prec_,rnd_> *y, IndexType incY,
+    mpfr::real<prec_,rnd_> *A, IndexType ldA)
+{
+    CXXBLAS_PROFILE_SCOPE("ger", ProfileGeneric, long(m)*n, 2.*m*n,
+                          (2.*m*n+m+n)*sizeof(mpfr::real<prec_,rnd_>));
+    CXXBLAS_DEBUG_OUT("ger [mpfr]");
+
+    if (order==RowMajor) {
+        ger(ColMajor, n, m, alpha, y, incY, x, incX, A, ldA);
+        return;
+    }
+
+    if (incX<0) {
+        x -= incX*(m-1);
+    }
+    if (incY<0) {
+        y -= incY*(n-1);
+    }
+
+    if (m==0 || n==0 || mpfr_zero_p(alpha.x_)) {
+        return;
+    }
+
+    const int  numThreads = mpfr_blas_num_threads(double(m)*n, n);
+    mpfr_ptr   acc = MpfrPool<MpfrAccPrec<prec_>::value>::get(numThreads);
+
+#   ifdef _OPENMP
+#   pragma omp parallel for num_threads(numThreads)
+#   endif
+    for (int t=0; t<numThreads; ++t) {
+        const IndexType j0 = (IndexType(t)*n)/numThreads;
+        const IndexType j1 = (IndexType(t+1)*n)/numThreads;
+
+        for (IndexType j=j0; j<j1; ++j) {
+            mpfr::real<prec_,rnd_> *a = A + j*ldA;
+
+            mpfr_mul(acc+t, alpha.x_, y[j*incY].x_, MPFR_RNDN);
+            for (IndexType i=0, iX=0; i<m; ++i, iX+=incX) {
+                mpfr_fma(a[i].x_, x[iX].x_, acc+t, a[i].x_, rnd_);
+            }
+        }
+    }
+}
+
+#endif // MPFR_REAL_HPP
+
+} // namespace cxxblas
+
+#endif // CXXBLAS_MPFR_GER_TCC
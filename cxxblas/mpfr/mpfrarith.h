@@ -0,0 +1,129 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef CXXBLAS_MPFR_MPFRARITH_H
+#define CXXBLAS_MPFR_MPFRARITH_H 1
+
+#include <cxxstd/cstddef.h>
+#include <cxxstd/vector.h>
+
+//
+//  Helpers for the mpfr::real kernels.
+//
+//  Each arithmetic operation on mpfr::real objects creates temporaries, and
+//  each temporary allocates its limbs on the heap (mpfr_init2).  The kernels
+//  instead accumulate sums of products in place with mpfr_fma.  Accumulators
+//  are taken from a thread local pool, so after the first call no more
+//  allocations happen.
+//
+//  Accumulators carry MPFR_BLAS_ACC_EXTRA_BITS more bits than the operands
+//  (mixed precision).  Each result gets rounded only once to the precision
+//  and with the rounding mode of its type.
+//
+#ifndef MPFR_BLAS_ACC_EXTRA_BITS
+#define MPFR_BLAS_ACC_EXTRA_BITS    64
+#endif
+
+//
+//  Minimal number of fused multiply-adds per thread
+//
+#ifndef MPFR_BLAS_PARALLEL_MIN
+#define MPFR_BLAS_PARALLEL_MIN      4096
+#endif
+
+namespace cxxblas {
+
+#ifdef MPFR_REAL_HPP
+
+//
+//  MpfrPool<Prec>::get(n) returns n accumulators with precision Prec.  The
+//  pool belongs to the calling thread and only grows.  Pointers returned
+//  by a previous call get invalidated, so only top level functions fetch
+//  accumulators and pass them on to their kernels.
+//
+template <mpfr_prec_t Prec>
+class MpfrPool
+{
+    public:
+        static __mpfr_struct *
+        get(std::size_t n);
+
+    private:
+        struct Storage
+        {
+            ~Storage();
+
+            std::vector<__mpfr_struct>  acc;
+        };
+
+        static Storage &
+        storage_();
+};
+
+//
+//  Precision of the accumulators used for mpfr::real<prec_, rnd_>
+//
+template <mpfr::real_prec_t prec_>
+struct MpfrAccPrec
+{
+    static const mpfr_prec_t value = prec_ + MPFR_BLAS_ACC_EXTRA_BITS;
+};
+
+//
+//  Number of threads for numOps fused multiply-adds split into at most
+//  numTasks independent tasks.
+//
+inline int
+mpfr_blas_num_threads(double numOps, double numTasks);
+
+//
+//  y = beta*y + alpha*acc
+//
+template <mpfr::real_prec_t prec_, mpfr::real_rnd_t rnd_>
+    void
+    mpfr_axpby(const mpfr::real<prec_,rnd_> &alpha, mpfr_ptr acc,
+               const mpfr::real<prec_,rnd_> &beta,
+               mpfr::real<prec_,rnd_> &y);
+
+//
+//  y = beta*y
+//
+template <typename IndexType, mpfr::real_prec_t prec_, mpfr::real_rnd_t rnd_>
+    void
+    mpfr_scal_kernel(IndexType n, const mpfr::real<prec_,rnd_> &beta,
+                     mpfr::real<prec_,rnd_> *y, IndexType incY);
+
+#endif // MPFR_REAL_HPP
+
+} // namespace cxxblas
+
+#endif // CXXBLAS_MPFR_MPFRARITH_H
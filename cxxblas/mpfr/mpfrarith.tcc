@@ -0,0 +1,130 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef CXXBLAS_MPFR_MPFRARITH_TCC
+#define CXXBLAS_MPFR_MPFRARITH_TCC 1
+
+#include <cxxstd/algorithm.h>
+#include <cxxblas/mpfr/mpfrarith.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace cxxblas {
+
+#ifdef MPFR_REAL_HPP
+
+template <mpfr_prec_t Prec>
+__mpfr_struct *
+MpfrPool<Prec>::get(std::size_t n)
+{
+    std::vector<__mpfr_struct> &acc = storage_().acc;
+
+    if (acc.size()<n) {
+        const std::size_t n0 = acc.size();
+
+        acc.resize(n);
+        for (std::size_t i=n0; i<n; ++i) {
+            mpfr_init2(&acc[i], Prec);
+        }
+    }
+    return acc.data();
+}
+
+template <mpfr_prec_t Prec>
+MpfrPool<Prec>::Storage::~Storage()
+{
+    for (std::size_t i=0; i<acc.size(); ++i) {
+        mpfr_clear(&acc[i]);
+    }
+}
+
+template <mpfr_prec_t Prec>
+typename MpfrPool<Prec>::Storage &
+MpfrPool<Prec>::storage_()
+{
+    static thread_local Storage storage;
+
+    return storage;
+}
+
+inline int
+mpfr_blas_num_threads(double numOps, double numTasks)
+{
+#   ifdef _OPENMP
+    const double numThreads = std::min(numTasks,
+                                       numOps/MPFR_BLAS_PARALLEL_MIN);
+
+    return std::max(1, std::min(omp_get_max_threads(), int(numThreads)));
+#   else
+    return 1;
+#   endif
+}
+
+template <mpfr::real_prec_t prec_, mpfr::real_rnd_t rnd_>
+void
+mpfr_axpby(const mpfr::real<prec_,rnd_> &alpha, mpfr_ptr acc,
+           const mpfr::real<prec_,rnd_> &beta,
+           mpfr::real<prec_,rnd_> &y)
+{
+    if (mpfr_zero_p(beta.x_)) {
+        mpfr_mul(y.x_, acc, alpha.x_, rnd_);
+        return;
+    }
+    if (mpfr_cmp_ui(beta.x_, 1)!=0) {
+        mpfr_mul(y.x_, y.x_, beta.x_, rnd_);
+    }
+    mpfr_fma(y.x_, acc, alpha.x_, y.x_, rnd_);
+}
+
+template <typename IndexType, mpfr::real_prec_t prec_, mpfr::real_rnd_t rnd_>
+void
+mpfr_scal_kernel(IndexType n, const mpfr::real<prec_,rnd_> &beta,
+                 mpfr::real<prec_,rnd_> *y, IndexType incY)
+{
+    if (mpfr_zero_p(beta.x_)) {
+        for (IndexType i=0, iY=0; i<n; ++i, iY+=incY) {
+            mpfr_set_zero(y[iY].x_, 1);
+        }
+    } else if (mpfr_cmp_ui(beta.x_, 1)!=0) {
+        for (IndexType i=0, iY=0; i<n; ++i, iY+=incY) {
+            mpfr_mul(y[iY].x_, y[iY].x_, beta.x_, rnd_);
+        }
+    }
+}
+
+#endif // MPFR_REAL_HPP
+
+} // namespace cxxblas
+
+#endif // CXXBLAS_MPFR_MPFRARITH_TCC
@@ -0,0 +1,75 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef CXXBLAS_MPFR_TRSM_H
+#define CXXBLAS_MPFR_TRSM_H 1
+
+#include <cxxblas/mpfr/mpfrarith.h>
+#include <cxxblas/typedefs.h>
+
+namespace cxxblas {
+
+#ifdef MPFR_REAL_HPP
+
+//
+//  Solves op(A)*x = alpha*b in place.  The triangular matrix op(A) has
+//  entries T[i*incRowT + j*incColT] and is lower triangular if lowerT is
+//  true.  Each x_i is accumulated and then rounded once (by the division
+//  by the diagonal entry).
+//
+template <typename IndexType, mpfr::real_prec_t prec_, mpfr::real_rnd_t rnd_>
+    void
+    mpfr_trsv_kernel(bool lowerT, bool unitDiag, IndexType n,
+                     const mpfr::real<prec_,rnd_> &alpha,
+                     const mpfr::real<prec_,rnd_> *T,
+                     IndexType incRowT, IndexType incColT,
+                     mpfr::real<prec_,rnd_> *x, IndexType incX,
+                     mpfr_ptr acc);
+
+//
+//  The columns (Left) or rows (Right) of B are independent right hand
+//  sides and get solved in parallel.
+//
+template <typename IndexType, mpfr::real_prec_t prec_, mpfr::real_rnd_t rnd_>
+    void
+    trsm(StorageOrder order, Side side, StorageUpLo upLo,
+         Transpose transA, Diag diag,
+         IndexType m, IndexType n,
+         const mpfr::real<prec_,rnd_> &alpha,
+         const mpfr::real<prec_,rnd_> *A, IndexType ldA,
+         mpfr::real<prec_,rnd_> *B, IndexType ldB);
+
+#endif // MPFR_REAL_HPP
+
+} // namespace cxxblas
+
+#endif // CXXBLAS_MPFR_TRSM_H
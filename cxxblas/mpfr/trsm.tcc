@@ -0,0 +1,157 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef CXXBLAS_MPFR_TRSM_TCC
+#define CXXBLAS_MPFR_TRSM_TCC 1
+
+#include <cxxstd/algorithm.h>
+#include <cxxblas/cxxblas.h>
+#include <cxxblas/mpfr/mpfrarith.h>
+#include <cxxblas/mpfr/trsm.h>
+
+namespace cxxblas {
+
+#ifdef MPFR_REAL_HPP
+
+template <typename IndexType, mpfr::real_prec_t prec_, mpfr::real_rnd_t rnd_>
+void
+mpfr_trsv_kernel(bool lowerT, bool unitDiag, IndexType n,
+                 const mpfr::real<prec_,rnd_> &alpha,
+                 const mpfr::real<prec_,rnd_> *T,
+                 IndexType incRowT, IndexType incColT,
+                 mpfr::real<prec_,rnd_> *x, IndexType incX,
+                 mpfr_ptr acc)
+{
+//
+//  Forward substitution for lower, backward substitution for upper
+//  triangular matrices.  With acc = sum_j T(i,j)*x_j - alpha*b_i we get
+//  x_i = -acc/T(i,i).
+//
+    const IndexType i0   = lowerT ? 0 : n-1;
+    const IndexType iInc = lowerT ? 1 : -1;
+
+    for (IndexType k=0, i=i0; k<n; ++k, i+=iInc) {
+        mpfr::real<prec_,rnd_> &xi = x[i*incX];
+
+        mpfr_mul(acc, alpha.x_, xi.x_, MPFR_RNDN);
+        mpfr_neg(acc, acc, MPFR_RNDN);
+        for (IndexType l=0, j=i0; l<k; ++l, j+=iInc) {
+            mpfr_fma(acc, T[i*incRowT+j*incColT].x_, x[j*incX].x_, acc,
+                     MPFR_RNDN);
+        }
+        if (unitDiag) {
+            mpfr_neg(xi.x_, acc, rnd_);
+        } else {
+            mpfr_div(xi.x_, acc, T[i*incRowT+i*incColT].x_, rnd_);
+            mpfr_neg(xi.x_, xi.x_, rnd_);
+        }
+    }
+}
+
+template <typename IndexType, mpfr::real_prec_t prec_, mpfr::real_rnd_t rnd_>
+void
+trsm(StorageOrder order, Side side, StorageUpLo upLo,
+     Transpose transA, Diag diag,
+     IndexType m, IndexType n,
+     const mpfr::real<prec_,rnd_> &alpha,
+     const mpfr::real<prec_,rnd_> *A, IndexType ldA,
+     mpfr::real<prec_,rnd_> *B, IndexType ldB)
+{
+    CXXBLAS_DEBUG_OUT("trsm [mpfr]");
+
+    if (m==0 || n==0) {
+        return;
+    }
+    if (mpfr_zero_p(alpha.x_)) {
+        for (IndexType j=0; j<n; ++j) {
+            for (IndexType i=0; i<m; ++i) {
+                IndexType iB = (order==ColMajor) ? i+j*ldB : i*ldB+j;
+                mpfr_set_zero(B[iB].x_, 1);
+            }
+        }
+        return;
+    }
+
+//
+//  Element strides of A and B
+//
+    const IndexType incRowA = (order==ColMajor) ? 1 : ldA;
+    const IndexType incColA = (order==ColMajor) ? ldA : 1;
+    const IndexType incRowB = (order==ColMajor) ? 1 : ldB;
+    const IndexType incColB = (order==ColMajor) ? ldB : 1;
+
+//
+//  op(A) is stored like A with row and column strides swapped if it is
+//  transposed.  For side==Right we solve op(A)^T*X^T = alpha*B^T.
+//
+    const bool noTrans  = !(transA & Trans);
+    const bool right    = (side==Right);
+    const bool unitDiag = (diag==Unit);
+
+    IndexType incRowT = noTrans ? incRowA : incColA;
+    IndexType incColT = noTrans ? incColA : incRowA;
+    bool      lowerT  = ((upLo==Lower)==noTrans);
+
+    if (right) {
+        std::swap(incRowT, incColT);
+        lowerT = !lowerT;
+    }
+
+    const IndexType dim    = right ? n : m;
+    const IndexType numRhs = right ? m : n;
+    const IndexType incX   = right ? incColB : incRowB;
+    const IndexType incRhs = right ? incRowB : incColB;
+
+    const int  numThreads = mpfr_blas_num_threads(double(dim)*dim*numRhs/2,
+                                                  numRhs);
+    mpfr_ptr   acc = MpfrPool<MpfrAccPrec<prec_>::value>::get(numThreads);
+
+#   ifdef _OPENMP
+#   pragma omp parallel for num_threads(numThreads)
+#   endif
+    for (int t=0; t<numThreads; ++t) {
+        const IndexType k0 = (IndexType(t)*numRhs)/numThreads;
+        const IndexType k1 = (IndexType(t+1)*numRhs)/numThreads;
+
+        for (IndexType k=k0; k<k1; ++k) {
+            mpfr_trsv_kernel(lowerT, unitDiag, dim, alpha,
+                             A, incRowT, incColT,
+                             B+k*incRhs, incX, acc+t);
+        }
+    }
+}
+
+#endif // MPFR_REAL_HPP
+
+} // namespace cxxblas
+
+#endif // CXXBLAS_MPFR_TRSM_TCC
@@ -0,0 +1,96 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef CXXBLAS_QD_AXPY_TCC
+#define CXXBLAS_QD_AXPY_TCC 1
+
+#include <cxxstd/algorithm.h>
+#include <cxxblas/cxxblas.h>
+#include <cxxblas/qd/ddarith.h>
+
+namespace cxxblas {
+
+#ifdef QD_API
+
+template <typename IndexType>
+void
+dd_axpy_kernel(IndexType n, double alphaHi, double alphaLo,
+               const dd_real *x, IndexType incX,
+               dd_real *y, IndexType incY)
+{
+    if (incX==1 && incY==1) {
+        for (IndexType i=0; i<n; ++i) {
+            dd_madd(alphaHi, alphaLo, x[i].x[0], x[i].x[1],
+                    y[i].x[0], y[i].x[1]);
+        }
+        return;
+    }
+    for (IndexType i=0, iX=0, iY=0; i<n; ++i, iX+=incX, iY+=incY) {
+        dd_madd(alphaHi, alphaLo, x[iX].x[0], x[iX].x[1],
+                y[iY].x[0], y[iY].x[1]);
+    }
+}
+
+template <typename IndexType>
+void
+axpy(IndexType n, const dd_real &alpha,
+     const dd_real *x, IndexType incX,
+     dd_real *y, IndexType incY)
+{
+    CXXBLAS_PROFILE_SCOPE("axpy", ProfileGeneric, n, 2.*n,
+                          3.*n*sizeof(dd_real));
+    CXXBLAS_DEBUG_OUT("axpy [double-double]");
+
+    if (incX<0) {
+        x -= incX*(n-1);
+    }
+    if (incY<0) {
+        y -= incY*(n-1);
+    }
+
+#   ifdef _OPENMP
+#   pragma omp parallel for if (n>=DD_PARALLEL_MIN)
+    for (IndexType i0=0; i0<n; i0+=DD_PARALLEL_MIN) {
+        const IndexType nb = std::min(IndexType(DD_PARALLEL_MIN), n-i0);
+
+        dd_axpy_kernel(nb, alpha.x[0], alpha.x[1],
+                       x+i0*incX, incX, y+i0*incY, incY);
+    }
+#   else
+    dd_axpy_kernel(n, alpha.x[0], alpha.x[1], x, incX, y, incY);
+#   endif
+}
+
+#endif // QD_API
+
+} // namespace cxxblas
+
+#endif // CXXBLAS_QD_AXPY_TCC
@@ -0,0 +1,108 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef CXXBLAS_QD_DDARITH_H
+#define CXXBLAS_QD_DDARITH_H 1
+
+//
+//  Double-double arithmetic on unevaluated sums hi+lo with |lo|<=ulp(hi)/2
+//  (the representation of dd_real).  The kernels keep the hi and lo parts
+//  in separate double variables such that the compiler can vectorize loops
+//  over independent accumulators.
+//
+//  With hardware FMA (FP_FAST_FMA is defined, e.g. for -mfma or
+//  -march=native) the rounding error of a product is computed by a single
+//  fma, otherwise by Dekker's splitting.  Like in the QD library additions
+//  use the accurate (IEEE) variant only if QD_IEEE_ADD is defined.
+//
+//  Compile without -ffast-math:  the error-free transformations rely on the
+//  exact order of the operations.
+//
+
+//
+//  Number of independent double-double accumulators in the level 1 and 2
+//  kernels
+//
+#ifndef DD_LANES
+#define DD_LANES            8
+#endif
+
+//
+//  With OpenMP vectors of at least this length (and matrices with at least
+//  this many entries) get split among the threads
+//
+#ifndef DD_PARALLEL_MIN
+#define DD_PARALLEL_MIN     16384
+#endif
+
+namespace cxxblas {
+
+//
+//  Returns s=fl(a+b) and sets e such that s+e=a+b
+//
+inline double
+dd_two_sum(double a, double b, double &e);
+
+//
+//  Like dd_two_sum but requires |a|>=|b|
+//
+inline double
+dd_quick_two_sum(double a, double b, double &e);
+
+//
+//  Returns p=fl(a*b) and sets e such that p+e=a*b
+//
+inline double
+dd_two_prod(double a, double b, double &e);
+
+//
+//  (hi, lo) += (bHi, bLo)
+//
+inline void
+dd_add(double &hi, double &lo, double bHi, double bLo);
+
+//
+//  (hi, lo) = (aHi, aLo)*(bHi, bLo)
+//
+inline void
+dd_mul(double aHi, double aLo, double bHi, double bLo,
+       double &hi, double &lo);
+
+//
+//  (hi, lo) += (aHi, aLo)*(bHi, bLo)
+//
+inline void
+dd_madd(double aHi, double aLo, double bHi, double bLo,
+        double &hi, double &lo);
+
+} // namespace cxxblas
+
+#endif // CXXBLAS_QD_DDARITH_H
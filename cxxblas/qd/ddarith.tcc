@@ -0,0 +1,129 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef CXXBLAS_QD_DDARITH_TCC
+#define CXXBLAS_QD_DDARITH_TCC 1
+
+#include <cxxstd/cmath.h>
+#include <cxxblas/qd/ddarith.h>
+
+namespace cxxblas {
+
+inline double
+dd_two_sum(double a, double b, double &e)
+{
+    const double s  = a + b;
+    const double bb = s - a;
+
+    e = (a - (s - bb)) + (b - bb);
+    return s;
+}
+
+inline double
+dd_quick_two_sum(double a, double b, double &e)
+{
+    const double s = a + b;
+
+    e = b - (s - a);
+    return s;
+}
+
+inline double
+dd_two_prod(double a, double b, double &e)
+{
+    const double p = a*b;
+#   ifdef FP_FAST_FMA
+    e = std::fma(a, b, -p);
+#   else
+//
+//  Dekker:  split a and b into 26 bit halves such that the partial products
+//  are exact
+//
+    const double split = 134217729.0;   // 2^27+1
+
+    double t = split*a;
+    const double aHi = t - (t - a);
+    const double aLo = a - aHi;
+
+    t = split*b;
+    const double bHi = t - (t - b);
+    const double bLo = b - bHi;
+
+    e = ((aHi*bHi - p) + aHi*bLo + aLo*bHi) + aLo*bLo;
+#   endif
+    return p;
+}
+
+inline void
+dd_add(double &hi, double &lo, double bHi, double bLo)
+{
+#   ifdef QD_IEEE_ADD
+    double s2, t2;
+    double s1 = dd_two_sum(hi, bHi, s2);
+    double t1 = dd_two_sum(lo, bLo, t2);
+
+    s2 += t1;
+    s1 = dd_quick_two_sum(s1, s2, s2);
+    s2 += t2;
+    hi = dd_quick_two_sum(s1, s2, lo);
+#   else
+    double e;
+    const double s = dd_two_sum(hi, bHi, e);
+
+    e += lo + bLo;
+    hi = dd_quick_two_sum(s, e, lo);
+#   endif
+}
+
+inline void
+dd_mul(double aHi, double aLo, double bHi, double bLo,
+       double &hi, double &lo)
+{
+    double e;
+    const double p = dd_two_prod(aHi, bHi, e);
+
+    e += aHi*bLo + aLo*bHi;
+    hi = dd_quick_two_sum(p, e, lo);
+}
+
+inline void
+dd_madd(double aHi, double aLo, double bHi, double bLo,
+        double &hi, double &lo)
+{
+    double pHi, pLo;
+
+    dd_mul(aHi, aLo, bHi, bLo, pHi, pLo);
+    dd_add(hi, lo, pHi, pLo);
+}
+
+} // namespace cxxblas
+
+#endif // CXXBLAS_QD_DDARITH_TCC
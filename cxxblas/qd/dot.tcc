@@ -0,0 +1,147 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef CXXBLAS_QD_DOT_TCC
+#define CXXBLAS_QD_DOT_TCC 1
+
+#include <cxxstd/algorithm.h>
+#include <cxxstd/vector.h>
+#include <cxxblas/cxxblas.h>
+#include <cxxblas/qd/ddarith.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace cxxblas {
+
+#ifdef QD_API
+
+template <typename IndexType>
+void
+dd_dot_kernel(IndexType n,
+              const dd_real *x, IndexType incX,
+              const dd_real *y, IndexType incY,
+              double &hi, double &lo)
+{
+    const int L = DD_LANES;
+
+    double sHi[L], sLo[L];
+
+    for (int l=0; l<L; ++l) {
+        sHi[l] = sLo[l] = 0;
+    }
+
+    IndexType i = 0;
+    if (incX==1 && incY==1) {
+        for (; i+L<=n; i+=L) {
+            for (int l=0; l<L; ++l) {
+                dd_madd(x[i+l].x[0], x[i+l].x[1], y[i+l].x[0], y[i+l].x[1],
+                        sHi[l], sLo[l]);
+            }
+        }
+    }
+    for (; i<n; ++i) {
+        const dd_real &xi = x[i*incX];
+        const dd_real &yi = y[i*incY];
+
+        dd_madd(xi.x[0], xi.x[1], yi.x[0], yi.x[1], sHi[0], sLo[0]);
+    }
+
+    hi = sHi[0];
+    lo = sLo[0];
+    for (int l=1; l<L; ++l) {
+        dd_add(hi, lo, sHi[l], sLo[l]);
+    }
+}
+
+template <typename IndexType>
+void
+dotu(IndexType n,
+     const dd_real *x, IndexType incX,
+     const dd_real *y, IndexType incY,
+     dd_real &result)
+{
+    CXXBLAS_PROFILE_SCOPE("dot", ProfileGeneric, n, 2.*n,
+                          2.*n*sizeof(dd_real));
+    CXXBLAS_DEBUG_OUT("dotu [double-double]");
+
+    if (incX<0) {
+        x -= incX*(n-1);
+    }
+    if (incY<0) {
+        y -= incY*(n-1);
+    }
+
+    double hi = 0, lo = 0;
+
+#   ifdef _OPENMP
+    const int numThreads = std::min(IndexType(omp_get_max_threads()),
+                                    n/DD_PARALLEL_MIN);
+
+    if (numThreads>1) {
+        std::vector<double> partHi(numThreads), partLo(numThreads);
+
+#       pragma omp parallel for num_threads(numThreads)
+        for (int t=0; t<numThreads; ++t) {
+            const IndexType i0 = (IndexType(t)*n)/numThreads;
+            const IndexType i1 = (IndexType(t+1)*n)/numThreads;
+
+            dd_dot_kernel(i1-i0, x+i0*incX, incX, y+i0*incY, incY,
+                          partHi[t], partLo[t]);
+        }
+        for (int t=0; t<numThreads; ++t) {
+            dd_add(hi, lo, partHi[t], partLo[t]);
+        }
+        result = dd_real(hi, lo);
+        return;
+    }
+#   endif
+
+    dd_dot_kernel(n, x, incX, y, incY, hi, lo);
+    result = dd_real(hi, lo);
+}
+
+template <typename IndexType>
+void
+dot(IndexType n,
+    const dd_real *x, IndexType incX,
+    const dd_real *y, IndexType incY,
+    dd_real &result)
+{
+    dotu(n, x, incX, y, incY, result);
+}
+
+#endif // QD_API
+
+} // namespace cxxblas
+
+#endif // CXXBLAS_QD_DOT_TCC
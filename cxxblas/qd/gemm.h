@@ -0,0 +1,132 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef CXXBLAS_QD_GEMM_H
+#define CXXBLAS_QD_GEMM_H 1
+
+#include <cxxblas/qd/ddarith.h>
+#include <cxxblas/typedefs.h>
+
+//
+//  Packed, multi-threaded gemm for dd_real (same structure as the intrinsics
+//  gemm in playground/cxxblas/intrinsics/level3/gemm/driver.h):
+//
+//    for pc (kc columns of A, kc rows of B)
+//        pack alpha*B(pc, :) into slivers of NR columns   (shared, parallel)
+//        for ic (mc rows of A), jr (column chunks)         (parallel)
+//            pack A(ic, pc) into slivers of MR rows        (per thread)
+//            for jr, ir: micro kernel on C(ir, jr)         (MR x NR)
+//
+//  Packed slivers store for each index l the hi parts followed by the lo
+//  parts, so the micro kernel updates MR x NR double-double accumulators
+//  with SIMD operations on the hi and lo parts.  Edges are padded with
+//  zeros.
+//
+#ifndef DD_GEMM_MR
+#define DD_GEMM_MR              8
+#endif
+
+#ifndef DD_GEMM_NR
+#define DD_GEMM_NR              4
+#endif
+
+#ifndef DD_GEMM_KC
+#define DD_GEMM_KC              256
+#endif
+
+#ifndef DD_GEMM_MC
+#define DD_GEMM_MC              64
+#endif
+
+#ifndef DD_GEMM_MIN_PARALLEL
+#define DD_GEMM_MIN_PARALLEL    (32*32*32)
+#endif
+
+namespace cxxblas {
+
+#ifdef QD_API
+
+//
+//  Packs rows i, ..., i+mr-1 and columns p, ..., p+kb-1 of op(A)
+//
+template <typename IndexType>
+    void
+    dd_gemm_packA(Transpose transA, const dd_real *A, IndexType ldA,
+                  IndexType i, IndexType p, IndexType mr, IndexType kb,
+                  double *packed);
+
+//
+//  Packs rows p, ..., p+kb-1 and columns j, ..., j+nr-1 of alpha*op(B)
+//
+template <typename IndexType>
+    void
+    dd_gemm_packB(Transpose transB, const dd_real &alpha,
+                  const dd_real *B, IndexType ldB,
+                  IndexType p, IndexType j, IndexType kb, IndexType nr,
+                  double *packed);
+
+//
+//  C(0:mr-1, 0:nr-1) += packedA*packedB
+//
+template <typename IndexType>
+    void
+    dd_gemm_micro_kernel(IndexType kb,
+                         const double *packedA, const double *packedB,
+                         IndexType mr, IndexType nr,
+                         dd_real *C, IndexType ldC);
+
+//
+//  C += alpha*op(A)*op(B) for ColMajor matrices
+//
+template <typename IndexType>
+    void
+    dd_gemm_driver(Transpose transA, Transpose transB,
+                   IndexType m, IndexType n, IndexType k,
+                   const dd_real &alpha,
+                   const dd_real *A, IndexType ldA,
+                   const dd_real *B, IndexType ldB,
+                   dd_real *C, IndexType ldC);
+
+template <typename IndexType>
+    void
+    gemm(StorageOrder order, Transpose transA, Transpose transB,
+         IndexType m, IndexType n, IndexType k,
+         const dd_real &alpha,
+         const dd_real *A, IndexType ldA,
+         const dd_real *B, IndexType ldB,
+         const dd_real &beta,
+         dd_real *C, IndexType ldC);
+
+#endif // QD_API
+
+} // namespace cxxblas
+
+#endif // CXXBLAS_QD_GEMM_H
@@ -0,0 +1,277 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef CXXBLAS_QD_GEMM_TCC
+#define CXXBLAS_QD_GEMM_TCC 1
+
+#include <cxxstd/algorithm.h>
+#include <cxxblas/cxxblas.h>
+#include <cxxblas/qd/ddarith.h>
+#include <cxxblas/qd/gemm.h>
+#include <cxxblas/qd/gemv.h>
+#include <flens/storage/workspace/workspace.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace cxxblas {
+
+#ifdef QD_API
+
+template <typename IndexType>
+void
+dd_gemm_packA(Transpose transA, const dd_real *A, IndexType ldA,
+              IndexType i, IndexType p, IndexType mr, IndexType kb,
+              double *packed)
+{
+    const IndexType MR = DD_GEMM_MR;
+
+    const IndexType incRow = (transA & Trans) ? ldA : 1;
+    const IndexType incCol = (transA & Trans) ? 1 : ldA;
+
+    for (IndexType l=0; l<kb; ++l) {
+        const dd_real *a = A + i*incRow + (p+l)*incCol;
+
+        for (IndexType r=0; r<mr; ++r) {
+            packed[r]    = a[r*incRow].x[0];
+            packed[MR+r] = a[r*incRow].x[1];
+        }
+        for (IndexType r=mr; r<MR; ++r) {
+            packed[r]    = 0;
+            packed[MR+r] = 0;
+        }
+        packed += 2*MR;
+    }
+}
+
+template <typename IndexType>
+void
+dd_gemm_packB(Transpose transB, const dd_real &alpha,
+              const dd_real *B, IndexType ldB,
+              IndexType p, IndexType j, IndexType kb, IndexType nr,
+              double *packed)
+{
+    const IndexType NR = DD_GEMM_NR;
+
+    const IndexType incRow = (transB & Trans) ? ldB : 1;
+    const IndexType incCol = (transB & Trans) ? 1 : ldB;
+
+    for (IndexType l=0; l<kb; ++l) {
+        const dd_real *b = B + (p+l)*incRow + j*incCol;
+
+        for (IndexType c=0; c<nr; ++c) {
+            dd_mul(alpha.x[0], alpha.x[1],
+                   b[c*incCol].x[0], b[c*incCol].x[1],
+                   packed[c], packed[NR+c]);
+        }
+        for (IndexType c=nr; c<NR; ++c) {
+            packed[c]    = 0;
+            packed[NR+c] = 0;
+        }
+        packed += 2*NR;
+    }
+}
+
+template <typename IndexType>
+void
+dd_gemm_micro_kernel(IndexType kb,
+                     const double *packedA, const double *packedB,
+                     IndexType mr, IndexType nr,
+                     dd_real *C, IndexType ldC)
+{
+    const int MR = DD_GEMM_MR;
+    const int NR = DD_GEMM_NR;
+
+    double abHi[MR*NR], abLo[MR*NR];
+
+    for (int i=0; i<MR*NR; ++i) {
+        abHi[i] = abLo[i] = 0;
+    }
+
+    for (IndexType l=0; l<kb; ++l) {
+        for (int c=0; c<NR; ++c) {
+            for (int r=0; r<MR; ++r) {
+                dd_madd(packedA[r], packedA[MR+r],
+                        packedB[c], packedB[NR+c],
+                        abHi[r+c*MR], abLo[r+c*MR]);
+            }
+        }
+        packedA += 2*MR;
+        packedB += 2*NR;
+    }
+
+    for (IndexType c=0; c<nr; ++c) {
+        for (IndexType r=0; r<mr; ++r) {
+            dd_real &cij = C[r+c*ldC];
+
+            dd_add(cij.x[0], cij.x[1], abHi[r+c*MR], abLo[r+c*MR]);
+        }
+    }
+}
+
+template <typename IndexType>
+void
+dd_gemm_driver(Transpose transA, Transpose transB,
+               IndexType m, IndexType n, IndexType k,
+               const dd_real &alpha,
+               const dd_real *A, IndexType ldA,
+               const dd_real *B, IndexType ldB,
+               dd_real *C, IndexType ldC)
+{
+    using std::max;
+    using std::min;
+
+    const IndexType MR = DD_GEMM_MR;
+    const IndexType NR = DD_GEMM_NR;
+
+    const IndexType kc = min(IndexType(DD_GEMM_KC), k);
+    const IndexType mc = min(IndexType(DD_GEMM_MC), ((m+MR-1)/MR)*MR);
+
+    const IndexType numPanels = (n+NR-1)/NR;
+    const IndexType numBlocks = (m+mc-1)/mc;
+
+    int numThreads = 1;
+#   ifdef _OPENMP
+    if (double(m)*n*k>=DD_GEMM_MIN_PARALLEL) {
+        numThreads = omp_get_max_threads();
+    }
+#   endif
+
+//
+//  Each block of rows gets split into column chunks such that there are at
+//  least as many tasks as threads.
+//
+    const IndexType numChunks = max(IndexType(1),
+                                    min(numPanels,
+                                        (numThreads+numBlocks-1)/numBlocks));
+    const IndexType numTasks  = numBlocks*numChunks;
+
+    const std::size_t sizeB = std::size_t(kc)*numPanels*2*NR*sizeof(double);
+    double *packedB = static_cast<double *>(flens::Workspace::allocate(sizeB));
+
+#   ifdef _OPENMP
+#   pragma omp parallel num_threads(numThreads)
+#   endif
+    {
+        const std::size_t sizeA = std::size_t(mc)*kc*2*sizeof(double);
+        double *packedA = static_cast<double *>(
+                                flens::Workspace::allocate(sizeA));
+
+        for (IndexType p=0; p<k; p+=kc) {
+            const IndexType kb = min(kc, k-p);
+
+#           ifdef _OPENMP
+#           pragma omp for schedule(static)
+#           endif
+            for (IndexType jp=0; jp<numPanels; ++jp) {
+                const IndexType j = jp*NR;
+                dd_gemm_packB(transB, alpha, B, ldB, p, j, kb,
+                              min(NR, n-j), packedB+2*j*kb);
+            }
+
+            IndexType packedI = -1;
+
+#           ifdef _OPENMP
+#           pragma omp for schedule(static)
+#           endif
+            for (IndexType task=0; task<numTasks; ++task) {
+                const IndexType i  = (task/numChunks)*mc;
+                const IndexType mb = min(mc, m-i);
+                const IndexType c  = task%numChunks;
+                const IndexType j0 = NR*((c*numPanels)/numChunks);
+                const IndexType j1 = min(n, NR*(((c+1)*numPanels)/numChunks));
+
+                if (j0>=j1) {
+                    continue;
+                }
+                if (i!=packedI) {
+                    for (IndexType ir=0; ir<mb; ir+=MR) {
+                        dd_gemm_packA(transA, A, ldA, i+ir, p,
+                                      min(MR, mb-ir), kb,
+                                      packedA+2*ir*kb);
+                    }
+                    packedI = i;
+                }
+                for (IndexType j=j0; j<j1; j+=NR) {
+                    for (IndexType ir=0; ir<mb; ir+=MR) {
+                        dd_gemm_micro_kernel(kb,
+                                             packedA+2*ir*kb,
+                                             packedB+2*j*kb,
+                                             min(MR, mb-ir), min(NR, j1-j),
+                                             C+(i+ir)+j*ldC, ldC);
+                    }
+                }
+            }
+        }
+        flens::Workspace::deallocate(packedA, sizeA);
+    }
+    flens::Workspace::deallocate(packedB, sizeB);
+}
+
+template <typename IndexType>
+void
+gemm(StorageOrder order, Transpose transA, Transpose transB,
+     IndexType m, IndexType n, IndexType k,
+     const dd_real &alpha,
+     const dd_real *A, IndexType ldA,
+     const dd_real *B, IndexType ldB,
+     const dd_real &beta,
+     dd_real *C, IndexType ldC)
+{
+    CXXBLAS_PROFILE_SCOPE("gemm", ProfileGeneric, long(m)*n*k,
+                          2.*m*n*k,
+                          (double(m)*k+double(k)*n+2.*m*n)*sizeof(dd_real));
+    CXXBLAS_DEBUG_OUT("gemm [double-double]");
+
+//
+//  C^T = op(B)^T*op(A)^T, i.e. RowMajor is handled by swapping the operands
+//
+    if (order==RowMajor) {
+        gemm(ColMajor, transB, transA, n, m, k, alpha, B, ldB, A, ldA,
+             beta, C, ldC);
+        return;
+    }
+
+    for (IndexType j=0; j<n; ++j) {
+        dd_scal_kernel(m, beta, C+j*ldC, IndexType(1));
+    }
+    if (m==0 || n==0 || k==0 || alpha.x[0]==0) {
+        return;
+    }
+    dd_gemm_driver(transA, transB, m, n, k, alpha, A, ldA, B, ldB, C, ldC);
+}
+
+#endif // QD_API
+
+} // namespace cxxblas
+
+#endif // CXXBLAS_QD_GEMM_TCC
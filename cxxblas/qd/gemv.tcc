@@ -0,0 +1,148 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef CXXBLAS_QD_GEMV_TCC
+#define CXXBLAS_QD_GEMV_TCC 1
+
+#include <cxxstd/algorithm.h>
+#include <cxxblas/cxxblas.h>
+#include <cxxblas/qd/axpy.h>
+#include <cxxblas/qd/ddarith.h>
+#include <cxxblas/qd/dot.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace cxxblas {
+
+#ifdef QD_API
+
+template <typename IndexType>
+void
+dd_scal_kernel(IndexType n, const dd_real &beta, dd_real *y, IndexType incY)
+{
+    if (beta.x[0]==0) {
+        for (IndexType i=0, iY=0; i<n; ++i, iY+=incY) {
+            y[iY] = dd_real(0.0);
+        }
+    } else if (beta.x[0]!=1 || beta.x[1]!=0) {
+        for (IndexType i=0, iY=0; i<n; ++i, iY+=incY) {
+            dd_mul(beta.x[0], beta.x[1], y[iY].x[0], y[iY].x[1],
+                   y[iY].x[0], y[iY].x[1]);
+        }
+    }
+}
+
+template <typename IndexType>
+void
+gemv(StorageOrder order, Transpose trans,
+     IndexType m, IndexType n,
+     const dd_real &alpha,
+     const dd_real *A, IndexType ldA,
+     const dd_real *x, IndexType incX,
+     const dd_real &beta,
+     dd_real *y, IndexType incY)
+{
+    CXXBLAS_PROFILE_SCOPE("gemv", ProfileGeneric, long(m)*n, 2.*m*n,
+                          (double(m)*n+m+n)*sizeof(dd_real));
+    CXXBLAS_DEBUG_OUT("gemv [double-double]");
+
+//
+//  A RowMajor matrix is the transposed of a ColMajor matrix.  For a real
+//  type conjugation has no effect.
+//
+    if (order==RowMajor) {
+        gemv(ColMajor, Transpose(trans^Trans), n, m, alpha, A, ldA,
+             x, incX, beta, y, incY);
+        return;
+    }
+
+    const bool      noTrans = !(trans & Trans);
+    const IndexType lenX    = noTrans ? n : m;
+    const IndexType lenY    = noTrans ? m : n;
+
+    if (incX<0) {
+        x -= incX*(lenX-1);
+    }
+    if (incY<0) {
+        y -= incY*(lenY-1);
+    }
+
+    dd_scal_kernel(lenY, beta, y, incY);
+
+    if (lenX==0 || alpha.x[0]==0) {
+        return;
+    }
+
+    int numThreads = 1;
+#   ifdef _OPENMP
+    numThreads = std::max(1, std::min(omp_get_max_threads(),
+                                      int(std::min(double(lenY),
+                                          double(m)*n/DD_PARALLEL_MIN))));
+#   endif
+
+    if (noTrans) {
+#       ifdef _OPENMP
+#       pragma omp parallel for num_threads(numThreads)
+#       endif
+        for (int t=0; t<numThreads; ++t) {
+            const IndexType i0 = (IndexType(t)*m)/numThreads;
+            const IndexType i1 = (IndexType(t+1)*m)/numThreads;
+
+            for (IndexType j=0; j<n; ++j) {
+                const dd_real &xj = x[j*incX];
+                double aHi, aLo;
+
+                dd_mul(alpha.x[0], alpha.x[1], xj.x[0], xj.x[1], aHi, aLo);
+                dd_axpy_kernel(i1-i0, aHi, aLo, A+i0+j*ldA, IndexType(1),
+                               y+i0*incY, incY);
+            }
+        }
+    } else {
+#       ifdef _OPENMP
+#       pragma omp parallel for num_threads(numThreads) schedule(static)
+#       endif
+        for (IndexType j=0; j<n; ++j) {
+            double hi, lo;
+
+            dd_dot_kernel(m, A+j*ldA, IndexType(1), x, incX, hi, lo);
+            dd_madd(alpha.x[0], alpha.x[1], hi, lo,
+                    y[j*incY].x[0], y[j*incY].x[1]);
+        }
+    }
+}
+
+#endif // QD_API
+
+} // namespace cxxblas
+
+#endif // CXXBLAS_QD_GEMV_TCC
@@ -0,0 +1,154 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef CXXBLAS_SPARSELEVEL2_GEBSRMV_TCC
+#define CXXBLAS_SPARSELEVEL2_GEBSRMV_TCC 1
+
+#include <cxxblas/auxiliary/auxiliary.h>
+#include <cxxblas/typedefs.h>
+
+#define HAVE_CXXBLAS_GEBSRMV 1
+
+namespace cxxblas {
+
+template <int BS, typename IndexType, typename ALPHA, typename MA,
+          typename VX, typename BETA, typename VY>
+void
+gebsrmv(Transpose        trans,
+        IndexType        m,
+        IndexType        n,
+        const ALPHA      &alpha,
+        const MA         *A,
+        const IndexType  *ia,
+        const IndexType  *ja,
+        const VX         *x,
+        const BETA       &beta,
+        VY               *y)
+{
+    CXXBLAS_DEBUG_OUT("gebsrmv_generic");
+
+    using cxxblas::conjugate;
+
+    const bool init  = (beta==BETA(0));
+    const bool scale = (beta!=BETA(0) && beta!=BETA(1));
+
+    const IndexType mb = m/BS;
+
+//
+//  Index base of the BSR matrix is stored in first Element of ia.  Make
+//  A and ja zero-based, block columns in ja stay w.r.t. the index base.
+//
+    const IndexType base = ia[0];
+
+    ja -= base;
+
+    if (trans==NoTrans || trans==Conj) {
+        for (IndexType I=0; I<mb; ++I) {
+            VY tmp[BS];
+            for (int r=0; r<BS; ++r) {
+                tmp[r] = VY(0);
+            }
+            for (IndexType k=ia[I]; k<ia[I+1]; ++k) {
+                const MA *a  = A + (k-base)*BS*BS;
+                const VX *xb = x + (ja[k]-base)*BS;
+
+                if (trans==NoTrans) {
+                    for (int r=0; r<BS; ++r) {
+                        for (int c=0; c<BS; ++c) {
+                            tmp[r] += a[r*BS+c]*xb[c];
+                        }
+                    }
+                } else {
+                    for (int r=0; r<BS; ++r) {
+                        for (int c=0; c<BS; ++c) {
+                            tmp[r] += conjugate(a[r*BS+c])*xb[c];
+                        }
+                    }
+                }
+            }
+
+            VY *yb = y + I*BS;
+            if (init) {
+                for (int r=0; r<BS; ++r) {
+                    yb[r] = alpha*tmp[r];
+                }
+            } else if (scale) {
+                for (int r=0; r<BS; ++r) {
+                    yb[r] = beta*yb[r] + alpha*tmp[r];
+                }
+            } else {
+                for (int r=0; r<BS; ++r) {
+                    yb[r] += alpha*tmp[r];
+                }
+            }
+        }
+    } else {
+        if (init) {
+            for (IndexType i=0; i<n; ++i) {
+                y[i] = VY(0);
+            }
+        } else if (scale) {
+            for (IndexType i=0; i<n; ++i) {
+                y[i] *= beta;
+            }
+        }
+
+        for (IndexType I=0; I<mb; ++I) {
+            VY xb[BS];
+            for (int r=0; r<BS; ++r) {
+                xb[r] = alpha*x[I*BS+r];
+            }
+            for (IndexType k=ia[I]; k<ia[I+1]; ++k) {
+                const MA *a  = A + (k-base)*BS*BS;
+                VY       *yb = y + (ja[k]-base)*BS;
+
+                if (trans==Trans) {
+                    for (int r=0; r<BS; ++r) {
+                        for (int c=0; c<BS; ++c) {
+                            yb[c] += a[r*BS+c]*xb[r];
+                        }
+                    }
+                } else {
+                    for (int r=0; r<BS; ++r) {
+                        for (int c=0; c<BS; ++c) {
+                            yb[c] += conjugate(a[r*BS+c])*xb[r];
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+} // namespace cxxblas
+
+#endif // CXXBLAS_SPARSELEVEL2_GEBSRMV_TCC
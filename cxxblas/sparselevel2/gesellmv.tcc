@@ -0,0 +1,166 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef CXXBLAS_SPARSELEVEL2_GESELLMV_TCC
+#define CXXBLAS_SPARSELEVEL2_GESELLMV_TCC 1
+
+#include <cxxblas/auxiliary/auxiliary.h>
+#include <cxxblas/typedefs.h>
+
+#define HAVE_CXXBLAS_GESELLMV 1
+
+namespace cxxblas {
+
+template <int CS, typename IndexType, typename ALPHA, typename MA,
+          typename VX, typename BETA, typename VY>
+void
+gesellmv(Transpose        trans,
+         IndexType        m,
+         IndexType        n,
+         const ALPHA      &alpha,
+         const MA         *A,
+         const IndexType  *chunkPtr,
+         const IndexType  *chunkLength,
+         const IndexType  *ja,
+         const IndexType  *perm,
+         const VX         *x,
+         const BETA       &beta,
+         VY               *y)
+{
+    CXXBLAS_DEBUG_OUT("gesellmv_generic");
+
+    using cxxblas::conjugate;
+
+    const bool init  = (beta==BETA(0));
+    const bool scale = (beta!=BETA(0) && beta!=BETA(1));
+
+    const IndexType numChunks = (m+CS-1)/CS;
+
+//
+//  Index base of the SELL matrix is stored in first Element of chunkPtr
+//
+    const IndexType base = chunkPtr[0];
+
+    A  -= base;
+    ja -= base;
+
+    if (trans==NoTrans || trans==Conj) {
+//
+//      Set correct index base for x and y
+//
+        x -= base;
+        y -= base;
+
+        for (IndexType c=0; c<numChunks; ++c) {
+            const MA        *a = A  + chunkPtr[c];
+            const IndexType *j = ja + chunkPtr[c];
+
+//
+//          The CS rows of a chunk are processed simultaneously.  The loop
+//          over r has a fixed trip count and unit stride in a and j.
+//
+            VY tmp[CS];
+            for (int r=0; r<CS; ++r) {
+                tmp[r] = VY(0);
+            }
+            if (trans==NoTrans) {
+                for (IndexType l=0; l<chunkLength[c]; ++l, a+=CS, j+=CS) {
+                    for (int r=0; r<CS; ++r) {
+                        tmp[r] += a[r]*x[j[r]];
+                    }
+                }
+            } else {
+                for (IndexType l=0; l<chunkLength[c]; ++l, a+=CS, j+=CS) {
+                    for (int r=0; r<CS; ++r) {
+                        tmp[r] += conjugate(a[r])*x[j[r]];
+                    }
+                }
+            }
+
+            const IndexType numSlots = (m-c*CS<CS) ? m-c*CS : CS;
+            const IndexType *p = perm + c*CS;
+
+            if (init) {
+                for (IndexType r=0; r<numSlots; ++r) {
+                    y[p[r]] = alpha*tmp[r];
+                }
+            } else if (scale) {
+                for (IndexType r=0; r<numSlots; ++r) {
+                    y[p[r]] = beta*y[p[r]] + alpha*tmp[r];
+                }
+            } else {
+                for (IndexType r=0; r<numSlots; ++r) {
+                    y[p[r]] += alpha*tmp[r];
+                }
+            }
+        }
+    } else {
+        if (init) {
+            for (IndexType i=0; i<n; ++i) {
+                y[i] = VY(0);
+            }
+        } else if (scale) {
+            for (IndexType i=0; i<n; ++i) {
+                y[i] *= beta;
+            }
+        }
+//
+//      Set correct index base for x and y
+//
+        x -= base;
+        y -= base;
+
+        const bool conjA = (trans==ConjTrans);
+
+        for (IndexType c=0; c<numChunks; ++c) {
+            const IndexType numSlots = (m-c*CS<CS) ? m-c*CS : CS;
+            const IndexType *p = perm + c*CS;
+
+            const MA        *a = A  + chunkPtr[c];
+            const IndexType *j = ja + chunkPtr[c];
+
+            for (IndexType l=0; l<chunkLength[c]; ++l, a+=CS, j+=CS) {
+                for (IndexType r=0; r<numSlots; ++r) {
+                    if (conjA) {
+                        y[j[r]] += alpha*conjugate(a[r])*x[p[r]];
+                    } else {
+                        y[j[r]] += alpha*a[r]*x[p[r]];
+                    }
+                }
+            }
+        }
+    }
+}
+
+} // namespace cxxblas
+
+#endif // CXXBLAS_SPARSELEVEL2_GESELLMV_TCC
@@ -41,7 +41,9 @@ template <typename IndexType>
 
 } // namespace cxxblas
 
+#include <cxxblas/sparselevel2/gebsrmv.h>
 #include <cxxblas/sparselevel2/gecrsmv.h>
+#include <cxxblas/sparselevel2/gesellmv.h>
 #include <cxxblas/sparselevel2/heccsmv.h>
 #include <cxxblas/sparselevel2/hecrsmv.h>
 #include <cxxblas/sparselevel2/syccsmv.h>
@@ -53,7 +53,9 @@ getIndexBaseChar(IndexType x)
 
 } // namespace cxxblas
 
+#include <cxxblas/sparselevel2/gebsrmv.tcc>
 #include <cxxblas/sparselevel2/gecrsmv.tcc>
+#include <cxxblas/sparselevel2/gesellmv.tcc>
 #include <cxxblas/sparselevel2/heccsmv.tcc>
 #include <cxxblas/sparselevel2/hecrsmv.tcc>
 #include <cxxblas/sparselevel2/syccsmv.tcc>
@@ -0,0 +1,130 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef CXXBLAS_SPARSELEVEL3_GEBSRMM_TCC
+#define CXXBLAS_SPARSELEVEL3_GEBSRMM_TCC 1
+
+#include <cxxblas/auxiliary/auxiliary.h>
+#include <cxxblas/typedefs.h>
+
+#define HAVE_CXXBLAS_GEBSRMM 1
+
+namespace cxxblas {
+
+template <int BS, typename IndexType, typename ALPHA, typename MA,
+          typename MB, typename BETA, typename MC>
+void
+gebsrmm(Transpose        transA,
+        IndexType        m,
+        IndexType        n,
+        IndexType        k,
+        const ALPHA      &alpha,
+        const MA         *A,
+        const IndexType  *ia,
+        const IndexType  *ja,
+        const MB         *B,
+        IndexType        ldB,
+        const BETA       &beta,
+        MC               *C,
+        IndexType        ldC)
+{
+    CXXBLAS_DEBUG_OUT("gebsrmm_generic");
+
+    using cxxblas::conjugate;
+
+    const bool noTrans = (transA==NoTrans || transA==Conj);
+    const bool conjA   = (transA==Conj || transA==ConjTrans);
+
+//
+//  Scale C (which is m x n for op(A)=A and k x n otherwise)
+//
+    const IndexType mC = noTrans ? m : k;
+
+    if (beta==BETA(0)) {
+        for (IndexType l=0; l<n; ++l) {
+            for (IndexType i=0; i<mC; ++i) {
+                C[i+l*ldC] = MC(0);
+            }
+        }
+    } else if (beta!=BETA(1)) {
+        for (IndexType l=0; l<n; ++l) {
+            for (IndexType i=0; i<mC; ++i) {
+                C[i+l*ldC] *= beta;
+            }
+        }
+    }
+
+//
+//  Index base of the BSR matrix is stored in first Element of ia
+//
+    const IndexType base = ia[0];
+    const IndexType mb   = m/BS;
+
+    ja -= base;
+
+    for (IndexType I=0; I<mb; ++I) {
+        for (IndexType p=ia[I]; p<ia[I+1]; ++p) {
+            const MA        *a = A + (p-base)*BS*BS;
+            const IndexType J  = ja[p]-base;
+
+            for (IndexType l=0; l<n; ++l) {
+                if (noTrans) {
+                    const MB *b  = B + J*BS + l*ldB;
+                    MC       *cb = C + I*BS + l*ldC;
+
+                    for (int r=0; r<BS; ++r) {
+                        MC tmp = MC(0);
+                        for (int c=0; c<BS; ++c) {
+                            tmp += (conjA ? conjugate(a[r*BS+c])
+                                          : a[r*BS+c]) * b[c];
+                        }
+                        cb[r] += alpha*tmp;
+                    }
+                } else {
+                    const MB *b  = B + I*BS + l*ldB;
+                    MC       *cb = C + J*BS + l*ldC;
+
+                    for (int r=0; r<BS; ++r) {
+                        for (int c=0; c<BS; ++c) {
+                            cb[c] += alpha*(conjA ? conjugate(a[r*BS+c])
+                                                  : a[r*BS+c]) * b[r];
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+} // namespace cxxblas
+
+#endif // CXXBLAS_SPARSELEVEL3_GEBSRMM_TCC
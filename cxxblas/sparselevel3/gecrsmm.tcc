@@ -59,11 +59,82 @@ gecrsmm(Transpose        transA,
 {
     CXXBLAS_DEBUG_OUT("gecrsmm_generic");
 
-    for (IndexType i=0; i<n; ++i) {
-         gecrsmv(transA, m, k, alpha, A, ia, ja, B+i*ldB, beta, C+i*ldC);
+    using cxxblas::conjugate;
+
+    const bool noTrans = (transA==NoTrans || transA==Conj);
+    const bool conjA   = (transA==Conj || transA==ConjTrans);
+
+//
+//  Scale C (which is m x n for op(A)=A and k x n otherwise).  Afterwards we
+//  sweep once through the nonzeros of A and update all n columns of C for
+//  each of them.  So A gets streamed only once from memory instead of n times.
+//
+    const IndexType mC = noTrans ? m : k;
+
+    if (beta==BETA(0)) {
+        for (IndexType l=0; l<n; ++l) {
+            for (IndexType i=0; i<mC; ++i) {
+                C[i+l*ldC] = MC(0);
+            }
+        }
+    } else if (beta!=BETA(1)) {
+        for (IndexType l=0; l<n; ++l) {
+            for (IndexType i=0; i<mC; ++i) {
+                C[i+l*ldC] *= beta;
+            }
+        }
     }
 
-    return;
+//
+//  Index base of the CRS matrix is stored in first Element of ia
+//
+    --ia;
+    ja -= ia[1];
+    A  -= ia[1];
+
+    if (noTrans) {
+//
+//      Set correct index base for the rows of B
+//
+        B -= ia[1];
+
+        for (IndexType i=1; i<=m; ++i) {
+            MC *c = C + (i-1);
+            for (IndexType p=ia[i]; p<ia[i+1]; ++p) {
+                const MB *b = B + ja[p];
+                if (conjA) {
+                    for (IndexType l=0; l<n; ++l) {
+                        c[l*ldC] += alpha*conjugate(A[p])*b[l*ldB];
+                    }
+                } else {
+                    for (IndexType l=0; l<n; ++l) {
+                        c[l*ldC] += alpha*A[p]*b[l*ldB];
+                    }
+                }
+            }
+        }
+    } else {
+//
+//      Set correct index base for the rows of C
+//
+        C -= ia[1];
+
+        for (IndexType i=1; i<=m; ++i) {
+            const MB *b = B + (i-1);
+            for (IndexType p=ia[i]; p<ia[i+1]; ++p) {
+                MC *c = C + ja[p];
+                if (conjA) {
+                    for (IndexType l=0; l<n; ++l) {
+                        c[l*ldC] += alpha*conjugate(A[p])*b[l*ldB];
+                    }
+                } else {
+                    for (IndexType l=0; l<n; ++l) {
+                        c[l*ldC] += alpha*A[p]*b[l*ldB];
+                    }
+                }
+            }
+        }
+    }
 }
 
 #ifdef HAVE_SPARSEBLAS
@@ -0,0 +1,151 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef CXXBLAS_SPARSELEVEL3_GESELLMM_TCC
+#define CXXBLAS_SPARSELEVEL3_GESELLMM_TCC 1
+
+#include <cxxblas/auxiliary/auxiliary.h>
+#include <cxxblas/typedefs.h>
+
+#define HAVE_CXXBLAS_GESELLMM 1
+
+namespace cxxblas {
+
+template <int CS, typename IndexType, typename ALPHA, typename MA,
+          typename MB, typename BETA, typename MC>
+void
+gesellmm(Transpose        transA,
+         IndexType        m,
+         IndexType        n,
+         IndexType        k,
+         const ALPHA      &alpha,
+         const MA         *A,
+         const IndexType  *chunkPtr,
+         const IndexType  *chunkLength,
+         const IndexType  *ja,
+         const IndexType  *perm,
+         const MB         *B,
+         IndexType        ldB,
+         const BETA       &beta,
+         MC               *C,
+         IndexType        ldC)
+{
+    CXXBLAS_DEBUG_OUT("gesellmm_generic");
+
+    using cxxblas::conjugate;
+
+    const bool noTrans = (transA==NoTrans || transA==Conj);
+    const bool conjA   = (transA==Conj || transA==ConjTrans);
+
+//
+//  Scale C (which is m x n for op(A)=A and k x n otherwise)
+//
+    const IndexType mC = noTrans ? m : k;
+
+    if (beta==BETA(0)) {
+        for (IndexType l=0; l<n; ++l) {
+            for (IndexType i=0; i<mC; ++i) {
+                C[i+l*ldC] = MC(0);
+            }
+        }
+    } else if (beta!=BETA(1)) {
+        for (IndexType l=0; l<n; ++l) {
+            for (IndexType i=0; i<mC; ++i) {
+                C[i+l*ldC] *= beta;
+            }
+        }
+    }
+
+//
+//  Index base of the SELL matrix is stored in first Element of chunkPtr.
+//  Set correct index base for A, ja and the rows of B and C.
+//
+    const IndexType base = chunkPtr[0];
+
+    A  -= base;
+    ja -= base;
+    B  -= base;
+    C  -= base;
+
+    const IndexType numChunks = (m+CS-1)/CS;
+
+//
+//  Each chunk gets applied to all n columns while it is still in cache
+//
+    for (IndexType c=0; c<numChunks; ++c) {
+        const IndexType numSlots = (m-c*CS<CS) ? m-c*CS : CS;
+        const IndexType *p = perm + c*CS;
+
+        for (IndexType l=0; l<n; ++l) {
+            const MB *b  = B + l*ldB;
+            MC       *cl = C + l*ldC;
+
+            const MA        *a = A  + chunkPtr[c];
+            const IndexType *j = ja + chunkPtr[c];
+
+            if (noTrans) {
+                MC tmp[CS];
+                for (int r=0; r<CS; ++r) {
+                    tmp[r] = MC(0);
+                }
+                for (IndexType q=0; q<chunkLength[c]; ++q, a+=CS, j+=CS) {
+                    if (conjA) {
+                        for (int r=0; r<CS; ++r) {
+                            tmp[r] += conjugate(a[r])*b[j[r]];
+                        }
+                    } else {
+                        for (int r=0; r<CS; ++r) {
+                            tmp[r] += a[r]*b[j[r]];
+                        }
+                    }
+                }
+                for (IndexType r=0; r<numSlots; ++r) {
+                    cl[p[r]] += alpha*tmp[r];
+                }
+            } else {
+                for (IndexType q=0; q<chunkLength[c]; ++q, a+=CS, j+=CS) {
+                    for (IndexType r=0; r<numSlots; ++r) {
+                        if (conjA) {
+                            cl[j[r]] += alpha*conjugate(a[r])*b[p[r]];
+                        } else {
+                            cl[j[r]] += alpha*a[r]*b[p[r]];
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+} // namespace cxxblas
+
+#endif // CXXBLAS_SPARSELEVEL3_GESELLMM_TCC
@@ -33,7 +33,9 @@
 #ifndef CXXBLAS_SPARSELEVEL3_SPARSELEVEL3_H
 #define CXXBLAS_SPARSELEVEL3_SPARSELEVEL3_H 1
 
+#include <cxxblas/sparselevel3/gebsrmm.h>
 #include <cxxblas/sparselevel3/gecrsmm.h>
+#include <cxxblas/sparselevel3/gesellmm.h>
 #include <cxxblas/sparselevel3/heccsmm.h>
 #include <cxxblas/sparselevel3/hecrsmm.h>
 #include <cxxblas/sparselevel3/syccsmm.h>
@@ -33,7 +33,9 @@
 #ifndef CXXBLAS_SPARSELEVEL3_SPARSELEVEL3_TCC
 #define CXXBLAS_SPARSELEVEL3_SPARSELEVEL3_TCC 1
 
+#include <cxxblas/sparselevel3/gebsrmm.tcc>
 #include <cxxblas/sparselevel3/gecrsmm.tcc>
+#include <cxxblas/sparselevel3/gesellmm.tcc>
 #include <cxxblas/sparselevel3/heccsmm.tcc>
 #include <cxxblas/sparselevel3/hecrsmm.tcc>
 #include <cxxblas/sparselevel3/syccsmm.tcc>
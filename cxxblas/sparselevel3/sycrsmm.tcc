@@ -58,8 +58,54 @@ sycrsmm(StorageUpLo      upLo,
 {
     CXXBLAS_DEBUG_OUT("sycrsmm_generic");
 
-        for (IndexType i=0; i<n; ++i) {
-         sycrsmv(upLo, m, alpha, A, ia, ja, B+i*ldB, beta, C+i*ldC);
+//
+//  Scale C.  Afterwards we sweep once through the stored triangle of A and
+//  update all n columns of C for each nonzero.
+//
+    if (beta==BETA(0)) {
+        for (IndexType l=0; l<n; ++l) {
+            for (IndexType i=0; i<m; ++i) {
+                C[i+l*ldC] = MC(0);
+            }
+        }
+    } else if (beta!=BETA(1)) {
+        for (IndexType l=0; l<n; ++l) {
+            for (IndexType i=0; i<m; ++i) {
+                C[i+l*ldC] *= beta;
+            }
+        }
+    }
+
+//
+//  The correct index base of the CRS matrix is stored in first Element of ia
+//
+    --ia;
+    ja -= ia[1];
+    A  -= ia[1];
+
+//
+//  B_, C_ get correct index base ia[1] for the rows
+//
+    const MB *B_ = B - ia[1];
+    MC       *C_ = C - ia[1];
+
+    for (IndexType i=1, I=ia[1]; i<=m; ++i, ++I) {
+        const MB *b  = B + (i-1);
+        MC       *c  = C + (i-1);
+        for (IndexType p=ia[i]; p<ia[i+1]; ++p) {
+            const IndexType J = ja[p];
+            const MB *bJ = B_ + J;
+            MC       *cJ = C_ + J;
+
+            for (IndexType l=0; l<n; ++l) {
+                c[l*ldC] += alpha*A[p]*bJ[l*ldB];
+            }
+            if (J!=I) {
+                for (IndexType l=0; l<n; ++l) {
+                    cJ[l*ldC] += alpha*A[p]*b[l*ldB];
+                }
+            }
+        }
     }
 }
 
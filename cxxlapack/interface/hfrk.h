@@ -38,7 +38,7 @@
 namespace cxxlapack {
 
 template <typename IndexType>
-    IndexType
+    void
     hfrk (char                        transr,
           char                        uplo,
           char                        trans,
@@ -51,7 +51,7 @@ template <typename IndexType>
           std::complex<float >        *C);
 
 template <typename IndexType>
-    IndexType
+    void
     hfrk (char                        transr,
           char                        uplo,
           char                        trans,
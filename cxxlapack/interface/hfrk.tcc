@@ -39,9 +39,8 @@
 
 namespace cxxlapack {
 
-
 template <typename IndexType>
-IndexType
+void
 hfrk (char                        transr,
       char                        uplo,
       char                        trans,
@@ -55,7 +54,6 @@ hfrk (char                        transr,
 {
     CXXLAPACK_DEBUG_OUT("chfrk");
 
-    IndexType info;
     LAPACK_IMPL(chfrk)(&transr,
                        &uplo,
                        &trans,
@@ -65,19 +63,11 @@ hfrk (char                        transr,
                        reinterpret_cast<const float  *>(A),
                        &ldA,
                        &beta,
-                       reinterpret_cast<float  *>(C),
-                       &info);
-#   ifndef NDEBUG
-    if (info<0) {
-        std::cerr << "info = " << info << std::endl;
-    }
-#   endif
-    ASSERT(info>=0);
-    return info;
+                       reinterpret_cast<float  *>(C));
 }
 
 template <typename IndexType>
-IndexType
+void
 hfrk (char                        transr,
       char                        uplo,
       char                        trans,
@@ -91,7 +81,6 @@ hfrk (char                        transr,
 {
     CXXLAPACK_DEBUG_OUT("zhfrk");
 
-    IndexType info;
     LAPACK_IMPL(zhfrk)(&transr,
                        &uplo,
                        &trans,
@@ -101,15 +90,7 @@ hfrk (char                        transr,
                        reinterpret_cast<const double *>(A),
                        &ldA,
                        &beta,
-                       reinterpret_cast<double *>(C),
-                       &info);
-#   ifndef NDEBUG
-    if (info<0) {
-        std::cerr << "info = " << info << std::endl;
-    }
-#   endif
-    ASSERT(info>=0);
-    return info;
+                       reinterpret_cast<double *>(C));
 }
 
 } // namespace cxxlapack
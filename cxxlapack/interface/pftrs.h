@@ -30,8 +30,8 @@
  *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
-#ifndef CXXLAPACK_INTERFACE_DUMMY_H
-#define CXXLAPACK_INTERFACE_DUMMY_H 1
+#ifndef CXXLAPACK_INTERFACE_PFTRS_H
+#define CXXLAPACK_INTERFACE_PFTRS_H 1
 
 #include <cxxstd/complex.h>
 
@@ -39,29 +39,44 @@ namespace cxxlapack {
 
 template <typename IndexType>
     IndexType
-    dummy(IndexType             m,
+    pftrs(char                  transr,
+          char                  uplo,
           IndexType             n,
-          float                 *A);
+          IndexType             nRhs,
+          const float           *A,
+          float                 *B,
+          IndexType             ldB);
 
 template <typename IndexType>
     IndexType
-    dummy(IndexType             m,
+    pftrs(char                  transr,
+          char                  uplo,
           IndexType             n,
-          double                *A);
+          IndexType             nRhs,
+          const double          *A,
+          double                *B,
+          IndexType             ldB);
 
 template <typename IndexType>
     IndexType
-    dummy(IndexType             n,
-          IndexType             m,
-          std::complex<float >  *A);
-
+    pftrs(char                        transr,
+          char                        uplo,
+          IndexType                   n,
+          IndexType                   nRhs,
+          const std::complex<float >  *A,
+          std::complex<float >        *B,
+          IndexType                   ldB);
 
 template <typename IndexType>
     IndexType
-    dummy(IndexType             n,
-          IndexType             m,
-          std::complex<double>  *A);
+    pftrs(char                        transr,
+          char                        uplo,
+          IndexType                   n,
+          IndexType                   nRhs,
+          const std::complex<double>  *A,
+          std::complex<double>        *B,
+          IndexType                   ldB);
 
 } // namespace cxxlapack
 
-#endif // CXXLAPACK_INTERFACE_DUMMY_H
+#endif // CXXLAPACK_INTERFACE_PFTRS_H
@@ -44,7 +44,7 @@ template <typename IndexType>
           float                 *d,
           float                 *e,
           float                 *B,
-          IndexType             &ldB);
+          IndexType             ldB);
 
 template <typename IndexType>
     IndexType
@@ -53,25 +53,25 @@ template <typename IndexType>
           double                *d,
           double                *e,
           double                *B,
-          IndexType             &ldB);
+          IndexType             ldB);
 
 template <typename IndexType>
     IndexType
     ptsv (IndexType             n,
           IndexType             nRhs,
-          std::complex<float >  *d,
+          float                 *d,
           std::complex<float >  *e,
           std::complex<float >  *B,
-          IndexType             &ldB);
+          IndexType             ldB);
 
 template <typename IndexType>
     IndexType
     ptsv (IndexType             n,
           IndexType             nRhs,
-          std::complex<double>  *d,
+          double                *d,
           std::complex<double>  *e,
           std::complex<double>  *B,
-          IndexType             &ldB);
+          IndexType             ldB);
 
 } // namespace cxxlapack
 
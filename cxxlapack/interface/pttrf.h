@@ -51,13 +51,13 @@ template <typename IndexType>
 
 template <typename IndexType>
     IndexType
-    dpttrf(IndexType             n,
-           float                 *d,
-           std::complex<float >  *e);
+    pttrf(IndexType             n,
+          float                 *d,
+          std::complex<float >  *e);
 
 template <typename IndexType>
     IndexType
-    dpttrf(IndexType             n,
+    pttrf(IndexType             n,
           double                *d,
           std::complex<double>  *e);
 
@@ -57,7 +57,8 @@ template <typename IndexType>
 
 template <typename IndexType>
     IndexType
-    pttrs(IndexType                   n,
+    pttrs(char                        upLo,
+          IndexType                   n,
           IndexType                   nRhs,
           const float                 *d,
           const std::complex<float >  *e,
@@ -66,7 +67,8 @@ template <typename IndexType>
 
 template <typename IndexType>
     IndexType
-    pttrs(IndexType                   n,
+    pttrs(char                        upLo,
+          IndexType                   n,
           IndexType                   nRhs,
           const double                *d,
           const std::complex<double>  *e,
@@ -97,7 +97,8 @@ pttrs(IndexType             n,
 
 template <typename IndexType>
 IndexType
-pttrs(IndexType                   n,
+pttrs(char                        upLo,
+      IndexType                   n,
       IndexType                   nRhs,
       const float                 *d,
       const std::complex<float >  *e,
@@ -107,7 +108,8 @@ pttrs(IndexType                   n,
     CXXLAPACK_DEBUG_OUT("cpttrs");
 
     IndexType info;
-    LAPACK_IMPL(cpttrs)(&n,
+    LAPACK_IMPL(cpttrs)(&upLo,
+                        &n,
                         &nRhs,
                         d,
                         reinterpret_cast<const float  *>(e),
@@ -125,7 +127,8 @@ pttrs(IndexType                   n,
 
 template <typename IndexType>
 IndexType
-pttrs(IndexType                   n,
+pttrs(char                        upLo,
+      IndexType                   n,
       IndexType                   nRhs,
       const double                *d,
       const std::complex<double>  *e,
@@ -135,7 +138,8 @@ pttrs(IndexType                   n,
     CXXLAPACK_DEBUG_OUT("zpttrs");
 
     IndexType info;
-    LAPACK_IMPL(zpttrs)(&n,
+    LAPACK_IMPL(zpttrs)(&upLo,
+                        &n,
                         &nRhs,
                         d,
                         reinterpret_cast<const double *>(e),
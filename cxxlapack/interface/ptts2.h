@@ -38,7 +38,7 @@
 namespace cxxlapack {
 
 template <typename IndexType>
-    IndexType
+    void
     ptts2(IndexType             n,
           IndexType             nRhs,
           const float           *d,
@@ -47,7 +47,7 @@ template <typename IndexType>
           IndexType             ldB);
 
 template <typename IndexType>
-    IndexType
+    void
     ptts2(IndexType             n,
           IndexType             nRhs,
           const double          *d,
@@ -56,8 +56,9 @@ template <typename IndexType>
           IndexType             ldB);
 
 template <typename IndexType>
-    IndexType
-    ptts2(IndexType                   n,
+    void
+    ptts2(IndexType                   iUpLo,
+          IndexType                   n,
           IndexType                   nRhs,
           const float                 *d,
           const std::complex<float >  *e,
@@ -65,8 +66,9 @@ template <typename IndexType>
           IndexType                   ldB);
 
 template <typename IndexType>
-    IndexType
-    ptts2(IndexType                   n,
+    void
+    ptts2(IndexType                   iUpLo,
+          IndexType                   n,
           IndexType                   nRhs,
           const double                *d,
           const std::complex<double>  *e,
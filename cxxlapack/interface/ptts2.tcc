@@ -41,7 +41,7 @@ namespace cxxlapack {
 
 template <typename IndexType>
 void
-pttrs(IndexType             n,
+ptts2(IndexType             n,
       IndexType             nRhs,
       const float           *d,
       const float           *e,
@@ -60,7 +60,7 @@ pttrs(IndexType             n,
 
 template <typename IndexType>
 void
-pttrs(IndexType             n,
+ptts2(IndexType             n,
       IndexType             nRhs,
       const double          *d,
       const double          *e,
@@ -79,7 +79,8 @@ pttrs(IndexType             n,
 
 template <typename IndexType>
 void
-ptts2(IndexType                   n,
+ptts2(IndexType                   iUpLo,
+      IndexType                   n,
       IndexType                   nRhs,
       const float                 *d,
       const std::complex<float >  *e,
@@ -88,7 +89,8 @@ ptts2(IndexType                   n,
 {
     CXXLAPACK_DEBUG_OUT("cptts2");
 
-    LAPACK_IMPL(cptts2)(&n,
+    LAPACK_IMPL(cptts2)(&iUpLo,
+                        &n,
                         &nRhs,
                         d,
                         reinterpret_cast<const float  *>(e),
@@ -98,7 +100,8 @@ ptts2(IndexType                   n,
 
 template <typename IndexType>
 void
-ptts2(IndexType                   n,
+ptts2(IndexType                   iUpLo,
+      IndexType                   n,
       IndexType                   nRhs,
       const double                *d,
       const std::complex<double>  *e,
@@ -107,7 +110,8 @@ ptts2(IndexType                   n,
 {
     CXXLAPACK_DEBUG_OUT("zptts2");
 
-    LAPACK_IMPL(zptts2)(&n,
+    LAPACK_IMPL(zptts2)(&iUpLo,
+                        &n,
                         &nRhs,
                         d,
                         reinterpret_cast<const double *>(e),
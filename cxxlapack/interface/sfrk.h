@@ -38,7 +38,7 @@
 namespace cxxlapack {
 
 template <typename IndexType>
-    IndexType
+    void
     sfrk (char                  transr,
           char                  uplo,
           char                  trans,
@@ -51,7 +51,7 @@ template <typename IndexType>
           float                 *C);
 
 template <typename IndexType>
-    IndexType
+    void
     sfrk (char                  transr,
           char                  uplo,
           char                  trans,
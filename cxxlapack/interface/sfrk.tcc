@@ -40,7 +40,7 @@
 namespace cxxlapack {
 
 template <typename IndexType>
-IndexType
+void
 sfrk (char                  transr,
       char                  uplo,
       char                  trans,
@@ -54,7 +54,6 @@ sfrk (char                  transr,
 {
     CXXLAPACK_DEBUG_OUT("ssfrk");
 
-    IndexType info;
     LAPACK_IMPL(ssfrk) (&transr,
                         &uplo,
                         &trans,
@@ -64,19 +63,11 @@ sfrk (char                  transr,
                         A,
                         &ldA,
                         &beta,
-                        C,
-                        &info);
-#   ifndef NDEBUG
-    if (info<0) {
-        std::cerr << "info = " << info << std::endl;
-    }
-#   endif
-    ASSERT(info>=0);
-    return info;
+                        C);
 }
 
 template <typename IndexType>
-IndexType
+void
 sfrk (char                  transr,
       char                  uplo,
       char                  trans,
@@ -90,7 +81,6 @@ sfrk (char                  transr,
 {
     CXXLAPACK_DEBUG_OUT("dsfrk");
 
-    IndexType info;
     LAPACK_IMPL(dsfrk) (&transr,
                         &uplo,
                         &trans,
@@ -100,15 +90,7 @@ sfrk (char                  transr,
                         A,
                         &ldA,
                         &beta,
-                        C,
-                        &info);
-#   ifndef NDEBUG
-    if (info<0) {
-        std::cerr << "info = " << info << std::endl;
-    }
-#   endif
-    ASSERT(info>=0);
-    return info;
+                        C);
 }
 
 } // namespace cxxlapack
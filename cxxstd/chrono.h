@@ -0,0 +1,6 @@
+#ifndef CXXSTD_CHRONO_H
+#define CXXSTD_CHRONO_H 1
+
+#include <chrono>
+
+#endif // CXXSTD_CHRONO_H
@@ -0,0 +1,6 @@
+#ifndef CXXSTD_ITERATOR_H
+#define CXXSTD_ITERATOR_H 1
+
+#include <iterator>
+
+#endif // CXXSTD_ITERATOR_H
@@ -1,6 +1,7 @@
 #ifndef CXXSTD_LIMITS_H
 #define CXXSTD_LIMITS_H 1
 
+#include <limits>
 #include <type_traits>
 
 #endif // CXXSTD_LIMITS_H
@@ -0,0 +1,6 @@
+#ifndef CXXSTD_MUTEX_H
+#define CXXSTD_MUTEX_H 1
+
+#include <mutex>
+
+#endif // CXXSTD_MUTEX_H
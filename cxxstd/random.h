@@ -0,0 +1,6 @@
+#ifndef CXXSTD_RANDOM_H
+#define CXXSTD_RANDOM_H 1
+
+#include <random>
+
+#endif // CXXSTD_RANDOM_H
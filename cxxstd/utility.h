@@ -0,0 +1,6 @@
+#ifndef CXXSTD_UTILITY_H
+#define CXXSTD_UTILITY_H 1
+
+#include <utility>
+
+#endif // CXXSTD_UTILITY_H
@@ -35,6 +35,7 @@
 
 #include <flens/auxiliary/allocator.h>
 #include <flens/auxiliary/constref.h>
+#include <flens/auxiliary/construct.h>
 #include <flens/auxiliary/compatiblescalar.h>
 #include <flens/auxiliary/compatibletype.h>
 #include <flens/auxiliary/complextrait.h>
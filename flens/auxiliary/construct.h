@@ -0,0 +1,88 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FLENS_AUXILIARY_CONSTRUCT_H
+#define FLENS_AUXILIARY_CONSTRUCT_H 1
+
+#include <cxxstd/iterator.h>
+#include <cxxstd/type_traits.h>
+#include <flens/auxiliary/restrictto.h>
+
+namespace flens {
+
+//
+//  Storage schemes allocate raw memory.  Elements of types that own
+//  resources (e.g. mpfr::real) have to be constructed before they can get
+//  assigned and destroyed before the memory gets released.  For all other
+//  types these functions are no-ops.  In particular std::complex is not
+//  trivially default constructible but gets assigned before it is read, so
+//  constructing it would just add a pass over the memory.
+//
+template <typename Pointer>
+struct PointerValueType
+{
+    typedef typename std::iterator_traits<Pointer>::value_type  Type;
+};
+
+template <typename T>
+struct NeedsConstruction
+{
+    static const bool value = !std::is_trivially_destructible<T>::value;
+};
+
+template <typename Pointer, typename IndexType>
+    typename RestrictTo<!NeedsConstruction<
+                            typename PointerValueType<Pointer>::Type>::value,
+                        void>::Type
+    default_construct_n(Pointer p, IndexType n);
+
+template <typename Pointer, typename IndexType>
+    typename RestrictTo<NeedsConstruction<
+                            typename PointerValueType<Pointer>::Type>::value,
+                        void>::Type
+    default_construct_n(Pointer p, IndexType n);
+
+template <typename Pointer, typename IndexType>
+    typename RestrictTo<std::is_trivially_destructible<
+                            typename PointerValueType<Pointer>::Type>::value,
+                        void>::Type
+    destroy_n(Pointer p, IndexType n);
+
+template <typename Pointer, typename IndexType>
+    typename RestrictTo<!std::is_trivially_destructible<
+                            typename PointerValueType<Pointer>::Type>::value,
+                        void>::Type
+    destroy_n(Pointer p, IndexType n);
+
+} // namespace flens
+
+#endif // FLENS_AUXILIARY_CONSTRUCT_H
@@ -0,0 +1,83 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FLENS_AUXILIARY_CONSTRUCT_TCC
+#define FLENS_AUXILIARY_CONSTRUCT_TCC 1
+
+#include <cxxstd/algorithm.h>
+#include <flens/auxiliary/construct.h>
+
+namespace flens {
+
+template <typename Pointer, typename IndexType>
+typename RestrictTo<!NeedsConstruction<
+                        typename PointerValueType<Pointer>::Type>::value,
+                    void>::Type
+default_construct_n(Pointer, IndexType)
+{
+}
+
+template <typename Pointer, typename IndexType>
+typename RestrictTo<NeedsConstruction<
+                        typename PointerValueType<Pointer>::Type>::value,
+                    void>::Type
+default_construct_n(Pointer p, IndexType n)
+{
+    typedef typename PointerValueType<Pointer>::Type  T;
+
+    flens::alg::uninitialized_fill_n(p, n, T());
+}
+
+template <typename Pointer, typename IndexType>
+typename RestrictTo<std::is_trivially_destructible<
+                        typename PointerValueType<Pointer>::Type>::value,
+                    void>::Type
+destroy_n(Pointer, IndexType)
+{
+}
+
+template <typename Pointer, typename IndexType>
+typename RestrictTo<!std::is_trivially_destructible<
+                        typename PointerValueType<Pointer>::Type>::value,
+                    void>::Type
+destroy_n(Pointer p, IndexType n)
+{
+    typedef typename PointerValueType<Pointer>::Type  T;
+
+    for (IndexType i=0; i<n; ++i) {
+        p[i].~T();
+    }
+}
+
+} // namespace flens
+
+#endif // FLENS_AUXILIARY_CONSTRUCT_TCC
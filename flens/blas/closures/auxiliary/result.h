@@ -41,6 +41,13 @@
 
 namespace flens {
 
+//
+//  Temporaries for evaluated closures draw from the workspace arena unless
+//  FLENS_NO_WORKSPACE is defined (see flens/storage/workspace/workspace.h).
+//  Like all workspace allocated objects they must not be passed to another
+//  thread.
+//
+
 //-- General definition --------------------------------------------------------
 template <typename A>
 struct Result
@@ -55,8 +62,10 @@ struct Result<VectorClosure<Op, L, R> >
 {
     typedef typename VectorClosure<Op, L, R>::ElementType T;
 
-    typedef DenseVector<Array<T> >  Type;
-    typedef typename Type::NoView   NoView;
+    typedef typename WorkspaceAllocatorFor<std::allocator<T> >::Type  A;
+
+    typedef DenseVector<Array<T, IndexOptions<>, A> >  Type;
+    typedef typename Type::NoView                      NoView;
 };
 
 //-- MatrixClosures ------------------------------------------------------------
@@ -67,7 +76,8 @@ struct Result<MatrixClosure<Op, L, R> >
 
     typedef typename AllocatorType<L>::Type LA;
     typedef typename AllocatorType<R>::Type RA;
-    typedef typename CommonAllocator<LA,RA>::Type A;
+    typedef typename CommonAllocator<LA,RA>::Type A_;
+    typedef typename WorkspaceAllocatorFor<A_>::Type A;
 
     typedef GeMatrix<FullStorage<T, ColMajor, IndexOptions<>, A> >  Type;
     typedef typename Type::NoView                                   NoView;
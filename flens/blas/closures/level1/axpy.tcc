@@ -72,28 +72,13 @@ axpy(const ALPHA &alpha, const VectorClosure<OpConj, VL, VR> &x, Vector<VY> &y)
 //
 //  y += alpha*(x1+x2)
 //
-#ifndef FLENS_DEBUG_CLOSURES
-
-template <typename ALPHA, typename VL, typename VR, typename VY>
-typename RestrictTo<VCDefaultEval<OpAdd, VL, VR>::value
-                 && IsVector<VL>::value
-                 && IsVector<VR>::value,
-         void>::Type
-axpy(const ALPHA &, const VectorClosure<OpAdd, VL, VR> &, Vector<VY> &)
-{
-//
-//  Note that y += x1+x2  or  y -= x1+x2 is equivalent to y = y + (x1+x2) or
-//  y = y - (x1+x2) respectively.  Hence, the result of x1+x2 has to be
-//  computed *before* we can update y.  This means that a temporary vectors is
-//  needed to hold the result of x1+x2.  We only allow this if the
+//  If y is not referenced in x1+x2 this is evaluated without temporary as
+//  y += alpha*x1 and y += alpha*x2.  Otherwise the result of x1+x2 has to
+//  be computed *before* we can update y.  This means that a temporary vector
+//  is needed to hold the result of x1+x2.  We only allow this if the
 //  FLENS_DEBUG_CLOSURES macro is defined such that a user has a chance to
 //  optimize his/her expressions.
 //
-    ASSERT(0);
-}
-
-#else
-
 template <typename ALPHA, typename VL, typename VR, typename VY>
 typename RestrictTo<VCDefaultEval<OpAdd, VL, VR>::value
                  && IsVector<VL>::value
@@ -101,6 +86,13 @@ typename RestrictTo<VCDefaultEval<OpAdd, VL, VR>::value
          void>::Type
 axpy(const ALPHA &alpha, const VectorClosure<OpAdd, VL, VR> &x, Vector<VY> &y)
 {
+    if (!DebugClosure::search(x, y.impl())) {
+        axpy(alpha, x.left(), y.impl());
+        axpy(alpha, x.right(), y.impl());
+        return;
+    }
+
+#   ifdef FLENS_DEBUG_CLOSURES
     FLENS_BLASLOG_BEGIN_AXPY(alpha, x, y);
     typedef VectorClosure<OpAdd, VL, VR>  VC;
 
@@ -118,36 +110,22 @@ axpy(const ALPHA &alpha, const VectorClosure<OpAdd, VL, VR> &x, Vector<VY> &y)
 
     FLENS_BLASLOG_TMP_REMOVE(tmp, x);
     FLENS_BLASLOG_END;
+#   else
+    ASSERT(0);
+#   endif
 }
 
-#endif
-
 //------------------------------------------------------------------------------
 //
 //  y += alpha*(x1-x2)
 //
-#ifndef FLENS_DEBUG_CLOSURES
-
-template <typename ALPHA, typename VL, typename VR, typename VY>
-typename RestrictTo<VCDefaultEval<OpSub, VL, VR>::value
-                 && IsVector<VL>::value
-                 && IsVector<VR>::value,
-         void>::Type
-axpy(const ALPHA &, const VectorClosure<OpSub, VL, VR> &, Vector<VY> &)
-{
-//
-//  Note that y += x1-x2  or  y -= x1-x2 is equivalent to y = y + (x1-x2) or
-//  y = y - (x1-x2) respectively.  Hence, the result of x1-x2 has to be
-//  computed *before* we can update y.  This means that a temporary vectors is
-//  needed to hold the result of x1-x2.  We only allow this if the
+//  If y is not referenced in x1-x2 this is evaluated without temporary as
+//  y += alpha*x1 and y -= alpha*x2.  Otherwise the result of x1-x2 has to
+//  be computed *before* we can update y.  This means that a temporary vector
+//  is needed to hold the result of x1-x2.  We only allow this if the
 //  FLENS_DEBUG_CLOSURES macro is defined such that a user has a chance to
 //  optimize his/her expressions.
 //
-    ASSERT(0);
-}
-
-#else
-
 template <typename ALPHA, typename VL, typename VR, typename VY>
 typename RestrictTo<VCDefaultEval<OpSub, VL, VR>::value
                  && IsVector<VL>::value
@@ -155,6 +133,13 @@ typename RestrictTo<VCDefaultEval<OpSub, VL, VR>::value
          void>::Type
 axpy(const ALPHA &alpha, const VectorClosure<OpSub, VL, VR> &x, Vector<VY> &y)
 {
+    if (!DebugClosure::search(x, y.impl())) {
+        axpy(alpha, x.left(), y.impl());
+        axpy(-alpha, x.right(), y.impl());
+        return;
+    }
+
+#   ifdef FLENS_DEBUG_CLOSURES
     FLENS_BLASLOG_BEGIN_AXPY(alpha, x, y);
     typedef VectorClosure<OpSub, VL, VR>  VC;
 
@@ -172,10 +157,11 @@ axpy(const ALPHA &alpha, const VectorClosure<OpSub, VL, VR> &x, Vector<VY> &y)
 
     FLENS_BLASLOG_TMP_REMOVE(tmp, x);
     FLENS_BLASLOG_END;
+#   else
+    ASSERT(0);
+#   endif
 }
 
-#endif
-
 //------------------------------------------------------------------------------
 //
 //  y += scalar*x
@@ -505,29 +491,13 @@ axpy(const ALPHA                      &FLENS_BLASLOG_VARDECL(alpha),
 //
 //  B += alpha*op(A1 + A2)
 //
-#ifndef FLENS_DEBUG_CLOSURES
-
-template <typename ALPHA, typename ML, typename MR, typename MB>
-typename RestrictTo<MCDefaultEval<OpAdd, ML, MR>::value
-                 && IsMatrix<ML>::value
-                 && IsMatrix<MR>::value,
-         void>::Type
-axpy(Transpose, const ALPHA &, const MatrixClosure<OpAdd, ML, MR> &,
-     Matrix<MB> &)
-{
-//
-//  Note that B += A1+A2  or  B -= A1+A2 is equivalent to B = B + (A1+A2) or
-//  B = B - (A1+A2) respectively.  Hence, the result of A1+A2 has to be
-//  computed *before* we can update y.  This means that a temporary vectors is
-//  needed to hold the result of A1+A2.  We only allow this if the
+//  If B is not referenced in A1+A2 this is evaluated without temporary as
+//  B += alpha*op(A1) and B += alpha*op(A2).  Otherwise the result of A1+A2
+//  has to be computed *before* we can update B.  This means that a temporary
+//  matrix is needed to hold the result of A1+A2.  We only allow this if the
 //  FLENS_DEBUG_CLOSURES macro is defined such that a user has a chance to
 //  optimize his/her expressions.
 //
-    ASSERT(0);
-}
-
-#else
-
 template <typename ALPHA, typename ML, typename MR, typename MB>
 typename RestrictTo<MCDefaultEval<OpAdd, ML, MR>::value
                  && IsMatrix<ML>::value
@@ -536,6 +506,13 @@ typename RestrictTo<MCDefaultEval<OpAdd, ML, MR>::value
 axpy(Transpose trans, const ALPHA &alpha,
      const MatrixClosure<OpAdd, ML, MR> &A, Matrix<MB> &B)
 {
+    if (!DebugClosure::search(A, B.impl())) {
+        axpy(trans, alpha, A.left(), B.impl());
+        axpy(trans, alpha, A.right(), B.impl());
+        return;
+    }
+
+#   ifdef FLENS_DEBUG_CLOSURES
     FLENS_BLASLOG_BEGIN_MAXPY(trans, alpha, A, B);
     typedef MatrixClosure<OpAdd, ML, MR>  MC;
 
@@ -547,43 +524,28 @@ axpy(Transpose trans, const ALPHA &alpha,
     typename Result<MC>::Type tmp = A;
     FLENS_BLASLOG_TMP_TROFF;
 //
-//  Update y with tmp, i.e. compute B = B + alpha*tmp
+//  Update B with tmp, i.e. compute B = B + alpha*tmp
 //
     axpy(trans, alpha, tmp, B.impl());
 
     FLENS_BLASLOG_TMP_REMOVE(tmp, A);
     FLENS_BLASLOG_END;
+#   else
+    ASSERT(0);
+#   endif
 }
 
-#endif
-
 //------------------------------------------------------------------------------
 //
 //  B += alpha*op(A1 - A2)
 //
-#ifndef FLENS_DEBUG_CLOSURES
-
-template <typename ALPHA, typename ML, typename MR, typename MB>
-typename RestrictTo<MCDefaultEval<OpSub, ML, MR>::value
-                 && IsMatrix<ML>::value
-                 && IsMatrix<MR>::value,
-         void>::Type
-axpy(Transpose, const ALPHA &, const MatrixClosure<OpSub, ML, MR> &,
-     Matrix<MB> &)
-{
-//
-//  Note that B += A1+A2  or  B -= A1+A2 is equivalent to B = B + (A1+A2) or
-//  B = B - (A1+A2) respectively.  Hence, the result of A1+A2 has to be
-//  computed *before* we can update y.  This means that a temporary vectors is
-//  needed to hold the result of A1+A2.  We only allow this if the
+//  If B is not referenced in A1-A2 this is evaluated without temporary as
+//  B += alpha*op(A1) and B -= alpha*op(A2).  Otherwise the result of A1-A2
+//  has to be computed *before* we can update B.  This means that a temporary
+//  matrix is needed to hold the result of A1-A2.  We only allow this if the
 //  FLENS_DEBUG_CLOSURES macro is defined such that a user has a chance to
 //  optimize his/her expressions.
 //
-    ASSERT(0);
-}
-
-#else
-
 template <typename ALPHA, typename ML, typename MR, typename MB>
 typename RestrictTo<MCDefaultEval<OpSub, ML, MR>::value
                  && IsMatrix<ML>::value
@@ -592,27 +554,35 @@ typename RestrictTo<MCDefaultEval<OpSub, ML, MR>::value
 axpy(Transpose trans, const ALPHA &alpha,
      const MatrixClosure<OpSub, ML, MR> &A, Matrix<MB> &B)
 {
-    typedef MatrixClosure<OpSub, ML, MR>  MC;
+    if (!DebugClosure::search(A, B.impl())) {
+        axpy(trans, alpha, A.left(), B.impl());
+        axpy(trans, -alpha, A.right(), B.impl());
+        return;
+    }
+
+#   ifdef FLENS_DEBUG_CLOSURES
     FLENS_BLASLOG_BEGIN_MAXPY(trans, alpha, A, B);
+    typedef MatrixClosure<OpSub, ML, MR>  MC;
 
 //
-//  Compute the result of closure A = (A.left()+A.right()) first and store
+//  Compute the result of closure A = (A.left()-A.right()) first and store
 //  it in tmp.
 //
     FLENS_BLASLOG_TMP_TRON;
     typename Result<MC>::Type tmp = A;
     FLENS_BLASLOG_TMP_TROFF;
 //
-//  Update y with tmp, i.e. compute B = B + alpha*tmp
+//  Update B with tmp, i.e. compute B = B + alpha*tmp
 //
     axpy(trans, alpha, tmp, B.impl());
 
     FLENS_BLASLOG_TMP_REMOVE(tmp, A);
     FLENS_BLASLOG_END;
+#   else
+    ASSERT(0);
+#   endif
 }
 
-#endif
-
 //------------------------------------------------------------------------------
 //
 //  B += scalar*op(A)
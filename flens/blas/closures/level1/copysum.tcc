@@ -64,6 +64,18 @@ copySum(const VX1 &x1, const ALPHA &alpha, const VX2 &x2, VY &y)
 {
     ASSERT(alpha==ALPHA(1) || alpha==ALPHA(-1));
 //
+//  If only x2 refers to y (e.g. y = A*x + beta*y) we evaluate x2 first and
+//  then add x1.  So no temporary is needed.
+//
+    if (DebugClosure::search(x2, y) && !DebugClosure::search(x1, y)) {
+        blas::copy(x2, y);
+        if (alpha!=ALPHA(1)) {
+            blas::scal(alpha, y);
+        }
+        blas::axpy(ALPHA(1), x1, y);
+        return;
+    }
+//
 //  In debug-closure-mode we check if x2 has to stored in a temporary.
 //  Otherwise an assertion gets triggered if x2 and y are identical of if x2
 //  is a closure that contains y.
@@ -119,6 +131,17 @@ copySum(const VectorClosure<OpMult, VXL1, VXR1> &x1, const ALPHA &alpha,
 {
     ASSERT(alpha==ALPHA(1) || alpha==ALPHA(-1));
 
+//
+//  y = beta1*x1 + beta2*y
+//
+    if (DEBUGCLOSURE::identical(x2.right().impl(), y)
+     && !DebugClosure::search(x1, y))
+    {
+         blas::scal(alpha*x2.left().value(), y);
+         blas::axpy(x1.left().value(), x1.right(), y);
+         return;
+    }
+
     ASSERT(!DebugClosure::search(x2, y));
 
     if (DEBUGCLOSURE::identical(x1.right().impl(), y)) {
@@ -175,6 +198,18 @@ copySum(Transpose trans,
 {
     ASSERT(alpha==ALPHA(1) || alpha==ALPHA(-1));
 //
+//  If only A2 refers to B (e.g. B = A*C + beta*B) we evaluate A2 first and
+//  then add A1.  So no temporary is needed.
+//
+    if (DebugClosure::search(A2, B) && !DebugClosure::search(A1, B)) {
+        blas::copy(trans, A2, B);
+        if (alpha!=ALPHA(1)) {
+            blas::scal(alpha, B);
+        }
+        blas::axpy(trans, ALPHA(1), A1, B);
+        return;
+    }
+//
 //  In debug-closure-mode we check if A2 has to stored in a temporary.
 //  Otherwise an assertion gets triggered if A2 and B are identical of if A2
 //  is a closure that contains B.
@@ -227,7 +262,7 @@ typename RestrictTo<IsScalarValue<MAL1>::value &&
                     void>::Type
 copySum(Transpose trans,
         const MatrixClosure<OpMult, MAL1, MAR1> &A1,
-        const ALPHA &DEBUG_VAR(alpha),
+        const ALPHA &alpha,
         const MatrixClosure<OpMult, MAL2, MAR2> &A2, MB &B)
 {
 
@@ -235,19 +270,30 @@ copySum(Transpose trans,
 
     ASSERT(alpha==ALPHA(1) || alpha==ALPHA(-1));
 
-    ASSERT(!DebugClosure::search(A2, B));
-
     Transpose trans_ = Transpose(trans^PruneConjTrans<MAR2>::trans);
     const MAR2_ &A2_  = PruneConjTrans<MAR2>::remainder(A2.right());
 //
+//  B = beta1*op(A1) + beta2*B
+//
+    if (trans_==NoTrans && DEBUGCLOSURE::identical(A2_, B)
+     && !DebugClosure::search(A1, B))
+    {
+        blas::scal(alpha*A2.left().value(), B);
+        blas::axpy(trans, A1.left().value(), A1.right(), B);
+        return;
+    }
+
+    ASSERT(!DebugClosure::search(A2, B));
+//
 //  B = A1
 //
     if (DEBUGCLOSURE::identical(A1.right().impl(), B)) {
-        blas::axpby(trans_, A2.left().value(), A2_, A1.left().value(), B);
+        blas::axpby(trans_, alpha*A2.left().value(), A2_,
+                    A1.left().value(), B);
     } else {
         blas::copy(trans, A1.right(), B);
         blas::scal(A1.left().value(), B);
-        blas::axpy(trans_, A2.left().value(), A2_, B);
+        blas::axpy(trans_, alpha*A2.left().value(), A2_, B);
     }
 
 }
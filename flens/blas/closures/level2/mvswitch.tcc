@@ -95,10 +95,12 @@ mvSwitch(Transpose trans, const ALPHA &alpha, const MA &A, const VX &x,
 #   ifdef FLENS_DEBUG_CLOSURES
     if (!IsSame<VX, typename Result<VX>::Type>::value) {
         FLENS_BLASLOG_TMP_REMOVE(x_, x);
+        CXXBLAS_PROFILE_TEMPORARY("mvSwitch");
     }
 #   else
     const bool check = IsSame<VX, typename Result<VX>::Type>::value;
     if (!check) {
+        CXXBLAS_PROFILE_TEMPORARY("mvSwitch");
         std::cerr << "ERROR: Temporary required." << std::endl;
     }
     ASSERT(check);
@@ -151,10 +153,12 @@ mvCase(Transpose trans, const ALPHA &alpha,
 #   ifdef FLENS_DEBUG_CLOSURES
     if (!IsSame<MA_, RMA>::value) {
         FLENS_BLASLOG_TMP_REMOVE(A, A_);
+        CXXBLAS_PROFILE_TEMPORARY("mvSwitch");
     }
 #   else
     const bool check = IsSame<MA_, RMA>::value;
     if (!check) {
+        CXXBLAS_PROFILE_TEMPORARY("mvSwitch");
         std::cerr << "ERROR: Temporary required." << std::endl;
     }
     ASSERT(check);
@@ -188,10 +192,12 @@ mvCase(Transpose trans, const ALPHA &alpha, const MatrixClosure<Op, L, R> &A,
 #   ifdef FLENS_DEBUG_CLOSURES
     if (!IsSame<MC, MA>::value) {
         FLENS_BLASLOG_TMP_REMOVE(A_, A);
+        CXXBLAS_PROFILE_TEMPORARY("mvSwitch");
     }
 #   else
     const bool check = IsSame<MC, MA>::value;
     if (!check) {
+        CXXBLAS_PROFILE_TEMPORARY("mvSwitch");
         std::cerr << "ERROR: Temporary required." << std::endl;
     }
     ASSERT(check);
@@ -100,10 +100,12 @@ mmSwitch(Transpose transA, Transpose transB, const ALPHA &alpha,
 #   ifdef FLENS_DEBUG_CLOSURES
     if (!IsSame<RMB, typename Result<RMB>::Type>::value) {
         FLENS_BLASLOG_TMP_REMOVE(B_, PruneConjTrans<MB>::remainder(B));
+        CXXBLAS_PROFILE_TEMPORARY("mmSwitch");
     }
 #   else
     const bool check = IsSame<RMB, typename Result<RMB>::Type>::value;
     if (!check) {
+        CXXBLAS_PROFILE_TEMPORARY("mmSwitch");
         std::cerr << "ERROR: Temporary required." << std::endl;
     }
     ASSERT(check);
@@ -156,10 +158,12 @@ mmCase(Transpose transA, Transpose transB, const ALPHA &alpha,
 #   ifdef FLENS_DEBUG_CLOSURES
     if (!IsSame<RMA, ResultRMA>::value) {
         FLENS_BLASLOG_TMP_REMOVE(A, A_);
+        CXXBLAS_PROFILE_TEMPORARY("mmSwitch");
     }
 #   else
     const bool check = IsSame<RMA, typename Result<RMA>::Type>::value;
     if (!check) {
+        CXXBLAS_PROFILE_TEMPORARY("mmSwitch");
         std::cerr << "ERROR: Temporary required." << std::endl;
     }
     ASSERT(check);
@@ -193,10 +197,12 @@ mmCase(Transpose transA, Transpose transB, const ALPHA &alpha,
 #   ifdef FLENS_DEBUG_CLOSURES
     if (!IsSame<ClosureType, MA>::value) {
         FLENS_BLASLOG_TMP_REMOVE(A_, A);
+        CXXBLAS_PROFILE_TEMPORARY("mmSwitch");
     }
 #   else
     const bool check = IsSame<ClosureType, MA>::value;
     if (!check) {
+        CXXBLAS_PROFILE_TEMPORARY("mmSwitch");
         std::cerr << "ERROR: Temporary required." << std::endl;
     }
     ASSERT(check);
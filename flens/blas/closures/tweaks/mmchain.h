@@ -0,0 +1,241 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FLENS_BLAS_CLOSURES_TWEAKS_MMCHAIN_H
+#define FLENS_BLAS_CLOSURES_TWEAKS_MMCHAIN_H 1
+
+#include <cxxblas/cxxblas.h>
+#include <cxxstd/string.h>
+#include <flens/blas/closures/tweaks/defaulteval.h>
+#include <flens/blas/operators/operators.h>
+#include <flens/matrixtypes/matrixtypes.h>
+#include <flens/scalartypes/scalartypes.h>
+#include <flens/typedefs.h>
+#include <flens/vectortypes/vectortypes.h>
+
+namespace flens { namespace blas {
+
+//
+//  Products of more than two matrices like A*B*C or A*B*x get evaluated in
+//  the cheapest order instead of the order written.  For matrix products the
+//  order is determined at runtime by the classic matrix chain dynamic
+//  program, for products with a vector the product gets evaluated from the
+//  vector outwards, i.e. A*(B*x) and (x*A)*B.
+//
+//  Factors can be general matrices, transposed or conjugated general matrices
+//  and scaled general matrices.  All matrices must have the same element
+//  type.  Other products take the default evaluation.
+//
+
+//
+//  MatrixChain provides the instrumentation hook.  If set the hook gets
+//  called for each evaluated chain with the chosen order, e.g.
+//  "(A1*(A2*A3))", the number of flops for this order and the number of
+//  flops for a left to right evaluation.  Ai denotes the i-th factor after
+//  transpositions got applied, e.g. for transpose(A*B*C) A1 is C^T.
+//
+class MatrixChain
+{
+    public:
+        typedef void (*Hook)(const char *order, double flops,
+                             double flopsLeftToRight);
+
+        static void
+        setHook(Hook hook);
+
+        static Hook
+        hook();
+
+        static void
+        report(const std::string &order, double flops,
+               double flopsLeftToRight);
+
+    private:
+        static Hook &
+        hook_();
+};
+
+//
+//  MatrixChainCheck_<check, X, T>::value is true if check is true and X has
+//  element type T.  X::ElementType only gets accessed if check is true.
+//
+template <bool check, typename X, typename T>
+struct MatrixChainCheck_
+{
+    static const bool value = false;
+};
+
+template <typename X, typename T>
+struct MatrixChainCheck_<true, X, T>
+{
+    static const bool value = IsSame<typename X::ElementType, T>::value;
+};
+
+//
+//  MatrixChainLength<M, T>::value is the number of matrix factors of M if
+//  all of them are general matrices with element type T and zero otherwise.
+//
+template <typename M, typename T>
+struct MatrixChainLength
+{
+    static const int value = MatrixChainCheck_<IsGeMatrix<M>::value,
+                                               M, T>::value ? 1 : 0;
+};
+
+template <typename MA, typename T>
+struct MatrixChainLength<MatrixClosureOpTrans<MA>, T>
+{
+    static const int value = MatrixChainLength<MA, T>::value;
+};
+
+template <typename MA, typename T>
+struct MatrixChainLength<MatrixClosureOpConj<MA>, T>
+{
+    static const int value = MatrixChainLength<MA, T>::value;
+};
+
+template <typename S, typename MA, typename T>
+struct MatrixChainLength<MatrixClosure<OpMult, ScalarValue<S>, MA>, T>
+{
+    static const int value = MatrixChainLength<MA, T>::value;
+};
+
+template <typename ML, typename MR, typename T>
+struct MatrixChainLength<MatrixClosure<OpMult, ML, MR>, T>
+{
+    static const int left  = MatrixChainLength<ML, T>::value;
+    static const int right = MatrixChainLength<MR, T>::value;
+
+    static const int value = (left>0 && right>0) ? left+right : 0;
+};
+
+//
+//  IsMatrixChain: product with at least three matrix factors.
+//
+template <typename ML, typename MR>
+struct IsMatrixChain
+{
+    typedef MatrixClosure<OpMult, ML, MR>    Closure;
+    typedef typename Closure::ElementType    T;
+
+    static const bool value = DefaultEval<Closure>::value
+                           && MatrixChainLength<Closure, T>::value>=3;
+};
+
+//
+//  IsMatrixVectorChain: product of at least two matrices with a dense vector
+//  from the right (VX is the vector) or from the left (ML is the vector).
+//
+template <typename ML, typename VX>
+struct IsMatrixVectorChain
+{
+    typedef VectorClosure<OpMult, ML, VX>    Closure;
+    typedef typename Closure::ElementType    T;
+
+    static const bool value = DefaultEval<Closure>::value
+                           && MatrixChainCheck_<IsDenseVector<VX>::value,
+                                                VX, T>::value
+                           && MatrixChainLength<ML, T>::value>=2;
+};
+
+template <typename VX, typename MR>
+struct IsVectorMatrixChain
+{
+    typedef VectorClosure<OpMult, VX, MR>    Closure;
+    typedef typename Closure::ElementType    T;
+
+    static const bool value = DefaultEval<Closure>::value
+                           && MatrixChainCheck_<IsDenseVector<VX>::value,
+                                                VX, T>::value
+                           && MatrixChainLength<MR, T>::value>=2;
+};
+
+//-- GeneralMatrix -------------------------------------------------------------
+//
+//  C = op(A1*A2*...*An)
+//
+template <typename ML, typename MR, typename MC>
+    typename RestrictTo<IsMatrixChain<ML, MR>::value
+                     && IsGeMatrix<MC>::value,
+             void>::Type
+    copy(Transpose trans, const MatrixClosure<OpMult, ML, MR> &A, MC &C);
+
+//
+//  C += alpha*op(A1*A2*...*An)
+//
+template <typename ALPHA, typename ML, typename MR, typename MC>
+    typename RestrictTo<IsMatrixChain<ML, MR>::value
+                     && IsGeMatrix<MC>::value,
+             void>::Type
+    axpy(Transpose trans, const ALPHA &alpha,
+         const MatrixClosure<OpMult, ML, MR> &A, MC &C);
+
+//-- DenseVector ---------------------------------------------------------------
+//
+//  y = A1*A2*...*An*x
+//
+template <typename ML, typename VX, typename VY>
+    typename RestrictTo<IsMatrixVectorChain<ML, VX>::value
+                     && IsDenseVector<VY>::value,
+             void>::Type
+    copy(const VectorClosure<OpMult, ML, VX> &Ax, VY &y);
+
+//
+//  y = x*A1*A2*...*An
+//
+template <typename VX, typename MR, typename VY>
+    typename RestrictTo<IsVectorMatrixChain<VX, MR>::value
+                     && IsDenseVector<VY>::value,
+             void>::Type
+    copy(const VectorClosure<OpMult, VX, MR> &xA, VY &y);
+
+//
+//  y += alpha*A1*A2*...*An*x
+//
+template <typename ALPHA, typename ML, typename VX, typename VY>
+    typename RestrictTo<IsMatrixVectorChain<ML, VX>::value
+                     && IsDenseVector<VY>::value,
+             void>::Type
+    axpy(const ALPHA &alpha, const VectorClosure<OpMult, ML, VX> &Ax, VY &y);
+
+//
+//  y += alpha*x*A1*A2*...*An
+//
+template <typename ALPHA, typename VX, typename MR, typename VY>
+    typename RestrictTo<IsVectorMatrixChain<VX, MR>::value
+                     && IsDenseVector<VY>::value,
+             void>::Type
+    axpy(const ALPHA &alpha, const VectorClosure<OpMult, VX, MR> &xA, VY &y);
+
+} } // namespace blas, flens
+
+#endif // FLENS_BLAS_CLOSURES_TWEAKS_MMCHAIN_H
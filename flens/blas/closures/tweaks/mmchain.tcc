@@ -0,0 +1,553 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FLENS_BLAS_CLOSURES_TWEAKS_MMCHAIN_TCC
+#define FLENS_BLAS_CLOSURES_TWEAKS_MMCHAIN_TCC 1
+
+#include <cxxstd/algorithm.h>
+#include <cxxstd/sstream.h>
+#include <flens/auxiliary/auxiliary.h>
+#include <flens/blas/closures/closures.h>
+#include <flens/blas/level1/level1.h>
+#include <flens/blas/level2/level2.h>
+#include <flens/blas/level3/level3.h>
+#include <flens/typedefs.h>
+
+#ifdef FLENS_DEBUG_CLOSURES
+#   include <flens/blas/blaslogon.h>
+#else
+#   include <flens/blas/blaslogoff.h>
+#endif
+
+namespace flens { namespace blas {
+
+//-- MatrixChain ---------------------------------------------------------------
+
+inline void
+MatrixChain::setHook(Hook hook)
+{
+    hook_() = hook;
+}
+
+inline MatrixChain::Hook
+MatrixChain::hook()
+{
+    return hook_();
+}
+
+inline void
+MatrixChain::report(const std::string &order, double flops,
+                    double flopsLeftToRight)
+{
+    if (hook_()) {
+        hook_()(order.c_str(), flops, flopsLeftToRight);
+    }
+}
+
+inline MatrixChain::Hook &
+MatrixChain::hook_()
+{
+    static Hook hook = 0;
+    return hook;
+}
+
+//-- Factors of a chain --------------------------------------------------------
+//
+//  A factor is a column major matrix (numRows x numCols) that enters the
+//  product as op(A) with op given by trans.  Row major matrices enter as
+//  transposed column major matrices.
+//
+template <typename T>
+struct MatrixChainFactor_
+{
+    typedef typename GeMatrix<FullStorage<T, ColMajor> >::ConstView  View;
+    typedef typename View::IndexType                                 IndexType;
+
+    const T     *data;
+    IndexType   numRows, numCols, leadingDimension;
+    Transpose   trans;
+
+    IndexType
+    rows() const
+    {
+        return (trans==NoTrans || trans==Conj) ? numRows : numCols;
+    }
+
+    IndexType
+    cols() const
+    {
+        return (trans==NoTrans || trans==Conj) ? numCols : numRows;
+    }
+
+    const View
+    view() const
+    {
+        typedef typename View::Engine  Engine;
+
+        return View(Engine(numRows, numCols, data, leadingDimension));
+    }
+};
+
+template <typename T, typename MA>
+void
+matrixChainFactors_(Transpose trans, const GeMatrix<MA> &A, T &,
+                    MatrixChainFactor_<T> *factor)
+{
+    factor->data             = A.data();
+    factor->leadingDimension = A.leadingDimension();
+    if (A.order()==ColMajor) {
+        factor->numRows = A.numRows();
+        factor->numCols = A.numCols();
+        factor->trans   = trans;
+    } else {
+        factor->numRows = A.numCols();
+        factor->numCols = A.numRows();
+        factor->trans   = Transpose(trans^Trans);
+    }
+}
+
+template <typename T, typename MA>
+void
+matrixChainFactors_(Transpose trans, const MatrixClosureOpTrans<MA> &A,
+                    T &alpha, MatrixChainFactor_<T> *factor)
+{
+    matrixChainFactors_(Transpose(trans^Trans), A.left(), alpha, factor);
+}
+
+template <typename T, typename MA>
+void
+matrixChainFactors_(Transpose trans, const MatrixClosureOpConj<MA> &A,
+                    T &alpha, MatrixChainFactor_<T> *factor)
+{
+    matrixChainFactors_(Transpose(trans^Conj), A.left(), alpha, factor);
+}
+
+template <typename T, typename S, typename MA>
+void
+matrixChainFactors_(Transpose trans,
+                    const MatrixClosure<OpMult, ScalarValue<S>, MA> &A,
+                    T &alpha, MatrixChainFactor_<T> *factor)
+{
+    using cxxblas::conjugate;
+
+    const S &scale = A.left().value();
+
+    alpha *= (trans==Conj || trans==ConjTrans) ? T(conjugate(scale))
+                                               : T(scale);
+    matrixChainFactors_(trans, A.right(), alpha, factor);
+}
+
+//
+//  For op(ML*MR) with a transposition the factors of MR come first.
+//
+template <typename T, typename ML, typename MR>
+void
+matrixChainFactors_(Transpose trans, const MatrixClosure<OpMult, ML, MR> &A,
+                    T &alpha, MatrixChainFactor_<T> *factor)
+{
+    const int numLeft  = MatrixChainLength<ML, T>::value;
+    const int numRight = MatrixChainLength<MR, T>::value;
+
+    if (trans==NoTrans || trans==Conj) {
+        matrixChainFactors_(trans, A.left(), alpha, factor);
+        matrixChainFactors_(trans, A.right(), alpha, factor+numLeft);
+    } else {
+        matrixChainFactors_(trans, A.right(), alpha, factor);
+        matrixChainFactors_(trans, A.left(), alpha, factor+numRight);
+    }
+}
+
+//-- Order of evaluation -------------------------------------------------------
+//
+//  Matrix chain dynamic program.  cost[i*n+j] is the minimal number of
+//  multiplications for factor[i]*...*factor[j], split[i*n+j] the index k
+//  such that this product gets computed as (factor[i]*...*factor[k])*
+//  (factor[k+1]*...*factor[j]).  Returns the number of flops.
+//
+template <typename T>
+double
+matrixChainOrder_(const MatrixChainFactor_<T> *factor, int n,
+                  double *cost, int *split)
+{
+    for (int i=0; i<n; ++i) {
+        cost[i*n+i]  = 0;
+        split[i*n+i] = i;
+    }
+    for (int len=2; len<=n; ++len) {
+        for (int i=0; i+len<=n; ++i) {
+            const int j = i+len-1;
+            const double m = factor[i].rows();
+            const double p = factor[j].cols();
+
+            cost[i*n+j] = -1;
+            for (int k=i; k<j; ++k) {
+                ASSERT(factor[k].cols()==factor[k+1].rows());
+
+                const double c = cost[i*n+k] + cost[(k+1)*n+j]
+                               + m*factor[k].cols()*p;
+                if (cost[i*n+j]<0 || c<cost[i*n+j]) {
+                    cost[i*n+j]  = c;
+                    split[i*n+j] = k;
+                }
+            }
+        }
+    }
+    return 2*cost[n-1];
+}
+
+//
+//  Flops for evaluating the chain from left to right.
+//
+template <typename T>
+double
+matrixChainLeftToRight_(const MatrixChainFactor_<T> *factor, int n)
+{
+    double flops = 0;
+    for (int k=1; k<n; ++k) {
+        flops += 2.*factor[0].rows()*factor[k].rows()*factor[k].cols();
+    }
+    return flops;
+}
+
+template <typename T>
+void
+matrixChainOrder_(const int *split, int n, int i, int j, std::ostream &out)
+{
+    if (i==j) {
+        out << "A" << i+1;
+        return;
+    }
+    const int k = split[i*n+j];
+    out << "(";
+    matrixChainOrder_<T>(split, n, i, k, out);
+    out << "*";
+    matrixChainOrder_<T>(split, n, k+1, j, out);
+    out << ")";
+}
+
+//-- Evaluation ----------------------------------------------------------------
+//
+//  Temporaries draw from the workspace arena.
+//
+template <typename T>
+struct MatrixChainTmp_
+{
+    typedef typename WorkspaceAllocatorFor<std::allocator<T> >::Type  A;
+
+    typedef GeMatrix<FullStorage<T, ColMajor, IndexOptions<>, A> >   Matrix;
+    typedef DenseVector<Array<T, IndexOptions<>, A> >                Vector;
+};
+
+template <typename T, typename MC>
+void
+matrixChainEval_(const MatrixChainFactor_<T> *factor, const int *split,
+                 int n, int i, int j,
+                 const T &alpha, const T &beta, MC &C)
+{
+    typedef typename MatrixChainTmp_<T>::Matrix  Matrix;
+
+    const int k = split[i*n+j];
+
+    MatrixChainFactor_<T>  A = factor[i];
+    MatrixChainFactor_<T>  B = factor[j];
+    Matrix                 AT, BT;
+
+    if (k>i) {
+        matrixChainEval_(factor, split, n, i, k, T(1), T(0), AT);
+        A.data             = AT.data();
+        A.numRows          = AT.numRows();
+        A.numCols          = AT.numCols();
+        A.leadingDimension = AT.leadingDimension();
+        A.trans            = NoTrans;
+    }
+    if (k+1<j) {
+        matrixChainEval_(factor, split, n, k+1, j, T(1), T(0), BT);
+        B.data             = BT.data();
+        B.numRows          = BT.numRows();
+        B.numCols          = BT.numCols();
+        B.leadingDimension = BT.leadingDimension();
+        B.trans            = NoTrans;
+    }
+    mm(A.trans, B.trans, alpha, A.view(), B.view(), beta, C);
+}
+
+//
+//  y = beta*y + alpha*op(factor[0])*...*op(factor[n-1])*x evaluated from the
+//  right.
+//
+template <typename T, typename VX, typename VY>
+void
+matrixChainMv_(const MatrixChainFactor_<T> *factor, int n,
+               const T &alpha, const VX &x, const T &beta, VY &y)
+{
+    typedef typename MatrixChainTmp_<T>::Vector  Vector;
+
+    if (n==1) {
+        mv(factor[0].trans, alpha, factor[0].view(), x, beta, y);
+        return;
+    }
+    Vector t;
+    matrixChainMv_(factor+1, n-1, T(1), x, T(0), t);
+    mv(factor[0].trans, alpha, factor[0].view(), t, beta, y);
+}
+
+//
+//  C = beta*C + alpha*op(A1*A2*...*An)
+//
+template <typename ALPHA, typename ML, typename MR, typename BETA, typename MC>
+void
+matrixChain_(Transpose trans, const ALPHA &alpha,
+             const MatrixClosure<OpMult, ML, MR> &A, const BETA &beta, MC &C)
+{
+    typedef MatrixClosure<OpMult, ML, MR>          Closure;
+    typedef typename Closure::ElementType          T;
+    typedef typename MatrixChainTmp_<T>::Matrix    Matrix;
+
+    const int n = MatrixChainLength<Closure, T>::value;
+
+    MatrixChainFactor_<T>  factor[n];
+    double                 cost[n*n];
+    int                    split[n*n];
+    T                      scale = alpha;
+
+    matrixChainFactors_(trans, A, scale, factor);
+
+    const double flops = matrixChainOrder_(factor, n, cost, split);
+
+    if (MatrixChain::hook()) {
+        std::ostringstream  order;
+
+        matrixChainOrder_<T>(split, n, 0, n-1, order);
+        MatrixChain::report(order.str(), flops,
+                            matrixChainLeftToRight_(factor, n));
+    }
+//
+//  If C is one of the factors the result goes to a temporary first.
+//
+    if (!DebugClosure::search(A, C)) {
+        matrixChainEval_(factor, split, n, 0, n-1, scale, T(beta), C);
+    } else {
+        Matrix  CT;
+        FLENS_BLASLOG_TMP_ADD(CT);
+
+        matrixChainEval_(factor, split, n, 0, n-1, scale, T(0), CT);
+        if (beta==BETA(0)) {
+            copy(NoTrans, CT, C);
+        } else {
+            if (beta!=BETA(1)) {
+                scal(beta, C);
+            }
+            axpy(NoTrans, T(1), CT, C);
+        }
+
+        FLENS_BLASLOG_TMP_REMOVE(CT, C);
+    }
+}
+
+//
+//  y = beta*y + alpha*A1*A2*...*An*x  (transX==NoTrans) or
+//  y = beta*y + alpha*x*A1*A2*...*An  (transX==Trans).
+//
+template <typename ALPHA, typename M, typename VX, typename BETA, typename VY>
+void
+matrixVectorChain_(Transpose transX, const ALPHA &alpha, const M &A,
+                   const VX &x, const BETA &beta, VY &y)
+{
+    typedef typename VY::ElementType  T;
+
+    const int n = MatrixChainLength<M, T>::value;
+
+    MatrixChainFactor_<T>  factor[n];
+    T                      scale = alpha;
+
+    matrixChainFactors_(NoTrans, A, scale, factor);
+
+    if (MatrixChain::hook()) {
+        std::ostringstream  order;
+
+        double flops = 0;
+        for (int k=0; k<n; ++k) {
+            flops += 2.*factor[k].rows()*factor[k].cols();
+        }
+        double flopsLeftToRight = matrixChainLeftToRight_(factor, n)
+                                + 2.*factor[0].rows()*factor[n-1].cols();
+        if (transX==NoTrans) {
+            for (int k=0; k<n; ++k) {
+                order << "(A" << k+1 << "*";
+            }
+            order << "x";
+            for (int k=0; k<n; ++k) {
+                order << ")";
+            }
+        } else {
+            for (int k=0; k<n; ++k) {
+                order << "(";
+            }
+            order << "x";
+            for (int k=0; k<n; ++k) {
+                order << "*A" << k+1 << ")";
+            }
+        }
+        MatrixChain::report(order.str(), flops, flopsLeftToRight);
+    }
+//
+//  x*A1*...*An = transpose(An)*...*transpose(A1)*x
+//
+    if (transX!=NoTrans) {
+        std::reverse(factor, factor+n);
+        for (int k=0; k<n; ++k) {
+            factor[k].trans = Transpose(factor[k].trans^Trans);
+        }
+    }
+    matrixChainMv_(factor, n, scale, x, T(beta), y);
+}
+
+//-- GeneralMatrix -------------------------------------------------------------
+//
+//  C = op(A1*A2*...*An)
+//
+template <typename ML, typename MR, typename MC>
+typename RestrictTo<IsMatrixChain<ML, MR>::value
+                 && IsGeMatrix<MC>::value,
+         void>::Type
+copy(Transpose trans, const MatrixClosure<OpMult, ML, MR> &A, MC &C)
+{
+    FLENS_BLASLOG_BEGIN_MCOPY(trans, A, C);
+
+    typedef typename MC::ElementType  TC;
+
+    matrixChain_(trans, TC(1), A, TC(0), C);
+
+    FLENS_BLASLOG_END;
+}
+
+//
+//  C += alpha*op(A1*A2*...*An)
+//
+template <typename ALPHA, typename ML, typename MR, typename MC>
+typename RestrictTo<IsMatrixChain<ML, MR>::value
+                 && IsGeMatrix<MC>::value,
+         void>::Type
+axpy(Transpose trans, const ALPHA &alpha,
+     const MatrixClosure<OpMult, ML, MR> &A, MC &C)
+{
+    FLENS_BLASLOG_BEGIN_MAXPY(trans, alpha, A, C);
+
+    typedef typename MC::ElementType  TC;
+
+    if (C.numRows()==0 || C.numCols()==0) {
+        matrixChain_(trans, alpha, A, TC(0), C);
+    } else {
+        matrixChain_(trans, alpha, A, TC(1), C);
+    }
+
+    FLENS_BLASLOG_END;
+}
+
+//-- DenseVector ---------------------------------------------------------------
+//
+//  y = A1*A2*...*An*x
+//
+template <typename ML, typename VX, typename VY>
+typename RestrictTo<IsMatrixVectorChain<ML, VX>::value
+                 && IsDenseVector<VY>::value,
+         void>::Type
+copy(const VectorClosure<OpMult, ML, VX> &Ax, VY &y)
+{
+    FLENS_BLASLOG_BEGIN_COPY(Ax, y);
+
+    typedef typename VY::ElementType  TY;
+
+    matrixVectorChain_(NoTrans, TY(1), Ax.left(), Ax.right(), TY(0), y);
+
+    FLENS_BLASLOG_END;
+}
+
+//
+//  y = x*A1*A2*...*An
+//
+template <typename VX, typename MR, typename VY>
+typename RestrictTo<IsVectorMatrixChain<VX, MR>::value
+                 && IsDenseVector<VY>::value,
+         void>::Type
+copy(const VectorClosure<OpMult, VX, MR> &xA, VY &y)
+{
+    FLENS_BLASLOG_BEGIN_COPY(xA, y);
+
+    typedef typename VY::ElementType  TY;
+
+    matrixVectorChain_(Trans, TY(1), xA.right(), xA.left(), TY(0), y);
+
+    FLENS_BLASLOG_END;
+}
+
+//
+//  y += alpha*A1*A2*...*An*x
+//
+template <typename ALPHA, typename ML, typename VX, typename VY>
+typename RestrictTo<IsMatrixVectorChain<ML, VX>::value
+                 && IsDenseVector<VY>::value,
+         void>::Type
+axpy(const ALPHA &alpha, const VectorClosure<OpMult, ML, VX> &Ax, VY &y)
+{
+    FLENS_BLASLOG_BEGIN_AXPY(alpha, Ax, y);
+
+    typedef typename VY::ElementType  TY;
+
+    const TY beta = (y.length()==0) ? TY(0) : TY(1);
+    matrixVectorChain_(NoTrans, alpha, Ax.left(), Ax.right(), beta, y);
+
+    FLENS_BLASLOG_END;
+}
+
+//
+//  y += alpha*x*A1*A2*...*An
+//
+template <typename ALPHA, typename VX, typename MR, typename VY>
+typename RestrictTo<IsVectorMatrixChain<VX, MR>::value
+                 && IsDenseVector<VY>::value,
+         void>::Type
+axpy(const ALPHA &alpha, const VectorClosure<OpMult, VX, MR> &xA, VY &y)
+{
+    FLENS_BLASLOG_BEGIN_AXPY(alpha, xA, y);
+
+    typedef typename VY::ElementType  TY;
+
+    const TY beta = (y.length()==0) ? TY(0) : TY(1);
+    matrixVectorChain_(Trans, alpha, xA.right(), xA.left(), beta, y);
+
+    FLENS_BLASLOG_END;
+}
+
+} } // namespace blas, flens
+
+#endif // FLENS_BLAS_CLOSURES_TWEAKS_MMCHAIN_TCC
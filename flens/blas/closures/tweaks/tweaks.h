@@ -36,6 +36,7 @@
 #include <flens/blas/closures/tweaks/defaulteval.h>
 
 #include <flens/blas/closures/tweaks/mm.h>
+#include <flens/blas/closures/tweaks/mmchain.h>
 #include <flens/blas/closures/tweaks/mv.h>
 #include <flens/blas/closures/tweaks/r.h>
 #include <flens/blas/closures/tweaks/r2.h>
@@ -35,6 +35,7 @@
 
 
 #include <flens/blas/closures/tweaks/mm.tcc>
+#include <flens/blas/closures/tweaks/mmchain.tcc>
 #include <flens/blas/closures/tweaks/mv.tcc>
 #include <flens/blas/closures/tweaks/r.tcc>
 #include <flens/blas/closures/tweaks/r2.tcc>
@@ -180,6 +180,20 @@ template <typename MA, typename MB>
              void>::Type
     copy(Transpose trans, const MA &A, MB &&B);
 
+//-- copy: GeCRSMatrix -> GeBSRMatrix
+template <typename MA, typename MB>
+    typename RestrictTo<IsGeCRSMatrix<MA>::value
+                     && IsGeBSRMatrix<MB>::value,
+             void>::Type
+    copy(Transpose trans, const MA &A, MB &&B);
+
+//-- copy: GeCRSMatrix -> GeSELLMatrix
+template <typename MA, typename MB>
+    typename RestrictTo<IsGeCRSMatrix<MA>::value
+                     && IsGeSELLMatrix<MB>::value,
+             void>::Type
+    copy(Transpose trans, const MA &A, MB &&B);
+
 //== HermitianMatrix
 
 //-- copy: HeCoordMatrix -> HeCCSMatrix
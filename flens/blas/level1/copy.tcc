@@ -773,6 +773,28 @@ copy(Transpose DEBUG_VAR(trans), const MA &A, MB &&B)
     B.engine() = A.engine();
 }
 
+//-- copy: GeCRSMatrix -> GeBSRMatrix
+template <typename MA, typename MB>
+typename RestrictTo<IsGeCRSMatrix<MA>::value
+                 && IsGeBSRMatrix<MB>::value,
+         void>::Type
+copy(Transpose DEBUG_VAR(trans), const MA &A, MB &&B)
+{
+    ASSERT(trans==NoTrans);
+    B.engine() = A.engine();
+}
+
+//-- copy: GeCRSMatrix -> GeSELLMatrix
+template <typename MA, typename MB>
+typename RestrictTo<IsGeCRSMatrix<MA>::value
+                 && IsGeSELLMatrix<MB>::value,
+         void>::Type
+copy(Transpose DEBUG_VAR(trans), const MA &A, MB &&B)
+{
+    ASSERT(trans==NoTrans);
+    B.engine() = A.engine();
+}
+
 //== HermitianMatrix
 
 //-- copy: HeCoordMatrix -> HeCCSMatrix
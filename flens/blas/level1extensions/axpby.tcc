@@ -59,7 +59,7 @@ axpby(const ALPHA &alpha, const VX &x, const BETA &beta, VY &&y)
     FLENS_BLASLOG_SETTAG("--> ");
     FLENS_BLASLOG_BEGIN_AXPBY(alpha, x, beta, y);
 
-    if (y.length()==0) {
+    if (y.length()==0 && x.length()!=0) {
 //
 //      So we allow  y = beta*y + alpha*x  for an empty vector y
 //
@@ -281,6 +281,114 @@ mv(Transpose trans, const ALPHA &alpha, const MA &A, const VX &x,
 #   endif
 }
 
+//-- gebsrmv
+template <typename ALPHA, typename MA, typename VX, typename BETA, typename VY>
+typename RestrictTo<IsGeBSRMatrix<MA>::value
+                 && IsDenseVector<VX>::value
+                 && IsDenseVector<VY>::value,
+         void>::Type
+mv(Transpose trans, const ALPHA &alpha, const MA &A, const VX &x,
+   const BETA &beta, VY &&y)
+{
+    const bool noTrans = (trans==NoTrans || trans==Conj);
+
+#   ifndef NDEBUG
+    if (noTrans) {
+        ASSERT(x.length()==A.numCols());
+    } else {
+        ASSERT(x.length()==A.numRows());
+    }
+#   endif
+
+    typedef typename RemoveRef<MA>::Type  MatrixA;
+    typedef typename MatrixA::IndexType   IndexType;
+    IndexType yLength = noTrans ? A.numRows()
+                                : A.numCols();
+
+    ASSERT(!DEBUGCLOSURE::identical(x, y));
+    ASSERT(beta==BETA(0) || y.length()==yLength || y.length()==0);
+
+    if (y.length()!=yLength) {
+        ASSERT(beta==BETA(0));
+        y.reserve(yLength, y.firstIndex());
+    }
+
+//  Sparse BLAS only supports this case:
+    ASSERT(x.stride()==1);
+    ASSERT(y.stride()==1);
+
+#   ifdef HAVE_CXXBLAS_GEBSRMV
+    const int BS = MatrixA::Engine::blockSize;
+
+    cxxblas::gebsrmv<BS>(trans,
+                         A.numRows(), A.numCols(),
+                         alpha,
+                         A.engine().values().data(),
+                         A.engine().rows().data(),
+                         A.engine().cols().data(),
+                         x.data(),
+                         beta,
+                         y.data());
+#   else
+    ASSERT(0);
+#   endif
+}
+
+//-- gesellmv
+template <typename ALPHA, typename MA, typename VX, typename BETA, typename VY>
+typename RestrictTo<IsGeSELLMatrix<MA>::value
+                 && IsDenseVector<VX>::value
+                 && IsDenseVector<VY>::value,
+         void>::Type
+mv(Transpose trans, const ALPHA &alpha, const MA &A, const VX &x,
+   const BETA &beta, VY &&y)
+{
+    const bool noTrans = (trans==NoTrans || trans==Conj);
+
+#   ifndef NDEBUG
+    if (noTrans) {
+        ASSERT(x.length()==A.numCols());
+    } else {
+        ASSERT(x.length()==A.numRows());
+    }
+#   endif
+
+    typedef typename RemoveRef<MA>::Type  MatrixA;
+    typedef typename MatrixA::IndexType   IndexType;
+    IndexType yLength = noTrans ? A.numRows()
+                                : A.numCols();
+
+    ASSERT(!DEBUGCLOSURE::identical(x, y));
+    ASSERT(beta==BETA(0) || y.length()==yLength || y.length()==0);
+
+    if (y.length()!=yLength) {
+        ASSERT(beta==BETA(0));
+        y.reserve(yLength, y.firstIndex());
+    }
+
+//  Sparse BLAS only supports this case:
+    ASSERT(x.stride()==1);
+    ASSERT(y.stride()==1);
+
+#   ifdef HAVE_CXXBLAS_GESELLMV
+    const int CS = MatrixA::Engine::chunkSize;
+
+    cxxblas::gesellmv<CS>(trans,
+                          A.numRows(), A.numCols(),
+                          alpha,
+                          A.engine().values().data(),
+                          A.engine().chunkPtr().data(),
+                          A.engine().chunkLength().data(),
+                          A.engine().cols().data(),
+                          A.engine().perm().data(),
+                          x.data(),
+                          beta,
+                          y.data());
+#   else
+    ASSERT(0);
+#   endif
+}
+
 //-- gemv
 template <typename ALPHA, typename MA, typename VX, typename BETA, typename VY>
 typename RestrictTo<IsGeMatrix<MA>::value
@@ -380,6 +380,238 @@ mm(Transpose        transposeA,
     FLENS_BLASLOG_UNSETTAG;
 }
 
+//-- geccsmm
+template <typename ALPHA, typename MA, typename MB, typename BETA, typename MC>
+typename RestrictTo<IsGeCCSMatrix<MA>::value
+                 && IsGeMatrix<MB>::value
+                 && IsGeMatrix<MC>::value,
+         void>::Type
+mm(Transpose        transA,
+   Transpose        transB,
+   const ALPHA      &alpha,
+   const MA         &A,
+   const MB         &B,
+   const BETA       &beta,
+   MC               &&C)
+{
+    typedef typename RemoveRef<MC>::Type MatrixC;
+    typedef typename MatrixC::IndexType  IndexType;
+
+    const bool noTransA = (transA==NoTrans || transA==Conj);
+
+    IndexType m = (noTransA) ? A.numRows() : A.numCols();
+    IndexType n = B.numCols();
+
+#   ifndef NDEBUG
+    IndexType k = (noTransA) ? A.numCols() : A.numRows();
+    ASSERT(B.numRows()==k);
+#   endif
+
+//  Sparse BLAS only supports this case:
+    ASSERT(transB==NoTrans);
+    ASSERT(B.order()==ColMajor);
+    ASSERT(C.order()==ColMajor);
+
+    ASSERT(!DEBUGCLOSURE::identical(B, C));
+    ASSERT(beta==BETA(0) || (C.numRows()==m && C.numCols()==n));
+
+    if ((C.numRows()!=m) || (C.numCols()!=n)) {
+        ASSERT(C.numRows()==0 && C.numCols()==0);
+        ASSERT(beta==BETA(0));
+        C.reserve(m, n);
+    }
+
+#   ifdef HAVE_CXXBLAS_GECRSMM
+    cxxblas::gecrsmm(Transpose(transA^Trans),
+                     A.numCols(), n, A.numRows(),
+                     alpha,
+                     A.engine().values().data(),
+                     A.engine().cols().data(),
+                     A.engine().rows().data(),
+                     B.data(), B.leadingDimension(),
+                     beta,
+                     C.data(), C.leadingDimension());
+#   else
+    ASSERT(0);
+#   endif
+}
+
+//-- gecrsmm
+template <typename ALPHA, typename MA, typename MB, typename BETA, typename MC>
+typename RestrictTo<IsGeCRSMatrix<MA>::value
+                 && IsGeMatrix<MB>::value
+                 && IsGeMatrix<MC>::value,
+         void>::Type
+mm(Transpose        transA,
+   Transpose        transB,
+   const ALPHA      &alpha,
+   const MA         &A,
+   const MB         &B,
+   const BETA       &beta,
+   MC               &&C)
+{
+    typedef typename RemoveRef<MC>::Type MatrixC;
+    typedef typename MatrixC::IndexType  IndexType;
+
+    const bool noTransA = (transA==NoTrans || transA==Conj);
+
+    IndexType m = (noTransA) ? A.numRows() : A.numCols();
+    IndexType n = B.numCols();
+
+#   ifndef NDEBUG
+    IndexType k = (noTransA) ? A.numCols() : A.numRows();
+    ASSERT(B.numRows()==k);
+#   endif
+
+//  Sparse BLAS only supports this case:
+    ASSERT(transB==NoTrans);
+    ASSERT(B.order()==ColMajor);
+    ASSERT(C.order()==ColMajor);
+
+    ASSERT(!DEBUGCLOSURE::identical(B, C));
+    ASSERT(beta==BETA(0) || (C.numRows()==m && C.numCols()==n));
+
+    if ((C.numRows()!=m) || (C.numCols()!=n)) {
+        ASSERT(C.numRows()==0 && C.numCols()==0);
+        ASSERT(beta==BETA(0));
+        C.reserve(m, n);
+    }
+
+#   ifdef HAVE_CXXBLAS_GECRSMM
+    cxxblas::gecrsmm(transA,
+                     A.numRows(), n, A.numCols(),
+                     alpha,
+                     A.engine().values().data(),
+                     A.engine().rows().data(),
+                     A.engine().cols().data(),
+                     B.data(), B.leadingDimension(),
+                     beta,
+                     C.data(), C.leadingDimension());
+#   else
+    ASSERT(0);
+#   endif
+}
+
+//-- gebsrmm
+template <typename ALPHA, typename MA, typename MB, typename BETA, typename MC>
+typename RestrictTo<IsGeBSRMatrix<MA>::value
+                 && IsGeMatrix<MB>::value
+                 && IsGeMatrix<MC>::value,
+         void>::Type
+mm(Transpose        transA,
+   Transpose        transB,
+   const ALPHA      &alpha,
+   const MA         &A,
+   const MB         &B,
+   const BETA       &beta,
+   MC               &&C)
+{
+    typedef typename RemoveRef<MA>::Type MatrixA;
+    typedef typename RemoveRef<MC>::Type MatrixC;
+    typedef typename MatrixC::IndexType  IndexType;
+
+    const bool noTransA = (transA==NoTrans || transA==Conj);
+
+    IndexType m = (noTransA) ? A.numRows() : A.numCols();
+    IndexType n = B.numCols();
+
+#   ifndef NDEBUG
+    IndexType k = (noTransA) ? A.numCols() : A.numRows();
+    ASSERT(B.numRows()==k);
+#   endif
+
+//  Sparse BLAS only supports this case:
+    ASSERT(transB==NoTrans);
+    ASSERT(B.order()==ColMajor);
+    ASSERT(C.order()==ColMajor);
+
+    ASSERT(!DEBUGCLOSURE::identical(B, C));
+    ASSERT(beta==BETA(0) || (C.numRows()==m && C.numCols()==n));
+
+    if ((C.numRows()!=m) || (C.numCols()!=n)) {
+        ASSERT(C.numRows()==0 && C.numCols()==0);
+        ASSERT(beta==BETA(0));
+        C.reserve(m, n);
+    }
+
+#   ifdef HAVE_CXXBLAS_GEBSRMM
+    const int BS = MatrixA::Engine::blockSize;
+
+    cxxblas::gebsrmm<BS>(transA,
+                         A.numRows(), n, A.numCols(),
+                         alpha,
+                         A.engine().values().data(),
+                         A.engine().rows().data(),
+                         A.engine().cols().data(),
+                         B.data(), B.leadingDimension(),
+                         beta,
+                         C.data(), C.leadingDimension());
+#   else
+    ASSERT(0);
+#   endif
+}
+
+//-- gesellmm
+template <typename ALPHA, typename MA, typename MB, typename BETA, typename MC>
+typename RestrictTo<IsGeSELLMatrix<MA>::value
+                 && IsGeMatrix<MB>::value
+                 && IsGeMatrix<MC>::value,
+         void>::Type
+mm(Transpose        transA,
+   Transpose        transB,
+   const ALPHA      &alpha,
+   const MA         &A,
+   const MB         &B,
+   const BETA       &beta,
+   MC               &&C)
+{
+    typedef typename RemoveRef<MA>::Type MatrixA;
+    typedef typename RemoveRef<MC>::Type MatrixC;
+    typedef typename MatrixC::IndexType  IndexType;
+
+    const bool noTransA = (transA==NoTrans || transA==Conj);
+
+    IndexType m = (noTransA) ? A.numRows() : A.numCols();
+    IndexType n = B.numCols();
+
+#   ifndef NDEBUG
+    IndexType k = (noTransA) ? A.numCols() : A.numRows();
+    ASSERT(B.numRows()==k);
+#   endif
+
+//  Sparse BLAS only supports this case:
+    ASSERT(transB==NoTrans);
+    ASSERT(B.order()==ColMajor);
+    ASSERT(C.order()==ColMajor);
+
+    ASSERT(!DEBUGCLOSURE::identical(B, C));
+    ASSERT(beta==BETA(0) || (C.numRows()==m && C.numCols()==n));
+
+    if ((C.numRows()!=m) || (C.numCols()!=n)) {
+        ASSERT(C.numRows()==0 && C.numCols()==0);
+        ASSERT(beta==BETA(0));
+        C.reserve(m, n);
+    }
+
+#   ifdef HAVE_CXXBLAS_GESELLMM
+    const int CS = MatrixA::Engine::chunkSize;
+
+    cxxblas::gesellmm<CS>(transA,
+                          A.numRows(), n, A.numCols(),
+                          alpha,
+                          A.engine().values().data(),
+                          A.engine().chunkPtr().data(),
+                          A.engine().chunkLength().data(),
+                          A.engine().cols().data(),
+                          A.engine().perm().data(),
+                          B.data(), B.leadingDimension(),
+                          beta,
+                          C.data(), C.leadingDimension());
+#   else
+    ASSERT(0);
+#   endif
+}
+
 //-- gemm
 template <typename ALPHA, typename MA, typename MB, typename BETA, typename MC>
 typename RestrictTo<IsGeMatrix<MA>::value
@@ -605,6 +837,104 @@ mm(Side             side,
 #   endif
 }
 
+//-- heccsmm
+template <typename ALPHA, typename MA, typename MB, typename BETA, typename MC>
+typename RestrictTo<IsHeCCSMatrix<MA>::value
+                 && IsGeMatrix<MB>::value
+                 && IsGeMatrix<MC>::value,
+         void>::Type
+mm(Side             side,
+   const ALPHA      &alpha,
+   const MA         &A,
+   const MB         &B,
+   const BETA       &beta,
+   MC               &&C)
+{
+    typedef typename RemoveRef<MC>::Type MatrixC;
+    typedef typename MatrixC::IndexType  IndexType;
+
+//  Sparse BLAS only supports this case:
+    ASSERT(side==Left);
+    ASSERT(B.order()==ColMajor);
+    ASSERT(C.order()==ColMajor);
+    ASSERT(A.dim()==B.numRows());
+
+    IndexType m = A.dim();
+    IndexType n = B.numCols();
+
+    ASSERT(!DEBUGCLOSURE::identical(B, C));
+    ASSERT(beta==BETA(0) || (C.numRows()==m && C.numCols()==n));
+
+    if ((C.numRows()!=m) || (C.numCols()!=n)) {
+        ASSERT(C.numRows()==0 && C.numCols()==0);
+        ASSERT(beta==BETA(0));
+        C.reserve(m, n);
+    }
+
+#   ifdef HAVE_CXXBLAS_HECCSMM
+    cxxblas::heccsmm(A.upLo(),
+                     m, n,
+                     alpha,
+                     A.engine().values().data(),
+                     A.engine().rows().data(),
+                     A.engine().cols().data(),
+                     B.data(), B.leadingDimension(),
+                     beta,
+                     C.data(), C.leadingDimension());
+#   else
+    ASSERT(0);
+#   endif
+}
+
+//-- hecrsmm
+template <typename ALPHA, typename MA, typename MB, typename BETA, typename MC>
+typename RestrictTo<IsHeCRSMatrix<MA>::value
+                 && IsGeMatrix<MB>::value
+                 && IsGeMatrix<MC>::value,
+         void>::Type
+mm(Side             side,
+   const ALPHA      &alpha,
+   const MA         &A,
+   const MB         &B,
+   const BETA       &beta,
+   MC               &&C)
+{
+    typedef typename RemoveRef<MC>::Type MatrixC;
+    typedef typename MatrixC::IndexType  IndexType;
+
+//  Sparse BLAS only supports this case:
+    ASSERT(side==Left);
+    ASSERT(B.order()==ColMajor);
+    ASSERT(C.order()==ColMajor);
+    ASSERT(A.dim()==B.numRows());
+
+    IndexType m = A.dim();
+    IndexType n = B.numCols();
+
+    ASSERT(!DEBUGCLOSURE::identical(B, C));
+    ASSERT(beta==BETA(0) || (C.numRows()==m && C.numCols()==n));
+
+    if ((C.numRows()!=m) || (C.numCols()!=n)) {
+        ASSERT(C.numRows()==0 && C.numCols()==0);
+        ASSERT(beta==BETA(0));
+        C.reserve(m, n);
+    }
+
+#   ifdef HAVE_CXXBLAS_HECRSMM
+    cxxblas::hecrsmm(A.upLo(),
+                     m, n,
+                     alpha,
+                     A.engine().values().data(),
+                     A.engine().rows().data(),
+                     A.engine().cols().data(),
+                     B.data(), B.leadingDimension(),
+                     beta,
+                     C.data(), C.leadingDimension());
+#   else
+    ASSERT(0);
+#   endif
+}
+
 //== SymmetricMatrix - GeneralMatrix products ==================================
 
 //-- sbmm
@@ -762,6 +1092,104 @@ mm(Side             side,
 }
 
 
+//-- syccsmm
+template <typename ALPHA, typename MA, typename MB, typename BETA, typename MC>
+typename RestrictTo<IsSyCCSMatrix<MA>::value
+                 && IsGeMatrix<MB>::value
+                 && IsGeMatrix<MC>::value,
+         void>::Type
+mm(Side             side,
+   const ALPHA      &alpha,
+   const MA         &A,
+   const MB         &B,
+   const BETA       &beta,
+   MC               &&C)
+{
+    typedef typename RemoveRef<MC>::Type MatrixC;
+    typedef typename MatrixC::IndexType  IndexType;
+
+//  Sparse BLAS only supports this case:
+    ASSERT(side==Left);
+    ASSERT(B.order()==ColMajor);
+    ASSERT(C.order()==ColMajor);
+    ASSERT(A.dim()==B.numRows());
+
+    IndexType m = A.dim();
+    IndexType n = B.numCols();
+
+    ASSERT(!DEBUGCLOSURE::identical(B, C));
+    ASSERT(beta==BETA(0) || (C.numRows()==m && C.numCols()==n));
+
+    if ((C.numRows()!=m) || (C.numCols()!=n)) {
+        ASSERT(C.numRows()==0 && C.numCols()==0);
+        ASSERT(beta==BETA(0));
+        C.reserve(m, n);
+    }
+
+#   ifdef HAVE_CXXBLAS_SYCCSMM
+    cxxblas::syccsmm(A.upLo(),
+                     m, n,
+                     alpha,
+                     A.engine().values().data(),
+                     A.engine().rows().data(),
+                     A.engine().cols().data(),
+                     B.data(), B.leadingDimension(),
+                     beta,
+                     C.data(), C.leadingDimension());
+#   else
+    ASSERT(0);
+#   endif
+}
+
+//-- sycrsmm
+template <typename ALPHA, typename MA, typename MB, typename BETA, typename MC>
+typename RestrictTo<IsSyCRSMatrix<MA>::value
+                 && IsGeMatrix<MB>::value
+                 && IsGeMatrix<MC>::value,
+         void>::Type
+mm(Side             side,
+   const ALPHA      &alpha,
+   const MA         &A,
+   const MB         &B,
+   const BETA       &beta,
+   MC               &&C)
+{
+    typedef typename RemoveRef<MC>::Type MatrixC;
+    typedef typename MatrixC::IndexType  IndexType;
+
+//  Sparse BLAS only supports this case:
+    ASSERT(side==Left);
+    ASSERT(B.order()==ColMajor);
+    ASSERT(C.order()==ColMajor);
+    ASSERT(A.dim()==B.numRows());
+
+    IndexType m = A.dim();
+    IndexType n = B.numCols();
+
+    ASSERT(!DEBUGCLOSURE::identical(B, C));
+    ASSERT(beta==BETA(0) || (C.numRows()==m && C.numCols()==n));
+
+    if ((C.numRows()!=m) || (C.numCols()!=n)) {
+        ASSERT(C.numRows()==0 && C.numCols()==0);
+        ASSERT(beta==BETA(0));
+        C.reserve(m, n);
+    }
+
+#   ifdef HAVE_CXXBLAS_SYCRSMM
+    cxxblas::sycrsmm(A.upLo(),
+                     m, n,
+                     alpha,
+                     A.engine().values().data(),
+                     A.engine().rows().data(),
+                     A.engine().cols().data(),
+                     B.data(), B.leadingDimension(),
+                     beta,
+                     C.data(), C.leadingDimension());
+#   else
+    ASSERT(0);
+#   endif
+}
+
 //== TriangularMatrix - GeneralMatrix products =================================
 
 //-- tbmm
@@ -0,0 +1,122 @@
+#include <chrono>
+#include <cxxstd/iostream.h>
+#include <cxxstd/vector.h>
+#include <flens/flens.cxx>
+
+using namespace std;
+using namespace cxxblas;
+
+typedef double   T;
+
+///
+///  Measures the crossover points between the generic cxxblas kernels and
+///  the external BLAS and writes them to a config file that can be used
+///  through CXXBLAS_DISPATCH_CONFIG.  Compile with the BLAS you are going to
+///  use, e.g. -DWITH_OPENBLAS ... -lopenblas
+///
+template <typename Func>
+double
+seconds(Func f)
+{
+    typedef std::chrono::high_resolution_clock  Clock;
+
+    long runs = 0;
+    Clock::time_point start = Clock::now();
+    double elapsed;
+    do {
+        f();
+        ++runs;
+        elapsed = std::chrono::duration<double>(Clock::now()-start).count();
+    } while (elapsed<0.02);
+    return elapsed/runs;
+}
+
+///
+///  Returns the smallest size from sizes for which the external BLAS is
+///  faster for this and all larger sizes.
+///
+template <typename Func>
+long
+crossover(DispatchRoutine routine, const vector<long> &sizes,
+          const vector<long> &problemSizes, Func run)
+{
+    long result = -1;
+    for (int i=int(sizes.size())-1; i>=0; --i) {
+        BlasDispatch::setThreshold(routine, -1);
+        double generic = seconds([&]{ run(sizes[i]); });
+        BlasDispatch::setThreshold(routine, 0);
+        double external = seconds([&]{ run(sizes[i]); });
+
+        cout << "  " << BlasDispatch::name(routine) << " n = " << sizes[i]
+             << ": generic " << generic << "s, external " << external << "s"
+             << endl;
+        if (external>generic) {
+            break;
+        }
+        result = problemSizes[i];
+    }
+    return result;
+}
+
+int
+main(int argc, char **argv)
+{
+    const char *filename = (argc>1) ? argv[1] : "cxxblas-dispatch.cfg";
+
+#   ifndef HAVE_CBLAS
+    cout << "No external BLAS available, nothing to calibrate." << endl;
+    return 0;
+#   endif
+
+    const long maxN = 1 << 14;
+    vector<T> x(maxN, T(1)), y(maxN, T(2));
+    vector<T> A(256*256, T(1)), B(256*256, T(2)), C(256*256, T(0));
+
+    ///
+    ///  Level 1: vector lengths
+    ///
+    vector<long> n1;
+    for (long n=8; n<=maxN; n*=2) {
+        n1.push_back(n);
+    }
+    long axpyThreshold = crossover(DispatchAxpy, n1, n1, [&](long n) {
+        axpy(int(n), T(1.5), x.data(), 1, y.data(), 1);
+    });
+    long dotThreshold = crossover(DispatchDot, n1, n1, [&](long n) {
+        T result;
+        dot(int(n), x.data(), 1, y.data(), 1, result);
+        y[0] = result;
+    });
+
+    ///
+    ///  Level 2 and 3: square matrices, threshold is m*n resp. m*n*k
+    ///
+    vector<long> n2, size2, size3;
+    for (long n=2; n<=256; n=(n*5)/4+1) {
+        n2.push_back(n);
+        size2.push_back(n*n);
+        size3.push_back(n*n*n);
+    }
+    long gemvThreshold = crossover(DispatchGemv, n2, size2, [&](long n) {
+        gemv(ColMajor, NoTrans, int(n), int(n), T(1), A.data(), int(n),
+             x.data(), 1, T(0), y.data(), 1);
+    });
+    vector<long> n3(n2.begin(), n2.end());
+    long gemmThreshold = crossover(DispatchGemm, n3, size3, [&](long n) {
+        gemm(ColMajor, NoTrans, NoTrans, int(n), int(n), int(n),
+             T(1), A.data(), int(n), B.data(), int(n),
+             T(0), C.data(), int(n));
+    });
+
+    BlasDispatch::setThreshold(DispatchAxpy, axpyThreshold);
+    BlasDispatch::setThreshold(DispatchDot,  dotThreshold);
+    BlasDispatch::setThreshold(DispatchGemv, gemvThreshold);
+    BlasDispatch::setThreshold(DispatchGemm, gemmThreshold);
+
+    if (!BlasDispatch::save(filename)) {
+        cerr << "Could not write " << filename << endl;
+        return 1;
+    }
+    cout << "Thresholds written to " << filename << endl;
+    return 0;
+}
@@ -0,0 +1,131 @@
+#include <chrono>
+#include <cxxstd/cstdlib.h>
+#include <cxxstd/iostream.h>
+#include <flens/flens.cxx>
+
+using namespace std;
+using namespace flens;
+
+typedef GeMatrix<FullStorage<double> >             DGeMatrix;
+typedef GeMatrix<FullStorage<double, RowMajor> >   DGeMatrixRowMajor;
+typedef DenseVector<Array<double> >                DDenseVector;
+
+///
+///  Products of three or more matrices and products of two or more matrices
+///  with a vector get evaluated in the cheapest order.  The hook reports the
+///  order chosen:
+///
+///      ./blas-matrix-chain [n]
+///
+void
+report(const char *order, double flops, double flopsLeftToRight)
+{
+    cout << "  order: " << order
+         << ", flops: " << flops
+         << " (left to right: " << flopsLeftToRight << ")" << endl;
+}
+
+template <typename Func>
+double
+seconds(Func f)
+{
+    typedef std::chrono::high_resolution_clock  Clock;
+
+    Clock::time_point start = Clock::now();
+    f();
+    return std::chrono::duration<double>(Clock::now()-start).count();
+}
+
+template <typename MA, typename MB>
+double
+maxDiff(const MA &A, const MB &B)
+{
+    double diff = 0;
+    for (int i=1; i<=A.numRows(); ++i) {
+        for (int j=1; j<=A.numCols(); ++j) {
+            diff = std::max(diff, abs(A(i,j)-B(i,j)));
+        }
+    }
+    return diff;
+}
+
+double
+maxDiff(const DDenseVector &x, const DDenseVector &y)
+{
+    double diff = 0;
+    for (int i=1; i<=x.length(); ++i) {
+        diff = std::max(diff, abs(x(i)-y(i)));
+    }
+    return diff;
+}
+
+int
+main(int argc, char **argv)
+{
+    const int n = (argc>1) ? atoi(argv[1]) : 1000;
+    const int k = 10;
+
+    blas::MatrixChain::setHook(report);
+
+    DGeMatrix     A(n, k), B(k, n), C(n, n), D(n, n), BC, AB, R;
+    DDenseVector  x(n), y(n), z, t, u;
+
+    fillRandom(A);
+    fillRandom(B);
+    fillRandom(C);
+    fillRandom(x);
+
+    ///
+    ///  (A*B)*C needs 2*n*n*(n+k) flops, A*(B*C) only 4*n*n*k.
+    ///
+    cout << "D = A*B*C" << endl;
+    double time = seconds([&] {
+        D = A*B*C;
+    });
+    blas::mm(NoTrans, NoTrans, 1.0, B, C, 0.0, BC);
+    blas::mm(NoTrans, NoTrans, 1.0, A, BC, 0.0, R);
+    cout << "  time: " << time << "s, error: " << maxDiff(D, R) << endl;
+
+    ///
+    ///  Scaling factors, transposes and row major factors are part of the
+    ///  chain.
+    ///
+    DGeMatrixRowMajor  CR = C;
+
+    cout << "D = 2*transpose(B)*transpose(A)*CR" << endl;
+    D = 2.0*transpose(B)*transpose(A)*CR;
+    blas::mm(NoTrans, NoTrans, 1.0, A, B, 0.0, AB);
+    blas::mm(Trans, NoTrans, 2.0, AB, C, 0.0, R);
+    cout << "  error: " << maxDiff(D, R) << endl;
+
+    cout << "D += transpose(A*B*C)" << endl;
+    D = 1;
+    D += transpose(A*B*C);
+    R = 1;
+    blas::mm(Trans, Trans, 1.0, BC, A, 1.0, R);
+    cout << "  error: " << maxDiff(D, R) << endl;
+
+    ///
+    ///  A*B*x gets computed as A*(B*x), i.e. without any matrix-matrix
+    ///  product.
+    ///
+    cout << "y = A*B*C*x" << endl;
+    time = seconds([&] {
+        y = A*B*C*x;
+    });
+    blas::mv(NoTrans, 1.0, C, x, 0.0, t);
+    blas::mv(NoTrans, 1.0, B, t, 0.0, z);
+    blas::mv(NoTrans, 1.0, A, z, 0.0, u);
+    cout << "  time: " << time << "s, error: " << maxDiff(y, u) << endl;
+
+    cout << "y = x*(C*A*B)" << endl;
+    y = x*(C*A*B);
+    DDenseVector  xC, xCA, xCAB;
+
+    blas::mv(Trans, 1.0, C, x, 0.0, xC);
+    blas::mv(Trans, 1.0, A, xC, 0.0, xCA);
+    blas::mv(Trans, 1.0, B, xCA, 0.0, xCAB);
+    cout << "  error: " << maxDiff(y, xCAB) << endl;
+
+    return 0;
+}
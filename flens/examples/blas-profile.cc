@@ -0,0 +1,53 @@
+#define CXXBLAS_PROFILE
+#include <cxxstd/iostream.h>
+#include <flens/flens.cxx>
+
+using namespace std;
+using namespace flens;
+
+typedef double   T;
+
+///
+///  With CXXBLAS_PROFILE defined the cxxblas kernels count calls, flops,
+///  bytes and time per routine and backend.  Instead of calling
+///  summary/writeChromeTrace explicitly you can also set the environment
+///  variables CXXBLAS_PROFILE_SUMMARY and CXXBLAS_PROFILE_TRACE.
+///
+int
+main()
+{
+    typedef GeMatrix<FullStorage<T> >   Matrix;
+    typedef DenseVector<Array<T> >      Vector;
+
+    cxxblas::Profiler::setTracing(true);
+
+    Matrix A(200, 200), B(200, 200), C(200, 200);
+    Vector x(200), y(200);
+
+    fillRandom(A);
+    fillRandom(B);
+    fillRandom(x);
+
+    for (int it=0; it<10; ++it) {
+        C  = A*B;
+        y  = A*x;
+        y += T(2)*x;
+    }
+
+    ///
+    ///  Small products that end up in the generic kernels
+    ///
+    for (int it=0; it<100; ++it) {
+        const Underscore<Matrix::IndexType> _;
+        C(_(1,4),_(1,4)) = A(_(1,4),_(1,4))*B(_(1,4),_(1,4));
+    }
+
+    cxxblas::Profiler::summary(cout);
+
+    if (!cxxblas::Profiler::writeChromeTrace("blas-profile.json")) {
+        cerr << "Could not write blas-profile.json" << endl;
+        return 1;
+    }
+    cout << "Trace written to blas-profile.json" << endl;
+    return 0;
+}
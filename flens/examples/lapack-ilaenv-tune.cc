@@ -0,0 +1,211 @@
+#include <chrono>
+#include <cxxstd/cstdlib.h>
+#include <cxxstd/iostream.h>
+#include <cxxstd/vector.h>
+#include <flens/flens.cxx>
+
+using namespace std;
+using namespace flens;
+
+///
+///  Benchmarks the blocked FLENS-LAPACK routines trf, qrf, potrf, hrd and
+///  (for complex types) trd over a grid of block sizes and crossover points.
+///  The fastest values for each element type are written to a tuning file
+///  that ilaenv picks up through FLENS_ILAENV_CONFIG:
+///
+///      ./lapack-ilaenv-tune [file] [n]
+///
+///  Compile with the BLAS you are going to use, e.g.
+///  -DWITH_OPENBLAS ... -lopenblas.  The values only affect the generic
+///  implementation, i.e. not calls that are forwarded to an external LAPACK.
+///
+template <typename Func>
+double
+seconds(Func f)
+{
+    typedef std::chrono::high_resolution_clock  Clock;
+
+    long runs = 0;
+    Clock::time_point start = Clock::now();
+    double elapsed;
+    do {
+        f();
+        ++runs;
+        elapsed = std::chrono::duration<double>(Clock::now()-start).count();
+    } while (elapsed<0.2);
+    return elapsed/runs;
+}
+
+///
+///  Runs f for each value of the grid with ilaenv returning this value for
+///  (spec, name) and keeps the fastest one in the tuning table.
+///
+template <typename T, typename Func>
+int
+tune(int spec, const char *name, const vector<int> &grid, Func f)
+{
+    int     best     = -1;
+    double  bestTime = 0;
+
+    for (size_t i=0; i<grid.size(); ++i) {
+        lapack::IlaenvTuning::set<T>(spec, name, grid[i]);
+        double time = seconds(f);
+
+        cout << "  " << lapack::IlaenvTuning::typeChar<T>() << name
+             << " spec = " << spec << ", value = " << grid[i]
+             << ": " << time << "s" << endl;
+        if (best<0 || time<bestTime) {
+            best     = grid[i];
+            bestTime = time;
+        }
+    }
+    lapack::IlaenvTuning::set<T>(spec, name, best);
+    return best;
+}
+
+///
+///  potrf takes a symmetric matrix in the real and a hermitian matrix in the
+///  complex case.
+///
+template <typename MA>
+typename RestrictTo<IsComplex<typename MA::ElementType>::value, void>::Type
+potrfUpper(MA &H)
+{
+    lapack::potrf(H.upper().hermitian());
+}
+
+template <typename MA>
+typename RestrictTo<!IsComplex<typename MA::ElementType>::value, void>::Type
+potrfUpper(MA &H)
+{
+    lapack::potrf(H.upper().symmetric());
+}
+
+///
+///  There is no real variant of trd, so HETRD is only tuned for complex types.
+///
+template <typename MA>
+typename RestrictTo<IsComplex<typename MA::ElementType>::value, void>::Type
+tuneTrd(const MA &H0, const vector<int> &nbGrid, const vector<int> &nxGrid)
+{
+    typedef typename MA::ElementType                     T;
+    typedef typename ComplexTrait<T>::PrimitiveType      PT;
+
+    const int n = H0.numRows();
+
+    auto run = [&] {
+        MA                              H = H0;
+        DenseVector<Array<PT> >         d(n), e(n-1);
+        DenseVector<Array<T> >          tau(n-1), work;
+
+        lapack::trd(H.upper().hermitian(), d, e, tau, work);
+    };
+    tune<T>(1, "HETRD", nbGrid, run);
+    tune<T>(3, "HETRD", nxGrid, run);
+}
+
+template <typename MA>
+typename RestrictTo<!IsComplex<typename MA::ElementType>::value, void>::Type
+tuneTrd(const MA &, const vector<int> &, const vector<int> &)
+{
+}
+
+template <typename T>
+void
+tuneAll(int n)
+{
+    typedef GeMatrix<FullStorage<T> >           Matrix;
+    typedef typename Matrix::IndexType          IndexType;
+    typedef DenseVector<Array<T> >              Vector;
+    typedef DenseVector<Array<IndexType> >      IndexVector;
+
+    const int nbValues[] = { 8, 16, 24, 32, 48, 64, 96, 128, 192, 256 };
+    const int nxValues[] = { 0, 32, 64, 96, 128, 192, 256 };
+
+    vector<int> nbGrid, nxGrid, hrdGrid;
+    for (int v: nbValues) {
+        if (v<n) {
+            nbGrid.push_back(v);
+        }
+        //  gehrd uses a fixed size buffer for block sizes up to 64
+        if (v<n && v<=64) {
+            hrdGrid.push_back(v);
+        }
+    }
+    for (int v: nxValues) {
+        if (v<n) {
+            nxGrid.push_back(v);
+        }
+    }
+
+    Matrix A0(n, n);
+    fillRandom(A0);
+
+    ///
+    ///  Hermitian positive definite matrix for potrf and trd
+    ///
+    Matrix H0(n, n);
+    blas::mm(ConjTrans, NoTrans, T(1), A0, A0, T(0), H0);
+    H0.diag(0) += T(n);
+
+    tune<T>(1, "GETRF", nbGrid, [&] {
+        Matrix      A = A0;
+        IndexVector piv(n);
+
+        lapack::trf(A, piv);
+    });
+
+    auto qrf = [&] {
+        Matrix  A = A0;
+        Vector  tau(n), work;
+
+        lapack::qrf(A, tau, work);
+    };
+    tune<T>(1, "GEQRF", nbGrid, qrf);
+    tune<T>(3, "GEQRF", nxGrid, qrf);
+
+    tune<T>(1, "POTRF", nbGrid, [&] {
+        Matrix  H = H0;
+
+        potrfUpper(H);
+    });
+
+    auto hrd = [&] {
+        Matrix  A = A0;
+        Vector  tau(n-1), work;
+
+        lapack::hrd(IndexType(1), IndexType(n), A, tau, work);
+    };
+    tune<T>(1, "GEHRD", hrdGrid, hrd);
+    tune<T>(3, "GEHRD", nxGrid, hrd);
+
+    tuneTrd(H0, nbGrid, nxGrid);
+}
+
+int
+main(int argc, char **argv)
+{
+    const char *filename = (argc>1) ? argv[1] : "flens-ilaenv.cfg";
+    const int  n         = (argc>2) ? atoi(argv[2]) : 512;
+
+    ///
+    ///  Start from the builtin defaults, not from a previous tuning file.
+    ///
+    lapack::IlaenvTuning::clear();
+
+    cout << "float:" << endl;
+    tuneAll<float>(n);
+    cout << "double:" << endl;
+    tuneAll<double>(n);
+    cout << "complex<float>:" << endl;
+    tuneAll<complex<float> >(n);
+    cout << "complex<double>:" << endl;
+    tuneAll<complex<double> >(n);
+
+    if (!lapack::IlaenvTuning::save(filename)) {
+        cerr << "Could not write " << filename << endl;
+        return 1;
+    }
+    cout << "Tuning table written to " << filename << endl;
+    return 0;
+}
@@ -0,0 +1,96 @@
+#include <chrono>
+#include <cxxstd/cstdlib.h>
+#include <cxxstd/iostream.h>
+#include <flens/flens.cxx>
+
+using namespace std;
+using namespace flens;
+
+///
+///  Matrix types using the allocators from flens/storage/allocator.  Compare
+///  the leading dimensions and the time of a matrix product for a power of
+///  two size:
+///
+///      ./storage-allocators [n]
+///
+///  For interleaved NUMA placement compile with -DWITH_LIBNUMA ... -lnuma,
+///  for first touch placement with -fopenmp.
+///
+typedef FullStorage<double, ColMajor>                                 FS;
+typedef FullStorage<double, ColMajor, IndexOptions<>,
+                    AlignedAllocator<double> >                        AlignedFS;
+typedef FullStorage<double, ColMajor, IndexOptions<>,
+                    PaddedAllocator<AlignedAllocator<double> > >      PaddedFS;
+typedef FullStorage<double, ColMajor, IndexOptions<>,
+                    HugePageAllocator<double> >                       HugeFS;
+typedef FullStorage<double, ColMajor, IndexOptions<>,
+                    NumaAllocator<double, NumaInterleave> >           NumaFS;
+
+template <typename Func>
+double
+seconds(Func f)
+{
+    typedef std::chrono::high_resolution_clock  Clock;
+
+    Clock::time_point start = Clock::now();
+    f();
+    return std::chrono::duration<double>(Clock::now()-start).count();
+}
+
+template <typename FS>
+void
+run(const char *name, int n)
+{
+    GeMatrix<FS>  A(n, n), B(n, n), C(n, n);
+
+    fillRandom(A);
+    fillRandom(B);
+
+    double time = seconds([&] {
+        C = A*B;
+    });
+
+    size_t address = reinterpret_cast<size_t>(A.data());
+
+    cout << name << ": leading dimension = " << A.leadingDimension()
+         << ", data % 64 = " << address % 64
+         << ", C(n,n) = " << C(n,n)
+         << ", time = " << time << "s" << endl;
+}
+
+int
+main(int argc, char **argv)
+{
+    const int n = (argc>1) ? atoi(argv[1]) : 1024;
+
+    run<FS>       ("std::allocator   ", n);
+    run<AlignedFS>("AlignedAllocator ", n);
+    run<PaddedFS> ("PaddedAllocator  ", n);
+    run<HugeFS>   ("HugePageAllocator", n);
+    run<NumaFS>   ("NumaAllocator    ", n);
+
+    ///
+    ///  Vectors can use the allocators as well
+    ///
+    DenseVector<Array<double, IndexOptions<>, AlignedAllocator<double> > >
+        x(n);
+    DenseVector<Array<double, IndexOptions<>, HugePageAllocator<double> > >
+        y(n);
+
+    x = 1;
+    y = 2;
+    y += x;
+    cout << "y(1) = " << y(1) << endl;
+
+    ///
+    ///  Copy between different allocators and padded storage
+    ///
+    GeMatrix<PaddedFS>  P(n, n);
+    GeMatrix<FS>        A(n, n);
+
+    fillRandom(A);
+    P = A;
+    A = P;
+    cout << "P(n,1) - A(n,1) = " << P(n,1) - A(n,1) << endl;
+    return 0;
+}
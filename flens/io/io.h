@@ -50,6 +50,7 @@
 #include <flens/io/packedstorage/load.h>
 #include <flens/io/packedstorage/out.h>
 #include <flens/io/packedstorage/save.h>
+#include <flens/io/rfpstorage/out.h>
 #include <flens/io/tinyarray/out.h>
 #include <flens/io/tinyfullstorage/out.h>
 
@@ -48,6 +48,7 @@
 #include <flens/io/packedstorage/load.tcc>
 #include <flens/io/packedstorage/out.tcc>
 #include <flens/io/packedstorage/save.tcc>
+#include <flens/io/rfpstorage/out.tcc>
 #include <flens/io/tinyarray/out.tcc>
 #include <flens/io/tinyfullstorage/out.tcc>
 
@@ -0,0 +1,70 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FLENS_LAPACK_AUXILIARY_RFP_H
+#define FLENS_LAPACK_AUXILIARY_RFP_H 1
+
+#include <flens/storage/rfpstorage/rfplayout.h>
+#include <flens/typedefs.h>
+
+namespace flens { namespace lapack {
+
+//
+//  The RFP kernels regard each block of the RFP array as a block of the
+//  upper triangular form:  it either holds A11, A12, A22 of the upper
+//  triangle or the conjugate transpose of it.  For upLo==Lower the lower
+//  triangle of a symmetric or hermitian matrix is the conjugate transpose
+//  of the upper one, a lower triangular matrix L gets treated as L^H.
+//
+template <typename MA>
+    bool
+    rfpConjTrans(const MA &A, RfpBlock block);
+
+//
+//  Triangle of a diagonal block as it is stored in the RFP array.
+//
+template <typename MA>
+    StorageUpLo
+    rfpUpLo(const MA &A, RfpBlock block);
+
+//
+//  Calls func(i, j, a, transposed) for each entry of the referenced
+//  triangle.  Here a is a reference into the RFP array and transposed is
+//  true if a holds the conjugate of A(i,j).
+//
+template <typename MA, typename FUNC>
+    void
+    rfpForEach(MA &A, FUNC func);
+
+} } // namespace lapack, flens
+
+#endif // FLENS_LAPACK_AUXILIARY_RFP_H
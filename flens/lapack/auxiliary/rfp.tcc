@@ -0,0 +1,101 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FLENS_LAPACK_AUXILIARY_RFP_TCC
+#define FLENS_LAPACK_AUXILIARY_RFP_TCC 1
+
+#include <flens/lapack/auxiliary/rfp.h>
+
+namespace flens { namespace lapack {
+
+template <typename MA>
+bool
+rfpConjTrans(const MA &A, RfpBlock block)
+{
+    const bool transposed = A.engine().transposedBlock(A.upLo(), block);
+
+    return (A.upLo()==Upper) ? transposed : !transposed;
+}
+
+template <typename MA>
+StorageUpLo
+rfpUpLo(const MA &A, RfpBlock block)
+{
+    ASSERT(block!=RfpOffDiag);
+
+    return rfpConjTrans(A, block) ? Lower : Upper;
+}
+
+template <typename MA, typename FUNC>
+void
+rfpForEach(MA &A, FUNC func)
+{
+    typedef typename MA::IndexType  IndexType;
+
+    const StorageUpLo upLo = A.upLo();
+    const IndexType   ib   = A.indexBase();
+    const IndexType   n1   = A.engine().viewBlock(upLo, RfpDiag1).numRows();
+
+    for (int b=RfpDiag1; b<=RfpOffDiag; ++b) {
+        const RfpBlock block     = RfpBlock(b);
+        const bool     diagBlock = (block!=RfpOffDiag);
+        const bool     trans     = A.engine().transposedBlock(upLo, block);
+
+        auto V = A.engine().viewBlock(upLo, block);
+//
+//      Dimensions and position of the block within the matrix
+//
+        const IndexType m  = (trans) ? V.numCols() : V.numRows();
+        const IndexType n  = (trans) ? V.numRows() : V.numCols();
+        const IndexType i0 = (block==RfpDiag2 || (!diagBlock && upLo==Lower))
+                           ? n1 : 0;
+        const IndexType j0 = (block==RfpDiag2 || (!diagBlock && upLo==Upper))
+                           ? n1 : 0;
+
+        for (IndexType j=0; j<n; ++j) {
+            const IndexType iFirst = (diagBlock && upLo==Lower) ? j : 0;
+            const IndexType iLast  = (diagBlock && upLo==Upper) ? j : m-1;
+
+            for (IndexType i=iFirst; i<=iLast; ++i) {
+                if (trans) {
+                    func(ib+i0+i, ib+j0+j, V(ib+j, ib+i), true);
+                } else {
+                    func(ib+i0+i, ib+j0+j, V(ib+i, ib+j), false);
+                }
+            }
+        }
+    }
+}
+
+} } // namespace lapack, flens
+
+#endif // FLENS_LAPACK_AUXILIARY_RFP_TCC
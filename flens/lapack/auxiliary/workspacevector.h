@@ -0,0 +1,81 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FLENS_LAPACK_AUXILIARY_WORKSPACEVECTOR_H
+#define FLENS_LAPACK_AUXILIARY_WORKSPACEVECTOR_H 1
+
+#include <flens/auxiliary/auxiliary.h>
+#include <flens/storage/storage.h>
+#include <flens/vectortypes/vectortypes.h>
+
+namespace flens { namespace lapack {
+
+//
+//  Vector types for the work arrays of the variants with temporary
+//  workspace.  For a matrix type MA with a dense vector type MA::Vector
+//
+//      WorkspaceVector<MA>::Type      has the element type of MA,
+//      WorkspaceVector<MA>::RealType  its primitive (real) type
+//
+//  and both allocate from the thread local workspace arena, i.e. they must
+//  not be passed to another thread.  Other vector types (and all types if
+//  FLENS_NO_WORKSPACE is defined) are used as they are.
+//
+template <typename V>
+struct WorkspaceVectorImpl
+{
+    typedef V   Type;
+    typedef V   RealType;
+};
+
+template <typename T, typename I, typename A>
+struct WorkspaceVectorImpl<DenseVector<Array<T, I, A> > >
+{
+    typedef typename ComplexTrait<T>::PrimitiveType                 PT;
+    typedef typename A::template rebind<PT>::other                  RA;
+
+    typedef typename WorkspaceAllocatorFor<A>::Type                 WA;
+    typedef typename WorkspaceAllocatorFor<RA>::Type                WRA;
+
+    typedef DenseVector<Array<T, I, WA> >                           Type;
+    typedef DenseVector<Array<PT, I, WRA> >                         RealType;
+};
+
+template <typename MA>
+struct WorkspaceVector
+    : public WorkspaceVectorImpl<typename RemoveRef<MA>::Type::Vector>
+{
+};
+
+} } // namespace lapack, flens
+
+#endif // FLENS_LAPACK_AUXILIARY_WORKSPACEVECTOR_H
@@ -0,0 +1,173 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FLENS_LAPACK_DEBUG_ISCLOSE_TCC
+#define FLENS_LAPACK_DEBUG_ISCLOSE_TCC 1
+
+#include <cxxstd/cmath.h>
+#include <cxxstd/complex.h>
+#include <cxxstd/iostream.h>
+#include <flens/lapack/debug/isclose.h>
+
+namespace flens { namespace lapack {
+
+template <typename X, typename Y, typename T>
+bool
+isClose(const X &x, const Y &y, const T &tol,
+        const char *xName, const char *yName)
+{
+    using std::abs;
+
+    if (!(abs(x-y)<=tol)) {
+        std::cerr.precision(20);
+        std::cerr << xName << " = " << x
+                  << std::endl
+                  << yName << " = " << y
+                  << std::endl
+                  << "|" << xName << " - " << yName << "| = " << abs(x-y)
+                  << " > " << tol
+                  << std::endl;
+        return false;
+    }
+    return true;
+}
+
+template <typename VX, typename VY, typename T>
+bool
+isClose(const DenseVector<VX> &x, const DenseVector<VY> &y, const T &tol,
+        const char *xName, const char *yName)
+{
+    using std::abs;
+
+    typedef typename DenseVector<VX>::IndexType IndexType;
+
+    if (x.length()!=y.length()) {
+        std::cerr << xName << ".length() = " << x.length() << ", "
+                  << yName << ".length() = " << y.length()
+                  << std::endl;
+        return false;
+    }
+
+    IndexType iMax  = 0;
+    bool      close = true;
+
+    for (IndexType k=0; k<x.length(); ++k) {
+        const IndexType i = x.firstIndex() + k*x.inc();
+        const IndexType j = y.firstIndex() + k*y.inc();
+
+        if (!(abs(x(i)-y(j))<=tol)) {
+            if (close || abs(x(i)-y(j))>abs(x(x.firstIndex()+iMax*x.inc())
+                                           -y(y.firstIndex()+iMax*y.inc())))
+            {
+                iMax = k;
+            }
+            close = false;
+        }
+    }
+    if (!close) {
+        const IndexType i = x.firstIndex() + iMax*x.inc();
+        const IndexType j = y.firstIndex() + iMax*y.inc();
+
+        std::cerr.precision(20);
+        std::cerr << xName << "(" << i << ") = " << x(i)
+                  << std::endl
+                  << yName << "(" << j << ") = " << y(j)
+                  << std::endl
+                  << "|" << xName << "(" << i << ") - "
+                  << yName << "(" << j << ")| = " << abs(x(i)-y(j))
+                  << " > " << tol
+                  << std::endl;
+    }
+    return close;
+}
+
+template <typename MA, typename MB, typename T>
+bool
+isClose(const GeMatrix<MA> &A, const GeMatrix<MB> &B, const T &tol,
+        const char *AName, const char *BName)
+{
+    using std::abs;
+
+    typedef typename GeMatrix<MA>::IndexType IndexType;
+
+    if (A.numRows()!=B.numRows()) {
+        std::cerr << AName << ".numRows() = " << A.numRows() << ", "
+                  << BName << ".numRows() = " << B.numRows()
+                  << std::endl;
+        return false;
+    }
+    if (A.numCols()!=B.numCols()) {
+        std::cerr << AName << ".numCols() = " << A.numCols() << ", "
+                  << BName << ".numCols() = " << B.numCols()
+                  << std::endl;
+        return false;
+    }
+
+    const IndexType i0 = A.firstRow(), j0 = A.firstCol();
+    const IndexType k0 = B.firstRow(), l0 = B.firstCol();
+
+    IndexType iMax  = 0, jMax = 0;
+    bool      close = true;
+
+    for (IndexType j=0; j<A.numCols(); ++j) {
+        for (IndexType i=0; i<A.numRows(); ++i) {
+            if (!(abs(A(i0+i,j0+j)-B(k0+i,l0+j))<=tol)) {
+                if (close || abs(A(i0+i,j0+j)-B(k0+i,l0+j))
+                            >abs(A(i0+iMax,j0+jMax)-B(k0+iMax,l0+jMax)))
+                {
+                    iMax = i;
+                    jMax = j;
+                }
+                close = false;
+            }
+        }
+    }
+    if (!close) {
+        const IndexType i = i0+iMax, j = j0+jMax;
+        const IndexType k = k0+iMax, l = l0+jMax;
+
+        std::cerr.precision(20);
+        std::cerr << AName << "(" << i << ", " << j << ") = " << A(i,j)
+                  << std::endl
+                  << BName << "(" << k << ", " << l << ") = " << B(k,l)
+                  << std::endl
+                  << "|" << AName << "(" << i << ", " << j << ") - "
+                  << BName << "(" << k << ", " << l << ")| = "
+                  << abs(A(i,j)-B(k,l)) << " > " << tol
+                  << std::endl;
+    }
+    return close;
+}
+
+} } // namespace lapack, flens
+
+#endif // FLENS_LAPACK_DEBUG_ISCLOSE_TCC
@@ -58,21 +58,61 @@ template <typename MA, typename MB>
     isIdentical(const GeMatrix<MA> &A, const GeMatrix<MB> &B,
                 const char *AName = "A", const char *BName = "B");
 
+template <typename MA, typename MB>
+    bool
+    isIdentical(const HbMatrix<MA> &A, const HbMatrix<MB> &B,
+                const char *AName = "A", const char *BName = "B");
+
 template <typename MA, typename MB>
     bool
     isIdentical(const HeMatrix<MA> &A, const HeMatrix<MB> &B,
                 const char *AName = "A", const char *BName = "B");
 
+template <typename MA, typename MB>
+    bool
+    isIdentical(const HfMatrix<MA> &A, const HfMatrix<MB> &B,
+                const char *AName = "A", const char *BName = "B");
+
+template <typename MA, typename MB>
+    bool
+    isIdentical(const HpMatrix<MA> &A, const HpMatrix<MB> &B,
+                const char *AName = "A", const char *BName = "B");
+
 template <typename MA, typename MB>
     bool
     isIdentical(const TrMatrix<MA> &A, const TrMatrix<MB> &B,
                 const char *AName = "A", const char *BName = "B");
 
+template <typename MA, typename MB>
+    bool
+    isIdentical(const TfMatrix<MA> &A, const TfMatrix<MB> &B,
+                const char *AName = "A", const char *BName = "B");
+
+template <typename MA, typename MB>
+    bool
+    isIdentical(const TpMatrix<MA> &A, const TpMatrix<MB> &B,
+                const char *AName = "A", const char *BName = "B");
+
+template <typename MA, typename MB>
+    bool
+    isIdentical(const SbMatrix<MA> &A, const SbMatrix<MB> &B,
+                const char *AName = "A", const char *BName = "B");
+
 template <typename MA, typename MB>
     bool
     isIdentical(const SyMatrix<MA> &A, const SyMatrix<MB> &B,
                 const char *AName = "A", const char *BName = "B");
 
+template <typename MA, typename MB>
+    bool
+    isIdentical(const SfMatrix<MA> &A, const SfMatrix<MB> &B,
+                const char *AName = "A", const char *BName = "B");
+
+template <typename MA, typename MB>
+    bool
+    isIdentical(const SpMatrix<MA> &A, const SpMatrix<MB> &B,
+                const char *AName = "A", const char *BName = "B");
+
 } } // namespace lapack, flens
 
 #endif // FLENS_LAPACK_DEBUG_ISIDENTICAL_H
@@ -309,6 +309,20 @@ isIdentical(const GbMatrix<MA> &A, const GbMatrix<MB> &B,
     return true;
 }
 
+template <typename MA, typename MB>
+bool
+isIdentical(const HbMatrix<MA> &A, const HbMatrix<MB> &B,
+            const char *AName, const char *BName)
+{
+    if (A.upLo()!=B.upLo()) {
+        std::cerr << AName << ".upLo() = " << A.upLo() << ", "
+                  << BName << ".upLo() = " << B.upLo()
+                  << std::endl;
+        return false;
+    }
+    return isIdentical(A.general(), B.general(), AName, BName);
+}
+
 template <typename MA, typename MB>
 bool
 isIdentical(const HeMatrix<MA> &A, const HeMatrix<MB> &B,
@@ -394,6 +408,78 @@ isIdentical(const HeMatrix<MA> &A, const HeMatrix<MB> &B,
     return true;
 }
 
+template <typename MA, typename MB>
+bool
+isIdentical(const HfMatrix<MA> &A, const HfMatrix<MB> &B,
+            const char *AName, const char *BName)
+{
+    typedef typename HfMatrix<MA>::ConstArrayView  ArrayViewA;
+    typedef typename HfMatrix<MB>::ConstArrayView  ArrayViewB;
+
+    if (A.upLo()!=B.upLo()) {
+        std::cerr << AName << ".upLo() = " << A.upLo() << ", "
+                  << BName << ".upLo() = " << B.upLo()
+                  << std::endl;
+        return false;
+    }
+    if (A.order()!=B.order()) {
+        std::cerr << AName << ".order() = " << A.order() << ", "
+                  << BName << ".order() = " << B.order()
+                  << std::endl;
+        return false;
+    }
+    if (A.dim()!=B.dim()) {
+        std::cerr << AName << ".dim() = " << A.dim() << ", "
+                  << BName << ".dim() = " << B.dim()
+                  << std::endl;
+        return false;
+    }
+//
+//  Same layout, so the arrays can be compared
+//
+    const DenseVector<ArrayViewA> a = ArrayViewA(A.engine().numNonZeros(),
+                                                 A.data());
+    const DenseVector<ArrayViewB> b = ArrayViewB(B.engine().numNonZeros(),
+                                                 B.data());
+    return isIdentical(a, b, AName, BName);
+}
+
+template <typename MA, typename MB>
+bool
+isIdentical(const HpMatrix<MA> &A, const HpMatrix<MB> &B,
+            const char *AName, const char *BName)
+{
+    typedef typename HpMatrix<MA>::ConstArrayView  ArrayViewA;
+    typedef typename HpMatrix<MB>::ConstArrayView  ArrayViewB;
+
+    if (A.upLo()!=B.upLo()) {
+        std::cerr << AName << ".upLo() = " << A.upLo() << ", "
+                  << BName << ".upLo() = " << B.upLo()
+                  << std::endl;
+        return false;
+    }
+    if (A.order()!=B.order()) {
+        std::cerr << AName << ".order() = " << A.order() << ", "
+                  << BName << ".order() = " << B.order()
+                  << std::endl;
+        return false;
+    }
+    if (A.dim()!=B.dim()) {
+        std::cerr << AName << ".dim() = " << A.dim() << ", "
+                  << BName << ".dim() = " << B.dim()
+                  << std::endl;
+        return false;
+    }
+//
+//  Same layout, so the arrays can be compared
+//
+    const DenseVector<ArrayViewA> a = ArrayViewA(A.engine().numNonZeros(),
+                                                 A.data());
+    const DenseVector<ArrayViewB> b = ArrayViewB(B.engine().numNonZeros(),
+                                                 B.data());
+    return isIdentical(a, b, AName, BName);
+}
+
 
 
 template <typename MA, typename MB>
@@ -485,6 +571,104 @@ isIdentical(const TrMatrix<MA> &A, const TrMatrix<MB> &B,
     return true;
 }
 
+template <typename MA, typename MB>
+bool
+isIdentical(const TfMatrix<MA> &A, const TfMatrix<MB> &B,
+            const char *AName, const char *BName)
+{
+    typedef typename TfMatrix<MA>::ConstArrayView  ArrayViewA;
+    typedef typename TfMatrix<MB>::ConstArrayView  ArrayViewB;
+
+    if (A.upLo()!=B.upLo()) {
+        std::cerr << AName << ".upLo() = " << A.upLo() << ", "
+                  << BName << ".upLo() = " << B.upLo()
+                  << std::endl;
+        return false;
+    }
+    if (A.diag()!=B.diag()) {
+        std::cerr << AName << ".diag() = " << A.diag() << ", "
+                  << BName << ".diag() = " << B.diag()
+                  << std::endl;
+        return false;
+    }
+    if (A.order()!=B.order()) {
+        std::cerr << AName << ".order() = " << A.order() << ", "
+                  << BName << ".order() = " << B.order()
+                  << std::endl;
+        return false;
+    }
+    if (A.dim()!=B.dim()) {
+        std::cerr << AName << ".dim() = " << A.dim() << ", "
+                  << BName << ".dim() = " << B.dim()
+                  << std::endl;
+        return false;
+    }
+//
+//  Same layout, so the arrays can be compared
+//
+    const DenseVector<ArrayViewA> a = ArrayViewA(A.engine().numNonZeros(),
+                                                 A.data());
+    const DenseVector<ArrayViewB> b = ArrayViewB(B.engine().numNonZeros(),
+                                                 B.data());
+    return isIdentical(a, b, AName, BName);
+}
+
+template <typename MA, typename MB>
+bool
+isIdentical(const TpMatrix<MA> &A, const TpMatrix<MB> &B,
+            const char *AName, const char *BName)
+{
+    typedef typename TpMatrix<MA>::ConstArrayView  ArrayViewA;
+    typedef typename TpMatrix<MB>::ConstArrayView  ArrayViewB;
+
+    if (A.upLo()!=B.upLo()) {
+        std::cerr << AName << ".upLo() = " << A.upLo() << ", "
+                  << BName << ".upLo() = " << B.upLo()
+                  << std::endl;
+        return false;
+    }
+    if (A.diag()!=B.diag()) {
+        std::cerr << AName << ".diag() = " << A.diag() << ", "
+                  << BName << ".diag() = " << B.diag()
+                  << std::endl;
+        return false;
+    }
+    if (A.order()!=B.order()) {
+        std::cerr << AName << ".order() = " << A.order() << ", "
+                  << BName << ".order() = " << B.order()
+                  << std::endl;
+        return false;
+    }
+    if (A.dim()!=B.dim()) {
+        std::cerr << AName << ".dim() = " << A.dim() << ", "
+                  << BName << ".dim() = " << B.dim()
+                  << std::endl;
+        return false;
+    }
+//
+//  Same layout, so the arrays can be compared
+//
+    const DenseVector<ArrayViewA> a = ArrayViewA(A.engine().numNonZeros(),
+                                                 A.data());
+    const DenseVector<ArrayViewB> b = ArrayViewB(B.engine().numNonZeros(),
+                                                 B.data());
+    return isIdentical(a, b, AName, BName);
+}
+
+template <typename MA, typename MB>
+bool
+isIdentical(const SbMatrix<MA> &A, const SbMatrix<MB> &B,
+            const char *AName, const char *BName)
+{
+    if (A.upLo()!=B.upLo()) {
+        std::cerr << AName << ".upLo() = " << A.upLo() << ", "
+                  << BName << ".upLo() = " << B.upLo()
+                  << std::endl;
+        return false;
+    }
+    return isIdentical(A.general(), B.general(), AName, BName);
+}
+
 template <typename MA, typename MB>
 bool
 isIdentical(const SyMatrix<MA> &A, const SyMatrix<MB> &B,
@@ -570,6 +754,78 @@ isIdentical(const SyMatrix<MA> &A, const SyMatrix<MB> &B,
     return true;
 }
 
+template <typename MA, typename MB>
+bool
+isIdentical(const SfMatrix<MA> &A, const SfMatrix<MB> &B,
+            const char *AName, const char *BName)
+{
+    typedef typename SfMatrix<MA>::ConstArrayView  ArrayViewA;
+    typedef typename SfMatrix<MB>::ConstArrayView  ArrayViewB;
+
+    if (A.upLo()!=B.upLo()) {
+        std::cerr << AName << ".upLo() = " << A.upLo() << ", "
+                  << BName << ".upLo() = " << B.upLo()
+                  << std::endl;
+        return false;
+    }
+    if (A.order()!=B.order()) {
+        std::cerr << AName << ".order() = " << A.order() << ", "
+                  << BName << ".order() = " << B.order()
+                  << std::endl;
+        return false;
+    }
+    if (A.dim()!=B.dim()) {
+        std::cerr << AName << ".dim() = " << A.dim() << ", "
+                  << BName << ".dim() = " << B.dim()
+                  << std::endl;
+        return false;
+    }
+//
+//  Same layout, so the arrays can be compared
+//
+    const DenseVector<ArrayViewA> a = ArrayViewA(A.engine().numNonZeros(),
+                                                 A.data());
+    const DenseVector<ArrayViewB> b = ArrayViewB(B.engine().numNonZeros(),
+                                                 B.data());
+    return isIdentical(a, b, AName, BName);
+}
+
+template <typename MA, typename MB>
+bool
+isIdentical(const SpMatrix<MA> &A, const SpMatrix<MB> &B,
+            const char *AName, const char *BName)
+{
+    typedef typename SpMatrix<MA>::ConstArrayView  ArrayViewA;
+    typedef typename SpMatrix<MB>::ConstArrayView  ArrayViewB;
+
+    if (A.upLo()!=B.upLo()) {
+        std::cerr << AName << ".upLo() = " << A.upLo() << ", "
+                  << BName << ".upLo() = " << B.upLo()
+                  << std::endl;
+        return false;
+    }
+    if (A.order()!=B.order()) {
+        std::cerr << AName << ".order() = " << A.order() << ", "
+                  << BName << ".order() = " << B.order()
+                  << std::endl;
+        return false;
+    }
+    if (A.dim()!=B.dim()) {
+        std::cerr << AName << ".dim() = " << A.dim() << ", "
+                  << BName << ".dim() = " << B.dim()
+                  << std::endl;
+        return false;
+    }
+//
+//  Same layout, so the arrays can be compared
+//
+    const DenseVector<ArrayViewA> a = ArrayViewA(A.engine().numNonZeros(),
+                                                 A.data());
+    const DenseVector<ArrayViewB> b = ArrayViewB(B.engine().numNonZeros(),
+                                                 B.data());
+    return isIdentical(a, b, AName, BName);
+}
+
 
 } } // namespace lapack, flens
 
@@ -1322,7 +1322,7 @@ ev(bool     computeVL,
 //
 //  Remove references from rvalue types
 //
-    typedef typename RemoveRef<MA>::Type::Vector WorkVector;
+    typedef typename WorkspaceVector<MA>::Type WorkVector;
     WorkVector work;
     return ev(computeVL, computeVR, A, wr, wi, VL, VR, work);
 }
@@ -1345,10 +1345,8 @@ ev(bool     computeVL,
 //
 //  Remove references from rvalue types
 //
-    typedef typename RemoveRef<MA>::Type::Vector        WorkVector;
-    typedef typename RemoveRef<MA>::Type::ElementType   T;
-    typedef typename ComplexTrait<T>::PrimitiveType     PT;
-    typedef DenseVector<Array<PT> >                     RealWorkVector;
+    typedef typename WorkspaceVector<MA>::Type          WorkVector;
+    typedef typename WorkspaceVector<MA>::RealType      RealWorkVector;
 
     WorkVector      work;
     RealWorkVector  rWork;
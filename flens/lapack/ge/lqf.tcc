@@ -437,7 +437,7 @@ typename RestrictTo<IsGeMatrix<MA>::value
          void>::Type
 lqf(MA &&A, VTAU &&tau)
 {
-    typedef typename RemoveRef<MA>::Type::Vector WorkVector;
+    typedef typename WorkspaceVector<MA>::Type WorkVector;
 
     WorkVector  work;
     lqf(A, tau, work);
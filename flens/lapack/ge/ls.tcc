@@ -720,7 +720,7 @@ ls(Transpose    trans,
    MA           &&A,
    MB           &&B)
 {
-    typedef typename RemoveRef<MA>::Type::Vector WorkVector;
+    typedef typename WorkspaceVector<MA>::Type WorkVector;
 
     WorkVector  work;
     return ls(trans, A, B, work);
@@ -766,7 +766,7 @@ ls(Transpose    trans,
    MA           &&A,
    VB           &&b)
 {
-    typedef typename RemoveRef<MA>::Type::Vector WorkVector;
+    typedef typename WorkspaceVector<MA>::Type WorkVector;
 
     WorkVector  work;
     return ls(trans, A, b, work);
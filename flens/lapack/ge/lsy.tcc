@@ -984,7 +984,7 @@ lsy(MA           &&A,
     VJPIV        &&jPiv,
     RCOND        rCond)
 {
-    typedef typename RemoveRef<MA>::Type::Vector WorkVector;
+    typedef typename WorkspaceVector<MA>::Type WorkVector;
 
     WorkVector  work;
     return lsy(A, B, jPiv, rCond);
@@ -1004,10 +1004,8 @@ lsy(MA           &&A,
     VJPIV        &&jPiv,
     RCOND        rCond)
 {
-    typedef typename RemoveRef<MA>::Type::Vector        WorkVector;
-    typedef typename RemoveRef<MA>::Type::ElementType   T;
-    typedef typename ComplexTrait<T>::PrimitiveType     PT;
-    typedef DenseVector<Array<PT> >                     RealWorkVector;
+    typedef typename WorkspaceVector<MA>::Type          WorkVector;
+    typedef typename WorkspaceVector<MA>::RealType      RealWorkVector;
 
     WorkVector      work;
     RealWorkVector  rwork;
@@ -1097,7 +1095,7 @@ lsy(MA           &&A,
     VJPIV        &&jPiv,
     RCOND        rCond)
 {
-    typedef typename RemoveRef<MA>::Type::Vector WorkVector;
+    typedef typename WorkspaceVector<MA>::Type WorkVector;
 
     WorkVector  work;
     return lsy(A, b, jPiv, rCond, work);
@@ -1117,10 +1115,8 @@ lsy(MA           &&A,
     VJPIV        &&jPiv,
     RCOND        rCond)
 {
-    typedef typename RemoveRef<MA>::Type::Vector        WorkVector;
-    typedef typename RemoveRef<MA>::Type::ElementType   T;
-    typedef typename ComplexTrait<T>::PrimitiveType     PT;
-    typedef DenseVector<Array<PT> >                     RealWorkVector;
+    typedef typename WorkspaceVector<MA>::Type          WorkVector;
+    typedef typename WorkspaceVector<MA>::RealType      RealWorkVector;
 
     WorkVector      work;
     RealWorkVector  rwork;
@@ -721,7 +721,7 @@ qp3(MA      &&A,
     VJPIV   &&jPiv,
     VTAU    &&tau)
 {
-    typename RemoveRef<MA>::Type::Vector  work;
+    typename WorkspaceVector<MA>::Type  work;
 
     qp3(A, jPiv, tau, work);
 }
@@ -890,11 +890,9 @@ qp3(MA      &&A,
     VJPIV   &&jPiv,
     VTAU    &&tau)
 {
-    typedef typename RemoveRef<MA>::Type::Vector    Vector;
+    typedef typename WorkspaceVector<MA>::Type      Vector;
 
-    typedef typename RemoveRef<MA>::Type::ElementType   T;
-    typedef typename ComplexTrait<T>::PrimitiveType     PT;
-    typedef DenseVector<Array<PT> >                     RealVector;
+    typedef typename WorkspaceVector<MA>::RealType      RealVector;
 
     Vector      work;
     RealVector  realWork;
@@ -327,7 +327,7 @@ typename RestrictTo<(IsRealGeMatrix<MA>::value
          void>::Type
 qrf(MA &&A, VTAU &&tau)
 {
-    typedef typename RemoveRef<MA>::Type::Vector WorkVector;
+    typedef typename WorkspaceVector<MA>::Type WorkVector;
 
     WorkVector  work;
     qrf(A, tau, work);
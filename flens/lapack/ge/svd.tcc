@@ -351,7 +351,7 @@ svd(SVD::Job    jobU,
 //
 //  Remove references from rvalue types
 //
-    typedef typename RemoveRef<MA>::Type::Vector WorkVector;
+    typedef typename WorkspaceVector<MA>::Type WorkVector;
     WorkVector work;
     svd(jobU, jobVT, A, s, U, VT, work);
 }
@@ -376,10 +376,8 @@ svd(SVD::Job    jobU,
 //
 //  Remove references from rvalue types
 //
-    typedef typename RemoveRef<MA>::Type::Vector        WorkVector;
-    typedef typename RemoveRef<MA>::Type::ElementType   T;
-    typedef typename ComplexTrait<T>::PrimitiveType     PT;
-    typedef DenseVector<Array<PT> >                     RealWorkVector;
+    typedef typename WorkspaceVector<MA>::Type          WorkVector;
+    typedef typename WorkspaceVector<MA>::RealType      RealWorkVector;
 
     WorkVector      work;
     RealWorkVector  rwork;
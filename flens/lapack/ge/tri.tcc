@@ -338,7 +338,7 @@ typename RestrictTo<IsGeMatrix<MA>::value
 tri(MA          &&A,
     const VPIV  &piv)
 {
-    typedef typename RemoveRef<MA>::Type::Vector WorkVector;
+    typedef typename WorkspaceVector<MA>::Type WorkVector;
 
     WorkVector  work;
     return tri(A, piv, work);
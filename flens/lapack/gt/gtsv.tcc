@@ -0,0 +1,402 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* Based on
+ *
+       SUBROUTINE DGTSV( N, NRHS, DL, D, DU, B, LDB, INFO )
+       SUBROUTINE ZGTSV( N, NRHS, DL, D, DU, B, LDB, INFO )
+ *
+ *  -- LAPACK routine (version 3.3.1) --
+ *  -- LAPACK is a software package provided by Univ. of Tennessee,    --
+ *  -- Univ. of California Berkeley, Univ. of Colorado Denver and NAG Ltd..--
+ *  -- April 2011
+ */
+
+#ifndef FLENS_LAPACK_GT_GTSV_TCC
+#define FLENS_LAPACK_GT_GTSV_TCC 1
+
+#include <cxxstd/cmath.h>
+#include <cxxstd/complex.h>
+#include <flens/blas/blas.h>
+#include <flens/lapack/lapack.h>
+
+namespace flens { namespace lapack {
+
+//== generic lapack implementation =============================================
+
+namespace generic {
+
+//-- gtsv_abs1: |x| for real, |Re(x)|+|Im(x)| for complex x --------------------
+
+template <typename T>
+typename RestrictTo<IsNotComplex<T>::value, T>::Type
+gtsv_abs1(const T &x)
+{
+    using std::abs;
+    return abs(x);
+}
+
+template <typename T>
+T
+gtsv_abs1(const std::complex<T> &x)
+{
+    return cxxblas::abs1(x);
+}
+
+//-- gtsv [real and complex variant] -------------------------------------------
+
+template <typename VDL, typename VD, typename VDU, typename MB>
+typename DenseVector<VD>::IndexType
+gtsv_impl(DenseVector<VDL>  &dl,
+          DenseVector<VD>   &d,
+          DenseVector<VDU>  &du,
+          GeMatrix<MB>      &B)
+{
+    typedef typename DenseVector<VD>::ElementType  T;
+    typedef typename DenseVector<VD>::IndexType    IndexType;
+
+    const T Zero(0);
+
+    const IndexType n    = d.length();
+    const IndexType nRhs = B.numCols();
+
+    for (IndexType k=1; k<=n-1; ++k) {
+        if (dl(k)==Zero) {
+//
+//          Subdiagonal is zero, no elimination is required.
+//
+            if (d(k)==Zero) {
+//
+//              Diagonal is zero: set INFO = K and return; a unique
+//              solution can not be found.
+//
+                return k;
+            }
+        } else if (gtsv_abs1(d(k))>=gtsv_abs1(dl(k))) {
+//
+//          No row interchange required
+//
+            const T mult = dl(k) / d(k);
+            d(k+1) -= mult*du(k);
+            for (IndexType j=1; j<=nRhs; ++j) {
+                B(k+1,j) -= mult*B(k,j);
+            }
+            if (k<n-1) {
+                dl(k) = Zero;
+            }
+        } else {
+//
+//          Interchange rows K and K+1
+//
+            const T mult = d(k) / dl(k);
+            d(k) = dl(k);
+            T temp = d(k+1);
+            d(k+1) = du(k) - mult*temp;
+            if (k<n-1) {
+                dl(k) = du(k+1);
+                du(k+1) = -mult*dl(k);
+            }
+            du(k) = temp;
+            for (IndexType j=1; j<=nRhs; ++j) {
+                temp = B(k,j);
+                B(k,j) = B(k+1,j);
+                B(k+1,j) = temp - mult*B(k+1,j);
+            }
+        }
+    }
+    if (d(n)==Zero) {
+        return n;
+    }
+//
+//  Back solve with the matrix U from the factorization.
+//
+    for (IndexType j=1; j<=nRhs; ++j) {
+        B(n,j) /= d(n);
+        if (n>1) {
+            B(n-1,j) = (B(n-1,j) - du(n-1)*B(n,j)) / d(n-1);
+        }
+        for (IndexType k=n-2; k>=1; --k) {
+            B(k,j) = (B(k,j) - du(k)*B(k+1,j) - dl(k)*B(k+2,j)) / d(k);
+        }
+    }
+    return 0;
+}
+
+} // namespace generic
+
+//== interface for native lapack ===============================================
+
+#ifdef USE_CXXLAPACK
+
+namespace external {
+
+//-- gtsv [real and complex variant] -------------------------------------------
+
+template <typename VDL, typename VD, typename VDU, typename MB>
+typename DenseVector<VD>::IndexType
+gtsv_impl(DenseVector<VDL>  &dl,
+          DenseVector<VD>   &d,
+          DenseVector<VDU>  &du,
+          GeMatrix<MB>      &B)
+{
+    typedef typename DenseVector<VD>::IndexType  IndexType;
+
+//
+//  Diagonals of a GbMatrix are not stored contiguously
+//
+    if (dl.stride()!=1 || d.stride()!=1 || du.stride()!=1) {
+        typename DenseVector<VDL>::NoView  dl_ = dl;
+        typename DenseVector<VD>::NoView   d_  = d;
+        typename DenseVector<VDU>::NoView  du_ = du;
+
+        const IndexType info = gtsv_impl(dl_, d_, du_, B);
+
+        dl = dl_;
+        d  = d_;
+        du = du_;
+        return info;
+    }
+
+    IndexType info = cxxlapack::gtsv<IndexType>(d.length(),
+                                                B.numCols(),
+                                                dl.data(),
+                                                d.data(),
+                                                du.data(),
+                                                B.data(),
+                                                B.leadingDimension());
+    ASSERT(info>=0);
+    return info;
+}
+
+} // namespace external
+
+#endif // USE_CXXLAPACK
+
+//== public interface ==========================================================
+
+//-- gtsv [real and complex variant] -------------------------------------------
+
+template <typename VDL, typename VD, typename VDU, typename MB>
+typename RestrictTo<IsDenseVector<VDL>::value
+                 && IsDenseVector<VD>::value
+                 && IsDenseVector<VDU>::value
+                 && IsGeMatrix<MB>::value,
+         typename RemoveRef<VD>::Type::IndexType>::Type
+gtsv(VDL &&dl, VD &&d, VDU &&du, MB &&B)
+{
+    LAPACK_DEBUG_OUT("gtsv");
+
+//
+//  Remove references from rvalue types
+//
+    typedef typename RemoveRef<VD>::Type    VectorD;
+    typedef typename VectorD::IndexType     IndexType;
+
+    const IndexType n = d.length();
+
+    if (n==0) {
+        return 0;
+    }
+
+//
+//  Test the input parameters
+//
+    ASSERT(dl.firstIndex()==1);
+    ASSERT(d.firstIndex()==1);
+    ASSERT(du.firstIndex()==1);
+    ASSERT(dl.length()==n-1);
+    ASSERT(du.length()==n-1);
+    ASSERT(B.firstRow()==1);
+    ASSERT(B.firstCol()==1);
+    ASSERT(B.numRows()==n);
+
+#   ifdef CHECK_CXXLAPACK
+//
+//  Make copies of output arguments
+//
+    typedef typename RemoveRef<VDL>::Type   VectorDL;
+    typedef typename RemoveRef<VDU>::Type   VectorDU;
+    typedef typename RemoveRef<MB>::Type    MatrixB;
+
+    typename VectorDL::NoView  dl_org = dl;
+    typename VectorD::NoView   d_org  = d;
+    typename VectorDU::NoView  du_org = du;
+    typename MatrixB::NoView   B_org  = B;
+#   endif
+
+//
+//  Call implementation
+//
+    const IndexType info = LAPACK_SELECT::gtsv_impl(dl, d, du, B);
+
+#   ifdef CHECK_CXXLAPACK
+//
+//  Restore output arguments
+//
+    typename VectorDL::NoView  dl_generic = dl;
+    typename VectorD::NoView   d_generic  = d;
+    typename VectorDU::NoView  du_generic = du;
+    typename MatrixB::NoView   B_generic  = B;
+
+    dl = dl_org;
+    d  = d_org;
+    du = du_org;
+    B  = B_org;
+
+//
+//  Compare results
+//
+    const IndexType info_ = external::gtsv_impl(dl, d, du, B);
+
+    bool failed = false;
+    if (! isIdentical(dl_generic, dl, "dl_generic", "dl")) {
+        std::cerr << "CXXLAPACK: dl_generic = " << dl_generic << std::endl;
+        std::cerr << "F77LAPACK: dl = " << dl << std::endl;
+        failed = true;
+    }
+
+    if (! isIdentical(d_generic, d, "d_generic", "d")) {
+        std::cerr << "CXXLAPACK: d_generic = " << d_generic << std::endl;
+        std::cerr << "F77LAPACK: d = " << d << std::endl;
+        failed = true;
+    }
+
+    if (! isIdentical(du_generic, du, "du_generic", "du")) {
+        std::cerr << "CXXLAPACK: du_generic = " << du_generic << std::endl;
+        std::cerr << "F77LAPACK: du = " << du << std::endl;
+        failed = true;
+    }
+
+    if (! isIdentical(B_generic, B, "B_generic", "B")) {
+        std::cerr << "CXXLAPACK: B_generic = " << B_generic << std::endl;
+        std::cerr << "F77LAPACK: B = " << B << std::endl;
+        failed = true;
+    }
+
+    if (! isIdentical(info, info_, " info", "info_")) {
+        std::cerr << "CXXLAPACK:  info = " << info << std::endl;
+        std::cerr << "F77LAPACK: info_ = " << info_ << std::endl;
+        failed = true;
+    }
+
+    if (failed) {
+        ASSERT(0);
+    }
+#   endif
+
+    return info;
+}
+
+//-- gtsv [variant if rhs is vector] -------------------------------------------
+
+template <typename VDL, typename VD, typename VDU, typename VB>
+typename RestrictTo<IsDenseVector<VDL>::value
+                 && IsDenseVector<VD>::value
+                 && IsDenseVector<VDU>::value
+                 && IsDenseVector<VB>::value,
+         typename RemoveRef<VD>::Type::IndexType>::Type
+gtsv(VDL &&dl, VD &&d, VDU &&du, VB &&b)
+{
+//
+//  Remove references from rvalue types
+//
+    typedef typename RemoveRef<VB>::Type    VectorB;
+
+    typedef typename VectorB::ElementType        ElementType;
+    typedef typename VectorB::IndexType          IndexType;
+    typedef typename VectorB::Engine::Allocator  Allocator;
+
+    const IndexType n = b.length();
+
+    GeMatrix<FullStorageView<ElementType, ColMajor, IndexOptions<IndexType>,
+                             Allocator> >  B(n, 1, b, n);
+
+    return gtsv(dl, d, du, B);
+}
+
+//-- gtsv [variant for a GbMatrix with unit bandwidths] ------------------------
+
+template <typename MA, typename MB>
+typename RestrictTo<IsGbMatrix<MA>::value
+                 && IsGeMatrix<MB>::value,
+         typename RemoveRef<MA>::Type::IndexType>::Type
+gtsv(MA &&A, MB &&B)
+{
+    typedef typename RemoveRef<MA>::Type::IndexType  IndexType;
+
+    const Underscore<IndexType> _;
+
+    ASSERT(A.numRows()==A.numCols());
+    ASSERT(A.numSubDiags()==1);
+    ASSERT(A.numSuperDiags()==1);
+
+    auto d = A.diag(0);
+
+    if (A.numRows()==1) {
+        return gtsv(d(_(1,0)), d, d(_(1,0)), B);
+    }
+
+    auto dl = A.diag(-1);
+    auto du = A.diag(1);
+
+    return gtsv(dl, d, du, B);
+}
+
+template <typename MA, typename VB>
+typename RestrictTo<IsGbMatrix<MA>::value
+                 && IsDenseVector<VB>::value,
+         typename RemoveRef<MA>::Type::IndexType>::Type
+gtsv(MA &&A, VB &&b)
+{
+    typedef typename RemoveRef<MA>::Type::IndexType  IndexType;
+
+    const Underscore<IndexType> _;
+
+    ASSERT(A.numRows()==A.numCols());
+    ASSERT(A.numSubDiags()==1);
+    ASSERT(A.numSuperDiags()==1);
+
+    auto d = A.diag(0);
+
+    if (A.numRows()==1) {
+        return gtsv(d(_(1,0)), d, d(_(1,0)), b);
+    }
+
+    auto dl = A.diag(-1);
+    auto du = A.diag(1);
+
+    return gtsv(dl, d, du, b);
+}
+
+} } // namespace lapack, flens
+
+#endif // FLENS_LAPACK_GT_GTSV_TCC
@@ -475,10 +475,8 @@ ev(bool     computeV,
 //
 //  Remove references from rvalue types
 //
-    typedef typename RemoveRef<MA>::Type::Vector        WorkVector;
-    typedef typename RemoveRef<MA>::Type::ElementType   T;
-    typedef typename ComplexTrait<T>::PrimitiveType     PT;
-    typedef DenseVector<Array<PT> >                     RealWorkVector;
+    typedef typename WorkspaceVector<MA>::Type          WorkVector;
+    typedef typename WorkspaceVector<MA>::RealType      RealWorkVector;
 
     WorkVector      work;
     RealWorkVector  rWork;
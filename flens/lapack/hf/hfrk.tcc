@@ -0,0 +1,225 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* Based on
+ *
+       SUBROUTINE ZHFRK( TRANSR, UPLO, TRANS, N, K, ALPHA, A, LDA, BETA,
+      $                  C )
+ *
+ *  -- LAPACK routine (version 3.3.1) --
+ *  -- LAPACK is a software package provided by Univ. of Tennessee,    --
+ *  -- Univ. of California Berkeley, Univ. of Colorado Denver and NAG Ltd..--
+ *  -- April 2011
+ */
+
+#ifndef FLENS_LAPACK_HF_HFRK_TCC
+#define FLENS_LAPACK_HF_HFRK_TCC 1
+
+#include <flens/blas/blas.h>
+#include <flens/lapack/lapack.h>
+
+namespace flens { namespace lapack {
+
+//== generic lapack implementation =============================================
+
+namespace generic {
+
+//-- hfrk [complex variant] ----------------------------------------------------
+//
+//  With op(A) split into the rows op(A)1 and op(A)2 the diagonal blocks get
+//  updated by herk and the off-diagonal block by gemm:
+//
+//      C11 := alpha*op(A)1*op(A)1^H + beta*C11,
+//      C12 := alpha*op(A)1*op(A)2^H + beta*C12,
+//      C22 := alpha*op(A)2*op(A)2^H + beta*C22.
+//
+template <typename ALPHA, typename MA, typename BETA, typename MC>
+void
+hfrk_impl(Transpose trans, const ALPHA &alpha, const GeMatrix<MA> &A,
+          const BETA &beta, HfMatrix<MC> &C)
+{
+    typedef typename HfMatrix<MC>::ElementType        T;
+    typedef typename HfMatrix<MC>::IndexType          IndexType;
+    typedef typename HfMatrix<MC>::Engine::BlockView  BlockView;
+
+    const Underscore<IndexType> _;
+
+    const bool        noTrans = (trans==NoTrans);
+    const StorageUpLo upLo    = C.upLo();
+    const IndexType   n       = C.dim();
+    const IndexType   k       = (noTrans) ? A.numCols() : A.numRows();
+
+//
+//  Quick return if possible
+//
+    if (n==0 || ((alpha==ALPHA(0) || k==0) && beta==BETA(1))) {
+        return;
+    }
+    if (alpha==ALPHA(0) && beta==BETA(0)) {
+        C.fill(T(0));
+        return;
+    }
+
+    HeMatrix<BlockView>  C11(C.engine().viewBlock(upLo, RfpDiag1),
+                             rfpUpLo(C, RfpDiag1));
+    HeMatrix<BlockView>  C22(C.engine().viewBlock(upLo, RfpDiag2),
+                             rfpUpLo(C, RfpDiag2));
+    GeMatrix<BlockView>  B(C.engine().viewBlock(upLo, RfpOffDiag));
+
+    const IndexType n1  = C11.dim();
+    const IndexType n2  = C22.dim();
+    const bool      ctB = rfpConjTrans(C, RfpOffDiag);
+
+    const auto A1 = (noTrans) ? A(_(1,n1),_) : A(_,_(1,n1));
+    const auto A2 = (noTrans) ? A(_(n1+1,n),_) : A(_,_(n1+1,n));
+
+//
+//  For n==1 one of the diagonal blocks is empty
+//
+    if (n1>0) {
+        blas::rk(trans, alpha, A1, beta, C11);
+    }
+    if (n2>0) {
+        blas::rk(trans, alpha, A2, beta, C22);
+    }
+//
+//  B holds C12 or C12^H = C21
+//
+    if (n1>0 && n2>0) {
+        blas::mm(noTrans ? NoTrans : ConjTrans, noTrans ? ConjTrans : NoTrans,
+                 T(alpha), ctB ? A2 : A1, ctB ? A1 : A2, T(beta), B);
+    }
+}
+
+} // namespace generic
+
+//== interface for native lapack ===============================================
+
+#ifdef USE_CXXLAPACK
+
+namespace external {
+
+//-- hfrk [complex variant] ----------------------------------------------------
+
+template <typename ALPHA, typename MA, typename BETA, typename MC>
+void
+hfrk_impl(Transpose trans, const ALPHA &alpha, const GeMatrix<MA> &A,
+          const BETA &beta, HfMatrix<MC> &C)
+{
+    typedef typename HfMatrix<MC>::ElementType        T;
+    typedef typename ComplexTrait<T>::PrimitiveType   PT;
+    typedef typename HfMatrix<MC>::IndexType          IndexType;
+
+    const char      transR = (C.order()==ColMajor) ? 'N' : 'C';
+    const IndexType k      = (trans==NoTrans) ? A.numCols() : A.numRows();
+
+    cxxlapack::hfrk<IndexType>(transR,
+                               getF77Char(C.upLo()),
+                               getF77Char(trans),
+                               C.dim(),
+                               k,
+                               PT(alpha),
+                               A.data(),
+                               A.leadingDimension(),
+                               PT(beta),
+                               C.data());
+}
+
+} // namespace external
+
+#endif // USE_CXXLAPACK
+
+//== public interface ==========================================================
+
+template <typename ALPHA, typename MA, typename BETA, typename MC>
+typename RestrictTo<IsComplexGeMatrix<MA>::value
+                 && IsHfMatrix<MC>::value,
+         void>::Type
+hfrk(Transpose trans, const ALPHA &alpha, const MA &A,
+     const BETA &beta, MC &&C)
+{
+    LAPACK_DEBUG_OUT("hfrk [complex]");
+
+//
+//  Remove references from rvalue types
+//
+#   ifdef CHECK_CXXLAPACK
+    typedef typename RemoveRef<MC>::Type    MatrixC;
+#   endif
+
+//
+//  Test the input parameters
+//
+    ASSERT(trans==NoTrans || trans==ConjTrans);
+    ASSERT(C.indexBase()==1);
+    ASSERT(A.firstRow()==1);
+    ASSERT(A.firstCol()==1);
+    ASSERT(C.dim()==((trans==NoTrans) ? A.numRows() : A.numCols()));
+
+#   ifdef CHECK_CXXLAPACK
+//
+//  Make copies of output arguments
+//
+    typename MatrixC::NoView  C_org = C;
+#   endif
+
+//
+//  Call implementation
+//
+    LAPACK_SELECT::hfrk_impl(trans, alpha, A, beta, C);
+
+#   ifdef CHECK_CXXLAPACK
+//
+//  Compare results
+//
+    typename MatrixC::NoView  C_generic = C;
+
+    C = C_org;
+
+    external::hfrk_impl(trans, alpha, A, beta, C);
+
+    bool failed = false;
+    if (! isIdentical(C_generic, C, "C_generic", "C")) {
+        std::cerr << "CXXLAPACK: C_generic = " << C_generic << std::endl;
+        std::cerr << "F77LAPACK: C = " << C << std::endl;
+        failed = true;
+    }
+
+    if (failed) {
+        ASSERT(0);
+    }
+#   endif
+}
+
+} } // namespace lapack, flens
+
+#endif // FLENS_LAPACK_HF_HFRK_TCC
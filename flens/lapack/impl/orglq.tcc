@@ -334,7 +334,7 @@ typename RestrictTo<IsRealGeMatrix<MA>::value
          void>::Type
 orglq(MA &&A, const VTAU &tau)
 {
-    typedef typename RemoveRef<MA>::Type::Vector  WorkVector;
+    typedef typename WorkspaceVector<MA>::Type    WorkVector;
 
     WorkVector  work;
     orglq(A, tau, work);
@@ -332,7 +332,7 @@ typename RestrictTo<IsRealGeMatrix<MA>::value
          void>::Type
 orgqr(MA &&A, const VTAU &tau)
 {
-    typedef typename RemoveRef<MA>::Type::Vector  WorkVector;
+    typedef typename WorkspaceVector<MA>::Type    WorkVector;
 
     WorkVector  work;
     orgqr(A, tau, work);
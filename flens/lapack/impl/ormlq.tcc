@@ -460,7 +460,7 @@ ormlq(Side         side,
       const VTAU   &tau,
       MC           &&C)
 {
-    typedef typename RemoveRef<MA>::Type::Vector  WorkVector;
+    typedef typename WorkspaceVector<MA>::Type    WorkVector;
 
     WorkVector  work;
     ormlq(side, trans, A, tau, C, work);
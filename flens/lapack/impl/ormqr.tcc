@@ -462,7 +462,7 @@ ormqr(Side         side,
       const VTAU   &tau,
       MC           &&C)
 {
-    typedef typename RemoveRef<MA>::Type::Vector  WorkVector;
+    typedef typename WorkspaceVector<MA>::Type    WorkVector;
 
     WorkVector  work;
     ormqr(side, trans, A, tau, C, work);
@@ -342,7 +342,7 @@ typename RestrictTo<IsComplexGeMatrix<MA>::value
          void>::Type
 unglq(MA &&A, const VTAU &tau)
 {
-    typedef typename RemoveRef<MA>::Type::Vector  WorkVector;
+    typedef typename WorkspaceVector<MA>::Type    WorkVector;
 
     WorkVector  work;
     unglq(A, tau, work);
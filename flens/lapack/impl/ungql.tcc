@@ -334,7 +334,7 @@ typename RestrictTo<IsComplexGeMatrix<MA>::value
          void>::Type
 ungql(MA &&A, const VTAU &tau)
 {
-    typedef typename RemoveRef<MA>::Type::Vector  WorkVector;
+    typedef typename WorkspaceVector<MA>::Type    WorkVector;
 
     WorkVector  work;
     ungql(A, tau, work);
@@ -336,7 +336,7 @@ typename RestrictTo<IsComplexGeMatrix<MA>::value
          void>::Type
 ungqr(MA &&A, const VTAU &tau)
 {
-    typedef typename RemoveRef<MA>::Type::Vector  WorkVector;
+    typedef typename WorkspaceVector<MA>::Type    WorkVector;
 
     WorkVector  work;
     ungqr(A, tau, work);
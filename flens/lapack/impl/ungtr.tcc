@@ -277,7 +277,7 @@ typename RestrictTo<IsHeMatrix<MA>::value
          void>::Type
 ungtr(MA &&A, const VTAU &tau)
 {
-    typedef typename RemoveRef<MA>::Type::Vector  WorkVector;
+    typedef typename WorkspaceVector<MA>::Type    WorkVector;
 
     WorkVector  work;
     ungtr(A, tau, work);
@@ -466,7 +466,7 @@ unmlq(Side         side,
       const VTAU   &tau,
       MC           &&C)
 {
-    typedef typename RemoveRef<MA>::Type::Vector WorkVector;
+    typedef typename WorkspaceVector<MA>::Type WorkVector;
 
     WorkVector  work;
     unmlq(side, trans, A, tau, C, work);
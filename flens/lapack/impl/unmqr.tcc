@@ -464,7 +464,7 @@ unmqr(Side         side,
       const VTAU   &tau,
       MC           &&C)
 {
-    typedef typename RemoveRef<MA>::Type::Vector WorkVector;
+    typedef typename WorkspaceVector<MA>::Type WorkVector;
 
     WorkVector  work;
     unmqr(side, trans, A, tau, C, work);
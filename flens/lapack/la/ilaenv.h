@@ -49,6 +49,10 @@
 namespace flens { namespace lapack {
 
 //-- ilaenv --------------------------------------------------------------------
+//
+//  For spec 1, 2 and 3 values stored in IlaenvTuning override the builtin
+//  defaults (see flens/lapack/la/ilaenvtuning.h).
+//
 template <typename T>
     int
     ilaenv(int spec, const char *name, const char *opts,
@@ -52,6 +52,7 @@
 #include <cxxstd/cstring.h>
 
 #include <flens/auxiliary/auxiliary.h>
+#include <flens/lapack/la/ilaenvtuning.h>
 #include <flens/lapack/lapack.h>
 
 namespace flens { namespace lapack {
@@ -500,6 +501,12 @@ ilaenv(int spec, const char *name, const char *opts,
        int n1, int n2, int n3, int n4)
 {
     int info;
+//
+//  Tuned block sizes and crossover points take precedence over the defaults
+//
+    if (spec>=1 && spec<=3 && IlaenvTuning::get<T>(spec, name, info)) {
+        return info;
+    }
 #if defined USE_ILAENV_WITH_UNDERSCORE
     info = ilaenv_LapackTest<T>(spec, name, opts, n1, n2, n3, n4);
 #else
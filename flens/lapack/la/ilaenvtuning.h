@@ -0,0 +1,111 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FLENS_LAPACK_LA_ILAENVTUNING_H
+#define FLENS_LAPACK_LA_ILAENVTUNING_H 1
+
+#include <cxxstd/map.h>
+#include <cxxstd/string.h>
+
+//
+//  Table of tuned ilaenv values.  Entries are keyed by element type, routine
+//  name (as passed to ilaenv, e.g. "GETRF") and spec:
+//
+//      spec = 1: optimal block size
+//      spec = 2: minimal block size
+//      spec = 3: crossover point
+//
+//  ilaenv consults the table first and only falls back to the builtin
+//  defaults if no entry is found.  Entries can be set with
+//  IlaenvTuning::set<T>(...) or read from a tuning file with
+//  IlaenvTuning::load(...).  On first use the file given by the environment
+//  variable FLENS_ILAENV_CONFIG is loaded (if set).
+//
+//  A tuning file contains lines "<type> <name> <spec> <value>" where type is
+//  one of S, D, C, Z; '#' starts a comment.  For example
+//
+//      D GETRF 1 128
+//      Z GEQRF 3 96
+//
+//  flens/examples/lapack-ilaenv-tune.cc benchmarks the blocked routines on
+//  the target machine and writes such a file.
+//
+
+namespace flens { namespace lapack {
+
+class IlaenvTuning
+{
+    public:
+        template <typename T>
+            static void
+            set(int spec, const char *name, int value);
+
+        template <typename T>
+            static bool
+            get(int spec, const char *name, int &value);
+
+        template <typename T>
+            static void
+            remove(int spec, const char *name);
+
+        static void
+        clear();
+
+        static bool
+        load(const char *filename);
+
+        static bool
+        save(const char *filename);
+
+        template <typename T>
+            static char
+            typeChar();
+
+    private:
+        typedef std::map<std::string, int>  Table;
+
+        static Table &
+        table_();
+
+        static bool
+        init_(Table &table);
+
+        static bool
+        read_(const char *filename, Table &table);
+
+        static std::string
+        key_(char type, const char *name, int spec);
+};
+
+} } // namespace lapack, flens
+
+#endif // FLENS_LAPACK_LA_ILAENVTUNING_H
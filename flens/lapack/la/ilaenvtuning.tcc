@@ -0,0 +1,176 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FLENS_LAPACK_LA_ILAENVTUNING_TCC
+#define FLENS_LAPACK_LA_ILAENVTUNING_TCC 1
+
+#include <cxxstd/complex.h>
+#include <cxxstd/cstdlib.h>
+#include <cxxstd/fstream.h>
+#include <cxxstd/sstream.h>
+#include <flens/auxiliary/auxiliary.h>
+#include <flens/lapack/la/ilaenvtuning.h>
+
+namespace flens { namespace lapack {
+
+template <typename T>
+void
+IlaenvTuning::set(int spec, const char *name, int value)
+{
+    table_()[key_(typeChar<T>(), name, spec)] = value;
+}
+
+template <typename T>
+bool
+IlaenvTuning::get(int spec, const char *name, int &value)
+{
+    const Table &table = table_();
+    if (table.empty()) {
+        return false;
+    }
+    Table::const_iterator it = table.find(key_(typeChar<T>(), name, spec));
+    if (it==table.end()) {
+        return false;
+    }
+    value = it->second;
+    return true;
+}
+
+template <typename T>
+void
+IlaenvTuning::remove(int spec, const char *name)
+{
+    table_().erase(key_(typeChar<T>(), name, spec));
+}
+
+inline void
+IlaenvTuning::clear()
+{
+    table_().clear();
+}
+
+inline bool
+IlaenvTuning::load(const char *filename)
+{
+    return read_(filename, table_());
+}
+
+inline bool
+IlaenvTuning::save(const char *filename)
+{
+    std::ofstream out(filename);
+    if (!out) {
+        return false;
+    }
+    out << "# flens::lapack::ilaenv tuning table" << std::endl;
+    out << "# <type> <name> <spec> <value>" << std::endl;
+
+    const Table &table = table_();
+    for (Table::const_iterator it=table.begin(); it!=table.end(); ++it) {
+        out << it->first << " " << it->second << std::endl;
+    }
+    return true;
+}
+
+template <typename T>
+char
+IlaenvTuning::typeChar()
+{
+    using std::complex;
+
+    if (IsSame<T,float>::value) {
+        return 'S';
+    } else if (IsSame<T,double>::value) {
+        return 'D';
+    } else if (IsSame<T,complex<float> >::value) {
+        return 'C';
+    } else if (IsSame<T,complex<double> >::value) {
+        return 'Z';
+    }
+    return 'X';
+}
+
+inline IlaenvTuning::Table &
+IlaenvTuning::table_()
+{
+    static Table table;
+    static bool  initialized = init_(table);
+
+    FAKE_USE(initialized);
+    return table;
+}
+
+inline bool
+IlaenvTuning::init_(Table &table)
+{
+    const char *config = std::getenv("FLENS_ILAENV_CONFIG");
+    if (config) {
+        read_(config, table);
+    }
+    return true;
+}
+
+inline bool
+IlaenvTuning::read_(const char *filename, Table &table)
+{
+    std::ifstream in(filename);
+    if (!in) {
+        return false;
+    }
+
+    std::string line;
+    while (std::getline(in, line)) {
+        line = line.substr(0, line.find('#'));
+
+        std::istringstream  fields(line);
+        std::string         type, name;
+        int                 spec, value;
+
+        if (!(fields >> type >> name >> spec >> value) || type.size()!=1) {
+            continue;
+        }
+        table[key_(type[0], name.c_str(), spec)] = value;
+    }
+    return true;
+}
+
+inline std::string
+IlaenvTuning::key_(char type, const char *name, int spec)
+{
+    std::ostringstream key;
+    key << type << " " << name << " " << spec;
+    return key.str();
+}
+
+} } // namespace lapack, flens
+
+#endif // FLENS_LAPACK_LA_ILAENVTUNING_TCC
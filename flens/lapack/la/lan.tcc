@@ -122,8 +122,17 @@ lan_impl(Norm norm, const GeMatrix<MA> &A, DenseVector<VWORK> &work)
 //
         T scale = Zero;
         T sum = One;
-        for (IndexType j=1; j<=n; ++j) {
-            lassq(A(_,j), scale, sum);
+//
+//      Without gaps between the columns (or rows) all elements get summed
+//      up in one sweep.
+//
+        const IndexType ld = (A.order()==ColMajor) ? m : n;
+        if (A.leadingDimension()==ld) {
+            lassq(A.vectorView(), scale, sum);
+        } else {
+            for (IndexType j=1; j<=n; ++j) {
+                lassq(A(_,j), scale, sum);
+            }
         }
         return scale*sqrt(sum);
     }
@@ -44,6 +44,8 @@
 #define FLENS_LAPACK_LA_LASSQ_TCC 1
 
 #include <cxxstd/cmath.h>
+#include <cxxstd/limits.h>
+#include <cxxblas/cxxblas.h>
 #include <flens/blas/blas.h>
 #include <flens/lapack/lapack.h>
 
@@ -57,26 +59,11 @@ template <typename VX, typename T>
 void
 lassq_impl(const DenseVector<VX> &x, T &scale, T &sumsq)
 {
-    using std::abs;
-    using cxxblas::pow;
-
-    typedef typename DenseVector<VX>::IndexType IndexType;
-
-    const IndexType n = x.length();
-
-    if (n>0) {
-        for (IndexType i=1; i<=n; ++i) {
-            if (x(i)!=T(0)) {
-                const T absXi = abs(x(i));
-                if (scale<absXi) {
-                    sumsq = 1 + sumsq*pow(scale/absXi, 2);
-                    scale = absXi;
-                } else {
-                    sumsq += pow(absXi/scale, 2);
-                }
-            }
-        }
-    }
+//
+//  Blue's algorithm (as in LAPACK 3.10) for IEEE types, the classic
+//  scaling otherwise
+//
+    cxxblas::nrm2_sumsq(x.length(), x.data(), x.stride(), scale, sumsq);
 }
 
 } // namespace generic
@@ -130,16 +117,23 @@ lassq(const DenseVector<VX> &x, T &scale, T &sumsq)
 //
     external::lassq_impl(x, scale_, sumsq_);
 
-    bool failed = false;
-    if (! isIdentical(scale, scale_, " scale", "scale_")) {
-        std::cerr << "CXXLAPACK:  scale = " << scale << std::endl;
-        std::cerr << "F77LAPACK: scale_ = " << scale_ << std::endl;
-        failed = true;
-    }
+//
+//  Scaling and summation order may differ from the reference
+//  implementation.  So only the represented norms get compared.
+//
+    using std::abs;
+    using std::sqrt;
+
+    const T norm  = scale*sqrt(sumsq);
+    const T norm_ = scale_*sqrt(sumsq_);
+    const T eps   = std::numeric_limits<T>::epsilon();
 
-    if (! isIdentical(sumsq, sumsq_, " sumsq", "sumsq_")) {
-        std::cerr << "CXXLAPACK:  sumsq = " << sumsq << std::endl;
-        std::cerr << "F77LAPACK: sumsq_ = " << sumsq_ << std::endl;
+    bool failed = false;
+    if (abs(norm-norm_)>(x.length()+1)*eps*norm_) {
+        std::cerr << "CXXLAPACK:  scale = " << scale
+                  << ", sumsq = " << sumsq << std::endl;
+        std::cerr << "F77LAPACK: scale_ = " << scale_
+                  << ", sumsq_ = " << sumsq_ << std::endl;
         failed = true;
     }
 
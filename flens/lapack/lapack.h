@@ -65,9 +65,12 @@
 
 #include <flens/lapack/auxiliary/getf77char.h>
 #include <flens/lapack/auxiliary/nint.h>
+#include <flens/lapack/auxiliary/rfp.h>
 #include <flens/lapack/auxiliary/sign.h>
+#include <flens/lapack/auxiliary/workspacevector.h>
 
 #include <flens/lapack/debug/hex.h>
+#include <flens/lapack/debug/isclose.h>
 #include <flens/lapack/debug/isidentical.h>
 
 #include <flens/lapack/gb/sv.h>
@@ -107,6 +110,8 @@
 #include <flens/lapack/ge/tri.h>
 #include <flens/lapack/ge/trs.h>
 
+#include <flens/lapack/gt/gtsv.h>
+
 #include <flens/lapack/hb/ev.h>
 
 #include <flens/lapack/he/ev.h>
@@ -117,6 +122,8 @@
 #include <flens/lapack/he/tri.h>
 #include <flens/lapack/he/trs.h>
 
+#include <flens/lapack/hf/hfrk.h>
+
 #include <flens/lapack/hp/ev.h>
 #include <flens/lapack/hp/sv.h>
 #include <flens/lapack/hp/trf.h>
@@ -162,6 +169,7 @@
 #include <flens/lapack/impl/unmrz.h>
 
 #include <flens/lapack/la/ilaenv.h>
+#include <flens/lapack/la/ilaenvtuning.h>
 #include <flens/lapack/la/ilalc.h>
 #include <flens/lapack/la/ilalr.h>
 #include <flens/lapack/la/labad.h>
@@ -212,9 +220,14 @@
 #include <flens/lapack/la/lauum.h>
 
 #include <flens/lapack/pb/pbsv.h>
+#include <flens/lapack/pb/pbtf2.h>
 #include <flens/lapack/pb/pbtrf.h>
 #include <flens/lapack/pb/pbtrs.h>
 
+#include <flens/lapack/pf/pftrf.h>
+#include <flens/lapack/pf/pftri.h>
+#include <flens/lapack/pf/pftrs.h>
+
 #include <flens/lapack/po/pocon.h>
 #include <flens/lapack/po/posv.h>
 #include <flens/lapack/po/potf2.h>
@@ -222,7 +235,12 @@
 #include <flens/lapack/po/potri.h>
 #include <flens/lapack/po/potrs.h>
 
+#include <flens/lapack/pt/ptsv.h>
+#include <flens/lapack/pt/pttrf.h>
+#include <flens/lapack/pt/pttrs.h>
+
 #include <flens/lapack/sb/ev.h>
+#include <flens/lapack/sf/sfrk.h>
 #include <flens/lapack/sp/ev.h>
 #include <flens/lapack/sp/sv.h>
 #include <flens/lapack/sp/trf.h>
@@ -237,12 +255,18 @@
 
 #include <flens/lapack/tb/trs.h>
 
+#include <flens/lapack/tf/tftri.h>
+#include <flens/lapack/tf/tfttp.h>
+#include <flens/lapack/tf/tfttr.h>
+
+#include <flens/lapack/tp/tpttf.h>
 #include <flens/lapack/tp/tri.h>
 #include <flens/lapack/tp/trs.h>
 
 #include <flens/lapack/tr/ti2.h>
 #include <flens/lapack/tr/tri.h>
 #include <flens/lapack/tr/trs.h>
+#include <flens/lapack/tr/trttf.h>
 
 #include <flens/lapack/typedefs.h>
 
@@ -39,9 +39,11 @@
 
 #include <flens/lapack/auxiliary/getf77char.tcc>
 #include <flens/lapack/auxiliary/nint.tcc>
+#include <flens/lapack/auxiliary/rfp.tcc>
 #include <flens/lapack/auxiliary/sign.tcc>
 
 #include <flens/lapack/debug/hex.tcc>
+#include <flens/lapack/debug/isclose.tcc>
 #include <flens/lapack/debug/isidentical.tcc>
 
 #include <flens/lapack/gb/sv.tcc>
@@ -81,6 +83,8 @@
 #include <flens/lapack/ge/tri.tcc>
 #include <flens/lapack/ge/trs.tcc>
 
+#include <flens/lapack/gt/gtsv.tcc>
+
 #include <flens/lapack/hb/ev.tcc>
 
 #include <flens/lapack/he/ev.tcc>
@@ -91,6 +95,8 @@
 #include <flens/lapack/he/tri.tcc>
 #include <flens/lapack/he/trs.tcc>
 
+#include <flens/lapack/hf/hfrk.tcc>
+
 #include <flens/lapack/hp/ev.tcc>
 #include <flens/lapack/hp/sv.tcc>
 #include <flens/lapack/hp/trf.tcc>
@@ -136,6 +142,7 @@
 #include <flens/lapack/impl/unmrz.tcc>
 
 #include <flens/lapack/la/ilaenv.tcc>
+#include <flens/lapack/la/ilaenvtuning.tcc>
 #include <flens/lapack/la/ilalc.tcc>
 #include <flens/lapack/la/ilalr.tcc>
 #include <flens/lapack/la/labad.tcc>
@@ -186,9 +193,14 @@
 #include <flens/lapack/la/lauum.tcc>
 
 #include <flens/lapack/pb/pbsv.tcc>
+#include <flens/lapack/pb/pbtf2.tcc>
 #include <flens/lapack/pb/pbtrf.tcc>
 #include <flens/lapack/pb/pbtrs.tcc>
 
+#include <flens/lapack/pf/pftrf.tcc>
+#include <flens/lapack/pf/pftri.tcc>
+#include <flens/lapack/pf/pftrs.tcc>
+
 #include <flens/lapack/po/pocon.tcc>
 #include <flens/lapack/po/posv.tcc>
 #include <flens/lapack/po/potf2.tcc>
@@ -196,8 +208,14 @@
 #include <flens/lapack/po/potri.tcc>
 #include <flens/lapack/po/potrs.tcc>
 
+#include <flens/lapack/pt/ptsv.tcc>
+#include <flens/lapack/pt/pttrf.tcc>
+#include <flens/lapack/pt/pttrs.tcc>
+
 #include <flens/lapack/sb/ev.tcc>
 
+#include <flens/lapack/sf/sfrk.tcc>
+
 #include <flens/lapack/sp/ev.tcc>
 #include <flens/lapack/sp/sv.tcc>
 #include <flens/lapack/sp/trf.tcc>
@@ -212,11 +230,17 @@
 
 #include <flens/lapack/tb/trs.tcc>
 
+#include <flens/lapack/tf/tftri.tcc>
+#include <flens/lapack/tf/tfttp.tcc>
+#include <flens/lapack/tf/tfttr.tcc>
+
+#include <flens/lapack/tp/tpttf.tcc>
 #include <flens/lapack/tp/tri.tcc>
 #include <flens/lapack/tp/trs.tcc>
 
 #include <flens/lapack/tr/ti2.tcc>
 #include <flens/lapack/tr/tri.tcc>
 #include <flens/lapack/tr/trs.tcc>
+#include <flens/lapack/tr/trttf.tcc>
 
 #endif // FLENS_LAPACK_LAPACK_TCC
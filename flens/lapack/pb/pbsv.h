@@ -49,16 +49,13 @@
 
 namespace flens { namespace lapack {
 
-
-#ifdef USE_CXXLAPACK
-
 //== pbsv ======================================================================
 //
 //  Real and complex variant
 //
 template <typename MA, typename MB>
-    typename RestrictTo<(IsSbMatrix<MA>::value || IsHbMatrix<MA>::value)
-                     && IsComplexGeMatrix<MB>::value,
+    typename RestrictTo<(IsRealSbMatrix<MA>::value || IsHbMatrix<MA>::value)
+                     && IsGeMatrix<MB>::value,
              typename RemoveRef<MA>::Type::IndexType>::Type
     pbsv(MA &&A, MB &&B);
 
@@ -67,14 +64,11 @@ template <typename MA, typename MB>
 //  Real and complex variant
 //
 template <typename MA, typename VB>
-    typename RestrictTo<(IsSbMatrix<MA>::value || IsHbMatrix<MA>::value)
+    typename RestrictTo<(IsRealSbMatrix<MA>::value || IsHbMatrix<MA>::value)
                      && IsDenseVector<VB>::value,
              typename RemoveRef<MA>::Type::IndexType>::Type
     pbsv(MA &&A, VB &&b);
 
-#endif // USE_CXXLAPACK
-
-
 } } // namespace lapack, flens
 
 #endif // FLENS_LAPACK_PB_PBSV_H
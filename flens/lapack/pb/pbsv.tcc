@@ -50,6 +50,53 @@
 
 namespace flens { namespace lapack {
 
+//== generic lapack implementation =============================================
+
+namespace generic {
+
+//-- pbsv [real variant] -------------------------------------------------------
+
+template <typename MA, typename MB>
+typename SbMatrix<MA>::IndexType
+pbsv_impl(SbMatrix<MA> &A, GeMatrix<MB> &B)
+{
+    typedef typename SbMatrix<MA>::IndexType  IndexType;
+//
+//  Compute the Cholesky factorization A = U**T*U or A = L*L**T.
+//
+    IndexType info = pbtrf(A);
+    if (info==0) {
+//
+//      Solve the system A*X = B, overwriting B with X.
+//
+        pbtrs(A, B);
+    }
+    return info;
+}
+
+//-- pbsv [complex variant] ----------------------------------------------------
+
+template <typename MA, typename MB>
+typename HbMatrix<MA>::IndexType
+pbsv_impl(HbMatrix<MA> &A, GeMatrix<MB> &B)
+{
+    typedef typename HbMatrix<MA>::IndexType  IndexType;
+//
+//  Compute the Cholesky factorization A = U**H*U or A = L*L**H.
+//
+    IndexType info = pbtrf(A);
+    if (info==0) {
+//
+//      Solve the system A*X = B, overwriting B with X.
+//
+        pbtrs(A, B);
+    }
+    return info;
+}
+
+} // namespace generic
+
+//== interface for native lapack ===============================================
 
 #ifdef USE_CXXLAPACK
 
@@ -97,18 +144,19 @@ pbsv_impl(HbMatrix<MA> &A, GeMatrix<MB> &B)
 
 } // namespace external
 
+#endif // USE_CXXLAPACK
+
+//== public interface ==========================================================
+
+//-- pbsv [real/complex variant] -----------------------------------------------
 
-//== pbsv =====================================================================
-//
-//  Real and complex variant
-//
 template <typename MA, typename MB>
-typename RestrictTo<(IsSbMatrix<MA>::value || IsHbMatrix<MA>::value)
+typename RestrictTo<(IsRealSbMatrix<MA>::value || IsHbMatrix<MA>::value)
                  && IsGeMatrix<MB>::value,
          typename RemoveRef<MA>::Type::IndexType>::Type
 pbsv(MA &&A, MB &&B)
 {
-    LAPACK_DEBUG_OUT("pbsv [complex]");
+    LAPACK_DEBUG_OUT("pbsv [real/complex]");
 
 //
 //  Remove references from rvalue types
@@ -119,29 +167,63 @@ pbsv(MA &&A, MB &&B)
 //
 //  Test the input parameters
 //
-#   ifndef NDEBUG
     ASSERT(A.firstIndex()==1);
-
     ASSERT(B.firstRow()==1);
     ASSERT(B.firstCol()==1);
-
     ASSERT(B.numRows()==A.dim());
+
+#   ifdef CHECK_CXXLAPACK
+//
+//  Make copies of output arguments
+//
+    typedef typename RemoveRef<MB>::Type    MatrixB;
+
+    typename MatrixA::NoView  A_   = A;
+    typename MatrixB::NoView  B_   = B;
 #   endif
 
 //
 //  Call implementation
 //
-    const IndexType info = external::pbsv_impl(A, B);
+    const IndexType info = LAPACK_SELECT::pbsv_impl(A, B);
+
+#   ifdef CHECK_CXXLAPACK
+//
+//  Compare results
+//
+    const IndexType info_ = external::pbsv_impl(A_, B_);
+
+    bool failed = false;
+    if (! isIdentical(A, A_, " A", "A_")) {
+        std::cerr << "CXXLAPACK:  A = " << A << std::endl;
+        std::cerr << "F77LAPACK: A_ = " << A_ << std::endl;
+        failed = true;
+    }
+
+    if (! isIdentical(B, B_, " B", "B_")) {
+        std::cerr << "CXXLAPACK:  B = " << B << std::endl;
+        std::cerr << "F77LAPACK: B_ = " << B_ << std::endl;
+        failed = true;
+    }
+
+    if (! isIdentical(info, info_, " info", "info_")) {
+        std::cerr << "CXXLAPACK:  info = " << info << std::endl;
+        std::cerr << "F77LAPACK: info_ = " << info_ << std::endl;
+        failed = true;
+    }
+
+    if (failed) {
+        ASSERT(0);
+    }
+#   endif
 
     return info;
 }
 
-//== pbsv variant if rhs is vector =============================================
-//
-//  Real and complex variant
-//
+//-- pbsv [variant if rhs is vector] -------------------------------------------
+
 template <typename MA, typename VB>
-typename RestrictTo<(IsSbMatrix<MA>::value || IsHbMatrix<MA>::value)
+typename RestrictTo<(IsRealSbMatrix<MA>::value || IsHbMatrix<MA>::value)
                  && IsDenseVector<VB>::value,
          typename RemoveRef<MA>::Type::IndexType>::Type
 pbsv(MA &&A, VB &&b)
@@ -163,9 +245,6 @@ pbsv(MA &&A, VB &&b)
     return pbsv(A, B);
 }
 
-#endif // USE_CXXLAPACK
-
-
 } } // namespace lapack, flens
 
 #endif // FLENS_LAPACK_PB_PBSV_TCC
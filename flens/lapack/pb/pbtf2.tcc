@@ -0,0 +1,369 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* Based on
+ *
+       SUBROUTINE DPBTF2( UPLO, N, KD, AB, LDAB, INFO )
+       SUBROUTINE ZPBTF2( UPLO, N, KD, AB, LDAB, INFO )
+ *
+ *  -- LAPACK routine (version 3.2) --
+ *  -- LAPACK is a software package provided by Univ. of Tennessee,    --
+ *  -- Univ. of California Berkeley, Univ. of Colorado Denver and NAG Ltd..--
+ *     November 2006
+ */
+
+#ifndef FLENS_LAPACK_PB_PBTF2_TCC
+#define FLENS_LAPACK_PB_PBTF2_TCC 1
+
+#include <cxxstd/algorithm.h>
+#include <cxxstd/cmath.h>
+#include <flens/blas/blas.h>
+#include <flens/lapack/lapack.h>
+
+namespace flens { namespace lapack {
+
+//== generic lapack implementation =============================================
+
+namespace generic {
+
+//-- pbtf2 [real variant] ------------------------------------------------------
+
+template <typename MA>
+typename SbMatrix<MA>::IndexType
+pbtf2_impl(SbMatrix<MA> &A)
+{
+    using std::isnan;
+    using std::min;
+    using std::sqrt;
+
+    typedef typename SbMatrix<MA>::ElementType              T;
+    typedef typename SbMatrix<MA>::IndexType                IndexType;
+    typedef typename SbMatrix<MA>::Engine::FullStorageView  FullStorageView;
+    typedef GeMatrix<FullStorageView>                       GeView;
+
+    const Underscore<IndexType> _;
+
+    const IndexType n    = A.dim();
+    const IndexType kd   = A.numOffDiags();
+    const IndexType ldAB = A.leadingDimension();
+    const IndexType kld  = ldAB-1;
+    const bool upper     = (A.upLo()==Upper);
+
+    const T Zero(0), One(1);
+
+    IndexType info = 0;
+//
+//  Quick return if possible
+//
+    if (n==0) {
+        return info;
+    }
+    ASSERT(SbMatrix<MA>::Engine::order==ColMajor);
+
+    GeView AB = FullStorageView(kd+1, n, A.data(), ldAB);
+
+    if (upper) {
+//
+//      Compute the Cholesky factorization A = U**T*U.
+//
+        for (IndexType j=1; j<=n; ++j) {
+//
+//          Compute U(J,J) and test for non-positive-definiteness.
+//
+            T ajj = AB(kd+1,j);
+            if (ajj<=Zero || isnan(ajj)) {
+                info = j;
+                break;
+            }
+            ajj = sqrt(ajj);
+            AB(kd+1,j) = ajj;
+//
+//          Compute elements J+1:J+KN of row J and update the
+//          trailing submatrix within the band.
+//
+            const IndexType kn = min(kd, n-j);
+            if (kn>0) {
+                GeView A12 = FullStorageView(1, kn, &AB(kd,j+1), kld);
+                GeView A22 = FullStorageView(kn, kn, &AB(kd+1,j+1), kld);
+
+                auto a12 = A12(1,_);
+                a12 *= One / ajj;
+                blas::r(-One, a12, A22.upper().symmetric());
+            }
+        }
+    } else {
+//
+//      Compute the Cholesky factorization A = L*L**T.
+//
+        for (IndexType j=1; j<=n; ++j) {
+//
+//          Compute L(J,J) and test for non-positive-definiteness.
+//
+            T ajj = AB(1,j);
+            if (ajj<=Zero || isnan(ajj)) {
+                info = j;
+                break;
+            }
+            ajj = sqrt(ajj);
+            AB(1,j) = ajj;
+//
+//          Compute elements J+1:J+KN of column J and update the
+//          trailing submatrix within the band.
+//
+            const IndexType kn = min(kd, n-j);
+            if (kn>0) {
+                GeView A22 = FullStorageView(kn, kn, &AB(1,j+1), kld);
+
+                auto a21 = AB(_(2,kn+1),j);
+                a21 *= One / ajj;
+                blas::r(-One, a21, A22.lower().symmetric());
+            }
+        }
+    }
+    return info;
+}
+
+//-- pbtf2 [complex variant] ---------------------------------------------------
+
+template <typename MA>
+typename HbMatrix<MA>::IndexType
+pbtf2_impl(HbMatrix<MA> &A)
+{
+    using std::isnan;
+    using std::min;
+    using std::real;
+    using std::sqrt;
+
+    typedef typename HbMatrix<MA>::ElementType              T;
+    typedef typename ComplexTrait<T>::PrimitiveType         PT;
+    typedef typename HbMatrix<MA>::IndexType                IndexType;
+    typedef typename HbMatrix<MA>::Engine::FullStorageView  FullStorageView;
+    typedef GeMatrix<FullStorageView>                       GeView;
+
+    const Underscore<IndexType> _;
+
+    const IndexType n    = A.dim();
+    const IndexType kd   = A.numOffDiags();
+    const IndexType ldAB = A.leadingDimension();
+    const IndexType kld  = ldAB-1;
+    const bool upper     = (A.upLo()==Upper);
+
+    const PT Zero(0), One(1);
+
+    IndexType info = 0;
+//
+//  Quick return if possible
+//
+    if (n==0) {
+        return info;
+    }
+    ASSERT(HbMatrix<MA>::Engine::order==ColMajor);
+
+    GeView AB = FullStorageView(kd+1, n, A.data(), ldAB);
+
+    if (upper) {
+//
+//      Compute the Cholesky factorization A = U**H*U.
+//
+        for (IndexType j=1; j<=n; ++j) {
+//
+//          Compute U(J,J) and test for non-positive-definiteness.
+//
+            PT ajj = real(AB(kd+1,j));
+            if (ajj<=Zero || isnan(ajj)) {
+                AB(kd+1,j) = ajj;
+                info = j;
+                break;
+            }
+            ajj = sqrt(ajj);
+            AB(kd+1,j) = ajj;
+//
+//          Compute elements J+1:J+KN of row J and update the
+//          trailing submatrix within the band.
+//
+            const IndexType kn = min(kd, n-j);
+            if (kn>0) {
+                GeView A12 = FullStorageView(1, kn, &AB(kd,j+1), kld);
+                GeView A22 = FullStorageView(kn, kn, &AB(kd+1,j+1), kld);
+
+                auto a12 = A12(1,_);
+                a12 *= One / ajj;
+                blas::conj(a12);
+                blas::r(-One, a12, A22.upper().hermitian());
+                blas::conj(a12);
+            }
+        }
+    } else {
+//
+//      Compute the Cholesky factorization A = L*L**H.
+//
+        for (IndexType j=1; j<=n; ++j) {
+//
+//          Compute L(J,J) and test for non-positive-definiteness.
+//
+            PT ajj = real(AB(1,j));
+            if (ajj<=Zero || isnan(ajj)) {
+                AB(1,j) = ajj;
+                info = j;
+                break;
+            }
+            ajj = sqrt(ajj);
+            AB(1,j) = ajj;
+//
+//          Compute elements J+1:J+KN of column J and update the
+//          trailing submatrix within the band.
+//
+            const IndexType kn = min(kd, n-j);
+            if (kn>0) {
+                GeView A22 = FullStorageView(kn, kn, &AB(1,j+1), kld);
+
+                auto a21 = AB(_(2,kn+1),j);
+                a21 *= One / ajj;
+                blas::r(-One, a21, A22.lower().hermitian());
+            }
+        }
+    }
+    return info;
+}
+
+} // namespace generic
+
+//== interface for native lapack ===============================================
+
+#ifdef USE_CXXLAPACK
+
+namespace external {
+
+//-- pbtf2 [real variant] ------------------------------------------------------
+
+template <typename MA>
+typename SbMatrix<MA>::IndexType
+pbtf2_impl(SbMatrix<MA> &A)
+{
+    typedef typename SbMatrix<MA>::IndexType  IndexType;
+
+    IndexType info = cxxlapack::pbtf2<IndexType>(getF77Char(A.upLo()),
+                                                 A.dim(),
+                                                 A.numOffDiags(),
+                                                 A.data(),
+                                                 A.leadingDimension());
+    ASSERT(info>=0);
+    return info;
+}
+
+//-- pbtf2 [complex variant] ---------------------------------------------------
+
+template <typename MA>
+typename HbMatrix<MA>::IndexType
+pbtf2_impl(HbMatrix<MA> &A)
+{
+    typedef typename HbMatrix<MA>::IndexType  IndexType;
+
+    IndexType info = cxxlapack::pbtf2<IndexType>(getF77Char(A.upLo()),
+                                                 A.dim(),
+                                                 A.numOffDiags(),
+                                                 A.data(),
+                                                 A.leadingDimension());
+    ASSERT(info>=0);
+    return info;
+}
+
+} // namespace external
+
+#endif // USE_CXXLAPACK
+
+//== public interface ==========================================================
+
+//-- pbtf2 [real/complex variant] ----------------------------------------------
+
+template <typename MA>
+typename RestrictTo<IsRealSbMatrix<MA>::value
+                 || IsHbMatrix<MA>::value,
+         typename RemoveRef<MA>::Type::IndexType>::Type
+pbtf2(MA &&A)
+{
+    LAPACK_DEBUG_OUT("pbtf2 [real/complex]");
+
+//
+//  Remove references from rvalue types
+//
+    typedef typename RemoveRef<MA>::Type    MatrixA;
+    typedef typename MatrixA::IndexType     IndexType;
+
+//
+//  Test the input parameters
+//
+    ASSERT(A.firstIndex()==1);
+
+#   ifdef CHECK_CXXLAPACK
+//
+//  Make copies of output arguments
+//
+    typename MatrixA::NoView       A_      = A;
+#   endif
+
+//
+//  Call implementation
+//
+    const IndexType info = LAPACK_SELECT::pbtf2_impl(A);
+
+#   ifdef CHECK_CXXLAPACK
+//
+//  Compare results
+//
+    const IndexType info_ = external::pbtf2_impl(A_);
+
+    bool failed = false;
+    if (! isIdentical(A, A_, " A", "A_")) {
+        std::cerr << "CXXLAPACK:  A = " << A << std::endl;
+        std::cerr << "F77LAPACK: A_ = " << A_ << std::endl;
+        failed = true;
+    }
+
+    if (! isIdentical(info, info_, " info", "info_")) {
+        std::cerr << "CXXLAPACK:  info = " << info << std::endl;
+        std::cerr << "F77LAPACK: info_ = " << info_ << std::endl;
+        failed = true;
+    }
+
+    if (failed) {
+        ASSERT(0);
+    }
+
+#   endif
+
+    return info;
+}
+
+} } // namespace lapack, flens
+
+#endif // FLENS_LAPACK_PB_PBTF2_TCC
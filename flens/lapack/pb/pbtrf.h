@@ -49,21 +49,16 @@
 
 namespace flens { namespace lapack {
 
-
-#ifdef USE_CXXLAPACK
-
 //== pbtrf =====================================================================
 //
 //  Real and complex variant
 //
 template <typename MA>
-    typename RestrictTo<IsSbMatrix<MA>::value || IsHbMatrix<MA>::value,
+    typename RestrictTo<IsRealSbMatrix<MA>::value
+                     || IsHbMatrix<MA>::value,
              typename RemoveRef<MA>::Type::IndexType>::Type
     pbtrf(MA &&A);
 
-#endif // USE_CXXLAPACK
-
-
 } } // namespace lapack, flens
 
 #endif // FLENS_LAPACK_PB_PBTRF_H
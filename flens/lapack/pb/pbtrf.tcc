@@ -50,6 +50,483 @@
 
 namespace flens { namespace lapack {
 
+//== generic lapack implementation =============================================
+
+namespace generic {
+
+//-- pbtrf [real variant] ------------------------------------------------------
+
+template <typename MA>
+typename SbMatrix<MA>::IndexType
+pbtrf_impl(SbMatrix<MA> &A)
+{
+    using std::min;
+
+    typedef typename SbMatrix<MA>::ElementType              T;
+    typedef typename SbMatrix<MA>::IndexType                IndexType;
+    typedef typename SbMatrix<MA>::Engine::FullStorageView  FullStorageView;
+    typedef GeMatrix<FullStorageView>                       GeView;
+    typedef typename GeView::NoView                         GeNoView;
+
+    const Underscore<IndexType> _;
+
+    const IndexType n    = A.dim();
+    const IndexType kd   = A.numOffDiags();
+    const IndexType ldAB = A.leadingDimension();
+    const IndexType kld  = ldAB-1;
+    const bool upper     = (A.upLo()==Upper);
+
+    const T One(1);
+
+    IndexType info = 0;
+//
+//  Quick return if possible
+//
+    if (n==0) {
+        return info;
+    }
+//
+//  Determine the block size for this environment.  The block size must
+//  not exceed the limit set by the size of the local array Work.
+//
+    const IndexType nbMax = 32;
+
+    const char *upLo = (upper) ? "U" : "L";
+    IndexType nb = ilaenv<T>(1, "PBTRF", upLo, n, kd);
+    nb = min(nb, nbMax);
+
+    if ((nb<=1) || (nb>kd)) {
+//
+//      Use unblocked code.
+//
+        return pbtf2(A);
+    }
+//
+//  Use blocked code.  Tiles of the band are viewed as full storage
+//  matrices with leading dimension ldAB-1.
+//
+    ASSERT(SbMatrix<MA>::Engine::order==ColMajor);
+
+    GeView    AB = FullStorageView(kd+1, n, A.data(), ldAB);
+    GeNoView  Work(nbMax, nbMax);
+
+    if (upper) {
+//
+//      Compute the Cholesky factorization of a symmetric band matrix,
+//      given the upper triangle of the matrix in band storage.
+//
+//      The strictly lower triangle of Work is zero and never touched.
+//
+        for (IndexType i=1; i<=n; i+=nb) {
+            const IndexType ib = min(nb, n-i+1);
+//
+//          Factorize the diagonal block
+//
+            GeView A11 = FullStorageView(ib, ib, &AB(kd+1,i), kld);
+
+            const IndexType iInfo = potf2(A11.upper().symmetric());
+            if (iInfo!=0) {
+                info = i + iInfo - 1;
+                break;
+            }
+            if (i+ib<=n) {
+//
+//              Update the relevant part of the trailing submatrix.
+//              If A11 denotes the diagonal block which has just been
+//              factorized, then we need to update the remaining
+//              blocks in the diagram:
+//
+//                 A11   A12   A13
+//                       A22   A23
+//                             A33
+//
+//              The numbers of rows and columns in the partitioning
+//              are ib, i2, i3 respectively. The blocks A12, A22 and
+//              A23 are empty if ib = kd. The upper triangle of A13
+//              lies outside the band.
+//
+                const IndexType i2 = min(kd-ib, n-i-ib+1);
+                const IndexType i3 = min(ib, n-i-kd+1);
+
+                const auto U11 = A11.upper();
+                GeView A12 = FullStorageView(ib, i2, &AB(kd+1-ib,i+ib), kld);
+
+                if (i2>0) {
+//
+//                  Update A12 and A22
+//
+                    GeView A22 = FullStorageView(i2, i2, &AB(kd+1,i+ib), kld);
+
+                    blas::sm(Left, Trans, One, U11, A12);
+                    blas::rk(Trans, -One, A12, One, A22.upper().symmetric());
+                }
+
+                if (i3>0) {
+//
+//                  Copy the lower triangle of A13 into the work array.
+//
+                    auto A13 = Work(_(1,ib),_(1,i3));
+
+                    for (IndexType jj=1; jj<=i3; ++jj) {
+                        for (IndexType ii=jj; ii<=ib; ++ii) {
+                            A13(ii,jj) = AB(ii-jj+1,jj+i+kd-1);
+                        }
+                    }
+//
+//                  Update A13 (in the work array), A23 and A33.
+//
+                    blas::sm(Left, Trans, One, U11, A13);
+
+                    if (i2>0) {
+                        GeView A23 = FullStorageView(i2, i3, &AB(1+ib,i+kd),
+                                                     kld);
+                        blas::mm(Trans, NoTrans, -One, A12, A13, One, A23);
+                    }
+
+                    GeView A33 = FullStorageView(i3, i3, &AB(kd+1,i+kd), kld);
+                    blas::rk(Trans, -One, A13, One, A33.upper().symmetric());
+//
+//                  Copy the lower triangle of A13 back into place.
+//
+                    for (IndexType jj=1; jj<=i3; ++jj) {
+                        for (IndexType ii=jj; ii<=ib; ++ii) {
+                            AB(ii-jj+1,jj+i+kd-1) = A13(ii,jj);
+                        }
+                    }
+                }
+            }
+        }
+    } else {
+//
+//      Compute the Cholesky factorization of a symmetric band matrix,
+//      given the lower triangle of the matrix in band storage.
+//
+//      The strictly upper triangle of Work is zero and never touched.
+//
+        for (IndexType i=1; i<=n; i+=nb) {
+            const IndexType ib = min(nb, n-i+1);
+//
+//          Factorize the diagonal block
+//
+            GeView A11 = FullStorageView(ib, ib, &AB(1,i), kld);
+
+            const IndexType iInfo = potf2(A11.lower().symmetric());
+            if (iInfo!=0) {
+                info = i + iInfo - 1;
+                break;
+            }
+            if (i+ib<=n) {
+//
+//              Update the relevant part of the trailing submatrix.
+//              If A11 denotes the diagonal block which has just been
+//              factorized, then we need to update the remaining
+//              blocks in the diagram:
+//
+//                 A11
+//                 A21   A22
+//                 A31   A32   A33
+//
+//              The numbers of rows and columns in the partitioning
+//              are ib, i2, i3 respectively. The blocks A21, A22 and
+//              A32 are empty if ib = kd. The lower triangle of A31
+//              lies outside the band.
+//
+                const IndexType i2 = min(kd-ib, n-i-ib+1);
+                const IndexType i3 = min(ib, n-i-kd+1);
+
+                const auto L11 = A11.lower();
+                GeView A21 = FullStorageView(i2, ib, &AB(1+ib,i), kld);
+
+                if (i2>0) {
+//
+//                  Update A21 and A22
+//
+                    GeView A22 = FullStorageView(i2, i2, &AB(1,i+ib), kld);
+
+                    blas::sm(Right, Trans, One, L11, A21);
+                    blas::rk(NoTrans, -One, A21, One, A22.lower().symmetric());
+                }
+
+                if (i3>0) {
+//
+//                  Copy the upper triangle of A31 into the work array.
+//
+                    auto A31 = Work(_(1,i3),_(1,ib));
+
+                    for (IndexType jj=1; jj<=ib; ++jj) {
+                        for (IndexType ii=1; ii<=min(jj,i3); ++ii) {
+                            A31(ii,jj) = AB(kd+1-jj+ii,jj+i-1);
+                        }
+                    }
+//
+//                  Update A31 (in the work array), A32 and A33.
+//
+                    blas::sm(Right, Trans, One, L11, A31);
+
+                    if (i2>0) {
+                        GeView A32 = FullStorageView(i3, i2,
+                                                     &AB(1+kd-ib,i+ib), kld);
+                        blas::mm(NoTrans, Trans, -One, A31, A21, One, A32);
+                    }
+
+                    GeView A33 = FullStorageView(i3, i3, &AB(1,i+kd), kld);
+                    blas::rk(NoTrans, -One, A31, One, A33.lower().symmetric());
+//
+//                  Copy the upper triangle of A31 back into place.
+//
+                    for (IndexType jj=1; jj<=ib; ++jj) {
+                        for (IndexType ii=1; ii<=min(jj,i3); ++ii) {
+                            AB(kd+1-jj+ii,jj+i-1) = A31(ii,jj);
+                        }
+                    }
+                }
+            }
+        }
+    }
+    return info;
+}
+
+//-- pbtrf [complex variant] ---------------------------------------------------
+
+template <typename MA>
+typename HbMatrix<MA>::IndexType
+pbtrf_impl(HbMatrix<MA> &A)
+{
+    using std::min;
+
+    typedef typename HbMatrix<MA>::ElementType              T;
+    typedef typename ComplexTrait<T>::PrimitiveType         PT;
+    typedef typename HbMatrix<MA>::IndexType                IndexType;
+    typedef typename HbMatrix<MA>::Engine::FullStorageView  FullStorageView;
+    typedef GeMatrix<FullStorageView>                       GeView;
+    typedef typename GeView::NoView                         GeNoView;
+
+    const Underscore<IndexType> _;
+
+    const IndexType n    = A.dim();
+    const IndexType kd   = A.numOffDiags();
+    const IndexType ldAB = A.leadingDimension();
+    const IndexType kld  = ldAB-1;
+    const bool upper     = (A.upLo()==Upper);
+
+    const PT  One(1);
+    const T   COne(1);
+
+    IndexType info = 0;
+//
+//  Quick return if possible
+//
+    if (n==0) {
+        return info;
+    }
+//
+//  Determine the block size for this environment.  The block size must
+//  not exceed the limit set by the size of the local array Work.
+//
+    const IndexType nbMax = 32;
+
+    const char *upLo = (upper) ? "U" : "L";
+    IndexType nb = ilaenv<T>(1, "PBTRF", upLo, n, kd);
+    nb = min(nb, nbMax);
+
+    if ((nb<=1) || (nb>kd)) {
+//
+//      Use unblocked code.
+//
+        return pbtf2(A);
+    }
+//
+//  Use blocked code.  Tiles of the band are viewed as full storage
+//  matrices with leading dimension ldAB-1.
+//
+    ASSERT(HbMatrix<MA>::Engine::order==ColMajor);
+
+    GeView    AB = FullStorageView(kd+1, n, A.data(), ldAB);
+    GeNoView  Work(nbMax, nbMax);
+
+    if (upper) {
+//
+//      Compute the Cholesky factorization of a hermitian band matrix,
+//      given the upper triangle of the matrix in band storage.
+//
+//      The strictly lower triangle of Work is zero and never touched.
+//
+        for (IndexType i=1; i<=n; i+=nb) {
+            const IndexType ib = min(nb, n-i+1);
+//
+//          Factorize the diagonal block
+//
+            GeView A11 = FullStorageView(ib, ib, &AB(kd+1,i), kld);
+
+            const IndexType iInfo = potf2(A11.upper().hermitian());
+            if (iInfo!=0) {
+                info = i + iInfo - 1;
+                break;
+            }
+            if (i+ib<=n) {
+//
+//              Update the relevant part of the trailing submatrix.
+//              If A11 denotes the diagonal block which has just been
+//              factorized, then we need to update the remaining
+//              blocks in the diagram:
+//
+//                 A11   A12   A13
+//                       A22   A23
+//                             A33
+//
+//              The numbers of rows and columns in the partitioning
+//              are ib, i2, i3 respectively. The blocks A12, A22 and
+//              A23 are empty if ib = kd. The upper triangle of A13
+//              lies outside the band.
+//
+                const IndexType i2 = min(kd-ib, n-i-ib+1);
+                const IndexType i3 = min(ib, n-i-kd+1);
+
+                const auto U11 = A11.upper();
+                GeView A12 = FullStorageView(ib, i2, &AB(kd+1-ib,i+ib), kld);
+
+                if (i2>0) {
+//
+//                  Update A12 and A22
+//
+                    GeView A22 = FullStorageView(i2, i2, &AB(kd+1,i+ib), kld);
+
+                    blas::sm(Left, ConjTrans, COne, U11, A12);
+                    blas::rk(ConjTrans, -One, A12,
+                             One, A22.upper().hermitian());
+                }
+
+                if (i3>0) {
+//
+//                  Copy the lower triangle of A13 into the work array.
+//
+                    auto A13 = Work(_(1,ib),_(1,i3));
+
+                    for (IndexType jj=1; jj<=i3; ++jj) {
+                        for (IndexType ii=jj; ii<=ib; ++ii) {
+                            A13(ii,jj) = AB(ii-jj+1,jj+i+kd-1);
+                        }
+                    }
+//
+//                  Update A13 (in the work array), A23 and A33.
+//
+                    blas::sm(Left, ConjTrans, COne, U11, A13);
+
+                    if (i2>0) {
+                        GeView A23 = FullStorageView(i2, i3, &AB(1+ib,i+kd),
+                                                     kld);
+                        blas::mm(ConjTrans, NoTrans, -COne, A12, A13,
+                                 COne, A23);
+                    }
+
+                    GeView A33 = FullStorageView(i3, i3, &AB(kd+1,i+kd), kld);
+                    blas::rk(ConjTrans, -One, A13,
+                             One, A33.upper().hermitian());
+//
+//                  Copy the lower triangle of A13 back into place.
+//
+                    for (IndexType jj=1; jj<=i3; ++jj) {
+                        for (IndexType ii=jj; ii<=ib; ++ii) {
+                            AB(ii-jj+1,jj+i+kd-1) = A13(ii,jj);
+                        }
+                    }
+                }
+            }
+        }
+    } else {
+//
+//      Compute the Cholesky factorization of a hermitian band matrix,
+//      given the lower triangle of the matrix in band storage.
+//
+//      The strictly upper triangle of Work is zero and never touched.
+//
+        for (IndexType i=1; i<=n; i+=nb) {
+            const IndexType ib = min(nb, n-i+1);
+//
+//          Factorize the diagonal block
+//
+            GeView A11 = FullStorageView(ib, ib, &AB(1,i), kld);
+
+            const IndexType iInfo = potf2(A11.lower().hermitian());
+            if (iInfo!=0) {
+                info = i + iInfo - 1;
+                break;
+            }
+            if (i+ib<=n) {
+//
+//              Update the relevant part of the trailing submatrix.
+//              If A11 denotes the diagonal block which has just been
+//              factorized, then we need to update the remaining
+//              blocks in the diagram:
+//
+//                 A11
+//                 A21   A22
+//                 A31   A32   A33
+//
+//              The numbers of rows and columns in the partitioning
+//              are ib, i2, i3 respectively. The blocks A21, A22 and
+//              A32 are empty if ib = kd. The lower triangle of A31
+//              lies outside the band.
+//
+                const IndexType i2 = min(kd-ib, n-i-ib+1);
+                const IndexType i3 = min(ib, n-i-kd+1);
+
+                const auto L11 = A11.lower();
+                GeView A21 = FullStorageView(i2, ib, &AB(1+ib,i), kld);
+
+                if (i2>0) {
+//
+//                  Update A21 and A22
+//
+                    GeView A22 = FullStorageView(i2, i2, &AB(1,i+ib), kld);
+
+                    blas::sm(Right, ConjTrans, COne, L11, A21);
+                    blas::rk(NoTrans, -One, A21, One, A22.lower().hermitian());
+                }
+
+                if (i3>0) {
+//
+//                  Copy the upper triangle of A31 into the work array.
+//
+                    auto A31 = Work(_(1,i3),_(1,ib));
+
+                    for (IndexType jj=1; jj<=ib; ++jj) {
+                        for (IndexType ii=1; ii<=min(jj,i3); ++ii) {
+                            A31(ii,jj) = AB(kd+1-jj+ii,jj+i-1);
+                        }
+                    }
+//
+//                  Update A31 (in the work array), A32 and A33.
+//
+                    blas::sm(Right, ConjTrans, COne, L11, A31);
+
+                    if (i2>0) {
+                        GeView A32 = FullStorageView(i3, i2,
+                                                     &AB(1+kd-ib,i+ib), kld);
+                        blas::mm(NoTrans, ConjTrans, -COne, A31, A21,
+                                 COne, A32);
+                    }
+
+                    GeView A33 = FullStorageView(i3, i3, &AB(1,i+kd), kld);
+                    blas::rk(NoTrans, -One, A31, One, A33.lower().hermitian());
+//
+//                  Copy the upper triangle of A31 back into place.
+//
+                    for (IndexType jj=1; jj<=ib; ++jj) {
+                        for (IndexType ii=1; ii<=min(jj,i3); ++ii) {
+                            AB(kd+1-jj+ii,jj+i-1) = A31(ii,jj);
+                        }
+                    }
+                }
+            }
+        }
+    }
+    return info;
+}
+
+} // namespace generic
+
+//== interface for native lapack ===============================================
 
 #ifdef USE_CXXLAPACK
 
@@ -91,17 +568,19 @@ pbtrf_impl(HbMatrix<MA> &A)
 
 } // namespace external
 
+#endif // USE_CXXLAPACK
+
+//== public interface ==========================================================
+
+//-- pbtrf [real/complex variant] ----------------------------------------------
 
-//== pbtrf =====================================================================
-//
-//  Real and complex variant
-//
 template <typename MA>
-typename RestrictTo<IsSbMatrix<MA>::value || IsHbMatrix<MA>::value,
+typename RestrictTo<IsRealSbMatrix<MA>::value
+                 || IsHbMatrix<MA>::value,
          typename RemoveRef<MA>::Type::IndexType>::Type
 pbtrf(MA &&A)
 {
-    LAPACK_DEBUG_OUT("pbtrf [complex]");
+    LAPACK_DEBUG_OUT("pbtrf [real/complex]");
 
 //
 //  Remove references from rvalue types
@@ -112,20 +591,47 @@ pbtrf(MA &&A)
 //
 //  Test the input parameters
 //
-#   ifndef NDEBUG
     ASSERT(A.firstIndex()==1);
+
+#   ifdef CHECK_CXXLAPACK
+//
+//  Make copies of output arguments
+//
+    typename MatrixA::NoView       A_      = A;
 #   endif
 
 //
 //  Call implementation
 //
-    const IndexType info = external::pbtrf_impl(A);
+    const IndexType info = LAPACK_SELECT::pbtrf_impl(A);
 
-    return info;
-}
+#   ifdef CHECK_CXXLAPACK
+//
+//  Compare results
+//
+    const IndexType info_ = external::pbtrf_impl(A_);
 
-#endif // USE_CXXLAPACK
+    bool failed = false;
+    if (! isIdentical(A, A_, " A", "A_")) {
+        std::cerr << "CXXLAPACK:  A = " << A << std::endl;
+        std::cerr << "F77LAPACK: A_ = " << A_ << std::endl;
+        failed = true;
+    }
+
+    if (! isIdentical(info, info_, " info", "info_")) {
+        std::cerr << "CXXLAPACK:  info = " << info << std::endl;
+        std::cerr << "F77LAPACK: info_ = " << info_ << std::endl;
+        failed = true;
+    }
 
+    if (failed) {
+        ASSERT(0);
+    }
+
+#   endif
+
+    return info;
+}
 
 } } // namespace lapack, flens
 
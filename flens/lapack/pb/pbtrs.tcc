@@ -50,6 +50,101 @@
 
 namespace flens { namespace lapack {
 
+//== generic lapack implementation =============================================
+
+namespace generic {
+
+//-- pbtrs [real variant] ------------------------------------------------------
+
+template <typename MA, typename MB>
+typename SbMatrix<MA>::IndexType
+pbtrs_impl(const SbMatrix<MA> &A, GeMatrix<MB> &B)
+{
+    typedef typename SbMatrix<MA>::IndexType  IndexType;
+
+    const Underscore<IndexType> _;
+
+    const auto T = A.triangular();
+
+    if (A.upLo()==Upper) {
+//
+//      Solve A*X = B where A = U**T*U.
+//
+        for (IndexType j=1; j<=B.numCols(); ++j) {
+//
+//          Solve U**T *X = B, overwriting B with X.
+//
+            blas::sv(Trans, T, B(_,j));
+//
+//          Solve U*X = B, overwriting B with X.
+//
+            blas::sv(NoTrans, T, B(_,j));
+        }
+    } else {
+//
+//      Solve A*X = B where A = L*L**T.
+//
+        for (IndexType j=1; j<=B.numCols(); ++j) {
+//
+//          Solve L*X = B, overwriting B with X.
+//
+            blas::sv(NoTrans, T, B(_,j));
+//
+//          Solve L**T *X = B, overwriting B with X.
+//
+            blas::sv(Trans, T, B(_,j));
+        }
+    }
+    return 0;
+}
+
+//-- pbtrs [complex variant] ---------------------------------------------------
+
+template <typename MA, typename MB>
+typename HbMatrix<MA>::IndexType
+pbtrs_impl(const HbMatrix<MA> &A, GeMatrix<MB> &B)
+{
+    typedef typename HbMatrix<MA>::IndexType  IndexType;
+
+    const Underscore<IndexType> _;
+
+    const auto T = A.triangular();
+
+    if (A.upLo()==Upper) {
+//
+//      Solve A*X = B where A = U**H*U.
+//
+        for (IndexType j=1; j<=B.numCols(); ++j) {
+//
+//          Solve U**H *X = B, overwriting B with X.
+//
+            blas::sv(ConjTrans, T, B(_,j));
+//
+//          Solve U*X = B, overwriting B with X.
+//
+            blas::sv(NoTrans, T, B(_,j));
+        }
+    } else {
+//
+//      Solve A*X = B where A = L*L**H.
+//
+        for (IndexType j=1; j<=B.numCols(); ++j) {
+//
+//          Solve L*X = B, overwriting B with X.
+//
+            blas::sv(NoTrans, T, B(_,j));
+//
+//          Solve L**H *X = B, overwriting B with X.
+//
+            blas::sv(ConjTrans, T, B(_,j));
+        }
+    }
+    return 0;
+}
+
+} // namespace generic
+
+//== interface for native lapack ===============================================
 
 #ifdef USE_CXXLAPACK
 
@@ -59,18 +154,18 @@ namespace external {
 
 template <typename MA, typename MB>
 typename SbMatrix<MA>::IndexType
-pbtrs_impl(SbMatrix<MA> &A, GeMatrix<MB> &B)
+pbtrs_impl(const SbMatrix<MA> &A, GeMatrix<MB> &B)
 {
     typedef typename SbMatrix<MA>::IndexType  IndexType;
 
     IndexType info = cxxlapack::pbtrs<IndexType>(getF77Char(A.upLo()),
-                                                A.dim(),
-                                                A.numOffDiags(),
-                                                B.numCols(),
-                                                A.data(),
-                                                A.leadingDimension(),
-                                                B.data(),
-                                                B.leadingDimension());
+                                                 A.dim(),
+                                                 A.numOffDiags(),
+                                                 B.numCols(),
+                                                 A.data(),
+                                                 A.leadingDimension(),
+                                                 B.data(),
+                                                 B.leadingDimension());
     ASSERT(info>=0);
     return info;
 }
@@ -79,36 +174,37 @@ pbtrs_impl(SbMatrix<MA> &A, GeMatrix<MB> &B)
 
 template <typename MA, typename MB>
 typename HbMatrix<MA>::IndexType
-pbtrs_impl(HbMatrix<MA> &A, GeMatrix<MB> &B)
+pbtrs_impl(const HbMatrix<MA> &A, GeMatrix<MB> &B)
 {
     typedef typename HbMatrix<MA>::IndexType  IndexType;
 
     IndexType info = cxxlapack::pbtrs<IndexType>(getF77Char(A.upLo()),
-                                                A.dim(),
-                                                A.numOffDiags(),
-                                                B.numCols(),
-                                                A.data(),
-                                                A.leadingDimension(),
-                                                B.data(),
-                                                B.leadingDimension());
+                                                 A.dim(),
+                                                 A.numOffDiags(),
+                                                 B.numCols(),
+                                                 A.data(),
+                                                 A.leadingDimension(),
+                                                 B.data(),
+                                                 B.leadingDimension());
     ASSERT(info>=0);
     return info;
 }
 
 } // namespace external
 
+#endif // USE_CXXLAPACK
+
+//== public interface ==========================================================
+
+//-- pbtrs [real/complex variant] ----------------------------------------------
 
-//== pbtrs =====================================================================
-//
-//  Real and complex variant
-//
 template <typename MA, typename MB>
-typename RestrictTo<(IsSbMatrix<MA>::value || IsHbMatrix<MA>::value)
+typename RestrictTo<(IsRealSbMatrix<MA>::value || IsHbMatrix<MA>::value)
                  && IsGeMatrix<MB>::value,
          typename RemoveRef<MA>::Type::IndexType>::Type
 pbtrs(MA &&A, MB &&B)
 {
-    LAPACK_DEBUG_OUT("pbtrs [complex]");
+    LAPACK_DEBUG_OUT("pbtrs [real/complex]");
 
 //
 //  Remove references from rvalue types
@@ -119,29 +215,60 @@ pbtrs(MA &&A, MB &&B)
 //
 //  Test the input parameters
 //
-#   ifndef NDEBUG
     ASSERT(A.firstIndex()==1);
-
     ASSERT(B.firstRow()==1);
     ASSERT(B.firstCol()==1);
-
     ASSERT(B.numRows()==A.dim());
+
+#   ifdef CHECK_CXXLAPACK
+
+    typedef typename RemoveRef<MB>::Type    MatrixB;
+//
+//  Make copies of output arguments
+//
+    typename MatrixB::NoView  B_org   = B;
 #   endif
 
 //
 //  Call implementation
 //
-    const IndexType info = external::pbtrs_impl(A, B);
+    IndexType info = LAPACK_SELECT::pbtrs_impl(A, B);
+
+#   ifdef CHECK_CXXLAPACK
+//
+//  Compare results
+//
+    typename MatrixB::NoView  B_generic   = B;
+
+    B   = B_org;
+
+    IndexType info_ = external::pbtrs_impl(A, B);
+
+    bool failed = false;
+    if (! isIdentical(B_generic, B, "B_generic", "B")) {
+        std::cerr << "CXXLAPACK: B_generic = " << B_generic << std::endl;
+        std::cerr << "F77LAPACK: B = " << B << std::endl;
+        failed = true;
+    }
+
+    if (! isIdentical(info, info_, "info", "info_")) {
+        std::cerr << "CXXLAPACK: info = " << info << std::endl;
+        std::cerr << "F77LAPACK: info_ = " << info_ << std::endl;
+        failed = true;
+    }
+
+    if (failed) {
+        ASSERT(0);
+    }
+#   endif
 
     return info;
 }
 
-//== pbsv variant if rhs is vector =============================================
-//
-//  Real and complex variant
-//
+//-- pbtrs [variant if rhs is vector] ------------------------------------------
+
 template <typename MA, typename VB>
-typename RestrictTo<(IsSbMatrix<MA>::value || IsHbMatrix<MA>::value)
+typename RestrictTo<(IsRealSbMatrix<MA>::value || IsHbMatrix<MA>::value)
                  && IsDenseVector<VB>::value,
          typename RemoveRef<MA>::Type::IndexType>::Type
 pbtrs(MA &&A, VB &&b)
@@ -163,9 +290,6 @@ pbtrs(MA &&A, VB &&b)
     return pbtrs(A, B);
 }
 
-#endif // USE_CXXLAPACK
-
-
 } } // namespace lapack, flens
 
 #endif // FLENS_LAPACK_PB_PBTRS_TCC
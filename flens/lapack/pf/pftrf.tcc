@@ -0,0 +1,267 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* Based on
+ *
+       SUBROUTINE DPFTRF( TRANSR, UPLO, N, A, INFO )
+       SUBROUTINE ZPFTRF( TRANSR, UPLO, N, A, INFO )
+ *
+ *  -- LAPACK routine (version 3.3.1) --
+ *  -- LAPACK is a software package provided by Univ. of Tennessee,    --
+ *  -- Univ. of California Berkeley, Univ. of Colorado Denver and NAG Ltd..--
+ *  -- April 2011
+ */
+
+#ifndef FLENS_LAPACK_PF_PFTRF_TCC
+#define FLENS_LAPACK_PF_PFTRF_TCC 1
+
+#include <flens/blas/blas.h>
+#include <flens/lapack/lapack.h>
+
+namespace flens { namespace lapack {
+
+//== generic lapack implementation =============================================
+
+namespace generic {
+
+//-- pftrf [real and complex variant] ------------------------------------------
+//
+//  The RFP array holds A11, A22 and A12 (or A12^H) as full storage blocks.
+//  With A11 = U11^H*U11 we get U12 = U11^{-H}*A12 and U22 from the Schur
+//  complement A22 - U12^H*U12.  So all work is done by potrf, trsm and
+//  syrk/herk on these blocks.
+//
+template <typename SYM, typename MA>
+typename MA::IndexType
+pftrf_rfp(MA &A)
+{
+    typedef typename MA::ElementType                 T;
+    typedef typename ComplexTrait<T>::PrimitiveType  PT;
+    typedef typename MA::IndexType                   IndexType;
+    typedef typename MA::Engine::BlockView           BlockView;
+
+    const T         One(1);
+    const PT        ROne(1);
+    const Transpose cTrans = (IsComplex<T>::value) ? ConjTrans : Trans;
+
+    const StorageUpLo upLo = A.upLo();
+
+//
+//  Quick return if possible
+//
+    if (A.dim()==0) {
+        return 0;
+    }
+
+    GeMatrix<BlockView>  B(A.engine().viewBlock(upLo, RfpOffDiag));
+
+    const bool          ct1    = rfpConjTrans(A, RfpDiag1);
+    const bool          ctB    = rfpConjTrans(A, RfpOffDiag);
+    const StorageUpLo   upLo1  = rfpUpLo(A, RfpDiag1);
+    const StorageUpLo   upLo2  = rfpUpLo(A, RfpDiag2);
+
+    SYM                 A11(A.engine().viewBlock(upLo, RfpDiag1), upLo1);
+    SYM                 A22(A.engine().viewBlock(upLo, RfpDiag2), upLo2);
+    TrMatrix<BlockView> U11(A.engine().viewBlock(upLo, RfpDiag1), upLo1);
+
+    const IndexType n1 = A11.dim();
+
+//
+//  Factor A11
+//
+    IndexType info = potrf(A11);
+    if (info>0) {
+        return info;
+    }
+//
+//  Update the off-diagonal block and the trailing block A22
+//
+    if (!ctB) {
+//
+//      B = A12:  B := U11^{-H}*B  and  A22 := A22 - B^H*B
+//
+        blas::sm(Left, ct1 ? NoTrans : cTrans, One, U11, B);
+        blas::rk(cTrans, -ROne, B, ROne, A22);
+    } else {
+//
+//      B = A12^H:  B := B*U11^{-1}  and  A22 := A22 - B*B^H
+//
+        blas::sm(Right, ct1 ? cTrans : NoTrans, One, U11, B);
+        blas::rk(NoTrans, -ROne, B, ROne, A22);
+    }
+//
+//  Factor A22
+//
+    info = potrf(A22);
+    if (info>0) {
+        info += n1;
+    }
+    return info;
+}
+
+//-- pftrf [real variant] ------------------------------------------------------
+
+template <typename MA>
+typename SfMatrix<MA>::IndexType
+pftrf_impl(SfMatrix<MA> &A)
+{
+    typedef typename SfMatrix<MA>::Engine::BlockView  BlockView;
+
+    return pftrf_rfp<SyMatrix<BlockView> >(A);
+}
+
+//-- pftrf [complex variant] ---------------------------------------------------
+
+template <typename MA>
+typename HfMatrix<MA>::IndexType
+pftrf_impl(HfMatrix<MA> &A)
+{
+    typedef typename HfMatrix<MA>::Engine::BlockView  BlockView;
+
+    return pftrf_rfp<HeMatrix<BlockView> >(A);
+}
+
+} // namespace generic
+
+//== interface for native lapack ===============================================
+
+#ifdef USE_CXXLAPACK
+
+namespace external {
+
+//-- pftrf [real variant] ------------------------------------------------------
+
+template <typename MA>
+typename SfMatrix<MA>::IndexType
+pftrf_impl(SfMatrix<MA> &A)
+{
+    typedef typename SfMatrix<MA>::IndexType  IndexType;
+
+    const char transR = (A.order()==ColMajor) ? 'N' : 'T';
+
+    IndexType info = cxxlapack::pftrf<IndexType>(transR,
+                                                 getF77Char(A.upLo()),
+                                                 A.dim(),
+                                                 A.data());
+    ASSERT(info>=0);
+    return info;
+}
+
+//-- pftrf [complex variant] ---------------------------------------------------
+
+template <typename MA>
+typename HfMatrix<MA>::IndexType
+pftrf_impl(HfMatrix<MA> &A)
+{
+    typedef typename HfMatrix<MA>::IndexType  IndexType;
+
+    const char transR = (A.order()==ColMajor) ? 'N' : 'C';
+
+    IndexType info = cxxlapack::pftrf<IndexType>(transR,
+                                                 getF77Char(A.upLo()),
+                                                 A.dim(),
+                                                 A.data());
+    ASSERT(info>=0);
+    return info;
+}
+
+} // namespace external
+
+#endif // USE_CXXLAPACK
+
+//== public interface ==========================================================
+
+template <typename MA>
+typename RestrictTo<IsRealSfMatrix<MA>::value
+                 || IsHfMatrix<MA>::value,
+         typename RemoveRef<MA>::Type::IndexType>::Type
+pftrf(MA &&A)
+{
+    LAPACK_DEBUG_OUT("pftrf [real/complex]");
+
+//
+//  Remove references from rvalue types
+//
+    typedef typename RemoveRef<MA>::Type    MatrixA;
+    typedef typename MatrixA::IndexType     IndexType;
+
+//
+//  Test the input parameters
+//
+    ASSERT(A.indexBase()==1);
+
+#   ifdef CHECK_CXXLAPACK
+//
+//  Make copies of output arguments
+//
+    typename MatrixA::NoView  A_org = A;
+#   endif
+
+//
+//  Call implementation
+//
+    IndexType info = LAPACK_SELECT::pftrf_impl(A);
+
+#   ifdef CHECK_CXXLAPACK
+//
+//  Compare results
+//
+    typename MatrixA::NoView  A_generic = A;
+
+    A = A_org;
+
+    IndexType info_ = external::pftrf_impl(A);
+
+    bool failed = false;
+    if (! isIdentical(A_generic, A, "A_generic", "A")) {
+        std::cerr << "CXXLAPACK: A_generic = " << A_generic << std::endl;
+        std::cerr << "F77LAPACK: A = " << A << std::endl;
+        failed = true;
+    }
+
+    if (! isIdentical(info, info_, "info", "info_")) {
+        std::cerr << "CXXLAPACK: info = " << info << std::endl;
+        std::cerr << "F77LAPACK: info_ = " << info_ << std::endl;
+        failed = true;
+    }
+
+    if (failed) {
+        ASSERT(0);
+    }
+#   endif
+
+    return info;
+}
+
+} } // namespace lapack, flens
+
+#endif // FLENS_LAPACK_PF_PFTRF_TCC
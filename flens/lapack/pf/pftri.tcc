@@ -0,0 +1,262 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* Based on
+ *
+       SUBROUTINE DPFTRI( TRANSR, UPLO, N, A, INFO )
+       SUBROUTINE ZPFTRI( TRANSR, UPLO, N, A, INFO )
+ *
+ *  -- LAPACK routine (version 3.3.1) --
+ *  -- LAPACK is a software package provided by Univ. of Tennessee,    --
+ *  -- Univ. of California Berkeley, Univ. of Colorado Denver and NAG Ltd..--
+ *  -- April 2011
+ */
+
+#ifndef FLENS_LAPACK_PF_PFTRI_TCC
+#define FLENS_LAPACK_PF_PFTRI_TCC 1
+
+#include <flens/blas/blas.h>
+#include <flens/lapack/lapack.h>
+
+namespace flens { namespace lapack {
+
+//== generic lapack implementation =============================================
+
+namespace generic {
+
+//-- pftri [real and complex variant] ------------------------------------------
+//
+//  With V = U^{-1} the inverse of A = U^H*U is V*V^H, i.e.
+//
+//      inv(A)11 = V11*V11^H + V12*V12^H,
+//      inv(A)12 = V12*V22^H,
+//      inv(A)22 = V22*V22^H.
+//
+template <typename SYM, typename MA>
+typename MA::IndexType
+pftri_rfp(MA &A)
+{
+    typedef typename MA::ElementType                 T;
+    typedef typename ComplexTrait<T>::PrimitiveType  PT;
+    typedef typename MA::IndexType                   IndexType;
+    typedef typename MA::Engine::BlockView           BlockView;
+
+    const T         One(1);
+    const PT        ROne(1);
+    const Transpose cTrans = (IsComplex<T>::value) ? ConjTrans : Trans;
+
+    const StorageUpLo upLo = A.upLo();
+
+//
+//  Quick return if possible
+//
+    if (A.dim()==0) {
+        return 0;
+    }
+//
+//  Invert the triangular Cholesky factor U
+//
+    auto U = A.triangular();
+
+    IndexType info = tftri(U);
+    if (info>0) {
+        return info;
+    }
+
+    const bool          ct2    = rfpConjTrans(A, RfpDiag2);
+    const bool          ctB    = rfpConjTrans(A, RfpOffDiag);
+    const StorageUpLo   upLo1  = rfpUpLo(A, RfpDiag1);
+    const StorageUpLo   upLo2  = rfpUpLo(A, RfpDiag2);
+
+    TrMatrix<BlockView>  V11(A.engine().viewBlock(upLo, RfpDiag1), upLo1);
+    TrMatrix<BlockView>  V22(A.engine().viewBlock(upLo, RfpDiag2), upLo2);
+    SYM                  A11(A.engine().viewBlock(upLo, RfpDiag1), upLo1);
+    GeMatrix<BlockView>  B(A.engine().viewBlock(upLo, RfpOffDiag));
+
+//
+//  A11 := V11*V11^H + V12*V12^H
+//
+    lauum(V11);
+    blas::rk(ctB ? cTrans : NoTrans, ROne, B, ROne, A11);
+//
+//  A12 := V12*V22^H
+//
+    if (!ctB) {
+        blas::mm(Right, ct2 ? NoTrans : cTrans, One, V22, B);
+    } else {
+        blas::mm(Left, ct2 ? cTrans : NoTrans, One, V22, B);
+    }
+//
+//  A22 := V22*V22^H
+//
+    lauum(V22);
+
+    return 0;
+}
+
+//-- pftri [real variant] ------------------------------------------------------
+
+template <typename MA>
+typename SfMatrix<MA>::IndexType
+pftri_impl(SfMatrix<MA> &A)
+{
+    typedef typename SfMatrix<MA>::Engine::BlockView  BlockView;
+
+    return pftri_rfp<SyMatrix<BlockView> >(A);
+}
+
+//-- pftri [complex variant] ---------------------------------------------------
+
+template <typename MA>
+typename HfMatrix<MA>::IndexType
+pftri_impl(HfMatrix<MA> &A)
+{
+    typedef typename HfMatrix<MA>::Engine::BlockView  BlockView;
+
+    return pftri_rfp<HeMatrix<BlockView> >(A);
+}
+
+} // namespace generic
+
+//== interface for native lapack ===============================================
+
+#ifdef USE_CXXLAPACK
+
+namespace external {
+
+//-- pftri [real variant] ------------------------------------------------------
+
+template <typename MA>
+typename SfMatrix<MA>::IndexType
+pftri_impl(SfMatrix<MA> &A)
+{
+    typedef typename SfMatrix<MA>::IndexType  IndexType;
+
+    const char transR = (A.order()==ColMajor) ? 'N' : 'T';
+
+    IndexType info = cxxlapack::pftri<IndexType>(transR,
+                                                 getF77Char(A.upLo()),
+                                                 A.dim(),
+                                                 A.data());
+    ASSERT(info>=0);
+    return info;
+}
+
+//-- pftri [complex variant] ---------------------------------------------------
+
+template <typename MA>
+typename HfMatrix<MA>::IndexType
+pftri_impl(HfMatrix<MA> &A)
+{
+    typedef typename HfMatrix<MA>::IndexType  IndexType;
+
+    const char transR = (A.order()==ColMajor) ? 'N' : 'C';
+
+    IndexType info = cxxlapack::pftri<IndexType>(transR,
+                                                 getF77Char(A.upLo()),
+                                                 A.dim(),
+                                                 A.data());
+    ASSERT(info>=0);
+    return info;
+}
+
+} // namespace external
+
+#endif // USE_CXXLAPACK
+
+//== public interface ==========================================================
+
+template <typename MA>
+typename RestrictTo<IsRealSfMatrix<MA>::value
+                 || IsHfMatrix<MA>::value,
+         typename RemoveRef<MA>::Type::IndexType>::Type
+pftri(MA &&A)
+{
+    LAPACK_DEBUG_OUT("pftri [real/complex]");
+
+//
+//  Remove references from rvalue types
+//
+    typedef typename RemoveRef<MA>::Type    MatrixA;
+    typedef typename MatrixA::IndexType     IndexType;
+
+//
+//  Test the input parameters
+//
+    ASSERT(A.indexBase()==1);
+
+#   ifdef CHECK_CXXLAPACK
+//
+//  Make copies of output arguments
+//
+    typename MatrixA::NoView  A_org = A;
+#   endif
+
+//
+//  Call implementation
+//
+    IndexType info = LAPACK_SELECT::pftri_impl(A);
+
+#   ifdef CHECK_CXXLAPACK
+//
+//  Compare results
+//
+    typename MatrixA::NoView  A_generic = A;
+
+    A = A_org;
+
+    IndexType info_ = external::pftri_impl(A);
+
+    bool failed = false;
+    if (! isIdentical(A_generic, A, "A_generic", "A")) {
+        std::cerr << "CXXLAPACK: A_generic = " << A_generic << std::endl;
+        std::cerr << "F77LAPACK: A = " << A << std::endl;
+        failed = true;
+    }
+
+    if (! isIdentical(info, info_, "info", "info_")) {
+        std::cerr << "CXXLAPACK: info = " << info << std::endl;
+        std::cerr << "F77LAPACK: info_ = " << info_ << std::endl;
+        failed = true;
+    }
+
+    if (failed) {
+        ASSERT(0);
+    }
+#   endif
+
+    return info;
+}
+
+} } // namespace lapack, flens
+
+#endif // FLENS_LAPACK_PF_PFTRI_TCC
@@ -0,0 +1,283 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* Based on
+ *
+       SUBROUTINE DPFTRS( TRANSR, UPLO, N, NRHS, A, B, LDB, INFO )
+       SUBROUTINE ZPFTRS( TRANSR, UPLO, N, NRHS, A, B, LDB, INFO )
+ *
+ *  -- LAPACK routine (version 3.3.1) --
+ *  -- LAPACK is a software package provided by Univ. of Tennessee,    --
+ *  -- Univ. of California Berkeley, Univ. of Colorado Denver and NAG Ltd..--
+ *  -- April 2011
+ */
+
+#ifndef FLENS_LAPACK_PF_PFTRS_TCC
+#define FLENS_LAPACK_PF_PFTRS_TCC 1
+
+#include <flens/blas/blas.h>
+#include <flens/lapack/lapack.h>
+
+namespace flens { namespace lapack {
+
+//== generic lapack implementation =============================================
+
+namespace generic {
+
+//-- pftrs [real and complex variant] ------------------------------------------
+//
+//  Solves U^H*U*X = B blockwise.  Depending on the RFP layout the array
+//  holds U11, U22, U12 or their conjugate transposes.
+//
+template <typename MA, typename MB>
+typename MA::IndexType
+pftrs_rfp(const MA &A, GeMatrix<MB> &B)
+{
+    typedef typename MA::ElementType                T;
+    typedef typename MA::IndexType                  IndexType;
+    typedef typename MA::Engine::ConstBlockView     BlockView;
+
+    const Underscore<IndexType> _;
+
+    const T         One(1);
+    const Transpose cTrans = (IsComplex<T>::value) ? ConjTrans : Trans;
+
+    const IndexType   n    = A.dim();
+    const StorageUpLo upLo = A.upLo();
+
+//
+//  Quick return if possible
+//
+    if (n==0 || B.numCols()==0) {
+        return 0;
+    }
+
+    const bool ct1 = rfpConjTrans(A, RfpDiag1);
+    const bool ct2 = rfpConjTrans(A, RfpDiag2);
+    const bool ctB = rfpConjTrans(A, RfpOffDiag);
+
+    const TrMatrix<BlockView>  U11(A.engine().viewBlock(upLo, RfpDiag1),
+                                   rfpUpLo(A, RfpDiag1));
+    const TrMatrix<BlockView>  U22(A.engine().viewBlock(upLo, RfpDiag2),
+                                   rfpUpLo(A, RfpDiag2));
+    const GeMatrix<BlockView>  U12(A.engine().viewBlock(upLo, RfpOffDiag));
+
+    const IndexType n1 = U11.dim();
+
+    auto B1 = B(_(1,n1),_);
+    auto B2 = B(_(n1+1,n),_);
+
+//
+//  Solve U^H*Y = B, overwriting B with Y.
+//
+    blas::sm(Left, ct1 ? NoTrans : cTrans, One, U11, B1);
+    blas::mm(ctB ? NoTrans : cTrans, NoTrans, -One, U12, B1, One, B2);
+    blas::sm(Left, ct2 ? NoTrans : cTrans, One, U22, B2);
+//
+//  Solve U*X = Y, overwriting B with X.
+//
+    blas::sm(Left, ct2 ? cTrans : NoTrans, One, U22, B2);
+    blas::mm(ctB ? cTrans : NoTrans, NoTrans, -One, U12, B2, One, B1);
+    blas::sm(Left, ct1 ? cTrans : NoTrans, One, U11, B1);
+
+    return 0;
+}
+
+//-- pftrs [real variant] ------------------------------------------------------
+
+template <typename MA, typename MB>
+typename SfMatrix<MA>::IndexType
+pftrs_impl(const SfMatrix<MA> &A, GeMatrix<MB> &B)
+{
+    return pftrs_rfp(A, B);
+}
+
+//-- pftrs [complex variant] ---------------------------------------------------
+
+template <typename MA, typename MB>
+typename HfMatrix<MA>::IndexType
+pftrs_impl(const HfMatrix<MA> &A, GeMatrix<MB> &B)
+{
+    return pftrs_rfp(A, B);
+}
+
+} // namespace generic
+
+//== interface for native lapack ===============================================
+
+#ifdef USE_CXXLAPACK
+
+namespace external {
+
+//-- pftrs [real variant] ------------------------------------------------------
+
+template <typename MA, typename MB>
+typename SfMatrix<MA>::IndexType
+pftrs_impl(const SfMatrix<MA> &A, GeMatrix<MB> &B)
+{
+    typedef typename SfMatrix<MA>::IndexType  IndexType;
+
+    const char transR = (A.order()==ColMajor) ? 'N' : 'T';
+
+    IndexType info = cxxlapack::pftrs<IndexType>(transR,
+                                                 getF77Char(A.upLo()),
+                                                 A.dim(),
+                                                 B.numCols(),
+                                                 A.data(),
+                                                 B.data(),
+                                                 B.leadingDimension());
+    ASSERT(info>=0);
+    return info;
+}
+
+//-- pftrs [complex variant] ---------------------------------------------------
+
+template <typename MA, typename MB>
+typename HfMatrix<MA>::IndexType
+pftrs_impl(const HfMatrix<MA> &A, GeMatrix<MB> &B)
+{
+    typedef typename HfMatrix<MA>::IndexType  IndexType;
+
+    const char transR = (A.order()==ColMajor) ? 'N' : 'C';
+
+    IndexType info = cxxlapack::pftrs<IndexType>(transR,
+                                                 getF77Char(A.upLo()),
+                                                 A.dim(),
+                                                 B.numCols(),
+                                                 A.data(),
+                                                 B.data(),
+                                                 B.leadingDimension());
+    ASSERT(info>=0);
+    return info;
+}
+
+} // namespace external
+
+#endif // USE_CXXLAPACK
+
+//== public interface ==========================================================
+
+//-- pftrs [real/complex variant] ----------------------------------------------
+
+template <typename MA, typename MB>
+typename RestrictTo<(IsRealSfMatrix<MA>::value || IsHfMatrix<MA>::value)
+                 && IsGeMatrix<MB>::value,
+         typename RemoveRef<MA>::Type::IndexType>::Type
+pftrs(const MA &A, MB &&B)
+{
+    LAPACK_DEBUG_OUT("pftrs [real/complex]");
+
+//
+//  Remove references from rvalue types
+//
+    typedef typename RemoveRef<MA>::Type    MatrixA;
+    typedef typename MatrixA::IndexType     IndexType;
+
+//
+//  Test the input parameters
+//
+    ASSERT(A.indexBase()==1);
+    ASSERT(B.firstRow()==1);
+    ASSERT(B.firstCol()==1);
+    ASSERT(B.numRows()==A.dim());
+
+#   ifdef CHECK_CXXLAPACK
+
+    typedef typename RemoveRef<MB>::Type    MatrixB;
+//
+//  Make copies of output arguments
+//
+    typename MatrixB::NoView  B_org   = B;
+#   endif
+
+//
+//  Call implementation
+//
+    IndexType info = LAPACK_SELECT::pftrs_impl(A, B);
+
+#   ifdef CHECK_CXXLAPACK
+//
+//  Compare results
+//
+    typename MatrixB::NoView  B_generic   = B;
+
+    B   = B_org;
+
+    IndexType info_ = external::pftrs_impl(A, B);
+
+    bool failed = false;
+    if (! isIdentical(B_generic, B, "B_generic", "B")) {
+        std::cerr << "CXXLAPACK: B_generic = " << B_generic << std::endl;
+        std::cerr << "F77LAPACK: B = " << B << std::endl;
+        failed = true;
+    }
+
+    if (! isIdentical(info, info_, "info", "info_")) {
+        std::cerr << "CXXLAPACK: info = " << info << std::endl;
+        std::cerr << "F77LAPACK: info_ = " << info_ << std::endl;
+        failed = true;
+    }
+
+    if (failed) {
+        ASSERT(0);
+    }
+#   endif
+
+    return info;
+}
+
+//-- pftrs [variant if rhs is vector] ------------------------------------------
+
+template <typename MA, typename VB>
+typename RestrictTo<(IsRealSfMatrix<MA>::value || IsHfMatrix<MA>::value)
+                 && IsDenseVector<VB>::value,
+         typename RemoveRef<MA>::Type::IndexType>::Type
+pftrs(const MA &A, VB &&b)
+{
+//
+//  Remove references from rvalue types
+//
+    typedef typename RemoveRef<VB>::Type    VectorB;
+
+    typedef typename VectorB::ElementType  ElementType;
+    typedef typename VectorB::IndexType    IndexType;
+
+    const IndexType    n     = b.length();
+
+    GeMatrix<FullStorageView<ElementType, ColMajor> >  B(n, 1, b, n);
+
+    return pftrs(A, B);
+}
+
+} } // namespace lapack, flens
+
+#endif // FLENS_LAPACK_PF_PFTRS_TCC
@@ -0,0 +1,80 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* Based on
+ *
+       SUBROUTINE DPTSV( N, NRHS, D, E, B, LDB, INFO )
+       SUBROUTINE ZPTSV( N, NRHS, D, E, B, LDB, INFO )
+ *
+ *  -- LAPACK driver routine (version 3.3.1) --
+ *  -- LAPACK is a software package provided by Univ. of Tennessee,    --
+ *  -- Univ. of California Berkeley, Univ. of Colorado Denver and NAG Ltd..--
+ *  -- April 2011
+ */
+
+#ifndef FLENS_LAPACK_PT_PTSV_H
+#define FLENS_LAPACK_PT_PTSV_H 1
+
+#include <flens/matrixtypes/matrixtypes.h>
+#include <flens/vectortypes/vectortypes.h>
+
+namespace flens { namespace lapack {
+
+//== ptsv ======================================================================
+//
+//  Solves A*X = B for a positive definite tridiagonal matrix A with real
+//  diagonal d and subdiagonal e.  On exit d and e contain the factorization
+//  computed by pttrf.
+//
+//  Real and complex variant
+//
+template <typename VD, typename VE, typename MB>
+    typename RestrictTo<IsRealDenseVector<VD>::value
+                     && IsDenseVector<VE>::value
+                     && IsGeMatrix<MB>::value,
+             typename RemoveRef<VD>::Type::IndexType>::Type
+    ptsv(VD &&d, VE &&e, MB &&B);
+
+//== ptsv variant if rhs is vector =============================================
+//
+//  Real and complex variant
+//
+template <typename VD, typename VE, typename VB>
+    typename RestrictTo<IsRealDenseVector<VD>::value
+                     && IsDenseVector<VE>::value
+                     && IsDenseVector<VB>::value,
+             typename RemoveRef<VD>::Type::IndexType>::Type
+    ptsv(VD &&d, VE &&e, VB &&b);
+
+} } // namespace lapack, flens
+
+#endif // FLENS_LAPACK_PT_PTSV_H
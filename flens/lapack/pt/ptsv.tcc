@@ -0,0 +1,228 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* Based on
+ *
+       SUBROUTINE DPTSV( N, NRHS, D, E, B, LDB, INFO )
+       SUBROUTINE ZPTSV( N, NRHS, D, E, B, LDB, INFO )
+ *
+ *  -- LAPACK driver routine (version 3.3.1) --
+ *  -- LAPACK is a software package provided by Univ. of Tennessee,    --
+ *  -- Univ. of California Berkeley, Univ. of Colorado Denver and NAG Ltd..--
+ *  -- April 2011
+ */
+
+#ifndef FLENS_LAPACK_PT_PTSV_TCC
+#define FLENS_LAPACK_PT_PTSV_TCC 1
+
+#include <flens/blas/blas.h>
+#include <flens/lapack/lapack.h>
+
+namespace flens { namespace lapack {
+
+//== generic lapack implementation =============================================
+
+namespace generic {
+
+//-- ptsv [real and complex variant] -------------------------------------------
+
+template <typename VD, typename VE, typename MB>
+typename DenseVector<VD>::IndexType
+ptsv_impl(DenseVector<VD> &d, DenseVector<VE> &e, GeMatrix<MB> &B)
+{
+    typedef typename DenseVector<VD>::IndexType  IndexType;
+//
+//  Compute the L*D*L**T (or L*D*L**H) factorization of A.
+//
+    const IndexType info = pttrf(d, e);
+    if (info==0) {
+//
+//      Solve the system A*X = B, overwriting B with X.
+//
+        pttrs(d, e, B);
+    }
+    return info;
+}
+
+} // namespace generic
+
+//== interface for native lapack ===============================================
+
+#ifdef USE_CXXLAPACK
+
+namespace external {
+
+//-- ptsv [real and complex variant] -------------------------------------------
+
+template <typename VD, typename VE, typename MB>
+typename DenseVector<VD>::IndexType
+ptsv_impl(DenseVector<VD> &d, DenseVector<VE> &e, GeMatrix<MB> &B)
+{
+    typedef typename DenseVector<VD>::IndexType  IndexType;
+
+    ASSERT(d.stride()==1);
+    ASSERT(e.stride()==1);
+
+    IndexType info = cxxlapack::ptsv<IndexType>(d.length(),
+                                                B.numCols(),
+                                                d.data(),
+                                                e.data(),
+                                                B.data(),
+                                                B.leadingDimension());
+    ASSERT(info>=0);
+    return info;
+}
+
+} // namespace external
+
+#endif // USE_CXXLAPACK
+
+//== public interface ==========================================================
+
+//-- ptsv [real and complex variant] -------------------------------------------
+
+template <typename VD, typename VE, typename MB>
+typename RestrictTo<IsRealDenseVector<VD>::value
+                 && IsDenseVector<VE>::value
+                 && IsGeMatrix<MB>::value,
+         typename RemoveRef<VD>::Type::IndexType>::Type
+ptsv(VD &&d, VE &&e, MB &&B)
+{
+    LAPACK_DEBUG_OUT("ptsv");
+
+//
+//  Remove references from rvalue types
+//
+    typedef typename RemoveRef<VD>::Type    VectorD;
+    typedef typename VectorD::IndexType     IndexType;
+
+    const IndexType n = d.length();
+
+    if (n==0) {
+        return 0;
+    }
+
+//
+//  Test the input parameters
+//
+    ASSERT(d.firstIndex()==1);
+    ASSERT(e.firstIndex()==1);
+    ASSERT(e.length()==n-1);
+    ASSERT(B.firstRow()==1);
+    ASSERT(B.firstCol()==1);
+    ASSERT(B.numRows()==n);
+
+#   ifdef CHECK_CXXLAPACK
+//
+//  Make copies of output arguments
+//
+    typedef typename RemoveRef<VE>::Type    VectorE;
+    typedef typename RemoveRef<MB>::Type    MatrixB;
+
+    typename VectorD::NoView  d_ = d;
+    typename VectorE::NoView  e_ = e;
+    typename MatrixB::NoView  B_ = B;
+#   endif
+
+//
+//  Call implementation
+//
+    const IndexType info = LAPACK_SELECT::ptsv_impl(d, e, B);
+
+#   ifdef CHECK_CXXLAPACK
+//
+//  Compare results
+//
+    const IndexType info_ = external::ptsv_impl(d_, e_, B_);
+
+    bool failed = false;
+    if (! isIdentical(d, d_, " d", "d_")) {
+        std::cerr << "CXXLAPACK:  d = " << d << std::endl;
+        std::cerr << "F77LAPACK: d_ = " << d_ << std::endl;
+        failed = true;
+    }
+
+    if (! isIdentical(e, e_, " e", "e_")) {
+        std::cerr << "CXXLAPACK:  e = " << e << std::endl;
+        std::cerr << "F77LAPACK: e_ = " << e_ << std::endl;
+        failed = true;
+    }
+
+    if (! isIdentical(B, B_, " B", "B_")) {
+        std::cerr << "CXXLAPACK:  B = " << B << std::endl;
+        std::cerr << "F77LAPACK: B_ = " << B_ << std::endl;
+        failed = true;
+    }
+
+    if (! isIdentical(info, info_, " info", "info_")) {
+        std::cerr << "CXXLAPACK:  info = " << info << std::endl;
+        std::cerr << "F77LAPACK: info_ = " << info_ << std::endl;
+        failed = true;
+    }
+
+    if (failed) {
+        ASSERT(0);
+    }
+#   endif
+
+    return info;
+}
+
+//-- ptsv [variant if rhs is vector] -------------------------------------------
+
+template <typename VD, typename VE, typename VB>
+typename RestrictTo<IsRealDenseVector<VD>::value
+                 && IsDenseVector<VE>::value
+                 && IsDenseVector<VB>::value,
+         typename RemoveRef<VD>::Type::IndexType>::Type
+ptsv(VD &&d, VE &&e, VB &&b)
+{
+//
+//  Remove references from rvalue types
+//
+    typedef typename RemoveRef<VB>::Type    VectorB;
+
+    typedef typename VectorB::ElementType        ElementType;
+    typedef typename VectorB::IndexType          IndexType;
+    typedef typename VectorB::Engine::Allocator  Allocator;
+
+    const IndexType n = b.length();
+
+    GeMatrix<FullStorageView<ElementType, ColMajor, IndexOptions<IndexType>,
+                             Allocator> >  B(n, 1, b, n);
+
+    return ptsv(d, e, B);
+}
+
+} } // namespace lapack, flens
+
+#endif // FLENS_LAPACK_PT_PTSV_TCC
@@ -0,0 +1,246 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* Based on
+ *
+       SUBROUTINE DPTTRF( N, D, E, INFO )
+       SUBROUTINE ZPTTRF( N, D, E, INFO )
+ *
+ *  -- LAPACK routine (version 3.3.1) --
+ *  -- LAPACK is a software package provided by Univ. of Tennessee,    --
+ *  -- Univ. of California Berkeley, Univ. of Colorado Denver and NAG Ltd..--
+ *  -- April 2011
+ */
+
+#ifndef FLENS_LAPACK_PT_PTTRF_TCC
+#define FLENS_LAPACK_PT_PTTRF_TCC 1
+
+#include <flens/blas/blas.h>
+#include <flens/lapack/lapack.h>
+
+namespace flens { namespace lapack {
+
+//== generic lapack implementation =============================================
+
+namespace generic {
+
+//-- pttrf [real variant] ------------------------------------------------------
+
+template <typename VD, typename VE>
+typename RestrictTo<IsNotComplex<typename DenseVector<VE>::ElementType>::value,
+         typename DenseVector<VD>::IndexType>::Type
+pttrf_impl(DenseVector<VD> &d, DenseVector<VE> &e)
+{
+    typedef typename DenseVector<VD>::ElementType  T;
+    typedef typename DenseVector<VD>::IndexType    IndexType;
+
+    const T Zero(0);
+
+    const IndexType n = d.length();
+//
+//  Compute the L*D*L**T factorization of A.
+//
+    for (IndexType i=1; i<=n-1; ++i) {
+        if (d(i)<=Zero) {
+            return i;
+        }
+        const T ei = e(i);
+        e(i) = ei / d(i);
+        d(i+1) -= e(i)*ei;
+    }
+//
+//  Check d(n) for positive definiteness.
+//
+    if (d(n)<=Zero) {
+        return n;
+    }
+    return 0;
+}
+
+//-- pttrf [complex variant] ---------------------------------------------------
+
+template <typename VD, typename VE>
+typename RestrictTo<IsComplex<typename DenseVector<VE>::ElementType>::value,
+         typename DenseVector<VD>::IndexType>::Type
+pttrf_impl(DenseVector<VD> &d, DenseVector<VE> &e)
+{
+    typedef typename DenseVector<VD>::ElementType  T;
+    typedef typename DenseVector<VE>::ElementType  CT;
+    typedef typename DenseVector<VD>::IndexType    IndexType;
+
+    const T Zero(0);
+
+    const IndexType n = d.length();
+//
+//  Compute the L*D*L**H factorization of A.
+//
+    for (IndexType i=1; i<=n-1; ++i) {
+        if (d(i)<=Zero) {
+            return i;
+        }
+        const T eir = cxxblas::real(e(i));
+        const T eii = cxxblas::imag(e(i));
+        const T f = eir / d(i);
+        const T g = eii / d(i);
+        e(i) = CT(f, g);
+        d(i+1) = d(i+1) - f*eir - g*eii;
+    }
+//
+//  Check d(n) for positive definiteness.
+//
+    if (d(n)<=Zero) {
+        return n;
+    }
+    return 0;
+}
+
+} // namespace generic
+
+//== interface for native lapack ===============================================
+
+#ifdef USE_CXXLAPACK
+
+namespace external {
+
+//-- pttrf [real and complex variant] ------------------------------------------
+
+template <typename VD, typename VE>
+typename DenseVector<VD>::IndexType
+pttrf_impl(DenseVector<VD> &d, DenseVector<VE> &e)
+{
+    typedef typename DenseVector<VD>::IndexType  IndexType;
+
+    ASSERT(d.stride()==1);
+    ASSERT(e.stride()==1);
+
+    IndexType info = cxxlapack::pttrf<IndexType>(d.length(),
+                                                 d.data(),
+                                                 e.data());
+    ASSERT(info>=0);
+    return info;
+}
+
+} // namespace external
+
+#endif // USE_CXXLAPACK
+
+//== public interface ==========================================================
+
+//-- pttrf [real and complex variant] ------------------------------------------
+
+template <typename VD, typename VE>
+typename RestrictTo<IsRealDenseVector<VD>::value
+                 && IsDenseVector<VE>::value,
+         typename RemoveRef<VD>::Type::IndexType>::Type
+pttrf(VD &&d, VE &&e)
+{
+    LAPACK_DEBUG_OUT("pttrf");
+
+//
+//  Remove references from rvalue types
+//
+    typedef typename RemoveRef<VD>::Type    VectorD;
+    typedef typename VectorD::IndexType     IndexType;
+
+    const IndexType n = d.length();
+
+    if (n==0) {
+        return 0;
+    }
+
+//
+//  Test the input parameters
+//
+    ASSERT(d.firstIndex()==1);
+    ASSERT(e.firstIndex()==1);
+    ASSERT(e.length()==n-1);
+
+#   ifdef CHECK_CXXLAPACK
+//
+//  Make copies of output arguments
+//
+    typedef typename RemoveRef<VE>::Type    VectorE;
+
+    typename VectorD::NoView  d_org = d;
+    typename VectorE::NoView  e_org = e;
+#   endif
+
+//
+//  Call implementation
+//
+    const IndexType info = LAPACK_SELECT::pttrf_impl(d, e);
+
+#   ifdef CHECK_CXXLAPACK
+//
+//  Restore output arguments
+//
+    typename VectorD::NoView  d_generic = d;
+    typename VectorE::NoView  e_generic = e;
+
+    d = d_org;
+    e = e_org;
+
+//
+//  Compare results
+//
+    const IndexType info_ = external::pttrf_impl(d, e);
+
+    bool failed = false;
+    if (! isIdentical(d_generic, d, "d_generic", "d")) {
+        std::cerr << "CXXLAPACK: d_generic = " << d_generic << std::endl;
+        std::cerr << "F77LAPACK: d = " << d << std::endl;
+        failed = true;
+    }
+
+    if (! isIdentical(e_generic, e, "e_generic", "e")) {
+        std::cerr << "CXXLAPACK: e_generic = " << e_generic << std::endl;
+        std::cerr << "F77LAPACK: e = " << e << std::endl;
+        failed = true;
+    }
+
+    if (! isIdentical(info, info_, " info", "info_")) {
+        std::cerr << "CXXLAPACK:  info = " << info << std::endl;
+        std::cerr << "F77LAPACK: info_ = " << info_ << std::endl;
+        failed = true;
+    }
+
+    if (failed) {
+        ASSERT(0);
+    }
+#   endif
+
+    return info;
+}
+
+} } // namespace lapack, flens
+
+#endif // FLENS_LAPACK_PT_PTTRF_TCC
@@ -0,0 +1,251 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* Based on
+ *
+       SUBROUTINE DPTTRS( N, NRHS, D, E, B, LDB, INFO )
+       SUBROUTINE ZPTTRS( UPLO, N, NRHS, D, E, B, LDB, INFO )
+       SUBROUTINE DPTTS2( N, NRHS, D, E, B, LDB )
+       SUBROUTINE ZPTTS2( IUPLO, N, NRHS, D, E, B, LDB )
+ *
+ *  -- LAPACK routine (version 3.3.1) --
+ *  -- LAPACK is a software package provided by Univ. of Tennessee,    --
+ *  -- Univ. of California Berkeley, Univ. of Colorado Denver and NAG Ltd..--
+ *  -- April 2011
+ */
+
+#ifndef FLENS_LAPACK_PT_PTTRS_TCC
+#define FLENS_LAPACK_PT_PTTRS_TCC 1
+
+#include <flens/blas/blas.h>
+#include <flens/lapack/lapack.h>
+
+namespace flens { namespace lapack {
+
+//== generic lapack implementation =============================================
+
+namespace generic {
+
+//-- pttrs [real and complex variant] ------------------------------------------
+
+template <typename VD, typename VE, typename MB>
+void
+pttrs_impl(const DenseVector<VD> &d, const DenseVector<VE> &e,
+           GeMatrix<MB> &B)
+{
+    using cxxblas::conjugate;
+
+    typedef typename DenseVector<VD>::ElementType  T;
+    typedef typename DenseVector<VD>::IndexType    IndexType;
+
+    const T One(1);
+
+    const IndexType n    = d.length();
+    const IndexType nRhs = B.numCols();
+
+    if (n==1) {
+        const T scale = One / d(1);
+        for (IndexType j=1; j<=nRhs; ++j) {
+            B(1,j) *= scale;
+        }
+        return;
+    }
+//
+//  Solve A * X = B using the factorization A = L*D*L**H,
+//  overwriting each right hand side vector with its solution.
+//
+    for (IndexType j=1; j<=nRhs; ++j) {
+//
+//      Solve L * x = b.
+//
+        for (IndexType i=2; i<=n; ++i) {
+            B(i,j) -= B(i-1,j)*e(i-1);
+        }
+//
+//      Solve D * L**H * x = b.
+//
+        B(n,j) /= d(n);
+        for (IndexType i=n-1; i>=1; --i) {
+            B(i,j) = B(i,j) / d(i) - B(i+1,j)*conjugate(e(i));
+        }
+    }
+}
+
+} // namespace generic
+
+//== interface for native lapack ===============================================
+
+#ifdef USE_CXXLAPACK
+
+namespace external {
+
+//-- pttrs [real variant] ------------------------------------------------------
+
+template <typename VD, typename VE, typename MB>
+typename RestrictTo<IsNotComplex<typename DenseVector<VE>::ElementType>::value,
+         void>::Type
+pttrs_impl(const DenseVector<VD> &d, const DenseVector<VE> &e,
+           GeMatrix<MB> &B)
+{
+    typedef typename DenseVector<VD>::IndexType  IndexType;
+
+    ASSERT(d.stride()==1);
+    ASSERT(e.stride()==1);
+
+    IndexType info = cxxlapack::pttrs<IndexType>(d.length(),
+                                                 B.numCols(),
+                                                 d.data(),
+                                                 e.data(),
+                                                 B.data(),
+                                                 B.leadingDimension());
+    ASSERT(info==0);
+}
+
+//-- pttrs [complex variant] ---------------------------------------------------
+
+template <typename VD, typename VE, typename MB>
+typename RestrictTo<IsComplex<typename DenseVector<VE>::ElementType>::value,
+         void>::Type
+pttrs_impl(const DenseVector<VD> &d, const DenseVector<VE> &e,
+           GeMatrix<MB> &B)
+{
+    typedef typename DenseVector<VD>::IndexType  IndexType;
+
+    ASSERT(d.stride()==1);
+    ASSERT(e.stride()==1);
+
+    IndexType info = cxxlapack::pttrs<IndexType>('L',
+                                                 d.length(),
+                                                 B.numCols(),
+                                                 d.data(),
+                                                 e.data(),
+                                                 B.data(),
+                                                 B.leadingDimension());
+    ASSERT(info==0);
+}
+
+} // namespace external
+
+#endif // USE_CXXLAPACK
+
+//== public interface ==========================================================
+
+//-- pttrs [real and complex variant] ------------------------------------------
+
+template <typename VD, typename VE, typename MB>
+typename RestrictTo<IsRealDenseVector<VD>::value
+                 && IsDenseVector<VE>::value
+                 && IsGeMatrix<MB>::value,
+         void>::Type
+pttrs(const VD &d, const VE &e, MB &&B)
+{
+    LAPACK_DEBUG_OUT("pttrs");
+
+    typedef typename VD::IndexType  IndexType;
+
+    const IndexType n = d.length();
+
+    if (n==0) {
+        return;
+    }
+
+//
+//  Test the input parameters
+//
+    ASSERT(d.firstIndex()==1);
+    ASSERT(e.firstIndex()==1);
+    ASSERT(e.length()==n-1);
+    ASSERT(B.firstRow()==1);
+    ASSERT(B.firstCol()==1);
+    ASSERT(B.numRows()==n);
+
+#   ifdef CHECK_CXXLAPACK
+//
+//  Make copies of output arguments
+//
+    typedef typename RemoveRef<MB>::Type    MatrixB;
+
+    typename MatrixB::NoView  B_org = B;
+#   endif
+
+//
+//  Call implementation
+//
+    LAPACK_SELECT::pttrs_impl(d, e, B);
+
+#   ifdef CHECK_CXXLAPACK
+//
+//  Compare results
+//
+    typename MatrixB::NoView  B_generic = B;
+
+    B = B_org;
+
+    external::pttrs_impl(d, e, B);
+
+    if (! isIdentical(B_generic, B, "B_generic", "B")) {
+        std::cerr << "CXXLAPACK: B_generic = " << B_generic << std::endl;
+        std::cerr << "F77LAPACK: B = " << B << std::endl;
+        ASSERT(0);
+    }
+#   endif
+}
+
+//-- pttrs [variant if rhs is vector] ------------------------------------------
+
+template <typename VD, typename VE, typename VB>
+typename RestrictTo<IsRealDenseVector<VD>::value
+                 && IsDenseVector<VE>::value
+                 && IsDenseVector<VB>::value,
+         void>::Type
+pttrs(const VD &d, const VE &e, VB &&b)
+{
+//
+//  Remove references from rvalue types
+//
+    typedef typename RemoveRef<VB>::Type    VectorB;
+
+    typedef typename VectorB::ElementType        ElementType;
+    typedef typename VectorB::IndexType          IndexType;
+    typedef typename VectorB::Engine::Allocator  Allocator;
+
+    const IndexType n = b.length();
+
+    GeMatrix<FullStorageView<ElementType, ColMajor, IndexOptions<IndexType>,
+                             Allocator> >  B(n, 1, b, n);
+
+    pttrs(d, e, B);
+}
+
+} } // namespace lapack, flens
+
+#endif // FLENS_LAPACK_PT_PTTRS_TCC
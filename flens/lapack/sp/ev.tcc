@@ -167,7 +167,7 @@ ev(bool     computeZ,
 //
 //  Remove references from rvalue types
 //
-    typedef typename RemoveRef<MA>::Type::Vector        WorkVector;
+    typedef typename WorkspaceVector<MA>::Type          WorkVector;
 
     WorkVector      work;
 
@@ -193,7 +193,7 @@ ev(bool     computeV,
 //
 //  Remove references from rvalue types
 //
-    typedef typename RemoveRef<MA>::Type::Vector WorkVector;
+    typedef typename WorkspaceVector<MA>::Type WorkVector;
     WorkVector work;
     return ev(computeV, A, w, work);
 }
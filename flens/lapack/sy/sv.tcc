@@ -179,7 +179,7 @@ typename RestrictTo<IsSyMatrix<MA>::value
          typename RemoveRef<MA>::Type::IndexType>::Type
 sv(MA &&A, VPIV &&piv, VB &&b)
 {
-    typedef typename RemoveRef<MA>::Type::Vector WorkVector;
+    typedef typename WorkspaceVector<MA>::Type WorkVector;
 
     WorkVector  work;
 
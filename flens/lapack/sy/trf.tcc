@@ -140,7 +140,7 @@ typename RestrictTo<IsSyMatrix<MA>::value
          typename RemoveRef<MA>::Type::IndexType>::Type
 trf(MA &&A, VPIV &&piv)
 {
-    typedef typename RemoveRef<MA>::Type::Vector WorkVector;
+    typedef typename WorkspaceVector<MA>::Type WorkVector;
 
     WorkVector  work;
 
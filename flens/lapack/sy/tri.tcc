@@ -140,7 +140,7 @@ typename RestrictTo<IsSyMatrix<MA>::value
 tri(MA          &&A,
     const VPIV  &piv)
 {
-    typedef typename RemoveRef<MA>::Type::Vector WorkVector;
+    typedef typename WorkspaceVector<MA>::Type WorkVector;
 
     WorkVector  work;
     return tri(A, piv, work);
@@ -0,0 +1,221 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* Based on
+ *
+       SUBROUTINE DTFTRI( TRANSR, UPLO, DIAG, N, A, INFO )
+       SUBROUTINE ZTFTRI( TRANSR, UPLO, DIAG, N, A, INFO )
+ *
+ *  -- LAPACK routine (version 3.3.1) --
+ *  -- LAPACK is a software package provided by Univ. of Tennessee,    --
+ *  -- Univ. of California Berkeley, Univ. of Colorado Denver and NAG Ltd..--
+ *  -- April 2011
+ */
+
+#ifndef FLENS_LAPACK_TF_TFTRI_TCC
+#define FLENS_LAPACK_TF_TFTRI_TCC 1
+
+#include <flens/blas/blas.h>
+#include <flens/lapack/lapack.h>
+
+namespace flens { namespace lapack {
+
+//== generic lapack implementation =============================================
+
+namespace generic {
+
+//-- tftri [real and complex variant] ------------------------------------------
+//
+//  For the upper triangular form U the inverse W is given by W11 = U11^{-1},
+//  W22 = U22^{-1} and W12 = -W11*U12*W22.  A lower triangular matrix L is
+//  handled as L^H = U which has the same storage as its inverse.
+//
+template <typename MA>
+typename TfMatrix<MA>::IndexType
+tftri_impl(TfMatrix<MA> &A)
+{
+    typedef typename TfMatrix<MA>::ElementType        T;
+    typedef typename TfMatrix<MA>::IndexType          IndexType;
+    typedef typename TfMatrix<MA>::Engine::BlockView  BlockView;
+
+    const T         One(1);
+    const Transpose cTrans = (IsComplex<T>::value) ? ConjTrans : Trans;
+
+    const StorageUpLo upLo = A.upLo();
+    const Diag        diag = A.diag();
+
+//
+//  Quick return if possible
+//
+    if (A.dim()==0) {
+        return 0;
+    }
+
+    const bool ct1 = rfpConjTrans(A, RfpDiag1);
+    const bool ct2 = rfpConjTrans(A, RfpDiag2);
+    const bool ctB = rfpConjTrans(A, RfpOffDiag);
+
+    TrMatrix<BlockView>  W11(A.engine().viewBlock(upLo, RfpDiag1),
+                             rfpUpLo(A, RfpDiag1), diag);
+    TrMatrix<BlockView>  W22(A.engine().viewBlock(upLo, RfpDiag2),
+                             rfpUpLo(A, RfpDiag2), diag);
+    GeMatrix<BlockView>  B(A.engine().viewBlock(upLo, RfpOffDiag));
+
+    const IndexType n1 = W11.dim();
+
+//
+//  Invert U11 and compute B := -W11*U12 or B := -U12^H*W11^H
+//
+    IndexType info = tri(W11);
+    if (info>0) {
+        return info;
+    }
+    if (!ctB) {
+        blas::mm(Left, ct1 ? cTrans : NoTrans, -One, W11, B);
+    } else {
+        blas::mm(Right, ct1 ? NoTrans : cTrans, -One, W11, B);
+    }
+//
+//  Invert U22 and compute B := B*W22 or B := W22^H*B
+//
+    info = tri(W22);
+    if (info>0) {
+        return info + n1;
+    }
+    if (!ctB) {
+        blas::mm(Right, ct2 ? cTrans : NoTrans, One, W22, B);
+    } else {
+        blas::mm(Left, ct2 ? NoTrans : cTrans, One, W22, B);
+    }
+    return 0;
+}
+
+} // namespace generic
+
+//== interface for native lapack ===============================================
+
+#ifdef USE_CXXLAPACK
+
+namespace external {
+
+//-- tftri [real and complex variant] ------------------------------------------
+
+template <typename MA>
+typename TfMatrix<MA>::IndexType
+tftri_impl(TfMatrix<MA> &A)
+{
+    typedef typename TfMatrix<MA>::ElementType  T;
+    typedef typename TfMatrix<MA>::IndexType    IndexType;
+
+    const char transR = (A.order()==ColMajor) ? 'N'
+                      : (IsComplex<T>::value) ? 'C'
+                                              : 'T';
+
+    IndexType info = cxxlapack::tftri<IndexType>(transR,
+                                                 getF77Char(A.upLo()),
+                                                 getF77Char(A.diag()),
+                                                 A.dim(),
+                                                 A.data());
+    ASSERT(info>=0);
+    return info;
+}
+
+} // namespace external
+
+#endif // USE_CXXLAPACK
+
+//== public interface ==========================================================
+
+template <typename MA>
+typename RestrictTo<IsTfMatrix<MA>::value,
+         typename RemoveRef<MA>::Type::IndexType>::Type
+tftri(MA &&A)
+{
+    LAPACK_DEBUG_OUT("tftri [real/complex]");
+
+//
+//  Remove references from rvalue types
+//
+    typedef typename RemoveRef<MA>::Type    MatrixA;
+    typedef typename MatrixA::IndexType     IndexType;
+
+//
+//  Test the input parameters
+//
+    ASSERT(A.indexBase()==1);
+
+#   ifdef CHECK_CXXLAPACK
+//
+//  Make copies of output arguments
+//
+    typename MatrixA::NoView  A_org = A;
+#   endif
+
+//
+//  Call implementation
+//
+    IndexType info = LAPACK_SELECT::tftri_impl(A);
+
+#   ifdef CHECK_CXXLAPACK
+//
+//  Compare results
+//
+    typename MatrixA::NoView  A_generic = A;
+
+    A = A_org;
+
+    IndexType info_ = external::tftri_impl(A);
+
+    bool failed = false;
+    if (! isIdentical(A_generic, A, "A_generic", "A")) {
+        std::cerr << "CXXLAPACK: A_generic = " << A_generic << std::endl;
+        std::cerr << "F77LAPACK: A = " << A << std::endl;
+        failed = true;
+    }
+
+    if (! isIdentical(info, info_, "info", "info_")) {
+        std::cerr << "CXXLAPACK: info = " << info << std::endl;
+        std::cerr << "F77LAPACK: info_ = " << info_ << std::endl;
+        failed = true;
+    }
+
+    if (failed) {
+        ASSERT(0);
+    }
+#   endif
+
+    return info;
+}
+
+} } // namespace lapack, flens
+
+#endif // FLENS_LAPACK_TF_TFTRI_TCC
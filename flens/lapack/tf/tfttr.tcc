@@ -0,0 +1,175 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* Based on
+ *
+       SUBROUTINE DTFTTR( TRANSR, UPLO, N, ARF, A, LDA, INFO )
+       SUBROUTINE ZTFTTR( TRANSR, UPLO, N, ARF, A, LDA, INFO )
+ *
+ *  -- LAPACK routine (version 3.3.1) --
+ *  -- LAPACK is a software package provided by Univ. of Tennessee,    --
+ *  -- Univ. of California Berkeley, Univ. of Colorado Denver and NAG Ltd..--
+ *  -- April 2011
+ */
+
+#ifndef FLENS_LAPACK_TF_TFTTR_TCC
+#define FLENS_LAPACK_TF_TFTTR_TCC 1
+
+#include <flens/blas/blas.h>
+#include <flens/lapack/lapack.h>
+
+namespace flens { namespace lapack {
+
+//== generic lapack implementation =============================================
+
+namespace generic {
+
+//-- tfttr [real and complex variant] ------------------------------------------
+
+template <typename MA, typename MB>
+void
+tfttr_impl(const MA &A, MB &B)
+{
+    typedef typename MA::ElementType  T;
+    typedef typename MA::IndexType    IndexType;
+
+    auto &engine = B.engine();
+
+    rfpForEach(A, [&](IndexType i, IndexType j, const T &a, bool transposed)
+                  {
+                      engine(i,j) = (transposed) ? cxxblas::conjugate(a)
+                                                    : a;
+                  });
+}
+
+} // namespace generic
+
+//== interface for native lapack ===============================================
+
+#ifdef USE_CXXLAPACK
+
+namespace external {
+
+//-- tfttr [real and complex variant] ------------------------------------------
+
+template <typename MA, typename MB>
+void
+tfttr_impl(const MA &A, MB &B)
+{
+    typedef typename MA::ElementType  T;
+    typedef typename MA::IndexType    IndexType;
+
+    ASSERT(MB::Engine::order==ColMajor);
+
+    const char transR = (A.order()==ColMajor) ? 'N'
+                      : (IsComplex<T>::value) ? 'C'
+                                              : 'T';
+
+    cxxlapack::tfttr<IndexType>(transR,
+                                getF77Char(A.upLo()),
+                                A.dim(),
+                                A.data(),
+                                B.data(),
+                                B.engine().leadingDimension());
+}
+
+} // namespace external
+
+#endif // USE_CXXLAPACK
+
+//== public interface ==========================================================
+
+template <typename MA, typename MB>
+typename RestrictTo<(IsTfMatrix<MA>::value
+                  && IsTrMatrix<MB>::value)
+                 || (IsRealSfMatrix<MA>::value
+                  && IsRealSyMatrix<MB>::value)
+                 || (IsHfMatrix<MA>::value
+                  && IsHeMatrix<MB>::value),
+         void>::Type
+tfttr(const MA &A, MB &&B)
+{
+    LAPACK_DEBUG_OUT("tfttr [real/complex]");
+
+//
+//  Remove references from rvalue types
+//
+#   ifdef CHECK_CXXLAPACK
+    typedef typename RemoveRef<MB>::Type    MatrixB;
+#   endif
+
+//
+//  Test the input parameters
+//
+    ASSERT(A.firstRow()==1);
+    ASSERT(B.firstRow()==1);
+    ASSERT(A.dim()==B.dim());
+    ASSERT(A.upLo()==B.upLo());
+
+#   ifdef CHECK_CXXLAPACK
+//
+//  Make copies of output arguments
+//
+    typename MatrixB::NoView  B_org = B;
+#   endif
+
+//
+//  Call implementation
+//
+    LAPACK_SELECT::tfttr_impl(A, B);
+
+#   ifdef CHECK_CXXLAPACK
+//
+//  Compare results
+//
+    typename MatrixB::NoView  B_generic = B;
+
+    B = B_org;
+
+    external::tfttr_impl(A, B);
+
+    bool failed = false;
+    if (! isIdentical(B_generic, B, "B_generic", "B")) {
+        std::cerr << "CXXLAPACK: B_generic = " << B_generic << std::endl;
+        std::cerr << "F77LAPACK: B = " << B << std::endl;
+        failed = true;
+    }
+
+    if (failed) {
+        ASSERT(0);
+    }
+#   endif
+}
+
+} } // namespace lapack, flens
+
+#endif // FLENS_LAPACK_TF_TFTTR_TCC
@@ -59,6 +59,13 @@ class GeCCSMatrix
             void
             operator=(const Matrix<RHS> &rhs);
 
+        // update values on the (frozen) sparsity pattern
+        const ElementType &
+        operator()(IndexType row, IndexType col) const;
+
+        ElementType &
+        operator()(IndexType row, IndexType col);
+
         // -- methods ----------------------------------------------------------
         IndexType
         numRows() const;
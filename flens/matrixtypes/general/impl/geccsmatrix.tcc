@@ -62,6 +62,20 @@ GeCCSMatrix<CCS>::operator=(const Matrix<RHS> &rhs)
     assign(rhs, *this);
 }
 
+template <typename CCS>
+const typename GeCCSMatrix<CCS>::ElementType &
+GeCCSMatrix<CCS>::operator()(IndexType row, IndexType col) const
+{
+    return engine_(row, col);
+}
+
+template <typename CCS>
+typename GeCCSMatrix<CCS>::ElementType &
+GeCCSMatrix<CCS>::operator()(IndexType row, IndexType col)
+{
+    return engine_(row, col);
+}
+
 //-- methods -------------------------------------------------------------------
 template <typename CCS>
 typename GeCCSMatrix<CCS>::IndexType
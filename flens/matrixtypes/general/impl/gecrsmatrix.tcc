@@ -62,6 +62,20 @@ GeCRSMatrix<CRS>::operator=(const Matrix<RHS> &rhs)
     assign(rhs, *this);
 }
 
+template <typename CRS>
+const typename GeCRSMatrix<CRS>::ElementType &
+GeCRSMatrix<CRS>::operator()(IndexType row, IndexType col) const
+{
+    return engine_(row, col);
+}
+
+template <typename CRS>
+typename GeCRSMatrix<CRS>::ElementType &
+GeCRSMatrix<CRS>::operator()(IndexType row, IndexType col)
+{
+    return engine_(row, col);
+}
+
 //-- methods -------------------------------------------------------------------
 template <typename CRS>
 typename GeCRSMatrix<CRS>::IndexType
@@ -129,6 +129,8 @@ class GeMatrix
 
         GeMatrix(const GeMatrix &rhs);
 
+        GeMatrix(GeMatrix &&rhs);
+
         template <typename RHS>
             GeMatrix(const GeMatrix<RHS> &rhs);
 
@@ -158,6 +160,12 @@ class GeMatrix
         GeMatrix &
         operator=(const GeMatrix &rhs);
 
+        template <typename RHS>
+            typename RestrictTo<IsSame<FS, RHS>::value
+                             && IsSame<FS, typename FS::NoView>::value,
+                     GeMatrix>::Type &
+            operator=(GeMatrix<RHS> &&rhs);
+
         template <typename RHS>
             GeMatrix &
             operator=(const Matrix<RHS> &rhs);
@@ -33,6 +33,7 @@
 #ifndef FLENS_MATRIXTYPES_GENERAL_IMPL_GEMATRIX_TCC
 #define FLENS_MATRIXTYPES_GENERAL_IMPL_GEMATRIX_TCC 1
 
+#include <cxxstd/utility.h>
 #include <flens/blas/blas.h>
 #include <flens/typedefs.h>
 
@@ -89,6 +90,12 @@ GeMatrix<FS>::GeMatrix(const GeMatrix &rhs)
 {
 }
 
+template <typename FS>
+GeMatrix<FS>::GeMatrix(GeMatrix &&rhs)
+    : engine_(std::move(rhs.engine_))
+{
+}
+
 template <typename FS>
 template <typename RHS>
 GeMatrix<FS>::GeMatrix(const GeMatrix<RHS> &rhs)
@@ -154,6 +161,29 @@ GeMatrix<FS>::operator=(const GeMatrix<FS> &rhs)
     return *this;
 }
 
+//
+//  Assignment from an expiring matrix with the same storage type takes over
+//  its memory if this matrix is empty.  Otherwise views might still refer to
+//  the memory of this matrix and the entries get copied as usual.
+//
+template <typename FS>
+template <typename RHS>
+typename RestrictTo<IsSame<FS, RHS>::value
+                 && IsSame<FS, typename FS::NoView>::value,
+         GeMatrix<FS> >::Type &
+GeMatrix<FS>::operator=(GeMatrix<RHS> &&rhs)
+{
+    if (this==&rhs) {
+        return *this;
+    }
+    if (numRows()==0 || numCols()==0) {
+        engine_.swap(rhs.engine());
+    } else {
+        assign(rhs, *this);
+    }
+    return *this;
+}
+
 template <typename FS>
 template <typename RHS>
 GeMatrix<FS> &
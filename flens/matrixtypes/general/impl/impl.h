@@ -35,10 +35,12 @@
 
 #include <flens/matrixtypes/general/impl/diagmatrix.h>
 #include <flens/matrixtypes/general/impl/gbmatrix.h>
+#include <flens/matrixtypes/general/impl/gebsrmatrix.h>
 #include <flens/matrixtypes/general/impl/geccsmatrix.h>
 #include <flens/matrixtypes/general/impl/gecoordmatrix.h>
 #include <flens/matrixtypes/general/impl/gecrsmatrix.h>
 #include <flens/matrixtypes/general/impl/gematrix.h>
+#include <flens/matrixtypes/general/impl/gesellmatrix.h>
 #include <flens/matrixtypes/general/impl/getinymatrix.h>
 #include <flens/matrixtypes/general/impl/imagmatrixclosure.h>
 #include <flens/matrixtypes/general/impl/realmatrixclosure.h>
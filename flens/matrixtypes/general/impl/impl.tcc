@@ -35,10 +35,12 @@
 
 #include <flens/matrixtypes/general/impl/diagmatrix.tcc>
 #include <flens/matrixtypes/general/impl/gbmatrix.tcc>
+#include <flens/matrixtypes/general/impl/gebsrmatrix.tcc>
 #include <flens/matrixtypes/general/impl/geccsmatrix.tcc>
 #include <flens/matrixtypes/general/impl/gecoordmatrix.tcc>
 #include <flens/matrixtypes/general/impl/gecrsmatrix.tcc>
 #include <flens/matrixtypes/general/impl/gematrix.tcc>
+#include <flens/matrixtypes/general/impl/gesellmatrix.tcc>
 #include <flens/matrixtypes/general/impl/getinymatrix.tcc>
 #include <flens/matrixtypes/general/impl/imagmatrixclosure.tcc>
 #include <flens/matrixtypes/general/impl/realmatrixclosure.tcc>
@@ -248,14 +248,14 @@ template <typename FS>
 typename HbMatrix<FS>::ConstGeneralView
 HbMatrix<FS>::general() const
 {
-    return ConstGeneralViewView(engine_, upLo_);
+    return ConstGeneralView(engine_);
 }
 
 template <typename FS>
 typename HbMatrix<FS>::GeneralView
 HbMatrix<FS>::general()
 {
-    return GeneralView(engine_, upLo_);
+    return GeneralView(engine_);
 }
 
 // symmetric view
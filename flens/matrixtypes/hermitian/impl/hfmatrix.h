@@ -0,0 +1,270 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FLENS_MATRIXTYPES_HERMITIAN_IMPL_HFMATRIX_H
+#define FLENS_MATRIXTYPES_HERMITIAN_IMPL_HFMATRIX_H 1
+
+#include <cxxblas/typedefs.h>
+#include <flens/auxiliary/auxiliary.h>
+#include <flens/matrixtypes/hermitian/hermitianmatrix.h>
+#include <flens/typedefs.h>
+
+namespace flens {
+
+// forward declarations
+template <typename A>
+    class DenseVector;
+
+template <typename RS>
+    class SfMatrix;
+
+template <typename RS>
+    class TfMatrix;
+
+//
+//  Hermitian matrix in rectangular full packed format.  Entries can be
+//  read with operator(), use lapack::trttf or lapack::tpttf to convert a
+//  HeMatrix or HpMatrix.
+//
+template <typename RS>
+class HfMatrix
+    : public HermitianMatrix<HfMatrix<RS> >
+{
+    public:
+        typedef RS                                  Engine;
+        typedef typename Engine::ElementType        ElementType;
+        typedef typename Engine::IndexType          IndexType;
+
+        // std:: typedefs
+        typedef typename Engine::size_type        size_type;
+        typedef ElementType                       value_type;
+        typedef typename Engine::pointer          pointer;
+        typedef typename Engine::const_pointer    const_pointer;
+        typedef typename Engine::reference        reference;
+        typedef typename Engine::const_reference  const_reference;
+
+        // view types from Engine
+        typedef typename Engine::ConstView          EngineConstView;
+        typedef typename Engine::View               EngineView;
+        typedef typename Engine::NoView             EngineNoView;
+
+        typedef typename Engine::ConstArrayView     ConstArrayView;
+        typedef typename Engine::ArrayView          ArrayView;
+        typedef typename Engine::Array              Array;
+
+        // view types
+        typedef DenseVector<ConstArrayView>         ConstVectorView;
+        typedef DenseVector<ArrayView>              VectorView;
+        typedef DenseVector<Array>                  Vector;
+
+        typedef HfMatrix<EngineConstView>           ConstView;
+        typedef HfMatrix<EngineView>                View;
+        typedef HfMatrix<EngineNoView>              NoView;
+
+        typedef SfMatrix<EngineConstView>           ConstSymmetricView;
+        typedef SfMatrix<EngineView>                SymmetricView;
+        typedef SfMatrix<EngineNoView>              SymmetricNoView;
+
+        typedef TfMatrix<EngineConstView>           ConstTriangularView;
+        typedef TfMatrix<EngineView>                TriangularView;
+        typedef TfMatrix<EngineNoView>              TriangularNoView;
+
+        //-- Constructors ------------------------------------------------------
+
+        HfMatrix(IndexType dim, StorageUpLo upLo);
+
+        HfMatrix(const Engine &engine, StorageUpLo upLo);
+
+        HfMatrix(const HfMatrix &rhs);
+
+        template <typename RHS>
+            HfMatrix(const HfMatrix<RHS> &rhs);
+
+        template <typename RHS>
+            HfMatrix(HfMatrix<RHS> &rhs);
+
+        //-- Operators ---------------------------------------------------------
+
+        HfMatrix &
+        operator=(const HfMatrix &rhs);
+
+        template <typename RHS>
+            HfMatrix &
+            operator=(const HfMatrix<RHS> &rhs);
+
+        ElementType
+        operator()(IndexType row, IndexType col) const;
+
+        //-- Methods -----------------------------------------------------------
+
+        IndexType
+        numRows() const;
+
+        IndexType
+        numCols() const;
+
+        IndexType
+        dim() const;
+
+        IndexType
+        firstRow() const;
+
+        IndexType
+        lastRow() const;
+
+        IndexType
+        firstCol() const;
+
+        IndexType
+        lastCol() const;
+
+        IndexType
+        indexBase() const;
+
+        StorageUpLo
+        upLo() const;
+
+        StorageUpLo &
+        upLo();
+
+        const_pointer
+        data() const;
+
+        pointer
+        data();
+
+        StorageOrder
+        order() const;
+
+        bool
+        fill(const ElementType &value = ElementType());
+
+        template <typename RHS>
+            bool
+            resize(const HfMatrix<RHS> &rhs,
+                   const ElementType &value = ElementType());
+
+        bool
+        resize(IndexType dim,
+               IndexType indexBase = Engine::defaultIndexBase,
+               const ElementType &value = ElementType());
+
+        //-- Views -------------------------------------------------------------
+
+        // hermitian views
+        const ConstView
+        hermitian() const;
+
+        View
+        hermitian();
+
+        // symmetric views
+        const ConstSymmetricView
+        symmetric() const;
+
+        SymmetricView
+        symmetric();
+
+        // triangular views
+        const ConstTriangularView
+        triangular() const;
+
+        TriangularView
+        triangular();
+
+        //-- Implementation ----------------------------------------------------
+
+        const Engine &
+        engine() const;
+
+        Engine &
+        engine();
+
+    private:
+        Engine       engine_;
+        StorageUpLo  upLo_;
+};
+
+//-- Traits --------------------------------------------------------------------
+//
+//  IsHfMatrix
+//
+struct HfMatrixChecker_
+{
+
+    struct Two {
+        char x;
+        char y;
+    };
+
+    static Two
+    check(AnyConversion_);
+
+    template <typename Any>
+        static char
+        check(HfMatrix<Any>);
+};
+
+template <typename T>
+struct IsHfMatrix
+{
+    static T var;
+    static const bool value = sizeof(HfMatrixChecker_::check(var))==1;
+};
+
+//
+//  IsRealHfMatrix
+//
+template <typename T>
+struct IsRealHfMatrix
+{
+    typedef typename std::remove_reference<T>::type  TT;
+
+    static const bool value = IsHfMatrix<TT>::value
+                           && IsNotComplex<typename TT::ElementType>::value;
+};
+
+//
+//  IsComplexHfMatrix
+//
+template <typename T>
+struct IsComplexHfMatrix
+{
+    typedef typename std::remove_reference<T>::type  TT;
+
+    static const bool value = IsHfMatrix<TT>::value
+                           && IsComplex<typename TT::ElementType>::value;
+};
+
+} // namespace flens
+
+#endif // FLENS_MATRIXTYPES_HERMITIAN_IMPL_HFMATRIX_H
@@ -0,0 +1,304 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FLENS_MATRIXTYPES_HERMITIAN_IMPL_HFMATRIX_TCC
+#define FLENS_MATRIXTYPES_HERMITIAN_IMPL_HFMATRIX_TCC 1
+
+#include <cxxstd/algorithm.h>
+#include <flens/auxiliary/auxiliary.h>
+#include <flens/matrixtypes/hermitian/impl/hfmatrix.h>
+#include <flens/typedefs.h>
+
+namespace flens {
+
+//-- Constructors --------------------------------------------------------------
+
+template <typename RS>
+HfMatrix<RS>::HfMatrix(IndexType dim, StorageUpLo upLo)
+      : engine_(dim), upLo_(upLo)
+{
+}
+
+template <typename RS>
+HfMatrix<RS>::HfMatrix(const Engine &engine, StorageUpLo upLo)
+    : engine_(engine), upLo_(upLo)
+{
+}
+
+template <typename RS>
+HfMatrix<RS>::HfMatrix(const HfMatrix &rhs)
+    : engine_(rhs.engine()), upLo_(rhs.upLo())
+{
+}
+
+template <typename RS>
+template <typename RHS>
+HfMatrix<RS>::HfMatrix(const HfMatrix<RHS> &rhs)
+    : engine_(rhs.engine()), upLo_(rhs.upLo())
+{
+}
+
+template <typename RS>
+template <typename RHS>
+HfMatrix<RS>::HfMatrix(HfMatrix<RHS> &rhs)
+    : engine_(rhs.engine()), upLo_(rhs.upLo())
+{
+}
+
+//-- Operators -----------------------------------------------------------------
+
+template <typename RS>
+HfMatrix<RS> &
+HfMatrix<RS>::operator=(const HfMatrix &rhs)
+{
+    if (this!=&rhs) {
+        ASSERT(upLo_==rhs.upLo());
+
+        engine_.resize(rhs.dim(), rhs.indexBase());
+        cxxblas::copy(engine_.numNonZeros(), rhs.data(), 1, data(), 1);
+    }
+    return *this;
+}
+
+template <typename RS>
+template <typename RHS>
+HfMatrix<RS> &
+HfMatrix<RS>::operator=(const HfMatrix<RHS> &rhs)
+{
+    ASSERT(upLo_==rhs.upLo());
+    ASSERT(order()==rhs.order());
+
+    engine_.resize(rhs.dim(), rhs.indexBase());
+    cxxblas::copy(engine_.numNonZeros(), rhs.data(), 1, data(), 1);
+    return *this;
+}
+
+template <typename RS>
+typename HfMatrix<RS>::ElementType
+HfMatrix<RS>::operator()(IndexType row, IndexType col) const
+{
+    bool conj = false;
+
+    if ((upLo_==Upper && row>col) || (upLo_==Lower && row<col)) {
+        std::swap(row, col);
+        conj = true;
+    }
+    if (engine_.transposedEntry(upLo_, row, col)) {
+        conj = !conj;
+    }
+    const ElementType &value = engine_(upLo_, row, col);
+    return (conj) ? cxxblas::conjugate(value) : value;
+}
+
+// -- methods ------------------------------------------------------------------
+
+template <typename RS>
+typename HfMatrix<RS>::IndexType
+HfMatrix<RS>::numRows() const
+{
+    return engine_.dim();
+}
+
+template <typename RS>
+typename HfMatrix<RS>::IndexType
+HfMatrix<RS>::numCols() const
+{
+    return engine_.dim();
+}
+
+template <typename RS>
+typename HfMatrix<RS>::IndexType
+HfMatrix<RS>::dim() const
+{
+    return engine_.dim();
+}
+
+template <typename RS>
+typename HfMatrix<RS>::IndexType
+HfMatrix<RS>::firstRow() const
+{
+    return engine_.indexBase();
+}
+
+template <typename RS>
+typename HfMatrix<RS>::IndexType
+HfMatrix<RS>::lastRow() const
+{
+    return firstRow()+numRows()-1;
+}
+
+template <typename RS>
+typename HfMatrix<RS>::IndexType
+HfMatrix<RS>::firstCol() const
+{
+    return engine_.indexBase();
+}
+
+template <typename RS>
+typename HfMatrix<RS>::IndexType
+HfMatrix<RS>::lastCol() const
+{
+    return firstCol()+numCols()-1;
+}
+
+template <typename RS>
+typename HfMatrix<RS>::IndexType
+HfMatrix<RS>::indexBase() const
+{
+    return engine_.indexBase();
+}
+
+template <typename RS>
+StorageUpLo
+HfMatrix<RS>::upLo() const
+{
+    return upLo_;
+}
+
+template <typename RS>
+StorageUpLo &
+HfMatrix<RS>::upLo()
+{
+    return upLo_;
+}
+
+template <typename RS>
+typename HfMatrix<RS>::const_pointer
+HfMatrix<RS>::data() const
+{
+    return engine_.data();
+}
+
+template <typename RS>
+typename HfMatrix<RS>::pointer
+HfMatrix<RS>::data()
+{
+    return engine_.data();
+}
+
+template <typename RS>
+StorageOrder
+HfMatrix<RS>::order() const
+{
+    return engine_.order;
+}
+
+template <typename RS>
+bool
+HfMatrix<RS>::fill(const ElementType &value)
+{
+    return engine_.fill(value);
+}
+
+template <typename RS>
+template <typename RHS>
+bool
+HfMatrix<RS>::resize(const HfMatrix<RHS> &rhs,
+                     const ElementType &value)
+{
+    return engine_.resize(rhs.dim(), rhs.indexBase(), value);
+}
+
+template <typename RS>
+bool
+HfMatrix<RS>::resize(IndexType dim, IndexType firstIndex,
+                     const ElementType &value)
+{
+    return engine_.resize(dim, firstIndex, value);
+}
+
+// -- views --------------------------------------------------------------------
+
+// hermitian views
+template <typename RS>
+const typename HfMatrix<RS>::ConstView
+HfMatrix<RS>::hermitian() const
+{
+    return ConstView(engine_, upLo_);
+}
+
+template <typename RS>
+typename HfMatrix<RS>::View
+HfMatrix<RS>::hermitian()
+{
+    return View(engine_, upLo_);
+}
+
+// symmetric views
+template <typename RS>
+const typename HfMatrix<RS>::ConstSymmetricView
+HfMatrix<RS>::symmetric() const
+{
+    return ConstSymmetricView(engine_, upLo_);
+}
+
+template <typename RS>
+typename HfMatrix<RS>::SymmetricView
+HfMatrix<RS>::symmetric()
+{
+    return SymmetricView(engine_, upLo_);
+}
+
+// triangular views
+template <typename RS>
+const typename HfMatrix<RS>::ConstTriangularView
+HfMatrix<RS>::triangular() const
+{
+    return ConstTriangularView(engine_, upLo_);
+}
+
+template <typename RS>
+typename HfMatrix<RS>::TriangularView
+HfMatrix<RS>::triangular()
+{
+    return TriangularView(engine_, upLo_);
+}
+
+// -- implementation -----------------------------------------------------------
+
+template <typename RS>
+const typename HfMatrix<RS>::Engine &
+HfMatrix<RS>::engine() const
+{
+    return engine_;
+}
+
+template <typename RS>
+typename HfMatrix<RS>::Engine &
+HfMatrix<RS>::engine()
+{
+    return engine_;
+}
+
+} // namespace flens
+
+#endif // FLENS_MATRIXTYPES_HERMITIAN_IMPL_HFMATRIX_TCC
@@ -37,6 +37,7 @@
 #include <flens/matrixtypes/hermitian/impl/heccsmatrix.h>
 #include <flens/matrixtypes/hermitian/impl/hecoordmatrix.h>
 #include <flens/matrixtypes/hermitian/impl/hecrsmatrix.h>
+#include <flens/matrixtypes/hermitian/impl/hfmatrix.h>
 #include <flens/matrixtypes/hermitian/impl/hematrix.h>
 #include <flens/matrixtypes/hermitian/impl/hpmatrix.h>
 
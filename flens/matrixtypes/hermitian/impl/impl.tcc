@@ -37,6 +37,7 @@
 #include <flens/matrixtypes/hermitian/impl/heccsmatrix.tcc>
 #include <flens/matrixtypes/hermitian/impl/hecoordmatrix.tcc>
 #include <flens/matrixtypes/hermitian/impl/hecrsmatrix.tcc>
+#include <flens/matrixtypes/hermitian/impl/hfmatrix.tcc>
 #include <flens/matrixtypes/hermitian/impl/hematrix.tcc>
 #include <flens/matrixtypes/hermitian/impl/hpmatrix.tcc>
 
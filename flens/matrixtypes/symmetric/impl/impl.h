@@ -34,6 +34,7 @@
 #define FLENS_MATRIXTYPES_SYMMETRIC_IMPL_IMPL_H 1
 
 #include <flens/matrixtypes/symmetric/impl/sbmatrix.h>
+#include <flens/matrixtypes/symmetric/impl/sfmatrix.h>
 #include <flens/matrixtypes/symmetric/impl/spmatrix.h>
 #include <flens/matrixtypes/symmetric/impl/syccsmatrix.h>
 #include <flens/matrixtypes/symmetric/impl/sycoordmatrix.h>
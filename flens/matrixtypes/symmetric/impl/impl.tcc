@@ -34,6 +34,7 @@
 #define FLENS_MATRIXTYPES_SYMMETRIC_IMPL_IMPL_TCC 1
 
 #include <flens/matrixtypes/symmetric/impl/sbmatrix.tcc>
+#include <flens/matrixtypes/symmetric/impl/sfmatrix.tcc>
 #include <flens/matrixtypes/symmetric/impl/spmatrix.tcc>
 #include <flens/matrixtypes/symmetric/impl/syccsmatrix.tcc>
 #include <flens/matrixtypes/symmetric/impl/sycoordmatrix.tcc>
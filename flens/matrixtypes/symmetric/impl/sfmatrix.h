@@ -0,0 +1,276 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FLENS_MATRIXTYPES_SYMMETRIC_IMPL_SFMATRIX_H
+#define FLENS_MATRIXTYPES_SYMMETRIC_IMPL_SFMATRIX_H 1
+
+#include <cxxblas/typedefs.h>
+#include <flens/auxiliary/auxiliary.h>
+#include <flens/matrixtypes/symmetric/symmetricmatrix.h>
+#include <flens/typedefs.h>
+
+namespace flens {
+
+// forward declarations
+template <typename A>
+    class DenseVector;
+
+template <typename RS>
+    class HfMatrix;
+
+template <typename RS>
+    class TfMatrix;
+
+//
+//  Symmetric matrix in rectangular full packed format.  Entries can be
+//  read with operator(), use lapack::trttf or lapack::tpttf to convert a
+//  SyMatrix or SpMatrix.  For complex element types use HfMatrix.
+//
+template <typename RS>
+class SfMatrix
+    : public SymmetricMatrix<SfMatrix<RS> >
+{
+    public:
+        typedef RS                                  Engine;
+        typedef typename Engine::ElementType        ElementType;
+        typedef typename Engine::IndexType          IndexType;
+
+        // std:: typedefs
+        typedef typename Engine::size_type        size_type;
+        typedef ElementType                       value_type;
+        typedef typename Engine::pointer          pointer;
+        typedef typename Engine::const_pointer    const_pointer;
+        typedef typename Engine::reference        reference;
+        typedef typename Engine::const_reference  const_reference;
+
+        // view types from Engine
+        typedef typename Engine::ConstView          EngineConstView;
+        typedef typename Engine::View               EngineView;
+        typedef typename Engine::NoView             EngineNoView;
+
+        typedef typename Engine::ConstArrayView     ConstArrayView;
+        typedef typename Engine::ArrayView          ArrayView;
+        typedef typename Engine::Array              Array;
+
+        // view types
+        typedef DenseVector<ConstArrayView>         ConstVectorView;
+        typedef DenseVector<ArrayView>              VectorView;
+        typedef DenseVector<Array>                  Vector;
+
+        typedef HfMatrix<EngineConstView>           ConstHermitianView;
+        typedef HfMatrix<EngineView>                HermitianView;
+        typedef HfMatrix<EngineNoView>              HermitianNoView;
+
+        typedef SfMatrix<EngineConstView>           ConstView;
+        typedef SfMatrix<EngineView>                View;
+        typedef SfMatrix<EngineNoView>              NoView;
+
+        typedef TfMatrix<EngineConstView>           ConstTriangularView;
+        typedef TfMatrix<EngineView>                TriangularView;
+        typedef TfMatrix<EngineNoView>              TriangularNoView;
+
+        //-- Constructors ------------------------------------------------------
+
+        SfMatrix(IndexType dim, StorageUpLo upLo);
+
+        SfMatrix(const Engine &engine, StorageUpLo upLo);
+
+        SfMatrix(const SfMatrix &rhs);
+
+        template <typename RHS>
+            SfMatrix(const SfMatrix<RHS> &rhs);
+
+        template <typename RHS>
+            SfMatrix(SfMatrix<RHS> &rhs);
+
+        //-- Operators ---------------------------------------------------------
+
+        SfMatrix &
+        operator=(const SfMatrix &rhs);
+
+        template <typename RHS>
+            SfMatrix &
+            operator=(const SfMatrix<RHS> &rhs);
+
+        ElementType
+        operator()(IndexType row, IndexType col) const;
+
+        SfMatrix &
+        operator*=(const ElementType &alpha);
+
+        SfMatrix &
+        operator/=(const ElementType &alpha);
+
+        //-- Methods -----------------------------------------------------------
+
+        IndexType
+        numRows() const;
+
+        IndexType
+        numCols() const;
+
+        IndexType
+        dim() const;
+
+        IndexType
+        firstRow() const;
+
+        IndexType
+        lastRow() const;
+
+        IndexType
+        firstCol() const;
+
+        IndexType
+        lastCol() const;
+
+        IndexType
+        indexBase() const;
+
+        StorageUpLo
+        upLo() const;
+
+        StorageUpLo &
+        upLo();
+
+        const_pointer
+        data() const;
+
+        pointer
+        data();
+
+        StorageOrder
+        order() const;
+
+        bool
+        fill(const ElementType &value = ElementType());
+
+        template <typename RHS>
+            bool
+            resize(const SfMatrix<RHS> &rhs,
+                   const ElementType &value = ElementType());
+
+        bool
+        resize(IndexType dim,
+               IndexType indexBase = Engine::defaultIndexBase,
+               const ElementType &value = ElementType());
+
+        //-- Views -------------------------------------------------------------
+
+        // hermitian views
+        const ConstHermitianView
+        hermitian() const;
+
+        HermitianView
+        hermitian();
+
+        // symmetric views
+        const ConstView
+        symmetric() const;
+
+        View
+        symmetric();
+
+        // triangular views
+        const ConstTriangularView
+        triangular() const;
+
+        TriangularView
+        triangular();
+
+        //-- Implementation ----------------------------------------------------
+
+        const Engine &
+        engine() const;
+
+        Engine &
+        engine();
+
+    private:
+        Engine       engine_;
+        StorageUpLo  upLo_;
+};
+
+//-- Traits --------------------------------------------------------------------
+//
+//  IsSfMatrix
+//
+struct SfMatrixChecker_
+{
+
+    struct Two {
+        char x;
+        char y;
+    };
+
+    static Two
+    check(AnyConversion_);
+
+    template <typename Any>
+        static char
+        check(SfMatrix<Any>);
+};
+
+template <typename T>
+struct IsSfMatrix
+{
+    static T var;
+    static const bool value = sizeof(SfMatrixChecker_::check(var))==1;
+};
+
+//
+//  IsRealSfMatrix
+//
+template <typename T>
+struct IsRealSfMatrix
+{
+    typedef typename std::remove_reference<T>::type  TT;
+
+    static const bool value = IsSfMatrix<TT>::value
+                           && IsNotComplex<typename TT::ElementType>::value;
+};
+
+//
+//  IsComplexSfMatrix
+//
+template <typename T>
+struct IsComplexSfMatrix
+{
+    typedef typename std::remove_reference<T>::type  TT;
+
+    static const bool value = IsSfMatrix<TT>::value
+                           && IsComplex<typename TT::ElementType>::value;
+};
+
+} // namespace flens
+
+#endif // FLENS_MATRIXTYPES_SYMMETRIC_IMPL_SFMATRIX_H
@@ -0,0 +1,318 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FLENS_MATRIXTYPES_SYMMETRIC_IMPL_SFMATRIX_TCC
+#define FLENS_MATRIXTYPES_SYMMETRIC_IMPL_SFMATRIX_TCC 1
+
+#include <flens/auxiliary/auxiliary.h>
+#include <flens/matrixtypes/symmetric/impl/sfmatrix.h>
+#include <flens/typedefs.h>
+
+namespace flens {
+
+//-- Constructors --------------------------------------------------------------
+
+template <typename RS>
+SfMatrix<RS>::SfMatrix(IndexType dim, StorageUpLo upLo)
+      : engine_(dim), upLo_(upLo)
+{
+}
+
+template <typename RS>
+SfMatrix<RS>::SfMatrix(const Engine &engine, StorageUpLo upLo)
+    : engine_(engine), upLo_(upLo)
+{
+}
+
+template <typename RS>
+SfMatrix<RS>::SfMatrix(const SfMatrix &rhs)
+    : engine_(rhs.engine()), upLo_(rhs.upLo())
+{
+}
+
+template <typename RS>
+template <typename RHS>
+SfMatrix<RS>::SfMatrix(const SfMatrix<RHS> &rhs)
+    : engine_(rhs.engine()), upLo_(rhs.upLo())
+{
+}
+
+template <typename RS>
+template <typename RHS>
+SfMatrix<RS>::SfMatrix(SfMatrix<RHS> &rhs)
+    : engine_(rhs.engine()), upLo_(rhs.upLo())
+{
+}
+
+//-- Operators -----------------------------------------------------------------
+
+template <typename RS>
+SfMatrix<RS> &
+SfMatrix<RS>::operator=(const SfMatrix &rhs)
+{
+    if (this!=&rhs) {
+        ASSERT(upLo_==rhs.upLo());
+
+        engine_.resize(rhs.dim(), rhs.indexBase());
+        cxxblas::copy(engine_.numNonZeros(), rhs.data(), 1, data(), 1);
+    }
+    return *this;
+}
+
+template <typename RS>
+template <typename RHS>
+SfMatrix<RS> &
+SfMatrix<RS>::operator=(const SfMatrix<RHS> &rhs)
+{
+    ASSERT(upLo_==rhs.upLo());
+    ASSERT(order()==rhs.order());
+
+    engine_.resize(rhs.dim(), rhs.indexBase());
+    cxxblas::copy(engine_.numNonZeros(), rhs.data(), 1, data(), 1);
+    return *this;
+}
+
+template <typename RS>
+typename SfMatrix<RS>::ElementType
+SfMatrix<RS>::operator()(IndexType row, IndexType col) const
+{
+    if ((upLo_==Upper && row>col) || (upLo_==Lower && row<col)) {
+        return engine_(upLo_, col, row);
+    }
+    return engine_(upLo_, row, col);
+}
+
+template <typename RS>
+SfMatrix<RS> &
+SfMatrix<RS>::operator*=(const ElementType &alpha)
+{
+    VectorView x = ArrayView(engine_.numNonZeros(), engine_.data());
+
+    x *= alpha;
+
+    return *this;
+}
+
+template <typename RS>
+SfMatrix<RS> &
+SfMatrix<RS>::operator/=(const ElementType &alpha)
+{
+    VectorView x = ArrayView(engine_.numNonZeros(), engine_.data());
+
+    x /= alpha;
+
+    return *this;
+}
+
+// -- methods ------------------------------------------------------------------
+
+template <typename RS>
+typename SfMatrix<RS>::IndexType
+SfMatrix<RS>::numRows() const
+{
+    return engine_.dim();
+}
+
+template <typename RS>
+typename SfMatrix<RS>::IndexType
+SfMatrix<RS>::numCols() const
+{
+    return engine_.dim();
+}
+
+template <typename RS>
+typename SfMatrix<RS>::IndexType
+SfMatrix<RS>::dim() const
+{
+    return engine_.dim();
+}
+
+template <typename RS>
+typename SfMatrix<RS>::IndexType
+SfMatrix<RS>::firstRow() const
+{
+    return engine_.indexBase();
+}
+
+template <typename RS>
+typename SfMatrix<RS>::IndexType
+SfMatrix<RS>::lastRow() const
+{
+    return firstRow()+numRows()-1;
+}
+
+template <typename RS>
+typename SfMatrix<RS>::IndexType
+SfMatrix<RS>::firstCol() const
+{
+    return engine_.indexBase();
+}
+
+template <typename RS>
+typename SfMatrix<RS>::IndexType
+SfMatrix<RS>::lastCol() const
+{
+    return firstCol()+numCols()-1;
+}
+
+template <typename RS>
+typename SfMatrix<RS>::IndexType
+SfMatrix<RS>::indexBase() const
+{
+    return engine_.indexBase();
+}
+
+template <typename RS>
+StorageUpLo
+SfMatrix<RS>::upLo() const
+{
+    return upLo_;
+}
+
+template <typename RS>
+StorageUpLo &
+SfMatrix<RS>::upLo()
+{
+    return upLo_;
+}
+
+template <typename RS>
+typename SfMatrix<RS>::const_pointer
+SfMatrix<RS>::data() const
+{
+    return engine_.data();
+}
+
+template <typename RS>
+typename SfMatrix<RS>::pointer
+SfMatrix<RS>::data()
+{
+    return engine_.data();
+}
+
+template <typename RS>
+StorageOrder
+SfMatrix<RS>::order() const
+{
+    return engine_.order;
+}
+
+template <typename RS>
+bool
+SfMatrix<RS>::fill(const ElementType &value)
+{
+    return engine_.fill(value);
+}
+
+template <typename RS>
+template <typename RHS>
+bool
+SfMatrix<RS>::resize(const SfMatrix<RHS> &rhs,
+                     const ElementType &value)
+{
+    return engine_.resize(rhs.dim(), rhs.indexBase(), value);
+}
+
+template <typename RS>
+bool
+SfMatrix<RS>::resize(IndexType dim, IndexType firstIndex,
+                     const ElementType &value)
+{
+    return engine_.resize(dim, firstIndex, value);
+}
+
+// -- views --------------------------------------------------------------------
+
+// hermitian views
+template <typename RS>
+const typename SfMatrix<RS>::ConstHermitianView
+SfMatrix<RS>::hermitian() const
+{
+    return ConstHermitianView(engine_, upLo_);
+}
+
+template <typename RS>
+typename SfMatrix<RS>::HermitianView
+SfMatrix<RS>::hermitian()
+{
+    return HermitianView(engine_, upLo_);
+}
+
+// symmetric views
+template <typename RS>
+const typename SfMatrix<RS>::ConstView
+SfMatrix<RS>::symmetric() const
+{
+    return ConstView(engine_, upLo_);
+}
+
+template <typename RS>
+typename SfMatrix<RS>::View
+SfMatrix<RS>::symmetric()
+{
+    return View(engine_, upLo_);
+}
+
+// triangular views
+template <typename RS>
+const typename SfMatrix<RS>::ConstTriangularView
+SfMatrix<RS>::triangular() const
+{
+    return ConstTriangularView(engine_, upLo_);
+}
+
+template <typename RS>
+typename SfMatrix<RS>::TriangularView
+SfMatrix<RS>::triangular()
+{
+    return TriangularView(engine_, upLo_);
+}
+
+// -- implementation -----------------------------------------------------------
+
+template <typename RS>
+const typename SfMatrix<RS>::Engine &
+SfMatrix<RS>::engine() const
+{
+    return engine_;
+}
+
+template <typename RS>
+typename SfMatrix<RS>::Engine &
+SfMatrix<RS>::engine()
+{
+    return engine_;
+}
+
+} // namespace flens
+
+#endif // FLENS_MATRIXTYPES_SYMMETRIC_IMPL_SFMATRIX_TCC
@@ -36,6 +36,7 @@
 #include <flens/matrixtypes/triangular/impl/tbmatrix.h>
 #include <flens/matrixtypes/triangular/impl/trmatrix.h>
 #include <flens/matrixtypes/triangular/impl/tpmatrix.h>
+#include <flens/matrixtypes/triangular/impl/tfmatrix.h>
 #include <flens/matrixtypes/triangular/impl/trccsmatrix.h>
 #include <flens/matrixtypes/triangular/impl/trcrsmatrix.h>
 #include <flens/matrixtypes/triangular/impl/trcoordmatrix.h>
@@ -36,6 +36,7 @@
 #include <flens/matrixtypes/triangular/impl/tbmatrix.tcc>
 #include <flens/matrixtypes/triangular/impl/trmatrix.tcc>
 #include <flens/matrixtypes/triangular/impl/tpmatrix.tcc>
+#include <flens/matrixtypes/triangular/impl/tfmatrix.tcc>
 #include <flens/matrixtypes/triangular/impl/trccsmatrix.tcc>
 #include <flens/matrixtypes/triangular/impl/trcrsmatrix.tcc>
 #include <flens/matrixtypes/triangular/impl/trcoordmatrix.tcc>
@@ -0,0 +1,283 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FLENS_MATRIXTYPES_TRIANGULAR_IMPL_TFMATRIX_H
+#define FLENS_MATRIXTYPES_TRIANGULAR_IMPL_TFMATRIX_H 1
+
+#include <cxxblas/typedefs.h>
+#include <flens/auxiliary/auxiliary.h>
+#include <flens/matrixtypes/triangular/triangularmatrix.h>
+#include <flens/typedefs.h>
+
+namespace flens {
+
+// forward declarations
+template <typename A>
+    class DenseVector;
+
+template <typename RS>
+    class HfMatrix;
+
+template <typename RS>
+    class SfMatrix;
+
+//
+//  Triangular matrix in rectangular full packed format.  Entries can be
+//  read with operator(), use lapack::trttf or lapack::tpttf to convert a
+//  TrMatrix or TpMatrix.
+//
+template <typename RS>
+class TfMatrix
+    : public TriangularMatrix<TfMatrix<RS> >
+{
+    public:
+        typedef RS                                  Engine;
+        typedef typename Engine::ElementType        ElementType;
+        typedef typename Engine::IndexType          IndexType;
+
+        // std:: typedefs
+        typedef typename Engine::size_type        size_type;
+        typedef ElementType                       value_type;
+        typedef typename Engine::pointer          pointer;
+        typedef typename Engine::const_pointer    const_pointer;
+        typedef typename Engine::reference        reference;
+        typedef typename Engine::const_reference  const_reference;
+
+        // view types from Engine
+        typedef typename Engine::ConstView          EngineConstView;
+        typedef typename Engine::View               EngineView;
+        typedef typename Engine::NoView             EngineNoView;
+
+        typedef typename Engine::ConstArrayView     ConstArrayView;
+        typedef typename Engine::ArrayView          ArrayView;
+        typedef typename Engine::Array              Array;
+
+        // view types
+        typedef DenseVector<ConstArrayView>         ConstVectorView;
+        typedef DenseVector<ArrayView>              VectorView;
+        typedef DenseVector<Array>                  Vector;
+
+        typedef HfMatrix<EngineConstView>           ConstHermitianView;
+        typedef HfMatrix<EngineView>                HermitianView;
+        typedef HfMatrix<EngineNoView>              HermitianNoView;
+
+        typedef SfMatrix<EngineConstView>           ConstSymmetricView;
+        typedef SfMatrix<EngineView>                SymmetricView;
+        typedef SfMatrix<EngineNoView>              SymmetricNoView;
+
+        typedef TfMatrix<EngineConstView>           ConstView;
+        typedef TfMatrix<EngineView>                View;
+        typedef TfMatrix<EngineNoView>              NoView;
+
+        //-- Constructors ------------------------------------------------------
+
+        TfMatrix(IndexType dim, StorageUpLo upLo, Diag diag = NonUnit);
+
+        TfMatrix(const Engine &engine, StorageUpLo upLo, Diag diag = NonUnit);
+
+        TfMatrix(const TfMatrix &rhs);
+
+        template <typename RHS>
+            TfMatrix(const TfMatrix<RHS> &rhs);
+
+        template <typename RHS>
+            TfMatrix(TfMatrix<RHS> &rhs);
+
+        //-- Operators ---------------------------------------------------------
+
+        TfMatrix &
+        operator=(const TfMatrix &rhs);
+
+        template <typename RHS>
+            TfMatrix &
+            operator=(const TfMatrix<RHS> &rhs);
+
+        ElementType
+        operator()(IndexType row, IndexType col) const;
+
+        TfMatrix &
+        operator*=(const ElementType &alpha);
+
+        TfMatrix &
+        operator/=(const ElementType &alpha);
+
+        //-- Methods -----------------------------------------------------------
+
+        IndexType
+        numRows() const;
+
+        IndexType
+        numCols() const;
+
+        IndexType
+        dim() const;
+
+        IndexType
+        firstRow() const;
+
+        IndexType
+        lastRow() const;
+
+        IndexType
+        firstCol() const;
+
+        IndexType
+        lastCol() const;
+
+        IndexType
+        indexBase() const;
+
+        StorageUpLo
+        upLo() const;
+
+        StorageUpLo &
+        upLo();
+
+        Diag
+        diag() const;
+
+        Diag &
+        diag();
+
+        const_pointer
+        data() const;
+
+        pointer
+        data();
+
+        StorageOrder
+        order() const;
+
+        bool
+        fill(const ElementType &value = ElementType());
+
+        template <typename RHS>
+            bool
+            resize(const TfMatrix<RHS> &rhs,
+                   const ElementType &value = ElementType());
+
+        bool
+        resize(IndexType dim,
+               IndexType indexBase = Engine::defaultIndexBase,
+               const ElementType &value = ElementType());
+
+        //-- Views -------------------------------------------------------------
+
+        // hermitian views
+        const ConstHermitianView
+        hermitian() const;
+
+        HermitianView
+        hermitian();
+
+        // symmetric views
+        const ConstSymmetricView
+        symmetric() const;
+
+        SymmetricView
+        symmetric();
+
+        // triangular views
+        const ConstView
+        triangular() const;
+
+        View
+        triangular();
+
+        //-- Implementation ----------------------------------------------------
+
+        const Engine &
+        engine() const;
+
+        Engine &
+        engine();
+
+    private:
+        Engine       engine_;
+        StorageUpLo  upLo_;
+        Diag         diag_;
+};
+
+//-- Traits --------------------------------------------------------------------
+//
+//  IsTfMatrix
+//
+struct TfMatrixChecker_
+{
+
+    struct Two {
+        char x;
+        char y;
+    };
+
+    static Two
+    check(AnyConversion_);
+
+    template <typename Any>
+        static char
+        check(TfMatrix<Any>);
+};
+
+template <typename T>
+struct IsTfMatrix
+{
+    static T var;
+    static const bool value = sizeof(TfMatrixChecker_::check(var))==1;
+};
+
+//
+//  IsRealTfMatrix
+//
+template <typename T>
+struct IsRealTfMatrix
+{
+    typedef typename std::remove_reference<T>::type  TT;
+
+    static const bool value = IsTfMatrix<TT>::value
+                           && IsNotComplex<typename TT::ElementType>::value;
+};
+
+//
+//  IsComplexTfMatrix
+//
+template <typename T>
+struct IsComplexTfMatrix
+{
+    typedef typename std::remove_reference<T>::type  TT;
+
+    static const bool value = IsTfMatrix<TT>::value
+                           && IsComplex<typename TT::ElementType>::value;
+};
+
+} // namespace flens
+
+#endif // FLENS_MATRIXTYPES_TRIANGULAR_IMPL_TFMATRIX_H
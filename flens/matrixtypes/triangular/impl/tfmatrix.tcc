@@ -0,0 +1,342 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FLENS_MATRIXTYPES_TRIANGULAR_IMPL_TFMATRIX_TCC
+#define FLENS_MATRIXTYPES_TRIANGULAR_IMPL_TFMATRIX_TCC 1
+
+#include <flens/auxiliary/auxiliary.h>
+#include <flens/matrixtypes/triangular/impl/tfmatrix.h>
+#include <flens/typedefs.h>
+
+namespace flens {
+
+//-- Constructors --------------------------------------------------------------
+
+template <typename RS>
+TfMatrix<RS>::TfMatrix(IndexType dim, StorageUpLo upLo, Diag diag)
+      : engine_(dim), upLo_(upLo), diag_(diag)
+{
+}
+
+template <typename RS>
+TfMatrix<RS>::TfMatrix(const Engine &engine, StorageUpLo upLo, Diag diag)
+    : engine_(engine), upLo_(upLo), diag_(diag)
+{
+}
+
+template <typename RS>
+TfMatrix<RS>::TfMatrix(const TfMatrix &rhs)
+    : engine_(rhs.engine()), upLo_(rhs.upLo()), diag_(rhs.diag())
+{
+}
+
+template <typename RS>
+template <typename RHS>
+TfMatrix<RS>::TfMatrix(const TfMatrix<RHS> &rhs)
+    : engine_(rhs.engine()), upLo_(rhs.upLo()), diag_(rhs.diag())
+{
+}
+
+template <typename RS>
+template <typename RHS>
+TfMatrix<RS>::TfMatrix(TfMatrix<RHS> &rhs)
+    : engine_(rhs.engine()), upLo_(rhs.upLo()), diag_(rhs.diag())
+{
+}
+
+//-- Operators -----------------------------------------------------------------
+
+template <typename RS>
+TfMatrix<RS> &
+TfMatrix<RS>::operator=(const TfMatrix &rhs)
+{
+    if (this!=&rhs) {
+        ASSERT(upLo_==rhs.upLo());
+
+        engine_.resize(rhs.dim(), rhs.indexBase());
+        cxxblas::copy(engine_.numNonZeros(), rhs.data(), 1, data(), 1);
+    }
+    return *this;
+}
+
+template <typename RS>
+template <typename RHS>
+TfMatrix<RS> &
+TfMatrix<RS>::operator=(const TfMatrix<RHS> &rhs)
+{
+    ASSERT(upLo_==rhs.upLo());
+    ASSERT(order()==rhs.order());
+
+    engine_.resize(rhs.dim(), rhs.indexBase());
+    cxxblas::copy(engine_.numNonZeros(), rhs.data(), 1, data(), 1);
+    return *this;
+}
+
+template <typename RS>
+typename TfMatrix<RS>::ElementType
+TfMatrix<RS>::operator()(IndexType row, IndexType col) const
+{
+#   ifndef NDEBUG
+    if (upLo_==Upper) {
+        ASSERT(col>=row);
+    } else {
+        ASSERT(col<=row);
+    }
+    ASSERT(!((diag_==Unit) && (col==row)));
+#   endif
+
+    const ElementType &value = engine_(upLo_, row, col);
+    if (engine_.transposedEntry(upLo_, row, col)) {
+        return cxxblas::conjugate(value);
+    }
+    return value;
+}
+
+template <typename RS>
+TfMatrix<RS> &
+TfMatrix<RS>::operator*=(const ElementType &alpha)
+{
+    VectorView x = ArrayView(engine_.numNonZeros(), engine_.data());
+
+    x *= alpha;
+
+    return *this;
+}
+
+template <typename RS>
+TfMatrix<RS> &
+TfMatrix<RS>::operator/=(const ElementType &alpha)
+{
+    VectorView x = ArrayView(engine_.numNonZeros(), engine_.data());
+
+    x /= alpha;
+
+    return *this;
+}
+
+// -- methods ------------------------------------------------------------------
+
+template <typename RS>
+typename TfMatrix<RS>::IndexType
+TfMatrix<RS>::numRows() const
+{
+    return engine_.dim();
+}
+
+template <typename RS>
+typename TfMatrix<RS>::IndexType
+TfMatrix<RS>::numCols() const
+{
+    return engine_.dim();
+}
+
+template <typename RS>
+typename TfMatrix<RS>::IndexType
+TfMatrix<RS>::dim() const
+{
+    return engine_.dim();
+}
+
+template <typename RS>
+typename TfMatrix<RS>::IndexType
+TfMatrix<RS>::firstRow() const
+{
+    return engine_.indexBase();
+}
+
+template <typename RS>
+typename TfMatrix<RS>::IndexType
+TfMatrix<RS>::lastRow() const
+{
+    return firstRow()+numRows()-1;
+}
+
+template <typename RS>
+typename TfMatrix<RS>::IndexType
+TfMatrix<RS>::firstCol() const
+{
+    return engine_.indexBase();
+}
+
+template <typename RS>
+typename TfMatrix<RS>::IndexType
+TfMatrix<RS>::lastCol() const
+{
+    return firstCol()+numCols()-1;
+}
+
+template <typename RS>
+typename TfMatrix<RS>::IndexType
+TfMatrix<RS>::indexBase() const
+{
+    return engine_.indexBase();
+}
+
+template <typename RS>
+StorageUpLo
+TfMatrix<RS>::upLo() const
+{
+    return upLo_;
+}
+
+template <typename RS>
+StorageUpLo &
+TfMatrix<RS>::upLo()
+{
+    return upLo_;
+}
+
+template <typename RS>
+Diag
+TfMatrix<RS>::diag() const
+{
+    return diag_;
+}
+
+template <typename RS>
+Diag &
+TfMatrix<RS>::diag()
+{
+    return diag_;
+}
+
+template <typename RS>
+typename TfMatrix<RS>::const_pointer
+TfMatrix<RS>::data() const
+{
+    return engine_.data();
+}
+
+template <typename RS>
+typename TfMatrix<RS>::pointer
+TfMatrix<RS>::data()
+{
+    return engine_.data();
+}
+
+template <typename RS>
+StorageOrder
+TfMatrix<RS>::order() const
+{
+    return engine_.order;
+}
+
+template <typename RS>
+bool
+TfMatrix<RS>::fill(const ElementType &value)
+{
+    return engine_.fill(value);
+}
+
+template <typename RS>
+template <typename RHS>
+bool
+TfMatrix<RS>::resize(const TfMatrix<RHS> &rhs,
+                     const ElementType &value)
+{
+    return engine_.resize(rhs.dim(), rhs.indexBase(), value);
+}
+
+template <typename RS>
+bool
+TfMatrix<RS>::resize(IndexType dim, IndexType firstIndex,
+                     const ElementType &value)
+{
+    return engine_.resize(dim, firstIndex, value);
+}
+
+// -- views --------------------------------------------------------------------
+
+// hermitian views
+template <typename RS>
+const typename TfMatrix<RS>::ConstHermitianView
+TfMatrix<RS>::hermitian() const
+{
+    return ConstHermitianView(engine_, upLo_);
+}
+
+template <typename RS>
+typename TfMatrix<RS>::HermitianView
+TfMatrix<RS>::hermitian()
+{
+    return HermitianView(engine_, upLo_);
+}
+
+// symmetric views
+template <typename RS>
+const typename TfMatrix<RS>::ConstSymmetricView
+TfMatrix<RS>::symmetric() const
+{
+    return ConstSymmetricView(engine_, upLo_);
+}
+
+template <typename RS>
+typename TfMatrix<RS>::SymmetricView
+TfMatrix<RS>::symmetric()
+{
+    return SymmetricView(engine_, upLo_);
+}
+
+// triangular views
+template <typename RS>
+const typename TfMatrix<RS>::ConstView
+TfMatrix<RS>::triangular() const
+{
+    return ConstView(engine_, upLo_, diag_);
+}
+
+template <typename RS>
+typename TfMatrix<RS>::View
+TfMatrix<RS>::triangular()
+{
+    return View(engine_, upLo_, diag_);
+}
+
+// -- implementation -----------------------------------------------------------
+
+template <typename RS>
+const typename TfMatrix<RS>::Engine &
+TfMatrix<RS>::engine() const
+{
+    return engine_;
+}
+
+template <typename RS>
+typename TfMatrix<RS>::Engine &
+TfMatrix<RS>::engine()
+{
+    return engine_;
+}
+
+} // namespace flens
+
+#endif // FLENS_MATRIXTYPES_TRIANGULAR_IMPL_TFMATRIX_TCC
@@ -0,0 +1,108 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FLENS_STORAGE_ALLOCATOR_ALIGNEDALLOCATOR_TCC
+#define FLENS_STORAGE_ALLOCATOR_ALIGNEDALLOCATOR_TCC 1
+
+#include <cxxstd/limits.h>
+#include <flens/storage/allocator/alignedallocator.h>
+#include <flens/storage/allocator/alignedmemory.tcc>
+
+namespace flens {
+
+template <typename T, std::size_t Alignment>
+AlignedAllocator<T, Alignment>::AlignedAllocator()
+{
+}
+
+template <typename T, std::size_t Alignment>
+template <typename S>
+AlignedAllocator<T, Alignment>::AlignedAllocator(
+                                        const AlignedAllocator<S, Alignment> &)
+{
+}
+
+template <typename T, std::size_t Alignment>
+typename AlignedAllocator<T, Alignment>::pointer
+AlignedAllocator<T, Alignment>::allocate(size_type n, const void *)
+{
+    return static_cast<pointer>(AlignedMemory::allocate(n*sizeof(T),
+                                                        Alignment));
+}
+
+template <typename T, std::size_t Alignment>
+void
+AlignedAllocator<T, Alignment>::deallocate(pointer p, size_type)
+{
+    AlignedMemory::deallocate(p);
+}
+
+template <typename T, std::size_t Alignment>
+void
+AlignedAllocator<T, Alignment>::construct(pointer p, const T &value)
+{
+    new (static_cast<void *>(p)) T(value);
+}
+
+template <typename T, std::size_t Alignment>
+void
+AlignedAllocator<T, Alignment>::destroy(pointer p)
+{
+    p->~T();
+}
+
+template <typename T, std::size_t Alignment>
+typename AlignedAllocator<T, Alignment>::size_type
+AlignedAllocator<T, Alignment>::max_size() const
+{
+    return std::numeric_limits<size_type>::max() / sizeof(T);
+}
+
+template <typename T, typename S, std::size_t Alignment>
+bool
+operator==(const AlignedAllocator<T, Alignment> &,
+           const AlignedAllocator<S, Alignment> &)
+{
+    return true;
+}
+
+template <typename T, typename S, std::size_t Alignment>
+bool
+operator!=(const AlignedAllocator<T, Alignment> &,
+           const AlignedAllocator<S, Alignment> &)
+{
+    return false;
+}
+
+} // namespace flens
+
+#endif // FLENS_STORAGE_ALLOCATOR_ALIGNEDALLOCATOR_TCC
@@ -0,0 +1,95 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FLENS_STORAGE_ALLOCATOR_ALIGNEDMEMORY_H
+#define FLENS_STORAGE_ALLOCATOR_ALIGNEDMEMORY_H 1
+
+#include <cxxstd/cstddef.h>
+
+//
+//  Low level memory routines used by the allocators in this directory.
+//
+//  AlignedMemory::allocate returns memory from malloc aligned to a given
+//  power of two.  mapPages gets fresh pages from the operating system.  These
+//  are not touched before the first write, so their NUMA placement is still
+//  open (see touchPages).  With TransparentHugePages the mapping is aligned
+//  to hugePageSize and marked for transparent huge pages.  ExplicitHugePages
+//  requests pages from the hugetlbfs pool (vm.nr_hugepages) and falls back
+//  to transparent huge pages if the pool is exhausted.  On systems other than
+//  Linux mapPages falls back to allocate.
+//
+
+namespace flens {
+
+enum HugePages {
+    NoHugePages,
+    TransparentHugePages,
+    ExplicitHugePages
+};
+
+class AlignedMemory
+{
+    public:
+        static const std::size_t cacheLineSize = 64;
+        static const std::size_t pageSize      = 4096;
+        static const std::size_t hugePageSize  = 2*1024*1024;
+
+        static void *
+        allocate(std::size_t numBytes, std::size_t alignment = cacheLineSize);
+
+        static void
+        deallocate(void *p);
+
+        static void *
+        mapPages(std::size_t numBytes, HugePages hugePages = NoHugePages);
+
+        static void
+        unmapPages(void *p, std::size_t numBytes,
+                   HugePages hugePages = NoHugePages);
+
+        //
+        //  Writes one byte in each page.  If compiled with OpenMP this is done
+        //  by all threads of a parallel region with static scheduling, i.e.
+        //  each thread touches a contiguous part.  With a first touch policy
+        //  the pages get placed on the NUMA node of the touching thread.
+        //
+        static void
+        touchPages(void *p, std::size_t numBytes);
+
+    private:
+        static std::size_t
+        mappedSize_(std::size_t numBytes, HugePages hugePages);
+};
+
+} // namespace flens
+
+#endif // FLENS_STORAGE_ALLOCATOR_ALIGNEDMEMORY_H
@@ -0,0 +1,185 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FLENS_STORAGE_ALLOCATOR_ALIGNEDMEMORY_TCC
+#define FLENS_STORAGE_ALLOCATOR_ALIGNEDMEMORY_TCC 1
+
+#include <cxxstd/cstdlib.h>
+#include <cxxstd/memory.h>
+#include <flens/auxiliary/auxiliary.h>
+#include <flens/storage/allocator/alignedmemory.h>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+namespace flens {
+
+inline void *
+AlignedMemory::allocate(std::size_t numBytes, std::size_t alignment)
+{
+    ASSERT(alignment>=sizeof(void *));
+    ASSERT((alignment & (alignment-1))==0);
+
+//
+//  The pointer returned by malloc is stored in front of the aligned block
+//
+    char *raw = static_cast<char *>(std::malloc(numBytes+alignment));
+    if (!raw) {
+        throw std::bad_alloc();
+    }
+    char *p = raw + alignment - reinterpret_cast<std::size_t>(raw) % alignment;
+
+    reinterpret_cast<char **>(p)[-1] = raw;
+    return p;
+}
+
+inline void
+AlignedMemory::deallocate(void *p)
+{
+    if (p) {
+        std::free(reinterpret_cast<char **>(p)[-1]);
+    }
+}
+
+#ifdef __linux__
+
+inline void *
+AlignedMemory::mapPages(std::size_t numBytes, HugePages hugePages)
+{
+    const std::size_t size = mappedSize_(numBytes, hugePages);
+    const int         prot = PROT_READ | PROT_WRITE;
+    const int         flag = MAP_PRIVATE | MAP_ANONYMOUS;
+
+#   ifdef MAP_HUGETLB
+    if (hugePages==ExplicitHugePages) {
+        void *p = mmap(0, size, prot, flag | MAP_HUGETLB, -1, 0);
+        if (p!=MAP_FAILED) {
+            return p;
+        }
+    }
+#   endif
+
+    if (hugePages==NoHugePages) {
+        void *p = mmap(0, size, prot, flag, -1, 0);
+        if (p==MAP_FAILED) {
+            throw std::bad_alloc();
+        }
+        return p;
+    }
+
+//
+//  Transparent huge pages require a mapping aligned to the huge page size.
+//  So we map one extra huge page and unmap what is not needed at the front
+//  and at the end.
+//
+    const std::size_t hugeSize = hugePageSize;
+    const std::size_t total    = size + hugeSize;
+
+    void *raw = mmap(0, total, prot, flag, -1, 0);
+    if (raw==MAP_FAILED) {
+        throw std::bad_alloc();
+    }
+    char *begin = static_cast<char *>(raw);
+    char *p     = begin + (hugeSize
+                           - reinterpret_cast<std::size_t>(begin) % hugeSize)
+                          % hugeSize;
+
+    if (p>begin) {
+        munmap(begin, p-begin);
+    }
+    if (p+size<begin+total) {
+        munmap(p+size, begin+total-(p+size));
+    }
+#   ifdef MADV_HUGEPAGE
+    madvise(p, size, MADV_HUGEPAGE);
+#   endif
+    return p;
+}
+
+inline void
+AlignedMemory::unmapPages(void *p, std::size_t numBytes, HugePages hugePages)
+{
+    if (p) {
+        munmap(p, mappedSize_(numBytes, hugePages));
+    }
+}
+
+#else
+
+inline void *
+AlignedMemory::mapPages(std::size_t numBytes, HugePages)
+{
+    return allocate(numBytes, pageSize);
+}
+
+inline void
+AlignedMemory::unmapPages(void *p, std::size_t, HugePages)
+{
+    deallocate(p);
+}
+
+#endif
+
+inline void
+AlignedMemory::touchPages(void *p, std::size_t numBytes)
+{
+    char       *data     = static_cast<char *>(p);
+    const long numPages  = (numBytes+pageSize-1)/pageSize;
+    const long stride    = pageSize;
+
+#   ifdef _OPENMP
+#   pragma omp parallel for schedule(static)
+#   endif
+    for (long i=0; i<numPages; ++i) {
+        data[i*stride] = 0;
+    }
+}
+
+//-- private methods -----------------------------------------------------------
+
+inline std::size_t
+AlignedMemory::mappedSize_(std::size_t numBytes, HugePages hugePages)
+{
+    const std::size_t smallPage = pageSize;
+    const std::size_t hugePage  = hugePageSize;
+    const std::size_t unit      = (hugePages==NoHugePages) ? smallPage
+                                                           : hugePage;
+    if (numBytes==0) {
+        numBytes = 1;
+    }
+    return ((numBytes+unit-1)/unit)*unit;
+}
+
+} // namespace flens
+
+#endif // FLENS_STORAGE_ALLOCATOR_ALIGNEDMEMORY_TCC
@@ -0,0 +1,99 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FLENS_STORAGE_ALLOCATOR_HUGEPAGEALLOCATOR_H
+#define FLENS_STORAGE_ALLOCATOR_HUGEPAGEALLOCATOR_H 1
+
+#include <cxxstd/cstddef.h>
+#include <flens/storage/allocator/alignedmemory.h>
+
+//
+//  Allocator for large matrices and vectors backed by huge pages to reduce
+//  TLB misses.  Requests of at least AlignedMemory::hugePageSize bytes are
+//  mapped with transparent (default) or explicit huge pages, smaller ones
+//  come from malloc aligned to a cache line.
+//
+
+namespace flens {
+
+template <typename T, HugePages Mode = TransparentHugePages>
+class HugePageAllocator
+{
+    public:
+        typedef T               value_type;
+        typedef T               *pointer;
+        typedef const T         *const_pointer;
+        typedef T               &reference;
+        typedef const T         &const_reference;
+        typedef std::size_t     size_type;
+        typedef std::ptrdiff_t  difference_type;
+
+        template <typename S>
+        struct rebind
+        {
+            typedef HugePageAllocator<S, Mode>   other;
+        };
+
+        HugePageAllocator();
+
+        template <typename S>
+            HugePageAllocator(const HugePageAllocator<S, Mode> &);
+
+        pointer
+        allocate(size_type n, const void *hint = 0);
+
+        void
+        deallocate(pointer p, size_type n);
+
+        void
+        construct(pointer p, const T &value);
+
+        void
+        destroy(pointer p);
+
+        size_type
+        max_size() const;
+};
+
+template <typename T, typename S, HugePages Mode>
+    bool
+    operator==(const HugePageAllocator<T, Mode> &,
+               const HugePageAllocator<S, Mode> &);
+
+template <typename T, typename S, HugePages Mode>
+    bool
+    operator!=(const HugePageAllocator<T, Mode> &,
+               const HugePageAllocator<S, Mode> &);
+
+} // namespace flens
+
+#endif // FLENS_STORAGE_ALLOCATOR_HUGEPAGEALLOCATOR_H
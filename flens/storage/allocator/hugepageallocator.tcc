@@ -0,0 +1,118 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FLENS_STORAGE_ALLOCATOR_HUGEPAGEALLOCATOR_TCC
+#define FLENS_STORAGE_ALLOCATOR_HUGEPAGEALLOCATOR_TCC 1
+
+#include <cxxstd/limits.h>
+#include <flens/storage/allocator/alignedmemory.tcc>
+#include <flens/storage/allocator/hugepageallocator.h>
+
+namespace flens {
+
+template <typename T, HugePages Mode>
+HugePageAllocator<T, Mode>::HugePageAllocator()
+{
+}
+
+template <typename T, HugePages Mode>
+template <typename S>
+HugePageAllocator<T, Mode>::HugePageAllocator(
+                                            const HugePageAllocator<S, Mode> &)
+{
+}
+
+template <typename T, HugePages Mode>
+typename HugePageAllocator<T, Mode>::pointer
+HugePageAllocator<T, Mode>::allocate(size_type n, const void *)
+{
+    const std::size_t numBytes = n*sizeof(T);
+
+    if (numBytes>=AlignedMemory::hugePageSize) {
+        return static_cast<pointer>(AlignedMemory::mapPages(numBytes, Mode));
+    }
+    return static_cast<pointer>(AlignedMemory::allocate(numBytes));
+}
+
+template <typename T, HugePages Mode>
+void
+HugePageAllocator<T, Mode>::deallocate(pointer p, size_type n)
+{
+    const std::size_t numBytes = n*sizeof(T);
+
+    if (numBytes>=AlignedMemory::hugePageSize) {
+        AlignedMemory::unmapPages(p, numBytes, Mode);
+    } else {
+        AlignedMemory::deallocate(p);
+    }
+}
+
+template <typename T, HugePages Mode>
+void
+HugePageAllocator<T, Mode>::construct(pointer p, const T &value)
+{
+    new (static_cast<void *>(p)) T(value);
+}
+
+template <typename T, HugePages Mode>
+void
+HugePageAllocator<T, Mode>::destroy(pointer p)
+{
+    p->~T();
+}
+
+template <typename T, HugePages Mode>
+typename HugePageAllocator<T, Mode>::size_type
+HugePageAllocator<T, Mode>::max_size() const
+{
+    return std::numeric_limits<size_type>::max() / sizeof(T);
+}
+
+template <typename T, typename S, HugePages Mode>
+bool
+operator==(const HugePageAllocator<T, Mode> &,
+           const HugePageAllocator<S, Mode> &)
+{
+    return true;
+}
+
+template <typename T, typename S, HugePages Mode>
+bool
+operator!=(const HugePageAllocator<T, Mode> &,
+           const HugePageAllocator<S, Mode> &)
+{
+    return false;
+}
+
+} // namespace flens
+
+#endif // FLENS_STORAGE_ALLOCATOR_HUGEPAGEALLOCATOR_TCC
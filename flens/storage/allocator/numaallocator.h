@@ -0,0 +1,117 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FLENS_STORAGE_ALLOCATOR_NUMAALLOCATOR_H
+#define FLENS_STORAGE_ALLOCATOR_NUMAALLOCATOR_H 1
+
+#include <cxxstd/cstddef.h>
+#include <flens/storage/allocator/alignedmemory.h>
+
+//
+//  Allocator controlling the NUMA placement of large allocations (at least
+//  NumaAllocator::minMappedSize bytes).  These get fresh pages from the
+//  operating system:
+//
+//   - NumaFirstTouch: the pages are touched in parallel by the OpenMP threads
+//     (see AlignedMemory::touchPages) so that they are distributed over the
+//     nodes the threads run on.  Kernels that split the data with a static
+//     schedule then mostly access local memory.  Without OpenMP the pages
+//     get placed on the node of the allocating thread.
+//   - NumaInterleave: pages are interleaved round-robin over all nodes.  This
+//     requires libnuma (compile with -DWITH_LIBNUMA, link with -lnuma),
+//     otherwise first touch placement is used.
+//
+//  Note that the initial fill in FullStorage or Array happens after the
+//  allocation and does not change the placement.
+//
+
+namespace flens {
+
+enum NumaPlacement {
+    NumaFirstTouch,
+    NumaInterleave
+};
+
+template <typename T, NumaPlacement Placement = NumaFirstTouch>
+class NumaAllocator
+{
+    public:
+        typedef T               value_type;
+        typedef T               *pointer;
+        typedef const T         *const_pointer;
+        typedef T               &reference;
+        typedef const T         &const_reference;
+        typedef std::size_t     size_type;
+        typedef std::ptrdiff_t  difference_type;
+
+        static const std::size_t minMappedSize = 16*AlignedMemory::pageSize;
+
+        template <typename S>
+        struct rebind
+        {
+            typedef NumaAllocator<S, Placement>   other;
+        };
+
+        NumaAllocator();
+
+        template <typename S>
+            NumaAllocator(const NumaAllocator<S, Placement> &);
+
+        pointer
+        allocate(size_type n, const void *hint = 0);
+
+        void
+        deallocate(pointer p, size_type n);
+
+        void
+        construct(pointer p, const T &value);
+
+        void
+        destroy(pointer p);
+
+        size_type
+        max_size() const;
+};
+
+template <typename T, typename S, NumaPlacement Placement>
+    bool
+    operator==(const NumaAllocator<T, Placement> &,
+               const NumaAllocator<S, Placement> &);
+
+template <typename T, typename S, NumaPlacement Placement>
+    bool
+    operator!=(const NumaAllocator<T, Placement> &,
+               const NumaAllocator<S, Placement> &);
+
+} // namespace flens
+
+#endif // FLENS_STORAGE_ALLOCATOR_NUMAALLOCATOR_H
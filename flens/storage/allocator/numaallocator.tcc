@@ -0,0 +1,132 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FLENS_STORAGE_ALLOCATOR_NUMAALLOCATOR_TCC
+#define FLENS_STORAGE_ALLOCATOR_NUMAALLOCATOR_TCC 1
+
+#include <cxxstd/limits.h>
+#include <flens/storage/allocator/alignedmemory.tcc>
+#include <flens/storage/allocator/numaallocator.h>
+
+#ifdef WITH_LIBNUMA
+#include <numa.h>
+#endif
+
+namespace flens {
+
+template <typename T, NumaPlacement Placement>
+NumaAllocator<T, Placement>::NumaAllocator()
+{
+}
+
+template <typename T, NumaPlacement Placement>
+template <typename S>
+NumaAllocator<T, Placement>::NumaAllocator(const NumaAllocator<S, Placement> &)
+{
+}
+
+template <typename T, NumaPlacement Placement>
+typename NumaAllocator<T, Placement>::pointer
+NumaAllocator<T, Placement>::allocate(size_type n, const void *)
+{
+    const std::size_t numBytes = n*sizeof(T);
+
+    if (numBytes<minMappedSize) {
+        return static_cast<pointer>(AlignedMemory::allocate(numBytes));
+    }
+
+    void *p = AlignedMemory::mapPages(numBytes);
+
+#   ifdef WITH_LIBNUMA
+    if (Placement==NumaInterleave && numa_available()>=0) {
+        numa_interleave_memory(p, numBytes, numa_all_nodes_ptr);
+        return static_cast<pointer>(p);
+    }
+#   endif
+
+    AlignedMemory::touchPages(p, numBytes);
+    return static_cast<pointer>(p);
+}
+
+template <typename T, NumaPlacement Placement>
+void
+NumaAllocator<T, Placement>::deallocate(pointer p, size_type n)
+{
+    const std::size_t numBytes = n*sizeof(T);
+
+    if (numBytes<minMappedSize) {
+        AlignedMemory::deallocate(p);
+    } else {
+        AlignedMemory::unmapPages(p, numBytes);
+    }
+}
+
+template <typename T, NumaPlacement Placement>
+void
+NumaAllocator<T, Placement>::construct(pointer p, const T &value)
+{
+    new (static_cast<void *>(p)) T(value);
+}
+
+template <typename T, NumaPlacement Placement>
+void
+NumaAllocator<T, Placement>::destroy(pointer p)
+{
+    p->~T();
+}
+
+template <typename T, NumaPlacement Placement>
+typename NumaAllocator<T, Placement>::size_type
+NumaAllocator<T, Placement>::max_size() const
+{
+    return std::numeric_limits<size_type>::max() / sizeof(T);
+}
+
+template <typename T, typename S, NumaPlacement Placement>
+bool
+operator==(const NumaAllocator<T, Placement> &,
+           const NumaAllocator<S, Placement> &)
+{
+    return true;
+}
+
+template <typename T, typename S, NumaPlacement Placement>
+bool
+operator!=(const NumaAllocator<T, Placement> &,
+           const NumaAllocator<S, Placement> &)
+{
+    return false;
+}
+
+} // namespace flens
+
+#endif // FLENS_STORAGE_ALLOCATOR_NUMAALLOCATOR_TCC
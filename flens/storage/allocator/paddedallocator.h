@@ -0,0 +1,103 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FLENS_STORAGE_ALLOCATOR_PADDEDALLOCATOR_H
+#define FLENS_STORAGE_ALLOCATOR_PADDEDALLOCATOR_H 1
+
+#include <cxxstd/cstddef.h>
+#include <cxxstd/memory.h>
+
+//
+//  PaddedAllocator<A> allocates like A but tells FullStorage to pad the
+//  leading dimension:  it gets rounded up to a multiple of a cache line and
+//  if the resulting stride is a multiple of LeadingDimension::criticalStride
+//  bytes one more cache line is added.  Otherwise consecutive columns (rows
+//  for RowMajor) map to the same cache sets and evict each other.  Short
+//  columns (less than minPaddedSize bytes) are not padded.  Combined with an
+//  aligned allocator each column starts on a cache line, e.g.
+//
+//      typedef PaddedAllocator<AlignedAllocator<double> >      Allocator;
+//      typedef GeMatrix<FullStorage<double, ColMajor,
+//                                   IndexOptions<>, Allocator> >  Matrix;
+//
+//  A padded FullStorage can not be viewed as a single array (arrayView).
+//
+
+namespace flens {
+
+template <typename A>
+class PaddedAllocator
+    : public A
+{
+    public:
+        template <typename S>
+        struct rebind
+        {
+            typedef typename A::template rebind<S>::other  Other;
+            typedef PaddedAllocator<Other>                  other;
+        };
+
+        PaddedAllocator();
+
+        PaddedAllocator(const A &allocator);
+
+        template <typename B>
+            PaddedAllocator(const PaddedAllocator<B> &rhs);
+};
+
+//
+//  LeadingDimension<A>::get(n) returns the leading dimension used by
+//  FullStorage with allocator A for columns (rows) of length n.
+//
+template <typename A>
+struct LeadingDimension
+{
+    template <typename IndexType>
+        static IndexType
+        get(IndexType n);
+};
+
+template <typename A>
+struct LeadingDimension<PaddedAllocator<A> >
+{
+    static const std::size_t cacheLineSize  = 64;
+    static const std::size_t criticalStride = 1024;
+    static const std::size_t minPaddedSize  = 256;
+
+    template <typename IndexType>
+        static IndexType
+        get(IndexType n);
+};
+
+} // namespace flens
+
+#endif // FLENS_STORAGE_ALLOCATOR_PADDEDALLOCATOR_H
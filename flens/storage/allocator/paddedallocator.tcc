@@ -0,0 +1,92 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FLENS_STORAGE_ALLOCATOR_PADDEDALLOCATOR_TCC
+#define FLENS_STORAGE_ALLOCATOR_PADDEDALLOCATOR_TCC 1
+
+#include <flens/storage/allocator/paddedallocator.h>
+
+namespace flens {
+
+template <typename A>
+PaddedAllocator<A>::PaddedAllocator()
+{
+}
+
+template <typename A>
+PaddedAllocator<A>::PaddedAllocator(const A &allocator)
+    : A(allocator)
+{
+}
+
+template <typename A>
+template <typename B>
+PaddedAllocator<A>::PaddedAllocator(const PaddedAllocator<B> &rhs)
+    : A(static_cast<const B &>(rhs))
+{
+}
+
+//-- LeadingDimension ----------------------------------------------------------
+
+template <typename A>
+template <typename IndexType>
+IndexType
+LeadingDimension<A>::get(IndexType n)
+{
+    return n;
+}
+
+template <typename A>
+template <typename IndexType>
+IndexType
+LeadingDimension<PaddedAllocator<A> >::get(IndexType n)
+{
+    typedef typename A::value_type  T;
+
+    const std::size_t elementSize = sizeof(T);
+
+    if (n*elementSize<minPaddedSize || elementSize>cacheLineSize) {
+        return n;
+    }
+
+    const IndexType lineLength = cacheLineSize/elementSize;
+
+    IndexType ld = ((n+lineLength-1)/lineLength)*lineLength;
+    if ((ld*elementSize) % criticalStride==0) {
+        ld += lineLength;
+    }
+    return ld;
+}
+
+} // namespace flens
+
+#endif // FLENS_STORAGE_ALLOCATOR_PADDEDALLOCATOR_TCC
@@ -78,6 +78,8 @@ class Array
 
         Array(const Array &rhs);
 
+        Array(Array &&rhs);
+
         template <typename RHS>
             Array(const RHS &rhs);
 
@@ -137,6 +139,9 @@ class Array
         void
         changeIndexBase(IndexType firstIndex);
 
+        void
+        swap(Array &rhs);
+
         const ConstView
         view(IndexType from, IndexType to,
              IndexType stride = IndexType(1),
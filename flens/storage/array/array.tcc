@@ -80,6 +80,17 @@ Array<T, I, A>::Array(const Array &rhs)
     }
 }
 
+template <typename T, typename I, typename A>
+Array<T, I, A>::Array(Array &&rhs)
+    : data_(rhs.data_),
+      length_(rhs.length_),
+      firstIndex_(rhs.firstIndex_),
+      allocator_(rhs.allocator_)
+{
+    rhs.data_   = pointer();
+    rhs.length_ = 0;
+}
+
 template <typename T, typename I, typename A>
 template <typename RHS>
 Array<T, I, A>::Array(const RHS &rhs)
@@ -232,6 +243,16 @@ Array<T, I, A>::changeIndexBase(IndexType firstIndex)
     firstIndex_ = firstIndex;
 }
 
+template <typename T, typename I, typename A>
+void
+Array<T, I, A>::swap(Array &rhs)
+{
+    std::swap(data_, rhs.data_);
+    std::swap(length_, rhs.length_);
+    std::swap(firstIndex_, rhs.firstIndex_);
+    std::swap(allocator_, rhs.allocator_);
+}
+
 template <typename T, typename I, typename A>
 const typename Array<T, I, A>::ConstView
 Array<T, I, A>::view(IndexType from, IndexType to,
@@ -292,6 +313,7 @@ Array<T, I, A>::raw_allocate_()
     if (length()>0) {
         data_ = allocator_.allocate(length_);
         ASSERT(data_!=pointer());
+        default_construct_n(data_, length_);
     }
 }
 
@@ -300,7 +322,7 @@ void
 Array<T, I, A>::allocate_(const ElementType &value)
 {
     raw_allocate_();
-    flens::alg::uninitialized_fill_n(data(), length(), value);
+    flens::alg::fill_n(data(), length(), value);
 }
 
 template <typename T, typename I, typename A>
@@ -309,8 +331,7 @@ Array<T, I, A>::release_()
 {
     if (data_ != pointer()) {
         ASSERT(length()>0);
-        // XXX: Assume T is trivially destructible
-        // TODO: std::destroy(first, last, alloc).  See gcc's std::_Destroy
+        destroy_n(data(), length());
         allocator_.deallocate(data(), length());
         data_ = pointer();
     }
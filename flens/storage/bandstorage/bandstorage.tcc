@@ -525,13 +525,13 @@ BandStorage<T, Order, I, A>::viewDiags(IndexType fromDiag,
 
     if (Order == RowMajor ) {
         if (toDiag < 0) {
-            return ConstView(numRows, numCols, -fromDiag+toDiag, pointer(),
+            return ConstView(numRows, numCols, -fromDiag+toDiag, IndexType(0),
                              &(operator()(i,j)) + fromDiag-toDiag,
                              numSubDiags_+numSuperDiags_+1,
                              firstIndex_, allocator_);
         }
         if (fromDiag > 0) {
-            return ConstView(numRows, numCols, pointer(), toDiag-fromDiag,
+            return ConstView(numRows, numCols, IndexType(0), toDiag-fromDiag,
                              &(operator()(i,j)),
                              numSubDiags_+numSuperDiags_+1,
                              firstIndex_, allocator_);
@@ -543,13 +543,13 @@ BandStorage<T, Order, I, A>::viewDiags(IndexType fromDiag,
     }
 
     if (toDiag < 0) {
-        return ConstView(numRows, numCols, -fromDiag+toDiag, pointer(),
+        return ConstView(numRows, numCols, -fromDiag+toDiag, IndexType(0),
                          &(operator()(i,j)),
                          numSubDiags_+numSuperDiags_+1,
                          firstIndex_, allocator_);
     }
     if (fromDiag > 0) {
-        return ConstView(numRows, numCols, pointer(), toDiag-fromDiag,
+        return ConstView(numRows, numCols, IndexType(0), toDiag-fromDiag,
                          &(operator()(i,j)) + fromDiag-toDiag,
                          numSubDiags_+numSuperDiags_+1,
                          firstIndex_, allocator_);
@@ -894,9 +894,11 @@ BandStorage<T, Order, I, A>::raw_allocate_()
     const IndexType m = numSubDiags_+numSuperDiags_+1;
     if (Order==ColMajor) {
         data_ = allocator_.allocate(m*numCols_);
+        default_construct_n(data_, m*numCols_);
     }
     else {
         data_ = allocator_.allocate(m*numRows_);
+        default_construct_n(data_, m*numRows_);
     }
 
     setIndexBase_(firstIndex_);
@@ -906,7 +908,7 @@ template <typename T, StorageOrder Order, typename I, typename A>
 void
 BandStorage<T, Order, I, A>::allocate_(const ElementType &value)
 {
-    if (numRows()*numCols()==0) {
+    if (numRows()==0 || numCols()==0) {
         return;
     }
 
@@ -918,7 +920,7 @@ BandStorage<T, Order, I, A>::allocate_(const ElementType &value)
         numArrayElements = (numSubDiags_+numSuperDiags_+1)*numRows_;
     }
 
-    flens::alg::uninitialized_fill_n(data(), numArrayElements, value);
+    flens::alg::fill_n(data(), numArrayElements, value);
 }
 
 template <typename T, StorageOrder Order, typename I, typename A>
@@ -931,8 +933,7 @@ BandStorage<T, Order, I, A>::release_()
             numElements = (numSubDiags_+numSuperDiags_+1)*numRows_;
         else
             numElements = (numSubDiags_+numSuperDiags_+1)*numCols_;
-        // XXX: Assume T is trivially destructible
-        // TODO: std::destroy(first, last, alloc).  See gcc's std::_Destroy
+        destroy_n(data(), numElements);
         allocator_.deallocate(data(), numElements);
         data_ = pointer();
     }
@@ -475,13 +475,13 @@ BandStorageView<T, Order, I, A>::viewDiags(IndexType fromDiag,
 
     if (Order == RowMajor ) {
         if (toDiag < 0) {
-            return ConstView(numRows, numCols, -fromDiag+toDiag, pointer(),
+            return ConstView(numRows, numCols, -fromDiag+toDiag, IndexType(0),
                              &(operator()(i,j)) + fromDiag-toDiag,
                             leadingDimension_,
                              firstIndex_, allocator_);
         }
         if (fromDiag > 0) {
-            return ConstView(numRows, numCols, pointer(), toDiag-fromDiag,
+            return ConstView(numRows, numCols, IndexType(0), toDiag-fromDiag,
                              &(operator()(i,j)),
                              leadingDimension_,
                              firstIndex_, allocator_);
@@ -493,13 +493,13 @@ BandStorageView<T, Order, I, A>::viewDiags(IndexType fromDiag,
     }
 
     if (toDiag < 0) {
-        return ConstView(numRows, numCols, -fromDiag+toDiag, pointer(),
+        return ConstView(numRows, numCols, -fromDiag+toDiag, IndexType(0),
                          &(operator()(i,j)),
                          leadingDimension_,
                          firstIndex_, allocator_);
     }
     if (fromDiag > 0) {
-        return ConstView(numRows, numCols, pointer(), toDiag-fromDiag,
+        return ConstView(numRows, numCols, IndexType(0), toDiag-fromDiag,
                          &(operator()(i,j)) + fromDiag-toDiag,
                          leadingDimension_,
                          firstIndex_, allocator_);
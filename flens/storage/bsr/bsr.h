@@ -0,0 +1,141 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FLENS_STORAGE_BSR_BSR_H
+#define FLENS_STORAGE_BSR_BSR_H 1
+
+#include <flens/vectortypes/impl/densevector.h>
+#include <flens/storage/array/array.h>
+#include <flens/storage/crs/crs.h>
+#include <flens/storage/indexoptions.h>
+
+namespace flens {
+
+//
+//  Block compressed row storage with a compile-time block size BS.
+//
+//  rows() and cols() are the CRS structure of the block pattern, i.e. they
+//  refer to block rows and block columns (w.r.t. indexBase()).  Block k is
+//  stored dense and row-major in values() starting at position
+//  indexBase() + (k-indexBase())*BS*BS.  numRows() and numCols() are the
+//  scalar dimensions and have to be multiples of BS.
+//
+template <typename T,
+          int BS,
+          typename I = IndexOptions<> >
+class BSR
+{
+    public:
+        typedef T                                   ElementType;
+        typedef typename I::IndexType               IndexType;
+
+        typedef DenseVector<Array<ElementType> >    ElementTypeVector;
+        typedef DenseVector<Array<IndexType> >      IndexTypeVector;
+
+        static const int blockSize = BS;
+
+        BSR();
+
+        ~BSR();
+
+        //-- operators ---------------------------------------------------------
+
+        template <typename T2, typename I2>
+            void
+            operator=(const CRS<T2, I2> &crs);
+
+        //-- methods -----------------------------------------------------------
+
+        const IndexType
+        indexBase() const;
+
+        const IndexType
+        firstRow() const;
+
+        const IndexType
+        lastRow() const;
+
+        const IndexType
+        firstCol() const;
+
+        const IndexType
+        lastCol() const;
+
+        const IndexType
+        numRows() const;
+
+        const IndexType
+        numCols() const;
+
+        const IndexType
+        numBlockRows() const;
+
+        const IndexType
+        numBlockCols() const;
+
+        const IndexType
+        numNonZeroBlocks() const;
+
+        // stored entries, i.e. including explicit zeros inside blocks
+        const IndexType
+        numNonZeros() const;
+
+        const IndexTypeVector &
+        rows() const;
+
+        const IndexTypeVector &
+        cols() const;
+
+        const ElementTypeVector &
+        values() const;
+
+        ElementTypeVector &
+        values();
+
+        template <typename T2, typename I2>
+            void
+            convert_(const CRS<T2, I2> &crs);
+
+    private:
+        BSR(const BSR &rhs);
+
+        IndexType  numRows_, numCols_;
+        IndexType  indexBase_;
+
+        DenseVector<Array<IndexType> >  rows_;
+        DenseVector<Array<IndexType> >  cols_;
+        DenseVector<Array<T> >          values_;
+};
+
+} // namespace flens
+
+#endif // FLENS_STORAGE_BSR_BSR_H
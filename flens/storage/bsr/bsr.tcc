@@ -0,0 +1,255 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FLENS_STORAGE_BSR_BSR_TCC
+#define FLENS_STORAGE_BSR_BSR_TCC 1
+
+#include <cxxstd/algorithm.h>
+#include <cxxstd/vector.h>
+#include <flens/auxiliary/auxiliary.h>
+#include <flens/storage/bsr/bsr.h>
+
+namespace flens {
+
+template <typename T, int BS, typename I>
+BSR<T,BS,I>::BSR()
+    : numRows_(0), numCols_(0),
+      indexBase_(I::defaultIndexBase)
+{
+}
+
+template <typename T, int BS, typename I>
+BSR<T,BS,I>::~BSR()
+{
+}
+
+//-- operators -----------------------------------------------------------------
+
+template <typename T, int BS, typename I>
+template <typename T2, typename I2>
+void
+BSR<T,BS,I>::operator=(const CRS<T2, I2> &crs)
+{
+    convert_(crs);
+}
+
+//-- methods -------------------------------------------------------------------
+
+template <typename T, int BS, typename I>
+const typename BSR<T,BS,I>::IndexType
+BSR<T,BS,I>::indexBase() const
+{
+    return indexBase_;
+}
+
+template <typename T, int BS, typename I>
+const typename BSR<T,BS,I>::IndexType
+BSR<T,BS,I>::firstRow() const
+{
+    return indexBase_;
+}
+
+template <typename T, int BS, typename I>
+const typename BSR<T,BS,I>::IndexType
+BSR<T,BS,I>::lastRow() const
+{
+    return indexBase_+numRows_-1;
+}
+
+template <typename T, int BS, typename I>
+const typename BSR<T,BS,I>::IndexType
+BSR<T,BS,I>::firstCol() const
+{
+    return indexBase_;
+}
+
+template <typename T, int BS, typename I>
+const typename BSR<T,BS,I>::IndexType
+BSR<T,BS,I>::lastCol() const
+{
+    return indexBase_+numCols_-1;
+}
+
+template <typename T, int BS, typename I>
+const typename BSR<T,BS,I>::IndexType
+BSR<T,BS,I>::numRows() const
+{
+    return numRows_;
+}
+
+template <typename T, int BS, typename I>
+const typename BSR<T,BS,I>::IndexType
+BSR<T,BS,I>::numCols() const
+{
+    return numCols_;
+}
+
+template <typename T, int BS, typename I>
+const typename BSR<T,BS,I>::IndexType
+BSR<T,BS,I>::numBlockRows() const
+{
+    return numRows_/BS;
+}
+
+template <typename T, int BS, typename I>
+const typename BSR<T,BS,I>::IndexType
+BSR<T,BS,I>::numBlockCols() const
+{
+    return numCols_/BS;
+}
+
+template <typename T, int BS, typename I>
+const typename BSR<T,BS,I>::IndexType
+BSR<T,BS,I>::numNonZeroBlocks() const
+{
+    return cols_.length();
+}
+
+template <typename T, int BS, typename I>
+const typename BSR<T,BS,I>::IndexType
+BSR<T,BS,I>::numNonZeros() const
+{
+    return values_.length();
+}
+
+template <typename T, int BS, typename I>
+const typename BSR<T,BS,I>::IndexTypeVector &
+BSR<T,BS,I>::rows() const
+{
+    return rows_;
+}
+
+template <typename T, int BS, typename I>
+const typename BSR<T,BS,I>::IndexTypeVector &
+BSR<T,BS,I>::cols() const
+{
+    return cols_;
+}
+
+template <typename T, int BS, typename I>
+const typename BSR<T,BS,I>::ElementTypeVector &
+BSR<T,BS,I>::values() const
+{
+    return values_;
+}
+
+template <typename T, int BS, typename I>
+typename BSR<T,BS,I>::ElementTypeVector &
+BSR<T,BS,I>::values()
+{
+    return values_;
+}
+
+template <typename T, int BS, typename I>
+template <typename T2, typename I2>
+void
+BSR<T,BS,I>::convert_(const CRS<T2, I2> &crs)
+{
+    ASSERT(crs.numRows()%BS==0);
+    ASSERT(crs.numCols()%BS==0);
+
+    numRows_   = crs.numRows();
+    numCols_   = crs.numCols();
+    indexBase_ = crs.indexBase();
+
+    const auto &ia = crs.rows();
+    const auto &ja = crs.cols();
+    const auto &a  = crs.values();
+
+    const IndexType b  = indexBase_;
+    const IndexType mb = numRows_/BS;
+    const IndexType nb = numCols_/BS;
+
+//
+//  First pass: block pattern.  pos[jB] is the position of block column jB
+//  within the current block row (or -1).
+//
+    std::vector<IndexType>  pos(nb, IndexType(-1));
+    std::vector<IndexType>  blockCols;
+    std::vector<IndexType>  blockRowPtr(mb+1, 0);
+
+    for (IndexType iB=0; iB<mb; ++iB) {
+        const IndexType first = blockCols.size();
+        for (IndexType i=b+iB*BS; i<b+iB*BS+BS; ++i) {
+            for (IndexType k=ia(i); k<ia(i+1); ++k) {
+                const IndexType jB = (ja(k)-b)/BS;
+                if (pos[jB]<0) {
+                    pos[jB] = 0;
+                    blockCols.push_back(jB);
+                }
+            }
+        }
+        std::sort(blockCols.begin()+first, blockCols.end());
+        for (IndexType k=first; k<IndexType(blockCols.size()); ++k) {
+            pos[blockCols[k]] = -1;
+        }
+        blockRowPtr[iB+1] = blockCols.size();
+    }
+
+    const IndexType nnzb = blockCols.size();
+
+    rows_.resize(mb+1, b);
+    cols_.resize(nnzb, b);
+    values_.resize(nnzb*BS*BS, b);
+    values_ = T(0);
+
+    for (IndexType iB=0; iB<=mb; ++iB) {
+        rows_(b+iB) = b + blockRowPtr[iB];
+    }
+    for (IndexType k=0; k<nnzb; ++k) {
+        cols_(b+k) = b + blockCols[k];
+    }
+
+//
+//  Second pass: scatter the values into the dense blocks
+//
+    for (IndexType iB=0; iB<mb; ++iB) {
+        for (IndexType k=blockRowPtr[iB]; k<blockRowPtr[iB+1]; ++k) {
+            pos[blockCols[k]] = k;
+        }
+        for (IndexType r=0; r<BS; ++r) {
+            const IndexType i = b+iB*BS+r;
+            for (IndexType k=ia(i); k<ia(i+1); ++k) {
+                const IndexType jB = (ja(k)-b)/BS;
+                const IndexType c = (ja(k)-b)%BS;
+                values_(b + pos[jB]*BS*BS + r*BS + c) = a(k);
+            }
+        }
+        for (IndexType k=blockRowPtr[iB]; k<blockRowPtr[iB+1]; ++k) {
+            pos[blockCols[k]] = -1;
+        }
+    }
+}
+
+} // namespace flens
+
+#endif // FLENS_STORAGE_BSR_BSR_TCC
@@ -59,6 +59,24 @@ CCS<T,I>::operator=(const CoordStorage<T2, CoordColRowCmp, I2> &coordStorage)
     compress_(coordStorage);
 }
 
+template <typename T, typename I>
+const typename CCS<T,I>::ElementType &
+CCS<T,I>::operator()(IndexType row, IndexType col) const
+{
+    const IndexType k = locate(row, col);
+    ASSERT(k>=indexBase_);
+    return values_(k);
+}
+
+template <typename T, typename I>
+typename CCS<T,I>::ElementType &
+CCS<T,I>::operator()(IndexType row, IndexType col)
+{
+    const IndexType k = locate(row, col);
+    ASSERT(k>=indexBase_);
+    return values_(k);
+}
+
 //-- methods -------------------------------------------------------------------
 
 template <typename T, typename I>
@@ -159,6 +177,32 @@ CCS<T,I>::values()
     return values_;
 }
 
+template <typename T, typename I>
+const typename CCS<T,I>::IndexType
+CCS<T,I>::locate(IndexType row, IndexType col) const
+{
+    ASSERT(row>=firstRow() && row<=lastRow());
+    ASSERT(col>=firstCol() && col<=lastCol());
+
+//
+//  Binary search within col 'col' for the sorted row index.
+//
+    IndexType lo = cols_(col);
+    IndexType hi = cols_(col+1);
+    while (lo<hi) {
+        const IndexType mid = lo + (hi-lo)/2;
+        if (rows_(mid)<row) {
+            lo = mid+1;
+        } else {
+            hi = mid;
+        }
+    }
+    if (lo<cols_(col+1) && rows_(lo)==row) {
+        return lo;
+    }
+    return indexBase_-1;
+}
+
 template <typename T, typename I>
 template <typename T2, typename I2>
 void
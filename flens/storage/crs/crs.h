@@ -64,6 +64,16 @@ class CRS
             void
             operator=(const CoordStorage<T2, CoordRowColCmp, I2> &coordStorage);
 
+        //
+        //  Element access on the frozen sparsity pattern.  Values can be
+        //  changed in place but (row, col) must be part of the pattern.
+        //
+        const ElementType &
+        operator()(IndexType row, IndexType col) const;
+
+        ElementType &
+        operator()(IndexType row, IndexType col);
+
         //-- methods -----------------------------------------------------------
 
         const IndexType
@@ -108,6 +118,14 @@ class CRS
         ElementTypeVector &
         values();
 
+        //
+        //  Returns the slot k with values()(k) holding entry (row, col) or
+        //  indexBase()-1 if the entry is not part of the sparsity pattern.
+        //  Requires sorted column indices (as created by compress_).
+        //
+        const IndexType
+        locate(IndexType row, IndexType col) const;
+
         template <typename T2, typename I2>
             void
             compress_(const CoordStorage<T2, CoordRowColCmp, I2> &coordStorage);
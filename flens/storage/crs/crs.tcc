@@ -60,6 +60,24 @@ CRS<T,I>::operator=(const CoordStorage<T2, CoordRowColCmp, I2> &coordStorage)
     compress_(coordStorage);
 }
 
+template <typename T, typename I>
+const typename CRS<T,I>::ElementType &
+CRS<T,I>::operator()(IndexType row, IndexType col) const
+{
+    const IndexType k = locate(row, col);
+    ASSERT(k>=indexBase_);
+    return values_(k);
+}
+
+template <typename T, typename I>
+typename CRS<T,I>::ElementType &
+CRS<T,I>::operator()(IndexType row, IndexType col)
+{
+    const IndexType k = locate(row, col);
+    ASSERT(k>=indexBase_);
+    return values_(k);
+}
+
 //-- methods -------------------------------------------------------------------
 
 template <typename T, typename I>
@@ -160,6 +178,32 @@ CRS<T,I>::values()
     return values_;
 }
 
+template <typename T, typename I>
+const typename CRS<T,I>::IndexType
+CRS<T,I>::locate(IndexType row, IndexType col) const
+{
+    ASSERT(row>=firstRow() && row<=lastRow());
+    ASSERT(col>=firstCol() && col<=lastCol());
+
+//
+//  Binary search within row 'row' for the sorted col index.
+//
+    IndexType lo = rows_(row);
+    IndexType hi = rows_(row+1);
+    while (lo<hi) {
+        const IndexType mid = lo + (hi-lo)/2;
+        if (cols_(mid)<col) {
+            lo = mid+1;
+        } else {
+            hi = mid;
+        }
+    }
+    if (lo<rows_(row+1) && cols_(lo)==col) {
+        return lo;
+    }
+    return indexBase_-1;
+}
+
 template <typename T, typename I>
 template <typename T2, typename I2>
 void
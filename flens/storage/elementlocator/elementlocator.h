@@ -0,0 +1,99 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FLENS_STORAGE_ELEMENTLOCATOR_ELEMENTLOCATOR_H
+#define FLENS_STORAGE_ELEMENTLOCATOR_ELEMENTLOCATOR_H 1
+
+#include <cxxstd/vector.h>
+
+namespace flens {
+
+//
+//  ElementLocator caches the value slots of a sparse engine (CRS or CCS)
+//  for a fixed sequence of (row, col) accesses.  The first pass through an
+//  assembly loop records the slots (binary search in the frozen pattern),
+//  after rewind() the same sequence gets replayed in O(1) per access:
+//
+//      ElementLocator<CRS<double> >  locate(A.engine());
+//      for (int step=0; step<numSteps; ++step) {
+//          A.engine().values() = 0;
+//          locate.rewind();
+//          for (...) {
+//              locate(i, j) += ...;
+//          }
+//      }
+//
+//  The access sequence must be identical in each pass.
+//
+template <typename Engine>
+class ElementLocator
+{
+    public:
+        typedef typename Engine::ElementType    ElementType;
+        typedef typename Engine::IndexType      IndexType;
+
+        ElementLocator(Engine &engine);
+
+        //-- operators ---------------------------------------------------------
+
+        ElementType &
+        operator()(IndexType row, IndexType col);
+
+        //-- methods -----------------------------------------------------------
+
+        // start a new pass replaying the recorded sequence
+        void
+        rewind();
+
+        // forget the recorded sequence (e.g. after the pattern changed)
+        void
+        reset();
+
+        IndexType
+        numRecorded() const;
+
+        const Engine &
+        engine() const;
+
+        Engine &
+        engine();
+
+    private:
+        Engine                  &engine_;
+        std::vector<IndexType>  slots_;
+        std::size_t             pos_;
+        bool                    recording_;
+};
+
+} // namespace flens
+
+#endif // FLENS_STORAGE_ELEMENTLOCATOR_ELEMENTLOCATOR_H
@@ -0,0 +1,107 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FLENS_STORAGE_ELEMENTLOCATOR_ELEMENTLOCATOR_TCC
+#define FLENS_STORAGE_ELEMENTLOCATOR_ELEMENTLOCATOR_TCC 1
+
+#include <flens/auxiliary/auxiliary.h>
+#include <flens/storage/elementlocator/elementlocator.h>
+
+namespace flens {
+
+template <typename Engine>
+ElementLocator<Engine>::ElementLocator(Engine &engine)
+    : engine_(engine), pos_(0), recording_(true)
+{
+}
+
+//-- operators -----------------------------------------------------------------
+
+template <typename Engine>
+typename ElementLocator<Engine>::ElementType &
+ElementLocator<Engine>::operator()(IndexType row, IndexType col)
+{
+    if (recording_) {
+        const IndexType k = engine_.locate(row, col);
+        ASSERT(k>=engine_.indexBase());
+        slots_.push_back(k);
+        return engine_.values()(k);
+    }
+    ASSERT(pos_<slots_.size());
+    ASSERT(engine_.locate(row, col)==slots_[pos_]);
+    return engine_.values()(slots_[pos_++]);
+}
+
+//-- methods -------------------------------------------------------------------
+
+template <typename Engine>
+void
+ElementLocator<Engine>::rewind()
+{
+    // a rewind before anything got recorded keeps the recording pass going
+    recording_ = slots_.empty();
+    pos_       = 0;
+}
+
+template <typename Engine>
+void
+ElementLocator<Engine>::reset()
+{
+    slots_.clear();
+    recording_ = true;
+    pos_       = 0;
+}
+
+template <typename Engine>
+typename ElementLocator<Engine>::IndexType
+ElementLocator<Engine>::numRecorded() const
+{
+    return slots_.size();
+}
+
+template <typename Engine>
+const Engine &
+ElementLocator<Engine>::engine() const
+{
+    return engine_;
+}
+
+template <typename Engine>
+Engine &
+ElementLocator<Engine>::engine()
+{
+    return engine_;
+}
+
+} // namespace flens
+
+#endif // FLENS_STORAGE_ELEMENTLOCATOR_ELEMENTLOCATOR_TCC
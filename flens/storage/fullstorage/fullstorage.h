@@ -35,6 +35,7 @@
 
 #include <cxxblas/typedefs.h>
 #include <flens/auxiliary/auxiliary.h>
+#include <flens/storage/allocator/paddedallocator.h>
 #include <flens/storage/indexoptions.h>
 #include <flens/typedefs.h>
 
@@ -97,6 +98,8 @@ class FullStorage
 
         FullStorage(const FullStorage &rhs);
 
+        FullStorage(FullStorage &&rhs);
+
         template <typename RHS>
             FullStorage(const RHS &rhs);
 
@@ -185,6 +188,9 @@ class FullStorage
         void
         changeIndexBase(IndexType firstRow, IndexType firstCol);
 
+        void
+        swap(FullStorage &rhs);
+
         // view of fullstorage scheme as an array
         const ConstArrayView
         arrayView(IndexType firstViewIndex = I::defaultIndexBase) const;
@@ -269,6 +275,12 @@ class FullStorage
 
     private:
 
+        static IndexType
+        leadingDimension_(IndexType numRows, IndexType numCols);
+
+        IndexType
+        storageSize_() const;
+
         void
         setIndexBase_(IndexType firstRow, IndexType firstCol);
 
@@ -283,6 +295,7 @@ class FullStorage
 
         pointer      data_;
         IndexType    numRows_, numCols_;
+        IndexType    ld_;
         IndexType    firstRow_, firstCol_;
         Allocator    allocator_;   // EBO?
 };
@@ -33,6 +33,7 @@
 #ifndef FLENS_STORAGE_FULLSTORAGE_FULLSTORAGE_TCC
 #define FLENS_STORAGE_FULLSTORAGE_FULLSTORAGE_TCC 1
 
+#include <cxxstd/algorithm.h>
 #include <cxxblas/level1extensions/gecopy.h>
 #include <flens/auxiliary/auxiliary.h>
 #include <flens/storage/fullstorage/fullstorage.h>
@@ -46,7 +47,7 @@ namespace flens {
 template <typename T, StorageOrder Order, typename I, typename A>
 FullStorage<T, Order, I, A>::FullStorage()
     :  data_(),
-       numRows_(0), numCols_(0),
+       numRows_(0), numCols_(0), ld_(leadingDimension_(0, 0)),
        firstRow_(I::defaultIndexBase), firstCol_(I::defaultIndexBase)
 {
 }
@@ -58,6 +59,7 @@ FullStorage<T, Order, I, A>::FullStorage(IndexType numRows, IndexType numCols,
                                          const Allocator &allocator)
     : data_(),
       numRows_(numRows), numCols_(numCols),
+      ld_(leadingDimension_(numRows, numCols)),
       firstRow_(firstRow), firstCol_(firstCol),
       allocator_(allocator)
 {
@@ -71,6 +73,7 @@ template <typename T, StorageOrder Order, typename I, typename A>
 FullStorage<T, Order, I, A>::FullStorage(const FullStorage &rhs)
     : data_(),
       numRows_(rhs.numRows()), numCols_(rhs.numCols()),
+      ld_(leadingDimension_(rhs.numRows(), rhs.numCols())),
       firstRow_(rhs.firstRow()), firstCol_(rhs.firstCol()),
       allocator_(rhs.allocator())
 {
@@ -82,11 +85,25 @@ FullStorage<T, Order, I, A>::FullStorage(const FullStorage &rhs)
                     data(), leadingDimension());
 }
 
+template <typename T, StorageOrder Order, typename I, typename A>
+FullStorage<T, Order, I, A>::FullStorage(FullStorage &&rhs)
+    : data_(rhs.data_),
+      numRows_(rhs.numRows_), numCols_(rhs.numCols_), ld_(rhs.ld_),
+      firstRow_(rhs.firstRow_), firstCol_(rhs.firstCol_),
+      allocator_(rhs.allocator_)
+{
+    rhs.data_    = pointer();
+    rhs.numRows_ = 0;
+    rhs.numCols_ = 0;
+    rhs.ld_      = leadingDimension_(0, 0);
+}
+
 template <typename T, StorageOrder Order, typename I, typename A>
 template <typename RHS>
 FullStorage<T, Order, I, A>::FullStorage(const RHS &rhs)
     : data_(),
       numRows_(rhs.numRows()), numCols_(rhs.numCols()),
+      ld_(leadingDimension_(rhs.numRows(), rhs.numCols())),
       firstRow_(rhs.firstRow()), firstCol_(rhs.firstCol())
       // XXX: HACK WAR?
       //, allocator_(rhs.allocator())
@@ -125,9 +142,9 @@ FullStorage<T, Order, I, A>::operator()(IndexType row, IndexType col) const
 #   endif
 
     if (Order==ColMajor) {
-        return data_[col*numRows_+row];
+        return data_[col*ld_+row];
     } else {
-        return data_[row*numCols_+col];
+        return data_[row*ld_+col];
     }
 }
 
@@ -149,9 +166,9 @@ FullStorage<T, Order, I, A>::operator()(IndexType row, IndexType col)
 #   endif
 
     if (Order==ColMajor) {
-        return data_[col*numRows_+row];
+        return data_[col*ld_+row];
     } else {
-        return data_[row*numCols_+col];
+        return data_[row*ld_+col];
 		}
 }
 
@@ -202,8 +219,7 @@ template <typename T, StorageOrder Order, typename I, typename A>
 typename FullStorage<T, Order, I, A>::IndexType
 FullStorage<T, Order, I, A>::leadingDimension() const
 {
-    return (Order==ColMajor) ? std::max(numRows_, IndexType(1))
-                             : std::max(numCols_, IndexType(1));
+    return ld_;
 }
 
 template <typename T, StorageOrder Order, typename I, typename A>
@@ -253,6 +269,7 @@ FullStorage<T, Order, I, A>::resize(IndexType numRows, IndexType numCols,
         release_();
         numRows_ = numRows;
         numCols_ = numCols;
+        ld_ = leadingDimension_(numRows_, numCols_);
         firstRow_ = firstRow;
         firstCol_ = firstCol;
         allocate_(value);
@@ -272,6 +289,7 @@ FullStorage<T, Order, I, A>::resize(const Range<IndexType> &rows,
         release_();
         numRows_ = rows.length();
         numCols_ = cols.length();
+        ld_ = leadingDimension_(numRows_, numCols_);
         firstRow_ = rows.firstIndex();
         firstCol_ = cols.firstIndex();
         allocate_(value);
@@ -300,6 +318,7 @@ FullStorage<T, Order, I, A>::reserve(IndexType numRows, IndexType numCols,
         release_();
         numRows_ = numRows;
         numCols_ = numCols;
+        ld_ = leadingDimension_(numRows_, numCols_);
         firstRow_ = firstRow;
         firstCol_ = firstCol;
         raw_allocate_();
@@ -318,6 +337,7 @@ FullStorage<T, Order, I, A>::reserve(const Range<IndexType> &rows,
         release_();
         numRows_ = rows.length();
         numCols_ = cols.length();
+        ld_ = leadingDimension_(numRows_, numCols_);
         firstRow_ = rows.firstIndex();
         firstCol_ = cols.firstIndex();
         raw_allocate_();
@@ -341,7 +361,7 @@ bool
 FullStorage<T, Order, I, A>::fill(const ElementType &value)
 {
     ASSERT(data_!=pointer());
-    flens::alg::fill_n(data(), numRows()*numCols(), value);
+    flens::alg::fill_n(data(), storageSize_(), value);
     return true;
 }
 
@@ -375,6 +395,19 @@ FullStorage<T, Order, I, A>::changeIndexBase(IndexType firstRow,
     firstCol_ = firstCol;
 }
 
+template <typename T, StorageOrder Order, typename I, typename A>
+void
+FullStorage<T, Order, I, A>::swap(FullStorage &rhs)
+{
+    std::swap(data_, rhs.data_);
+    std::swap(numRows_, rhs.numRows_);
+    std::swap(numCols_, rhs.numCols_);
+    std::swap(ld_, rhs.ld_);
+    std::swap(firstRow_, rhs.firstRow_);
+    std::swap(firstCol_, rhs.firstCol_);
+    std::swap(allocator_, rhs.allocator_);
+}
+
 // view of fullstorage scheme as an array
 template <typename T, StorageOrder Order, typename I, typename A>
 const typename FullStorage<T, Order, I, A>::ConstArrayView
@@ -772,6 +805,27 @@ FullStorage<T, Order, I, A>::viewAntiDiag(IndexType d,
 
 //-- Private Methods -----------------------------------------------------------
 
+template <typename T, StorageOrder Order, typename I, typename A>
+typename FullStorage<T, Order, I, A>::IndexType
+FullStorage<T, Order, I, A>::leadingDimension_(IndexType numRows,
+                                               IndexType numCols)
+{
+    const IndexType n = (Order==ColMajor) ? numRows : numCols;
+
+    return LeadingDimension<A>::get(std::max(n, IndexType(1)));
+}
+
+//
+//  Number of elements allocated including the padding of the leading
+//  dimension.
+//
+template <typename T, StorageOrder Order, typename I, typename A>
+typename FullStorage<T, Order, I, A>::IndexType
+FullStorage<T, Order, I, A>::storageSize_() const
+{
+    return (Order==ColMajor) ? ld_*numCols_ : ld_*numRows_;
+}
+
 template <typename T, StorageOrder Order, typename I, typename A>
 void
 FullStorage<T, Order, I, A>::setIndexBase_(IndexType firstRow,
@@ -780,10 +834,10 @@ FullStorage<T, Order, I, A>::setIndexBase_(IndexType firstRow,
     // assume: data_ points to allocated memory
 
     if (Order==RowMajor) {
-        data_ -= firstRow*numCols_ + firstCol;
+        data_ -= firstRow*ld_ + firstCol;
     }
     if (Order==ColMajor) {
-        data_ -= firstCol*numRows_ + firstRow;
+        data_ -= firstCol*ld_ + firstRow;
     }
     firstRow_ = firstRow;
     firstCol_ = firstCol;
@@ -797,7 +851,8 @@ FullStorage<T, Order, I, A>::raw_allocate_()
     ASSERT(numRows_>0);
     ASSERT(numCols_>0);
 
-    data_ = allocator_.allocate(numRows_*numCols_);
+    data_ = allocator_.allocate(storageSize_());
+    default_construct_n(data_, storageSize_());
 #ifndef NDEBUG
     pointer p = data_;
 #endif
@@ -819,7 +874,7 @@ FullStorage<T, Order, I, A>::allocate_(const ElementType &value)
     }
 
     raw_allocate_();
-    flens::alg::uninitialized_fill_n(data(), numElements, value);
+    flens::alg::fill_n(data(), storageSize_(), value);
 }
 
 template <typename T, StorageOrder Order, typename I, typename A>
@@ -827,9 +882,8 @@ void
 FullStorage<T, Order, I, A>::release_()
 {
     if (data_ != pointer()) {
-        // XXX: Assume T is trivially destructible
-        // TODO: std::destroy(first, last, alloc).  See gcc's std::_Destroy
-        allocator_.deallocate(data(), numRows()*numCols());
+        destroy_n(data(), storageSize_());
+        allocator_.deallocate(data(), storageSize_());
         data_ = pointer();
     }
     ASSERT(data_==pointer());
@@ -849,9 +903,12 @@ fillRandom(FullStorage<T, Order, I, Allocator> &A)
     typedef typename FullStorage<T,Order,I,Allocator>::pointer      pointer;
     typedef typename FullStorage<T,Order,I,Allocator>::IndexType    IndexType;
 
+    const IndexType n = (Order==ColMajor) ? A.leadingDimension()*A.numCols()
+                                          : A.leadingDimension()*A.numRows();
+
     pointer data = A.data();
     ASSERT(data!=pointer());
-    for (IndexType i=0; i<A.numRows()*A.numCols(); ++i) {
+    for (IndexType i=0; i<n; ++i) {
         data[i] = randomValue<T>();
     }
     return true;
@@ -132,6 +132,10 @@ class PackedStorage
                IndexType indexBase = I::defaultIndexBase,
                const ElementType &value = ElementType());
 
+        bool
+        reserve(IndexType dim,
+                IndexType indexBase = I::defaultIndexBase);
+
         bool
         fill(const ElementType &value = ElementType());
 
@@ -63,7 +63,7 @@ PackedStorage<T, Order, I, A>::PackedStorage(const PackedStorage &rhs)
 {
     allocate_(ElementType());
 
-    cxxblas::copy(rhs.dim(), rhs.data(), 1, data(), 1);
+    cxxblas::copy(rhs.numNonZeros(), rhs.data(), 1, data(), 1);
 }
 
 template <typename T, StorageOrder Order, typename I, typename A>
@@ -75,7 +75,7 @@ PackedStorage<T, Order, I, A>::PackedStorage(const RHS &rhs)
 {
     allocate_(ElementType());
 
-    cxxblas::copy(rhs.dim(), rhs.data(), 1, data(), 1);
+    cxxblas::copy(rhs.numNonZeros(), rhs.data(), 1, data(), 1);
 
 }
 
@@ -213,6 +213,13 @@ PackedStorage<T, Order, I, A>::resize(IndexType dim,
     return false;
 }
 
+template <typename T, StorageOrder Order, typename I, typename A>
+bool
+PackedStorage<T, Order, I, A>::reserve(IndexType dim, IndexType indexBase)
+{
+    return resize(dim, indexBase);
+}
+
 template <typename T, StorageOrder Order, typename I, typename A>
 bool
 PackedStorage<T, Order, I, A>::fill(const ElementType &value)
@@ -240,6 +247,7 @@ PackedStorage<T, Order, I, A>::raw_allocate_()
 
     data_ = allocator_.allocate(numNonZeros());
     ASSERT(data_!=pointer());
+    default_construct_n(data_, numNonZeros());
 
 #ifndef NDEBUG
     pointer p = data_;
@@ -263,7 +271,7 @@ PackedStorage<T, Order, I, A>::allocate_(const ElementType &value)
     }
 
     raw_allocate_();
-    flens::alg::uninitialized_fill_n(data(), numElements, value);
+    flens::alg::fill_n(data(), numElements, value);
 }
 
 template <typename T, StorageOrder Order, typename I, typename A>
@@ -271,8 +279,7 @@ void
 PackedStorage<T, Order, I, A>::release_()
 {
     if (data_ != pointer()) {
-        // XXX: Assume T is trivially destructible
-        // TODO: std::destroy(first, last, alloc).  See gcc's std::_Destroy
+        destroy_n(data(), numNonZeros());
         allocator_.deallocate(data(), numNonZeros());
         data_ = pointer();
     }
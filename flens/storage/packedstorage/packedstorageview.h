@@ -136,6 +136,10 @@ class PackedStorageView
                IndexType indexBase = I::defaultIndexBase,
                const ElementType &value = ElementType());
 
+        bool
+        reserve(IndexType dim,
+                IndexType indexBase = I::defaultIndexBase);
+
         bool
         fill(const ElementType &value = ElementType());
 
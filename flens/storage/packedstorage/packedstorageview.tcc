@@ -228,6 +228,13 @@ PackedStorageView<T, Order, I, A>::resize(IndexType DEBUG_VAR(dim_),
     return false;
 }
 
+template <typename T, StorageOrder Order, typename I, typename A>
+bool
+PackedStorageView<T, Order, I, A>::reserve(IndexType dim, IndexType indexBase)
+{
+    return resize(dim, indexBase);
+}
+
 template <typename T, StorageOrder Order, typename I, typename A>
 bool
 PackedStorageView<T, Order, I, A>::fill(const ElementType &value)
@@ -0,0 +1,207 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FLENS_STORAGE_RFPSTORAGE_CONSTRFPSTORAGEVIEW_TCC
+#define FLENS_STORAGE_RFPSTORAGE_CONSTRFPSTORAGEVIEW_TCC 1
+
+#include <flens/auxiliary/auxiliary.h>
+#include <flens/storage/fullstorage/constfullstorageview.h>
+#include <flens/storage/rfpstorage/constrfpstorageview.h>
+#include <flens/storage/rfpstorage/rfplayout.h>
+#include <flens/typedefs.h>
+
+namespace flens {
+
+template <typename T, StorageOrder Order, typename I, typename A>
+ConstRfpStorageView<T, Order, I, A>::ConstRfpStorageView(
+                                                     IndexType dim,
+                                                     const_pointer data,
+                                                     IndexType indexBase,
+                                                     const Allocator &allocator)
+    : data_(data),
+      allocator_(allocator),
+      dim_(dim),
+      indexBase_(0)
+{
+    ASSERT(dim_>=0);
+
+    changeIndexBase(indexBase);
+}
+
+template <typename T, StorageOrder Order, typename I, typename A>
+template <typename ARRAY>
+ConstRfpStorageView<T, Order, I, A>::ConstRfpStorageView(
+                                                     IndexType dim,
+                                                     ARRAY &array,
+                                                     IndexType indexBase,
+                                                     const Allocator &allocator)
+    : data_(array.data()),
+      allocator_(allocator),
+      dim_(dim),
+      indexBase_(0)
+{
+    ASSERT((dim*(dim+1))/2<=array.length());
+    ASSERT(dim_>=0);
+
+    changeIndexBase(indexBase);
+}
+
+template <typename T, StorageOrder Order, typename I, typename A>
+ConstRfpStorageView<T, Order, I, A>::ConstRfpStorageView(
+                                                 const ConstRfpStorageView &rhs)
+    : data_(rhs.data_),
+      allocator_(rhs.allocator_),
+      dim_(rhs.dim_),
+      indexBase_(rhs.indexBase_)
+{
+}
+
+template <typename T, StorageOrder Order, typename I, typename A>
+template <typename RHS>
+ConstRfpStorageView<T, Order, I, A>::ConstRfpStorageView(const RHS &rhs)
+    : data_(rhs.data()),
+      allocator_(rhs.allocator()),
+      dim_(rhs.dim()),
+      indexBase_(0)
+{
+    ASSERT(RHS::order==Order);
+
+    changeIndexBase(rhs.indexBase());
+}
+
+template <typename T, StorageOrder Order, typename I, typename A>
+ConstRfpStorageView<T, Order, I, A>::~ConstRfpStorageView()
+{
+}
+
+//-- operators -----------------------------------------------------------------
+
+template <typename T, StorageOrder Order, typename I, typename A>
+typename ConstRfpStorageView<T, Order, I, A>::const_reference
+ConstRfpStorageView<T, Order, I, A>::operator()(StorageUpLo  upLo,
+                                                IndexType    row,
+                                                IndexType    col) const
+{
+    ASSERT(row>=indexBase());
+    ASSERT(col>=indexBase());
+    ASSERT(row<=indexBase()+dim()-1);
+    ASSERT(col<=indexBase()+dim()-1);
+
+    const RfpLayout<IndexType> layout(dim_, Order, upLo);
+
+    bool transposed;
+    return data_[layout.index(row-indexBase_, col-indexBase_, transposed)];
+}
+
+template <typename T, StorageOrder Order, typename I, typename A>
+typename ConstRfpStorageView<T, Order, I, A>::IndexType
+ConstRfpStorageView<T, Order, I, A>::indexBase() const
+{
+    return indexBase_;
+}
+
+template <typename T, StorageOrder Order, typename I, typename A>
+typename ConstRfpStorageView<T, Order, I, A>::IndexType
+ConstRfpStorageView<T, Order, I, A>::numNonZeros() const
+{
+    return (dim_+1)*dim_/IndexType(2);
+}
+
+template <typename T, StorageOrder Order, typename I, typename A>
+typename ConstRfpStorageView<T, Order, I, A>::IndexType
+ConstRfpStorageView<T, Order, I, A>::dim() const
+{
+    return dim_;
+}
+
+template <typename T, StorageOrder Order, typename I, typename A>
+typename ConstRfpStorageView<T, Order, I, A>::const_pointer
+ConstRfpStorageView<T, Order, I, A>::data() const
+{
+    return data_;
+}
+
+template <typename T, StorageOrder Order, typename I, typename A>
+const typename ConstRfpStorageView<T, Order, I, A>::Allocator &
+ConstRfpStorageView<T, Order, I, A>::allocator() const
+{
+    return allocator_;
+}
+
+template <typename T, StorageOrder Order, typename I, typename A>
+void
+ConstRfpStorageView<T, Order, I, A>::changeIndexBase(IndexType indexBase)
+{
+    indexBase_ = indexBase;
+}
+
+template <typename T, StorageOrder Order, typename I, typename A>
+bool
+ConstRfpStorageView<T, Order, I, A>::transposedEntry(StorageUpLo  upLo,
+                                                     IndexType    row,
+                                                     IndexType    col) const
+{
+    const RfpLayout<IndexType> layout(dim_, Order, upLo);
+
+    bool transposed;
+    layout.index(row-indexBase_, col-indexBase_, transposed);
+    return transposed;
+}
+
+//-- blocks --------------------------------------------------------------------
+
+template <typename T, StorageOrder Order, typename I, typename A>
+bool
+ConstRfpStorageView<T, Order, I, A>::transposedBlock(StorageUpLo upLo,
+                                                     RfpBlock block) const
+{
+    const RfpLayout<IndexType> layout(dim_, Order, upLo);
+
+    return layout.transposed[block];
+}
+
+template <typename T, StorageOrder Order, typename I, typename A>
+typename ConstRfpStorageView<T, Order, I, A>::ConstBlockView
+ConstRfpStorageView<T, Order, I, A>::viewBlock(StorageUpLo upLo,
+                                               RfpBlock block) const
+{
+    const RfpLayout<IndexType> layout(dim_, Order, upLo);
+
+    return ConstBlockView(layout.numRows[block], layout.numCols[block],
+                          data_ + layout.offset[block],
+                          layout.leadingDimension,
+                          indexBase_, indexBase_, allocator_);
+}
+
+} // namespace flens
+
+#endif // FLENS_STORAGE_RFPSTORAGE_CONSTRFPSTORAGEVIEW_TCC
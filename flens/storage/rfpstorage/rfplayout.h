@@ -0,0 +1,79 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FLENS_STORAGE_RFPSTORAGE_RFPLAYOUT_H
+#define FLENS_STORAGE_RFPSTORAGE_RFPLAYOUT_H 1
+
+#include <flens/typedefs.h>
+
+namespace flens {
+
+//
+//  Rectangular full packed format (RFP) as used by LAPACK (see LAPACK
+//  Working Note 199).  A n x n matrix gets split into the diagonal blocks
+//
+//      A11 = A(1:n1,1:n1),  A22 = A(n1+1:n,n1+1:n)
+//
+//  and the off-diagonal block A21 = A(n1+1:n,1:n1) for upLo==Lower or
+//  A12 = A(1:n1,n1+1:n) for upLo==Upper.  Each block is stored as a full
+//  column major matrix within an array of length n*(n+1)/2, some of them
+//  transposed (conjugate transposed for complex element types).  For
+//  order==RowMajor the complete array is transposed, i.e. TRANSR='T' or
+//  TRANSR='C' in LAPACK.
+//
+
+enum RfpBlock {
+    RfpDiag1   = 0,     // A11
+    RfpDiag2   = 1,     // A22
+    RfpOffDiag = 2      // A21 or A12
+};
+
+template <typename IndexType>
+struct RfpLayout
+{
+    RfpLayout(IndexType n, StorageOrder order, StorageUpLo upLo);
+
+    // Offset of entry (i,j) in the upLo triangle, indices are zero based.
+    IndexType
+    index(IndexType i, IndexType j, bool &transposedEntry) const;
+
+    StorageUpLo  upLo;
+    IndexType    n1, n2, leadingDimension;
+
+    // position and size of the blocks as stored in the array
+    IndexType    offset[3], numRows[3], numCols[3];
+    bool         transposed[3];
+};
+
+} // namespace flens
+
+#endif // FLENS_STORAGE_RFPSTORAGE_RFPLAYOUT_H
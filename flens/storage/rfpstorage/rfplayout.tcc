@@ -0,0 +1,142 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FLENS_STORAGE_RFPSTORAGE_RFPLAYOUT_TCC
+#define FLENS_STORAGE_RFPSTORAGE_RFPLAYOUT_TCC 1
+
+#include <flens/auxiliary/auxiliary.h>
+#include <flens/storage/rfpstorage/rfplayout.h>
+
+namespace flens {
+
+template <typename IndexType>
+RfpLayout<IndexType>::RfpLayout(IndexType n, StorageOrder order,
+                                StorageUpLo upLo_)
+    : upLo(upLo_)
+{
+    ASSERT(n>=0);
+
+    const bool nIsOdd = (n%2==1);
+
+//
+//  Rows and columns of the array for TRANSR='N'
+//
+    const IndexType m = nIsOdd ? n : n+1;
+    const IndexType k = nIsOdd ? (n+1)/2 : n/2;
+
+//
+//  Position (r0(b), c0(b)) of block b within this array
+//
+    IndexType r0[3], c0[3];
+
+    if (upLo==Lower) {
+        n2 = n/2;
+        n1 = n - n2;
+
+        const IndexType s = nIsOdd ? 0 : 1;
+
+        r0[RfpDiag1]   = s;        c0[RfpDiag1]   = 0;
+        r0[RfpDiag2]   = 0;        c0[RfpDiag2]   = 1-s;
+        r0[RfpOffDiag] = n1+s;     c0[RfpOffDiag] = 0;
+
+        transposed[RfpDiag1]   = false;
+        transposed[RfpDiag2]   = true;
+        transposed[RfpOffDiag] = false;
+    } else {
+        n1 = n/2;
+        n2 = n - n1;
+
+        r0[RfpDiag1]   = n1+1;     c0[RfpDiag1]   = 0;
+        r0[RfpDiag2]   = n1;       c0[RfpDiag2]   = 0;
+        r0[RfpOffDiag] = 0;        c0[RfpOffDiag] = 0;
+
+        transposed[RfpDiag1]   = true;
+        transposed[RfpDiag2]   = false;
+        transposed[RfpOffDiag] = false;
+    }
+
+    const IndexType logicalRows[3] = { n1, n2, (upLo==Lower) ? n2 : n1 };
+    const IndexType logicalCols[3] = { n1, n2, (upLo==Lower) ? n1 : n2 };
+
+    for (int b=0; b<3; ++b) {
+        if (order==ColMajor) {
+            offset[b] = r0[b] + c0[b]*m;
+        } else {
+            offset[b] = c0[b] + r0[b]*k;
+            transposed[b] = !transposed[b];
+        }
+        numRows[b] = transposed[b] ? logicalCols[b] : logicalRows[b];
+        numCols[b] = transposed[b] ? logicalRows[b] : logicalCols[b];
+    }
+    leadingDimension = (order==ColMajor) ? m : k;
+    if (leadingDimension==0) {
+        leadingDimension = 1;
+    }
+}
+
+template <typename IndexType>
+IndexType
+RfpLayout<IndexType>::index(IndexType i, IndexType j,
+                            bool &transposedEntry) const
+{
+    int       b;
+    IndexType r, c;
+
+    if (upLo==Lower) {
+        ASSERT(i>=j);
+        if (j>=n1) {
+            b = RfpDiag2;   r = i-n1;   c = j-n1;
+        } else if (i<n1) {
+            b = RfpDiag1;   r = i;      c = j;
+        } else {
+            b = RfpOffDiag; r = i-n1;   c = j;
+        }
+    } else {
+        ASSERT(i<=j);
+        if (i>=n1) {
+            b = RfpDiag2;   r = i-n1;   c = j-n1;
+        } else if (j<n1) {
+            b = RfpDiag1;   r = i;      c = j;
+        } else {
+            b = RfpOffDiag; r = i;      c = j-n1;
+        }
+    }
+    transposedEntry = transposed[b];
+    if (transposedEntry) {
+        return offset[b] + c + r*leadingDimension;
+    }
+    return offset[b] + r + c*leadingDimension;
+}
+
+} // namespace flens
+
+#endif // FLENS_STORAGE_RFPSTORAGE_RFPLAYOUT_TCC
@@ -0,0 +1,191 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FLENS_STORAGE_RFPSTORAGE_RFPSTORAGE_H
+#define FLENS_STORAGE_RFPSTORAGE_RFPSTORAGE_H 1
+
+#include <cxxblas/typedefs.h>
+#include <flens/auxiliary/auxiliary.h>
+#include <flens/storage/indexoptions.h>
+#include <flens/storage/rfpstorage/rfplayout.h>
+#include <flens/typedefs.h>
+
+namespace flens {
+
+template <typename T, typename I, typename A>
+    class Array;
+
+template <typename T, typename I, typename A>
+    class ArrayView;
+
+template <typename T, typename I, typename A>
+    class ConstArrayView;
+
+template <typename T, StorageOrder Order, typename I, typename A>
+    class ConstFullStorageView;
+
+template <typename T, StorageOrder Order, typename I, typename A>
+    class FullStorageView;
+
+template <typename T, StorageOrder Order, typename I, typename A>
+    class RfpStorageView;
+
+template <typename T, StorageOrder Order, typename I, typename A>
+    class ConstRfpStorageView;
+
+//
+//  Storage of a symmetric, hermitian or triangular matrix in the
+//  rectangular full packed format (see rfplayout.h).  The triangle and
+//  the storage order determine where an entry is located.  operator()
+//  returns the array entry that stores (row,col) of the upLo triangle.
+//  If transposedEntry(upLo,row,col) is true this entry holds the
+//  conjugated value.
+//
+template <typename T,
+          StorageOrder Order = ColMajor,
+          typename I = IndexOptions<>,
+          typename A = std::allocator<T> >
+class RfpStorage
+{
+    public:
+        typedef T                        ElementType;
+        typedef typename I::IndexType    IndexType;
+        typedef A                        Allocator;
+
+        static const StorageOrder        order = Order;
+        static const IndexType           defaultIndexBase = I::defaultIndexBase;
+
+        // std:: typedefs
+        typedef Allocator                                 allocator_type;
+        typedef typename allocator_type::size_type        size_type;
+        typedef T                                         value_type;
+        typedef typename allocator_type::pointer          pointer;
+        typedef typename allocator_type::const_pointer    const_pointer;
+        typedef typename allocator_type::reference        reference;
+        typedef typename allocator_type::const_reference  const_reference;
+
+        typedef ConstRfpStorageView<T, Order, I, A>     ConstView;
+        typedef RfpStorageView<T, Order, I, A>          View;
+        typedef RfpStorage                              NoView;
+
+        typedef flens::ConstArrayView<T, I, A>          ConstArrayView;
+        typedef flens::ArrayView<T, I, A>               ArrayView;
+        typedef flens::Array<T, I, A>                   Array;
+
+        typedef ConstFullStorageView<T, ColMajor, I, A> ConstBlockView;
+        typedef FullStorageView<T, ColMajor, I, A>      BlockView;
+
+        RfpStorage(IndexType dim,
+                   IndexType indexBase = I::defaultIndexBase,
+                   const ElementType &value = ElementType(),
+                   const Allocator &allocator = Allocator());
+
+        RfpStorage(const RfpStorage &rhs);
+
+        template <typename RHS>
+            RfpStorage(const RHS &rhs);
+
+        ~RfpStorage();
+
+        //-- operators ---------------------------------------------------------
+
+        const_reference
+        operator()(StorageUpLo upLo, IndexType row, IndexType col) const;
+
+        reference
+        operator()(StorageUpLo upLo, IndexType row, IndexType col);
+
+        //-- methods -----------------------------------------------------------
+
+        IndexType
+        indexBase() const;
+
+        IndexType
+        numNonZeros() const;
+
+        IndexType
+        dim() const;
+
+        const_pointer
+        data() const;
+
+        pointer
+        data();
+
+        const Allocator &
+        allocator() const;
+
+        bool
+        resize(IndexType dim,
+               IndexType indexBase = I::defaultIndexBase,
+               const ElementType &value = ElementType());
+
+        bool
+        fill(const ElementType &value = ElementType());
+
+        void
+        changeIndexBase(IndexType indexBase);
+
+        bool
+        transposedEntry(StorageUpLo upLo, IndexType row, IndexType col) const;
+
+        //-- blocks ------------------------------------------------------------
+
+        bool
+        transposedBlock(StorageUpLo upLo, RfpBlock block) const;
+
+        ConstBlockView
+        viewBlock(StorageUpLo upLo, RfpBlock block) const;
+
+        BlockView
+        viewBlock(StorageUpLo upLo, RfpBlock block);
+
+    private:
+
+        void
+        raw_allocate_();
+
+        void
+        allocate_(const ElementType &value = ElementType());
+
+        void
+        release_();
+
+        ElementType  *data_;
+        Allocator    allocator_;
+        IndexType    dim_;
+        IndexType    indexBase_;
+};
+
+} // namespace flens
+
+#endif // FLENS_STORAGE_RFPSTORAGE_RFPSTORAGE_H
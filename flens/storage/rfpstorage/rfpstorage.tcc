@@ -0,0 +1,296 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FLENS_STORAGE_RFPSTORAGE_RFPSTORAGE_TCC
+#define FLENS_STORAGE_RFPSTORAGE_RFPSTORAGE_TCC 1
+
+#include <flens/auxiliary/auxiliary.h>
+#include <flens/storage/fullstorage/constfullstorageview.h>
+#include <flens/storage/fullstorage/fullstorageview.h>
+#include <flens/storage/rfpstorage/rfplayout.h>
+#include <flens/storage/rfpstorage/rfpstorage.h>
+#include <flens/typedefs.h>
+
+namespace flens {
+
+//-- Constructors --------------------------------------------------------------
+
+template <typename T, StorageOrder Order, typename I, typename A>
+RfpStorage<T, Order, I, A>::RfpStorage(IndexType dim,
+                                       IndexType indexBase,
+                                       const ElementType &value,
+                                       const Allocator &allocator)
+    : data_(), allocator_(allocator),
+      dim_(dim),
+      indexBase_(indexBase)
+{
+    ASSERT(dim_>=0);
+
+    allocate_(value);
+}
+
+template <typename T, StorageOrder Order, typename I, typename A>
+RfpStorage<T, Order, I, A>::RfpStorage(const RfpStorage &rhs)
+    : data_(), allocator_(rhs.allocator()),
+      dim_(rhs.dim()),
+      indexBase_(rhs.indexBase())
+{
+    allocate_(ElementType());
+
+    cxxblas::copy(numNonZeros(), rhs.data(), 1, data(), 1);
+}
+
+template <typename T, StorageOrder Order, typename I, typename A>
+template <typename RHS>
+RfpStorage<T, Order, I, A>::RfpStorage(const RHS &rhs)
+    : data_(), allocator_(rhs.allocator()),
+      dim_(rhs.dim()),
+      indexBase_(rhs.indexBase())
+{
+    ASSERT(RHS::order==Order);
+
+    allocate_(ElementType());
+
+    cxxblas::copy(numNonZeros(), rhs.data(), 1, data(), 1);
+}
+
+template <typename T, StorageOrder Order, typename I, typename A>
+RfpStorage<T, Order, I, A>::~RfpStorage()
+{
+    release_();
+}
+
+//-- operators -----------------------------------------------------------------
+
+template <typename T, StorageOrder Order, typename I, typename A>
+typename RfpStorage<T, Order, I, A>::const_reference
+RfpStorage<T, Order, I, A>::operator()(StorageUpLo  upLo,
+                                       IndexType    row,
+                                       IndexType    col) const
+{
+    ASSERT(row>=indexBase());
+    ASSERT(col>=indexBase());
+    ASSERT(row<=indexBase()+dim()-1);
+    ASSERT(col<=indexBase()+dim()-1);
+
+    const RfpLayout<IndexType> layout(dim_, Order, upLo);
+
+    bool transposed;
+    return data_[layout.index(row-indexBase_, col-indexBase_, transposed)];
+}
+
+template <typename T, StorageOrder Order, typename I, typename A>
+typename RfpStorage<T, Order, I, A>::reference
+RfpStorage<T, Order, I, A>::operator()(StorageUpLo  upLo,
+                                       IndexType    row,
+                                       IndexType    col)
+{
+    ASSERT(row>=indexBase());
+    ASSERT(col>=indexBase());
+    ASSERT(row<=indexBase()+dim()-1);
+    ASSERT(col<=indexBase()+dim()-1);
+
+    const RfpLayout<IndexType> layout(dim_, Order, upLo);
+
+    bool transposed;
+    return data_[layout.index(row-indexBase_, col-indexBase_, transposed)];
+}
+
+//-- Methods -------------------------------------------------------------------
+
+template <typename T, StorageOrder Order, typename I, typename A>
+typename RfpStorage<T, Order, I, A>::IndexType
+RfpStorage<T, Order, I, A>::indexBase() const
+{
+    return indexBase_;
+}
+
+template <typename T, StorageOrder Order, typename I, typename A>
+typename RfpStorage<T, Order, I, A>::IndexType
+RfpStorage<T, Order, I, A>::numNonZeros() const
+{
+    return (dim_+1)*dim_/IndexType(2);
+}
+
+template <typename T, StorageOrder Order, typename I, typename A>
+typename RfpStorage<T, Order, I, A>::IndexType
+RfpStorage<T, Order, I, A>::dim() const
+{
+    return dim_;
+}
+
+template <typename T, StorageOrder Order, typename I, typename A>
+typename RfpStorage<T, Order, I, A>::const_pointer
+RfpStorage<T, Order, I, A>::data() const
+{
+    return data_;
+}
+
+template <typename T, StorageOrder Order, typename I, typename A>
+typename RfpStorage<T, Order, I, A>::pointer
+RfpStorage<T, Order, I, A>::data()
+{
+    return data_;
+}
+
+template <typename T, StorageOrder Order, typename I, typename A>
+const typename RfpStorage<T, Order, I, A>::Allocator &
+RfpStorage<T, Order, I, A>::allocator() const
+{
+    return allocator_;
+}
+
+template <typename T, StorageOrder Order, typename I, typename A>
+bool
+RfpStorage<T, Order, I, A>::resize(IndexType dim,
+                                   IndexType indexBase,
+                                   const ElementType &value)
+{
+    if (dim_!=dim) {
+        release_();
+        dim_ = dim;
+        indexBase_ = indexBase;
+        allocate_(value);
+        return true;
+    }
+    changeIndexBase(indexBase);
+    return false;
+}
+
+template <typename T, StorageOrder Order, typename I, typename A>
+bool
+RfpStorage<T, Order, I, A>::fill(const ElementType &value)
+{
+    ASSERT(data_!=pointer());
+    flens::alg::fill_n(data(), numNonZeros(), value);
+    return true;
+}
+
+template <typename T, StorageOrder Order, typename I, typename A>
+void
+RfpStorage<T, Order, I, A>::changeIndexBase(IndexType indexBase)
+{
+    indexBase_ = indexBase;
+}
+
+template <typename T, StorageOrder Order, typename I, typename A>
+bool
+RfpStorage<T, Order, I, A>::transposedEntry(StorageUpLo  upLo,
+                                            IndexType    row,
+                                            IndexType    col) const
+{
+    const RfpLayout<IndexType> layout(dim_, Order, upLo);
+
+    bool transposed;
+    layout.index(row-indexBase_, col-indexBase_, transposed);
+    return transposed;
+}
+
+//-- Blocks --------------------------------------------------------------------
+
+template <typename T, StorageOrder Order, typename I, typename A>
+bool
+RfpStorage<T, Order, I, A>::transposedBlock(StorageUpLo upLo,
+                                            RfpBlock block) const
+{
+    const RfpLayout<IndexType> layout(dim_, Order, upLo);
+
+    return layout.transposed[block];
+}
+
+template <typename T, StorageOrder Order, typename I, typename A>
+typename RfpStorage<T, Order, I, A>::ConstBlockView
+RfpStorage<T, Order, I, A>::viewBlock(StorageUpLo upLo, RfpBlock block) const
+{
+    const RfpLayout<IndexType> layout(dim_, Order, upLo);
+
+    return ConstBlockView(layout.numRows[block], layout.numCols[block],
+                          data_ + layout.offset[block],
+                          layout.leadingDimension,
+                          indexBase_, indexBase_, allocator_);
+}
+
+template <typename T, StorageOrder Order, typename I, typename A>
+typename RfpStorage<T, Order, I, A>::BlockView
+RfpStorage<T, Order, I, A>::viewBlock(StorageUpLo upLo, RfpBlock block)
+{
+    const RfpLayout<IndexType> layout(dim_, Order, upLo);
+
+    return BlockView(layout.numRows[block], layout.numCols[block],
+                     data_ + layout.offset[block],
+                     layout.leadingDimension,
+                     indexBase_, indexBase_, allocator_);
+}
+
+//-- Private Methods -----------------------------------------------------------
+
+template <typename T, StorageOrder Order, typename I, typename A>
+void
+RfpStorage<T, Order, I, A>::raw_allocate_()
+{
+    ASSERT(data_==pointer());
+    ASSERT(dim_>0);
+
+    data_ = allocator_.allocate(numNonZeros());
+    ASSERT(data_!=pointer());
+    default_construct_n(data_, numNonZeros());
+}
+
+template <typename T, StorageOrder Order, typename I, typename A>
+void
+RfpStorage<T, Order, I, A>::allocate_(const ElementType &value)
+{
+    const IndexType numElements = numNonZeros();
+
+    if (numElements==0) {
+        return;
+    }
+
+    raw_allocate_();
+    flens::alg::fill_n(data(), numElements, value);
+}
+
+template <typename T, StorageOrder Order, typename I, typename A>
+void
+RfpStorage<T, Order, I, A>::release_()
+{
+    if (data_ != pointer()) {
+        destroy_n(data(), numNonZeros());
+        allocator_.deallocate(data(), numNonZeros());
+        data_ = pointer();
+    }
+    ASSERT(data_==pointer());
+}
+
+} // namespace flens
+
+#endif // FLENS_STORAGE_RFPSTORAGE_RFPSTORAGE_TCC
@@ -0,0 +1,153 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FLENS_STORAGE_SELL_SELL_H
+#define FLENS_STORAGE_SELL_SELL_H 1
+
+#include <flens/vectortypes/impl/densevector.h>
+#include <flens/storage/array/array.h>
+#include <flens/storage/crs/crs.h>
+#include <flens/storage/indexoptions.h>
+
+namespace flens {
+
+//
+//  SELL-C-sigma (sliced ELLPACK) storage.
+//
+//  Rows get sorted by decreasing length within windows of sigma rows and are
+//  then grouped into chunks of C rows.  Each chunk is padded to its longest
+//  row and stored column-major, i.e. entry l of the r-th row in chunk c is
+//  at position chunkPtr(c) + l*C + r.  So the inner loop of SpMV runs over
+//  the C rows of a chunk with unit stride and vectorizes independent of the
+//  row lengths.  perm() maps a slot (position within the sorted rows) back
+//  to the original row.  Padding entries have value zero and column index
+//  indexBase().
+//
+//  As with CRS all index vectors are stored w.r.t. indexBase().
+//
+template <typename T,
+          int C = 8,
+          typename I = IndexOptions<> >
+class SELL
+{
+    public:
+        typedef T                                   ElementType;
+        typedef typename I::IndexType               IndexType;
+
+        typedef DenseVector<Array<ElementType> >    ElementTypeVector;
+        typedef DenseVector<Array<IndexType> >      IndexTypeVector;
+
+        static const int chunkSize = C;
+
+        SELL(IndexType sigma = 32*C);
+
+        ~SELL();
+
+        //-- operators ---------------------------------------------------------
+
+        template <typename T2, typename I2>
+            void
+            operator=(const CRS<T2, I2> &crs);
+
+        //-- methods -----------------------------------------------------------
+
+        const IndexType
+        indexBase() const;
+
+        const IndexType
+        firstRow() const;
+
+        const IndexType
+        lastRow() const;
+
+        const IndexType
+        firstCol() const;
+
+        const IndexType
+        lastCol() const;
+
+        const IndexType
+        numRows() const;
+
+        const IndexType
+        numCols() const;
+
+        // number of nonzeros without padding
+        const IndexType
+        numNonZeros() const;
+
+        const IndexType
+        numChunks() const;
+
+        const IndexType
+        sigma() const;
+
+        const IndexTypeVector &
+        chunkPtr() const;
+
+        const IndexTypeVector &
+        chunkLength() const;
+
+        const IndexTypeVector &
+        cols() const;
+
+        const IndexTypeVector &
+        perm() const;
+
+        const ElementTypeVector &
+        values() const;
+
+        ElementTypeVector &
+        values();
+
+        template <typename T2, typename I2>
+            void
+            convert_(const CRS<T2, I2> &crs);
+
+    private:
+        SELL(const SELL &rhs);
+
+        IndexType  numRows_, numCols_;
+        IndexType  indexBase_;
+        IndexType  numNonZeros_;
+        IndexType  sigma_;
+
+        DenseVector<Array<IndexType> >  chunkPtr_;
+        DenseVector<Array<IndexType> >  chunkLength_;
+        DenseVector<Array<IndexType> >  cols_;
+        DenseVector<Array<IndexType> >  perm_;
+        DenseVector<Array<T> >          values_;
+};
+
+} // namespace flens
+
+#endif // FLENS_STORAGE_SELL_SELL_H
@@ -0,0 +1,263 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FLENS_STORAGE_SELL_SELL_TCC
+#define FLENS_STORAGE_SELL_SELL_TCC 1
+
+#include <cxxstd/algorithm.h>
+#include <cxxstd/vector.h>
+#include <flens/auxiliary/auxiliary.h>
+#include <flens/storage/sell/sell.h>
+
+namespace flens {
+
+template <typename T, int C, typename I>
+SELL<T,C,I>::SELL(IndexType sigma)
+    : numRows_(0), numCols_(0),
+      indexBase_(I::defaultIndexBase),
+      numNonZeros_(0),
+      sigma_(sigma)
+{
+    ASSERT(sigma_>=1);
+}
+
+template <typename T, int C, typename I>
+SELL<T,C,I>::~SELL()
+{
+}
+
+//-- operators -----------------------------------------------------------------
+
+template <typename T, int C, typename I>
+template <typename T2, typename I2>
+void
+SELL<T,C,I>::operator=(const CRS<T2, I2> &crs)
+{
+    convert_(crs);
+}
+
+//-- methods -------------------------------------------------------------------
+
+template <typename T, int C, typename I>
+const typename SELL<T,C,I>::IndexType
+SELL<T,C,I>::indexBase() const
+{
+    return indexBase_;
+}
+
+template <typename T, int C, typename I>
+const typename SELL<T,C,I>::IndexType
+SELL<T,C,I>::firstRow() const
+{
+    return indexBase_;
+}
+
+template <typename T, int C, typename I>
+const typename SELL<T,C,I>::IndexType
+SELL<T,C,I>::lastRow() const
+{
+    return indexBase_+numRows_-1;
+}
+
+template <typename T, int C, typename I>
+const typename SELL<T,C,I>::IndexType
+SELL<T,C,I>::firstCol() const
+{
+    return indexBase_;
+}
+
+template <typename T, int C, typename I>
+const typename SELL<T,C,I>::IndexType
+SELL<T,C,I>::lastCol() const
+{
+    return indexBase_+numCols_-1;
+}
+
+template <typename T, int C, typename I>
+const typename SELL<T,C,I>::IndexType
+SELL<T,C,I>::numRows() const
+{
+    return numRows_;
+}
+
+template <typename T, int C, typename I>
+const typename SELL<T,C,I>::IndexType
+SELL<T,C,I>::numCols() const
+{
+    return numCols_;
+}
+
+template <typename T, int C, typename I>
+const typename SELL<T,C,I>::IndexType
+SELL<T,C,I>::numNonZeros() const
+{
+    return numNonZeros_;
+}
+
+template <typename T, int C, typename I>
+const typename SELL<T,C,I>::IndexType
+SELL<T,C,I>::numChunks() const
+{
+    return chunkLength_.length();
+}
+
+template <typename T, int C, typename I>
+const typename SELL<T,C,I>::IndexType
+SELL<T,C,I>::sigma() const
+{
+    return sigma_;
+}
+
+template <typename T, int C, typename I>
+const typename SELL<T,C,I>::IndexTypeVector &
+SELL<T,C,I>::chunkPtr() const
+{
+    return chunkPtr_;
+}
+
+template <typename T, int C, typename I>
+const typename SELL<T,C,I>::IndexTypeVector &
+SELL<T,C,I>::chunkLength() const
+{
+    return chunkLength_;
+}
+
+template <typename T, int C, typename I>
+const typename SELL<T,C,I>::IndexTypeVector &
+SELL<T,C,I>::cols() const
+{
+    return cols_;
+}
+
+template <typename T, int C, typename I>
+const typename SELL<T,C,I>::IndexTypeVector &
+SELL<T,C,I>::perm() const
+{
+    return perm_;
+}
+
+template <typename T, int C, typename I>
+const typename SELL<T,C,I>::ElementTypeVector &
+SELL<T,C,I>::values() const
+{
+    return values_;
+}
+
+template <typename T, int C, typename I>
+typename SELL<T,C,I>::ElementTypeVector &
+SELL<T,C,I>::values()
+{
+    return values_;
+}
+
+template <typename T, int C, typename I>
+template <typename T2, typename I2>
+void
+SELL<T,C,I>::convert_(const CRS<T2, I2> &crs)
+{
+    numRows_     = crs.numRows();
+    numCols_     = crs.numCols();
+    indexBase_   = crs.indexBase();
+    numNonZeros_ = crs.numNonZeros();
+
+    const auto &ia = crs.rows();
+    const auto &ja = crs.cols();
+    const auto &a  = crs.values();
+
+    const IndexType m  = numRows_;
+    const IndexType b  = indexBase_;
+    const IndexType nc = (m+C-1)/C;
+
+    auto rowLength = [&](IndexType i) { return ia(b+i+1) - ia(b+i); };
+
+//
+//  Sort rows by decreasing length within windows of sigma rows.  slot[s] is
+//  the (zero based) row stored at position s.
+//
+    std::vector<IndexType> slot(m);
+    for (IndexType s=0; s<m; ++s) {
+        slot[s] = s;
+    }
+    for (IndexType w=0; w<m; w+=sigma_) {
+        std::stable_sort(slot.begin()+w, slot.begin()+std::min(w+sigma_, m),
+                         [&](IndexType i, IndexType j)
+                         {
+                             return rowLength(i)>rowLength(j);
+                         });
+    }
+
+    perm_.resize(m, b);
+    for (IndexType s=0; s<m; ++s) {
+        perm_(b+s) = b + slot[s];
+    }
+
+//
+//  Chunk widths and offsets
+//
+    chunkLength_.resize(nc, b);
+    chunkPtr_.resize(nc+1, b);
+    chunkPtr_(b) = b;
+
+    for (IndexType c=0; c<nc; ++c) {
+        IndexType width = 0;
+        for (IndexType s=c*C; s<std::min(c*C+C, m); ++s) {
+            width = std::max(width, rowLength(slot[s]));
+        }
+        chunkLength_(b+c) = width;
+        chunkPtr_(b+c+1)  = chunkPtr_(b+c) + C*width;
+    }
+
+//
+//  Fill in the entries, padding stays zero
+//
+    const IndexType size = chunkPtr_(b+nc) - b;
+
+    cols_.resize(size, b);
+    values_.resize(size, b);
+    cols_   = b;
+    values_ = T(0);
+
+    for (IndexType c=0; c<nc; ++c) {
+        for (IndexType s=c*C; s<std::min(c*C+C, m); ++s) {
+            const IndexType i = slot[s];
+            IndexType p = chunkPtr_(b+c) + (s-c*C);
+            for (IndexType k=ia(b+i); k<ia(b+i+1); ++k, p+=C) {
+                cols_(p)   = ja(k);
+                values_(p) = a(k);
+            }
+        }
+    }
+}
+
+} // namespace flens
+
+#endif // FLENS_STORAGE_SELL_SELL_TCC
@@ -35,6 +35,11 @@
 
 #include <flens/storage/indexoptions.h>
 
+#include <flens/storage/allocator/alignedallocator.h>
+#include <flens/storage/allocator/alignedmemory.h>
+#include <flens/storage/allocator/hugepageallocator.h>
+#include <flens/storage/allocator/numaallocator.h>
+#include <flens/storage/allocator/paddedallocator.h>
 #include <flens/storage/array/array.h>
 #include <flens/storage/array/arrayview.h>
 #include <flens/storage/array/constarrayview.h>
@@ -49,10 +54,13 @@
 #include <flens/storage/bandstorage/hasbandstorage.h>
 #include <flens/storage/bandstorage/isbandstorage.h>
 
+#include <flens/storage/bsr/bsr.h>
 #include <flens/storage/ccs/ccs.h>
 #include <flens/storage/coordstorage/coordstorage.h>
 #include <flens/storage/crs/crs.h>
 
+#include <flens/storage/elementlocator/elementlocator.h>
+
 #include <flens/storage/fullstorage/constfullstorageview.h>
 #include <flens/storage/fullstorage/fullstorage.h>
 #include <flens/storage/fullstorage/fullstorageview.h>
@@ -66,6 +74,14 @@
 #include <flens/storage/packedstorage/packedstorage.h>
 #include <flens/storage/packedstorage/packedstorageview.h>
 
+#include <flens/storage/rfpstorage/constrfpstorageview.h>
+#include <flens/storage/rfpstorage/isrfpstorage.h>
+#include <flens/storage/rfpstorage/rfplayout.h>
+#include <flens/storage/rfpstorage/rfpstorage.h>
+#include <flens/storage/rfpstorage/rfpstorageview.h>
+
+#include <flens/storage/sell/sell.h>
+
 #include <flens/storage/tinyarray/tinyarray.h>
 #include <flens/storage/tinyarray/tinyarrayview.h>
 #include <flens/storage/tinyarray/tinyconstarrayview.h>
@@ -74,4 +90,6 @@
 #include <flens/storage/tinyfullstorage/tinyfullstorageview.h>
 #include <flens/storage/tinyfullstorage/tinyconstfullstorageview.h>
 
+#include <flens/storage/workspace/workspace.h>
+
 #endif // FLENS_STORAGE_STORAGE_H
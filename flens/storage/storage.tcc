@@ -33,6 +33,11 @@
 #ifndef FLENS_STORAGE_STORAGE_TCC
 #define FLENS_STORAGE_STORAGE_TCC 1
 
+#include <flens/storage/allocator/alignedallocator.tcc>
+#include <flens/storage/allocator/alignedmemory.tcc>
+#include <flens/storage/allocator/hugepageallocator.tcc>
+#include <flens/storage/allocator/numaallocator.tcc>
+#include <flens/storage/allocator/paddedallocator.tcc>
 #include <flens/storage/array/array.tcc>
 #include <flens/storage/array/arrayview.tcc>
 #include <flens/storage/array/constarrayview.tcc>
@@ -41,10 +46,13 @@
 #include <flens/storage/bandstorage/bandstorageview.tcc>
 #include <flens/storage/bandstorage/constbandstorageview.tcc>
 
+#include <flens/storage/bsr/bsr.tcc>
 #include <flens/storage/ccs/ccs.tcc>
 #include <flens/storage/coordstorage/coordstorage.tcc>
 #include <flens/storage/crs/crs.tcc>
 
+#include <flens/storage/elementlocator/elementlocator.tcc>
+
 #include <flens/storage/fullstorage/constfullstorageview.tcc>
 #include <flens/storage/fullstorage/fullstorage.tcc>
 #include <flens/storage/fullstorage/fullstorageview.tcc>
@@ -54,6 +62,13 @@
 #include <flens/storage/packedstorage/packedstorageview.tcc>
 #include <flens/storage/packedstorage/packedstorage.tcc>
 
+#include <flens/storage/rfpstorage/constrfpstorageview.tcc>
+#include <flens/storage/rfpstorage/rfplayout.tcc>
+#include <flens/storage/rfpstorage/rfpstorageview.tcc>
+#include <flens/storage/rfpstorage/rfpstorage.tcc>
+
+#include <flens/storage/sell/sell.tcc>
+
 #include <flens/storage/tinyarray/tinyarray.tcc>
 #include <flens/storage/tinyarray/tinyarrayview.tcc>
 #include <flens/storage/tinyarray/tinyconstarrayview.tcc>
@@ -62,4 +77,6 @@
 #include <flens/storage/tinyfullstorage/tinyfullstorageview.tcc>
 #include <flens/storage/tinyfullstorage/tinyconstfullstorageview.tcc>
 
+#include <flens/storage/workspace/workspace.tcc>
+
 #endif // FLENS_STORAGE_STORAGE_TCC
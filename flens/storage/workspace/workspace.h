@@ -0,0 +1,209 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FLENS_STORAGE_WORKSPACE_WORKSPACE_H
+#define FLENS_STORAGE_WORKSPACE_WORKSPACE_H 1
+
+#include <cxxstd/cstddef.h>
+#include <cxxstd/memory.h>
+#include <cxxstd/vector.h>
+
+//
+//  Thread local workspace arena.  Memory is handed out like from a stack:
+//  allocations are bumped from the top of the current chunk and released
+//  blocks are popped as soon as everything allocated after them is released
+//  too.  Typically buffers are released in reverse order (local temporaries),
+//  so in a loop the same memory gets reused without calling malloc/free.  If
+//  a chunk is full a new, larger chunk is allocated.  Once the arena is empty
+//  the chunks are merged into a single chunk of the total size.
+//
+//  Blocks must be released by the thread that allocated them, so workspace
+//  allocated objects (closure temporaries, LAPACK work arrays or anything
+//  else using WorkspaceAllocator) must not be handed over to another thread.
+//  Releasing a block of another thread triggers an assertion, with NDEBUG
+//  the block stays allocated in the owning arena until that thread ends.
+//
+//  WorkspaceAllocator<T> is an allocator drawing from the arena.  It is used
+//  for closure temporaries (flens/blas/closures/auxiliary/result.h) and for
+//  the work arrays of the LAPACK variants with temporary workspace unless
+//  FLENS_NO_WORKSPACE is defined.
+//
+//  Workspace::reserve(n) pre-allocates n bytes for the calling thread.  The
+//  environment variable FLENS_WORKSPACE_RESERVE sets the amount of bytes that
+//  gets reserved on first use in each thread.
+//
+
+namespace flens {
+
+class Workspace
+{
+    public:
+        static const std::size_t alignment = 64;
+
+        static void *
+        allocate(std::size_t numBytes);
+
+        static void
+        deallocate(void *p, std::size_t numBytes);
+
+        static void
+        reserve(std::size_t numBytes);
+
+        static void
+        release();
+
+        //-- statistics (for the calling thread) -------------------------------
+
+        static std::size_t
+        inUse();
+
+        static std::size_t
+        peak();
+
+        static std::size_t
+        capacity();
+
+        static long
+        numAllocations();
+
+        static long
+        numChunkAllocations();
+
+        static void
+        resetStatistics();
+
+    private:
+        struct Chunk
+        {
+            char            *data;
+            std::size_t     size;
+            std::size_t     top;
+        };
+
+        struct Block
+        {
+            char            *data;
+            std::size_t     size;
+            std::size_t     chunk;
+            bool            released;
+        };
+
+        struct Arena
+        {
+            Arena();
+
+            ~Arena();
+
+            std::vector<Chunk>  chunks;
+            std::vector<Block>  blocks;
+            std::size_t         inUse, peak;
+            long                numAllocations, numChunkAllocations;
+        };
+
+        static Arena &
+        arena_();
+
+        static void
+        addChunk_(Arena &arena, std::size_t numBytes);
+
+        static void
+        freeChunks_(Arena &arena);
+};
+
+template <typename T>
+class WorkspaceAllocator
+{
+    public:
+        typedef T               value_type;
+        typedef T               *pointer;
+        typedef const T         *const_pointer;
+        typedef T               &reference;
+        typedef const T         &const_reference;
+        typedef std::size_t     size_type;
+        typedef std::ptrdiff_t  difference_type;
+
+        template <typename S>
+        struct rebind
+        {
+            typedef WorkspaceAllocator<S>   other;
+        };
+
+        WorkspaceAllocator();
+
+        template <typename S>
+            WorkspaceAllocator(const WorkspaceAllocator<S> &);
+
+        pointer
+        allocate(size_type n, const void *hint = 0);
+
+        void
+        deallocate(pointer p, size_type n);
+
+        void
+        construct(pointer p, const T &value);
+
+        void
+        destroy(pointer p);
+
+        size_type
+        max_size() const;
+};
+
+template <typename T, typename S>
+    bool
+    operator==(const WorkspaceAllocator<T> &, const WorkspaceAllocator<S> &);
+
+template <typename T, typename S>
+    bool
+    operator!=(const WorkspaceAllocator<T> &, const WorkspaceAllocator<S> &);
+
+//
+//  WorkspaceAllocatorFor<A>::Type is the allocator used for temporaries if
+//  operands are allocated with A.  Only std::allocator gets replaced.
+//
+template <typename A>
+struct WorkspaceAllocatorFor
+{
+    typedef A   Type;
+};
+
+#ifndef FLENS_NO_WORKSPACE
+template <typename T>
+struct WorkspaceAllocatorFor<std::allocator<T> >
+{
+    typedef WorkspaceAllocator<T>   Type;
+};
+#endif
+
+} // namespace flens
+
+#endif // FLENS_STORAGE_WORKSPACE_WORKSPACE_H
@@ -0,0 +1,323 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FLENS_STORAGE_WORKSPACE_WORKSPACE_TCC
+#define FLENS_STORAGE_WORKSPACE_WORKSPACE_TCC 1
+
+#include <cxxstd/algorithm.h>
+#include <cxxstd/cstdlib.h>
+#include <cxxstd/limits.h>
+#include <flens/auxiliary/auxiliary.h>
+#include <flens/storage/workspace/workspace.h>
+
+namespace flens {
+
+//-- Workspace -----------------------------------------------------------------
+
+inline void *
+Workspace::allocate(std::size_t numBytes)
+{
+    using std::max;
+
+    Arena &arena = arena_();
+
+    const std::size_t align = alignment;
+    const std::size_t size  = max(align, ((numBytes+align-1)/align)*align);
+
+    if (arena.chunks.empty()
+     || arena.chunks.back().top+size>arena.chunks.back().size)
+    {
+        const std::size_t minChunkSize = 1 << 16;
+        std::size_t       chunkSize    = max(size, minChunkSize);
+
+        if (!arena.chunks.empty()) {
+            chunkSize = max(chunkSize, 2*arena.chunks.back().size);
+        }
+        addChunk_(arena, chunkSize);
+    }
+
+    Chunk &chunk = arena.chunks.back();
+
+    Block block;
+    block.data     = chunk.data + chunk.top;
+    block.size     = size;
+    block.chunk    = arena.chunks.size()-1;
+    block.released = false;
+
+    chunk.top += size;
+    arena.blocks.push_back(block);
+
+    arena.inUse += size;
+    arena.peak   = max(arena.peak, arena.inUse);
+    ++arena.numAllocations;
+
+    return block.data;
+}
+
+inline void
+Workspace::deallocate(void *p, std::size_t)
+{
+    Arena &arena = arena_();
+
+//
+//  Usually p is the block on top of the stack.  If it is not found at all it
+//  was allocated by another thread (see workspace.h).
+//
+    std::size_t i = arena.blocks.size();
+    while (i>0 && arena.blocks[i-1].data!=p) {
+        --i;
+    }
+    ASSERT(i>0);
+    if (i==0) {
+        return;
+    }
+
+    Block &block = arena.blocks[i-1];
+    block.released = true;
+    arena.inUse   -= block.size;
+
+//
+//  Pop released blocks from the top
+//
+    while (!arena.blocks.empty() && arena.blocks.back().released) {
+        const Block &top   = arena.blocks.back();
+        Chunk       &chunk = arena.chunks[top.chunk];
+
+        chunk.top = top.data - chunk.data;
+        arena.blocks.pop_back();
+    }
+
+//
+//  If the arena is empty merge all chunks into one
+//
+    if (arena.blocks.empty() && arena.chunks.size()>1) {
+        const std::size_t size = capacity();
+        freeChunks_(arena);
+        addChunk_(arena, size);
+    }
+}
+
+inline void
+Workspace::reserve(std::size_t numBytes)
+{
+    Arena &arena = arena_();
+
+    const std::size_t size = capacity();
+    if (size>=numBytes) {
+        return;
+    }
+    if (arena.blocks.empty()) {
+        freeChunks_(arena);
+        addChunk_(arena, numBytes);
+    } else {
+        addChunk_(arena, numBytes-size);
+    }
+}
+
+inline void
+Workspace::release()
+{
+    Arena &arena = arena_();
+
+    if (arena.blocks.empty()) {
+        freeChunks_(arena);
+    }
+}
+
+inline std::size_t
+Workspace::inUse()
+{
+    return arena_().inUse;
+}
+
+inline std::size_t
+Workspace::peak()
+{
+    return arena_().peak;
+}
+
+inline std::size_t
+Workspace::capacity()
+{
+    const Arena &arena = arena_();
+
+    std::size_t size = 0;
+    for (std::size_t i=0; i<arena.chunks.size(); ++i) {
+        size += arena.chunks[i].size;
+    }
+    return size;
+}
+
+inline long
+Workspace::numAllocations()
+{
+    return arena_().numAllocations;
+}
+
+inline long
+Workspace::numChunkAllocations()
+{
+    return arena_().numChunkAllocations;
+}
+
+inline void
+Workspace::resetStatistics()
+{
+    Arena &arena = arena_();
+
+    arena.peak                = arena.inUse;
+    arena.numAllocations      = 0;
+    arena.numChunkAllocations = 0;
+}
+
+inline
+Workspace::Arena::Arena()
+    : inUse(0), peak(0), numAllocations(0), numChunkAllocations(0)
+{
+    const char *reserve = std::getenv("FLENS_WORKSPACE_RESERVE");
+    if (reserve && std::atol(reserve)>0) {
+        addChunk_(*this, std::size_t(std::atol(reserve)));
+    }
+}
+
+inline
+Workspace::Arena::~Arena()
+{
+    freeChunks_(*this);
+}
+
+inline Workspace::Arena &
+Workspace::arena_()
+{
+    static thread_local Arena arena;
+    return arena;
+}
+
+//
+//  Chunks start at an aligned address inside a buffer from malloc.  The
+//  offset to the start of the buffer is stored in front of the chunk.
+//
+inline void
+Workspace::addChunk_(Arena &arena, std::size_t numBytes)
+{
+    char *raw = static_cast<char *>(std::malloc(numBytes+alignment));
+    if (!raw) {
+        throw std::bad_alloc();
+    }
+    std::size_t offset = alignment
+                       - reinterpret_cast<std::size_t>(raw) % alignment;
+
+    Chunk chunk;
+    chunk.data = raw + offset;
+    chunk.size = numBytes;
+    chunk.top  = 0;
+    chunk.data[-1] = char(offset);
+
+    arena.chunks.push_back(chunk);
+    ++arena.numChunkAllocations;
+}
+
+inline void
+Workspace::freeChunks_(Arena &arena)
+{
+    for (std::size_t i=0; i<arena.chunks.size(); ++i) {
+        char *data = arena.chunks[i].data;
+        std::free(data - static_cast<unsigned char>(data[-1]));
+    }
+    arena.chunks.clear();
+}
+
+//-- WorkspaceAllocator --------------------------------------------------------
+
+template <typename T>
+WorkspaceAllocator<T>::WorkspaceAllocator()
+{
+}
+
+template <typename T>
+template <typename S>
+WorkspaceAllocator<T>::WorkspaceAllocator(const WorkspaceAllocator<S> &)
+{
+}
+
+template <typename T>
+typename WorkspaceAllocator<T>::pointer
+WorkspaceAllocator<T>::allocate(size_type n, const void *)
+{
+    return static_cast<pointer>(Workspace::allocate(n*sizeof(T)));
+}
+
+template <typename T>
+void
+WorkspaceAllocator<T>::deallocate(pointer p, size_type n)
+{
+    Workspace::deallocate(p, n*sizeof(T));
+}
+
+template <typename T>
+void
+WorkspaceAllocator<T>::construct(pointer p, const T &value)
+{
+    new (static_cast<void *>(p)) T(value);
+}
+
+template <typename T>
+void
+WorkspaceAllocator<T>::destroy(pointer p)
+{
+    p->~T();
+}
+
+template <typename T>
+typename WorkspaceAllocator<T>::size_type
+WorkspaceAllocator<T>::max_size() const
+{
+    return std::numeric_limits<size_type>::max() / sizeof(T);
+}
+
+template <typename T, typename S>
+bool
+operator==(const WorkspaceAllocator<T> &, const WorkspaceAllocator<S> &)
+{
+    return true;
+}
+
+template <typename T, typename S>
+bool
+operator!=(const WorkspaceAllocator<T> &, const WorkspaceAllocator<S> &)
+{
+    return false;
+}
+
+} // namespace flens
+
+#endif // FLENS_STORAGE_WORKSPACE_WORKSPACE_TCC
@@ -0,0 +1,260 @@
+#include <cxxstd/cstdlib.h>
+#include <cxxstd/iostream.h>
+#include <cxxstd/utility.h>
+#include <flens/flens.cxx>
+
+#ifndef SEED
+#define SEED  0
+#endif
+
+//
+//  Matrices using the allocators from flens/storage/allocator.  All
+//  operations are compared against matrices using std::allocator.  Values
+//  are integers (and the LU factorization has no pivoting) so results have
+//  to be identical.
+//
+//  n = 256 gives a critical stride for double (2KB), so PaddedAllocator has
+//  to pad the leading dimension.  512x512 matrices are large enough for the
+//  huge pages of HugePageAllocator.
+//
+
+using namespace flens;
+using namespace std;
+
+typedef double                                              T;
+typedef AlignedAllocator<T>                                 Aligned;
+typedef PaddedAllocator<AlignedAllocator<T> >               Padded;
+typedef PaddedAllocator<std::allocator<T> >                 PaddedStd;
+typedef HugePageAllocator<T>                                HugePage;
+typedef HugePageAllocator<T, ExplicitHugePages>             ExplicitHugePage;
+typedef NumaAllocator<T>                                    NumaFirstTouch_;
+typedef NumaAllocator<T, NumaInterleave>                    NumaInterleave_;
+
+template <typename FS>
+void
+fill(GeMatrix<FS> &A)
+{
+    for (int i=A.firstRow(); i<=A.lastRow(); ++i) {
+        for (int j=A.firstCol(); j<=A.lastCol(); ++j) {
+            A(i,j) = rand() % 10 - 5;
+        }
+    }
+}
+
+template <typename MA, typename MB>
+void
+check(const MA &A, const MB &A_, const char *what)
+{
+    if (! lapack::isIdentical(A, A_, "A", "A_")) {
+        cerr << endl << "failed: " << what << endl;
+        ASSERT(0);
+    }
+}
+
+//
+//  The leading dimension is the one computed for the allocator.  If the
+//  allocator aligns and pads each column (row) starts on a cache line unless
+//  it is too short for padding.
+//
+template <typename FS>
+void
+checkLeadingDimension(const GeMatrix<FS> &A, const char *what)
+{
+    typedef typename FS::Allocator  Allocator;
+
+    const int n  = (FS::order==ColMajor) ? A.numRows() : A.numCols();
+    const int ld = LeadingDimension<Allocator>::get(n);
+
+    if (A.leadingDimension()!=ld) {
+        cerr << endl << "failed: leading dimension after " << what << endl;
+        cerr << "leadingDimension = " << A.leadingDimension()
+             << " (expected " << ld << ")" << endl;
+        ASSERT(0);
+    }
+    if (IsSame<Allocator, Padded>::value && ld!=n) {
+        const int m = (FS::order==ColMajor) ? A.numCols() : A.numRows();
+        for (int j=0; j<m; ++j) {
+            const T *p = A.data() + j*A.leadingDimension();
+            if (reinterpret_cast<size_t>(p) % 64!=0) {
+                cerr << endl << "failed: alignment after " << what << endl;
+                ASSERT(0);
+            }
+        }
+    }
+}
+
+template <typename Allocator, StorageOrder Order>
+void
+run(int n)
+{
+    typedef FullStorage<T, Order, IndexOptions<>, Allocator>  FS;
+    typedef FullStorage<T, Order>                             FS_;
+    typedef flens::GeMatrix<FS>                               GeMatrix;
+    typedef flens::GeMatrix<FS_>                              GeMatrix_;
+    typedef DenseVector<Array<int> >                          IDenseVector;
+
+    const Underscore<int> _;
+
+    GeMatrix_  A_(n, n), B_(n, n), C_(n, n), R_(n+1, n-1);
+
+    fill(A_);
+    fill(B_);
+    fill(R_);
+
+//
+//  copy, also from a transposed matrix and between index bases
+//
+    GeMatrix  A(n, n), B = B_, C;
+
+    A = A_;
+    checkLeadingDimension(A, "construction");
+    checkLeadingDimension(B, "copy construction");
+    check(A, A_, "copy");
+    check(B, B_, "copy construction");
+
+    C   = transpose(A);
+    C_  = transpose(A_);
+    checkLeadingDimension(C, "transposed copy");
+    check(C, C_, "transposed copy");
+
+    GeMatrix  D(n, n, 0, 2);
+    D = B;
+    checkLeadingDimension(D, "copy with index base");
+    ASSERT(D.firstRow()==0 && D.firstCol()==2);
+    if (! lapack::isClose(D, B_, 0.5, "D", "B_")) {
+        cerr << endl << "failed: copy with index base" << endl;
+        ASSERT(0);
+    }
+
+    GeMatrix  E = A(_(2,n-1),_(3,n));
+    checkLeadingDimension(E, "copy of a view");
+    check(E, A_(_(2,n-1),_(3,n)), "copy of a view");
+
+//
+//  scal
+//
+    A  *= 3;
+    A_ *= 3;
+    check(A, A_, "scal");
+
+    A(_(1,n/2),_)  *= -2;
+    A_(_(1,n/2),_) *= -2;
+    check(A, A_, "scal of a view");
+
+//
+//  mm
+//
+    C  = A*B;
+    C_ = A_*B_;
+    check(C, C_, "A*B");
+
+    C  = transpose(A)*B + 2*C;
+    C_ = transpose(A_)*B_ + 2*C_;
+    check(C, C_, "transpose(A)*B + 2*C");
+
+    C  = A_*transpose(B);
+    C_ = A_*transpose(B_);
+    check(C, C_, "A_*transpose(B)");
+
+//
+//  trf of a diagonally dominant matrix, i.e. without pivoting
+//
+    IDenseVector  piv(n), piv_(n);
+
+    for (int i=1; i<=n; ++i) {
+        A(i,i)  = 4*n;
+        A_(i,i) = 4*n;
+    }
+    ASSERT(lapack::trf(A, piv)==0);
+    ASSERT(lapack::trf(A_, piv_)==0);
+    if (! lapack::isIdentical(piv, piv_, "piv", "piv_")
+     || ! lapack::isClose(A, A_, 1e-10, "LU", "LU_"))
+    {
+        cerr << endl << "failed: trf" << endl;
+        ASSERT(0);
+    }
+
+//
+//  resize to other, short (unpadded) and the original sizes
+//
+    A.resize(n+1, n-1);
+    checkLeadingDimension(A, "resize");
+    A = R_;
+    check(A, R_, "resize");
+
+    A.resize(5, 3, -1, 2);
+    checkLeadingDimension(A, "resize to short columns");
+
+    A.resize(n, n);
+    checkLeadingDimension(A, "resize to original size");
+    A = A_;
+    check(A, A_, "resize to original size");
+
+//
+//  move construction keeps data and leading dimension, the source is empty
+//  and can be reused
+//
+    const T   *data = A.data();
+    const int ld    = A.leadingDimension();
+
+    GeMatrix  M(std::move(A));
+    ASSERT(M.data()==data && M.leadingDimension()==ld);
+    ASSERT(A.numRows()==0 && A.numCols()==0);
+    check(M, A_, "move construction");
+
+    A.resize(n, n);
+    checkLeadingDimension(A, "resize after move");
+
+//
+//  move assignment to an empty matrix swaps, to a matrix of the same size
+//  it copies
+//
+    GeMatrix  F;
+    F = std::move(M);
+    ASSERT(F.data()==data && F.leadingDimension()==ld);
+    check(F, A_, "move assignment");
+
+    A = std::move(F);
+    checkLeadingDimension(A, "move assignment with copy");
+    check(A, A_, "move assignment with copy");
+}
+
+template <typename Allocator>
+void
+run(int n)
+{
+    run<Allocator, ColMajor>(n);
+    run<Allocator, RowMajor>(n);
+}
+
+int
+main()
+{
+    srand(SEED);
+
+//
+//  The critical stride gets padded by one cache line, short columns are not
+//  padded
+//
+    ASSERT(LeadingDimension<Padded>::get(256)==256+8);
+    ASSERT(LeadingDimension<Padded>::get(201)==208);
+    ASSERT(LeadingDimension<Padded>::get(20)==20);
+    ASSERT(LeadingDimension<std::allocator<T> >::get(256)==256);
+
+    GeMatrix<FullStorage<T, ColMajor, IndexOptions<>, Padded> >  P(256, 10);
+    ASSERT(P.leadingDimension()>P.numRows());
+
+    for (int n : { 256, 201, 17 }) {
+        run<std::allocator<T> >(n);
+        run<Aligned>(n);
+        run<Padded>(n);
+        run<PaddedStd>(n);
+    }
+    run<NumaFirstTouch_>(256);
+    run<NumaInterleave_>(256);
+    for (int n : { 256, 512 }) {
+        run<HugePage>(n);
+        run<ExplicitHugePage>(n);
+        run<PaddedAllocator<HugePage> >(n);
+    }
+}
@@ -0,0 +1,243 @@
+#include <cxxstd/cmath.h>
+#include <cxxstd/complex.h>
+#include <cxxstd/iostream.h>
+
+#define USE_PLAYGROUND
+#include <flens/flens.cxx>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+//
+//  Compile with -fopenmp for the threaded variant.  The native band
+//  Cholesky pbsv (blocked for kd>64) and the partitioned SPIKE solver get
+//  checked against a known solution for GbMatrix, SbMatrix and HbMatrix.
+//
+
+using namespace flens;
+using namespace std;
+
+template <typename T>
+void
+fillRandom(T &x)
+{
+    x = T(rand())/T(RAND_MAX)-T(0.5);
+}
+
+template <typename T>
+void
+fillRandom(complex<T> &z)
+{
+    T re, im;
+    fillRandom(re);
+    fillRandom(im);
+    z = complex<T>(re, im);
+}
+
+//
+//  Diagonally dominant band matrices
+//
+template <typename MA>
+void
+fill(GbMatrix<MA> &A)
+{
+    typedef typename GbMatrix<MA>::ElementType  T;
+
+    const int kl = A.numSubDiags(), ku = A.numSuperDiags();
+
+    for (int j=1; j<=A.numCols(); ++j) {
+        for (int i=std::max(1,j-ku); i<=std::min(A.numRows(),j+kl); ++i) {
+            fillRandom(A(i,j));
+        }
+        A(j,j) += T(kl+ku+1);
+    }
+}
+
+template <typename MA>
+void
+fill(SbMatrix<MA> &A)
+{
+    const int n = A.dim(), kd = A.numOffDiags();
+    const bool upper = (A.upLo()==Upper);
+
+    for (int j=1; j<=n; ++j) {
+        const int iFirst = upper ? std::max(1,j-kd) : j;
+        const int iLast  = upper ? j : std::min(n,j+kd);
+        for (int i=iFirst; i<=iLast; ++i) {
+            fillRandom(A(i,j));
+        }
+        A(j,j) += 2*kd+1;
+    }
+}
+
+template <typename MA>
+void
+fill(HbMatrix<MA> &A)
+{
+    typedef typename HbMatrix<MA>::ElementType  T;
+
+    const int n = A.dim(), kd = A.numOffDiags();
+    const bool upper = (A.upLo()==Upper);
+
+    for (int j=1; j<=n; ++j) {
+        const int iFirst = upper ? std::max(1,j-kd) : j;
+        const int iLast  = upper ? j : std::min(n,j+kd);
+        for (int i=iFirst; i<=iLast; ++i) {
+            fillRandom(A(i,j));
+        }
+        A(j,j) = T(real(A(j,j))+2*kd+1);
+    }
+}
+
+template <typename MA, typename T>
+void
+rhs(const MA &A, GeMatrix<FullStorage<T> > &X, GeMatrix<FullStorage<T> > &B)
+{
+    const Underscore<int> _;
+
+    for (int j=1; j<=X.numCols(); ++j) {
+        for (int i=1; i<=X.numRows(); ++i) {
+            fillRandom(X(i,j));
+        }
+        B(_,j) = A*X(_,j);
+    }
+}
+
+template <typename T>
+void
+runGb(int n, int kl, int ku, int nRhs)
+{
+    typedef GbMatrix<BandStorage<T> >     BandMatrix;
+    typedef GeMatrix<FullStorage<T> >     Matrix;
+
+    BandMatrix A(n, n, kl, ku);
+    Matrix     X(n, nRhs), B(n, nRhs);
+
+    fill(A);
+    rhs(A, X, B);
+
+    for (int p=1; p<=5; ++p) {
+        Matrix Y = B;
+        lapack::extensions::spike_sv(A, Y, p);
+        if (! lapack::isClose(Y, X, 1e-10, "Y", "X")) {
+            cerr << endl << "failed: spike_sv (gb) [n = " << n
+                 << ", kl = " << kl << ", ku = " << ku << ", p = " << p
+                 << "]" << endl;
+            ASSERT(0);
+        }
+    }
+}
+
+template <typename BandMatrix>
+void
+runPb(int n, int kd, StorageUpLo upLo, int nRhs)
+{
+    typedef typename BandMatrix::ElementType  T;
+    typedef GeMatrix<FullStorage<T> >         Matrix;
+
+    BandMatrix A(n, upLo, kd);
+    Matrix     X(n, nRhs), B(n, nRhs);
+
+    fill(A);
+    rhs(A, X, B);
+
+    for (int p=1; p<=5; ++p) {
+        Matrix Y = B;
+        lapack::extensions::spike_sv(A, Y, p);
+        if (! lapack::isClose(Y, X, 1e-10, "Y", "X")) {
+            cerr << endl << "failed: spike_sv (pb) [n = " << n
+                 << ", kd = " << kd << ", p = " << p << "]" << endl;
+            ASSERT(0);
+        }
+    }
+
+    BandMatrix F = A;
+    Matrix     Y = B;
+    if (lapack::pbsv(F, Y)!=0) {
+        cerr << endl << "failed: pbsv [n = " << n << ", kd = " << kd
+             << "] not positive definite" << endl;
+        ASSERT(0);
+    }
+    if (! lapack::isClose(Y, X, 1e-10, "Y", "X")) {
+        cerr << endl << "failed: pbsv [n = " << n << ", kd = " << kd
+             << "]" << endl;
+        ASSERT(0);
+    }
+}
+
+//
+//  Tridiagonal matrix with zero diagonal.  Diagonal blocks of odd order
+//  are singular and spike_sv has to fall back to the sequential solver.
+//
+void
+runSingularBlock()
+{
+    typedef GbMatrix<BandStorage<double> >     BandMatrix;
+    typedef GeMatrix<FullStorage<double> >     Matrix;
+
+    const int n = 1000;
+
+    BandMatrix A(n, n, 1, 1);
+    Matrix     X(n, 1), B(n, 1);
+
+    A = 0;
+    for (int i=1; i<n; ++i) {
+        A(i,i+1) = 1;
+        A(i+1,i) = 1;
+    }
+    rhs(A, X, B);
+
+    if (lapack::extensions::spike_sv(A, B, 3)!=0) {
+        cerr << endl << "failed: spike_sv (singular block) is singular"
+             << endl;
+        ASSERT(0);
+    }
+    if (! lapack::isClose(B, X, 1e-10, "B", "X")) {
+        cerr << endl << "failed: spike_sv (singular block)" << endl;
+        ASSERT(0);
+    }
+}
+
+void
+run()
+{
+    typedef complex<double>  Z;
+
+    const int bandWidths[][2] = { {1,1}, {2,5}, {5,2}, {0,3}, {3,0},
+                                  {0,0}, {10,10} };
+
+    for (auto kb : bandWidths) {
+        runGb<double>(1000, kb[0], kb[1], 1);
+        runGb<double>(1000, kb[0], kb[1], 3);
+        runGb<Z>(500, kb[0], kb[1], 2);
+    }
+    runGb<double>(7, 1, 2, 1);
+
+    const int kds[] = { 0, 1, 5, 70 };
+    const int ns[]  = { 1, 50, 1000 };
+
+    for (int kd : kds) {
+        for (int n : ns) {
+            runPb<SbMatrix<BandStorage<double> > >(n, kd, Upper, 2);
+            runPb<SbMatrix<BandStorage<double> > >(n, kd, Lower, 2);
+            runPb<HbMatrix<BandStorage<Z> > >(n, kd, Upper, 2);
+            runPb<HbMatrix<BandStorage<Z> > >(n, kd, Lower, 2);
+        }
+    }
+    runSingularBlock();
+}
+
+int
+main()
+{
+    run();
+
+#   ifdef _OPENMP
+    for (int t=1; t<=4; ++t) {
+        omp_set_num_threads(t);
+        runGb<double>(20000, 4, 7, 2);
+        runPb<SbMatrix<BandStorage<double> > >(20000, 8, Lower, 1);
+    }
+#   endif
+}
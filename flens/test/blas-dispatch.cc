@@ -0,0 +1,372 @@
+#include <cxxstd/cmath.h>
+#include <cxxstd/complex.h>
+#include <cxxstd/cstdio.h>
+#include <cxxstd/cstdlib.h>
+#include <cxxstd/fstream.h>
+#include <cxxstd/iostream.h>
+#include <cxxstd/limits.h>
+#include <cxxstd/vector.h>
+#include <flens/flens.cxx>
+
+#ifndef SEED
+#define SEED  0
+#endif
+
+//
+//  Compile with an external BLAS, e.g.
+//
+//      -DWITH_OPENBLAS -lopenblas
+//
+//  such that sizes at a threshold go to the external BLAS and sizes just
+//  below it to the generic kernels.  Without an external BLAS both sizes use
+//  the generic kernels.  All values are integers, so results have to be
+//  identical to the reference loops.
+//
+//  Environment overrides are read on first use of the thresholds, so they
+//  get set at the very beginning of main.
+//
+
+using namespace cxxblas;
+using namespace std;
+
+typedef complex<double>  zdouble;
+
+const char *configFile = "blas-dispatch.config";
+const char *saveFile   = "blas-dispatch.save";
+
+template <typename T>
+T
+integerValue()
+{
+    return T(rand() % 10 - 5);
+}
+
+template <>
+zdouble
+integerValue<zdouble>()
+{
+    return zdouble(rand() % 10 - 5, rand() % 10 - 5);
+}
+
+template <typename T>
+void
+fill(T *x, int n)
+{
+    for (int i=0; i<n; ++i) {
+        x[i] = integerValue<T>();
+    }
+}
+
+//
+//  y = alpha*x + y
+//
+template <typename T>
+void
+testAxpy(int n)
+{
+    flens::DenseVector<flens::Array<T> >  x(n), y(n), y_(n);
+
+    fill(x.data(), n);
+    fill(y.data(), n);
+    y_ = y;
+
+    const T alpha = integerValue<T>();
+
+    flens::blas::axpy(alpha, x, y);
+    for (int i=1; i<=n; ++i) {
+        y_(i) += alpha*x(i);
+    }
+    if (! flens::lapack::isIdentical(y, y_, "y", "y_")) {
+        cerr << endl << "failed: axpy [n = " << n << "]" << endl;
+        ASSERT(0);
+    }
+}
+
+//
+//  result = x^T*y
+//
+template <typename T>
+void
+testDot(int n)
+{
+    flens::DenseVector<flens::Array<T> >  x(n), y(n);
+
+    fill(x.data(), n);
+    fill(y.data(), n);
+
+    T result_ = T(0);
+    for (int i=1; i<=n; ++i) {
+        result_ += x(i)*y(i);
+    }
+
+    const T result = flens::blas::dotu(x, y);
+    if (! flens::lapack::isIdentical(result, result_, "result", "result_")) {
+        cerr << endl << "failed: dotu [n = " << n << "]" << endl;
+        ASSERT(0);
+    }
+}
+
+//
+//  y = beta*y + alpha*A*x.  For beta==0 the content of y must not be
+//  referenced, so it gets initialized with NaN.
+//
+template <typename T>
+void
+testGemv(int m, int n)
+{
+    flens::GeMatrix<flens::FullStorage<T> >  A(m, n);
+    flens::DenseVector<flens::Array<T> >     x(n), y(m), y_(m);
+
+    fill(A.data(), m*n);
+    fill(x.data(), n);
+
+    for (int test=1; test<=2; ++test) {
+        const T alpha = integerValue<T>();
+        const T beta  = (test==1) ? T(0) : integerValue<T>();
+
+        if (test==1) {
+            y = numeric_limits<double>::quiet_NaN();
+        } else {
+            fill(y.data(), m);
+        }
+        for (int i=1; i<=m; ++i) {
+            T y_i = T(0);
+            for (int j=1; j<=n; ++j) {
+                y_i += A(i,j)*x(j);
+            }
+            y_(i) = alpha*y_i;
+            if (test!=1) {
+                y_(i) += beta*y(i);
+            }
+        }
+
+        flens::blas::mv(flens::NoTrans, alpha, A, x, beta, y);
+        if (! flens::lapack::isIdentical(y, y_, "y", "y_")) {
+            cerr << endl << "failed: gemv [m = " << m << ", n = " << n
+                 << ", beta = " << beta << "]" << endl;
+            ASSERT(0);
+        }
+    }
+}
+
+//
+//  C = beta*C + alpha*A*B.  For beta==0 the content of C must not be
+//  referenced, so it gets initialized with NaN.
+//
+template <typename T>
+void
+testGemm(int m, int n, int k)
+{
+    flens::GeMatrix<flens::FullStorage<T> >  A(m, k), B(k, n), C(m, n),
+                                             C_(m, n);
+
+    fill(A.data(), m*k);
+    fill(B.data(), k*n);
+
+    for (int test=1; test<=2; ++test) {
+        const T alpha = integerValue<T>();
+        const T beta  = (test==1) ? T(0) : integerValue<T>();
+
+        if (test==1) {
+            C = numeric_limits<double>::quiet_NaN();
+        } else {
+            fill(C.data(), m*n);
+        }
+        for (int i=1; i<=m; ++i) {
+            for (int j=1; j<=n; ++j) {
+                T c_ij = T(0);
+                for (int l=1; l<=k; ++l) {
+                    c_ij += A(i,l)*B(l,j);
+                }
+                C_(i,j) = alpha*c_ij;
+                if (test!=1) {
+                    C_(i,j) += beta*C(i,j);
+                }
+            }
+        }
+
+        flens::blas::mm(flens::NoTrans, flens::NoTrans, alpha, A, B, beta, C);
+        if (! flens::lapack::isIdentical(C, C_, "C", "C_")) {
+            cerr << endl << "failed: gemm [m = " << m << ", n = " << n
+                 << ", k = " << k << ", beta = " << beta << "]" << endl;
+            ASSERT(0);
+        }
+    }
+}
+
+//
+//  The generic symv and hemv kernels must not reference y for beta==0
+//
+template <typename T>
+void
+testSymvHemv(int n)
+{
+    const bool isComplex = flens::IsComplex<T>::value;
+
+    std::vector<T>  A(n*n), x(n), y(n), y_(n);
+
+    fill(A.data(), n*n);
+    fill(x.data(), n);
+    for (int i=0; i<n; ++i) {
+        A[i*n+i] = cxxblas::real(A[i*n+i]);
+        for (int j=0; j<i; ++j) {
+            A[j*n+i] = isComplex ? cxxblas::conjugate(A[i*n+j]) : A[i*n+j];
+        }
+    }
+    for (int i=0; i<n; ++i) {
+        y_[i] = T(0);
+        for (int j=0; j<n; ++j) {
+            y_[i] += A[i*n+j]*x[j];
+        }
+        y[i] = numeric_limits<double>::quiet_NaN();
+    }
+
+    if (isComplex) {
+        hemv_generic(RowMajor, Upper, NoTrans, n, T(1), A.data(), n,
+                     x.data(), 1, T(0), y.data(), 1);
+    } else {
+        symv_generic(RowMajor, Upper, n, T(1), A.data(), n,
+                     x.data(), 1, T(0), y.data(), 1);
+    }
+    for (int i=0; i<n; ++i) {
+        if (! flens::lapack::isIdentical(y[i], y_[i], "y[i]", "y_[i]")) {
+            cerr << endl << "failed: " << (isComplex ? "hemv" : "symv")
+                 << " with beta = 0 [n = " << n << "]" << endl;
+            ASSERT(0);
+        }
+    }
+}
+
+//
+//  Results just below and at each threshold
+//
+template <typename T>
+void
+run()
+{
+    const long t = 120;
+
+    BlasDispatch::setThreshold(DispatchAxpy, t);
+    BlasDispatch::setThreshold(DispatchDot,  t);
+    BlasDispatch::setThreshold(DispatchGemv, t);
+    BlasDispatch::setThreshold(DispatchGemm, t);
+
+#   ifndef CXXBLAS_NO_RUNTIME_DISPATCH
+    for (int r=0; r<BlasDispatch::numRoutines; ++r) {
+        if (BlasDispatch::useExternal(DispatchRoutine(r), t-1)
+         || ! BlasDispatch::useExternal(DispatchRoutine(r), t))
+        {
+            cerr << endl << "failed: useExternal ["
+                 << BlasDispatch::name(DispatchRoutine(r)) << "]" << endl;
+            ASSERT(0);
+        }
+    }
+#   endif
+
+    testAxpy<T>(t-1);
+    testAxpy<T>(t);
+
+    testDot<T>(t-1);
+    testDot<T>(t);
+
+    // m*n = 119 and 120
+    testGemv<T>(7, 17);
+    testGemv<T>(12, 10);
+
+    // m*n*k = 119 and 120
+    testGemm<T>(7, 17, 1);
+    testGemm<T>(6, 5, 4);
+
+//
+//  A negative threshold disables the external BLAS
+//
+    BlasDispatch::setThreshold(DispatchGemm, -1);
+#   ifndef CXXBLAS_NO_RUNTIME_DISPATCH
+    if (BlasDispatch::useExternal(DispatchGemm, 1000000)) {
+        cerr << endl << "failed: negative threshold" << endl;
+        ASSERT(0);
+    }
+#   endif
+    testGemm<T>(6, 5, 4);
+
+    testSymvHemv<T>(9);
+
+    BlasDispatch::reset();
+}
+
+int
+main()
+{
+    srand(SEED);
+
+//
+//  The config file sets gemv and gemm, the environment overrides gemm
+//
+    {
+        ofstream out(configFile);
+        out << "# comment line" << endl;
+        out << "gemv 77   # trailing comment" << endl;
+        out << "gemm 99" << endl;
+        out << "malformed" << endl;
+        out << "gemv" << endl;
+        out << "unknown 5" << endl;
+    }
+    setenv("CXXBLAS_DISPATCH_CONFIG", configFile, 1);
+    setenv("CXXBLAS_DISPATCH_GEMM", "1234", 1);
+
+    if (BlasDispatch::threshold(DispatchGemv)!=77
+     || BlasDispatch::threshold(DispatchGemm)!=1234)
+    {
+        cerr << endl << "failed: environment overrides" << endl;
+        cerr << "gemv = " << BlasDispatch::threshold(DispatchGemv) << endl;
+        cerr << "gemm = " << BlasDispatch::threshold(DispatchGemm) << endl;
+        ASSERT(0);
+    }
+
+//
+//  reset() restores the built-in defaults
+//
+    const long axpy = BlasDispatch::threshold(DispatchAxpy);
+
+    BlasDispatch::reset();
+    if (BlasDispatch::threshold(DispatchAxpy)!=axpy
+     || BlasDispatch::threshold(DispatchGemv)==77
+     || BlasDispatch::threshold(DispatchGemm)==1234)
+    {
+        cerr << endl << "failed: reset" << endl;
+        ASSERT(0);
+    }
+
+//
+//  save/load round-trip
+//
+    long thresholds[BlasDispatch::numRoutines];
+    for (int r=0; r<BlasDispatch::numRoutines; ++r) {
+        thresholds[r] = 1 + rand() % 100000;
+        BlasDispatch::setThreshold(DispatchRoutine(r), thresholds[r]);
+    }
+    ASSERT(BlasDispatch::save(saveFile));
+    BlasDispatch::reset();
+    ASSERT(BlasDispatch::load(saveFile));
+
+    for (int r=0; r<BlasDispatch::numRoutines; ++r) {
+        const long threshold = BlasDispatch::threshold(DispatchRoutine(r));
+        if (! flens::lapack::isIdentical(threshold, thresholds[r],
+                                         "threshold", "thresholds[r]"))
+        {
+            cerr << endl << "failed: save/load ["
+                 << BlasDispatch::name(DispatchRoutine(r)) << "]" << endl;
+            ASSERT(0);
+        }
+    }
+    if (BlasDispatch::load("blas-dispatch.does-not-exist")) {
+        cerr << endl << "failed: load of missing file" << endl;
+        ASSERT(0);
+    }
+
+    remove(configFile);
+    remove(saveFile);
+
+    run<double>();
+    run<zdouble>();
+}
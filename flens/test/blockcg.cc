@@ -0,0 +1,174 @@
+#include <cxxstd/iostream.h>
+
+#define USE_PLAYGROUND
+#include <flens/flens.cxx>
+
+#ifndef SEED
+#define SEED  0
+#endif
+
+#ifndef GRID
+#define GRID  20
+#endif
+
+//
+//  Block CG with deflation.  The right-hand sides contain columns that
+//  converge before the first iteration (zero and exact initial guess) and
+//  duplicated columns.  Converged columns get swapped to the back, so all
+//  of them have to end up in their original position and must not depend on
+//  the other columns.
+//
+
+using namespace flens;
+using namespace std;
+
+typedef double                                  T;
+typedef GeMatrix<FullStorage<T> >               DGeMatrix;
+typedef DenseVector<Array<T> >                  DDenseVector;
+
+//
+//  2D Poisson matrix on a k x k grid and its full control matrix A_
+//
+template <typename Coord, typename MA>
+void
+setup(int k, StorageUpLo upLo, MA &A, DGeMatrix &A_)
+{
+    const int n = k*k;
+
+    A_.resize(n, n);
+    A_ = T(0);
+
+    SyCoordMatrix<Coord>  B(n, upLo);
+    for (int i=1; i<=k; ++i) {
+        for (int j=1; j<=k; ++j) {
+            const int p = (i-1)*k + j;
+            B(p,p) += 4;
+            A_(p,p) = 4;
+            if (j<k) {
+                (upLo==Upper) ? B(p,p+1) -= 1 : B(p+1,p) -= 1;
+                A_(p,p+1) = A_(p+1,p) = -1;
+            }
+            if (i<k) {
+                (upLo==Upper) ? B(p,p+k) -= 1 : B(p+k,p) -= 1;
+                A_(p,p+k) = A_(p+k,p) = -1;
+            }
+        }
+    }
+    A = B;
+}
+
+template <typename MA>
+void
+run(const MA &A, const DGeMatrix &A_)
+{
+    const Underscore<int> _;
+
+    const int n    = A_.numRows();
+    const int nRhs = 6;
+    const T   tol  = 1e-20;
+
+//
+//  Columns:  1, 5, 6 random, 2 zero, 3 with exact initial guess and 4 a
+//  copy of 1.
+//
+    DGeMatrix     B(n, nRhs), X(n, nRhs);
+    DDenseVector  x3(n);
+
+    for (int i=1; i<=n; ++i) {
+        B(i,1) = rand() % 10;
+        B(i,5) = rand() % 10;
+        B(i,6) = rand() % 10;
+        x3(i)  = rand() % 10;
+    }
+    B(_,3) = A_*x3;
+    B(_,4) = B(_,1);
+    X(_,3) = x3;
+
+    const DGeMatrix X0 = X;
+
+    int it = solver::blockcg(A, X, B, tol);
+    if (it!=0) {
+        cerr << endl << "failed: blockcg did not converge" << endl;
+        ASSERT(0);
+    }
+
+//
+//  All columns solve A*X = B
+//
+    DGeMatrix AX = A_*X;
+    if (! lapack::isClose(AX, B, 1e-8, "A*X", "B")) {
+        cerr << endl << "failed: A*X = B" << endl;
+        ASSERT(0);
+    }
+
+//
+//  Deflated columns stay untouched and in place
+//
+    if (! lapack::isIdentical(X(_,2), X0(_,2), "X(_,2)", "X0(_,2)")) {
+        cerr << endl << "failed: zero right-hand side" << endl;
+        ASSERT(0);
+    }
+    if (! lapack::isIdentical(X(_,3), x3, "X(_,3)", "x3")) {
+        cerr << endl << "failed: exact initial guess" << endl;
+        ASSERT(0);
+    }
+    if (! lapack::isIdentical(X(_,4), X(_,1), "X(_,4)", "X(_,1)")) {
+        cerr << endl << "failed: duplicated right-hand side" << endl;
+        ASSERT(0);
+    }
+
+//
+//  Each column agrees with CG for this column alone
+//
+    for (int j=1; j<=nRhs; ++j) {
+        DDenseVector  x = X0(_,j);
+
+        solver::cg(A, x, B(_,j), tol);
+        if (! lapack::isClose(X(_,j), x, 1e-8, "X(_,j)", "x")) {
+            cerr << endl << "failed: blockcg and cg differ [j = " << j << "]"
+                 << endl;
+            ASSERT(0);
+        }
+    }
+
+//
+//  After a single iteration the deflated columns are already in place
+//
+    X = X0;
+    it = solver::blockcg(A, X, B, tol, 1);
+    if (it==0) {
+        cerr << endl << "failed: blockcg converged in one iteration" << endl;
+        ASSERT(0);
+    }
+    if (! lapack::isIdentical(X(_,2), X0(_,2), "X(_,2)", "X0(_,2)")
+     || ! lapack::isIdentical(X(_,3), x3, "X(_,3)", "x3")
+     || ! lapack::isIdentical(X(_,4), X(_,1), "X(_,4)", "X(_,1)"))
+    {
+        cerr << endl << "failed: deflation after one iteration" << endl;
+        ASSERT(0);
+    }
+}
+
+int
+main()
+{
+    srand(SEED);
+
+    typedef CoordStorage<T, CoordRowColCmp>  CoordRC;
+    typedef CoordStorage<T, CoordColRowCmp>  CoordCR;
+
+    DGeMatrix  A_;
+
+    for (StorageUpLo upLo : { Upper, Lower }) {
+        {
+            SyCRSMatrix<CRS<T> >  A;
+            setup<CoordRC>(GRID, upLo, A, A_);
+            run(A, A_);
+        }
+        {
+            SyCCSMatrix<CCS<T> >  A;
+            setup<CoordCR>(GRID, upLo, A, A_);
+            run(A, A_);
+        }
+    }
+}
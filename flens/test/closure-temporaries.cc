@@ -0,0 +1,196 @@
+#include <cxxstd/cstdlib.h>
+#include <cxxstd/iostream.h>
+#include <new>
+#include <flens/flens.cxx>
+
+#ifndef N
+#define N  100
+#endif
+
+using namespace flens;
+using namespace std;
+
+//
+//  Counts all allocations through operator new (std::allocator) and all
+//  chunks allocated by the workspace arena.  Expressions get evaluated once
+//  before counting so that the arena is warmed up.
+//
+static long numNew = 0;
+
+void *
+operator new(size_t numBytes)
+{
+    ++numNew;
+    void *p = malloc(numBytes);
+    if (!p) {
+        throw bad_alloc();
+    }
+    return p;
+}
+
+void
+operator delete(void *p) noexcept
+{
+    free(p);
+}
+
+long
+numAllocations()
+{
+    return numNew + Workspace::numChunkAllocations();
+}
+
+typedef GeMatrix<FullStorage<double> >      DGeMatrix;
+typedef DenseVector<Array<double> >        DDenseVector;
+
+template <typename Func>
+void
+check(const char *expr, long maxAllocations, Func f)
+{
+    f();
+
+    long before = numAllocations();
+    f();
+    long allocations = numAllocations() - before;
+
+    cout << expr << ": " << allocations << " allocations" << endl;
+    if (allocations>maxAllocations) {
+        cerr << endl << "failed: " << expr << " [at most " << maxAllocations
+             << " allocations expected]" << endl;
+        ASSERT(0);
+    }
+}
+
+int
+main()
+{
+    const int  n = N;
+
+    DGeMatrix  A(n, n), B(n, n), C(n, n), D(n, n), E(n, n), R(n, n);
+    DDenseVector  x(n), y(n), z(n);
+
+    fillRandom(A);
+    fillRandom(B);
+    fillRandom(D);
+    fillRandom(E);
+    fillRandom(x);
+    fillRandom(y);
+
+    check("C = A*B + D*E", 0, [&] {
+        C = A*B + D*E;
+    });
+    R = 0;
+    blas::mm(NoTrans, NoTrans, 1.0, A, B, 0.0, R);
+    blas::mm(NoTrans, NoTrans, 1.0, D, E, 1.0, R);
+    if (! lapack::isClose(C, R, 1e-10, "C", "R")) {
+        cerr << endl << "failed: C = A*B + D*E" << endl;
+        ASSERT(0);
+    }
+
+    check("C += A*B - D*E", 0, [&] {
+        C += A*B - D*E;
+    });
+    blas::mm(NoTrans, NoTrans,  1.0, A, B, 1.0, R);
+    blas::mm(NoTrans, NoTrans, -1.0, D, E, 1.0, R);
+    blas::mm(NoTrans, NoTrans,  1.0, A, B, 1.0, R);
+    blas::mm(NoTrans, NoTrans, -1.0, D, E, 1.0, R);
+    if (! lapack::isClose(C, R, 1e-10, "C", "R")) {
+        cerr << endl << "failed: C += A*B - D*E" << endl;
+        ASSERT(0);
+    }
+
+    R = C;
+    check("C = A*B + 0.5*C", 0, [&] {
+        C = A*B + 0.5*C;
+    });
+    for (int k=0; k<2; ++k) {
+        blas::mm(NoTrans, NoTrans, 1.0, A, B, 0.5, R);
+    }
+    if (! lapack::isClose(C, R, 1e-10, "C", "R")) {
+        cerr << endl << "failed: C = A*B + 0.5*C" << endl;
+        ASSERT(0);
+    }
+
+    z = y;
+    check("y = A*x + 2*y", 0, [&] {
+        y = A*x + 2.0*y;
+    });
+    for (int k=0; k<2; ++k) {
+        blas::mv(NoTrans, 1.0, A, x, 2.0, z);
+    }
+    if (! lapack::isClose(y, z, 1e-10, "y", "z")) {
+        cerr << endl << "failed: y = A*x + 2*y" << endl;
+        ASSERT(0);
+    }
+
+    check("y += A*x - B*z", 0, [&] {
+        y += A*x - B*z;
+    });
+
+    //
+    //  Expiring matrices and vectors hand over their memory to empty matrices
+    //  and vectors.  Only T and v get allocated.
+    //
+    check("DGeMatrix M = move(T)", 1, [&] {
+        DGeMatrix  T(n, n);
+        double  *p = T.data();
+
+        T = 1;
+        DGeMatrix  M = std::move(T);
+        if (M.data()!=p || T.numRows()!=0) {
+            cerr << endl << "failed: memory was not moved" << endl;
+            ASSERT(0);
+        }
+    });
+    check("M = move(T)", 1, [&] {
+        DGeMatrix  T(n, n), M;
+        double  *p = T.data();
+
+        T = 1;
+        M = std::move(T);
+        if (M.data()!=p) {
+            cerr << endl << "failed: memory was not moved" << endl;
+            ASSERT(0);
+        }
+    });
+    check("w = move(v)", 1, [&] {
+        DDenseVector  v(n), w;
+        double  *p = v.data();
+
+        v = 2;
+        w = std::move(v);
+        if (w.data()!=p || w(n)!=2) {
+            cerr << endl << "failed: memory was not moved" << endl;
+            ASSERT(0);
+        }
+    });
+
+    //
+    //  Matrices and vectors that are not empty keep their memory such that
+    //  views stay valid.
+    //
+    const Underscore<int>  _;
+
+    check("C = move(T)", 1, [&] {
+        DGeMatrix  T(n, n);
+        auto       V = C(_(1,2),_);
+
+        T = 1;
+        C = std::move(T);
+        if (V(1,1)!=1 || C(n,n)!=1) {
+            cerr << endl << "failed: view of C is not valid" << endl;
+            ASSERT(0);
+        }
+    });
+    check("y = move(v)", 1, [&] {
+        DDenseVector  v(n);
+        auto          u = y(_(1,2));
+
+        v = 2;
+        y = std::move(v);
+        if (u(1)!=2 || y(n)!=2) {
+            cerr << endl << "failed: view of y is not valid" << endl;
+            ASSERT(0);
+        }
+    });
+}
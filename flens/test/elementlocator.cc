@@ -0,0 +1,219 @@
+#include <cxxstd/iostream.h>
+#include <flens/flens.cxx>
+
+#ifndef SEED
+#define SEED  0
+#endif
+
+#ifndef MAX_M
+#define MAX_M  300
+#endif
+
+#ifndef MAX_N
+#define MAX_N  300
+#endif
+
+#ifndef MAX_NNZ
+#define MAX_NNZ  3*MAX_M
+#endif
+
+
+using namespace flens;
+using namespace std;
+
+//
+//  Create sparse matrix A (compressed row or col storage) from random
+//  coordinates.
+//
+template <typename Coord, typename MA>
+void
+setup(int m, int n, int max_nnz, int indexBase, MA &A)
+{
+    GeCoordMatrix<Coord>  B(m, n, 1, indexBase);
+
+    for (int k=1; k<=max_nnz; ++k) {
+        const int i = indexBase + rand() % m;
+        const int j = indexBase + rand() % n;
+
+        B(i,j) += 1 + rand() % 9;
+    }
+    A = B;
+}
+
+//
+//  Slot matrix K_ with K_(i,j) = k if values()(k) holds A(i,j).  All other
+//  entries are indexBase-1.
+//
+template <typename CRS>
+void
+slots(const GeCRSMatrix<CRS> &A, GeMatrix<FullStorage<int> > &K_)
+{
+    const CRS &crs = A.engine();
+    const int i0   = A.firstRow();
+
+    K_.resize(A.numRows(), A.numCols(), i0, A.firstCol());
+    K_ = i0-1;
+
+    for (int i=A.firstRow(); i<=A.lastRow(); ++i) {
+        for (int k=crs.rows()(i); k<crs.rows()(i+1); ++k) {
+            K_(i,crs.cols()(k)) = k;
+        }
+    }
+}
+
+template <typename CCS>
+void
+slots(const GeCCSMatrix<CCS> &A, GeMatrix<FullStorage<int> > &K_)
+{
+    const CCS &ccs = A.engine();
+    const int j0   = A.firstCol();
+
+    K_.resize(A.numRows(), A.numCols(), A.firstRow(), j0);
+    K_ = j0-1;
+
+    for (int j=A.firstCol(); j<=A.lastCol(); ++j) {
+        for (int k=ccs.cols()(j); k<ccs.cols()(j+1); ++k) {
+            K_(ccs.rows()(k),j) = k;
+        }
+    }
+}
+
+//
+//  Check locate() for all entries including those not in the pattern.
+//
+template <typename MA>
+void
+locate(const MA &A, const GeMatrix<FullStorage<int> > &K_)
+{
+    GeMatrix<FullStorage<int> >  K(A.numRows(), A.numCols(),
+                                   A.firstRow(), A.firstCol());
+
+    for (int j=A.firstCol(); j<=A.lastCol(); ++j) {
+        for (int i=A.firstRow(); i<=A.lastRow(); ++i) {
+            K(i,j) = A.engine().locate(i,j);
+        }
+    }
+
+    if (! lapack::isIdentical(K, K_, "K", "K_")) {
+        cerr << endl << "failed: locate(i,j)" << endl;
+        ASSERT(0);
+    }
+}
+
+//
+//  Record a random access sequence and replay it with new values.  Each
+//  pass gets compared against the same updates applied to a full matrix.
+//
+template <typename MA>
+void
+replay(MA &A, const GeMatrix<FullStorage<int> > &K_)
+{
+    typedef typename MA::ElementType        ElementType;
+    typedef typename MA::Engine             Engine;
+
+    const int nnz = A.engine().numNonZeros();
+
+    if (nnz==0) {
+        return;
+    }
+
+    vector<int>  rows, cols;
+    for (int j=A.firstCol(); j<=A.lastCol(); ++j) {
+        for (int i=A.firstRow(); i<=A.lastRow(); ++i) {
+            if (K_(i,j)>=A.engine().indexBase()) {
+                rows.push_back(i);
+                cols.push_back(j);
+            }
+        }
+    }
+
+    //
+    //  Each entry of the pattern gets accessed about twice in random order
+    //
+    vector<int>  seq(2*nnz);
+    for (size_t p=0; p<seq.size(); ++p) {
+        seq[p] = rand() % nnz;
+    }
+
+    ElementLocator<Engine>          locator(A.engine());
+    GeMatrix<FullStorage<double> >  A_(A.numRows(), A.numCols(),
+                                       A.firstRow(), A.firstCol());
+
+    for (int pass=1; pass<=3; ++pass) {
+        A.engine().values() = ElementType(0);
+        A_ = ElementType(0);
+
+        locator.rewind();
+        for (size_t p=0; p<seq.size(); ++p) {
+            const int          i = rows[seq[p]];
+            const int          j = cols[seq[p]];
+            const ElementType  v = pass*(1 + rand() % 9);
+
+            locator(i,j) += v;
+            A_(i,j)      += v;
+        }
+
+        if (locator.numRecorded()!=int(seq.size())) {
+            cerr << endl << "failed: numRecorded() = "
+                 << locator.numRecorded() << endl;
+            ASSERT(0);
+        }
+
+        GeMatrix<FullStorage<double> >  A__ = A;
+
+        if (! lapack::isIdentical(A_, A__, "A_", "A__")) {
+            cerr << endl << "failed: ElementLocator pass " << pass << endl;
+            ASSERT(0);
+        }
+    }
+
+    //
+    //  After reset() the locator records a new sequence
+    //
+    locator.reset();
+    A.engine().values() = ElementType(0);
+    locator(rows[0], cols[0]) = ElementType(1);
+
+    if (locator.numRecorded()!=1
+     || A(rows[0], cols[0])!=ElementType(1))
+    {
+        cerr << endl << "failed: ElementLocator reset()" << endl;
+        ASSERT(0);
+    }
+}
+
+int
+main()
+{
+    srand(SEED);
+
+    for (int run=1; run<=10; ++run) {
+        int m       = std::max(1, rand() % (MAX_M));
+        int n       = std::max(1, rand() % (MAX_N));
+        // check case 'nnz==0' at least once
+        int max_nnz = (run==1) ? 0 : (rand() % (MAX_NNZ));
+
+        for (int indexBase=-3; indexBase<=3; ++indexBase) {
+            GeMatrix<FullStorage<int> >  K_;
+
+            {
+                GeCRSMatrix<CRS<double> >  A;
+
+                setup<CoordStorage<double, CoordRowColCmp> >(m, n, max_nnz,
+                                                              indexBase, A);
+                slots(A, K_);
+                locate(A, K_);
+                replay(A, K_);
+            }
+            {
+                GeCCSMatrix<CCS<double> >  A;
+
+                setup<CoordStorage<double, CoordColRowCmp> >(m, n, max_nnz,
+                                                              indexBase, A);
+                slots(A, K_);
+                locate(A, K_);
+                replay(A, K_);
+            }
+        }
+    }
+}
@@ -0,0 +1,87 @@
+#include <cxxstd/cmath.h>
+#include <cxxstd/iostream.h>
+
+//
+//  A small cutoff makes even moderate sizes go through several levels of
+//  the Strassen-Winograd recursion (and its dynamic peeling).  Compile with
+//  -fopenmp to run the top level products as tasks.
+//
+#define STRASSEN_CUTOFF     8
+#define STRASSEN_TASK_DEPTH 2
+
+#define USE_PLAYGROUND
+#include <flens/flens.cxx>
+
+using namespace flens;
+using namespace std;
+
+template <typename MA>
+double
+maxAbs(const MA &A)
+{
+    double ref = 0;
+    for (int j=1; j<=A.numCols(); ++j) {
+        for (int i=1; i<=A.numRows(); ++i) {
+            ref = std::max(ref, double(abs(A(i,j))));
+        }
+    }
+    return ref;
+}
+
+template <typename T, StorageOrder Order>
+void
+run(int m, int n, int k, const T &beta)
+{
+    typedef GeMatrix<FullStorage<T, Order> >   Matrix;
+    typedef typename ComplexTrait<T>::PrimitiveType  PT;
+
+    const Transpose trans[] = { NoTrans, Conj, Trans, ConjTrans };
+    const T         alpha(1.5);
+
+    for (Transpose transA : trans) {
+        for (Transpose transB : trans) {
+            const bool noTransA = (transA==NoTrans || transA==Conj);
+            const bool noTransB = (transB==NoTrans || transB==Conj);
+
+            Matrix A = noTransA ? Matrix(m, k) : Matrix(k, m);
+            Matrix B = noTransB ? Matrix(k, n) : Matrix(n, k);
+            Matrix C(m, n), R;
+
+            fillRandom(A);
+            fillRandom(B);
+            fillRandom(C);
+            R = C;
+
+            blas::mm(transA, transB, alpha, A, B, beta, R);
+            blas::extensions::mm_strassen(transA, transB, alpha, A, B,
+                                          beta, C);
+
+            const double tol = k*100*numeric_limits<PT>::epsilon()
+                             *(maxAbs(R)+1);
+            if (! lapack::isClose(C, R, tol, "C", "R")) {
+                cerr << endl << "failed: mm_strassen [m = " << m
+                     << ", n = " << n << ", k = " << k
+                     << ", transA = " << transA << ", transB = " << transB
+                     << ", beta = " << beta << "]" << endl;
+                ASSERT(0);
+            }
+        }
+    }
+}
+
+int
+main()
+{
+    const int sizes[][3] = { {1, 1, 1}, {17, 13, 9}, {64, 64, 64},
+                             {65, 67, 63}, {101, 77, 131} };
+
+    for (const auto &s : sizes) {
+        run<double, ColMajor>(s[0], s[1], s[2], 0.0);
+        run<double, ColMajor>(s[0], s[1], s[2], 0.5);
+        run<double, RowMajor>(s[0], s[1], s[2], 0.5);
+        run<complex<double>, ColMajor>(s[0], s[1], s[2],
+                                       complex<double>(0.5, 1));
+        run<complex<double>, RowMajor>(s[0], s[1], s[2],
+                                       complex<double>(0));
+    }
+}
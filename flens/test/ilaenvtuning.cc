@@ -0,0 +1,197 @@
+#include <cxxstd/complex.h>
+#include <cxxstd/cstdio.h>
+#include <cxxstd/cstdlib.h>
+#include <cxxstd/fstream.h>
+#include <cxxstd/iostream.h>
+#include <flens/flens.cxx>
+
+//
+//  Tuned ilaenv values.  The file given by FLENS_ILAENV_CONFIG is read on
+//  first use of the table, so the variable gets set at the very beginning of
+//  main.
+//
+
+using namespace flens;
+using namespace std;
+
+typedef complex<double>  zdouble;
+
+const char *configFile = "ilaenvtuning.config";
+const char *saveFile   = "ilaenvtuning.save";
+
+template <typename T>
+void
+checkEntry(int spec, const char *name, bool found, int value=0)
+{
+    int        value_ = -1;
+    const bool found_ = lapack::IlaenvTuning::get<T>(spec, name, value_);
+
+    if (found_!=found || (found && value_!=value)) {
+        cerr << endl << "failed: entry "
+             << lapack::IlaenvTuning::typeChar<T>() << " " << name
+             << " " << spec << endl;
+        cerr << "found = " << found_ << ", value = " << value_
+             << " (expected " << value << ")" << endl;
+        ASSERT(0);
+    }
+}
+
+template <typename T>
+void
+checkIlaenv(int spec, const char *name, int value)
+{
+    const int value_ = lapack::ilaenv<T>(spec, name, "");
+
+    if (value_!=value) {
+        cerr << endl << "failed: ilaenv "
+             << lapack::IlaenvTuning::typeChar<T>() << " " << name
+             << " " << spec << endl;
+        cerr << "value = " << value_ << " (expected " << value << ")"
+             << endl;
+        ASSERT(0);
+    }
+}
+
+//
+//  Entries read from FLENS_ILAENV_CONFIG.  Comments and malformed lines get
+//  skipped.
+//
+void
+config()
+{
+    checkEntry<double>(1, "GETRF", true, 11);
+    checkEntry<double>(2, "GETRF", true, 3);
+    checkEntry<zdouble>(1, "GEQRF", true, 17);
+    checkEntry<double>(3, "GETRF", false);
+    checkEntry<float>(1, "GETRF", false);
+    checkEntry<double>(1, "POTRF", false);
+    checkEntry<double>(1, "GEQRF", false);
+
+    lapack::IlaenvTuning::clear();
+    checkEntry<double>(1, "GETRF", false);
+}
+
+//
+//  set, get and remove.  Entries of different types are independent.
+//
+void
+setGetRemove()
+{
+    lapack::IlaenvTuning::set<double>(1, "GETRF", 32);
+    lapack::IlaenvTuning::set<zdouble>(1, "GETRF", 48);
+    lapack::IlaenvTuning::set<double>(3, "GEQRF", 100);
+
+    checkEntry<double>(1, "GETRF", true, 32);
+    checkEntry<zdouble>(1, "GETRF", true, 48);
+    checkEntry<double>(3, "GEQRF", true, 100);
+    checkEntry<float>(1, "GETRF", false);
+    checkEntry<double>(2, "GETRF", false);
+
+    lapack::IlaenvTuning::set<double>(1, "GETRF", 40);
+    checkEntry<double>(1, "GETRF", true, 40);
+
+    lapack::IlaenvTuning::remove<double>(1, "GETRF");
+    checkEntry<double>(1, "GETRF", false);
+    checkEntry<zdouble>(1, "GETRF", true, 48);
+
+    lapack::IlaenvTuning::remove<double>(1, "GETRF");
+    checkEntry<double>(1, "GETRF", false);
+
+    lapack::IlaenvTuning::clear();
+    checkEntry<zdouble>(1, "GETRF", false);
+    checkEntry<double>(3, "GEQRF", false);
+}
+
+//
+//  save/load round-trip
+//
+void
+saveLoad()
+{
+    lapack::IlaenvTuning::set<float>(1, "GETRF", 24);
+    lapack::IlaenvTuning::set<double>(2, "GETRF", 4);
+    lapack::IlaenvTuning::set<zdouble>(3, "GEQRF", 96);
+
+    ASSERT(lapack::IlaenvTuning::save(saveFile));
+    lapack::IlaenvTuning::clear();
+    ASSERT(lapack::IlaenvTuning::load(saveFile));
+
+    checkEntry<float>(1, "GETRF", true, 24);
+    checkEntry<double>(2, "GETRF", true, 4);
+    checkEntry<zdouble>(3, "GEQRF", true, 96);
+    checkEntry<double>(1, "GETRF", false);
+
+//
+//  load merges into the table
+//
+    lapack::IlaenvTuning::set<double>(1, "GETRF", 8);
+    lapack::IlaenvTuning::set<float>(1, "GETRF", 12);
+    ASSERT(lapack::IlaenvTuning::load(saveFile));
+    checkEntry<double>(1, "GETRF", true, 8);
+    checkEntry<float>(1, "GETRF", true, 24);
+
+    if (lapack::IlaenvTuning::load("ilaenvtuning.does-not-exist")) {
+        cerr << endl << "failed: load of missing file" << endl;
+        ASSERT(0);
+    }
+    lapack::IlaenvTuning::clear();
+}
+
+//
+//  ilaenv returns tuned values over the builtin defaults
+//
+template <typename T>
+void
+tunedIlaenv()
+{
+    lapack::IlaenvTuning::clear();
+
+    int defaults[4];
+    for (int spec=1; spec<=3; ++spec) {
+        defaults[spec] = lapack::ilaenv<T>(spec, "GETRF", "");
+        lapack::IlaenvTuning::set<T>(spec, "GETRF", defaults[spec]+7*spec);
+    }
+    for (int spec=1; spec<=3; ++spec) {
+        checkIlaenv<T>(spec, "GETRF", defaults[spec]+7*spec);
+    }
+
+    lapack::IlaenvTuning::remove<T>(2, "GETRF");
+    checkIlaenv<T>(1, "GETRF", defaults[1]+7);
+    checkIlaenv<T>(2, "GETRF", defaults[2]);
+    checkIlaenv<T>(3, "GETRF", defaults[3]+21);
+
+    lapack::IlaenvTuning::clear();
+    for (int spec=1; spec<=3; ++spec) {
+        checkIlaenv<T>(spec, "GETRF", defaults[spec]);
+    }
+}
+
+int
+main()
+{
+    {
+        ofstream out(configFile);
+        out << "# comment line" << endl;
+        out << "D GETRF 1 11   # trailing comment" << endl;
+        out << "D GETRF 2 3" << endl;
+        out << "Z GEQRF 1 17" << endl;
+        out << "malformed" << endl;
+        out << "D GETRF 3" << endl;
+        out << "DD GETRF 3 5" << endl;
+        out << "D GETRF x 5" << endl;
+        out << "# D POTRF 1 5" << endl;
+    }
+    setenv("FLENS_ILAENV_CONFIG", configFile, 1);
+
+    config();
+    setGetRemove();
+    saveLoad();
+
+    tunedIlaenv<float>();
+    tunedIlaenv<double>();
+    tunedIlaenv<complex<float> >();
+    tunedIlaenv<zdouble>();
+
+    remove(configFile);
+    remove(saveFile);
+}
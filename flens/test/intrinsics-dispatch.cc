@@ -0,0 +1,171 @@
+#include <cxxstd/cmath.h>
+#include <cxxstd/iostream.h>
+
+#define USE_PLAYGROUND
+#include <flens/flens.cxx>
+
+//
+//  Compile with -DWITH_INTRINSICS_DISPATCH (and -msse3 or -DWITH_AVX -mavx
+//  for the baseline), then all intrinsics levels supported by the host get
+//  compared against a scalar reference.
+//
+
+using namespace flens;
+using namespace std;
+
+template <typename T>
+T
+tolerance(int n, T ref)
+{
+    return T(4)*n*numeric_limits<T>::epsilon()*(ref+T(1));
+}
+
+template <typename T>
+void
+run(IntrinsicsLevel level, int n)
+{
+    typedef GeMatrix<FullStorage<T, ColMajor> >     ColMatrix;
+    typedef GeMatrix<FullStorage<T, RowMajor> >     RowMatrix;
+    typedef DenseVector<Array<T> >                  Vector;
+
+    const char *name = cxxblas::IntrinsicsDispatch::name(level);
+    const T     alpha(1.5), beta(0.5);
+
+    const int m = n+3, k = n+5;
+
+    ColMatrix  A(m, n), B(n, k), C(m, k), C_(m, k);
+    RowMatrix  R(m, n);
+    Vector     x(n), y(m), y_(m), z(n), z_(n);
+
+    fillRandom(A);
+    fillRandom(B);
+    fillRandom(C);
+    fillRandom(x);
+    fillRandom(y);
+    fillRandom(z);
+    R = A;
+
+    cxxblas::IntrinsicsDispatch::setLevel(level);
+
+    //
+    //  axpy and dot
+    //
+    z_ = z;
+    blas::axpy(alpha, x, z);
+    T ref = 0;
+    for (int i=1; i<=n; ++i) {
+        z_(i) += alpha*x(i);
+        ref    = std::max(ref, abs(z_(i)));
+    }
+    if (! lapack::isClose(z, z_, tolerance(n, ref), "z", "z_")) {
+        cerr << endl << "failed: axpy [" << name << ", n = " << n << "]"
+             << endl;
+        ASSERT(0);
+    }
+
+    T dot_ = 0, absDot = 0;
+    for (int i=1; i<=n; ++i) {
+        dot_   += x(i)*z(i);
+        absDot += abs(x(i)*z(i));
+    }
+    if (! lapack::isClose(blas::dot(x, z), dot_, tolerance(n, absDot),
+                          "dot(x, z)", "dot_"))
+    {
+        cerr << endl << "failed: dot [" << name << ", n = " << n << "]"
+             << endl;
+        ASSERT(0);
+    }
+
+    //
+    //  nrm2 (Blue's algorithm)
+    //
+    T nrm2_ = 0;
+    for (int i=1; i<=n; ++i) {
+        nrm2_ += z(i)*z(i);
+    }
+    nrm2_ = sqrt(nrm2_);
+    if (! lapack::isClose(blas::nrm2(z), nrm2_, tolerance(n, nrm2_),
+                          "nrm2(z)", "nrm2_"))
+    {
+        cerr << endl << "failed: nrm2 [" << name << ", n = " << n << "]"
+             << endl;
+        ASSERT(0);
+    }
+
+    //
+    //  gemv, column major (y += A*x) and row major (y += R*x) storage
+    //
+    for (int rowMajor=0; rowMajor<=1; ++rowMajor) {
+        y_ = y;
+        if (rowMajor) {
+            blas::mv(NoTrans, alpha, R, x, beta, y);
+        } else {
+            blas::mv(NoTrans, alpha, A, x, beta, y);
+        }
+        ref = 0;
+        for (int i=1; i<=m; ++i) {
+            T yi = beta*y_(i);
+            for (int j=1; j<=n; ++j) {
+                yi += alpha*A(i,j)*x(j);
+            }
+            y_(i) = yi;
+            ref   = std::max(ref, abs(yi));
+        }
+        if (! lapack::isClose(y, y_, tolerance(n, ref), "y", "y_")) {
+            cerr << endl << "failed: gemv ("
+                 << (rowMajor ? "RowMajor" : "ColMajor") << ") [" << name
+                 << ", n = " << n << "]" << endl;
+            ASSERT(0);
+        }
+    }
+
+    //
+    //  gemm
+    //
+    C_ = C;
+    blas::mm(NoTrans, NoTrans, alpha, A, B, beta, C);
+    ref = 0;
+    for (int j=1; j<=k; ++j) {
+        for (int i=1; i<=m; ++i) {
+            T cij = beta*C_(i,j);
+            for (int l=1; l<=n; ++l) {
+                cij += alpha*A(i,l)*B(l,j);
+            }
+            C_(i,j) = cij;
+            ref     = std::max(ref, abs(cij));
+        }
+    }
+    if (! lapack::isClose(C, C_, tolerance(n, ref), "C", "C_")) {
+        cerr << endl << "failed: gemm [" << name << ", n = " << n << "]"
+             << endl;
+        ASSERT(0);
+    }
+}
+
+int
+main()
+{
+    const IntrinsicsLevel host   = cxxblas::IntrinsicsDispatch::host();
+    const IntrinsicsLevel levels[] = { IntrinsicsLevel::SSE,
+                                       IntrinsicsLevel::AVX,
+                                       IntrinsicsLevel::AVX2,
+                                       IntrinsicsLevel::AVX512 };
+
+    cout << "host: " << cxxblas::IntrinsicsDispatch::name(host) << endl;
+
+    //
+    //  Odd sizes exercise the masked tails of all kernels
+    //
+    const int sizes[] = { 1, 3, 7, 13, 31, 64, 67, 130 };
+
+    for (IntrinsicsLevel level : levels) {
+        if (level>host) {
+            continue;
+        }
+        for (int n : sizes) {
+            run<float>(level, n);
+            run<double>(level, n);
+        }
+    }
+    cxxblas::IntrinsicsDispatch::reset();
+}
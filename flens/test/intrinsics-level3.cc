@@ -0,0 +1,220 @@
+#include <cxxstd/cmath.h>
+#include <cxxstd/iostream.h>
+
+#define USE_PLAYGROUND
+#include <flens/flens.cxx>
+
+//
+//  Compile with -DWITH_AVX -mavx (or -msse3) and -fopenmp for the threaded
+//  variant.  symm, syrk, trmm and trsm of the intrinsics backend get compared
+//  against products with explicitly expanded matrices.  Sizes cross the
+//  recursion of trmm/trsm and the blocking of the gemm driver.
+//
+
+using namespace flens;
+using namespace std;
+
+//
+//  Allowed error relative to the largest entry of the reference R
+//
+template <typename T>
+double
+tolerance(const GeMatrix<FullStorage<T> > &R)
+{
+    typedef typename ComplexTrait<T>::PrimitiveType  PT;
+
+    double ref = 0;
+    for (int j=1; j<=R.numCols(); ++j) {
+        for (int i=1; i<=R.numRows(); ++i) {
+            ref = std::max(ref, double(abs(R(i,j))));
+        }
+    }
+    return 1000*numeric_limits<PT>::epsilon()*(ref+1);
+}
+
+//
+//  Reference for op(A) with A triangular (stored in the triangle upLo)
+//
+template <typename T>
+GeMatrix<FullStorage<T> >
+opTr(StorageUpLo upLo, Transpose trans, Diag diag,
+     const GeMatrix<FullStorage<T> > &A)
+{
+    const int n = A.numRows();
+
+    GeMatrix<FullStorage<T> >  R(n, n);
+
+    for (int j=1; j<=n; ++j) {
+        for (int i=1; i<=n; ++i) {
+            bool stored = (upLo==Upper) ? (i<=j) : (i>=j);
+            T    aij    = (i==j && diag==Unit) ? T(1)
+                        : (stored ? A(i,j) : T(0));
+            if (trans==Conj || trans==ConjTrans) {
+                aij = cxxblas::conjugate(aij);
+            }
+            if (trans==NoTrans || trans==Conj) {
+                R(i,j) = aij;
+            } else {
+                R(j,i) = aij;
+            }
+        }
+    }
+    return R;
+}
+
+//
+//  Triangular view of A
+//
+template <typename MA>
+auto
+tr(StorageUpLo upLo, Diag diag, MA &A) -> decltype(A.upper())
+{
+    if (upLo==Upper) {
+        return (diag==Unit) ? A.upperUnit() : A.upper();
+    }
+    return (diag==Unit) ? A.lowerUnit() : A.lower();
+}
+
+template <typename T>
+void
+run(int m, int n)
+{
+    typedef GeMatrix<FullStorage<T> >   Matrix;
+
+    const StorageUpLo upLos[] = { Upper, Lower };
+    const Side        sides[] = { Left, Right };
+    const Transpose   trans[] = { NoTrans, Conj, Trans, ConjTrans };
+    const Diag        diags[] = { NonUnit, Unit };
+
+    const T alpha(1.5), beta(0.5);
+
+    Matrix B(m, n), C(m, n), R(m, n);
+
+    fillRandom(B);
+    fillRandom(C);
+
+    for (Side side : sides) {
+        const int k = (side==Left) ? m : n;
+
+        //
+        //  Off-diagonal entries of order 1/k keep the triangular solves
+        //  with unit diagonal well conditioned.
+        //
+        Matrix A(k, k), S(k, k);
+
+        fillRandom(A);
+        A *= T(1)/T(k);
+        for (int i=1; i<=k; ++i) {
+            A(i,i) += T(2);
+        }
+
+        for (StorageUpLo upLo : upLos) {
+            for (int j=1; j<=k; ++j) {
+                for (int i=1; i<=k; ++i) {
+                    bool stored = (upLo==Upper) ? (i<=j) : (i>=j);
+                    S(i,j) = stored ? A(i,j) : A(j,i);
+                }
+            }
+
+            //
+            //  symm
+            //
+            Matrix C_ = C;
+            R = beta*C;
+            if (side==Left) {
+                R += alpha*S*B;
+                blas::mm(Left, alpha, tr(upLo, NonUnit, A).symmetric(), B,
+                         beta, C_);
+            } else {
+                R += alpha*B*S;
+                blas::mm(Right, alpha, tr(upLo, NonUnit, A).symmetric(), B,
+                         beta, C_);
+            }
+            if (! lapack::isClose(C_, R, tolerance(R), "C_", "R")) {
+                cerr << endl << "failed: symm [m = " << m << ", n = " << n
+                     << "]" << endl;
+                ASSERT(0);
+            }
+
+            //
+            //  trmm and trsm
+            //
+            for (Transpose transA : trans) {
+                for (Diag diag : diags) {
+                    Matrix OpA = opTr(upLo, transA, diag, A);
+                    Matrix X   = B;
+
+                    R = (side==Left) ? Matrix(alpha*OpA*B)
+                                     : Matrix(alpha*B*OpA);
+                    blas::mm(side, transA, alpha, tr(upLo, diag, A), X);
+                    if (! lapack::isClose(X, R, tolerance(R), "X", "R")) {
+                        cerr << endl << "failed: trmm [m = " << m
+                             << ", n = " << n << "]" << endl;
+                        ASSERT(0);
+                    }
+
+                    X = B;
+                    blas::sm(side, transA, alpha, tr(upLo, diag, A), X);
+                    R = (side==Left) ? Matrix(OpA*X) : Matrix(X*OpA);
+
+                    const Matrix AB = alpha*B;
+                    if (! lapack::isClose(R, AB, tolerance(AB), "R", "AB")) {
+                        cerr << endl << "failed: trsm [m = " << m
+                             << ", n = " << n << "]" << endl;
+                        ASSERT(0);
+                    }
+                }
+            }
+        }
+    }
+
+    //
+    //  syrk (C is n x n, A is n x m or m x n)
+    //
+    for (StorageUpLo upLo : upLos) {
+        for (int t=0; t<2; ++t) {
+            Matrix A = (t==0) ? Matrix(n, m) : Matrix(m, n);
+            Matrix D(n, n), D_, R(n, n);
+
+            fillRandom(A);
+            fillRandom(D);
+            D_ = D;
+
+            if (t==0) {
+                R = alpha*A*transpose(A) + beta*D;
+                blas::rk(NoTrans, alpha, A, beta,
+                         tr(upLo, NonUnit, D_).symmetric());
+            } else {
+                R = alpha*transpose(A)*A + beta*D;
+                blas::rk(Trans, alpha, A, beta,
+                         tr(upLo, NonUnit, D_).symmetric());
+            }
+            for (int j=1; j<=n; ++j) {
+                for (int i=1; i<=n; ++i) {
+                    if ((upLo==Upper) ? (i>j) : (i<j)) {
+                        R(i,j) = D(i,j);
+                    }
+                }
+            }
+            if (! lapack::isClose(D_, R, tolerance(R), "D_", "R")) {
+                cerr << endl << "failed: syrk [m = " << n << ", n = " << m
+                     << "]" << endl;
+                ASSERT(0);
+            }
+        }
+    }
+}
+
+int
+main()
+{
+    const int sizes[][2] = { {1, 1}, {5, 3}, {17, 13}, {33, 40},
+                             {97, 131}, {301, 257} };
+
+    for (const auto &s : sizes) {
+        run<float>(s[0], s[1]);
+        run<double>(s[0], s[1]);
+        run<complex<float> >(s[0], s[1]);
+        run<complex<double> >(s[0], s[1]);
+    }
+}
@@ -0,0 +1,342 @@
+#include <cxxstd/iostream.h>
+#include <cxxstd/string.h>
+#include <flens/flens.cxx>
+
+#ifndef SEED
+#define SEED  0
+#endif
+
+#ifndef MAX_DIM
+#define MAX_DIM  30
+#endif
+
+//
+//  Products of three to five matrices (and matrix-vector chains) get
+//  evaluated in the cheapest order.  Results are compared against an
+//  explicit evaluation from left to right.  All values are integers so the
+//  order of evaluation does not change the result.
+//
+
+using namespace flens;
+using namespace std;
+
+typedef double                                   T;
+typedef GeMatrix<FullStorage<T> >                DGeMatrix;
+typedef GeMatrix<FullStorage<T, RowMajor> >      DGeMatrixRowMajor;
+typedef DenseVector<Array<T> >                   DDenseVector;
+
+const T tol = 1e-8;
+
+//
+//  Instrumentation hook
+//
+string  chainOrder;
+double  chainFlops, chainFlopsLeftToRight;
+int     numReports = 0;
+
+void
+hook(const char *order, double flops, double flopsLeftToRight)
+{
+    chainOrder            = order;
+    chainFlops            = flops;
+    chainFlopsLeftToRight = flopsLeftToRight;
+    ++numReports;
+}
+
+int
+randomDim()
+{
+    return 1 + rand() % MAX_DIM;
+}
+
+int
+randomBase()
+{
+    return rand() % 7 - 3;
+}
+
+//
+//  m x n matrix with random index base and integer entries
+//
+template <typename MA>
+void
+setup(int m, int n, MA &A)
+{
+    const int firstRow = randomBase();
+    const int firstCol = randomBase();
+
+    A.resize(m, n, firstRow, firstCol);
+    for (int i=A.firstRow(); i<=A.lastRow(); ++i) {
+        for (int j=A.firstCol(); j<=A.lastCol(); ++j) {
+            A(i,j) = rand() % 10 - 5;
+        }
+    }
+}
+
+void
+setup(int n, DDenseVector &x)
+{
+    x.resize(n, randomBase());
+    for (int i=x.firstIndex(); i<=x.lastIndex(); ++i) {
+        x(i) = rand() % 10 - 5;
+    }
+}
+
+//
+//  Reference products with exactly two factors
+//
+template <typename MA, typename MB>
+DGeMatrix
+mult(Transpose transA, const MA &A, Transpose transB, const MB &B)
+{
+    DGeMatrix C;
+    blas::mm(transA, transB, T(1), A, B, T(0), C);
+    return C;
+}
+
+template <typename MA, typename MB>
+DGeMatrix
+mult(const MA &A, const MB &B)
+{
+    return mult(NoTrans, A, NoTrans, B);
+}
+
+template <typename MA>
+DDenseVector
+mult(Transpose trans, const MA &A, const DDenseVector &x)
+{
+    DDenseVector y;
+    blas::mv(trans, T(1), A, x, T(0), y);
+    return y;
+}
+
+void
+check(const DGeMatrix &C, const DGeMatrix &C_, const char *what)
+{
+    if (! lapack::isClose(C, C_, tol, "C", "C_")) {
+        cerr << endl << "failed: " << what << endl;
+        ASSERT(0);
+    }
+}
+
+void
+check(const DDenseVector &y, const DDenseVector &y_, const char *what)
+{
+    if (! lapack::isClose(y, y_, tol, "y", "y_")) {
+        cerr << endl << "failed: " << what << endl;
+        ASSERT(0);
+    }
+}
+
+//
+//  Chains with random shapes
+//
+void
+chains()
+{
+    int d[6];
+    for (int i=0; i<6; ++i) {
+        d[i] = randomDim();
+    }
+
+    DGeMatrix          A, B, C, D, E, At, Ct, C_, R, Rt, Rt_, R4, R4_,
+                       R5, R5_;
+    DGeMatrixRowMajor  BR;
+
+    setup(d[0], d[1], A);
+    setup(d[1], d[2], B);
+    setup(d[2], d[3], C);
+    setup(d[3], d[4], D);
+    setup(d[4], d[5], E);
+    setup(d[1], d[0], At);
+    setup(d[3], d[2], Ct);
+    setup(d[1], d[2], BR);
+
+//
+//  Three factors
+//
+    R  = A*B*C;
+    C_ = mult(mult(A, B), C);
+    check(R, C_, "A*B*C");
+
+    R  = transpose(At)*B*C;
+    C_ = mult(mult(Trans, At, NoTrans, B), C);
+    check(R, C_, "transpose(At)*B*C");
+
+    R  = 2.0*A*BR*transpose(Ct);
+    C_ = mult(NoTrans, mult(A, BR), Trans, Ct);
+    C_ *= 2;
+    check(R, C_, "2*A*BR*transpose(Ct)");
+
+    Rt  = transpose(A*B*C);
+    Rt_ = transpose(mult(mult(A, B), C));
+    check(Rt, Rt_, "transpose(A*B*C)");
+
+//
+//  Four factors
+//
+    R4  = A*B*C*D;
+    R4_ = mult(mult(mult(A, B), C), D);
+    check(R4, R4_, "A*B*C*D");
+
+    R4  = A*(B*transpose(Ct))*D;
+    R4_ = mult(mult(NoTrans, mult(A, B), Trans, Ct), D);
+    check(R4, R4_, "A*(B*transpose(Ct))*D");
+
+//
+//  Five factors
+//
+    R5  = A*B*C*D*E;
+    R5_ = mult(mult(mult(mult(A, B), C), D), E);
+    check(R5, R5_, "A*B*C*D*E");
+
+    R5  = transpose(At)*BR*C*(0.5*D)*E;
+    R5_ = mult(mult(mult(mult(Trans, At, NoTrans, BR), C), D), E);
+    R5_ *= 0.5;
+    check(R5, R5_, "transpose(At)*BR*C*(0.5*D)*E");
+
+//
+//  R += alpha*A*B*C
+//
+    setup(d[0], d[3], R);
+    C_ = R;
+    R  += 2.0*A*B*C;
+    C_ += 2.0*mult(mult(A, B), C);
+    check(R, C_, "R += 2*A*B*C");
+
+//
+//  A*B*C*x versus A*(B*(C*x)) and x*(A*B*C)
+//
+    DDenseVector  x, y, y_, Cx, BCx;
+
+    setup(d[3], x);
+    y   = A*B*C*x;
+    Cx  = C*x;
+    BCx = B*Cx;
+    y_  = A*BCx;
+    check(y, y_, "A*B*C*x");
+
+    y_ = mult(NoTrans, mult(mult(A, B), C), x);
+    check(y, y_, "A*B*C*x (left to right)");
+
+    DDenseVector  xt, yt, yt_;
+
+    setup(d[0], xt);
+    yt  = xt*(A*B*C);
+    yt_ = mult(Trans, mult(mult(A, B), C), xt);
+    check(yt, yt_, "x*(A*B*C)");
+
+    DDenseVector  xs, ys, ys_;
+
+    setup(d[4], xs);
+    setup(d[1], ys);
+    ys_ = ys;
+    ys  += 3.0*B*C*D*xs;
+    ys_ += 3.0*mult(NoTrans, mult(mult(B, C), D), xs);
+    check(ys, ys_, "y += 3*B*C*D*x");
+}
+
+//
+//  The target is one of the factors
+//
+void
+aliasing()
+{
+    const int n = randomDim();
+
+    DGeMatrix  A, B, C, C_;
+
+    setup(n, n, A);
+    setup(n, n, B);
+    setup(n, n, C);
+
+    C_ = mult(mult(A, C), B);
+    C  = A*C*B;
+    check(C, C_, "C = A*C*B");
+
+    C_ = mult(mult(C, A), C);
+    C  = C*A*C;
+    check(C, C_, "C = C*A*C");
+
+    C_ = C;
+    C_ += mult(mult(A, B), C);
+    C += A*B*C;
+    check(C, C_, "C += A*B*C");
+}
+
+//
+//  The hook reports the chosen order and the flops.
+//
+void
+order()
+{
+    const int n = 30;
+
+    DGeMatrix  A, B, C, R;
+
+    setup(n, 1, A);
+    setup(1, n, B);
+    setup(n, 1, C);
+
+    blas::MatrixChain::setHook(hook);
+
+    numReports = 0;
+    R = A*B*C;
+    ASSERT(numReports==1);
+    if (chainOrder!="(A1*(A2*A3))"
+     || chainFlops!=4*n || chainFlopsLeftToRight!=4*n*n)
+    {
+        cerr << endl << "failed: order of A*B*C" << endl;
+        cerr << "order            = " << chainOrder << endl;
+        cerr << "flops            = " << chainFlops << endl;
+        cerr << "flopsLeftToRight = " << chainFlopsLeftToRight << endl;
+        ASSERT(0);
+    }
+
+    DGeMatrix  BAB = B*A*B;
+    if (chainOrder!="((A1*A2)*A3)") {
+        cerr << endl << "failed: order of B*A*B" << endl;
+        cerr << "order = " << chainOrder << endl;
+        ASSERT(0);
+    }
+
+//
+//  For transpose(A*B*C) the factors are C^T, B^T, A^T
+//
+    DGeMatrix  D;
+    setup(1, n, D);
+
+    R = transpose(D*A*B);
+    if (chainOrder!="(A1*(A2*A3))") {
+        cerr << endl << "failed: order of transpose(D*A*B)" << endl;
+        cerr << "order = " << chainOrder << endl;
+        ASSERT(0);
+    }
+
+    DDenseVector  x;
+    setup(1, x);
+
+    DDenseVector  y = A*B*A*x;
+    if (chainOrder!="(A1*(A2*(A3*x)))") {
+        cerr << endl << "failed: order of A*B*A*x" << endl;
+        cerr << "order = " << chainOrder << endl;
+        ASSERT(0);
+    }
+
+    blas::MatrixChain::setHook(0);
+    numReports = 0;
+    R = A*B*C;
+    ASSERT(numReports==0);
+}
+
+int
+main()
+{
+    srand(SEED);
+
+    for (int run=1; run<=100; ++run) {
+        chains();
+        aliasing();
+    }
+    order();
+}
@@ -0,0 +1,373 @@
+#include <cxxstd/cmath.h>
+#include <cxxstd/iostream.h>
+#include <cxxstd/random.h>
+
+///
+///  Include the header of mpfr::real first, this enables the mpfr kernels
+///
+#define REAL_ENABLE_CONVERSION_OPERATORS
+#include <external/real.hpp>
+
+#include <flens/flens.cxx>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+//
+//  Compile with -fopenmp for the threaded variant.  The mpfr kernels for
+//  dot, iamax, gemv, ger, gemm and trsm get compared against plain loops
+//  using the operators of mpfr::real.
+//
+
+using namespace flens;
+using namespace std;
+
+typedef mpfr::real<256>                        T;
+typedef DenseVector<Array<T> >                 MpVector;
+typedef GeMatrix<FullStorage<T, ColMajor> >    ColMatrix;
+typedef GeMatrix<FullStorage<T, RowMajor> >    RowMatrix;
+
+mt19937 engine(1);
+
+T
+randomEntry()
+{
+    uniform_real_distribution<double>  uniform(-1, 1);
+
+    // entries with more digits than a double
+    return T(uniform(engine))/T(3) + T(uniform(engine));
+}
+
+template <typename V>
+void
+fill(DenseVector<V> &x)
+{
+    for (int i=1; i<=x.length(); ++i) {
+        x(i) = randomEntry();
+    }
+}
+
+template <typename M>
+void
+fill(GeMatrix<M> &A)
+{
+    for (int i=1; i<=A.numRows(); ++i) {
+        for (int j=1; j<=A.numCols(); ++j) {
+            A(i,j) = randomEntry();
+        }
+    }
+}
+
+//
+//  Error bound for a sum of n products with absolute value sum ref
+//
+T
+tolerance(int n, const T &ref)
+{
+    const T eps = numeric_limits<T>::epsilon();
+
+    return T(8)*T(n+1)*eps*(ref+T(1));
+}
+
+void
+runLevel1(int n)
+{
+    MpVector x(n), y(n);
+    fill(x);
+    fill(y);
+
+    T dot_ = 0, absDot = 0;
+    for (int i=1; i<=n; ++i) {
+        dot_   += x(i)*y(i);
+        absDot += abs(x(i)*y(i));
+    }
+    if (! lapack::isClose(blas::dot(x, y), dot_, tolerance(n, absDot),
+                          "dot(x, y)", "dot_"))
+    {
+        cerr << endl << "failed: dot [n = " << n << "]" << endl;
+        ASSERT(0);
+    }
+
+    const Underscore<int> _;
+    if (n>1) {
+        T dotStrided_ = 0;
+        for (int i=1; i<=n; i+=2) {
+            dotStrided_ += x(i)*y(i);
+        }
+        if (! lapack::isClose(blas::dot(x(_(1,2,n)), y(_(1,2,n))),
+                              dotStrided_, tolerance(n, absDot),
+                              "dot(x(_(1,2,n)), y(_(1,2,n)))", "dotStrided_"))
+        {
+            cerr << endl << "failed: dot (stride 2) [n = " << n << "]"
+                 << endl;
+            ASSERT(0);
+        }
+    }
+
+    int iMax = 1;
+    for (int i=2; i<=n; ++i) {
+        if (abs(x(i))>abs(x(iMax))) {
+            iMax = i;
+        }
+    }
+    if (blas::iamax(x)!=iMax) {
+        cerr << endl << "failed: iamax [n = " << n << "]" << endl;
+        ASSERT(0);
+    }
+}
+
+template <typename Matrix>
+void
+runLevel2(int m, int n)
+{
+    const Transpose trans[] = { NoTrans, Trans, ConjTrans };
+    const T         alpha = randomEntry(), beta = randomEntry();
+
+    Matrix A(m, n), A_;
+    fill(A);
+
+    for (Transpose t : trans) {
+        const bool noTrans = (t==NoTrans);
+        const int  lenX = noTrans ? n : m;
+        const int  lenY = noTrans ? m : n;
+
+        MpVector x(lenX), y(lenY), y_(lenY);
+        fill(x);
+        fill(y);
+        y_ = y;
+
+        blas::mv(t, alpha, A, x, beta, y);
+
+        T ref = 0;
+        for (int i=1; i<=lenY; ++i) {
+            T yi = 0, absYi = 0;
+            for (int j=1; j<=lenX; ++j) {
+                const T aij = noTrans ? A(i,j) : A(j,i);
+                yi    += aij*x(j);
+                absYi += abs(aij*x(j));
+            }
+            ref   = std::max(ref, abs(beta*y_(i)) + abs(alpha)*absYi);
+            y_(i) = beta*y_(i) + alpha*yi;
+        }
+        if (! lapack::isClose(y, y_, tolerance(std::max(m, n), ref),
+                              "y", "y_"))
+        {
+            cerr << endl << "failed: gemv [m = " << m << ", n = " << n
+                 << "]" << endl;
+            ASSERT(0);
+        }
+    }
+
+    MpVector x(m), y(n);
+    fill(x);
+    fill(y);
+    A_ = A;
+
+    blas::r(alpha, x, y, A);
+
+    T ref = 0;
+    for (int i=1; i<=m; ++i) {
+        for (int j=1; j<=n; ++j) {
+            ref     = std::max(ref, abs(A_(i,j))+abs(alpha*x(i)*y(j)));
+            A_(i,j) = A_(i,j)+alpha*x(i)*y(j);
+        }
+    }
+    if (! lapack::isClose(A, A_, tolerance(1, ref), "A", "A_")) {
+        cerr << endl << "failed: ger [m = " << m << ", n = " << n << "]"
+             << endl;
+        ASSERT(0);
+    }
+}
+
+template <typename Matrix>
+void
+runLevel3(int m, int n, int k)
+{
+    const Transpose trans[] = { NoTrans, Trans };
+    const T         alpha = randomEntry();
+    const T         betas[] = { T(0), T(1), randomEntry() };
+
+    for (Transpose transA : trans) {
+        for (Transpose transB : trans) {
+            for (const T &beta : betas) {
+                Matrix A = (transA==NoTrans) ? Matrix(m, k) : Matrix(k, m);
+                Matrix B = (transB==NoTrans) ? Matrix(k, n) : Matrix(n, k);
+                Matrix C(m, n), C_;
+
+                fill(A);
+                fill(B);
+                fill(C);
+                C_ = C;
+
+                blas::mm(transA, transB, alpha, A, B, beta, C);
+
+                T ref = 0;
+                for (int i=1; i<=m; ++i) {
+                    for (int j=1; j<=n; ++j) {
+                        T cij = 0, absCij = 0;
+                        for (int l=1; l<=k; ++l) {
+                            const T ail = (transA==NoTrans) ? A(i,l) : A(l,i);
+                            const T blj = (transB==NoTrans) ? B(l,j) : B(j,l);
+                            cij    += ail*blj;
+                            absCij += abs(ail*blj);
+                        }
+                        ref     = std::max(ref, abs(beta*C_(i,j))
+                                           + abs(alpha)*absCij);
+                        C_(i,j) = beta*C_(i,j) + alpha*cij;
+                    }
+                }
+                if (! lapack::isClose(C, C_, tolerance(k, ref), "C", "C_")) {
+                    cerr << endl << "failed: gemm [m = " << m << ", n = "
+                         << n << ", k = " << k << "]" << endl;
+                    ASSERT(0);
+                }
+            }
+        }
+    }
+}
+
+//
+//  Residual of op(A)*X = alpha*B (Left) or X*op(A) = alpha*B (Right)
+//
+template <typename Matrix, typename TrMatrix>
+void
+checkTrsm(Side side, Transpose trans, const T &alpha, const TrMatrix &A,
+          const Matrix &B, const Matrix &X)
+{
+    const bool left = (side==Left);
+    const int  m = B.numRows(), n = B.numCols(), dim = left ? m : n;
+
+    Matrix AX(m, n), alphaB(m, n);
+
+    T ref = 0;
+    for (int i=1; i<=m; ++i) {
+        for (int j=1; j<=n; ++j) {
+            T bij = 0, absBij = 0;
+            for (int l=1; l<=dim; ++l) {
+                const int r = left ? i : l;
+                const int c = left ? l : j;
+                T arc = (trans==NoTrans) ? A(r,c) : A(c,r);
+                T prod = left ? arc*X(l,j) : X(i,l)*arc;
+                bij    += prod;
+                absBij += abs(prod);
+            }
+            AX(i,j)     = bij;
+            alphaB(i,j) = alpha*B(i,j);
+            ref         = std::max(ref, absBij);
+        }
+    }
+    if (! lapack::isClose(AX, alphaB, tolerance(dim, ref), "AX", "alphaB")) {
+        cerr << endl << "failed: trsm [m = " << m << ", n = " << n
+             << ", side = " << ((left) ? "Left" : "Right") << "]" << endl;
+        ASSERT(0);
+    }
+}
+
+template <typename Matrix>
+void
+runTrsm(int m, int n)
+{
+    const Side      sides[] = { Left, Right };
+    const Transpose trans[] = { NoTrans, Trans };
+    const T         alpha = randomEntry();
+
+    for (Side side : sides) {
+        const int dim = (side==Left) ? m : n;
+
+        Matrix A(dim, dim);
+        fill(A);
+        for (int i=1; i<=dim; ++i) {
+            A(i,i) += T(dim);
+        }
+
+        for (Transpose t : trans) {
+            for (int variant=0; variant<4; ++variant) {
+                Matrix B(m, n), X;
+                fill(B);
+                X = B;
+
+                //
+                //  Dense copy of the triangular matrix for the reference
+                //
+                Matrix TA(dim, dim);
+                TA = T(0);
+                for (int i=1; i<=dim; ++i) {
+                    for (int j=1; j<=dim; ++j) {
+                        const bool upper = (variant<2);
+                        const bool unit  = (variant%2==1);
+                        if (i==j) {
+                            TA(i,j) = unit ? T(1) : A(i,j);
+                        } else if ((i<j)==upper) {
+                            TA(i,j) = A(i,j);
+                        }
+                    }
+                }
+
+                switch (variant) {
+                    case 0: blas::sm(side, t, alpha, A.upper(), X); break;
+                    case 1: blas::sm(side, t, alpha, A.upperUnit(), X); break;
+                    case 2: blas::sm(side, t, alpha, A.lower(), X); break;
+                    case 3: blas::sm(side, t, alpha, A.lowerUnit(), X); break;
+                }
+                checkTrsm(side, t, alpha, TA, B, X);
+            }
+        }
+    }
+}
+
+//
+//  FLENS-LAPACK in mpfr::real uses the kernels above
+//
+void
+runLapack(int n)
+{
+    ColMatrix                 A(n, n);
+    MpVector                  b(n), x(n);
+    DenseVector<Array<int> >  piv(n);
+
+    fill(A);
+    fill(x);
+    b = A*x;
+
+    lapack::sv(A, piv, b);
+
+    T ref = 0;
+    for (int i=1; i<=n; ++i) {
+        ref = std::max(ref, abs(x(i)));
+    }
+    // the condition number of a random matrix grows roughly like n
+    if (! lapack::isClose(b, x, tolerance(n*n, ref), "b", "x")) {
+        cerr << endl << "failed: sv [n = " << n << "]" << endl;
+        ASSERT(0);
+    }
+}
+
+int
+main()
+{
+    const int sizes[] = { 1, 3, 7, 33, 67 };
+
+    for (int n : sizes) {
+        runLevel1(n);
+        runLevel2<ColMatrix>(n, n+3);
+        runLevel2<RowMatrix>(n+3, n);
+        runLevel3<ColMatrix>(n, n+5, n+3);
+        runLevel3<RowMatrix>(n+2, n, n+1);
+        runTrsm<ColMatrix>(n, n+2);
+        runTrsm<RowMatrix>(n+1, n);
+    }
+    runLevel3<ColMatrix>(101, 77, 131);
+
+#   ifdef _OPENMP
+    for (int t=1; t<=4; ++t) {
+        omp_set_num_threads(t);
+        runLevel1(20000);
+        runLevel2<ColMatrix>(200, 150);
+        runLevel3<ColMatrix>(90, 80, 70);
+        runTrsm<ColMatrix>(60, 50);
+    }
+#   endif
+
+    runLapack(100);
+}
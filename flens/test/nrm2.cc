@@ -0,0 +1,172 @@
+#include <cxxstd/cmath.h>
+#include <cxxstd/iostream.h>
+#include <cxxstd/limits.h>
+
+#include <flens/flens.cxx>
+
+//
+//  Compile with -fopenmp for the threaded variant.  Vector norms, lassq and
+//  Frobenius norms computed with Blue's algorithm get compared against a
+//  reference in long double.  Entries are scaled such that squaring them
+//  in double would under- or overflow.
+//
+
+using namespace flens;
+using namespace std;
+
+typedef long double  LD;
+
+LD
+tolerance(int n, LD ref)
+{
+    return (2*n+2)*numeric_limits<double>::epsilon()*fabsl(ref);
+}
+
+template <typename VX>
+LD
+refNorm(const DenseVector<VX> &x)
+{
+    LD sum = 0;
+    for (int i=1; i<=x.length(); ++i) {
+        LD re = real(x(i)), im = imag(x(i));
+        sum += re*re + im*im;
+    }
+    return sqrtl(sum);
+}
+
+template <typename T>
+void
+run(int n, double scale)
+{
+    typedef DenseVector<Array<T> >              Vector;
+    typedef GeMatrix<FullStorage<T> >           Matrix;
+    typedef typename ComplexTrait<T>::PrimitiveType PT;
+
+    const Underscore<int> _;
+
+    Vector x(2*n);
+    fillRandom(x);
+    x *= PT(scale);
+
+    //
+    //  nrm2 for contiguous and strided vectors
+    //
+    const LD nrm2X_  = refNorm(x);
+    const LD nrm2X2_ = refNorm(x(_(1,2,2*n)));
+
+    if (! lapack::isClose(LD(blas::nrm2(x)), nrm2X_, tolerance(n, nrm2X_),
+                          "nrm2(x)", "nrm2X_")
+     || ! lapack::isClose(LD(blas::nrm2(x(_(1,2,2*n)))), nrm2X2_,
+                          tolerance(n, nrm2X2_),
+                          "nrm2(x(_(1,2,2*n)))", "nrm2X2_"))
+    {
+        cerr << endl << "failed: nrm2 [n = " << n << ", scale = " << scale
+             << "]" << endl;
+        ASSERT(0);
+    }
+
+    //
+    //  lassq: merge the second half into the scaled sum of the first
+    //
+    PT s = 0, ssq = 1;
+    lapack::lassq(x(_(1,n)), s, ssq);
+
+    const LD lassq_ = refNorm(x(_(1,n)));
+    if (! lapack::isClose(LD(s*sqrt(ssq)), lassq_, tolerance(n, lassq_),
+                          "s*sqrt(ssq)", "lassq_"))
+    {
+        cerr << endl << "failed: lassq [n = " << n << ", scale = " << scale
+             << "]" << endl;
+        ASSERT(0);
+    }
+
+    lapack::lassq(x(_(n+1,2*n)), s, ssq);
+    if (! lapack::isClose(LD(s*sqrt(ssq)), nrm2X_, tolerance(n, nrm2X_),
+                          "s*sqrt(ssq)", "nrm2X_"))
+    {
+        cerr << endl << "failed: lassq (merge) [n = " << n << ", scale = "
+             << scale << "]" << endl;
+        ASSERT(0);
+    }
+
+    //
+    //  Frobenius norm of a matrix and of a view with gaps
+    //
+    Matrix A(n, 3);
+    fillRandom(A);
+    A *= PT(scale);
+
+    const LD lanA_ = refNorm(A.vectorView());
+    if (! lapack::isClose(LD(lapack::lan(lapack::FrobeniusNorm, A)), lanA_,
+                          tolerance(n, lanA_), "lan(A)", "lanA_"))
+    {
+        cerr << endl << "failed: lan [n = " << n << ", scale = " << scale
+             << "]" << endl;
+        ASSERT(0);
+    }
+    if (n>1) {
+        Matrix B = A(_(1,n-1),_);
+
+        const LD lanB_ = refNorm(B.vectorView());
+        if (! lapack::isClose(
+                    LD(lapack::lan(lapack::FrobeniusNorm, A(_(1,n-1),_))),
+                    lanB_, tolerance(n, lanB_),
+                    "lan(A(_(1,n-1),_))", "lanB_"))
+        {
+            cerr << endl << "failed: lan (view) [n = " << n << ", scale = "
+                 << scale << "]" << endl;
+            ASSERT(0);
+        }
+    }
+}
+
+int
+main()
+{
+    const int    sizes[]  = { 1, 2, 7, 33, 1000, 100000 };
+    const double scales[] = { 1, 1e-160, 1e-300, 1e160, 1e300 };
+
+    for (int n : sizes) {
+        for (double scale : scales) {
+            run<double>(n, scale);
+            run<complex<double> >(n, scale);
+        }
+    }
+
+    //
+    //  Entries of very different magnitude, NaN and Inf
+    //
+    DenseVector<Array<double> > x(1001);
+    fillRandom(x);
+    x(17)   = 1e300;
+    x(500)  = 1e-300;
+    const LD nrm2X_ = refNorm(x);
+    if (! lapack::isClose(LD(blas::nrm2(x)), nrm2X_, tolerance(1001, nrm2X_),
+                          "nrm2(x)", "nrm2X_"))
+    {
+        cerr << endl << "failed: nrm2 (mixed)" << endl;
+        ASSERT(0);
+    }
+
+    x(800) = numeric_limits<double>::infinity();
+    if (! lapack::isIdentical(LD(blas::nrm2(x)), refNorm(x),
+                              "nrm2(x)", "refNorm(x)"))
+    {
+        cerr << endl << "failed: nrm2 (inf)" << endl;
+        ASSERT(0);
+    }
+
+    x(900) = numeric_limits<double>::quiet_NaN();
+    if (! lapack::isIdentical(LD(blas::nrm2(x)), refNorm(x),
+                              "nrm2(x)", "refNorm(x)"))
+    {
+        cerr << endl << "failed: nrm2 (nan)" << endl;
+        ASSERT(0);
+    }
+
+    x = 0;
+    if (! lapack::isIdentical(blas::nrm2(x), 0., "nrm2(x)", "0")) {
+        cerr << endl << "failed: nrm2 (zero)" << endl;
+        ASSERT(0);
+    }
+}
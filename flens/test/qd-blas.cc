@@ -0,0 +1,267 @@
+#include <cxxstd/cmath.h>
+#include <cxxstd/iostream.h>
+#include <cxxstd/random.h>
+
+///
+///  Include the qd-headers first, this enables the double-double kernels
+///
+#include <qd/qd_real.h>
+#include <qd/fpu.h>
+
+#include <flens/flens.cxx>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+//
+//  Compile with -mfma (or -march=native) for the FMA variant of the
+//  error-free transformations and with -fopenmp for the threaded variant.
+//  The double-double kernels for dot, axpy, gemv and gemm get compared
+//  against plain loops using the operators of dd_real.
+//
+
+using namespace flens;
+using namespace std;
+
+typedef dd_real                                T;
+typedef DenseVector<Array<T> >                 DDVector;
+typedef GeMatrix<FullStorage<T, ColMajor> >    ColMatrix;
+typedef GeMatrix<FullStorage<T, RowMajor> >    RowMatrix;
+
+mt19937 engine(1);
+
+T
+randomEntry()
+{
+    uniform_real_distribution<double>  uniform(-1, 1);
+
+    // entries with a non-trivial low part
+    return T(uniform(engine))/T(3) + T(uniform(engine));
+}
+
+template <typename V>
+void
+fill(DenseVector<V> &x)
+{
+    for (int i=1; i<=x.length(); ++i) {
+        x(i) = randomEntry();
+    }
+}
+
+template <typename M>
+void
+fill(GeMatrix<M> &A)
+{
+    for (int i=1; i<=A.numRows(); ++i) {
+        for (int j=1; j<=A.numCols(); ++j) {
+            A(i,j) = randomEntry();
+        }
+    }
+}
+
+//
+//  Error bound for a sum of n products with absolute value sum ref
+//
+T
+tolerance(int n, const T &ref)
+{
+    return T(8)*T(n+1)*T(dd_real::_eps)*(ref+T(1));
+}
+
+void
+runLevel1(int n)
+{
+    DDVector x(n), y(n), y_(n);
+    fill(x);
+    fill(y);
+
+    T dot_ = 0, absDot = 0;
+    for (int i=1; i<=n; ++i) {
+        dot_   += x(i)*y(i);
+        absDot += abs(x(i)*y(i));
+    }
+    if (! lapack::isClose(blas::dot(x, y), dot_, tolerance(n, absDot),
+                          "dot(x, y)", "dot_"))
+    {
+        cerr << endl << "failed: dot [n = " << n << "]" << endl;
+        ASSERT(0);
+    }
+
+    const Underscore<int> _;
+    if (n>1) {
+        T dotStrided_ = 0;
+        for (int i=1; i<=n; i+=2) {
+            dotStrided_ += x(i)*y(i);
+        }
+        if (! lapack::isClose(blas::dot(x(_(1,2,n)), y(_(1,2,n))),
+                              dotStrided_, tolerance(n, absDot),
+                              "dot(x(_(1,2,n)), y(_(1,2,n)))", "dotStrided_"))
+        {
+            cerr << endl << "failed: dot (stride 2) [n = " << n << "]"
+                 << endl;
+            ASSERT(0);
+        }
+    }
+
+    const T alpha = randomEntry();
+    y_ = y;
+    blas::axpy(alpha, x, y);
+    T ref = 0;
+    for (int i=1; i<=n; ++i) {
+        ref   = std::max(ref, abs(y_(i))+abs(alpha*x(i)));
+        y_(i) = y_(i)+alpha*x(i);
+    }
+    if (! lapack::isClose(y, y_, tolerance(n, ref), "y", "y_")) {
+        cerr << endl << "failed: axpy [n = " << n << "]" << endl;
+        ASSERT(0);
+    }
+}
+
+template <typename Matrix>
+void
+runLevel2(int m, int n)
+{
+    const Transpose trans[] = { NoTrans, Trans, ConjTrans };
+    const T         alpha = randomEntry(), beta = randomEntry();
+
+    Matrix A(m, n);
+    fill(A);
+
+    for (Transpose t : trans) {
+        const bool noTrans = (t==NoTrans);
+        const int  lenX = noTrans ? n : m;
+        const int  lenY = noTrans ? m : n;
+
+        DDVector x(lenX), y(lenY), y_(lenY);
+        fill(x);
+        fill(y);
+        y_ = y;
+
+        blas::mv(t, alpha, A, x, beta, y);
+
+        T ref = 0;
+        for (int i=1; i<=lenY; ++i) {
+            T yi = 0, absYi = 0;
+            for (int j=1; j<=lenX; ++j) {
+                const T aij = noTrans ? A(i,j) : A(j,i);
+                yi    += aij*x(j);
+                absYi += abs(aij*x(j));
+            }
+            ref   = std::max(ref, abs(beta*y_(i)) + abs(alpha)*absYi);
+            y_(i) = beta*y_(i) + alpha*yi;
+        }
+        if (! lapack::isClose(y, y_, tolerance(std::max(m, n), ref),
+                              "y", "y_"))
+        {
+            cerr << endl << "failed: gemv [m = " << m << ", n = " << n
+                 << "]" << endl;
+            ASSERT(0);
+        }
+    }
+}
+
+template <typename Matrix>
+void
+runLevel3(int m, int n, int k)
+{
+    const Transpose trans[] = { NoTrans, Trans };
+    const T         alpha = randomEntry();
+    const T         betas[] = { T(0), randomEntry() };
+
+    for (Transpose transA : trans) {
+        for (Transpose transB : trans) {
+            for (const T &beta : betas) {
+                Matrix A = (transA==NoTrans) ? Matrix(m, k) : Matrix(k, m);
+                Matrix B = (transB==NoTrans) ? Matrix(k, n) : Matrix(n, k);
+                Matrix C(m, n), C_;
+
+                fill(A);
+                fill(B);
+                fill(C);
+                C_ = C;
+
+                blas::mm(transA, transB, alpha, A, B, beta, C);
+
+                T ref = 0;
+                for (int i=1; i<=m; ++i) {
+                    for (int j=1; j<=n; ++j) {
+                        T cij = 0, absCij = 0;
+                        for (int l=1; l<=k; ++l) {
+                            const T ail = (transA==NoTrans) ? A(i,l) : A(l,i);
+                            const T blj = (transB==NoTrans) ? B(l,j) : B(j,l);
+                            cij    += ail*blj;
+                            absCij += abs(ail*blj);
+                        }
+                        ref     = std::max(ref, abs(beta*C_(i,j))
+                                           + abs(alpha)*absCij);
+                        C_(i,j) = beta*C_(i,j) + alpha*cij;
+                    }
+                }
+                if (! lapack::isClose(C, C_, tolerance(k, ref), "C", "C_")) {
+                    cerr << endl << "failed: gemm [m = " << m << ", n = "
+                         << n << ", k = " << k << "]" << endl;
+                    ASSERT(0);
+                }
+            }
+        }
+    }
+}
+
+//
+//  FLENS-LAPACK in double-double uses the kernels above
+//
+void
+runLapack(int n)
+{
+    ColMatrix                 A(n, n);
+    DDVector                  b(n), x(n);
+    DenseVector<Array<int> >  piv(n);
+
+    fill(A);
+    fill(x);
+    b = A*x;
+
+    lapack::sv(A, piv, b);
+
+    T ref = 0;
+    for (int i=1; i<=n; ++i) {
+        ref = std::max(ref, abs(x(i)));
+    }
+    // the condition number of a random matrix grows roughly like n
+    if (! lapack::isClose(b, x, tolerance(n*n, ref), "b", "x")) {
+        cerr << endl << "failed: sv [n = " << n << "]" << endl;
+        ASSERT(0);
+    }
+}
+
+int
+main()
+{
+    unsigned int old_cw;
+    fpu_fix_start(&old_cw);
+
+    const int sizes[] = { 1, 3, 7, 64, 67, 130 };
+
+    for (int n : sizes) {
+        runLevel1(n);
+        runLevel1(40000+n);
+        runLevel2<ColMatrix>(n, n+3);
+        runLevel2<RowMatrix>(n+3, n);
+        runLevel3<ColMatrix>(n, n+5, n+3);
+        runLevel3<RowMatrix>(n+2, n, n+1);
+    }
+    runLevel3<ColMatrix>(301, 263, 517);
+
+#   ifdef _OPENMP
+    for (int t=1; t<=4; ++t) {
+        omp_set_num_threads(t);
+        runLevel2<ColMatrix>(300, 200);
+        runLevel3<ColMatrix>(150, 130, 140);
+    }
+#   endif
+
+    runLapack(100);
+
+    fpu_fix_end(&old_cw);
+}
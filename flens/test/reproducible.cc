@@ -0,0 +1,388 @@
+#include <cxxstd/cmath.h>
+#include <cxxstd/iostream.h>
+#include <cxxstd/limits.h>
+#include <cxxstd/random.h>
+#include <cxxstd/vector.h>
+
+#define USE_PLAYGROUND
+#include <flens/flens.cxx>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+//
+//  Compile with -fopenmp for the threaded variant.  Reproducible sums, dot
+//  products and norms must be bitwise identical for permuted or reversed
+//  data and for any number of threads.  Entries span many orders of
+//  magnitude and cancel each other.
+//
+
+using namespace flens;
+using namespace std;
+
+typedef long double  LD;
+
+//
+//  Allowed error of a result rounded to precision T
+//
+template <typename T>
+LD
+tolerance(LD ref, LD tol)
+{
+    return 2*numeric_limits<T>::epsilon()*fabsl(ref) + tol;
+}
+
+//
+//  Compensated summation (Neumaier) for the reference values
+//
+struct RefSum
+{
+    RefSum()
+        : s(0), c(0)
+    {
+    }
+
+    void
+    operator+=(LD v)
+    {
+        const LD t = s + v;
+        c += (fabsl(s)>=fabsl(v)) ? (s-t)+v : (v-t)+s;
+        s = t;
+    }
+
+    LD
+    value() const
+    {
+        return s + c;
+    }
+
+    LD  s, c;
+};
+
+template <typename T>
+struct Results
+{
+    typedef typename cxxblas::ComplexTrait<T>::PrimitiveType  PT;
+
+    T   sum, dotu, dot;
+    PT  asum, nrm2;
+};
+
+template <typename T>
+Results<T>
+reduce(int n, const T *x, const T *y, int inc)
+{
+    Results<T> r;
+
+    cxxblas::sum_reproducible(n, x, inc, r.sum);
+    cxxblas::dotu_reproducible(n, x, inc, y, inc, r.dotu);
+    cxxblas::dot_reproducible(n, x, inc, y, inc, r.dot);
+    cxxblas::asum_reproducible(n, x, inc, r.asum);
+    cxxblas::nrm2_reproducible(n, x, inc, r.nrm2);
+    return r;
+}
+
+template <typename T>
+void
+checkIdentical(const char *variant, int n, const Results<T> &r,
+               const Results<T> &ref)
+{
+    if (! lapack::isIdentical(r.sum, ref.sum, "sum", "sum_")
+     || ! lapack::isIdentical(r.dotu, ref.dotu, "dotu", "dotu_")
+     || ! lapack::isIdentical(r.dot, ref.dot, "dot", "dot_")
+     || ! lapack::isIdentical(r.asum, ref.asum, "asum", "asum_")
+     || ! lapack::isIdentical(r.nrm2, ref.nrm2, "nrm2", "nrm2_"))
+    {
+        cerr << endl << "failed: " << variant << " [n = " << n << "]"
+             << endl;
+        ASSERT(0);
+    }
+}
+
+template <typename T>
+T
+randomEntry(mt19937 &engine)
+{
+    uniform_real_distribution<double>  mantissa(-1, 1);
+    uniform_int_distribution<int>      exponent(-30, 30);
+
+    return T(ldexp(mantissa(engine), exponent(engine)));
+}
+
+template <typename T>
+void
+randomEntry(mt19937 &engine, complex<T> &z)
+{
+    z = complex<T>(randomEntry<T>(engine), randomEntry<T>(engine));
+}
+
+template <typename T>
+void
+randomEntry(mt19937 &engine, T &x)
+{
+    x = randomEntry<T>(engine);
+}
+
+template <typename T>
+void
+run(int n)
+{
+    typedef typename cxxblas::ComplexTrait<T>::PrimitiveType  PT;
+
+    mt19937  engine(n);
+
+    vector<T> x(n+1), y(n+1);
+    for (int i=0; i<n; ++i) {
+        randomEntry(engine, x[i]);
+        randomEntry(engine, y[i]);
+    }
+
+    const Results<T> ref = reduce(n, x.data(), y.data(), 1);
+
+//
+//  Permuted and reversed data
+//
+    vector<int> p(n);
+    for (int i=0; i<n; ++i) {
+        p[i] = i;
+    }
+    shuffle(p.begin(), p.end(), engine);
+
+    vector<T> xp(n+1), yp(n+1);
+    for (int i=0; i<n; ++i) {
+        xp[i] = x[p[i]];
+        yp[i] = y[p[i]];
+    }
+    checkIdentical("permuted", n, reduce(n, xp.data(), yp.data(), 1), ref);
+    checkIdentical("reversed", n, reduce(n, x.data(), y.data(), -1), ref);
+
+//
+//  Different number of threads
+//
+#   ifdef _OPENMP
+    const int maxThreads = omp_get_max_threads();
+    for (int t=1; t<=4; ++t) {
+        omp_set_num_threads(t);
+        checkIdentical("threads", n, reduce(n, x.data(), y.data(), 1), ref);
+    }
+    omp_set_num_threads(maxThreads);
+#   endif
+
+//
+//  Accuracy.  Products get rounded to the working precision, sums are
+//  almost exact.
+//
+    RefSum sumRe, sumIm, dotuRe, dotuIm, dotRe, dotIm, asum, nrm2;
+    LD     absSum = 0, absDot = 0;
+
+    for (int i=0; i<n; ++i) {
+        const LD xr = real(x[i]), xi = imag(x[i]);
+        const LD yr = real(y[i]), yi = imag(y[i]);
+
+        sumRe  += xr;
+        sumIm  += xi;
+        dotuRe += xr*yr;
+        dotuRe += -xi*yi;
+        dotuIm += xr*yi;
+        dotuIm += xi*yr;
+        dotRe  += xr*yr;
+        dotRe  += xi*yi;
+        dotIm  += xr*yi;
+        dotIm  += -xi*yr;
+        asum   += fabsl(xr) + fabsl(xi);
+        nrm2   += xr*xr + xi*xi;
+        absSum += fabsl(xr) + fabsl(xi);
+        absDot += (fabsl(xr) + fabsl(xi))*(fabsl(yr) + fabsl(yi));
+    }
+
+    const LD eps    = numeric_limits<PT>::epsilon();
+    const LD epsLD  = numeric_limits<LD>::epsilon();
+    const LD sumTol = 4*epsLD*absSum;
+    const LD dotTol = eps*absDot;
+
+    const LD sumRe_ = sumRe.value(), sumIm_ = sumIm.value();
+    const LD dotuRe_ = dotuRe.value(), dotuIm_ = dotuIm.value();
+    const LD dotRe_ = dotRe.value(), dotIm_ = dotIm.value();
+    const LD asum_ = asum.value(), nrm2_ = sqrtl(nrm2.value());
+
+    if (! lapack::isClose(LD(real(ref.sum)), sumRe_,
+                          tolerance<PT>(sumRe_, sumTol), "sum.re", "sumRe_")
+     || ! lapack::isClose(LD(imag(ref.sum)), sumIm_,
+                          tolerance<PT>(sumIm_, sumTol), "sum.im", "sumIm_")
+     || ! lapack::isClose(LD(real(ref.dotu)), dotuRe_,
+                          tolerance<PT>(dotuRe_, dotTol), "dotu.re", "dotuRe_")
+     || ! lapack::isClose(LD(imag(ref.dotu)), dotuIm_,
+                          tolerance<PT>(dotuIm_, dotTol), "dotu.im", "dotuIm_")
+     || ! lapack::isClose(LD(real(ref.dot)), dotRe_,
+                          tolerance<PT>(dotRe_, dotTol), "dot.re", "dotRe_")
+     || ! lapack::isClose(LD(imag(ref.dot)), dotIm_,
+                          tolerance<PT>(dotIm_, dotTol), "dot.im", "dotIm_")
+     || ! lapack::isClose(LD(ref.asum), asum_,
+                          tolerance<PT>(asum_, sumTol), "asum", "asum_")
+     || ! lapack::isClose(LD(ref.nrm2), nrm2_,
+                          tolerance<PT>(nrm2_, 0), "nrm2", "nrm2_"))
+    {
+        cerr << endl << "failed: accuracy [n = " << n << "]" << endl;
+        ASSERT(0);
+    }
+}
+
+//
+//  The global switch routes the regular BLAS functions through the
+//  reproducible kernels
+//
+void
+runGlobal(int n)
+{
+    typedef DenseVector<Array<double> >            Vector;
+    typedef GeMatrix<FullStorage<double> >         Matrix;
+
+    Vector x(n), y(n);
+    Matrix A(n, 3);
+
+    fillRandom(x);
+    fillRandom(y);
+    fillRandom(A);
+
+    double dot, asum, nrm2, sum;
+    cxxblas::dot_reproducible(n, x.data(), 1, y.data(), 1, dot);
+    cxxblas::asum_reproducible(n, x.data(), 1, asum);
+    cxxblas::nrm2_reproducible(n, x.data(), 1, nrm2);
+    cxxblas::sum_reproducible(n, x.data(), 1, sum);
+
+    double lan;
+    {
+        cxxblas::ReproducibleScope  scope;
+
+        if (! lapack::isIdentical(blas::dot(x, y), dot, "dot(x, y)", "dot")
+         || ! lapack::isIdentical(blas::asum(x), asum, "asum(x)", "asum")
+         || ! lapack::isIdentical(blas::nrm2(x), nrm2, "nrm2(x)", "nrm2")
+         || ! lapack::isIdentical(blas::extensions::sum(x), sum,
+                                  "sum(x)", "sum"))
+        {
+            cerr << endl << "failed: global [n = " << n << "]" << endl;
+            ASSERT(0);
+        }
+
+        lan = lapack::lan(lapack::FrobeniusNorm, A);
+#       ifdef _OPENMP
+        const int maxThreads = omp_get_max_threads();
+        for (int t=1; t<=4; ++t) {
+            omp_set_num_threads(t);
+            if (! lapack::isIdentical(lapack::lan(lapack::FrobeniusNorm, A),
+                                      lan, "lan(A)", "lan"))
+            {
+                cerr << endl << "failed: lan [n = " << n << ", threads = "
+                     << t << "]" << endl;
+                ASSERT(0);
+            }
+        }
+        omp_set_num_threads(maxThreads);
+#       endif
+    }
+    ASSERT(!cxxblas::Reproducible::enabled());
+
+    const double nrm2A = blas::nrm2(A.vectorView());
+    if (! lapack::isClose(lan, nrm2A,
+                          3*n*numeric_limits<double>::epsilon()*lan,
+                          "lan", "nrm2A"))
+    {
+        cerr << endl << "failed: lan [n = " << n << "]" << endl;
+        ASSERT(0);
+    }
+}
+
+void
+runSpecial()
+{
+    const double inf = numeric_limits<double>::infinity();
+    const double nan = numeric_limits<double>::quiet_NaN();
+    const double big = numeric_limits<double>::max();
+    const double tiny = numeric_limits<double>::denorm_min();
+
+    double r;
+
+//
+//  Partial sums of a naive summation would overflow
+//
+    const double x1[] = { big, big, -big, -big, big };
+    cxxblas::sum_reproducible(5, x1, 1, r);
+    if (! lapack::isIdentical(r, big, "sum", "big")) {
+        cerr << endl << "failed: sum (overflow)" << endl;
+        ASSERT(0);
+    }
+    const double x2[] = { big/2, big/2, -big/2 };
+    cxxblas::nrm2_reproducible(3, x2, 1, r);
+    if (! lapack::isClose(LD(r), sqrtl(LD(3))*big/2,
+                          tolerance<double>(sqrtl(LD(3))*big/2, 0),
+                          "nrm2", "sqrt(3)*big/2"))
+    {
+        cerr << endl << "failed: nrm2 (overflow)" << endl;
+        ASSERT(0);
+    }
+
+//
+//  Subnormal entries
+//
+    const double x3[] = { tiny, 3*tiny, -tiny, 5*tiny };
+    cxxblas::sum_reproducible(4, x3, 1, r);
+    if (! lapack::isIdentical(r, 8*tiny, "sum", "8*tiny")) {
+        cerr << endl << "failed: sum (subnormal)" << endl;
+        ASSERT(0);
+    }
+
+//
+//  Inf, NaN and zeros
+//
+    const double x4[] = { 1, inf, 2 };
+    cxxblas::sum_reproducible(3, x4, 1, r);
+    if (! lapack::isIdentical(r, inf, "sum", "inf")) {
+        cerr << endl << "failed: sum (inf)" << endl;
+        ASSERT(0);
+    }
+    cxxblas::nrm2_reproducible(3, x4, 1, r);
+    if (! lapack::isIdentical(r, inf, "nrm2", "inf")) {
+        cerr << endl << "failed: nrm2 (inf)" << endl;
+        ASSERT(0);
+    }
+
+    const double x5[] = { 1, nan, inf };
+    cxxblas::sum_reproducible(3, x5, 1, r);
+    if (! lapack::isIdentical(r, nan, "sum", "nan")) {
+        cerr << endl << "failed: sum (nan)" << endl;
+        ASSERT(0);
+    }
+    cxxblas::nrm2_reproducible(3, x5, 1, r);
+    if (! lapack::isIdentical(r, nan, "nrm2", "nan")) {
+        cerr << endl << "failed: nrm2 (nan)" << endl;
+        ASSERT(0);
+    }
+
+    const double x6[] = { 0, 0, 0 };
+    cxxblas::asum_reproducible(3, x6, 1, r);
+    if (! lapack::isIdentical(r, 0., "asum", "0")) {
+        cerr << endl << "failed: asum (zero)" << endl;
+        ASSERT(0);
+    }
+    cxxblas::nrm2_reproducible(3, x6, 1, r);
+    if (! lapack::isIdentical(r, 0., "nrm2", "0")) {
+        cerr << endl << "failed: nrm2 (zero)" << endl;
+        ASSERT(0);
+    }
+}
+
+int
+main()
+{
+    const int sizes[] = { 0, 1, 2, 7, 33, 1000, 65536, 100003, 300000 };
+
+    for (int n : sizes) {
+        run<float>(n);
+        run<double>(n);
+        run<complex<double> >(n);
+    }
+    runGlobal(1000);
+    runGlobal(200000);
+    runSpecial();
+}
@@ -0,0 +1,355 @@
+#include <cxxstd/cmath.h>
+#include <cxxstd/complex.h>
+#include <cxxstd/iostream.h>
+
+#include <flens/flens.cxx>
+
+//
+//  Rectangular full packed (RFP) storage:  conversions from and to full and
+//  packed storage and the level 3 kernels pftrf, pftrs, pftri, tftri and
+//  sfrk/hfrk get checked against their counterparts for full storage.  All
+//  eight RFP layouts (odd/even dimension, Upper/Lower, ColMajor/RowMajor)
+//  are covered.
+//
+
+using namespace flens;
+using namespace std;
+
+template <typename T>
+void
+fillRandom(T &x)
+{
+    x = T(rand())/T(RAND_MAX)-T(0.5);
+}
+
+template <typename T>
+void
+fillRandom(complex<T> &z)
+{
+    T re, im;
+    fillRandom(re);
+    fillRandom(im);
+    z = complex<T>(re, im);
+}
+
+//
+//  Matrix types for the real (symmetric) and complex (hermitian) variant
+//
+template <typename T, StorageOrder Order>
+struct Types
+{
+    typedef SyMatrix<FullStorage<T> >           FullMatrix;
+    typedef SpMatrix<PackedStorage<T> >         PackedMatrix;
+    typedef SfMatrix<RfpStorage<T, Order> >     RfpMatrix;
+
+    static const Transpose                      trans = Trans;
+};
+
+template <typename T, StorageOrder Order>
+struct Types<complex<T>, Order>
+{
+    typedef HeMatrix<FullStorage<complex<T> > >         FullMatrix;
+    typedef HpMatrix<PackedStorage<complex<T> > >       PackedMatrix;
+    typedef HfMatrix<RfpStorage<complex<T>, Order> >    RfpMatrix;
+
+    static const Transpose                              trans = ConjTrans;
+};
+
+template <typename MA, typename MB, typename MC>
+void
+rk(Transpose trans, double alpha, const GeMatrix<MA> &A, double beta,
+   SfMatrix<MB> &C, SyMatrix<MC> &C_full)
+{
+    lapack::sfrk(trans, alpha, A, beta, C);
+    blas::rk(trans, alpha, A, beta, C_full);
+}
+
+template <typename MA, typename MB, typename MC>
+void
+rk(Transpose trans, double alpha, const GeMatrix<MA> &A, double beta,
+   HfMatrix<MB> &C, HeMatrix<MC> &C_full)
+{
+    lapack::hfrk(trans, alpha, A, beta, C);
+    blas::rk(trans, alpha, A, beta, C_full);
+}
+
+//
+//  Entry of a symmetric/hermitian matrix in full or packed storage
+//
+template <typename MA>
+typename MA::ElementType
+entry(const MA &A, int i, int j)
+{
+    const bool swap = (A.upLo()==Upper) ? (i>j) : (i<j);
+
+    return swap ? cxxblas::conjugate(A.engine()(j,i)) : A.engine()(i,j);
+}
+
+template <typename MA>
+typename MA::ElementType
+packedEntry(const MA &A, int i, int j)
+{
+    const StorageUpLo upLo = A.upLo();
+    const bool        swap = (upLo==Upper) ? (i>j) : (i<j);
+
+    return swap ? cxxblas::conjugate(A.engine()(upLo,j,i))
+                : A.engine()(upLo,i,j);
+}
+
+void
+failed(const char *what, const char *type, int n, StorageUpLo upLo,
+       StorageOrder order)
+{
+    cerr << endl << "failed: " << what << " (" << type << ") [n = " << n
+         << ", upLo = " << ((upLo==Upper) ? "Upper" : "Lower")
+         << ", order = " << ((order==ColMajor) ? "ColMajor" : "RowMajor")
+         << "]" << endl;
+    ASSERT(0);
+}
+
+template <typename T, StorageOrder Order>
+void
+run(const char *type, int n, StorageUpLo upLo)
+{
+    typedef Types<T, Order>                         Types;
+    typedef typename Types::FullMatrix              FullMatrix;
+    typedef typename Types::PackedMatrix            PackedMatrix;
+    typedef typename Types::RfpMatrix               RfpMatrix;
+    typedef GeMatrix<FullStorage<T> >               Matrix;
+    typedef TrMatrix<FullStorage<T> >               TrFullMatrix;
+    typedef TfMatrix<RfpStorage<T, Order> >         TrRfpMatrix;
+
+    const Underscore<int> _;
+    const int             nRhs = 3, k = 7;
+    const double          tol  = 1e-9;
+
+//
+//  Positive definite matrix A in full and RFP storage
+//
+    Matrix  A_ge(n, n);
+    for (int j=1; j<=n; ++j) {
+        for (int i=1; i<j; ++i) {
+            fillRandom(A_ge(i,j));
+            A_ge(j,i) = cxxblas::conjugate(A_ge(i,j));
+        }
+        fillRandom(A_ge(j,j));
+        A_ge(j,j) = cxxblas::real(A_ge(j,j)) + n;
+    }
+
+    FullMatrix  A(n, upLo);
+    for (int j=1; j<=n; ++j) {
+        for (int i=1; i<=n; ++i) {
+            if ((upLo==Upper) ? (i<=j) : (i>=j)) {
+                A.engine()(i,j) = A_ge(i,j);
+            }
+        }
+    }
+
+    RfpMatrix  A_rfp(n, upLo);
+    lapack::trttf(A, A_rfp);
+
+    Matrix  D(n, n), D_(n, n);
+    for (int j=1; j<=n; ++j) {
+        for (int i=1; i<=n; ++i) {
+            D(i,j) = A_rfp(i,j);
+        }
+    }
+    if (! lapack::isClose(D, A_ge, tol, "A_rfp", "A_ge")) {
+        failed("trttf", type, n, upLo, Order);
+    }
+
+//
+//  Round trips through full and packed storage
+//
+    FullMatrix  B(n, upLo);
+    lapack::tfttr(A_rfp, B);
+
+    for (int j=1; j<=n; ++j) {
+        for (int i=1; i<=n; ++i) {
+            D(i,j) = entry(B,i,j);
+        }
+    }
+    if (! lapack::isClose(D, A_ge, tol, "B", "A_ge")) {
+        failed("tfttr", type, n, upLo, Order);
+    }
+
+    PackedMatrix  A_packed(n, upLo);
+    lapack::tfttp(A_rfp, A_packed);
+
+    RfpMatrix  B_rfp(n, upLo);
+    lapack::tpttf(A_packed, B_rfp);
+
+    for (int j=1; j<=n; ++j) {
+        for (int i=1; i<=n; ++i) {
+            D(i,j)  = packedEntry(A_packed,i,j);
+            D_(i,j) = B_rfp(i,j);
+        }
+    }
+    if (! lapack::isClose(D, A_ge, tol, "A_packed", "A_ge")) {
+        failed("tfttp", type, n, upLo, Order);
+    }
+    if (! lapack::isClose(D_, A_ge, tol, "B_rfp", "A_ge")) {
+        failed("tpttf", type, n, upLo, Order);
+    }
+
+//
+//  Cholesky factorization:  pftrf versus potrf
+//
+    RfpMatrix   F_rfp = A_rfp;
+    FullMatrix  F     = A;
+
+    if (lapack::pftrf(F_rfp)!=0 || lapack::potrf(F)!=0) {
+        failed("pftrf/potrf (not positive definite)", type, n, upLo, Order);
+    }
+
+    const auto U_rfp = F_rfp.triangular();
+
+    D  = T(0);
+    D_ = T(0);
+    for (int j=1; j<=n; ++j) {
+        for (int i=1; i<=n; ++i) {
+            if ((upLo==Upper) ? (i<=j) : (i>=j)) {
+                D(i,j)  = U_rfp(i,j);
+                D_(i,j) = F.engine()(i,j);
+            }
+        }
+    }
+    if (! lapack::isClose(D, D_, tol, "U_rfp", "F")) {
+        failed("pftrf", type, n, upLo, Order);
+    }
+
+//
+//  Solve A*X = B with the RFP factor
+//
+    Matrix  X(n, nRhs), B_ge(n, nRhs);
+    for (int j=1; j<=nRhs; ++j) {
+        for (int i=1; i<=n; ++i) {
+            fillRandom(X(i,j));
+        }
+    }
+    B_ge = A_ge*X;
+    lapack::pftrs(F_rfp, B_ge);
+
+    DenseVector<Array<T> >  x = X(_,1);
+    DenseVector<Array<T> >  b = A_ge*x;
+    lapack::pftrs(F_rfp, b);
+
+    if (! lapack::isClose(B_ge, X, tol, "B_ge", "X")
+     || ! lapack::isClose(b, x, tol, "b", "x"))
+    {
+        failed("pftrs", type, n, upLo, Order);
+    }
+
+//
+//  Inverse:  pftri versus potri
+//
+    lapack::pftri(F_rfp);
+    lapack::potri(F);
+
+    for (int j=1; j<=n; ++j) {
+        for (int i=1; i<=n; ++i) {
+            D(i,j)  = F_rfp(i,j);
+            D_(i,j) = entry(F,i,j);
+        }
+    }
+    if (! lapack::isClose(D, D_, tol, "F_rfp", "F")) {
+        failed("pftri", type, n, upLo, Order);
+    }
+
+//
+//  Inverse of a triangular matrix:  tftri versus tri
+//
+    for (int d=0; d<=1; ++d) {
+        const Diag diag = (d==0) ? NonUnit : Unit;
+
+//
+//      Off-diagonal entries get scaled such that the inverse stays bounded
+//
+        TrFullMatrix  T_full(n, upLo, diag);
+        for (int j=1; j<=n; ++j) {
+            for (int i=1; i<=n; ++i) {
+                if ((upLo==Upper) ? (i<j) : (i>j)) {
+                    fillRandom(T_full.engine()(i,j));
+                    T_full.engine()(i,j) /= T(n);
+                }
+            }
+            fillRandom(T_full.engine()(j,j));
+            T_full.engine()(j,j) += T(2);
+        }
+
+        TrRfpMatrix  T_rfp(n, upLo, diag);
+        lapack::trttf(T_full, T_rfp);
+
+        if (lapack::tftri(T_rfp)!=0 || lapack::tri(T_full)!=0) {
+            failed("tftri/tri (singular)", type, n, upLo, Order);
+        }
+
+        D  = T(0);
+        D_ = T(0);
+        for (int j=1; j<=n; ++j) {
+            for (int i=1; i<=n; ++i) {
+                if ((upLo==Upper) ? (i<j) : (i>j)
+                 || (diag==NonUnit && i==j))
+                {
+                    D(i,j)  = T_rfp(i,j);
+                    D_(i,j) = T_full.engine()(i,j);
+                }
+            }
+        }
+        if (! lapack::isClose(D, D_, tol, "T_rfp", "T_full")) {
+            failed((diag==NonUnit) ? "tftri" : "tftri (unit)",
+                   type, n, upLo, Order);
+        }
+    }
+
+//
+//  Rank k update:  sfrk/hfrk versus syrk/herk
+//
+    for (int t=0; t<=1; ++t) {
+        const Transpose trans = (t==0) ? NoTrans : Types::trans;
+
+        Matrix  V = (trans==NoTrans) ? Matrix(n, k) : Matrix(k, n);
+        for (int j=1; j<=V.numCols(); ++j) {
+            for (int i=1; i<=V.numRows(); ++i) {
+                fillRandom(V(i,j));
+            }
+        }
+
+        RfpMatrix   C_rfp = A_rfp;
+        FullMatrix  C     = A;
+
+        rk(trans, -0.5, V, 2.0, C_rfp, C);
+
+        for (int j=1; j<=n; ++j) {
+            for (int i=1; i<=n; ++i) {
+                D(i,j)  = C_rfp(i,j);
+                D_(i,j) = entry(C,i,j);
+            }
+        }
+        if (! lapack::isClose(D, D_, tol, "C_rfp", "C")) {
+            failed((trans==NoTrans) ? "rk (NoTrans)" : "rk (Trans)",
+                   type, n, upLo, Order);
+        }
+    }
+}
+
+template <typename T>
+void
+run(const char *type, int n)
+{
+    run<T, ColMajor>(type, n, Upper);
+    run<T, ColMajor>(type, n, Lower);
+    run<T, RowMajor>(type, n, Upper);
+    run<T, RowMajor>(type, n, Lower);
+}
+
+int
+main()
+{
+    const int sizes[] = { 1, 2, 3, 4, 5, 10, 11, 64, 65, 200, 201 };
+
+    for (int n : sizes) {
+        run<double>("double", n);
+        run<complex<double> >("complex<double>", n);
+    }
+}
@@ -0,0 +1,348 @@
+#include <cxxstd/complex.h>
+#include <cxxstd/iostream.h>
+#include <flens/flens.cxx>
+
+#ifndef SEED
+#define SEED  0
+#endif
+
+#ifndef MAX_M
+#define MAX_M  400
+#endif
+
+#ifndef MAX_N
+#define MAX_N  400
+#endif
+
+#ifndef MAX_NNZ
+#define MAX_NNZ  3*MAX_M
+#endif
+
+#ifndef MAX_RHS
+#define MAX_RHS  9
+#endif
+
+//
+//  Products of sparse matrices in CRS and CCS format with dense blocks of
+//  column vectors get compared against products with control matrices in
+//  full storage.  All values are integers and alpha, beta are powers of two
+//  so results have to be identical.
+//
+
+using namespace flens;
+using namespace std;
+
+typedef complex<double>  zdouble;
+
+template <typename T>
+T
+integerValue()
+{
+    return T(rand() % 10);
+}
+
+template <>
+zdouble
+integerValue<zdouble>()
+{
+    return zdouble(rand() % 10, rand() % 10);
+}
+
+template <typename T>
+T
+randomScalar()
+{
+    return std::pow(2, 5 - std::max(1, rand() % 10));
+}
+
+//
+//  Create general sparse matrix A and control matrix A_
+//
+template <typename Coord, typename MA, typename T>
+void
+setup(int m, int n, int max_nnz, int indexBase, MA &A,
+      GeMatrix<FullStorage<T> > &A_)
+{
+    A_.resize(m, n, indexBase, indexBase);
+    A_ = T(0);
+
+    GeCoordMatrix<Coord>  B(m, n, 1, indexBase);
+
+    for (int k=1; k<=max_nnz; ++k) {
+        const int i = indexBase + rand() % m;
+        const int j = indexBase + rand() % n;
+        const T   v = integerValue<T>();
+
+        B(i,j)  += v;
+        A_(i,j) += v;
+    }
+    A = B;
+
+    typename GeMatrix<FullStorage<T> >::NoView  A__ = A;
+    if (! lapack::isIdentical(A_, A__, "A_", "A__")) {
+        cerr << "m =       " << m << endl;
+        cerr << "n =       " << n << endl;
+        cerr << "max_nnz = " << max_nnz << endl;
+        ASSERT(0);
+    }
+}
+
+//
+//  Create symmetric (hermitian) sparse matrix A in the triangle upLo and
+//  the full control matrix A_.  Diagonal entries of hermitian matrices are
+//  real.
+//
+template <typename CoordMatrix, typename MA, typename T>
+void
+setup(StorageUpLo upLo, int n, int max_nnz, int indexBase, bool hermitian,
+      MA &A, GeMatrix<FullStorage<T> > &A_)
+{
+    A_.resize(n, n, indexBase, indexBase);
+    A_ = T(0);
+
+    CoordMatrix  B(n, upLo, 1, indexBase);
+
+    for (int k=1; k<=max_nnz; ++k) {
+        int i = indexBase + rand() % n;
+        int j = indexBase + rand() % n;
+        T   v = integerValue<T>();
+
+        if ((upLo==Upper) ? (i>j) : (i<j)) {
+            std::swap(i, j);
+        }
+        if (i==j && hermitian) {
+            v = cxxblas::real(v);
+        }
+        B(i,j)  += v;
+        A_(i,j) += v;
+        if (i!=j) {
+            A_(j,i) += hermitian ? cxxblas::conjugate(v) : v;
+        }
+    }
+    A = B;
+}
+
+//
+//  C = op(A)*B for general sparse matrices
+//
+template <typename MA, typename T>
+void
+mm(Transpose trans, int nRhs, const MA &A, const GeMatrix<FullStorage<T> > &A_)
+{
+    typedef GeMatrix<FullStorage<T> >  Matrix;
+
+    const Underscore<int> _;
+
+    const bool noTrans = (trans==NoTrans || trans==Conj);
+    const int  m       = noTrans ? A_.numRows() : A_.numCols();
+    const int  k       = noTrans ? A_.numCols() : A_.numRows();
+
+//
+//  B is a view with leading dimension larger than its number of rows
+//
+    Matrix  BB(k+2, nRhs), C, C_;
+    for (int j=1; j<=nRhs; ++j) {
+        for (int i=1; i<=k+2; ++i) {
+            BB(i,j) = integerValue<T>();
+        }
+    }
+    const auto B = BB(_(2,k+1),_);
+
+    if (trans==NoTrans) {
+        C  = A*B;
+        C_ = A_*B;
+        if (! lapack::isIdentical(C, C_, "C", "C_")) {
+            cerr << endl << "failed: C = A*B" << endl;
+            ASSERT(0);
+        }
+
+        C  += A*B;
+        C_ += A_*B;
+        if (! lapack::isIdentical(C, C_, "C", "C_")) {
+            cerr << endl << "failed: C += A*B" << endl;
+            ASSERT(0);
+        }
+
+        C  -= A*B;
+        C_ -= A_*B;
+        if (! lapack::isIdentical(C, C_, "C", "C_")) {
+            cerr << endl << "failed: C -= A*B" << endl;
+            ASSERT(0);
+        }
+    } else if (trans==Trans) {
+        C  = transpose(A)*B;
+        C_ = transpose(A_)*B;
+        if (! lapack::isIdentical(C, C_, "C", "C_")) {
+            cerr << endl << "failed: C = A^T*B" << endl;
+            ASSERT(0);
+        }
+    }
+
+    C.resize(m, nRhs);
+    for (int test=1; test<=10; ++test) {
+        const T alpha = randomScalar<T>();
+        const T beta  = (test==1) ? T(0) : randomScalar<T>();
+
+        for (int j=1; j<=nRhs; ++j) {
+            for (int i=1; i<=m; ++i) {
+                C(i,j) = rand() % 1000;
+            }
+        }
+        C_ = C;
+
+        blas::mm(trans, NoTrans, alpha, A, B, beta, C);
+        blas::mm(trans, NoTrans, alpha, A_, B, beta, C_);
+
+        if (! lapack::isIdentical(C, C_, "C", "C_")) {
+            cerr << endl << "failed: C = beta*C + alpha*op(A)*B"
+                 << " [trans = " << trans << "]" << endl;
+            cerr << "alpha = " << alpha << endl;
+            cerr << "beta  = " << beta << endl;
+            ASSERT(0);
+        }
+    }
+}
+
+//
+//  C = A*B for symmetric and hermitian sparse matrices
+//
+template <typename MA, typename T>
+void
+mm(int nRhs, const MA &A, const GeMatrix<FullStorage<T> > &A_)
+{
+    typedef GeMatrix<FullStorage<T> >  Matrix;
+
+    const Underscore<int> _;
+
+    const int n = A_.numRows();
+
+    Matrix  BB(n+2, nRhs), C, C_;
+    for (int j=1; j<=nRhs; ++j) {
+        for (int i=1; i<=n+2; ++i) {
+            BB(i,j) = integerValue<T>();
+        }
+    }
+    const auto B = BB(_(2,n+1),_);
+
+    C  = A*B;
+    C_ = A_*B;
+    if (! lapack::isIdentical(C, C_, "C", "C_")) {
+        cerr << endl << "failed: C = A*B" << endl;
+        ASSERT(0);
+    }
+
+    C  += A*B;
+    C_ += A_*B;
+    if (! lapack::isIdentical(C, C_, "C", "C_")) {
+        cerr << endl << "failed: C += A*B" << endl;
+        ASSERT(0);
+    }
+
+    for (int test=1; test<=10; ++test) {
+        const T alpha = randomScalar<T>();
+        const T beta  = (test==1) ? T(0) : randomScalar<T>();
+
+        for (int j=1; j<=nRhs; ++j) {
+            for (int i=1; i<=n; ++i) {
+                C(i,j) = rand() % 1000;
+            }
+        }
+        C_ = C;
+
+        blas::mm(Left, alpha, A, B, beta, C);
+        blas::mm(NoTrans, NoTrans, alpha, A_, B, beta, C_);
+
+        if (! lapack::isIdentical(C, C_, "C", "C_")) {
+            cerr << endl << "failed: C = beta*C + alpha*A*B" << endl;
+            cerr << "alpha = " << alpha << endl;
+            cerr << "beta  = " << beta << endl;
+            ASSERT(0);
+        }
+    }
+}
+
+template <typename T>
+void
+run(int m, int n, int max_nnz, int nRhs, int indexBase)
+{
+    typedef CoordStorage<T, CoordRowColCmp>  CoordRC;
+    typedef CoordStorage<T, CoordColRowCmp>  CoordCR;
+
+    const bool      isComplex = IsComplex<T>::value;
+    const Transpose trans[]   = { NoTrans, Trans, ConjTrans };
+
+    GeMatrix<FullStorage<T> >  A_;
+
+    for (Transpose t : trans) {
+        if (t==ConjTrans && !isComplex) {
+            continue;
+        }
+        {
+            GeCRSMatrix<CRS<T> >  A;
+            setup<CoordRC>(m, n, max_nnz, indexBase, A, A_);
+            mm(t, nRhs, A, A_);
+        }
+        {
+            GeCCSMatrix<CCS<T> >  A;
+            setup<CoordCR>(m, n, max_nnz, indexBase, A, A_);
+            mm(t, nRhs, A, A_);
+        }
+    }
+
+    for (StorageUpLo upLo : { Upper, Lower }) {
+        if (isComplex) {
+            {
+                HeCRSMatrix<CRS<T> >  A;
+                setup<HeCoordMatrix<CoordRC> >(upLo, m, max_nnz, indexBase,
+                                               true, A, A_);
+                mm(nRhs, A, A_);
+            }
+            {
+                HeCCSMatrix<CCS<T> >  A;
+                setup<HeCoordMatrix<CoordCR> >(upLo, m, max_nnz, indexBase,
+                                               true, A, A_);
+                mm(nRhs, A, A_);
+            }
+        } else {
+            {
+                SyCRSMatrix<CRS<T> >  A;
+                setup<SyCoordMatrix<CoordRC> >(upLo, m, max_nnz, indexBase,
+                                               false, A, A_);
+                mm(nRhs, A, A_);
+            }
+            {
+                SyCCSMatrix<CCS<T> >  A;
+                setup<SyCoordMatrix<CoordCR> >(upLo, m, max_nnz, indexBase,
+                                               false, A, A_);
+                mm(nRhs, A, A_);
+            }
+        }
+    }
+}
+
+int
+main()
+{
+    srand(SEED);
+
+    for (int run=1; run<=10; ++run) {
+        const int m       = std::max(1, rand() % (MAX_M));
+        const int n       = std::max(1, rand() % (MAX_N));
+        const int nRhs    = 1 + rand() % (MAX_RHS);
+        // check case 'nnz==0' at least once
+        const int max_nnz = (run==1) ? 0 : (rand() % (MAX_NNZ));
+
+        cerr << "run " << run << ":" << endl;
+
+        for (int indexBase=-3; indexBase<=3; ++indexBase) {
+            cerr << "indexBase = " << indexBase << endl;
+            cerr << "m =         " << m << endl;
+            cerr << "n =         " << n << endl;
+            cerr << "nRhs =      " << nRhs << endl;
+            cerr << "max_nnz =   " << max_nnz << endl << endl;
+
+            ::run<double>(m, n, max_nnz, nRhs, indexBase);
+            ::run<zdouble>(m, n, max_nnz, nRhs, indexBase);
+        }
+    }
+}
@@ -0,0 +1,364 @@
+#include <cxxstd/cstdlib.h>
+#include <cxxstd/iostream.h>
+#include <cxxstd/vector.h>
+
+#define USE_PLAYGROUND
+#include <flens/flens.cxx>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#ifndef SEED
+#define SEED  0
+#endif
+
+#ifndef GRID
+#define GRID  30
+#endif
+
+#ifndef MAX_N
+#define MAX_N  400
+#endif
+
+//
+//  Compile with -fopenmp for the threaded variant.  The supernodal factors
+//  of P*A*P^T get compared against dense factorizations:  potrf for
+//  Cholesky and sytrf (if USE_CXXLAPACK is defined, otherwise getrf) for
+//  LDL^T.  All matrices are diagonally dominant such that the dense LDL^T
+//  and LU factorizations do not pivot.
+//
+
+using namespace flens;
+using namespace std;
+
+typedef double                                  T;
+typedef GeMatrix<FullStorage<T> >               DGeMatrix;
+typedef DenseVector<Array<T> >                  DDenseVector;
+typedef SyCRSMatrix<CRS<T> >::IndexType          Index;
+typedef DenseVector<Array<Index> >              IndexVector;
+
+const T tol = 1e-10;
+
+//
+//  2D Poisson matrix on a k x k grid.  With a stride the diagonal entries of
+//  every stride-th grid point get negated and the others shifted by one
+//  such that A stays diagonally dominant.
+//
+void
+poisson(int k, DGeMatrix &A_, int stride = 0)
+{
+    const int n = k*k;
+
+    A_.resize(n, n);
+    A_ = T(0);
+    for (int i=1; i<=k; ++i) {
+        for (int j=1; j<=k; ++j) {
+            const int p = (i-1)*k + j;
+            A_(p,p) = (stride==0) ? 4 : ((p%stride==0) ? -5 : 5);
+            if (j<k) {
+                A_(p,p+1) = A_(p+1,p) = -1;
+            }
+            if (i<k) {
+                A_(p,p+k) = A_(p+k,p) = -1;
+            }
+        }
+    }
+}
+
+//
+//  Random symmetric matrix with integer entries that is strictly diagonally
+//  dominant.  If definite is false the diagonal gets random signs.
+//
+void
+randomMatrix(int n, int max_nnz, bool definite, DGeMatrix &A_)
+{
+    A_.resize(n, n);
+    A_ = T(0);
+    for (int k=1; k<=max_nnz; ++k) {
+        const int i = 1 + rand() % n;
+        const int j = 1 + rand() % n;
+        if (i!=j) {
+            A_(i,j) = A_(j,i) = rand() % 19 - 9;
+        }
+    }
+    for (int i=1; i<=n; ++i) {
+        T sum = 1;
+        for (int j=1; j<=n; ++j) {
+            if (i!=j) {
+                sum += abs(A_(i,j));
+            }
+        }
+        A_(i,i) = (definite || rand() % 2) ? sum : -sum;
+    }
+}
+
+//
+//  Sparse symmetric matrix A with the nonzeros of A_ in the triangle upLo
+//
+template <typename MA, typename Cmp>
+void
+setup(const DGeMatrix &A_, StorageUpLo upLo, int indexBase, MA &A, Cmp)
+{
+    typedef CoordStorage<T, Cmp>  Coord;
+
+    const int n = A_.numRows();
+
+    SyCoordMatrix<Coord>  B(n, upLo, 1, indexBase);
+    for (int j=1; j<=n; ++j) {
+        for (int i=1; i<=n; ++i) {
+            if (A_(i,j)!=T(0) && ((upLo==Upper) ? (i<=j) : (i>=j))) {
+                B(indexBase+i-1, indexBase+j-1) += A_(i,j);
+            }
+        }
+    }
+    A = B;
+}
+
+//
+//  Dense lower triangular matrix with the panels of the supernodal factor
+//
+DGeMatrix
+factor(const supernodal::Symbolic<Index>       &S,
+       const supernodal::Numeric<T, Index>     &N)
+{
+    DGeMatrix L(S.n, S.n);
+
+    for (Index s=0; s<S.numSupernodes(); ++s) {
+        const Index first = S.superPtr[s];
+        const Index nc    = S.superPtr[s+1]-first;
+        const Index m     = S.rowPtr[s+1]-S.rowPtr[s];
+
+        for (Index jj=0; jj<nc; ++jj) {
+            for (Index ii=jj; ii<m; ++ii) {
+                L(S.rows[S.rowPtr[s]+ii]+1, first+jj+1) = N.L[s](ii+1,jj+1);
+            }
+        }
+    }
+    return L;
+}
+
+//
+//  Dense factorizations of P*A*P^T.  LD_ gets the unit lower factor below
+//  and D on the diagonal.
+//
+Index
+potrf(const DGeMatrix &PA, DGeMatrix &L_)
+{
+    const int n = PA.numRows();
+
+    L_ = PA;
+    const Index info = lapack::potrf(L_.lower().symmetric());
+    for (int j=1; j<=n; ++j) {
+        for (int i=1; i<j; ++i) {
+            L_(i,j) = 0;
+        }
+    }
+    return info;
+}
+
+void
+ldlt(const DGeMatrix &PA, DGeMatrix &LD_)
+{
+    const int n = PA.numRows();
+
+    IndexVector  piv(n);
+
+    LD_ = PA;
+#   ifdef USE_CXXLAPACK
+    const Index info = lapack::trf(LD_.lower().symmetric(), piv);
+#   else
+//
+//  LU without pivoting gives P*A*P^T = L*U with U = D*L^T
+//
+    const Index info = lapack::trf(LD_, piv);
+#   endif
+    ASSERT(info==0);
+
+    for (int j=1; j<=n; ++j) {
+        if (piv(j)!=j) {
+            cerr << endl << "failed: dense LDL^T pivots" << endl;
+            ASSERT(0);
+        }
+        for (int i=1; i<j; ++i) {
+            LD_(i,j) = 0;
+        }
+    }
+}
+
+template <typename MA>
+void
+run(const char *name, const DGeMatrix &A_, bool definite, const MA &A,
+    supernodal::Ordering ordering)
+{
+    const Underscore<Index> _;
+    const int                   n    = A_.numRows();
+    const int                   nRhs = 3;
+
+    supernodal::Symbolic<Index>  S;
+    supernodal::analyze(A, S, ordering);
+
+    if (S.n!=n || int(S.perm.size())!=n) {
+        cerr << endl << "failed: analyze (" << name << ")" << endl;
+        ASSERT(0);
+    }
+
+//
+//  Dense P*A*P^T and its factors
+//
+    DGeMatrix PA(n, n);
+    for (int j=1; j<=n; ++j) {
+        for (int i=1; i<=n; ++i) {
+            PA(i,j) = A_(S.perm[i-1]+1, S.perm[j-1]+1);
+        }
+    }
+
+    DGeMatrix     L_, LD_;
+    Index  info_ = potrf(PA, L_);
+    ldlt(PA, LD_);
+
+    ASSERT(!definite || info_==0);
+
+//
+//  Random right-hand sides
+//
+    DGeMatrix B(n, nRhs), X;
+    for (int j=1; j<=nRhs; ++j) {
+        for (int i=1; i<=n; ++i) {
+            B(i,j) = rand() % 10;
+        }
+    }
+    DDenseVector  b = B(_,1), x;
+
+//
+//  The parallel subtree path gets taken for more than one thread.  Factors
+//  must not depend on the number of threads.
+//
+    DGeMatrix L1, LD1;
+
+    int maxThreads = 1;
+#   ifdef _OPENMP
+    maxThreads = 4;
+#   endif
+
+    for (int numThreads=1; numThreads<=maxThreads; ++numThreads) {
+#       ifdef _OPENMP
+        omp_set_num_threads(numThreads);
+#       endif
+
+        supernodal::Numeric<T, Index>  N(supernodal::Cholesky);
+        supernodal::Numeric<T, Index>  ND(supernodal::LDLT);
+
+        Index info = supernodal::factorize(A, S, N);
+        if (! lapack::isIdentical(info, info_, "info", "info_")) {
+            cerr << endl << "failed: Cholesky info (" << name
+                 << ", numThreads = " << numThreads << ")" << endl;
+            ASSERT(0);
+        }
+        if (definite) {
+            const DGeMatrix L = factor(S, N);
+
+            if (! lapack::isClose(L, L_, tol, "L", "L_")) {
+                cerr << endl << "failed: Cholesky (" << name
+                     << ", numThreads = " << numThreads << ")" << endl;
+                ASSERT(0);
+            }
+            if (numThreads==1) {
+                L1 = L;
+            } else if (! lapack::isIdentical(L, L1, "L", "L1")) {
+                cerr << endl << "failed: Cholesky (" << name
+                     << ", numThreads = " << numThreads << ")" << endl;
+                ASSERT(0);
+            }
+
+            X = B;
+            supernodal::solve(S, N, X);
+            if (! lapack::isClose(DGeMatrix(A_*X), B, tol, "A_*X", "B")) {
+                cerr << endl << "failed: Cholesky solve (" << name
+                     << ", numThreads = " << numThreads << ")" << endl;
+                ASSERT(0);
+            }
+        }
+
+        info = supernodal::factorize(A, S, ND);
+        ASSERT(info==0);
+
+        const DGeMatrix LD = factor(S, ND);
+
+        if (! lapack::isClose(LD, LD_, tol, "LD", "LD_")) {
+            cerr << endl << "failed: LDL^T (" << name
+                 << ", numThreads = " << numThreads << ")" << endl;
+            ASSERT(0);
+        }
+        if (numThreads==1) {
+            LD1 = LD;
+        } else if (! lapack::isIdentical(LD, LD1, "LD", "LD1")) {
+            cerr << endl << "failed: LDL^T (" << name
+                 << ", numThreads = " << numThreads << ")" << endl;
+            ASSERT(0);
+        }
+
+        X = B;
+        supernodal::solve(S, ND, X);
+        if (! lapack::isClose(DGeMatrix(A_*X), B, tol, "A_*X", "B")) {
+            cerr << endl << "failed: LDL^T solve (" << name
+                 << ", numThreads = " << numThreads << ")" << endl;
+            ASSERT(0);
+        }
+
+        x = b;
+        supernodal::solve(S, ND, x);
+        if (! lapack::isClose(DDenseVector(A_*x), b, tol,
+                              "A_*x", "b"))
+        {
+            cerr << endl << "failed: LDL^T solve (vector, " << name
+                 << ", numThreads = " << numThreads << ")" << endl;
+            ASSERT(0);
+        }
+    }
+}
+
+void
+run(const char *name, const DGeMatrix &A_, bool definite)
+{
+    const supernodal::Ordering  orderings[] = { supernodal::Natural,
+                                                supernodal::MinimumDegree,
+                                                supernodal::NestedDissection };
+
+    for (supernodal::Ordering ordering : orderings) {
+        cerr << name << ", ordering = " << ordering << endl;
+
+        SyCRSMatrix<CRS<T> >  A;
+        setup(A_, Upper, 1, A, CoordRowColCmp());
+        run(name, A_, definite, A, ordering);
+
+        SyCCSMatrix<CCS<T> >  A2;
+        setup(A_, Lower, 0, A2, CoordColRowCmp());
+        run(name, A_, definite, A2, ordering);
+    }
+}
+
+int
+main()
+{
+    srand(SEED);
+
+    DGeMatrix A_;
+
+    poisson(GRID, A_);
+    run("poisson", A_, true);
+
+    poisson(GRID, A_, 97);
+    run("poisson indefinite", A_, false);
+
+    for (int test=1; test<=3; ++test) {
+        const int n       = std::max(1, rand() % MAX_N);
+        const int max_nnz = rand() % (3*n);
+
+        randomMatrix(n, max_nnz, true, A_);
+        run("random", A_, true);
+
+        randomMatrix(n, max_nnz, false, A_);
+        run("random indefinite", A_, false);
+    }
+}
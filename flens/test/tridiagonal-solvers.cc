@@ -0,0 +1,341 @@
+#include <cxxstd/cmath.h>
+#include <cxxstd/complex.h>
+#include <cxxstd/iostream.h>
+
+#define USE_PLAYGROUND
+#include <flens/flens.cxx>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+//
+//  Compile with -fopenmp for the threaded variant.  gtsv, ptsv, the Thomas
+//  algorithm (single, multiple and batched systems), cyclic reduction and
+//  parallel cyclic reduction get checked against a known solution.
+//
+
+using namespace flens;
+using namespace std;
+
+template <typename T>
+void
+fillRandom(T &x)
+{
+    x = T(rand())/T(RAND_MAX)-T(0.5);
+}
+
+template <typename T>
+void
+fillRandom(complex<T> &z)
+{
+    T re, im;
+    fillRandom(re);
+    fillRandom(im);
+    z = complex<T>(re, im);
+}
+
+template <typename V>
+void
+fill(DenseVector<V> &x)
+{
+    for (int i=1; i<=x.length(); ++i) {
+        fillRandom(x(i));
+    }
+}
+
+template <typename M>
+void
+fill(GeMatrix<M> &A)
+{
+    for (int i=1; i<=A.numRows(); ++i) {
+        for (int j=1; j<=A.numCols(); ++j) {
+            fillRandom(A(i,j));
+        }
+    }
+}
+
+//
+//  B = A*X for the tridiagonal matrix A = (dl, d, du)
+//
+template <typename VDL, typename VD, typename VDU, typename MX, typename MB>
+void
+apply(const DenseVector<VDL> &dl, const DenseVector<VD> &d,
+      const DenseVector<VDU> &du, const GeMatrix<MX> &X, GeMatrix<MB> &B)
+{
+    const int n = d.length();
+
+    for (int j=1; j<=X.numCols(); ++j) {
+        for (int i=1; i<=n; ++i) {
+            B(i,j) = d(i)*X(i,j);
+            if (i>1) {
+                B(i,j) += dl(i-1)*X(i-1,j);
+            }
+            if (i<n) {
+                B(i,j) += du(i)*X(i+1,j);
+            }
+        }
+    }
+}
+
+//
+//  Random diagonally dominant tridiagonal matrix
+//
+template <typename VDL, typename VD, typename VDU>
+void
+fill(DenseVector<VDL> &dl, DenseVector<VD> &d, DenseVector<VDU> &du)
+{
+    typedef typename DenseVector<VD>::ElementType  T;
+
+    fill(dl);
+    fill(d);
+    fill(du);
+    for (int i=1; i<=d.length(); ++i) {
+        d(i) += T(3);
+    }
+}
+
+template <typename T>
+void
+run(int n)
+{
+    typedef DenseVector<Array<T> >                   Vector;
+    typedef GeMatrix<FullStorage<T, ColMajor> >      Matrix;
+    typedef GeMatrix<FullStorage<T, RowMajor> >      RowMatrix;
+    typedef GbMatrix<BandStorage<T> >                BandMatrix;
+
+    const Underscore<int> _;
+    const int             nRhs = 3;
+
+    Vector dl(n-1), d(n), du(n-1), work(n);
+    Matrix X(n, nRhs), B(n, nRhs);
+
+    fill(dl, d, du);
+    fill(X);
+    apply(dl, d, du, X, B);
+
+    BandMatrix A(n, n, 1, 1);
+    A.diag(0) = d;
+    if (n>1) {
+        A.diag(-1) = dl;
+        A.diag(1)  = du;
+    }
+
+//
+//  gtsv
+//
+    {
+        Vector dl_ = dl, d_ = d, du_ = du;
+        Matrix B_  = B;
+        lapack::gtsv(dl_, d_, du_, B_);
+        if (! lapack::isClose(B_, X, 1e-10, "B_", "X")) {
+            cerr << endl << "failed: gtsv [n = " << n << "]" << endl;
+            ASSERT(0);
+        }
+
+        BandMatrix A_ = A;
+        Vector     b_ = B(_,1);
+        lapack::gtsv(A_, b_);
+        if (! lapack::isClose(b_, X(_,1), 1e-10, "b_", "X(_,1)")) {
+            cerr << endl << "failed: gtsv (GbMatrix) [n = " << n << "]" << endl;
+            ASSERT(0);
+        }
+    }
+//
+//  Thomas algorithm
+//
+    {
+        Vector    b_ = B(_,1);
+        Matrix    B_ = B;
+        RowMatrix R_ = B;
+
+        lapack::extensions::thomas_sv(dl, d, du, b_, work);
+        if (! lapack::isClose(b_, X(_,1), 1e-10, "b_", "X(_,1)")) {
+            cerr << endl << "failed: thomas_sv [n = " << n << "]" << endl;
+            ASSERT(0);
+        }
+        lapack::extensions::thomas_sv(dl, d, du, B_, work);
+        if (! lapack::isClose(B_, X, 1e-10, "B_", "X")) {
+            cerr << endl << "failed: thomas_sv (ColMajor) [n = "
+                 << n << "]" << endl;
+            ASSERT(0);
+        }
+        lapack::extensions::thomas_sv(dl, d, du, R_, work);
+        if (! lapack::isClose(R_, X, 1e-10, "R_", "X")) {
+            cerr << endl << "failed: thomas_sv (RowMajor) [n = "
+                 << n << "]" << endl;
+            ASSERT(0);
+        }
+
+        b_ = B(_,1);
+        lapack::extensions::thomas_sv(A, b_, work);
+        if (! lapack::isClose(b_, X(_,1), 1e-10, "b_", "X(_,1)")) {
+            cerr << endl << "failed: thomas_sv (GbMatrix) [n = "
+                 << n << "]" << endl;
+            ASSERT(0);
+        }
+    }
+//
+//  Cyclic reduction and parallel cyclic reduction
+//
+    {
+        Vector dl_ = dl, d_ = d, du_ = du, b_ = B(_,1);
+        lapack::extensions::cr_sv(dl_, d_, du_, b_);
+        if (! lapack::isClose(b_, X(_,1), 1e-10, "b_", "X(_,1)")) {
+            cerr << endl << "failed: cr_sv [n = " << n << "]" << endl;
+            ASSERT(0);
+        }
+
+        BandMatrix A_ = A;
+        b_ = B(_,1);
+        lapack::extensions::cr_sv(A_, b_);
+        if (! lapack::isClose(b_, X(_,1), 1e-10, "b_", "X(_,1)")) {
+            cerr << endl << "failed: cr_sv (GbMatrix) [n = "
+                 << n << "]" << endl;
+            ASSERT(0);
+        }
+
+        b_ = B(_,1);
+        lapack::extensions::pcr_sv(dl, d, du, b_);
+        if (! lapack::isClose(b_, X(_,1), 1e-10, "b_", "X(_,1)")) {
+            cerr << endl << "failed: pcr_sv [n = " << n << "]" << endl;
+            ASSERT(0);
+        }
+
+        b_ = B(_,1);
+        lapack::extensions::pcr_sv(A, b_);
+        if (! lapack::isClose(b_, X(_,1), 1e-10, "b_", "X(_,1)")) {
+            cerr << endl << "failed: pcr_sv (GbMatrix) [n = "
+                 << n << "]" << endl;
+            ASSERT(0);
+        }
+    }
+}
+
+//
+//  Positive definite matrices for ptsv
+//
+template <typename T>
+void
+runPt(int n)
+{
+    typedef typename ComplexTrait<T>::PrimitiveType  PT;
+    typedef DenseVector<Array<PT> >                  RealVector;
+    typedef DenseVector<Array<T> >                   Vector;
+    typedef GeMatrix<FullStorage<T, ColMajor> >      Matrix;
+
+    RealVector d(n);
+    Vector     e(n-1), eH(n-1);
+    Matrix     X(n, 2), B(n, 2);
+
+    fill(e);
+    for (int i=1; i<=n; ++i) {
+        fillRandom(d(i));
+        d(i) += PT(3);
+    }
+    for (int i=1; i<=n-1; ++i) {
+        eH(i) = cxxblas::conjugate(e(i));
+    }
+    fill(X);
+    apply(e, d, eH, X, B);
+
+    lapack::ptsv(d, e, B);
+    if (! lapack::isClose(B, X, 1e-10, "B", "X")) {
+        cerr << endl << "failed: ptsv [n = " << n << "]" << endl;
+        ASSERT(0);
+    }
+}
+
+//
+//  Zero diagonal, gtsv has to pivot
+//
+void
+runPivoting(int n)
+{
+    typedef DenseVector<Array<double> >   Vector;
+    typedef GeMatrix<FullStorage<double> > Matrix;
+
+    Vector dl(n-1), d(n), du(n-1);
+    Matrix X(n, 1), B(n, 1);
+
+    dl = 1;
+    d  = 0;
+    du = 1;
+    fill(X);
+    apply(dl, d, du, X, B);
+
+    if (lapack::gtsv(dl, d, du, B)!=0) {
+        cerr << endl << "failed: gtsv [pivoting] is singular" << endl;
+        ASSERT(0);
+    }
+    if (! lapack::isClose(B, X, 1e-10, "B", "X")) {
+        cerr << endl << "failed: gtsv (pivoting) [n = " << n << "]" << endl;
+        ASSERT(0);
+    }
+}
+
+//
+//  m systems of order n, stored ColMajor or RowMajor (interleaved)
+//
+template <typename T, StorageOrder Order>
+void
+runBatched(int n, int m)
+{
+    typedef GeMatrix<FullStorage<T, Order> >  Matrix;
+    typedef DenseVector<Array<T> >            Vector;
+
+    const Underscore<int> _;
+
+    Matrix DL(n, m), D(n, m), DU(n, m), X(n, m), B(n, m), Work(n, m);
+
+    fill(DL);
+    fill(D);
+    fill(DU);
+    fill(X);
+    for (int k=1; k<=m; ++k) {
+        for (int i=1; i<=n; ++i) {
+            D(i,k) += T(3);
+        }
+        Vector dl = DL(_(2,n),k), du = DU(_(1,n-1),k);
+        Matrix Bk(n, 1), Xk = X(_,_(k,k));
+        apply(dl, D(_,k), du, Xk, Bk);
+        B(_,k) = Bk(_,1);
+    }
+
+    lapack::extensions::thomas_sv_batched(DL, D, DU, B, Work);
+    if (! lapack::isClose(B, X, 1e-10, "B", "X")) {
+        cerr << endl << "failed: thomas_sv_batched [n = " << n << "]" << endl;
+        ASSERT(0);
+    }
+}
+
+int
+main()
+{
+    typedef complex<double>  Z;
+
+    const int sizes[] = { 1, 2, 3, 7, 8, 64, 1000, 100003 };
+
+    for (int n : sizes) {
+        run<double>(n);
+        run<Z>(n);
+        runPt<double>(n);
+        runPt<Z>(n);
+    }
+    runPivoting(1000);
+
+    const int numSystems[] = { 1, 63, 64, 200 };
+    for (int m : numSystems) {
+        runBatched<double, ColMajor>(50, m);
+        runBatched<double, RowMajor>(50, m);
+        runBatched<Z, RowMajor>(17, m);
+    }
+
+#   ifdef _OPENMP
+    for (int t=1; t<=4; ++t) {
+        omp_set_num_threads(t);
+        run<double>(1<<20);
+        runBatched<double, RowMajor>(100, 5000);
+    }
+#   endif
+}
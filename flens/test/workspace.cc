@@ -0,0 +1,281 @@
+#include <cxxstd/cstdlib.h>
+#include <cxxstd/iostream.h>
+#include <thread>
+#include <flens/flens.cxx>
+
+#ifndef SEED
+#define SEED  0
+#endif
+
+//
+//  Tests the thread local workspace arena.  Compile with -pthread and once
+//  more with -DFLENS_NO_WORKSPACE for the fallback to std::allocator.
+//
+
+using namespace flens;
+using namespace std;
+
+typedef GeMatrix<FullStorage<double> >           DGeMatrix;
+typedef DenseVector<Array<double> >              DDenseVector;
+typedef DenseVector<Array<int> >                 IDenseVector;
+
+const size_t minChunkSize = 1 << 16;
+
+void
+checkAligned(void *p)
+{
+    if (reinterpret_cast<size_t>(p) % Workspace::alignment!=0) {
+        cerr << endl << "failed: alignment of " << p << endl;
+        ASSERT(0);
+    }
+}
+
+void
+checkStatistics(const char *what, size_t inUse, size_t peak,
+                long numAllocations, long numChunkAllocations, size_t capacity)
+{
+    if (Workspace::inUse()!=inUse
+     || Workspace::peak()!=peak
+     || Workspace::numAllocations()!=numAllocations
+     || Workspace::numChunkAllocations()!=numChunkAllocations
+     || Workspace::capacity()!=capacity)
+    {
+        cerr << endl << "failed: " << what << endl;
+        cerr << "inUse =               " << Workspace::inUse()
+             << " (expected " << inUse << ")" << endl;
+        cerr << "peak =                " << Workspace::peak()
+             << " (expected " << peak << ")" << endl;
+        cerr << "numAllocations =      " << Workspace::numAllocations()
+             << " (expected " << numAllocations << ")" << endl;
+        cerr << "numChunkAllocations = " << Workspace::numChunkAllocations()
+             << " (expected " << numChunkAllocations << ")" << endl;
+        cerr << "capacity =            " << Workspace::capacity()
+             << " (expected " << capacity << ")" << endl;
+        ASSERT(0);
+    }
+}
+
+//
+//  Blocks get popped once everything allocated after them is released
+//
+void
+lifo()
+{
+    Workspace::release();
+    Workspace::resetStatistics();
+
+    char *a = static_cast<char *>(Workspace::allocate(100));
+    char *b = static_cast<char *>(Workspace::allocate(1000));
+    char *c = static_cast<char *>(Workspace::allocate(10));
+
+    checkAligned(a);
+    checkAligned(b);
+    checkAligned(c);
+    ASSERT(b==a+128 && c==b+1024);
+    checkStatistics("allocate", 1216, 1216, 3, 1, minChunkSize);
+
+//
+//  b is not on top, so it can not be reused yet
+//
+    Workspace::deallocate(b, 1000);
+    checkStatistics("release out of order", 192, 1216, 3, 1, minChunkSize);
+
+    char *d = static_cast<char *>(Workspace::allocate(64));
+    ASSERT(d==c+64);
+
+//
+//  Releasing d and c also pops b
+//
+    Workspace::deallocate(d, 64);
+    Workspace::deallocate(c, 10);
+    checkStatistics("release", 128, 1216, 4, 1, minChunkSize);
+
+    char *e = static_cast<char *>(Workspace::allocate(1000));
+    ASSERT(e==b);
+
+    Workspace::deallocate(a, 100);
+    Workspace::deallocate(e, 1000);
+    checkStatistics("release all", 0, 1216, 5, 1, minChunkSize);
+
+    Workspace::resetStatistics();
+    checkStatistics("resetStatistics", 0, 0, 0, 0, minChunkSize);
+}
+
+//
+//  Growth by chunks of at least twice the size of the last chunk and merge
+//  into a single chunk once the arena is empty
+//
+void
+growth()
+{
+    Workspace::release();
+    Workspace::resetStatistics();
+
+    void *a = Workspace::allocate(minChunkSize/2);
+    void *b = Workspace::allocate(minChunkSize);
+    checkStatistics("second chunk", 3*minChunkSize/2, 3*minChunkSize/2, 2, 2,
+                    3*minChunkSize);
+
+    void *c = Workspace::allocate(2*minChunkSize);
+    checkStatistics("third chunk", 7*minChunkSize/2, 7*minChunkSize/2, 3, 3,
+                    7*minChunkSize);
+
+    checkAligned(a);
+    checkAligned(b);
+    checkAligned(c);
+
+    Workspace::deallocate(a, minChunkSize/2);
+    Workspace::deallocate(c, 2*minChunkSize);
+    checkStatistics("no merge", minChunkSize, 7*minChunkSize/2, 3, 3,
+                    7*minChunkSize);
+
+    Workspace::deallocate(b, minChunkSize);
+    checkStatistics("merge", 0, 7*minChunkSize/2, 3, 4, 7*minChunkSize);
+
+//
+//  The merged chunk holds everything at once
+//
+    void *d = Workspace::allocate(7*minChunkSize);
+    checkStatistics("merged chunk", 7*minChunkSize, 7*minChunkSize, 4, 4,
+                    7*minChunkSize);
+    Workspace::deallocate(d, 7*minChunkSize);
+}
+
+void
+reservation()
+{
+    Workspace::release();
+    Workspace::resetStatistics();
+
+    Workspace::reserve(1 << 20);
+    checkStatistics("reserve", 0, 0, 0, 1, 1 << 20);
+
+    Workspace::reserve(1000);
+    checkStatistics("reserve less", 0, 0, 0, 1, 1 << 20);
+
+//
+//  With blocks in use reserve adds a chunk for the difference
+//
+    void *a = Workspace::allocate(100);
+    Workspace::reserve(1 << 21);
+    checkStatistics("reserve in use", 128, 128, 1, 2, 1 << 21);
+
+    Workspace::release();
+    checkStatistics("release in use", 128, 128, 1, 2, 1 << 21);
+
+    Workspace::deallocate(a, 100);
+    checkStatistics("merge reserved", 0, 128, 1, 3, 1 << 21);
+
+    Workspace::release();
+    checkStatistics("release", 0, 128, 1, 3, 0);
+}
+
+//
+//  Objects using WorkspaceAllocator, LAPACK work arrays and types of closure
+//  temporaries
+//
+void
+allocators()
+{
+    typedef std::allocator<double>                           SA;
+    typedef WorkspaceAllocator<double>                       WA;
+    typedef DenseVector<Array<double, IndexOptions<>, WA> >  WVector;
+    typedef WorkspaceAllocatorFor<SA>::Type                  TA;
+    typedef VectorClosure<OpAdd, DDenseVector, DDenseVector> Closure;
+    typedef Result<Closure>::Type::Engine::Allocator         RA;
+
+    Workspace::resetStatistics();
+    {
+        WVector x(100), y(10);
+
+        ASSERT(Workspace::inUse()==832+128);
+        checkAligned(x.data());
+
+        x = 1;
+        y = 2;
+        ASSERT(x(100)==1 && y(10)==2);
+    }
+    ASSERT(Workspace::inUse()==0);
+
+#   ifndef FLENS_NO_WORKSPACE
+    ASSERT((IsSame<TA, WA>::value));
+    ASSERT((IsSame<RA, WA>::value));
+#   else
+    ASSERT((IsSame<TA, SA>::value));
+    ASSERT((IsSame<RA, SA>::value));
+#   endif
+
+//
+//  getri takes its work array from the arena
+//
+    const int n = 50;
+
+    DGeMatrix     A_(n, n), A(n, n), I(n, n), I_(n, n);
+    IDenseVector  piv(n);
+
+    for (int i=1; i<=n; ++i) {
+        for (int j=1; j<=n; ++j) {
+            A_(i,j) = (i==j) ? 2*n : rand() % 10;
+            I_(i,j) = (i==j) ? 1 : 0;
+        }
+    }
+    A = A_;
+
+    ASSERT(lapack::trf(A, piv)==0);
+
+    Workspace::resetStatistics();
+    ASSERT(lapack::tri(A, piv)==0);
+
+#   ifndef FLENS_NO_WORKSPACE
+    ASSERT(Workspace::numAllocations()>0);
+#   else
+    ASSERT(Workspace::numAllocations()==0);
+#   endif
+    ASSERT(Workspace::inUse()==0);
+
+    blas::mm(NoTrans, NoTrans, 1.0, A_, A, 0.0, I);
+    if (! lapack::isClose(I, I_, 1e-12, "A*inv(A)", "I")) {
+        cerr << endl << "failed: tri" << endl;
+        ASSERT(0);
+    }
+}
+
+//
+//  Each thread has its own arena.  FLENS_WORKSPACE_RESERVE gets read when a
+//  thread uses its arena for the first time.
+//
+void
+threads()
+{
+    void *a = Workspace::allocate(100);
+    const size_t inUse = Workspace::inUse();
+
+    setenv("FLENS_WORKSPACE_RESERVE", "100000", 1);
+
+    std::thread t([] {
+        checkStatistics("new thread", 0, 0, 0, 1, 100000);
+
+        void *b = Workspace::allocate(1000);
+        ASSERT(Workspace::inUse()==1024);
+        Workspace::deallocate(b, 1000);
+        ASSERT(Workspace::inUse()==0);
+    });
+    t.join();
+
+    unsetenv("FLENS_WORKSPACE_RESERVE");
+
+    ASSERT(Workspace::inUse()==inUse);
+    Workspace::deallocate(a, 100);
+}
+
+int
+main()
+{
+    srand(SEED);
+
+    lifo();
+    growth();
+    reservation();
+    allocators();
+    threads();
+}
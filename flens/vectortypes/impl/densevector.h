@@ -99,6 +99,8 @@ class DenseVector
 
         DenseVector(const DenseVector &rhs);
 
+        DenseVector(DenseVector &&rhs);
+
         template <typename RHS>
             DenseVector(const DenseVector<RHS> &rhs);
 
@@ -120,6 +122,12 @@ class DenseVector
         DenseVector &
         operator=(const DenseVector &rhs);
 
+        template <typename RHS>
+            typename RestrictTo<IsSame<A, RHS>::value
+                             && IsSame<A, typename A::NoView>::value,
+                     DenseVector>::Type &
+            operator=(DenseVector<RHS> &&rhs);
+
         template <typename RHS>
             DenseVector &
             operator=(const Vector<RHS> &rhs);
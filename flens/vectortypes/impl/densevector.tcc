@@ -131,6 +131,29 @@ DenseVector<A>::operator=(const DenseVector &rhs)
     return *this;
 }
 
+//
+//  Assignment from an expiring vector with the same storage type takes over
+//  its memory if this vector is empty.  Otherwise views might still refer to
+//  the memory of this vector and the entries get copied as usual.
+//
+template <typename A>
+template <typename RHS>
+typename RestrictTo<IsSame<A, RHS>::value
+                 && IsSame<A, typename A::NoView>::value,
+         DenseVector<A> >::Type &
+DenseVector<A>::operator=(DenseVector<RHS> &&rhs)
+{
+    if (this==&rhs) {
+        return *this;
+    }
+    if (length()==0) {
+        array_.swap(rhs.engine());
+    } else {
+        assign(rhs, *this);
+    }
+    return *this;
+}
+
 template <typename A>
 template <typename E>
 DenseVector<A> &
@@ -34,6 +34,7 @@
 #define PLAYGROUND_CXXBLAS_INTRINSICS_AUXILIARY_BLOCKSIZE_H 1
 
 #include <math.h>
+#include <cxxstd/algorithm.h>
 
 #ifdef USE_INTRINSIC
 
@@ -41,6 +42,7 @@ enum BlasFct
 {
     TRMV,
     TRSV,
+    GEMM,
 };
 
 template <typename T>
@@ -126,6 +128,48 @@ struct BlockSize<TRSV, T, IndexType> {
 
 };
 
+//
+//  Block sizes of the packed gemm (level3/gemm/driver.h) for a MR x NR micro
+//  kernel.  A kc x NR sliver of B and a MR x kc sliver of A take about half
+//  of the L1 cache, a packed mc x kc block of A about half of the L2 cache.
+//  BLOCKSIZE_GEMM_K and BLOCKSIZE_GEMM_M override the cache probes.
+//
+template<typename T, typename IndexType>
+struct BlockSize<GEMM, T, IndexType> {
+
+    static const IndexType
+    KC(IndexType MR, IndexType NR)
+    {
+#       ifdef BLOCKSIZE_GEMM_K
+        return BLOCKSIZE_GEMM_K;
+#       else
+        size_t l1 = get_l1_cache_size();
+        if (l1==0 || l1>size_t(1)<<24) {
+            l1 = 32*1024;
+        }
+        IndexType kc = l1/(2*(MR+NR)*sizeOf<T>::value);
+        kc = (kc/8)*8;
+        return std::max(IndexType(64), std::min(kc, IndexType(1024)));
+#       endif
+    };
+
+    static const IndexType
+    MC(IndexType MR, IndexType kc)
+    {
+#       ifdef BLOCKSIZE_GEMM_M
+        return BLOCKSIZE_GEMM_M;
+#       else
+        size_t l2 = get_l2_cache_size();
+        if (l2==0 || l2>size_t(1)<<30) {
+            l2 = 256*1024;
+        }
+        IndexType mc = l2/(2*kc*sizeOf<T>::value);
+        mc = (mc/MR)*MR;
+        return std::max(MR, std::min(mc, IndexType(4096)));
+#       endif
+    };
+
+};
 
 #endif // USE_INTRINSIC
 
@@ -0,0 +1,129 @@
+/*
+ *   Copyright (c) 2012, Klaus Pototzky
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef PLAYGROUND_CXXBLAS_INTRINSICS_CLASSES_AVX2_H
+#define PLAYGROUND_CXXBLAS_INTRINSICS_CLASSES_AVX2_H 1
+
+#include <playground/cxxblas/intrinsics/includes.h>
+#include <playground/cxxblas/intrinsics/classes/functions/functions.h>
+
+#ifdef HAVE_AVX2
+
+INTRINSICS_TARGET_AVX2
+
+//
+//  AVX2 registers are AVX registers, but intrinsic_fmadd_ uses FMA.  The
+//  tail of a vector gets loaded and stored with a mask: loadu(a, n) and
+//  storeu(a, n) only touch the first n<numElements elements.
+//
+template <>
+class Intrinsics<float, IntrinsicsLevel::AVX2>
+{
+public:
+    typedef float                            DataType;
+    typedef float                            PrimitiveDataType;
+    typedef __m256                           IntrinsicsDataType;
+    static  const int                        numElements = 8;
+
+    Intrinsics(void)                         {}
+    Intrinsics(__m256 val)                   {v = val;}
+    Intrinsics(float *a)                     {this->load(a);}
+    Intrinsics(float a)                      {this->fill(a);}
+
+    void operator=(float *a)                 {this->load(a);}
+    void operator=(float a)                  {this->fill(a);}
+    void operator=(__m256 a)                 {v = a; }
+
+    __m256 get(void) const                   {return v;}
+
+    void fill(float a)                       { v = mm256_broadcast_ss_(&a); }
+    void load(const float *a)                { v = mm256_load_ps_(a);  }
+    void loadu(const float *a)               { v = mm256_loadu_ps_(a);  }
+    void loadu(const float *a, int n)        { v = mm256_maskload_ps_(a, mask(n)); }
+    void setZero()                           { v = mm256_setzero_ps_(); }
+    void store(float *a)                     { mm256_store_ps_(a, v);  }
+    void storeu(float *a)                    { mm256_storeu_ps_(a, v);  }
+    void storeu(float *a, int n)             { mm256_maskstore_ps_(a, mask(n), v); }
+    void stream(float *a)                    { mm256_stream_ps_(a, v); }
+
+    static __m256i mask(int n)               { return mm256_cmpgt_epi32_(mm256_set1_epi32_(n),
+                                                                         mm256_setr_epi32_(0, 1, 2, 3, 4, 5, 6, 7)); }
+
+private:
+    __m256                                   v;
+
+};
+
+template <>
+class Intrinsics<double, IntrinsicsLevel::AVX2> {
+
+public:
+    typedef double                           DataType;
+    typedef double                           PrimitiveDataType;
+    typedef __m256d                          IntrinsicsDataType;
+    static  const int                        numElements = 4;
+
+    Intrinsics(void)                         {}
+    Intrinsics(__m256d val)                  {v = val;}
+    Intrinsics(double *a)                    {this->load(a);}
+    Intrinsics(double a)                     {this->fill(a);}
+
+    void operator=(double *a)                {this->load(a);}
+    void operator=(double a)                 {this->fill(a);}
+    void operator=(__m256d a)                {v = a; }
+
+    __m256d get(void) const                  {return v;}
+
+    void fill(double a)                      { v = mm256_broadcast_sd_(&a); }
+    void load(const double *a)               { v = mm256_load_pd_(a);  }
+    void loadu(const double *a)              { v = mm256_loadu_pd_(a);  }
+    void loadu(const double *a, int n)       { v = mm256_maskload_pd_(a, mask(n)); }
+    void setZero()                           { v = mm256_setzero_pd_(); }
+    void store(double *a)                    { mm256_store_pd_(a, v);  }
+    void storeu(double *a)                   { mm256_storeu_pd_(a, v);  }
+    void storeu(double *a, int n)            { mm256_maskstore_pd_(a, mask(n), v); }
+    void stream(double *a)                   { mm256_stream_pd_(a, v); }
+
+    static __m256i mask(int n)               { return mm256_cmpgt_epi64_(mm256_set1_epi64x_(n),
+                                                                         mm256_setr_epi64x_(0, 1, 2, 3)); }
+
+private:
+    __m256d                                  v;
+
+};
+
+INTRINSICS_TARGET_END
+
+#endif // HAVE_AVX2
+
+#endif // PLAYGROUND_CXXBLAS_INTRINSICS_CLASSES_AVX2_H
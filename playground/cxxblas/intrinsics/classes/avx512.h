@@ -0,0 +1,127 @@
+/*
+ *   Copyright (c) 2012, Klaus Pototzky
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef PLAYGROUND_CXXBLAS_INTRINSICS_CLASSES_AVX512_H
+#define PLAYGROUND_CXXBLAS_INTRINSICS_CLASSES_AVX512_H 1
+
+#include <playground/cxxblas/intrinsics/includes.h>
+#include <playground/cxxblas/intrinsics/classes/functions/functions.h>
+
+#ifdef HAVE_AVX512
+
+INTRINSICS_TARGET_AVX512
+
+//
+//  AVX-512F registers.  Tails get loaded and stored with a mask register:
+//  loadu(a, n) and storeu(a, n) only touch the first n<numElements
+//  elements.
+//
+template <>
+class Intrinsics<float, IntrinsicsLevel::AVX512>
+{
+public:
+    typedef float                            DataType;
+    typedef float                            PrimitiveDataType;
+    typedef __m512                           IntrinsicsDataType;
+    static  const int                        numElements = 16;
+
+    Intrinsics(void)                         {}
+    Intrinsics(__m512 val)                   {v = val;}
+    Intrinsics(float *a)                     {this->load(a);}
+    Intrinsics(float a)                      {this->fill(a);}
+
+    void operator=(float *a)                 {this->load(a);}
+    void operator=(float a)                  {this->fill(a);}
+    void operator=(__m512 a)                 {v = a; }
+
+    __m512 get(void) const                   {return v;}
+
+    void fill(float a)                       { v = mm512_set1_ps_(a); }
+    void load(const float *a)                { v = mm512_load_ps_(a);  }
+    void loadu(const float *a)               { v = mm512_loadu_ps_(a);  }
+    void loadu(const float *a, int n)        { v = mm512_maskz_loadu_ps_(mask(n), a); }
+    void setZero()                           { v = mm512_setzero_ps_(); }
+    void store(float *a)                     { mm512_store_ps_(a, v);  }
+    void storeu(float *a)                    { mm512_storeu_ps_(a, v);  }
+    void storeu(float *a, int n)             { mm512_mask_storeu_ps_(a, mask(n), v); }
+    void stream(float *a)                    { mm512_stream_ps_(a, v); }
+
+    static __mmask16 mask(int n)             { return __mmask16((1u << n) - 1u); }
+
+private:
+    __m512                                   v;
+
+};
+
+template <>
+class Intrinsics<double, IntrinsicsLevel::AVX512> {
+
+public:
+    typedef double                           DataType;
+    typedef double                           PrimitiveDataType;
+    typedef __m512d                          IntrinsicsDataType;
+    static  const int                        numElements = 8;
+
+    Intrinsics(void)                         {}
+    Intrinsics(__m512d val)                  {v = val;}
+    Intrinsics(double *a)                    {this->load(a);}
+    Intrinsics(double a)                     {this->fill(a);}
+
+    void operator=(double *a)                {this->load(a);}
+    void operator=(double a)                 {this->fill(a);}
+    void operator=(__m512d a)                {v = a; }
+
+    __m512d get(void) const                  {return v;}
+
+    void fill(double a)                      { v = mm512_set1_pd_(a); }
+    void load(const double *a)               { v = mm512_load_pd_(a);  }
+    void loadu(const double *a)              { v = mm512_loadu_pd_(a);  }
+    void loadu(const double *a, int n)       { v = mm512_maskz_loadu_pd_(mask(n), a); }
+    void setZero()                           { v = mm512_setzero_pd_(); }
+    void store(double *a)                    { mm512_store_pd_(a, v);  }
+    void storeu(double *a)                   { mm512_storeu_pd_(a, v);  }
+    void storeu(double *a, int n)            { mm512_mask_storeu_pd_(a, mask(n), v); }
+    void stream(double *a)                   { mm512_stream_pd_(a, v); }
+
+    static __mmask8 mask(int n)              { return __mmask8((1u << n) - 1u); }
+
+private:
+    __m512d                                  v;
+
+};
+
+INTRINSICS_TARGET_END
+
+#endif // HAVE_AVX512
+
+#endif // PLAYGROUND_CXXBLAS_INTRINSICS_CLASSES_AVX512_H
@@ -41,6 +41,8 @@
 
 #include <playground/cxxblas/intrinsics/classes/sse.h>
 #include <playground/cxxblas/intrinsics/classes/avx.h>
+#include <playground/cxxblas/intrinsics/classes/avx2.h>
+#include <playground/cxxblas/intrinsics/classes/avx512.h>
 
 
 
@@ -0,0 +1,118 @@
+/*
+ *   Copyright (c) 2012, Klaus Pototzky
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PLAYGROUND_CXXBLAS_INTRINSICS_CLASSES_FUNCTIONS_ABS_TCC
+#define PLAYGROUND_CXXBLAS_INTRINSICS_CLASSES_FUNCTIONS_ABS_TCC 1
+
+#include <playground/cxxblas/intrinsics/includes.h>
+
+#ifdef HAVE_SSE
+
+//--- Abs
+Intrinsics<float, IntrinsicsLevel::SSE>
+inline intrinsic_abs_(const Intrinsics<float, IntrinsicsLevel::SSE> &x)
+{
+    return Intrinsics<float, IntrinsicsLevel::SSE>(mm_andnot_ps_(mm_set1_ps_(-0.0f), x.get()));
+}
+
+Intrinsics<double, IntrinsicsLevel::SSE>
+inline intrinsic_abs_(const Intrinsics<double, IntrinsicsLevel::SSE> &x)
+{
+    return Intrinsics<double, IntrinsicsLevel::SSE>(mm_andnot_pd_(mm_set1_pd_(-0.0), x.get()));
+}
+
+#endif // HAVE_SSE
+
+
+#ifdef HAVE_AVX
+
+//--- Abs
+Intrinsics<float, IntrinsicsLevel::AVX>
+inline intrinsic_abs_(const Intrinsics<float, IntrinsicsLevel::AVX> &x)
+{
+    return Intrinsics<float, IntrinsicsLevel::AVX>(mm256_andnot_ps_(mm256_set1_ps_(-0.0f), x.get()));
+}
+
+Intrinsics<double, IntrinsicsLevel::AVX>
+inline intrinsic_abs_(const Intrinsics<double, IntrinsicsLevel::AVX> &x)
+{
+    return Intrinsics<double, IntrinsicsLevel::AVX>(mm256_andnot_pd_(mm256_set1_pd_(-0.0), x.get()));
+}
+
+#endif // HAVE_AVX
+
+
+#ifdef HAVE_AVX2
+
+INTRINSICS_TARGET_AVX2
+
+//--- Abs
+Intrinsics<float, IntrinsicsLevel::AVX2>
+inline intrinsic_abs_(const Intrinsics<float, IntrinsicsLevel::AVX2> &x)
+{
+    return Intrinsics<float, IntrinsicsLevel::AVX2>(mm256_andnot_ps_(mm256_set1_ps_(-0.0f), x.get()));
+}
+
+Intrinsics<double, IntrinsicsLevel::AVX2>
+inline intrinsic_abs_(const Intrinsics<double, IntrinsicsLevel::AVX2> &x)
+{
+    return Intrinsics<double, IntrinsicsLevel::AVX2>(mm256_andnot_pd_(mm256_set1_pd_(-0.0), x.get()));
+}
+
+INTRINSICS_TARGET_END
+
+#endif // HAVE_AVX2
+
+
+#ifdef HAVE_AVX512
+
+INTRINSICS_TARGET_AVX512
+
+//--- Abs
+Intrinsics<float, IntrinsicsLevel::AVX512>
+inline intrinsic_abs_(const Intrinsics<float, IntrinsicsLevel::AVX512> &x)
+{
+    return Intrinsics<float, IntrinsicsLevel::AVX512>(mm512_abs_ps_(x.get()));
+}
+
+Intrinsics<double, IntrinsicsLevel::AVX512>
+inline intrinsic_abs_(const Intrinsics<double, IntrinsicsLevel::AVX512> &x)
+{
+    return Intrinsics<double, IntrinsicsLevel::AVX512>(mm512_abs_pd_(x.get()));
+}
+
+INTRINSICS_TARGET_END
+
+#endif // HAVE_AVX512
+
+
+#endif // PLAYGROUND_CXXBLAS_INTRINSICS_CLASSES_FUNCTIONS_ABS_TCC
@@ -79,4 +79,42 @@ inline intrinsic_add_(const Intrinsics<std::complex<double>, IntrinsicsLevel::AV
 
 #endif // HAVE_AVX
 
+
+#ifdef HAVE_AVX2
+
+INTRINSICS_TARGET_AVX2
+
+//--- Add
+Intrinsics<float, IntrinsicsLevel::AVX2>
+inline intrinsic_add_(const Intrinsics<float, IntrinsicsLevel::AVX2> &x,
+                      const Intrinsics<float, IntrinsicsLevel::AVX2> &y);
+
+Intrinsics<double, IntrinsicsLevel::AVX2>
+inline intrinsic_add_(const Intrinsics<double, IntrinsicsLevel::AVX2> &x,
+                      const Intrinsics<double, IntrinsicsLevel::AVX2> &y);
+
+INTRINSICS_TARGET_END
+
+#endif // HAVE_AVX2
+
+
+
+#ifdef HAVE_AVX512
+
+INTRINSICS_TARGET_AVX512
+
+//--- Add
+Intrinsics<float, IntrinsicsLevel::AVX512>
+inline intrinsic_add_(const Intrinsics<float, IntrinsicsLevel::AVX512> &x,
+                      const Intrinsics<float, IntrinsicsLevel::AVX512> &y);
+
+Intrinsics<double, IntrinsicsLevel::AVX512>
+inline intrinsic_add_(const Intrinsics<double, IntrinsicsLevel::AVX512> &x,
+                      const Intrinsics<double, IntrinsicsLevel::AVX512> &y);
+
+INTRINSICS_TARGET_END
+
+#endif // HAVE_AVX512
+
+
 #endif // PLAYGROUND_CXXBLAS_INTRINSICS_CLASSES_FUNCTIONS_ADD_H
@@ -102,4 +102,54 @@ inline intrinsic_add_(const Intrinsics<std::complex<double>, IntrinsicsLevel::AV
 
 #endif // HAVE_AVX
 
+
+#ifdef HAVE_AVX2
+
+INTRINSICS_TARGET_AVX2
+
+//--- Add
+Intrinsics<float, IntrinsicsLevel::AVX2>
+inline intrinsic_add_(const Intrinsics<float, IntrinsicsLevel::AVX2> &x,
+                      const Intrinsics<float, IntrinsicsLevel::AVX2> &y)
+{
+    return Intrinsics<float, IntrinsicsLevel::AVX2>(mm256_add_ps_(x.get(), y.get()));
+}
+
+Intrinsics<double, IntrinsicsLevel::AVX2>
+inline intrinsic_add_(const Intrinsics<double, IntrinsicsLevel::AVX2> &x,
+                      const Intrinsics<double, IntrinsicsLevel::AVX2> &y)
+{
+    return Intrinsics<double, IntrinsicsLevel::AVX2>(mm256_add_pd_(x.get(), y.get()));
+}
+
+INTRINSICS_TARGET_END
+
+#endif // HAVE_AVX2
+
+
+
+#ifdef HAVE_AVX512
+
+INTRINSICS_TARGET_AVX512
+
+//--- Add
+Intrinsics<float, IntrinsicsLevel::AVX512>
+inline intrinsic_add_(const Intrinsics<float, IntrinsicsLevel::AVX512> &x,
+                      const Intrinsics<float, IntrinsicsLevel::AVX512> &y)
+{
+    return Intrinsics<float, IntrinsicsLevel::AVX512>(mm512_add_ps_(x.get(), y.get()));
+}
+
+Intrinsics<double, IntrinsicsLevel::AVX512>
+inline intrinsic_add_(const Intrinsics<double, IntrinsicsLevel::AVX512> &x,
+                      const Intrinsics<double, IntrinsicsLevel::AVX512> &y)
+{
+    return Intrinsics<double, IntrinsicsLevel::AVX512>(mm512_add_pd_(x.get(), y.get()));
+}
+
+INTRINSICS_TARGET_END
+
+#endif // HAVE_AVX512
+
+
 #endif // PLAYGROUND_CXXBLAS_INTRINSICS_CLASSES_FUNCTIONS_ADD_TCC
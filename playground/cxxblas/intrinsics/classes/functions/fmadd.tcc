@@ -0,0 +1,135 @@
+/*
+ *   Copyright (c) 2012, Klaus Pototzky
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef PLAYGROUND_CXXBLAS_INTRINSICS_CLASSES_FUNCTIONS_FMADD_TCC
+#define PLAYGROUND_CXXBLAS_INTRINSICS_CLASSES_FUNCTIONS_FMADD_TCC 1
+
+#include <playground/cxxblas/intrinsics/includes.h>
+
+#ifdef HAVE_SSE
+
+//--- Fmadd
+Intrinsics<float, IntrinsicsLevel::SSE>
+inline intrinsic_fmadd_(const Intrinsics<float, IntrinsicsLevel::SSE> &x,
+                        const Intrinsics<float, IntrinsicsLevel::SSE> &y,
+                        const Intrinsics<float, IntrinsicsLevel::SSE> &z)
+{
+    return Intrinsics<float, IntrinsicsLevel::SSE>(mm_add_ps_(mm_mul_ps_(x.get(), y.get()), z.get()));
+}
+
+Intrinsics<double, IntrinsicsLevel::SSE>
+inline intrinsic_fmadd_(const Intrinsics<double, IntrinsicsLevel::SSE> &x,
+                        const Intrinsics<double, IntrinsicsLevel::SSE> &y,
+                        const Intrinsics<double, IntrinsicsLevel::SSE> &z)
+{
+    return Intrinsics<double, IntrinsicsLevel::SSE>(mm_add_pd_(mm_mul_pd_(x.get(), y.get()), z.get()));
+}
+
+#endif // HAVE_SSE
+
+
+#ifdef HAVE_AVX
+
+//--- Fmadd
+Intrinsics<float, IntrinsicsLevel::AVX>
+inline intrinsic_fmadd_(const Intrinsics<float, IntrinsicsLevel::AVX> &x,
+                        const Intrinsics<float, IntrinsicsLevel::AVX> &y,
+                        const Intrinsics<float, IntrinsicsLevel::AVX> &z)
+{
+    return Intrinsics<float, IntrinsicsLevel::AVX>(mm256_add_ps_(mm256_mul_ps_(x.get(), y.get()), z.get()));
+}
+
+Intrinsics<double, IntrinsicsLevel::AVX>
+inline intrinsic_fmadd_(const Intrinsics<double, IntrinsicsLevel::AVX> &x,
+                        const Intrinsics<double, IntrinsicsLevel::AVX> &y,
+                        const Intrinsics<double, IntrinsicsLevel::AVX> &z)
+{
+    return Intrinsics<double, IntrinsicsLevel::AVX>(mm256_add_pd_(mm256_mul_pd_(x.get(), y.get()), z.get()));
+}
+
+#endif // HAVE_AVX
+
+
+#ifdef HAVE_AVX2
+
+INTRINSICS_TARGET_AVX2
+
+//--- Fmadd
+Intrinsics<float, IntrinsicsLevel::AVX2>
+inline intrinsic_fmadd_(const Intrinsics<float, IntrinsicsLevel::AVX2> &x,
+                        const Intrinsics<float, IntrinsicsLevel::AVX2> &y,
+                        const Intrinsics<float, IntrinsicsLevel::AVX2> &z)
+{
+    return Intrinsics<float, IntrinsicsLevel::AVX2>(mm256_fmadd_ps_(x.get(), y.get(), z.get()));
+}
+
+Intrinsics<double, IntrinsicsLevel::AVX2>
+inline intrinsic_fmadd_(const Intrinsics<double, IntrinsicsLevel::AVX2> &x,
+                        const Intrinsics<double, IntrinsicsLevel::AVX2> &y,
+                        const Intrinsics<double, IntrinsicsLevel::AVX2> &z)
+{
+    return Intrinsics<double, IntrinsicsLevel::AVX2>(mm256_fmadd_pd_(x.get(), y.get(), z.get()));
+}
+
+INTRINSICS_TARGET_END
+
+#endif // HAVE_AVX2
+
+
+#ifdef HAVE_AVX512
+
+INTRINSICS_TARGET_AVX512
+
+//--- Fmadd
+Intrinsics<float, IntrinsicsLevel::AVX512>
+inline intrinsic_fmadd_(const Intrinsics<float, IntrinsicsLevel::AVX512> &x,
+                        const Intrinsics<float, IntrinsicsLevel::AVX512> &y,
+                        const Intrinsics<float, IntrinsicsLevel::AVX512> &z)
+{
+    return Intrinsics<float, IntrinsicsLevel::AVX512>(mm512_fmadd_ps_(x.get(), y.get(), z.get()));
+}
+
+Intrinsics<double, IntrinsicsLevel::AVX512>
+inline intrinsic_fmadd_(const Intrinsics<double, IntrinsicsLevel::AVX512> &x,
+                        const Intrinsics<double, IntrinsicsLevel::AVX512> &y,
+                        const Intrinsics<double, IntrinsicsLevel::AVX512> &z)
+{
+    return Intrinsics<double, IntrinsicsLevel::AVX512>(mm512_fmadd_pd_(x.get(), y.get(), z.get()));
+}
+
+INTRINSICS_TARGET_END
+
+#endif // HAVE_AVX512
+
+
+#endif // PLAYGROUND_CXXBLAS_INTRINSICS_CLASSES_FUNCTIONS_FMADD_TCC
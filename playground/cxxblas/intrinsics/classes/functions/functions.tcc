@@ -33,13 +33,16 @@
 #ifndef PLAYGROUND_CXXBLAS_INTRINSICS_CLASSES_FUNCTIONS_FUNCTIONS_TCC
 #define PLAYGROUND_CXXBLAS_INTRINSICS_CLASSES_FUNCTIONS_FUNCTIONS_TCC 1
 
+#include <playground/cxxblas/intrinsics/classes/functions/abs.tcc>
 #include <playground/cxxblas/intrinsics/classes/functions/add.tcc>
 #include <playground/cxxblas/intrinsics/classes/functions/addsub.tcc>
 #include <playground/cxxblas/intrinsics/classes/functions/div.tcc>
+#include <playground/cxxblas/intrinsics/classes/functions/fmadd.tcc>
 #include <playground/cxxblas/intrinsics/classes/functions/imag.tcc>
 #include <playground/cxxblas/intrinsics/classes/functions/mul.tcc>
 #include <playground/cxxblas/intrinsics/classes/functions/out.tcc>
 #include <playground/cxxblas/intrinsics/classes/functions/real.tcc>
+#include <playground/cxxblas/intrinsics/classes/functions/select.tcc>
 #include <playground/cxxblas/intrinsics/classes/functions/sub.tcc>
 #include <playground/cxxblas/intrinsics/classes/functions/swaprealimag.tcc>
 #include <playground/cxxblas/intrinsics/classes/functions/unpack.tcc>
@@ -130,4 +130,54 @@ inline intrinsic_mul_(const Intrinsics<double, IntrinsicsLevel::AVX> &x,
 
 #endif // HAVE_AVX
 
+
+#ifdef HAVE_AVX2
+
+INTRINSICS_TARGET_AVX2
+
+//--- Mul
+Intrinsics<float, IntrinsicsLevel::AVX2>
+inline intrinsic_mul_(const Intrinsics<float, IntrinsicsLevel::AVX2> &x,
+                      const Intrinsics<float, IntrinsicsLevel::AVX2> &y)
+{
+    return Intrinsics<float, IntrinsicsLevel::AVX2>(mm256_mul_ps_(x.get(), y.get()));
+}
+
+Intrinsics<double, IntrinsicsLevel::AVX2>
+inline intrinsic_mul_(const Intrinsics<double, IntrinsicsLevel::AVX2> &x,
+                      const Intrinsics<double, IntrinsicsLevel::AVX2> &y)
+{
+    return Intrinsics<double, IntrinsicsLevel::AVX2>(mm256_mul_pd_(x.get(), y.get()));
+}
+
+INTRINSICS_TARGET_END
+
+#endif // HAVE_AVX2
+
+
+
+#ifdef HAVE_AVX512
+
+INTRINSICS_TARGET_AVX512
+
+//--- Mul
+Intrinsics<float, IntrinsicsLevel::AVX512>
+inline intrinsic_mul_(const Intrinsics<float, IntrinsicsLevel::AVX512> &x,
+                      const Intrinsics<float, IntrinsicsLevel::AVX512> &y)
+{
+    return Intrinsics<float, IntrinsicsLevel::AVX512>(mm512_mul_ps_(x.get(), y.get()));
+}
+
+Intrinsics<double, IntrinsicsLevel::AVX512>
+inline intrinsic_mul_(const Intrinsics<double, IntrinsicsLevel::AVX512> &x,
+                      const Intrinsics<double, IntrinsicsLevel::AVX512> &y)
+{
+    return Intrinsics<double, IntrinsicsLevel::AVX512>(mm512_mul_pd_(x.get(), y.get()));
+}
+
+INTRINSICS_TARGET_END
+
+#endif // HAVE_AVX512
+
+
 #endif // PLAYGROUND_CXXBLAS_INTRINSICS_CLASSES_FUNCTIONS_MUL_TCC
@@ -0,0 +1,123 @@
+/*
+ *   Copyright (c) 2012, Klaus Pototzky
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PLAYGROUND_CXXBLAS_INTRINSICS_CLASSES_FUNCTIONS_SELECT_H
+#define PLAYGROUND_CXXBLAS_INTRINSICS_CLASSES_FUNCTIONS_SELECT_H 1
+
+#include <playground/cxxblas/intrinsics/includes.h>
+
+//
+//  intrinsic_select_lt_(a, b, x, y) returns x where a<b and y elsewhere.  The
+//  comparison is ordered and quiet, i.e. y gets selected where a or b is NaN.
+//
+
+#ifdef HAVE_SSE
+
+//--- Select
+Intrinsics<float, IntrinsicsLevel::SSE>
+inline intrinsic_select_lt_(const Intrinsics<float, IntrinsicsLevel::SSE> &a,
+                            const Intrinsics<float, IntrinsicsLevel::SSE> &b,
+                            const Intrinsics<float, IntrinsicsLevel::SSE> &x,
+                            const Intrinsics<float, IntrinsicsLevel::SSE> &y);
+
+Intrinsics<double, IntrinsicsLevel::SSE>
+inline intrinsic_select_lt_(const Intrinsics<double, IntrinsicsLevel::SSE> &a,
+                            const Intrinsics<double, IntrinsicsLevel::SSE> &b,
+                            const Intrinsics<double, IntrinsicsLevel::SSE> &x,
+                            const Intrinsics<double, IntrinsicsLevel::SSE> &y);
+
+#endif // HAVE_SSE
+
+
+#ifdef HAVE_AVX
+
+//--- Select
+Intrinsics<float, IntrinsicsLevel::AVX>
+inline intrinsic_select_lt_(const Intrinsics<float, IntrinsicsLevel::AVX> &a,
+                            const Intrinsics<float, IntrinsicsLevel::AVX> &b,
+                            const Intrinsics<float, IntrinsicsLevel::AVX> &x,
+                            const Intrinsics<float, IntrinsicsLevel::AVX> &y);
+
+Intrinsics<double, IntrinsicsLevel::AVX>
+inline intrinsic_select_lt_(const Intrinsics<double, IntrinsicsLevel::AVX> &a,
+                            const Intrinsics<double, IntrinsicsLevel::AVX> &b,
+                            const Intrinsics<double, IntrinsicsLevel::AVX> &x,
+                            const Intrinsics<double, IntrinsicsLevel::AVX> &y);
+
+#endif // HAVE_AVX
+
+
+#ifdef HAVE_AVX2
+
+INTRINSICS_TARGET_AVX2
+
+//--- Select
+Intrinsics<float, IntrinsicsLevel::AVX2>
+inline intrinsic_select_lt_(const Intrinsics<float, IntrinsicsLevel::AVX2> &a,
+                            const Intrinsics<float, IntrinsicsLevel::AVX2> &b,
+                            const Intrinsics<float, IntrinsicsLevel::AVX2> &x,
+                            const Intrinsics<float, IntrinsicsLevel::AVX2> &y);
+
+Intrinsics<double, IntrinsicsLevel::AVX2>
+inline intrinsic_select_lt_(const Intrinsics<double, IntrinsicsLevel::AVX2> &a,
+                            const Intrinsics<double, IntrinsicsLevel::AVX2> &b,
+                            const Intrinsics<double, IntrinsicsLevel::AVX2> &x,
+                            const Intrinsics<double, IntrinsicsLevel::AVX2> &y);
+
+INTRINSICS_TARGET_END
+
+#endif // HAVE_AVX2
+
+
+#ifdef HAVE_AVX512
+
+INTRINSICS_TARGET_AVX512
+
+//--- Select
+Intrinsics<float, IntrinsicsLevel::AVX512>
+inline intrinsic_select_lt_(const Intrinsics<float, IntrinsicsLevel::AVX512> &a,
+                            const Intrinsics<float, IntrinsicsLevel::AVX512> &b,
+                            const Intrinsics<float, IntrinsicsLevel::AVX512> &x,
+                            const Intrinsics<float, IntrinsicsLevel::AVX512> &y);
+
+Intrinsics<double, IntrinsicsLevel::AVX512>
+inline intrinsic_select_lt_(const Intrinsics<double, IntrinsicsLevel::AVX512> &a,
+                            const Intrinsics<double, IntrinsicsLevel::AVX512> &b,
+                            const Intrinsics<double, IntrinsicsLevel::AVX512> &x,
+                            const Intrinsics<double, IntrinsicsLevel::AVX512> &y);
+
+INTRINSICS_TARGET_END
+
+#endif // HAVE_AVX512
+
+
+#endif // PLAYGROUND_CXXBLAS_INTRINSICS_CLASSES_FUNCTIONS_SELECT_H
@@ -0,0 +1,154 @@
+/*
+ *   Copyright (c) 2012, Klaus Pototzky
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PLAYGROUND_CXXBLAS_INTRINSICS_CLASSES_FUNCTIONS_SELECT_TCC
+#define PLAYGROUND_CXXBLAS_INTRINSICS_CLASSES_FUNCTIONS_SELECT_TCC 1
+
+#include <playground/cxxblas/intrinsics/includes.h>
+
+#ifdef HAVE_SSE
+
+//--- Select
+Intrinsics<float, IntrinsicsLevel::SSE>
+inline intrinsic_select_lt_(const Intrinsics<float, IntrinsicsLevel::SSE> &a,
+                            const Intrinsics<float, IntrinsicsLevel::SSE> &b,
+                            const Intrinsics<float, IntrinsicsLevel::SSE> &x,
+                            const Intrinsics<float, IntrinsicsLevel::SSE> &y)
+{
+    const __m128 m = mm_cmplt_ps_(a.get(), b.get());
+    return Intrinsics<float, IntrinsicsLevel::SSE>(mm_or_ps_(mm_and_ps_(m, x.get()),
+                                                             mm_andnot_ps_(m, y.get())));
+}
+
+Intrinsics<double, IntrinsicsLevel::SSE>
+inline intrinsic_select_lt_(const Intrinsics<double, IntrinsicsLevel::SSE> &a,
+                            const Intrinsics<double, IntrinsicsLevel::SSE> &b,
+                            const Intrinsics<double, IntrinsicsLevel::SSE> &x,
+                            const Intrinsics<double, IntrinsicsLevel::SSE> &y)
+{
+    const __m128d m = mm_cmplt_pd_(a.get(), b.get());
+    return Intrinsics<double, IntrinsicsLevel::SSE>(mm_or_pd_(mm_and_pd_(m, x.get()),
+                                                              mm_andnot_pd_(m, y.get())));
+}
+
+#endif // HAVE_SSE
+
+
+#ifdef HAVE_AVX
+
+//--- Select
+Intrinsics<float, IntrinsicsLevel::AVX>
+inline intrinsic_select_lt_(const Intrinsics<float, IntrinsicsLevel::AVX> &a,
+                            const Intrinsics<float, IntrinsicsLevel::AVX> &b,
+                            const Intrinsics<float, IntrinsicsLevel::AVX> &x,
+                            const Intrinsics<float, IntrinsicsLevel::AVX> &y)
+{
+    const __m256 m = mm256_cmp_ps_(a.get(), b.get(), _CMP_LT_OQ);
+    return Intrinsics<float, IntrinsicsLevel::AVX>(mm256_or_ps_(mm256_and_ps_(m, x.get()),
+                                                                mm256_andnot_ps_(m, y.get())));
+}
+
+Intrinsics<double, IntrinsicsLevel::AVX>
+inline intrinsic_select_lt_(const Intrinsics<double, IntrinsicsLevel::AVX> &a,
+                            const Intrinsics<double, IntrinsicsLevel::AVX> &b,
+                            const Intrinsics<double, IntrinsicsLevel::AVX> &x,
+                            const Intrinsics<double, IntrinsicsLevel::AVX> &y)
+{
+    const __m256d m = mm256_cmp_pd_(a.get(), b.get(), _CMP_LT_OQ);
+    return Intrinsics<double, IntrinsicsLevel::AVX>(mm256_or_pd_(mm256_and_pd_(m, x.get()),
+                                                                 mm256_andnot_pd_(m, y.get())));
+}
+
+#endif // HAVE_AVX
+
+
+#ifdef HAVE_AVX2
+
+INTRINSICS_TARGET_AVX2
+
+//--- Select
+Intrinsics<float, IntrinsicsLevel::AVX2>
+inline intrinsic_select_lt_(const Intrinsics<float, IntrinsicsLevel::AVX2> &a,
+                            const Intrinsics<float, IntrinsicsLevel::AVX2> &b,
+                            const Intrinsics<float, IntrinsicsLevel::AVX2> &x,
+                            const Intrinsics<float, IntrinsicsLevel::AVX2> &y)
+{
+    const __m256 m = mm256_cmp_ps_(a.get(), b.get(), _CMP_LT_OQ);
+    return Intrinsics<float, IntrinsicsLevel::AVX2>(mm256_blendv_ps_(y.get(), x.get(), m));
+}
+
+Intrinsics<double, IntrinsicsLevel::AVX2>
+inline intrinsic_select_lt_(const Intrinsics<double, IntrinsicsLevel::AVX2> &a,
+                            const Intrinsics<double, IntrinsicsLevel::AVX2> &b,
+                            const Intrinsics<double, IntrinsicsLevel::AVX2> &x,
+                            const Intrinsics<double, IntrinsicsLevel::AVX2> &y)
+{
+    const __m256d m = mm256_cmp_pd_(a.get(), b.get(), _CMP_LT_OQ);
+    return Intrinsics<double, IntrinsicsLevel::AVX2>(mm256_blendv_pd_(y.get(), x.get(), m));
+}
+
+INTRINSICS_TARGET_END
+
+#endif // HAVE_AVX2
+
+
+#ifdef HAVE_AVX512
+
+INTRINSICS_TARGET_AVX512
+
+//--- Select
+Intrinsics<float, IntrinsicsLevel::AVX512>
+inline intrinsic_select_lt_(const Intrinsics<float, IntrinsicsLevel::AVX512> &a,
+                            const Intrinsics<float, IntrinsicsLevel::AVX512> &b,
+                            const Intrinsics<float, IntrinsicsLevel::AVX512> &x,
+                            const Intrinsics<float, IntrinsicsLevel::AVX512> &y)
+{
+    const __mmask16 m = mm512_cmp_ps_mask_(a.get(), b.get(), _CMP_LT_OQ);
+    return Intrinsics<float, IntrinsicsLevel::AVX512>(mm512_mask_blend_ps_(m, y.get(), x.get()));
+}
+
+Intrinsics<double, IntrinsicsLevel::AVX512>
+inline intrinsic_select_lt_(const Intrinsics<double, IntrinsicsLevel::AVX512> &a,
+                            const Intrinsics<double, IntrinsicsLevel::AVX512> &b,
+                            const Intrinsics<double, IntrinsicsLevel::AVX512> &x,
+                            const Intrinsics<double, IntrinsicsLevel::AVX512> &y)
+{
+    const __mmask8 m = mm512_cmp_pd_mask_(a.get(), b.get(), _CMP_LT_OQ);
+    return Intrinsics<double, IntrinsicsLevel::AVX512>(mm512_mask_blend_pd_(m, y.get(), x.get()));
+}
+
+INTRINSICS_TARGET_END
+
+#endif // HAVE_AVX512
+
+
+#endif // PLAYGROUND_CXXBLAS_INTRINSICS_CLASSES_FUNCTIONS_SELECT_TCC
@@ -0,0 +1,88 @@
+/*
+ *   Copyright (c) 2012, Klaus Pototzky
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PLAYGROUND_CXXBLAS_INTRINSICS_DISPATCH_DISPATCH_H
+#define PLAYGROUND_CXXBLAS_INTRINSICS_DISPATCH_DISPATCH_H 1
+
+#include <cxxblas/typedefs.h>
+#include <flens/auxiliary/isreal.h>
+#include <flens/auxiliary/restrictto.h>
+#include <playground/cxxblas/intrinsics/dispatch/intrinsicslevel.h>
+
+//
+//  Entry points for the real level 1, level 2 and gemm kernels.  Each
+//  dispatch_* function runs the kernel for IntrinsicsDispatch::level() and
+//  returns true.  If there is no kernel for this level (i.e. the level is
+//  not beyond DEFAULT_INTRINSIC_LEVEL) it returns false and the caller falls
+//  back to its own DEFAULT_INTRINSIC_LEVEL implementation.
+//
+
+namespace cxxblas {
+
+template <typename IndexType, typename T>
+    typename flens::RestrictTo<flens::IsReal<T>::value, bool>::Type
+    dispatch_axpy(IndexType n, const T &alpha, const T *x, T *y);
+
+template <typename IndexType, typename T>
+    typename flens::RestrictTo<flens::IsReal<T>::value, bool>::Type
+    dispatch_dot(IndexType n, const T *x, const T *y, T &result);
+
+template <typename IndexType, typename T>
+    typename flens::RestrictTo<flens::IsReal<T>::value, bool>::Type
+    dispatch_nrm2(IndexType n, const T *x, T &asml, T &amed, T &abig);
+
+template <typename IndexType, typename T>
+    typename flens::RestrictTo<flens::IsReal<T>::value, bool>::Type
+    dispatch_gemv_n(IndexType m, IndexType n,
+                    const T &alpha,
+                    const T *A, IndexType ldA,
+                    const T *x,
+                    T *y, IndexType incY);
+
+template <typename IndexType, typename T>
+    typename flens::RestrictTo<flens::IsReal<T>::value, bool>::Type
+    dispatch_gemv_t(IndexType m, IndexType n,
+                    const T &alpha,
+                    const T *A, IndexType ldA,
+                    const T *x, IndexType incX,
+                    T *y);
+
+template <int MR, typename IndexType, typename T>
+    typename flens::RestrictTo<flens::IsReal<T>::value, bool>::Type
+    dispatch_gemm(IndexType k,
+                  const T &alpha,
+                  const T *A, const T *B,
+                  T *C, IndexType ldC);
+
+} // namespace cxxblas
+
+#endif // PLAYGROUND_CXXBLAS_INTRINSICS_DISPATCH_DISPATCH_H
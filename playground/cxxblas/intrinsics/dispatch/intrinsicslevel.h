@@ -0,0 +1,87 @@
+/*
+ *   Copyright (c) 2012, Klaus Pototzky
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PLAYGROUND_CXXBLAS_INTRINSICS_DISPATCH_INTRINSICSLEVEL_H
+#define PLAYGROUND_CXXBLAS_INTRINSICS_DISPATCH_INTRINSICSLEVEL_H 1
+
+#include <playground/cxxblas/intrinsics/includes.h>
+
+//
+//  Selects the instruction set used by the real axpy, dot, gemv and gemm
+//  kernels at runtime.  Only AVX2 and AVX512 have kernels of their own, for
+//  any lower level the kernels of DEFAULT_INTRINSIC_LEVEL get used.
+//
+//  The level defaults to the best one supported by the host (cpuid) and
+//  compiled in (HAVE_AVX2, HAVE_AVX512).  On first use the environment is
+//  consulted:
+//
+//      CXXBLAS_INTRINSICS=<level>       SSE, AVX, AVX2 or AVX512
+//
+//  A level beyond what the host supports gets lowered to the host level.
+//
+
+namespace cxxblas {
+
+template <IntrinsicsLevel Level>
+struct IntrinsicsLevelTag
+{
+};
+
+class IntrinsicsDispatch
+{
+    public:
+        static IntrinsicsLevel
+        host();
+
+        static IntrinsicsLevel
+        level();
+
+        static void
+        setLevel(IntrinsicsLevel level);
+
+        static void
+        reset();
+
+        static const char *
+        name(IntrinsicsLevel level);
+
+    private:
+        static IntrinsicsLevel &
+        level_();
+
+        static IntrinsicsLevel
+        init_();
+};
+
+} // namespace cxxblas
+
+#endif // PLAYGROUND_CXXBLAS_INTRINSICS_DISPATCH_INTRINSICSLEVEL_H
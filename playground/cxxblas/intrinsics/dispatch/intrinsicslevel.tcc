@@ -0,0 +1,115 @@
+/*
+ *   Copyright (c) 2012, Klaus Pototzky
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PLAYGROUND_CXXBLAS_INTRINSICS_DISPATCH_INTRINSICSLEVEL_TCC
+#define PLAYGROUND_CXXBLAS_INTRINSICS_DISPATCH_INTRINSICSLEVEL_TCC 1
+
+#include <cxxstd/cstdlib.h>
+#include <cxxstd/cstring.h>
+#include <playground/cxxblas/intrinsics/dispatch/intrinsicslevel.h>
+
+namespace cxxblas {
+
+inline IntrinsicsLevel
+IntrinsicsDispatch::host()
+{
+#   if defined(WITH_INTRINSICS_DISPATCH)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) {
+        return IntrinsicsLevel::AVX512;
+    }
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+        return IntrinsicsLevel::AVX2;
+    }
+    return DEFAULT_INTRINSIC_LEVEL;
+#   elif defined(HAVE_AVX512)
+    return IntrinsicsLevel::AVX512;
+#   elif defined(HAVE_AVX2)
+    return IntrinsicsLevel::AVX2;
+#   else
+    return DEFAULT_INTRINSIC_LEVEL;
+#   endif
+}
+
+inline IntrinsicsLevel
+IntrinsicsDispatch::level()
+{
+    return level_();
+}
+
+inline void
+IntrinsicsDispatch::setLevel(IntrinsicsLevel level)
+{
+    const IntrinsicsLevel hostLevel = host();
+
+    level_() = (level>hostLevel) ? hostLevel : level;
+}
+
+inline void
+IntrinsicsDispatch::reset()
+{
+    level_() = host();
+}
+
+inline const char *
+IntrinsicsDispatch::name(IntrinsicsLevel level)
+{
+    static const char *names[] = { "NONE", "SSE", "AVX", "AVX2", "AVX512" };
+    return names[level];
+}
+
+inline IntrinsicsLevel &
+IntrinsicsDispatch::level_()
+{
+    static IntrinsicsLevel level = init_();
+    return level;
+}
+
+inline IntrinsicsLevel
+IntrinsicsDispatch::init_()
+{
+    const IntrinsicsLevel hostLevel = host();
+
+    const char *value = std::getenv("CXXBLAS_INTRINSICS");
+    if (value) {
+        for (int l=IntrinsicsLevel::NONE; l<hostLevel; ++l) {
+            if (std::strcmp(value, name(IntrinsicsLevel(l)))==0) {
+                return IntrinsicsLevel(l);
+            }
+        }
+    }
+    return hostLevel;
+}
+
+} // namespace cxxblas
+
+#endif // PLAYGROUND_CXXBLAS_INTRINSICS_DISPATCH_INTRINSICSLEVEL_TCC
@@ -0,0 +1,511 @@
+/*
+ *   Copyright (c) 2012, Klaus Pototzky
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+//
+//  No include guard: dispatch/kernels.tcc includes this file once per
+//  instruction set, inside the matching INTRINSICS_TARGET_* region and with
+//  INTRINSICS_KERNEL_LEVEL defined as the level.  Overloading on
+//  IntrinsicsLevelTag<INTRINSICS_KERNEL_LEVEL> keeps the versions apart.
+//
+//  The kernels use fused multiply-adds and handle the remainder of a loop
+//  with one masked load/store instead of a scalar loop.
+//
+
+namespace cxxblas {
+
+template <typename T>
+T
+kernel_sum(const Intrinsics<T, INTRINSICS_KERNEL_LEVEL> &x_)
+{
+    typedef Intrinsics<T, INTRINSICS_KERNEL_LEVEL> IntrinsicType;
+    const int numElements = IntrinsicType::numElements;
+
+    T tmp[numElements];
+    IntrinsicType(x_).storeu(tmp);
+
+    T result = T(0);
+    for (int k=0; k<numElements; ++k) {
+        result += tmp[k];
+    }
+    return result;
+}
+
+//
+//  y[0:n] += alpha*x[0:n]
+//
+template <typename IndexType, typename T>
+void
+kernel_axpy(IntrinsicsLevelTag<INTRINSICS_KERNEL_LEVEL>,
+            IndexType n, const T &alpha, const T *x, T *y)
+{
+    typedef Intrinsics<T, INTRINSICS_KERNEL_LEVEL> IntrinsicType;
+    const int numElements = IntrinsicType::numElements;
+
+    IntrinsicType alpha_(alpha), x0_, x1_, y0_, y1_;
+
+    IndexType i=0;
+    for (; i+2*numElements-1<n; i+=2*numElements) {
+        x0_.loadu(x+i);
+        x1_.loadu(x+i+numElements);
+        y0_.loadu(y+i);
+        y1_.loadu(y+i+numElements);
+
+        y0_ = intrinsic_fmadd_(alpha_, x0_, y0_);
+        y1_ = intrinsic_fmadd_(alpha_, x1_, y1_);
+
+        y0_.storeu(y+i);
+        y1_.storeu(y+i+numElements);
+    }
+    for (; i<n; i+=numElements) {
+        const int r = (n-i<numElements) ? int(n-i) : numElements;
+
+        x0_.loadu(x+i, r);
+        y0_.loadu(y+i, r);
+        y0_ = intrinsic_fmadd_(alpha_, x0_, y0_);
+        y0_.storeu(y+i, r);
+    }
+}
+
+//
+//  x[0:n]^T * y[0:n]
+//
+template <typename IndexType, typename T>
+T
+kernel_dot(IntrinsicsLevelTag<INTRINSICS_KERNEL_LEVEL>,
+           IndexType n, const T *x, const T *y)
+{
+    typedef Intrinsics<T, INTRINSICS_KERNEL_LEVEL> IntrinsicType;
+    const int numElements = IntrinsicType::numElements;
+
+    IntrinsicType x_, y_, s0_, s1_, s2_, s3_;
+
+    s0_.setZero();
+    s1_.setZero();
+    s2_.setZero();
+    s3_.setZero();
+
+    IndexType i=0;
+    for (; i+4*numElements-1<n; i+=4*numElements) {
+        x_.loadu(x+i);
+        y_.loadu(y+i);
+        s0_ = intrinsic_fmadd_(x_, y_, s0_);
+
+        x_.loadu(x+i+numElements);
+        y_.loadu(y+i+numElements);
+        s1_ = intrinsic_fmadd_(x_, y_, s1_);
+
+        x_.loadu(x+i+2*numElements);
+        y_.loadu(y+i+2*numElements);
+        s2_ = intrinsic_fmadd_(x_, y_, s2_);
+
+        x_.loadu(x+i+3*numElements);
+        y_.loadu(y+i+3*numElements);
+        s3_ = intrinsic_fmadd_(x_, y_, s3_);
+    }
+    for (; i<n; i+=numElements) {
+        const int r = (n-i<numElements) ? int(n-i) : numElements;
+
+        x_.loadu(x+i, r);
+        y_.loadu(y+i, r);
+        s0_ = intrinsic_fmadd_(x_, y_, s0_);
+    }
+    s0_ = intrinsic_add_(intrinsic_add_(s0_, s1_), intrinsic_add_(s2_, s3_));
+    return kernel_sum(s0_);
+}
+
+//
+//  Adds the squares of x[0:n] to the three accumulators of Blue's algorithm
+//  (see cxxblas/level1/nrm2.tcc).  Entries get sorted into the accumulators
+//  by selects, NaNs end up in the medium one.
+//
+template <typename T>
+void
+kernel_nrm2_add(const Intrinsics<T, INTRINSICS_KERNEL_LEVEL> &x_,
+                const Intrinsics<T, INTRINSICS_KERNEL_LEVEL> &tsml_,
+                const Intrinsics<T, INTRINSICS_KERNEL_LEVEL> &tbig_,
+                const Intrinsics<T, INTRINSICS_KERNEL_LEVEL> &ssml_,
+                const Intrinsics<T, INTRINSICS_KERNEL_LEVEL> &sbig_,
+                Intrinsics<T, INTRINSICS_KERNEL_LEVEL> &sml_,
+                Intrinsics<T, INTRINSICS_KERNEL_LEVEL> &med_,
+                Intrinsics<T, INTRINSICS_KERNEL_LEVEL> &big_)
+{
+    typedef Intrinsics<T, INTRINSICS_KERNEL_LEVEL> IntrinsicType;
+
+    IntrinsicType zero_, ax_, ys_, yb_, ym_;
+
+    zero_.setZero();
+    ax_ = intrinsic_abs_(x_);
+
+    ys_ = intrinsic_select_lt_(ax_, tsml_, intrinsic_mul_(ax_, ssml_), zero_);
+    yb_ = intrinsic_select_lt_(tbig_, ax_, intrinsic_mul_(ax_, sbig_), zero_);
+    ym_ = intrinsic_select_lt_(ax_, tsml_, zero_,
+                               intrinsic_select_lt_(tbig_, ax_, zero_, ax_));
+
+    sml_ = intrinsic_fmadd_(ys_, ys_, sml_);
+    big_ = intrinsic_fmadd_(yb_, yb_, big_);
+    med_ = intrinsic_fmadd_(ym_, ym_, med_);
+}
+
+template <typename IndexType, typename T>
+void
+kernel_nrm2(IntrinsicsLevelTag<INTRINSICS_KERNEL_LEVEL>,
+            IndexType n, const T *x, T &asml, T &amed, T &abig)
+{
+    typedef Intrinsics<T, INTRINSICS_KERNEL_LEVEL> IntrinsicType;
+    const int numElements = IntrinsicType::numElements;
+
+    const IntrinsicType tsml_(Nrm2Blue<T>::tsml()), tbig_(Nrm2Blue<T>::tbig());
+    const IntrinsicType ssml_(Nrm2Blue<T>::ssml()), sbig_(Nrm2Blue<T>::sbig());
+
+    IntrinsicType x0_, x1_, sml0_, sml1_, med0_, med1_, big0_, big1_;
+
+    sml0_.setZero();
+    sml1_.setZero();
+    med0_.setZero();
+    med1_.setZero();
+    big0_.setZero();
+    big1_.setZero();
+
+    IndexType i=0;
+    for (; i+2*numElements-1<n; i+=2*numElements) {
+        x0_.loadu(x+i);
+        x1_.loadu(x+i+numElements);
+
+        kernel_nrm2_add(x0_, tsml_, tbig_, ssml_, sbig_, sml0_, med0_, big0_);
+        kernel_nrm2_add(x1_, tsml_, tbig_, ssml_, sbig_, sml1_, med1_, big1_);
+    }
+    for (; i<n; i+=numElements) {
+        const int r = (n-i<numElements) ? int(n-i) : numElements;
+
+        x0_.loadu(x+i, r);
+        kernel_nrm2_add(x0_, tsml_, tbig_, ssml_, sbig_, sml0_, med0_, big0_);
+    }
+    asml += kernel_sum(intrinsic_add_(sml0_, sml1_));
+    amed += kernel_sum(intrinsic_add_(med0_, med1_));
+    abig += kernel_sum(intrinsic_add_(big0_, big1_));
+}
+
+//
+//  y[i*incY] += alpha * A[i*ldA+0:n]^T * x[0:n]  for i=0..m-1,
+//  i.e. the rows of A are contiguous (see gemv_real_n)
+//
+template <typename IndexType, typename T>
+void
+kernel_gemv_n(IntrinsicsLevelTag<INTRINSICS_KERNEL_LEVEL> tag,
+              IndexType m, IndexType n,
+              const T &alpha,
+              const T *A, IndexType ldA,
+              const T *x,
+              T *y, IndexType incY)
+{
+    typedef Intrinsics<T, INTRINSICS_KERNEL_LEVEL> IntrinsicType;
+    const int numElements = IntrinsicType::numElements;
+
+    IntrinsicType A0_, A1_, A2_, A3_, x_, y0_, y1_, y2_, y3_;
+
+    IndexType i=0;
+    for (; i+3<m; i+=4) {
+        const T *A0 = A+i*ldA;
+        const T *A1 = A0+ldA;
+        const T *A2 = A1+ldA;
+        const T *A3 = A2+ldA;
+
+        y0_.setZero();
+        y1_.setZero();
+        y2_.setZero();
+        y3_.setZero();
+
+        IndexType j=0;
+        for (; j+numElements-1<n; j+=numElements) {
+            x_.loadu(x+j);
+            A0_.loadu(A0+j);
+            A1_.loadu(A1+j);
+            A2_.loadu(A2+j);
+            A3_.loadu(A3+j);
+
+            y0_ = intrinsic_fmadd_(A0_, x_, y0_);
+            y1_ = intrinsic_fmadd_(A1_, x_, y1_);
+            y2_ = intrinsic_fmadd_(A2_, x_, y2_);
+            y3_ = intrinsic_fmadd_(A3_, x_, y3_);
+        }
+        if (j<n) {
+            const int r = int(n-j);
+
+            x_.loadu(x+j, r);
+            A0_.loadu(A0+j, r);
+            A1_.loadu(A1+j, r);
+            A2_.loadu(A2+j, r);
+            A3_.loadu(A3+j, r);
+
+            y0_ = intrinsic_fmadd_(A0_, x_, y0_);
+            y1_ = intrinsic_fmadd_(A1_, x_, y1_);
+            y2_ = intrinsic_fmadd_(A2_, x_, y2_);
+            y3_ = intrinsic_fmadd_(A3_, x_, y3_);
+        }
+        y[ i   *incY] += alpha*kernel_sum(y0_);
+        y[(i+1)*incY] += alpha*kernel_sum(y1_);
+        y[(i+2)*incY] += alpha*kernel_sum(y2_);
+        y[(i+3)*incY] += alpha*kernel_sum(y3_);
+    }
+    for (; i<m; ++i) {
+        y[i*incY] += alpha*kernel_dot(tag, n, A+i*ldA, x);
+    }
+}
+
+//
+//  y[0:n] += alpha * sum_j x[j*incX] * A[j*ldA+0:n]  for j=0..m-1,
+//  i.e. the columns of A are contiguous (see gemv_real_t)
+//
+template <typename IndexType, typename T>
+void
+kernel_gemv_t(IntrinsicsLevelTag<INTRINSICS_KERNEL_LEVEL> tag,
+              IndexType m, IndexType n,
+              const T &alpha,
+              const T *A, IndexType ldA,
+              const T *x, IndexType incX,
+              T *y)
+{
+    typedef Intrinsics<T, INTRINSICS_KERNEL_LEVEL> IntrinsicType;
+    const int numElements = IntrinsicType::numElements;
+
+    IntrinsicType A0_, A1_, A2_, A3_, x0_, x1_, x2_, x3_, y_;
+
+    IndexType j=0;
+    for (; j+3<m; j+=4) {
+        const T *A0 = A+j*ldA;
+        const T *A1 = A0+ldA;
+        const T *A2 = A1+ldA;
+        const T *A3 = A2+ldA;
+
+        x0_.fill(alpha*x[ j   *incX]);
+        x1_.fill(alpha*x[(j+1)*incX]);
+        x2_.fill(alpha*x[(j+2)*incX]);
+        x3_.fill(alpha*x[(j+3)*incX]);
+
+        IndexType i=0;
+        for (; i+numElements-1<n; i+=numElements) {
+            y_.loadu(y+i);
+            A0_.loadu(A0+i);
+            A1_.loadu(A1+i);
+            A2_.loadu(A2+i);
+            A3_.loadu(A3+i);
+
+            y_ = intrinsic_fmadd_(A0_, x0_, y_);
+            y_ = intrinsic_fmadd_(A1_, x1_, y_);
+            y_ = intrinsic_fmadd_(A2_, x2_, y_);
+            y_ = intrinsic_fmadd_(A3_, x3_, y_);
+
+            y_.storeu(y+i);
+        }
+        if (i<n) {
+            const int r = int(n-i);
+
+            y_.loadu(y+i, r);
+            A0_.loadu(A0+i, r);
+            A1_.loadu(A1+i, r);
+            A2_.loadu(A2+i, r);
+            A3_.loadu(A3+i, r);
+
+            y_ = intrinsic_fmadd_(A0_, x0_, y_);
+            y_ = intrinsic_fmadd_(A1_, x1_, y_);
+            y_ = intrinsic_fmadd_(A2_, x2_, y_);
+            y_ = intrinsic_fmadd_(A3_, x3_, y_);
+
+            y_.storeu(y+i, r);
+        }
+    }
+    for (; j<m; ++j) {
+        kernel_axpy(tag, n, T(alpha*x[j*incX]), A+j*ldA, y);
+    }
+}
+
+//
+//  Loads and stores of M<=numElements elements, masked if M<numElements
+//
+template <int M, typename T>
+void
+kernel_loadu(Intrinsics<T, INTRINSICS_KERNEL_LEVEL> &x_, const T *x)
+{
+    if (M==Intrinsics<T, INTRINSICS_KERNEL_LEVEL>::numElements) {
+        x_.loadu(x);
+    } else {
+        x_.loadu(x, M);
+    }
+}
+
+template <int M, typename T>
+void
+kernel_storeu(Intrinsics<T, INTRINSICS_KERNEL_LEVEL> &x_, T *x)
+{
+    if (M==Intrinsics<T, INTRINSICS_KERNEL_LEVEL>::numElements) {
+        x_.storeu(x);
+    } else {
+        x_.storeu(x, M);
+    }
+}
+
+//
+//  x[0:M] += alpha*c
+//
+template <int M, typename T>
+void
+kernel_update(const Intrinsics<T, INTRINSICS_KERNEL_LEVEL> &alpha_,
+              const Intrinsics<T, INTRINSICS_KERNEL_LEVEL> &c_,
+              T *x)
+{
+    Intrinsics<T, INTRINSICS_KERNEL_LEVEL> x_;
+
+    kernel_loadu<M>(x_, x);
+    x_ = intrinsic_fmadd_(alpha_, c_, x_);
+    kernel_storeu<M>(x_, x);
+}
+
+//
+//  C[0:MR,0:4] += alpha*A*B with A packed as MR elements per p and B packed
+//  as 4 elements per p (see packmatrix.h).  MR=2*numElements of
+//  DEFAULT_INTRINSIC_LEVEL, so a column of C takes at most two registers, the
+//  last one gets masked if MR is not a multiple of numElements.
+//
+template <int MR, typename IndexType, typename T>
+void
+kernel_gemm(IntrinsicsLevelTag<INTRINSICS_KERNEL_LEVEL>,
+            IndexType k,
+            const T &alpha,
+            const T *A, const T *B,
+            T *C, IndexType ldC)
+{
+    typedef Intrinsics<T, INTRINSICS_KERNEL_LEVEL> IntrinsicType;
+    const int numElements = IntrinsicType::numElements;
+    const int M0          = (MR<numElements) ? MR : numElements;
+    const int M1          = MR-M0;
+
+    static_assert(M1<=numElements, "MR exceeds two registers");
+
+    IntrinsicType  a0_, a1_, b0_, b1_, b2_, b3_,
+                   c00_, c01_, c02_, c03_,
+                   c10_, c11_, c12_, c13_;
+
+    c00_.setZero();
+    c01_.setZero();
+    c02_.setZero();
+    c03_.setZero();
+    c10_.setZero();
+    c11_.setZero();
+    c12_.setZero();
+    c13_.setZero();
+
+    IndexType p=0;
+    if (M1>0) {
+        for (; p<k; ++p, A+=MR, B+=4) {
+            kernel_loadu<M0>(a0_, A);
+            kernel_loadu<M1>(a1_, A+M0);
+
+            b0_.fill(B[0]);
+            b1_.fill(B[1]);
+            b2_.fill(B[2]);
+            b3_.fill(B[3]);
+
+            c00_ = intrinsic_fmadd_(a0_, b0_, c00_);
+            c01_ = intrinsic_fmadd_(a0_, b1_, c01_);
+            c02_ = intrinsic_fmadd_(a0_, b2_, c02_);
+            c03_ = intrinsic_fmadd_(a0_, b3_, c03_);
+
+            c10_ = intrinsic_fmadd_(a1_, b0_, c10_);
+            c11_ = intrinsic_fmadd_(a1_, b1_, c11_);
+            c12_ = intrinsic_fmadd_(a1_, b2_, c12_);
+            c13_ = intrinsic_fmadd_(a1_, b3_, c13_);
+        }
+    } else {
+        //
+        //  A column of C fits into one register.  Two steps in p at once
+        //  keep eight independent accumulators busy.
+        //
+        for (; p+1<k; p+=2, A+=2*MR, B+=8) {
+            kernel_loadu<M0>(a0_, A);
+            kernel_loadu<M0>(a1_, A+MR);
+
+            b0_.fill(B[0]);
+            b1_.fill(B[1]);
+            b2_.fill(B[2]);
+            b3_.fill(B[3]);
+
+            c00_ = intrinsic_fmadd_(a0_, b0_, c00_);
+            c01_ = intrinsic_fmadd_(a0_, b1_, c01_);
+            c02_ = intrinsic_fmadd_(a0_, b2_, c02_);
+            c03_ = intrinsic_fmadd_(a0_, b3_, c03_);
+
+            b0_.fill(B[4]);
+            b1_.fill(B[5]);
+            b2_.fill(B[6]);
+            b3_.fill(B[7]);
+
+            c10_ = intrinsic_fmadd_(a1_, b0_, c10_);
+            c11_ = intrinsic_fmadd_(a1_, b1_, c11_);
+            c12_ = intrinsic_fmadd_(a1_, b2_, c12_);
+            c13_ = intrinsic_fmadd_(a1_, b3_, c13_);
+        }
+        if (p<k) {
+            kernel_loadu<M0>(a0_, A);
+
+            b0_.fill(B[0]);
+            b1_.fill(B[1]);
+            b2_.fill(B[2]);
+            b3_.fill(B[3]);
+
+            c00_ = intrinsic_fmadd_(a0_, b0_, c00_);
+            c01_ = intrinsic_fmadd_(a0_, b1_, c01_);
+            c02_ = intrinsic_fmadd_(a0_, b2_, c02_);
+            c03_ = intrinsic_fmadd_(a0_, b3_, c03_);
+        }
+        c00_ = intrinsic_add_(c00_, c10_);
+        c01_ = intrinsic_add_(c01_, c11_);
+        c02_ = intrinsic_add_(c02_, c12_);
+        c03_ = intrinsic_add_(c03_, c13_);
+    }
+
+    IntrinsicType alpha_(alpha);
+
+    kernel_update<M0>(alpha_, c00_, C);
+    kernel_update<M0>(alpha_, c01_, C+ldC);
+    kernel_update<M0>(alpha_, c02_, C+2*ldC);
+    kernel_update<M0>(alpha_, c03_, C+3*ldC);
+
+    if (M1>0) {
+        kernel_update<M1>(alpha_, c10_, C+M0);
+        kernel_update<M1>(alpha_, c11_, C+M0+ldC);
+        kernel_update<M1>(alpha_, c12_, C+M0+2*ldC);
+        kernel_update<M1>(alpha_, c13_, C+M0+3*ldC);
+    }
+}
+
+} // namespace cxxblas
@@ -34,11 +34,82 @@
 #define PLAYGROUND_CXXBLAS_INTRINSICS_INCLUDES_H 1
 
 enum IntrinsicsLevel {
-    AVX  = 2,
-    SSE  = 1,
-    NONE = 0
+    AVX512 = 4,
+    AVX2   = 3,
+    AVX    = 2,
+    SSE    = 1,
+    NONE   = 0
 };
 
+//
+//  AVX2 (with FMA) and AVX-512 are only used for the real level 1, level 2
+//  and gemm kernels in playground/cxxblas/intrinsics/dispatch, the other
+//  routines keep using DEFAULT_INTRINSIC_LEVEL.
+//
+//  With WITH_INTRINSICS_DISPATCH the AVX2 and AVX-512 kernels get compiled
+//  for their instruction set through target pragmas, independent of the
+//  compiler flags.  The kernels get selected at runtime from cpuid, so one
+//  binary runs on all hosts (see dispatch/intrinsicslevel.h).  The baseline
+//  is SSE (with SSE3) or AVX, whatever WITH_SSE/WITH_AVX selects.
+//
+#ifdef WITH_INTRINSICS_DISPATCH
+#   ifndef HAVE_AVX512
+#       define HAVE_AVX512
+#   endif
+#   ifndef HAVE_AVX2
+#       define HAVE_AVX2
+#   endif
+#   ifndef WITH_AVX
+#       ifndef WITH_SSE
+#           define WITH_SSE
+#       endif
+#   endif
+#   include <immintrin.h>
+#   if defined(__clang__)
+#       define INTRINSICS_TARGET_AVX2                                        \
+            _Pragma("clang attribute push(__attribute__((target("           \
+                    "\"avx2,fma\"))), apply_to=function)")
+#       define INTRINSICS_TARGET_AVX512                                      \
+            _Pragma("clang attribute push(__attribute__((target("           \
+                    "\"avx512f,avx2,fma\"))), apply_to=function)")
+#       define INTRINSICS_TARGET_END                                         \
+            _Pragma("clang attribute pop")
+#   else
+#       define INTRINSICS_TARGET_AVX2                                        \
+            _Pragma("GCC push_options")                                      \
+            _Pragma("GCC target(\"avx2,fma\")")
+#       define INTRINSICS_TARGET_AVX512                                      \
+            _Pragma("GCC push_options")                                      \
+            _Pragma("GCC target(\"avx512f,avx2,fma\")")
+#       define INTRINSICS_TARGET_END                                         \
+            _Pragma("GCC pop_options")
+#   endif
+#endif
+
+#ifdef WITH_AVX512
+#   ifndef HAVE_AVX512
+#       define HAVE_AVX512
+#   endif
+#   ifndef WITH_AVX2
+#       define WITH_AVX2
+#   endif
+#endif
+
+#ifdef WITH_AVX2
+#   ifndef HAVE_AVX2
+#       define HAVE_AVX2
+#   endif
+#   ifndef WITH_AVX
+#       define WITH_AVX
+#   endif
+#endif
+
+#ifndef INTRINSICS_TARGET_AVX2
+#   define INTRINSICS_TARGET_AVX2
+#   define INTRINSICS_TARGET_AVX512
+#   define INTRINSICS_TARGET_END
+#endif
+
 #ifdef WITH_AVX
 #   ifndef HAVE_AVX
 #       define HAVE_AVX
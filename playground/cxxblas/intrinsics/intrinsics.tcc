@@ -37,6 +37,7 @@
 
 #include <playground/cxxblas/intrinsics/auxiliary/auxiliary.tcc>
 #include <playground/cxxblas/intrinsics/classes/classes.tcc>
+#include <playground/cxxblas/intrinsics/dispatch/dispatch.tcc>
 
 #include <playground/cxxblas/intrinsics/level1/level1.tcc>
 #include <playground/cxxblas/intrinsics/level1extensions/level1extensions.tcc>
@@ -35,6 +35,7 @@
 
 #include <cxxblas/cxxblas.h>
 #include <playground/cxxblas/intrinsics/auxiliary/auxiliary.h>
+#include <playground/cxxblas/intrinsics/dispatch/dispatch.h>
 #include <playground/cxxblas/intrinsics/includes.h>
 #include <playground/cxxblas/intrinsics/level1/axpy.h>
 
@@ -55,6 +56,13 @@ axpy(IndexType n, const T &alpha, const T *x,
         return;
 
     if (incX==1 && incY==1) {
+        CXXBLAS_PROFILE_SCOPE("axpy", ProfileIntrinsics, n, 2.*n,
+                              3.*n*sizeof(T));
+
+        if (dispatch_axpy(n, alpha, x, y)) {
+            return;
+        }
+
         typedef Intrinsics<T, DEFAULT_INTRINSIC_LEVEL> IntrinsicType;
         const int numElements = IntrinsicType::numElements;
 
@@ -101,6 +109,8 @@ axpy(IndexType n, const T &alpha, const T *x,
         return;
 
     if (incX==1 && incY==1) {
+        CXXBLAS_PROFILE_SCOPE("axpy", ProfileIntrinsics, n, 8.*n,
+                              3.*n*sizeof(T));
 
         if (imag(alpha)==PT(0)) {
             axpy(2*n, real(alpha),
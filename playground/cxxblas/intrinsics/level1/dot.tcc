@@ -35,6 +35,7 @@
 
 #include <cxxblas/cxxblas.h>
 #include <playground/cxxblas/intrinsics/auxiliary/auxiliary.h>
+#include <playground/cxxblas/intrinsics/dispatch/dispatch.h>
 #include <playground/cxxblas/intrinsics/includes.h>
 
 namespace cxxblas {
@@ -52,10 +53,19 @@ dotu(IndexType n,
 {
     CXXBLAS_DEBUG_OUT("dotu_intrinsic [real, " INTRINSIC_NAME "]");
 
+    if (Reproducible::enabled()) {
+        dotu_reproducible(n, x, incX, y, incY, result);
+        return;
+    }
+
     if (incX==1 && incY==1) {
 
         result = T(0);
 
+        if (dispatch_dot(n, x, y, result)) {
+            return;
+        }
+
         typedef Intrinsics<T, DEFAULT_INTRINSIC_LEVEL> IntrinsicType;
         const int numElements = IntrinsicType::numElements;
 
@@ -102,6 +112,11 @@ dotu(IndexType n,
 
     CXXBLAS_DEBUG_OUT("dotu_intrinsic [complex, " INTRINSIC_NAME "]");
 
+    if (Reproducible::enabled()) {
+        dotu_reproducible(n, x, incX, y, incY, result);
+        return;
+    }
+
     if (incX==1 && incY==1) {
 
         result = T(0);
@@ -179,6 +194,11 @@ dot(IndexType n,
 {
     CXXBLAS_DEBUG_OUT("dot_intrinsic [complex, " INTRINSIC_NAME "]");
 
+    if (Reproducible::enabled()) {
+        dot_reproducible(n, x, incX, y, incY, result);
+        return;
+    }
+
     using std::conj;
 
     result = T(0);
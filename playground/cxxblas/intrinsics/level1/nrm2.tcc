@@ -0,0 +1,120 @@
+/*
+ *   Copyright (c) 2012, Klaus Pototzky
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef PLAYGROUND_CXXBLAS_INTRINSICS_LEVEL1_NRM2_TCC
+#define PLAYGROUND_CXXBLAS_INTRINSICS_LEVEL1_NRM2_TCC 1
+
+#include <cxxblas/cxxblas.h>
+#include <playground/cxxblas/intrinsics/auxiliary/auxiliary.h>
+#include <playground/cxxblas/intrinsics/dispatch/dispatch.h>
+#include <playground/cxxblas/intrinsics/includes.h>
+
+namespace cxxblas {
+
+#ifdef USE_INTRINSIC
+
+template <typename IndexType, typename T>
+typename flens::RestrictTo<flens::IsReal<T>::value &&
+                           flens::IsIntrinsicsCompatible<T>::value,
+                           void>::Type
+nrm2_blue(IndexType n, const T *x, IndexType incX,
+          T &asml, T &amed, T &abig)
+{
+    CXXBLAS_DEBUG_OUT("nrm2_blue_intrinsic [real, " INTRINSIC_NAME "]");
+
+    if (incX==1) {
+
+        if (dispatch_nrm2(n, x, asml, amed, abig)) {
+            return;
+        }
+
+        typedef Intrinsics<T, DEFAULT_INTRINSIC_LEVEL> IntrinsicType;
+        const int numElements = IntrinsicType::numElements;
+
+        const IntrinsicType tsml_(Nrm2Blue<T>::tsml());
+        const IntrinsicType tbig_(Nrm2Blue<T>::tbig());
+        const IntrinsicType ssml_(Nrm2Blue<T>::ssml());
+        const IntrinsicType sbig_(Nrm2Blue<T>::sbig());
+
+        IntrinsicType zero_, x_, ys_, yb_, ym_;
+        IntrinsicType sml_, med_, big_;
+
+        zero_.setZero();
+        sml_.setZero();
+        med_.setZero();
+        big_.setZero();
+
+        IndexType i=0;
+
+        for (; i+numElements-1<n; i+=numElements) {
+            x_.loadu(x+i);
+            x_ = intrinsic_abs_(x_);
+
+            ys_ = intrinsic_select_lt_(x_, tsml_, intrinsic_mul_(x_, ssml_),
+                                       zero_);
+            yb_ = intrinsic_select_lt_(tbig_, x_, intrinsic_mul_(x_, sbig_),
+                                       zero_);
+            ym_ = intrinsic_select_lt_(x_, tsml_, zero_,
+                                       intrinsic_select_lt_(tbig_, x_,
+                                                            zero_, x_));
+
+            sml_ = intrinsic_add_(sml_, intrinsic_mul_(ys_, ys_));
+            big_ = intrinsic_add_(big_, intrinsic_mul_(yb_, yb_));
+            med_ = intrinsic_add_(med_, intrinsic_mul_(ym_, ym_));
+        }
+
+        T tmp[3][numElements];
+        sml_.storeu(tmp[0]);
+        med_.storeu(tmp[1]);
+        big_.storeu(tmp[2]);
+
+        for (IndexType k=0; k<numElements; ++k) {
+            asml += tmp[0][k];
+            amed += tmp[1][k];
+            abig += tmp[2][k];
+        }
+
+        cxxblas::nrm2_blue<IndexType, T, T>(n-i, x+i, incX, asml, amed, abig);
+
+    } else {
+
+        cxxblas::nrm2_blue<IndexType, T, T>(n, x, incX, asml, amed, abig);
+
+    }
+}
+
+#endif // USE_INTRINSIC
+
+} // namespace cxxblas
+
+#endif // PLAYGROUND_CXXBLAS_INTRINSICS_LEVEL1_NRM2_TCC
@@ -51,7 +51,7 @@ acxpby(IndexType n, const T &alpha, const T *x,
 {
     CXXBLAS_DEBUG_OUT("acxpby_intrinsics [real, " INTRINSIC_NAME "]");
 
-    cxxblas::axpy(n, alpha, x, incX, beta, y, incY);
+    cxxblas::axpby(n, alpha, x, incX, beta, y, incY);
 
 }
 
@@ -139,8 +139,8 @@ acxpby(IndexType n, const T &alpha, const T *x,
 
     } else {
 
-        cxxblas::acxpby<IndexType, T, T, T ,T>(n, alpha, x, incX, beta,
-                                               y, incY);
+        cxxblas::acxpby<IndexType, T, const T *, T, T *>(n, alpha, x, incX,
+                                                         beta, y, incY);
 
     }
 }
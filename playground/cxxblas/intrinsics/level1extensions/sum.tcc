@@ -48,6 +48,11 @@ sum(IndexType n, const T *y, IndexType incY, T &sum)
 {
     CXXBLAS_DEBUG_OUT("sum_intrinsics [real, " INTRINSIC_NAME "]");
 
+    if (Reproducible::enabled()) {
+        sum_reproducible(n, y, incY, sum);
+        return;
+    }
+
     if (incY==1) {
         typedef Intrinsics<T, DEFAULT_INTRINSIC_LEVEL> IntrinsicType;
         const int numElements = IntrinsicType::numElements;
@@ -62,7 +67,13 @@ sum(IndexType n, const T *y, IndexType incY, T &sum)
             y_.loadu(y+i);
             sum_ = intrinsic_add_(sum_, y_);
         }
-        sum_.storeu(&sum);
+        T tmp_sum[numElements];
+        sum_.storeu(tmp_sum);
+
+        sum = T(0);
+        for (IndexType k=0; k<numElements; ++k) {
+            sum += tmp_sum[k];
+        }
 
         for (;i<n;++i) {
             sum += y[i];
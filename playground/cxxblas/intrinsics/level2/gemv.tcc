@@ -35,6 +35,7 @@
 
 #include <cxxblas/cxxblas.h>
 #include <playground/cxxblas/intrinsics/auxiliary/auxiliary.h>
+#include <playground/cxxblas/intrinsics/dispatch/dispatch.h>
 #include <playground/cxxblas/intrinsics/includes.h>
 
 namespace cxxblas {
@@ -64,6 +65,10 @@ template <typename IndexType, typename T>
         y -= incY*(m-1);
     }
 
+    if (dispatch_gemv_n(m, n, alpha, A, ldA, x, y, incY)) {
+        return;
+    }
+
     IndexType i=0;
     IndexType iY=0;
 
@@ -179,6 +184,10 @@ template <typename IndexType, typename T>
         x -= incX*(m-1);
     }
 
+    if (dispatch_gemv_t(m, n, alpha, A, ldA, x, incX, y)) {
+        return;
+    }
+
     IndexType j=0, jX=0;
 
     for (; j+3<m; j+=4, jX+=4*incX) {
@@ -745,11 +754,13 @@ template <typename IndexType, typename T>
     }
 
     if  ((transA==NoTrans || transA==Conj) && incX==1 ) {
-
+        CXXBLAS_PROFILE_SCOPE("gemv", ProfileIntrinsics, long(m)*n, 2.*m*n,
+                              (double(m)*n+m+n)*sizeof(T));
         gemv_real_n(m, n, alpha, A, ldA, x, 1, beta, y, incY);
 
     } else if ((transA==Trans || transA==ConjTrans) && incY==1 ) {
-
+        CXXBLAS_PROFILE_SCOPE("gemv", ProfileIntrinsics, long(m)*n, 2.*m*n,
+                              (double(m)*n+m+n)*sizeof(T));
         gemv_real_t(m, n, alpha, A, ldA, x, incX, beta, y, 1);
 
     } else {
@@ -780,19 +791,23 @@ template <typename IndexType, typename T>
     }
 
     if  ( transA==NoTrans && incX==1 ) {
-
+        CXXBLAS_PROFILE_SCOPE("gemv", ProfileIntrinsics, long(m)*n, 8.*m*n,
+                              (double(m)*n+m+n)*sizeof(T));
         gemv_complex_n(m, n, alpha, A, ldA, x, 1, beta, y, incY);
 
     } else if ( transA==Conj && incX==1 ) {
-
+        CXXBLAS_PROFILE_SCOPE("gemv", ProfileIntrinsics, long(m)*n, 8.*m*n,
+                              (double(m)*n+m+n)*sizeof(T));
         gemv_complex_c(m, n, alpha, A, ldA, x, 1, beta, y, incY);
 
     } else if ( transA==Trans && incY==1 ) {
-
+        CXXBLAS_PROFILE_SCOPE("gemv", ProfileIntrinsics, long(m)*n, 8.*m*n,
+                              (double(m)*n+m+n)*sizeof(T));
         gemv_complex_t(m, n, alpha, A, ldA, x, incX, beta, y, 1);
 
     } else if ( transA==ConjTrans && incY==1 ) {
-
+        CXXBLAS_PROFILE_SCOPE("gemv", ProfileIntrinsics, long(m)*n, 8.*m*n,
+                              (double(m)*n+m+n)*sizeof(T));
         gemv_complex_ct(m, n, alpha, A, ldA, x, incX, beta, y, 1);
 
     } else {
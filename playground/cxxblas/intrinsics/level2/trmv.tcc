@@ -1596,7 +1596,7 @@ trmv(StorageOrder order, StorageUpLo upLo,
 
     if ( incX != 1) {
 
-        cxxblas::trmv<IndexType, T, T>(RowMajor, Upper, transA, diag, n,
+        cxxblas::trmv<IndexType, T, T>(RowMajor, upLo, transA, diag, n,
                                        A, ldA, x, incX);
         return;
 
@@ -1650,7 +1650,7 @@ trmv(StorageOrder order, StorageUpLo upLo,
 
     if ( incX != 1) {
 
-        cxxblas::trmv<IndexType, T, T>(RowMajor, Upper, transA, diag, n,
+        cxxblas::trmv<IndexType, T, T>(RowMajor, upLo, transA, diag, n,
                                        A, ldA, x, incX);
         return;
 
@@ -1493,7 +1493,7 @@ trsv(StorageOrder order, StorageUpLo upLo,
 
     if ( incX != 1) {
 
-        cxxblas::trsv<IndexType, T, T>(RowMajor, Upper, transA, diag, n, A, ldA,
+        cxxblas::trsv<IndexType, T, T>(RowMajor, upLo, transA, diag, n, A, ldA,
                                        x, incX);
         return;
 
@@ -1547,7 +1547,7 @@ trsv(StorageOrder order, StorageUpLo upLo,
 
     if ( incX != 1) {
 
-        cxxblas::trsv<IndexType, T, T>(RowMajor, Upper, transA, diag, n, A, ldA,
+        cxxblas::trsv<IndexType, T, T>(RowMajor, upLo, transA, diag, n, A, ldA,
                                        x, incX);
         return;
 
@@ -34,23 +34,14 @@
 #define PLAYGROUND_CXXBLAS_INTRINSICS_LEVEL3_GEMM_H 1
 
 #include <playground/cxxblas/intrinsics/level3/gemm/packmatrix.h>
-#include <playground/cxxblas/intrinsics/level3/gemm/subgemm.h>
 #include <playground/cxxblas/intrinsics/level3/gemm/kernelgemm.h>
+#include <playground/cxxblas/intrinsics/level3/gemm/operand.h>
+#include <playground/cxxblas/intrinsics/level3/gemm/driver.h>
 
 namespace cxxblas {
 
 #ifdef USE_INTRINSIC
 
-
-/* Block sizes */
-#ifndef BLOCKSIZE_GEMM_M
-#   define BLOCKSIZE_GEMM_M 256
-#endif
-
-#ifndef BLOCKSIZE_GEMM_K
-#   define BLOCKSIZE_GEMM_K 128
-#endif
-
 template <typename IndexType, typename T, typename MA, typename MB>
     typename flens::RestrictTo<flens::IsIntrinsicsCompatible<T>::value &&
                                flens::IsIntrinsicsCompatible<MA>::value &&
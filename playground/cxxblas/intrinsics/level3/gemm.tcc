@@ -50,8 +50,9 @@
 #define PLAYGROUND_CXXBLAS_INTRINSICS_LEVEL3_GEMM_TCC 1
 
 #include <playground/cxxblas/intrinsics/level3/gemm/packmatrix.tcc>
-#include <playground/cxxblas/intrinsics/level3/gemm/subgemm.tcc>
 #include <playground/cxxblas/intrinsics/level3/gemm/kernelgemm.tcc>
+#include <playground/cxxblas/intrinsics/level3/gemm/operand.tcc>
+#include <playground/cxxblas/intrinsics/level3/gemm/driver.tcc>
 
 namespace cxxblas {
 
@@ -75,8 +76,6 @@ gemm(StorageOrder order, Transpose transA, Transpose transB,
 {
     CXXBLAS_DEBUG_OUT("gemm_intrinsics [" INTRINSIC_NAME "]");
 
-    using std::min;
-
     if ((m==0) || (n==0)) {
         return;
     }
@@ -90,240 +89,19 @@ gemm(StorageOrder order, Transpose transA, Transpose transB,
         return;
     }
 
-    cxxblas::gescal(cxxblas::StorageOrder::ColMajor, m, n, beta, C, ldC);
-
-    IndexType kc = BLOCKSIZE_GEMM_K;
-    IndexType mc = BLOCKSIZE_GEMM_M;
-
-    // Allocate memory
-    MA *packedA = new MA[ min(k,kc) * min(m,mc) ];
-    MB *packedB = new MB[ min(k,kc) * n ];
-
-    if ( transA==NoTrans ) {
-
-        if ( transB==NoTrans ) {
-
-            for ( IndexType p=0; p<k; p+=kc ){
-                IndexType pb = min( k-p, kc );
-
-                for (IndexType i=0; i<m; i+=mc ){
-                    IndexType ib = min( m-i, mc );
-                    sub_gemm_n_n(ib, n, pb, alpha, A+i+p*ldA, ldA,
-                                 B+p, ldB, T(1), C+i, ldC,
-                                 packedA, packedB, i==0);
-                }
-            }
-
-        } else if ( transB==Conj ) {
-
-            for ( IndexType p=0; p<k; p+=kc ){
-                IndexType pb = min( k-p, kc );
-
-                for (IndexType i=0; i<m; i+=mc ){
-                    IndexType ib = min( m-i, mc );
-                    sub_gemm_n_c(ib, n, pb, alpha, A+i+p*ldA, ldA,
-                                 B+p, ldB, T(1), C+i, ldC,
-                                 packedA, packedB, i==0 );
-                }
-            }
-
-        } else if ( transB==Trans ) {
-
-            for ( IndexType p=0; p<k; p+=kc ){
-                IndexType pb = min( k-p, kc );
-
-                for (IndexType i=0; i<m; i+=mc ){
-                    IndexType ib = min( m-i, mc );
-                    sub_gemm_n_t(ib, n, pb, alpha, A+i+p*ldA, ldA,
-                                 B+p*ldB, ldB, T(1), C+i, ldC,
-                                 packedA, packedB, i==0);
-                }
-            }
-
-        } else if ( transB==ConjTrans ) {
-
-            for ( IndexType p=0; p<k; p+=kc ){
-                IndexType pb = min( k-p, kc );
-
-                for (IndexType i=0; i<m; i+=mc ){
-                    IndexType ib = min( m-i, mc );
-                    sub_gemm_n_ct(ib, n, pb, alpha, A+i+p*ldA, ldA,
-                                  B+p*ldB, ldB, T(1), C+i, ldC,
-                                  packedA, packedB, i==0);
-                }
-            }
-
-        }
-
-    } else if ( transA==Conj ) {
-
-        if ( transB==NoTrans || transB==Conj ) {
-
-            for ( IndexType p=0; p<k; p+=kc ){
-                IndexType pb = min( k-p, kc );
-
-                for (IndexType i=0; i<m; i+=mc ){
-                    IndexType ib = min( m-i, mc );
-                    sub_gemm_c_n(ib, n, pb, alpha, A+i+p*ldA, ldA,
-                                 B+p, ldB, T(1), C+i, ldC,
-                                 packedA, packedB, i==0);
-                }
-            }
-
-        } else if ( transB==Conj ) {
-
-            for ( IndexType p=0; p<k; p+=kc ){
-                IndexType pb = min( k-p, kc );
-
-                for (IndexType i=0; i<m; i+=mc ){
-                    IndexType ib = min( m-i, mc );
-                    sub_gemm_c_c(ib, n, pb, alpha, A+i+p*ldA, ldA,
-                                 B+p, ldB, T(1), C+i, ldC,
-                                 packedA, packedB, i==0);
-                }
-            }
-
-        } else if ( transB==Trans ) {
-
-            for ( IndexType p=0; p<k; p+=kc ){
-                IndexType pb = min( k-p, kc );
-
-                for (IndexType i=0; i<m; i+=mc ){
-                    IndexType ib = min( m-i, mc );
-                    sub_gemm_c_t(ib, n, pb, alpha, A+i+p*ldA, ldA,
-                                 B+p*ldB, ldB, T(1), C+i, ldC,
-                                 packedA, packedB, i==0);
-                }
-            }
-
-        } else if ( transB==ConjTrans ) {
+    CXXBLAS_PROFILE_SCOPE("gemm", ProfileIntrinsics, long(m)*n*k,
+                          (flens::IsComplex<T>::value ? 8. : 2.)*m*n*k,
+                          (double(k)*(m+n)+2.*m*n)*sizeof(T));
 
-            for ( IndexType p=0; p<k; p+=kc ){
-                IndexType pb = min( k-p, kc );
-
-                for (IndexType i=0; i<m; i+=mc ){
-                    IndexType ib = min( m-i, mc );
-                    sub_gemm_c_ct(ib, n, pb, alpha, A+i+p*ldA, ldA,
-                                  B+p*ldB, ldB, T(1), C+i, ldC,
-                                  packedA, packedB, i==0);
-                }
-            }
-
-        }
-
-    } else if ( transA==Trans ) {
-
-        if ( transB==NoTrans ) {
-
-            for ( IndexType p=0; p<k; p+=kc ){
-                IndexType pb = min( k-p, kc );
-
-                for (IndexType i=0; i<m; i+=mc ){
-                    IndexType ib = min( m-i, mc );
-                    sub_gemm_t_n(ib, n, pb, alpha, A+p+i*ldA, ldA,
-                                 B+p, ldB, T(1), C+i, ldC,
-                                 packedA, packedB, i==0);
-                }
-            }
-
-        } else if ( transB==Conj ) {
-
-            for ( IndexType p=0; p<k; p+=kc ){
-                IndexType pb = min( k-p, kc );
-
-                for (IndexType i=0; i<m; i+=mc ){
-                    IndexType ib = min( m-i, mc );
-                    sub_gemm_t_c(ib, n, pb, alpha, A+p+i*ldA, ldA,
-                                 B+p, ldB, T(1), C+i, ldC,
-                                 packedA, packedB, i==0);
-                }
-            }
-
-        } else if ( transB==Trans ) {
-
-            for ( IndexType p=0; p<k; p+=kc ){
-                IndexType pb = min( k-p, kc );
-
-                for (IndexType i=0; i<m; i+=mc ){
-                    IndexType ib = min( m-i, mc );
-                    sub_gemm_t_t(ib, n, pb, alpha, A+p+i*ldA, ldA,
-                                 B+p*ldB, ldB, T(1), C+i, ldC,
-                                 packedA, packedB, i==0);
-                }
-            }
-        } else if ( transB==ConjTrans ) {
-
-            for ( IndexType p=0; p<k; p+=kc ){
-                IndexType pb = min( k-p, kc );
-
-                for (IndexType i=0; i<m; i+=mc ){
-                    IndexType ib = min( m-i, mc );
-                    sub_gemm_t_ct(ib, n, pb, alpha, A+p+i*ldA, ldA,
-                                  B+p*ldB, ldB, T(1), C+i, ldC,
-                                  packedA, packedB, i==0);
-                }
-            }
-        }
-
-    } else if ( transA==ConjTrans ) {
-
-        if ( transB==NoTrans ) {
-
-            for ( IndexType p=0; p<k; p+=kc ){
-                IndexType pb = min( k-p, kc );
-
-                for (IndexType i=0; i<m; i+=mc ){
-                    IndexType ib = min( m-i, mc );
-                    sub_gemm_ct_n(ib, n, pb, alpha, A+p+i*ldA, ldA,
-                                  B+p, ldB, T(1), C+i, ldC,
-                                  packedA, packedB, i==0);
-                }
-            }
-
-        } else if ( transB==Conj ) {
-
-            for ( IndexType p=0; p<k; p+=kc ){
-                IndexType pb = min( k-p, kc );
-
-                for (IndexType i=0; i<m; i+=mc ){
-                    IndexType ib = min( m-i, mc );
-                    sub_gemm_ct_c(ib, n, pb, alpha, A+p+i*ldA, ldA,
-                                  B+p, ldB, T(1), C+i, ldC,
-                                  packedA, packedB, i==0);
-                }
-            }
-
-        } else if ( transB==Trans ) {
-
-            for ( IndexType p=0; p<k; p+=kc ){
-                IndexType pb = min( k-p, kc );
-
-                for (IndexType i=0; i<m; i+=mc ){
-                    IndexType ib = min( m-i, mc );
-                    sub_gemm_ct_t(ib, n, pb, alpha, A+p+i*ldA, ldA,
-                                  B+p*ldB, ldB, T(1), C+i, ldC,
-                                  packedA, packedB, i==0);
-                }
-            }
-        } else if ( transB==ConjTrans ) {
-
-            for ( IndexType p=0; p<k; p+=kc ){
-                IndexType pb = min( k-p, kc );
-
-                for (IndexType i=0; i<m; i+=mc ){
-                    IndexType ib = min( m-i, mc );
-                    sub_gemm_ct_ct(ib, n, pb, alpha, A+p+i*ldA, ldA,
-                                   B+p*ldB, ldB, T(1), C+i, ldC,
-                                   packedA, packedB, i==0);
-                }
-            }
-        }
+    gemm_scale(m, n, beta, C, ldC);
+    if (alpha==T(0)) {
+        return;
     }
 
-    // free memory again
-    delete[] packedA;
-    delete[] packedB;
-
+    gemm_driver(m, n, k, alpha,
+                GemmGeOperand<IndexType, MA>(transA, A, ldA),
+                GemmGeOperand<IndexType, MB>(transB, B, ldB),
+                C, ldC);
 }
 
 #endif // USE_INTRINSIC
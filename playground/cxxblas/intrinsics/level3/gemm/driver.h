@@ -0,0 +1,111 @@
+/*
+ *   Copyright (c) 2013, Klaus Pototzky
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef PLAYGROUND_CXXBLAS_INTRINSICS_LEVEL3_GEMM_DRIVER_H
+#define PLAYGROUND_CXXBLAS_INTRINSICS_LEVEL3_GEMM_DRIVER_H 1
+
+#include <cxxblas/typedefs.h>
+
+//
+//  Packed, multi-threaded gemm in the style of Goto/BLIS:
+//
+//    for pc (kc columns of A, kc rows of B)
+//        pack B(pc, :) into slivers of NR=4 columns     (shared, parallel)
+//        for ic (mc rows of A), jr (column chunks)       (parallel)
+//            pack A(ic, pc) into slivers of MR rows      (per thread)
+//            for jr, ir: micro kernel on C(ir, jr)       (MR x NR)
+//
+//  MR=2*numElements of DEFAULT_INTRINSIC_LEVEL.  kc and mc come from the
+//  cache probes (BlockSize<GEMM, ...>).  The packing buffers are drawn from
+//  the thread local workspace arena (flens/storage/workspace), so they get
+//  reused by subsequent calls.  With OpenMP the (ic, jr) loops get split
+//  among the threads, with at least as many tasks as threads.  Define
+//  INTRINSICS_GEMM_MIN_PARALLEL to change the smallest m*n*k for which
+//  threads are used.
+//
+//  Edges (mr<MR or nr<NR) and tiles crossing the diagonal of C for a
+//  triangular update (part!=GemmFull, used by syrk) get computed into a
+//  local tile first.
+//
+
+#ifndef INTRINSICS_GEMM_MIN_PARALLEL
+#   define INTRINSICS_GEMM_MIN_PARALLEL   (64*64*64)
+#endif
+
+namespace cxxblas {
+
+#ifdef USE_INTRINSIC
+
+enum GemmPart {
+    GemmFull  = 0,
+    GemmUpper = 1,
+    GemmLower = 2
+};
+
+//
+//  C += alpha*A*B, with A and B operands from operand.h.  For part!=GemmFull
+//  only the upper or lower triangle of C (including the diagonal) gets
+//  updated.
+//
+template <typename IndexType, typename T, typename OpA, typename OpB>
+    void
+    gemm_driver(IndexType m, IndexType n, IndexType k,
+                const T &alpha, const OpA &A, const OpB &B,
+                T *C, IndexType ldC,
+                GemmPart part = GemmFull);
+
+//
+//  C = beta*C.  With beta==0 the content of C is not referenced (C might be
+//  uninitialized), so it gets overwritten instead of scaled.
+//
+template <typename IndexType, typename T>
+    void
+    gemm_scale(IndexType m, IndexType n, const T &beta, T *C, IndexType ldC);
+
+//
+//  C(i0:i0+mb, j0:j0+nb) += alpha*A*B for packed A (mb x kb) and B (kb x nb)
+//
+template <typename IndexType, typename T, typename MA, typename MB>
+    void
+    gemm_macro_kernel(IndexType i0, IndexType j0,
+                      IndexType mb, IndexType nb, IndexType kb,
+                      const T &alpha,
+                      const MA *packedA, const MB *packedB,
+                      T *C, IndexType ldC,
+                      GemmPart part);
+
+#endif // USE_INTRINSIC
+
+} // namespace cxxblas
+
+#endif // PLAYGROUND_CXXBLAS_INTRINSICS_LEVEL3_GEMM_DRIVER_H
@@ -0,0 +1,238 @@
+/*
+ *   Copyright (c) 2013, Klaus Pototzky
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef PLAYGROUND_CXXBLAS_INTRINSICS_LEVEL3_GEMM_DRIVER_TCC
+#define PLAYGROUND_CXXBLAS_INTRINSICS_LEVEL3_GEMM_DRIVER_TCC 1
+
+#include <cxxstd/algorithm.h>
+#include <cxxblas/cxxblas.h>
+#include <flens/storage/workspace/workspace.h>
+#include <playground/cxxblas/intrinsics/auxiliary/auxiliary.h>
+#include <playground/cxxblas/intrinsics/includes.h>
+#include <playground/cxxblas/intrinsics/level3/gemm/driver.h>
+#include <playground/cxxblas/intrinsics/level3/gemm/kernelgemm.h>
+#include <playground/cxxblas/intrinsics/level3/gemm/operand.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace cxxblas {
+
+#ifdef USE_INTRINSIC
+
+template <typename IndexType, typename T, typename OpA, typename OpB>
+void
+gemm_driver(IndexType m, IndexType n, IndexType k,
+            const T &alpha, const OpA &A, const OpB &B,
+            T *C, IndexType ldC,
+            GemmPart part)
+{
+    typedef typename OpA::ElementType   MA;
+    typedef typename OpB::ElementType   MB;
+
+    using std::max;
+    using std::min;
+
+    if (m==0 || n==0 || k==0) {
+        return;
+    }
+
+    const IndexType MR = 2*Intrinsics<T, DEFAULT_INTRINSIC_LEVEL>::numElements;
+    const IndexType NR = 4;
+
+    IndexType kc = BlockSize<GEMM, T, IndexType>::KC(MR, NR);
+    IndexType mc = BlockSize<GEMM, T, IndexType>::MC(MR, kc);
+
+    kc = min(kc, k);
+    mc = min(mc, ((m+MR-1)/MR)*MR);
+
+    const IndexType numPanels = (n+NR-1)/NR;
+    const IndexType numBlocks = (m+mc-1)/mc;
+
+    int numThreads = 1;
+#   ifdef _OPENMP
+    if (double(m)*n*k>=INTRINSICS_GEMM_MIN_PARALLEL) {
+        numThreads = omp_get_max_threads();
+    }
+#   endif
+
+//
+//  Each block of rows gets split into column chunks such that there are at
+//  least as many tasks as threads.
+//
+    const IndexType numChunks = max(IndexType(1),
+                                    min(numPanels,
+                                        (numThreads+numBlocks-1)/numBlocks));
+    const IndexType numTasks  = numBlocks*numChunks;
+
+    const std::size_t sizeB = std::size_t(kc)*numPanels*NR*sizeof(MB);
+    MB *packedB = static_cast<MB *>(flens::Workspace::allocate(sizeB));
+
+#   ifdef _OPENMP
+#   pragma omp parallel num_threads(numThreads)
+#   endif
+    {
+        const std::size_t sizeA = std::size_t(mc)*kc*sizeof(MA);
+        MA *packedA = static_cast<MA *>(flens::Workspace::allocate(sizeA));
+
+        for (IndexType p=0; p<k; p+=kc) {
+            const IndexType kb = min(kc, k-p);
+
+#           ifdef _OPENMP
+#           pragma omp for schedule(static)
+#           endif
+            for (IndexType jp=0; jp<numPanels; ++jp) {
+                const IndexType j = jp*NR;
+                B.packB(p, j, kb, min(NR, n-j), NR, packedB+j*kb);
+            }
+
+            IndexType packedI = -1;
+
+#           ifdef _OPENMP
+#           pragma omp for schedule(static)
+#           endif
+            for (IndexType task=0; task<numTasks; ++task) {
+                const IndexType i  = (task/numChunks)*mc;
+                const IndexType mb = min(mc, m-i);
+                const IndexType c  = task%numChunks;
+                const IndexType j0 = NR*((c*numPanels)/numChunks);
+                const IndexType j1 = min(n, NR*(((c+1)*numPanels)/numChunks));
+
+                if (j0>=j1) {
+                    continue;
+                }
+                if ((part==GemmUpper && i>=j1)
+                 || (part==GemmLower && i+mb<=j0))
+                {
+                    continue;
+                }
+                if (i!=packedI) {
+                    for (IndexType ir=0; ir<mb; ir+=MR) {
+                        A.packA(i+ir, p, min(MR, mb-ir), kb, MR,
+                                packedA+ir*kb);
+                    }
+                    packedI = i;
+                }
+                gemm_macro_kernel(i, j0, mb, j1-j0, kb, alpha,
+                                  packedA, packedB+j0*kb,
+                                  C+i+j0*ldC, ldC, part);
+            }
+        }
+        flens::Workspace::deallocate(packedA, sizeA);
+    }
+    flens::Workspace::deallocate(packedB, sizeB);
+}
+
+template <typename IndexType, typename T>
+void
+gemm_scale(IndexType m, IndexType n, const T &beta, T *C, IndexType ldC)
+{
+    if (beta==T(0)) {
+        for (IndexType j=0; j<n; ++j) {
+            std::fill_n(C+j*ldC, m, T(0));
+        }
+    } else if (beta!=T(1)) {
+        gescal(ColMajor, m, n, beta, C, ldC);
+    }
+}
+
+template <typename IndexType, typename T, typename MA, typename MB>
+void
+gemm_macro_kernel(IndexType i0, IndexType j0,
+                  IndexType mb, IndexType nb, IndexType kb,
+                  const T &alpha,
+                  const MA *packedA, const MB *packedB,
+                  T *C, IndexType ldC,
+                  GemmPart part)
+{
+    const int MR = 2*Intrinsics<T, DEFAULT_INTRINSIC_LEVEL>::numElements;
+    const int NR = 4;
+
+    T tile[MR*NR];
+
+    for (IndexType jr=0; jr<nb; jr+=NR) {
+        const IndexType nr = std::min(IndexType(NR), nb-jr);
+        const IndexType j  = j0+jr;
+
+        for (IndexType ir=0; ir<mb; ir+=MR) {
+            const IndexType mr = std::min(IndexType(MR), mb-ir);
+            const IndexType i  = i0+ir;
+
+            bool full = (mr==MR && nr==NR);
+
+            if (part==GemmUpper) {
+                if (i>j+nr-1) {
+                    continue;
+                }
+                full = full && (i+mr-1<=j);
+            } else if (part==GemmLower) {
+                if (i+mr-1<j) {
+                    continue;
+                }
+                full = full && (i>=j+nr-1);
+            }
+
+            const MA *A_ = packedA+ir*kb;
+            const MB *B_ = packedB+jr*kb;
+            T        *C_ = C+ir+jr*ldC;
+
+            if (full) {
+                kernel_gemm_2numElementsx4(kb, alpha, A_, IndexType(MR),
+                                           B_, kb, T(1), C_, ldC);
+                continue;
+            }
+
+            std::fill_n(tile, MR*NR, T(0));
+            kernel_gemm_2numElementsx4(kb, alpha, A_, IndexType(MR),
+                                       B_, kb, T(1), tile, IndexType(MR));
+
+            for (IndexType c=0; c<nr; ++c) {
+                for (IndexType r=0; r<mr; ++r) {
+                    if ((part==GemmUpper && i+r>j+c)
+                     || (part==GemmLower && i+r<j+c))
+                    {
+                        continue;
+                    }
+                    C_[r+c*ldC] += tile[r+c*MR];
+                }
+            }
+        }
+    }
+}
+
+#endif // USE_INTRINSIC
+
+} // namespace cxxblas
+
+#endif // PLAYGROUND_CXXBLAS_INTRINSICS_LEVEL3_GEMM_DRIVER_TCC
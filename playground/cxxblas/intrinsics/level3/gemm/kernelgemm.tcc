@@ -35,6 +35,7 @@
 
 #include <cxxblas/cxxblas.h>
 #include <playground/cxxblas/intrinsics/auxiliary/auxiliary.h>
+#include <playground/cxxblas/intrinsics/dispatch/dispatch.h>
 #include <playground/cxxblas/intrinsics/includes.h>
 #include <playground/cxxblas/intrinsics/level3/gemm/packmatrix.h>
 
@@ -55,6 +56,11 @@ kernel_gemm_2numElementsx4(IndexType k,
     typedef Intrinsics<T, DEFAULT_INTRINSIC_LEVEL> IntrinsicType;
     const int numElements = IntrinsicType::numElements;
 
+    // C gets scaled by beta before the kernel is called
+    if (dispatch_gemm<2*numElements>(k, alpha, A, B, C, ldC)) {
+        return;
+    }
+
     IntrinsicType  c_00_c_10_,    c_01_c_11_,    c_02_c_12_,    c_03_c_13_,
                    c_20_c_30_,    c_21_c_31_,    c_22_c_32_,    c_23_c_33_,
                    a_0p_a_1p_,    a_2p_a_3p_,
@@ -0,0 +1,132 @@
+/*
+ *   Copyright (c) 2013, Klaus Pototzky
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef PLAYGROUND_CXXBLAS_INTRINSICS_LEVEL3_GEMM_OPERAND_H
+#define PLAYGROUND_CXXBLAS_INTRINSICS_LEVEL3_GEMM_OPERAND_H 1
+
+#include <cxxblas/typedefs.h>
+
+namespace cxxblas {
+
+#ifdef USE_INTRINSIC
+
+//
+//  Operands of the packed gemm driver (driver.h).  An operand gives access
+//  to the elements of op(A) and packs slivers of op(A) in the layout of the
+//  micro kernels (kernelgemm.h):
+//
+//    packA(i, p, mr, kb, MR, to)   rows i..i+mr-1, columns p..p+kb-1 with
+//                                  MR elements per column: to[l*MR+r]
+//    packB(p, j, kb, nr, NR, to)   rows p..p+kb-1, columns j..j+nr-1 with
+//                                  NR elements per row: to[l*NR+c]
+//
+//  Partial slivers (mr<MR, nr<NR) get padded with zeros.  Matrices are
+//  stored column major.
+//
+
+//
+//  op(A) for a general matrix A
+//
+template <typename IndexType, typename MA>
+class GemmGeOperand
+{
+    public:
+        typedef MA  ElementType;
+
+        GemmGeOperand(Transpose trans, const MA *A, IndexType ldA);
+
+        MA
+        operator()(IndexType i, IndexType p) const;
+
+        void
+        packA(IndexType i, IndexType p, IndexType mr, IndexType kb,
+              IndexType MR, MA *to) const;
+
+        void
+        packB(IndexType p, IndexType j, IndexType kb, IndexType nr,
+              IndexType NR, MA *to) const;
+
+    private:
+        Transpose   trans_;
+        const MA    *A_;
+        IndexType   ldA_;
+};
+
+//
+//  Symmetric matrix A, only the triangle upLo of A gets referenced
+//
+template <typename IndexType, typename MA>
+class GemmSyOperand
+{
+    public:
+        typedef MA  ElementType;
+
+        GemmSyOperand(StorageUpLo upLo, const MA *A, IndexType ldA);
+
+        MA
+        operator()(IndexType i, IndexType p) const;
+
+        void
+        packA(IndexType i, IndexType p, IndexType mr, IndexType kb,
+              IndexType MR, MA *to) const;
+
+        void
+        packB(IndexType p, IndexType j, IndexType kb, IndexType nr,
+              IndexType NR, MA *to) const;
+
+    private:
+        StorageUpLo upLo_;
+        const MA    *A_;
+        IndexType   ldA_;
+};
+
+//
+//  Packing through operator() of the operand
+//
+template <typename Operand, typename IndexType, typename MA>
+    void
+    gemm_packA(const Operand &A,
+               IndexType i, IndexType p, IndexType mr, IndexType kb,
+               IndexType MR, MA *to);
+
+template <typename Operand, typename IndexType, typename MB>
+    void
+    gemm_packB(const Operand &B,
+               IndexType p, IndexType j, IndexType kb, IndexType nr,
+               IndexType NR, MB *to);
+
+#endif // USE_INTRINSIC
+
+} // namespace cxxblas
+
+#endif // PLAYGROUND_CXXBLAS_INTRINSICS_LEVEL3_GEMM_OPERAND_H
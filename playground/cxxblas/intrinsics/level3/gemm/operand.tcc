@@ -0,0 +1,197 @@
+/*
+ *   Copyright (c) 2013, Klaus Pototzky
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef PLAYGROUND_CXXBLAS_INTRINSICS_LEVEL3_GEMM_OPERAND_TCC
+#define PLAYGROUND_CXXBLAS_INTRINSICS_LEVEL3_GEMM_OPERAND_TCC 1
+
+#include <cxxblas/cxxblas.h>
+#include <playground/cxxblas/intrinsics/level3/gemm/operand.h>
+#include <playground/cxxblas/intrinsics/level3/gemm/packmatrix.h>
+
+namespace cxxblas {
+
+#ifdef USE_INTRINSIC
+
+//-- GemmGeOperand -------------------------------------------------------------
+
+template <typename IndexType, typename MA>
+GemmGeOperand<IndexType, MA>::GemmGeOperand(Transpose trans, const MA *A,
+                                            IndexType ldA)
+    : trans_(trans), A_(A), ldA_(ldA)
+{
+}
+
+template <typename IndexType, typename MA>
+MA
+GemmGeOperand<IndexType, MA>::operator()(IndexType i, IndexType p) const
+{
+    switch (trans_) {
+        case NoTrans:
+            return A_[i+p*ldA_];
+        case Conj:
+            return conjugate(A_[i+p*ldA_]);
+        case Trans:
+            return A_[p+i*ldA_];
+        default:
+            return conjugate(A_[p+i*ldA_]);
+    }
+}
+
+template <typename IndexType, typename MA>
+void
+GemmGeOperand<IndexType, MA>::packA(IndexType i, IndexType p,
+                                    IndexType mr, IndexType kb,
+                                    IndexType MR, MA *to) const
+{
+    if (mr<MR) {
+        gemm_packA(*this, i, p, mr, kb, MR, to);
+        return;
+    }
+    switch (trans_) {
+        case NoTrans:
+            PackMatrixColToColMajor(kb, A_+i+p*ldA_, ldA_, to, MR);
+            break;
+        case Conj:
+            PackMatrixColToColMajor_conj(kb, A_+i+p*ldA_, ldA_, to, MR);
+            break;
+        case Trans:
+            PackMatrixColToRowMajor(kb, A_+p+i*ldA_, ldA_, to, MR);
+            break;
+        default:
+            PackMatrixColToRowMajor_conj(kb, A_+p+i*ldA_, ldA_, to, MR);
+    }
+}
+
+template <typename IndexType, typename MA>
+void
+GemmGeOperand<IndexType, MA>::packB(IndexType p, IndexType j,
+                                    IndexType kb, IndexType nr,
+                                    IndexType NR, MA *to) const
+{
+    if (nr<NR || NR!=4) {
+        gemm_packB(*this, p, j, kb, nr, NR, to);
+        return;
+    }
+    switch (trans_) {
+        case NoTrans:
+            PackMatrixColToRowMajor_4(kb, A_+p+j*ldA_, ldA_, to);
+            break;
+        case Conj:
+            PackMatrixColToRowMajor_4_conj(kb, A_+p+j*ldA_, ldA_, to);
+            break;
+        case Trans:
+            PackMatrixColToColMajor_4(kb, A_+j+p*ldA_, ldA_, to);
+            break;
+        default:
+            PackMatrixColToColMajor_4_conj(kb, A_+j+p*ldA_, ldA_, to);
+    }
+}
+
+//-- GemmSyOperand -------------------------------------------------------------
+
+template <typename IndexType, typename MA>
+GemmSyOperand<IndexType, MA>::GemmSyOperand(StorageUpLo upLo, const MA *A,
+                                            IndexType ldA)
+    : upLo_(upLo), A_(A), ldA_(ldA)
+{
+}
+
+template <typename IndexType, typename MA>
+MA
+GemmSyOperand<IndexType, MA>::operator()(IndexType i, IndexType p) const
+{
+    if ((upLo_==Upper) == (i<=p)) {
+        return A_[i+p*ldA_];
+    }
+    return A_[p+i*ldA_];
+}
+
+template <typename IndexType, typename MA>
+void
+GemmSyOperand<IndexType, MA>::packA(IndexType i, IndexType p,
+                                    IndexType mr, IndexType kb,
+                                    IndexType MR, MA *to) const
+{
+    gemm_packA(*this, i, p, mr, kb, MR, to);
+}
+
+template <typename IndexType, typename MA>
+void
+GemmSyOperand<IndexType, MA>::packB(IndexType p, IndexType j,
+                                    IndexType kb, IndexType nr,
+                                    IndexType NR, MA *to) const
+{
+    gemm_packB(*this, p, j, kb, nr, NR, to);
+}
+
+//-- packing through operator() ------------------------------------------------
+
+template <typename Operand, typename IndexType, typename MA>
+void
+gemm_packA(const Operand &A,
+           IndexType i, IndexType p, IndexType mr, IndexType kb,
+           IndexType MR, MA *to)
+{
+    for (IndexType l=0; l<kb; ++l, to+=MR) {
+        IndexType r=0;
+        for (; r<mr; ++r) {
+            to[r] = A(i+r, p+l);
+        }
+        for (; r<MR; ++r) {
+            to[r] = MA(0);
+        }
+    }
+}
+
+template <typename Operand, typename IndexType, typename MB>
+void
+gemm_packB(const Operand &B,
+           IndexType p, IndexType j, IndexType kb, IndexType nr,
+           IndexType NR, MB *to)
+{
+    for (IndexType l=0; l<kb; ++l, to+=NR) {
+        IndexType c=0;
+        for (; c<nr; ++c) {
+            to[c] = B(p+l, j+c);
+        }
+        for (; c<NR; ++c) {
+            to[c] = MB(0);
+        }
+    }
+}
+
+#endif // USE_INTRINSIC
+
+} // namespace cxxblas
+
+#endif // PLAYGROUND_CXXBLAS_INTRINSICS_LEVEL3_GEMM_OPERAND_TCC
@@ -238,15 +238,6 @@ PackMatrixColToColMajor_conj(IndexType k, const T *A, IndexType ldA,
             break;
         default: ASSERT(0);
     }
-
-    for(IndexType j=0; j<k; j++){
-        const T *a_ij_pntr = A+j*ldA;
-        for (IndexType l=0; l<ldA_to; ++l) {
-            *(A_to+l  ) = conjugate(*(a_ij_pntr+l  ));
-        }
-
-        A_to += ldA_to;
-    }
 }
 
 template <typename IndexType, typename T>
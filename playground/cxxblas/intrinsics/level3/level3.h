@@ -34,5 +34,9 @@
 #define PLAYGROUND_CXXBLAS_INTRINSICS_LEVEL3_LEVEL3_H 1
 
 #include <playground/cxxblas/intrinsics/level3/gemm.h>
+#include <playground/cxxblas/intrinsics/level3/symm.h>
+#include <playground/cxxblas/intrinsics/level3/syrk.h>
+#include <playground/cxxblas/intrinsics/level3/trmm.h>
+#include <playground/cxxblas/intrinsics/level3/trsm.h>
 
 #endif // PLAYGROUND_CXXBLAS_INTRINSICS_LEVEL3_LEVEL3_H
@@ -34,5 +34,9 @@
 #define PLAYGROUND_CXXBLAS_INTRINSICS_LEVEL3_LEVEL3_TCC 1
 
 #include <playground/cxxblas/intrinsics/level3/gemm.tcc>
+#include <playground/cxxblas/intrinsics/level3/symm.tcc>
+#include <playground/cxxblas/intrinsics/level3/syrk.tcc>
+#include <playground/cxxblas/intrinsics/level3/trmm.tcc>
+#include <playground/cxxblas/intrinsics/level3/trsm.tcc>
 
 #endif // PLAYGROUND_CXXBLAS_INTRINSICS_LEVEL3_LEVEL3_TCC
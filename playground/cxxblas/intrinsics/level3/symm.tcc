@@ -0,0 +1,99 @@
+/*
+ *   Copyright (c) 2013, Klaus Pototzky
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef PLAYGROUND_CXXBLAS_INTRINSICS_LEVEL3_SYMM_TCC
+#define PLAYGROUND_CXXBLAS_INTRINSICS_LEVEL3_SYMM_TCC 1
+
+#include <cxxblas/cxxblas.h>
+#include <playground/cxxblas/intrinsics/level3/gemm/driver.tcc>
+#include <playground/cxxblas/intrinsics/level3/gemm/operand.tcc>
+
+namespace cxxblas {
+
+#ifdef USE_INTRINSIC
+
+template <typename IndexType, typename T>
+typename flens::RestrictTo<flens::IsIntrinsicsCompatible<T>::value,
+                           void>::Type
+symm(StorageOrder order, Side side, StorageUpLo upLo,
+     IndexType m, IndexType n,
+     const T &alpha,
+     const T *A, IndexType ldA,
+     const T *B, IndexType ldB,
+     const T &beta,
+     T *C, IndexType ldC)
+{
+    CXXBLAS_DEBUG_OUT("symm_intrinsics [" INTRINSIC_NAME "]");
+
+    if ((m==0) || (n==0)) {
+        return;
+    }
+
+    if (order==RowMajor) {
+        side = (side==Left) ? Right : Left;
+        upLo = (upLo==Upper) ? Lower : Upper;
+        symm(ColMajor, side, upLo, n, m,
+             alpha, A, ldA, B, ldB,
+             beta, C, ldC);
+        return;
+    }
+
+    const IndexType k = (side==Left) ? m : n;
+
+    CXXBLAS_PROFILE_SCOPE("symm", ProfileIntrinsics, long(m)*n*k,
+                          (flens::IsComplex<T>::value ? 8. : 2.)*m*n*k,
+                          (0.5*k*k+3.*m*n)*sizeof(T));
+
+    gemm_scale(m, n, beta, C, ldC);
+    if (alpha==T(0)) {
+        return;
+    }
+
+    if (side==Left) {
+        gemm_driver(m, n, k, alpha,
+                    GemmSyOperand<IndexType, T>(upLo, A, ldA),
+                    GemmGeOperand<IndexType, T>(NoTrans, B, ldB),
+                    C, ldC);
+    } else {
+        gemm_driver(m, n, k, alpha,
+                    GemmGeOperand<IndexType, T>(NoTrans, B, ldB),
+                    GemmSyOperand<IndexType, T>(upLo, A, ldA),
+                    C, ldC);
+    }
+}
+
+#endif // USE_INTRINSIC
+
+} // namespace cxxblas
+
+#endif // PLAYGROUND_CXXBLAS_INTRINSICS_LEVEL3_SYMM_TCC
@@ -0,0 +1,111 @@
+/*
+ *   Copyright (c) 2013, Klaus Pototzky
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef PLAYGROUND_CXXBLAS_INTRINSICS_LEVEL3_SYRK_TCC
+#define PLAYGROUND_CXXBLAS_INTRINSICS_LEVEL3_SYRK_TCC 1
+
+#include <cxxblas/cxxblas.h>
+#include <playground/cxxblas/intrinsics/level3/gemm/driver.tcc>
+#include <playground/cxxblas/intrinsics/level3/gemm/operand.tcc>
+
+namespace cxxblas {
+
+#ifdef USE_INTRINSIC
+
+template <typename IndexType, typename T>
+typename flens::RestrictTo<flens::IsIntrinsicsCompatible<T>::value,
+                           void>::Type
+syrk(StorageOrder order, StorageUpLo upLo,
+     Transpose trans,
+     IndexType n, IndexType k,
+     const T &alpha,
+     const T *A, IndexType ldA,
+     const T &beta,
+     T *C, IndexType ldC)
+{
+    CXXBLAS_DEBUG_OUT("syrk_intrinsics [" INTRINSIC_NAME "]");
+
+    ASSERT(trans==NoTrans || trans==Trans);
+
+    if (n==0) {
+        return;
+    }
+
+    if (order==RowMajor) {
+        upLo  = (upLo==Upper) ? Lower : Upper;
+        trans = (trans==NoTrans) ? Trans : NoTrans;
+        syrk(ColMajor, upLo, trans, n, k,
+             alpha, A, ldA,
+             beta, C, ldC);
+        return;
+    }
+
+    CXXBLAS_PROFILE_SCOPE("syrk", ProfileIntrinsics, long(n)*n*k/2,
+                          (flens::IsComplex<T>::value ? 4. : 1.)*n*n*k,
+                          (double(n)*k+n*n)*sizeof(T));
+
+//
+//  With beta==0 the triangle of C gets overwritten.
+//
+    if (beta==T(0)) {
+        for (IndexType j=0; j<n; ++j) {
+            if (upLo==Upper) {
+                std::fill_n(C+j*ldC, j+1, T(0));
+            } else {
+                std::fill_n(C+j+j*ldC, n-j, T(0));
+            }
+        }
+    } else if (beta!=T(1)) {
+        syscal(ColMajor, upLo, n, beta, C, ldC);
+    }
+    if ((k==0) || (alpha==T(0))) {
+        return;
+    }
+
+//
+//  C += alpha*op(A)*op(A)^T restricted to the triangle upLo of C
+//
+    const Transpose transB = (trans==NoTrans) ? Trans : NoTrans;
+
+    gemm_driver(n, n, k, alpha,
+                GemmGeOperand<IndexType, T>(trans, A, ldA),
+                GemmGeOperand<IndexType, T>(transB, A, ldA),
+                C, ldC,
+                (upLo==Upper) ? GemmUpper : GemmLower);
+}
+
+#endif // USE_INTRINSIC
+
+} // namespace cxxblas
+
+#endif // PLAYGROUND_CXXBLAS_INTRINSICS_LEVEL3_SYRK_TCC
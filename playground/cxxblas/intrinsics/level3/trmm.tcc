@@ -0,0 +1,174 @@
+/*
+ *   Copyright (c) 2013, Klaus Pototzky
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef PLAYGROUND_CXXBLAS_INTRINSICS_LEVEL3_TRMM_TCC
+#define PLAYGROUND_CXXBLAS_INTRINSICS_LEVEL3_TRMM_TCC 1
+
+#include <cxxblas/cxxblas.h>
+#include <playground/cxxblas/intrinsics/includes.h>
+#include <playground/cxxblas/intrinsics/level3/gemm/driver.tcc>
+#include <playground/cxxblas/intrinsics/level3/gemm/operand.tcc>
+
+namespace cxxblas {
+
+#ifdef USE_INTRINSIC
+
+template <typename IndexType, typename T>
+void
+trmm_recursive(Side side, StorageUpLo upLo,
+               Transpose transA, Diag diag,
+               IndexType m, IndexType n,
+               const T &alpha,
+               const T *A, IndexType ldA,
+               T *B, IndexType ldB)
+{
+    const IndexType MR = 2*Intrinsics<T, DEFAULT_INTRINSIC_LEVEL>::numElements;
+
+    const IndexType k = (side==Left) ? m : n;
+
+    if (k<=INTRINSICS_TRMM_BLOCKSIZE) {
+        trmm_generic(ColMajor, side, upLo, transA, diag, m, n,
+                     alpha, A, ldA, B, ldB);
+        return;
+    }
+
+//
+//  op(A) = [ A11 A12 ]  with k1 a multiple of MR
+//          [ A21 A22 ]
+//
+//  Only one of A12, A21 is referenced, for op(A) upper or lower triangular.
+//
+    const bool noTrans = (transA==NoTrans) || (transA==Conj);
+    const bool lower   = (upLo==Lower)==noTrans;
+
+    const IndexType k1 = ((k/2+MR-1)/MR)*MR;
+    const IndexType k2 = k-k1;
+
+    const T *A11 = A;
+    const T *A22 = A+k1+k1*ldA;
+    const T *A12 = noTrans ? A+k1*ldA : A+k1;
+    const T *A21 = noTrans ? A+k1 : A+k1*ldA;
+
+    if (side==Left) {
+        T *B1 = B;
+        T *B2 = B+k1;
+
+        if (lower) {
+            trmm_recursive(side, upLo, transA, diag, k2, n, alpha,
+                           A22, ldA, B2, ldB);
+            gemm_driver(k2, n, k1, alpha,
+                        GemmGeOperand<IndexType, T>(transA, A21, ldA),
+                        GemmGeOperand<IndexType, T>(NoTrans, B1, ldB),
+                        B2, ldB);
+            trmm_recursive(side, upLo, transA, diag, k1, n, alpha,
+                           A11, ldA, B1, ldB);
+        } else {
+            trmm_recursive(side, upLo, transA, diag, k1, n, alpha,
+                           A11, ldA, B1, ldB);
+            gemm_driver(k1, n, k2, alpha,
+                        GemmGeOperand<IndexType, T>(transA, A12, ldA),
+                        GemmGeOperand<IndexType, T>(NoTrans, B2, ldB),
+                        B1, ldB);
+            trmm_recursive(side, upLo, transA, diag, k2, n, alpha,
+                           A22, ldA, B2, ldB);
+        }
+    } else {
+        T *B1 = B;
+        T *B2 = B+k1*ldB;
+
+        if (lower) {
+            trmm_recursive(side, upLo, transA, diag, m, k1, alpha,
+                           A11, ldA, B1, ldB);
+            gemm_driver(m, k1, k2, alpha,
+                        GemmGeOperand<IndexType, T>(NoTrans, B2, ldB),
+                        GemmGeOperand<IndexType, T>(transA, A21, ldA),
+                        B1, ldB);
+            trmm_recursive(side, upLo, transA, diag, m, k2, alpha,
+                           A22, ldA, B2, ldB);
+        } else {
+            trmm_recursive(side, upLo, transA, diag, m, k2, alpha,
+                           A22, ldA, B2, ldB);
+            gemm_driver(m, k2, k1, alpha,
+                        GemmGeOperand<IndexType, T>(NoTrans, B1, ldB),
+                        GemmGeOperand<IndexType, T>(transA, A12, ldA),
+                        B2, ldB);
+            trmm_recursive(side, upLo, transA, diag, m, k1, alpha,
+                           A11, ldA, B1, ldB);
+        }
+    }
+}
+
+template <typename IndexType, typename T>
+typename flens::RestrictTo<flens::IsIntrinsicsCompatible<T>::value,
+                           void>::Type
+trmm(StorageOrder order, Side side, StorageUpLo upLo,
+     Transpose transA, Diag diag,
+     IndexType m, IndexType n,
+     const T &alpha,
+     const T *A, IndexType ldA,
+     T *B, IndexType ldB)
+{
+    CXXBLAS_DEBUG_OUT("trmm_intrinsics [" INTRINSIC_NAME "]");
+
+    if ((m==0) || (n==0)) {
+        return;
+    }
+
+    if (order==RowMajor) {
+        side = (side==Left) ? Right : Left;
+        upLo = (upLo==Upper) ? Lower : Upper;
+        trmm(ColMajor, side, upLo, transA, diag, n, m,
+             alpha, A, ldA, B, ldB);
+        return;
+    }
+
+#   ifdef CXXBLAS_PROFILE
+    const IndexType k = (side==Left) ? m : n;
+
+    CXXBLAS_PROFILE_SCOPE("trmm", ProfileIntrinsics, long(m)*n*k/2,
+                          (flens::IsComplex<T>::value ? 4. : 1.)*m*n*k,
+                          (0.5*k*k+2.*m*n)*sizeof(T));
+#   endif
+
+    if (alpha==T(0)) {
+        gemm_scale(m, n, alpha, B, ldB);
+        return;
+    }
+    trmm_recursive(side, upLo, transA, diag, m, n, alpha, A, ldA, B, ldB);
+}
+
+#endif // USE_INTRINSIC
+
+} // namespace cxxblas
+
+#endif // PLAYGROUND_CXXBLAS_INTRINSICS_LEVEL3_TRMM_TCC
@@ -0,0 +1,77 @@
+/*
+ *   Copyright (c) 2013, Klaus Pototzky
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifndef PLAYGROUND_CXXBLAS_INTRINSICS_LEVEL3_TRSM_H
+#define PLAYGROUND_CXXBLAS_INTRINSICS_LEVEL3_TRSM_H 1
+
+#include <cxxblas/typedefs.h>
+
+#ifndef INTRINSICS_TRSM_BLOCKSIZE
+#   define INTRINSICS_TRSM_BLOCKSIZE   32
+#endif
+
+namespace cxxblas {
+
+#ifdef USE_INTRINSIC
+
+//
+//  op(A)*X = alpha*B or X*op(A) = alpha*B
+//
+template <typename IndexType, typename T>
+    typename flens::RestrictTo<flens::IsIntrinsicsCompatible<T>::value,
+                               void>::Type
+    trsm(StorageOrder order, Side side, StorageUpLo upLo,
+         Transpose transA, Diag diag,
+         IndexType m, IndexType n,
+         const T &alpha,
+         const T *A, IndexType ldA,
+         T *B, IndexType ldB);
+
+//
+//  Column major trsm (with alpha=1) by recursive splitting of A.  The
+//  off-diagonal blocks get eliminated by the gemm driver, diagonal blocks of
+//  order at most INTRINSICS_TRSM_BLOCKSIZE get solved by trsm_generic.
+//
+template <typename IndexType, typename T>
+    void
+    trsm_recursive(Side side, StorageUpLo upLo,
+                   Transpose transA, Diag diag,
+                   IndexType m, IndexType n,
+                   const T *A, IndexType ldA,
+                   T *B, IndexType ldB);
+
+#endif // USE_INTRINSIC
+
+} // namespace cxxblas
+
+#endif // PLAYGROUND_CXXBLAS_INTRINSICS_LEVEL3_TRSM_H
@@ -55,6 +55,10 @@ template <typename IndexType, typename X, typename T>
 void
 sum(IndexType n, const X *x, IndexType incX, T &sum)
 {
+    if (Reproducible::enabled()) {
+        sum_reproducible(n, x, incX, sum);
+        return;
+    }
     if (incX<0) {
         x -= incX*(n-1);
     }
@@ -33,16 +33,37 @@
 #ifndef PLAYGROUND_CXXBLAS_LEVEL3EXTENSION_GEMM_STASSEN_H
 #define PLAYGROUND_CXXBLAS_LEVEL3EXTENSION_GEMM_STASSEN_H 1
 
+#include <cxxstd/cstddef.h>
 #include <cxxblas/typedefs.h>
 
 namespace cxxblas {
 
 #define HAVE_CXXBLAS_GEMM_STRASSEN 1
 
-#ifndef MINDIM
-#    define MINDIM 384
+//
+//  Products with min(m, n, k) at most STRASSEN_CUTOFF are computed by gemm.
+//  (MINDIM is the former name of this cutoff.)  On the top STRASSEN_TASK_DEPTH
+//  levels of the recursion the seven sub-products run as OpenMP tasks.  These
+//  levels keep all sums and products in separate buffers and therefore need
+//  more workspace than the sequential levels.
+//
+#ifndef STRASSEN_CUTOFF
+#   ifdef MINDIM
+#       define STRASSEN_CUTOFF      MINDIM
+#   else
+#       define STRASSEN_CUTOFF      384
+#   endif
 #endif
 
+#ifndef STRASSEN_TASK_DEPTH
+#   define STRASSEN_TASK_DEPTH      1
+#endif
+
+//
+//  C = alpha*op(A)*op(B) + beta*C by the Winograd variant of Strassen's
+//  algorithm.  Arbitrary m, n, k are handled by dynamic peeling: each level
+//  recurses on the even parts and updates odd rows/columns with gemm.
+//
 template <typename IndexType, typename T>
     void
     gemm_strassen(StorageOrder order,
@@ -54,6 +75,42 @@ template <typename IndexType, typename T>
                   const T beta,
                   T *C, IndexType ldC);
 
+template <typename IndexType, typename T>
+    void
+    gemm_strassen(StorageOrder order,
+                  Transpose transA, Transpose transB,
+                  IndexType m, IndexType n, IndexType k,
+                  const T alpha,
+                  const T *A, IndexType ldA,
+                  const T *B, IndexType ldB,
+                  const T beta,
+                  T *C, IndexType ldC,
+                  IndexType cutoff, int taskDepth);
+
+//
+//  Number of elements of type T required as workspace by
+//  gemm_strassen_kernel
+//
+template <typename T, typename IndexType>
+    std::size_t
+    gemm_strassen_workspace(IndexType m, IndexType n, IndexType k,
+                            bool betaIsZero,
+                            IndexType cutoff, int taskDepth);
+
+//
+//  Column major kernel with workspace of gemm_strassen_workspace elements
+//
+template <typename IndexType, typename T>
+    void
+    gemm_strassen_kernel(Transpose transA, Transpose transB,
+                         IndexType m, IndexType n, IndexType k,
+                         const T &alpha,
+                         const T *A, IndexType ldA,
+                         const T *B, IndexType ldB,
+                         const T &beta,
+                         T *C, IndexType ldC,
+                         IndexType cutoff, int taskDepth,
+                         T *work);
 
 } // namespace cxxblas
 
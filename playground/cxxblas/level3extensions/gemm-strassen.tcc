@@ -33,11 +33,16 @@
 #ifndef PLAYGROUND_CXXBLAS_LEVEL3EXTENSION_GEMM_STASSEN_TCC
 #define PLAYGROUND_CXXBLAS_LEVEL3EXTENSION_GEMM_STASSEN_TCC 1
 
+#include <cxxstd/algorithm.h>
 #include <cxxblas/cxxblas.h>
 #include <flens/auxiliary/auxiliary.h>
-#include <cxxblas/auxiliary/pow.h>
+#include <flens/storage/workspace/workspace.h>
 #include <playground/cxxblas/level3extensions/gemm-strassen.h>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 namespace cxxblas {
 
 template <typename IndexType, typename T>
@@ -257,478 +262,417 @@ gemm_complex_3m_kernel(StorageOrder order,
 
 }
 
+//
+//  Z = X + s*Y, elementwise for column major blocks.  Z may be X or Y.
+//
 template <typename IndexType, typename T>
 void
-gemm_strassen_kernel(StorageOrder order,
-                     Transpose transA, Transpose transB,
-                     IndexType m, IndexType n, IndexType k,
-                     T alpha,
-                     const T *A, IndexType ldA,
-                     const T *B, IndexType ldB,
-                     T beta,
-                     T *C, IndexType ldC,
-                     T *ptmp = NULL,
-                     size_t size_tmp = 0)
+gemm_strassen_add(IndexType numRows, IndexType numCols,
+                  const T *X, IndexType ldX,
+                  const T &s,
+                  const T *Y, IndexType ldY,
+                  T *Z, IndexType ldZ)
 {
-/*
- * Implementation of the Winograd Variant of Strassen's
- * Matrix-Matrix Multiply Algorithm. It is based on
- *
- * C Douglas et al:
- * "GEMMW: A Portable Level 3 BLAS  Winograd Variant
- *   of Strassen's Matrix-Matrix Multiply Algorithm."
- * J. Comput. Phys. 110, 1-10, 1994.
- *
- */
-
-    ASSERT(beta==T(0));
-
-    T one(1), zero(0);
-    IndexType min_mnk = std::min(m, std::min(n,k));
-
-    if (min_mnk<=MINDIM) {
-        ASSERT(size_tmp>=0);
-#       ifndef USE_COMPLEX_3M
-            cxxblas::gemm(order, transA, transB,
-                          m, n, k,
-                          alpha,
-                          A, ldA,
-                          B, ldB,
-                          beta,
-                          C, ldC);
-        return;
-#       else
-
-            if(flens::IsReal<T>::value) {
-                cxxblas::gemm(order, transA, transB,
-                              m, n, k,
-                              alpha,
-                              A, ldA,
-                              B, ldB,
-                              beta,
-                              C, ldC);
-            } else {
-                cxxblas::gemm_complex_3m_kernel(order, transA, transB,
-                                                m, n, k,
-                                                alpha,
-                                                A, ldA,
-                                                B, ldB,
-                                                beta,
-                                                C, ldC,
-                                                ptmp, size_tmp);
-            }
-            return;
-
-#       endif
-
+    for (IndexType j=0; j<numCols; ++j) {
+        for (IndexType i=0; i<numRows; ++i) {
+            Z[i+j*ldZ] = X[i+j*ldX] + s*Y[i+j*ldY];
+        }
     }
+}
 
-    bool k_odd = !(k%2==0);
-
-    IndexType mh =  m   /2;
-    IndexType nh =  n   /2;
-    IndexType kh = (k+1)/2;
-
-    const T *pA11 = A;
-    const T *pA21 = (transA==NoTrans || transA==Conj) ? A+mh
-                                                      : A+mh*ldA;
-    const T *pA12 = (transA==NoTrans || transA==Conj) ? A+kh*ldA
-                                                      : A+kh;
-    const T *pA22 = (transA==NoTrans || transA==Conj) ? A+mh+kh*ldA
-                                                      : A+kh+mh*ldA;
-
-    const T *pB11 = B;
-    const T *pB21 = (transB==NoTrans || transB==Conj) ? B+kh
-                                                      : B+kh*ldB;
-    const T *pB12 = (transB==NoTrans || transB==Conj) ? B+nh*ldB
-                                                      : B+nh;
-    const T *pB22 = (transB==NoTrans || transB==Conj) ? B+kh+nh*ldB
-                                                      : B+nh+kh*ldB;
-
-    T *pC11 = C;
-    T *pC21 = C + mh;
-    T *pC12 = C      + nh*ldC;
-    T *pC22 = C + mh + nh*ldC;
-
-    IndexType A_numRows_h = (transA==NoTrans || transA==Conj) ? mh : kh;
-    IndexType A_numCols_h = (transA==NoTrans || transA==Conj) ? kh : mh;
-
-    IndexType B_numRows_h = (transB==NoTrans || transB==Conj) ? kh : nh;
-    IndexType B_numCols_h = (transB==NoTrans || transB==Conj) ? nh : kh;
-
-
-    // Temporary Storage
-    T *ptmpB = ptmp;
-    T *ptmpA = ptmp + nh*kh;
-    T *ptmpC = ptmp + nh*kh;
-
-    ptmp = ptmp + (nh*kh+mh*std::max(kh,nh));
-    ASSERT(size_tmp >= size_t(nh*kh) + size_t(mh*std::max(kh,nh)));
-    size_tmp = size_tmp - nh*kh - mh*std::max(kh,nh);
-
-    // Leading Dimensions of temporary Storage
-    IndexType ld_tmpA = A_numRows_h;
-    IndexType ld_tmpB = B_numRows_h;
-    IndexType ld_tmpC = mh;
-
-
-    // Step 1: tmpB  = B22 - B12;
-    if (!k_odd) {
-        //
-        cxxblas::gecopy(order, NoTrans,
-                        B_numRows_h, B_numCols_h,
-                        pB22, ldB,
-                        ptmpB, ld_tmpB);
-        cxxblas::geaxpy(order, NoTrans,
-                        B_numRows_h, B_numCols_h,
-                        -one,
-                        pB12, ldB,
-                        ptmpB, ld_tmpB);
-    } else {
-        if (transB==NoTrans) {
-            cxxblas::gecopy(order, NoTrans,
-                            kh-1, nh,
-                            pB22, ldB,
-                            ptmpB, ld_tmpB);
-            cxxblas::scal(nh, zero, ptmpB+kh-1, ld_tmpB);
-            cxxblas::geaxpy(order, NoTrans,
-                            kh, nh,
-                            -one,
-                            pB12, ldB,
-                            ptmpB, ld_tmpB);
-        } else {
-            cxxblas::scal(nh, zero, ptmpB+(kh-1)*ld_tmpB, IndexType(1));
-            cxxblas::gecopy(order, NoTrans,
-                            nh, kh-1,
-                            pB22, ldB,
-                            ptmpB, ld_tmpB);
-            cxxblas::geaxpy(order, NoTrans,
-                            nh, kh,
-                            -one,
-                            pB12, ldB,
-                            ptmpB, ld_tmpB);
+template <typename T, typename IndexType>
+std::size_t
+gemm_strassen_workspace(IndexType m, IndexType n, IndexType k,
+                        bool betaIsZero,
+                        IndexType cutoff, int taskDepth)
+{
+    using std::max;
+    using std::min;
+
+    if (min(m, min(n, k))<=cutoff) {
+#       ifdef USE_COMPLEX_3M
+        if (flens::IsComplex<T>::value && betaIsZero) {
+            return (std::size_t(m)*k + std::size_t(k)*n + 1)/2;
         }
+#       endif
+        return 0;
     }
 
+    const std::size_t mh = m/2, nh = n/2, kh = k/2;
 
-    // Step 2: tmpA  = A11 - A21;
-    cxxblas::gecopy(order, NoTrans,
-                    A_numRows_h, A_numCols_h,
-                    pA11, ldA,
-                    ptmpA, ld_tmpA);
+    std::size_t size = (betaIsZero) ? 0 : 4*mh*nh;
 
-    cxxblas::geaxpy(order, NoTrans,
-                    A_numRows_h, A_numCols_h,
-                    -one,
-                    pA21,ldA,
-                    ptmpA, ld_tmpA);
-
-    // Step 3: C21 = alpha*op(tmpA)*op(tmpB)
-    cxxblas::gemm_strassen_kernel(order, transA, transB,
-                                  mh, nh, kh,
-                                  alpha,
-                                  ptmpA, ld_tmpA,
-                                  ptmpB, ld_tmpB,
-                                  zero,
-                                  pC21, ldC,
-                                  ptmp, size_tmp);
-
-    // Step 4: tmpA = A21 + A22;
-    if (!k_odd) {
-        cxxblas::gecopy(order, NoTrans,
-                        A_numRows_h, A_numCols_h,
-                        pA21, ldA,
-                        ptmpA, ld_tmpA);
-        cxxblas::geaxpy(order, NoTrans,
-                        A_numRows_h, A_numCols_h,
-                        one,
-                        pA22, ldA,
-                        ptmpA, ld_tmpA);
+    const std::size_t sub = gemm_strassen_workspace<T>(IndexType(mh),
+                                                       IndexType(nh),
+                                                       IndexType(kh),
+                                                       true, cutoff,
+                                                       taskDepth-1);
+    if (taskDepth>0) {
+        size += 4*mh*kh + 4*kh*nh + 3*mh*nh + 7*sub;
     } else {
-        if (transA==NoTrans || transA==Conj) {
-            cxxblas::gecopy(order, NoTrans,
-                            A_numRows_h, A_numCols_h,
-                            pA21, ldA,
-                            ptmpA, ld_tmpA);
-            cxxblas::geaxpy(order, NoTrans,
-                            A_numRows_h, A_numCols_h-1,
-                            one,
-                            pA22, ldA,
-                            ptmpA, ld_tmpA);
-        } else {
-            cxxblas::gecopy(order, NoTrans,
-                            A_numRows_h, A_numCols_h,
-                            pA21, ldA,
-                            ptmpA, ld_tmpA);
-            cxxblas::geaxpy(order, NoTrans,
-                            A_numRows_h-1, A_numCols_h,
-                            one,
-                            pA22, ldA,
-                            ptmpA, ld_tmpA);
-        }
+        size += mh*max(kh, nh) + kh*nh + sub;
     }
+    return size;
+}
 
-    // Step 5: tmpB = B12 - B11;
-    cxxblas::gecopy(order, NoTrans,
-                    B_numRows_h, B_numCols_h,
-                    pB12, ldB,
-                    ptmpB, ld_tmpB);
-    cxxblas::geaxpy(order, NoTrans,
-                    B_numRows_h, B_numCols_h,
-                    -one,
-                    pB11, ldB,
-                    ptmpB, ld_tmpB);
-
-    // Step 6: C22 = alpha*op(tmpA)*op(tmpB);
-    cxxblas::gemm_strassen_kernel(order, transA, transB,
-                                  mh, nh, kh,
-                                  alpha,
-                                  ptmpA, ld_tmpA,
-                                  ptmpB, ld_tmpB,
-                                  zero,
-                                  pC22, ldC,
-                                  ptmp, size_tmp);
-
-    // Step 7: tmpB = tmpB - B22;
-    if (!k_odd) {
-        cxxblas::geaxpy(order, NoTrans,
-                        B_numRows_h, B_numCols_h,
-                        -one,
-                        pB22, ldB,
-                        ptmpB, ld_tmpB);
-    } else {
-        if (transB==NoTrans || transB==Conj) {
-            cxxblas::geaxpy(order, NoTrans,
-                            B_numRows_h-1, B_numCols_h,
-                            -one,
-                            pB22, ldB,
-                            ptmpB, ld_tmpB);
-        } else {
-            cxxblas::geaxpy(order, NoTrans,
-                            B_numRows_h, B_numCols_h-1,
-                            -one,
-                            pB22, ldB,
-                            ptmpB, ld_tmpB);
-        }
+//
+//  C = alpha*op(A)*op(B) for even m, n, k.  Implementation of the Winograd
+//  variant of Strassen's Matrix-Matrix Multiply Algorithm.  It is based on
+//
+//    C Douglas et al:
+//    "GEMMW: A Portable Level 3 BLAS  Winograd Variant
+//     of Strassen's Matrix-Matrix Multiply Algorithm."
+//    J. Comput. Phys. 110, 1-10, 1994.
+//
+//  and for the sequential schedule (two temporaries, the quadrants of C hold
+//  intermediate results) on
+//
+//    B Boyer et al:
+//    "Memory efficient scheduling of Strassen-Winograd's matrix
+//     multiplication algorithm."
+//    ISSAC 2009.
+//
+template <typename IndexType, typename T>
+void
+gemm_strassen_split(Transpose transA, Transpose transB,
+                    IndexType m, IndexType n, IndexType k,
+                    const T &alpha,
+                    const T *A, IndexType ldA,
+                    const T *B, IndexType ldB,
+                    T *C, IndexType ldC,
+                    IndexType cutoff, int taskDepth,
+                    T *work)
+{
+    using std::max;
+
+    const bool noTransA = (transA==NoTrans || transA==Conj);
+    const bool noTransB = (transB==NoTrans || transB==Conj);
+
+    const IndexType mh = m/2, nh = n/2, kh = k/2;
+
+//
+//  Quadrants of op(A), op(B) and C.  The sums of quadrants of A and B keep
+//  the storage layout of A and B, i.e. they are numRowsA x numColsA and
+//  numRowsB x numColsB blocks.
+//
+    const T *A11 = A;
+    const T *A12 = (noTransA) ? A+kh*ldA    : A+kh;
+    const T *A21 = (noTransA) ? A+mh        : A+mh*ldA;
+    const T *A22 = (noTransA) ? A+mh+kh*ldA : A+kh+mh*ldA;
+
+    const T *B11 = B;
+    const T *B12 = (noTransB) ? B+nh*ldB    : B+nh;
+    const T *B21 = (noTransB) ? B+kh        : B+kh*ldB;
+    const T *B22 = (noTransB) ? B+kh+nh*ldB : B+nh+kh*ldB;
+
+    T *C11 = C;
+    T *C12 = C+nh*ldC;
+    T *C21 = C+mh;
+    T *C22 = C+mh+nh*ldC;
+
+    const IndexType numRowsA = (noTransA) ? mh : kh;
+    const IndexType numColsA = (noTransA) ? kh : mh;
+    const IndexType numRowsB = (noTransB) ? kh : nh;
+    const IndexType numColsB = (noTransB) ? nh : kh;
+
+    const T one(1), zero(0);
+
+    if (taskDepth<=0) {
+//
+//      Sequential schedule with X (mh x max(kh,nh)) and Y (kh x nh)
+//
+        T *X    = work;
+        T *Y    = X + std::size_t(mh)*max(kh, nh);
+        T *next = Y + std::size_t(kh)*nh;
+
+        const IndexType ldX = numRowsA;
+        const IndexType ldY = numRowsB;
+
+        // X = A11 - A21 (S3), Y = B22 - B12 (T3), C21 = X*Y (P7)
+        gemm_strassen_add(numRowsA, numColsA, A11, ldA, -one, A21, ldA,
+                          X, ldX);
+        gemm_strassen_add(numRowsB, numColsB, B22, ldB, -one, B12, ldB,
+                          Y, ldY);
+        gemm_strassen_kernel(transA, transB, mh, nh, kh, alpha,
+                             X, ldX, Y, ldY, zero, C21, ldC,
+                             cutoff, 0, next);
+
+        // X = A21 + A22 (S1), Y = B12 - B11 (T1), C22 = X*Y (P5)
+        gemm_strassen_add(numRowsA, numColsA, A21, ldA, one, A22, ldA,
+                          X, ldX);
+        gemm_strassen_add(numRowsB, numColsB, B12, ldB, -one, B11, ldB,
+                          Y, ldY);
+        gemm_strassen_kernel(transA, transB, mh, nh, kh, alpha,
+                             X, ldX, Y, ldY, zero, C22, ldC,
+                             cutoff, 0, next);
+
+        // X = X - A11 (S2), Y = B22 - Y (T2), C12 = X*Y (P6)
+        gemm_strassen_add(numRowsA, numColsA, X, ldX, -one, A11, ldA,
+                          X, ldX);
+        gemm_strassen_add(numRowsB, numColsB, B22, ldB, -one, Y, ldY,
+                          Y, ldY);
+        gemm_strassen_kernel(transA, transB, mh, nh, kh, alpha,
+                             X, ldX, Y, ldY, zero, C12, ldC,
+                             cutoff, 0, next);
+
+        // X = A12 - X (S4), C11 = X*B22 (P3)
+        gemm_strassen_add(numRowsA, numColsA, A12, ldA, -one, X, ldX,
+                          X, ldX);
+        gemm_strassen_kernel(transA, transB, mh, nh, kh, alpha,
+                             X, ldX, B22, ldB, zero, C11, ldC,
+                             cutoff, 0, next);
+
+        // X = A11*B11 (P1), mh x nh
+        gemm_strassen_kernel(transA, transB, mh, nh, kh, alpha,
+                             A11, ldA, B11, ldB, zero, X, mh,
+                             cutoff, 0, next);
+
+        // C12 = X + C12 (U2), C21 = C12 + C21 (U3), C12 = C12 + C22 (U4)
+        // C22 = C21 + C22 (U7), C12 = C12 + C11 (U5)
+        gemm_strassen_add(mh, nh, C12, ldC, one, X, mh, C12, ldC);
+        gemm_strassen_add(mh, nh, C21, ldC, one, C12, ldC, C21, ldC);
+        gemm_strassen_add(mh, nh, C12, ldC, one, C22, ldC, C12, ldC);
+        gemm_strassen_add(mh, nh, C22, ldC, one, C21, ldC, C22, ldC);
+        gemm_strassen_add(mh, nh, C12, ldC, one, C11, ldC, C12, ldC);
+
+        // Y = Y - B21 (T4), C11 = A22*Y (P4), C21 = C21 - C11 (U6)
+        gemm_strassen_add(numRowsB, numColsB, Y, ldY, -one, B21, ldB,
+                          Y, ldY);
+        gemm_strassen_kernel(transA, transB, mh, nh, kh, alpha,
+                             A22, ldA, Y, ldY, zero, C11, ldC,
+                             cutoff, 0, next);
+        gemm_strassen_add(mh, nh, C21, ldC, -one, C11, ldC, C21, ldC);
+
+        // C11 = A12*B21 (P2), C11 = X + C11 (U1)
+        gemm_strassen_kernel(transA, transB, mh, nh, kh, alpha,
+                             A12, ldA, B21, ldB, zero, C11, ldC,
+                             cutoff, 0, next);
+        gemm_strassen_add(mh, nh, C11, ldC, one, X, mh, C11, ldC);
+        return;
     }
 
-    // Step 8: tmpA = tmpA - A11;
-    cxxblas::geaxpy(order, NoTrans,
-                    A_numRows_h, A_numCols_h,
-                    -one,
-                    pA11, ldA,
-                    ptmpA, ld_tmpA);
-
-    // Step 9: C11 = -alpha*op(tmpA)*op(tmpB);
-    cxxblas::gemm_strassen_kernel(order, transA, transB,
-                                  mh, nh, kh,
-                                  -alpha,
-                                  ptmpA, ld_tmpA,
-                                  ptmpB, ld_tmpB,
-                                  zero,
-                                  pC11, ldC,
-                                  ptmp, size_tmp);
-
-    // Step 10: tmpA = tmpA - A12;
-    if (!k_odd) {
-
-        cxxblas::geaxpy(order, NoTrans,
-                        A_numRows_h, A_numCols_h,
-                        -one,
-                        pA12, ldA,
-                        ptmpA, ld_tmpA);
-
-    } else {
-        if (transA==NoTrans || transA==Conj) {
-
-            cxxblas::geaxpy(order, NoTrans,
-                            A_numRows_h, A_numCols_h-1,
-                           -one,
-                           pA12, ldA,
-                           ptmpA, ld_tmpA);
+//
+//  Task parallel schedule: all sums and the products P1, P6, P7 get their
+//  own buffers, P2, P3, P4, P5 go to the quadrants of C.
+//
+    const std::size_t sizeA = std::size_t(mh)*kh;
+    const std::size_t sizeB = std::size_t(kh)*nh;
+    const std::size_t sizeC = std::size_t(mh)*nh;
+    const std::size_t sizeW = gemm_strassen_workspace<T>(mh, nh, kh, true,
+                                                         cutoff,
+                                                         taskDepth-1);
+
+    T *S1 = work,    *S2 = S1+sizeA, *S3 = S2+sizeA, *S4 = S3+sizeA;
+    T *T1 = S4+sizeA, *T2 = T1+sizeB, *T3 = T2+sizeB, *T4 = T3+sizeB;
+    T *P1 = T4+sizeB, *P6 = P1+sizeC, *P7 = P6+sizeC;
+    T *W  = P7+sizeC;
+
+    const IndexType ldS = numRowsA;
+    const IndexType ldT = numRowsB;
+
+    gemm_strassen_add(numRowsA, numColsA, A21, ldA,  one, A22, ldA, S1, ldS);
+    gemm_strassen_add(numRowsA, numColsA, S1,  ldS, -one, A11, ldA, S2, ldS);
+    gemm_strassen_add(numRowsA, numColsA, A11, ldA, -one, A21, ldA, S3, ldS);
+    gemm_strassen_add(numRowsA, numColsA, A12, ldA, -one, S2,  ldS, S4, ldS);
+
+    gemm_strassen_add(numRowsB, numColsB, B12, ldB, -one, B11, ldB, T1, ldT);
+    gemm_strassen_add(numRowsB, numColsB, B22, ldB, -one, T1,  ldT, T2, ldT);
+    gemm_strassen_add(numRowsB, numColsB, B22, ldB, -one, B12, ldB, T3, ldT);
+    gemm_strassen_add(numRowsB, numColsB, T2,  ldT, -one, B21, ldB, T4, ldT);
+
+    const T     *opA[7] = { A11, A12, S4,  A22, S1,  S2,  S3  };
+    const T     *opB[7] = { B11, B21, B22, T4,  T1,  T2,  T3  };
+    T           *P[7]   = { P1,  C11, C12, C21, C22, P6,  P7  };
+
+    const IndexType ldOpA[7] = { ldA, ldA, ldS, ldA, ldS, ldS, ldS };
+    const IndexType ldOpB[7] = { ldB, ldB, ldB, ldT, ldT, ldT, ldT };
+    const IndexType ldP[7]   = { mh,  ldC, ldC, ldC, ldC, mh,  mh  };
+
+    for (int l=0; l<7; ++l) {
+#       ifdef _OPENMP
+#       pragma omp task firstprivate(l) shared(opA, opB, P, ldOpA, ldOpB, ldP)
+#       endif
+        gemm_strassen_kernel(transA, transB, mh, nh, kh, alpha,
+                             opA[l], ldOpA[l], opB[l], ldOpB[l],
+                             zero, P[l], ldP[l],
+                             cutoff, taskDepth-1, W+l*sizeW);
+    }
+#   ifdef _OPENMP
+#   pragma omp taskwait
+#   endif
+
+    // C11 = C11 + P1 (U1), P1 = P1 + P6 (U2), P7 = P7 + P1 (U3)
+    // P1 = P1 + C22 (U4), C12 = C12 + P1 (U5), C22 = C22 + P7 (U7)
+    // C21 = P7 - C21 (U6)
+    gemm_strassen_add(mh, nh, C11, ldC, one, P1, mh, C11, ldC);
+    gemm_strassen_add(mh, nh, P1, mh, one, P6, mh, P1, mh);
+    gemm_strassen_add(mh, nh, P7, mh, one, P1, mh, P7, mh);
+    gemm_strassen_add(mh, nh, P1, mh, one, C22, ldC, P1, mh);
+    gemm_strassen_add(mh, nh, C12, ldC, one, P1, mh, C12, ldC);
+    gemm_strassen_add(mh, nh, C22, ldC, one, P7, mh, C22, ldC);
+    gemm_strassen_add(mh, nh, P7, mh, -one, C21, ldC, C21, ldC);
+}
 
-        } else {
+template <typename IndexType, typename T>
+void
+gemm_strassen_kernel(Transpose transA, Transpose transB,
+                     IndexType m, IndexType n, IndexType k,
+                     const T &alpha,
+                     const T *A, IndexType ldA,
+                     const T *B, IndexType ldB,
+                     const T &beta,
+                     T *C, IndexType ldC,
+                     IndexType cutoff, int taskDepth,
+                     T *work)
+{
+    using std::min;
 
-            cxxblas::geaxpy(order, NoTrans,
-                            A_numRows_h-1, A_numCols_h,
-                           -one,
-                           pA12, ldA,
-                           ptmpA, ld_tmpA);
+    if (min(m, min(n, k))<=cutoff) {
+#       ifdef USE_COMPLEX_3M
+        if (flens::IsComplex<T>::value && beta==T(0)) {
+            gemm_complex_3m_kernel(ColMajor, transA, transB, m, n, k,
+                                   alpha, A, ldA, B, ldB, beta, C, ldC,
+                                   work, (std::size_t(m)*k
+                                          + std::size_t(k)*n + 1)/2);
+            return;
         }
+#       endif
+        gemm(ColMajor, transA, transB, m, n, k,
+             alpha, A, ldA, B, ldB,
+             beta, C, ldC);
+        return;
     }
 
-    // Step 11: C12 = -alpha*op(tmpA)*op(B22);
-    if (!k_odd) {
-        cxxblas::gemm_strassen_kernel(order, transA, transB,
-                                      mh, nh, kh,
-                                      -alpha,
-                                      ptmpA, ld_tmpA,
-                                      pB22, ldB,
-                                      zero,
-                                      pC12, ldC,
-                                      ptmp, size_tmp);
+    const bool noTransA = (transA==NoTrans || transA==Conj);
+    const bool noTransB = (transB==NoTrans || transB==Conj);
+
+//
+//  Dynamic peeling:
+//
+//    [ C11 c12 ]   [ A11 a12 ] [ B11 b12 ]
+//    [ c21 c22 ] = [ a21 a22 ] [ b21 b22 ]
+//
+//  with even sized C11 = A11*B11 + a12*b21 computed recursively.
+//
+    const IndexType m2 = m - m%2;
+    const IndexType n2 = n - n%2;
+    const IndexType k2 = k - k%2;
+
+    if (beta==T(0)) {
+        gemm_strassen_split(transA, transB, m2, n2, k2, alpha,
+                            A, ldA, B, ldB, C, ldC,
+                            cutoff, taskDepth, work);
     } else {
-        if (transA==NoTrans || transA==Conj) {
-
-            cxxblas::gemm_strassen_kernel(order, transA, transB,
-                                          mh, nh, kh-1,
-                                          -alpha,
-                                          ptmpA, ld_tmpA,
-                                          pB22, ldB,
-                                          zero,
-                                          pC12, ldC,
-                                          ptmp, size_tmp);
-        } else {
-            cxxblas::gemm_strassen_kernel(order, transA, transB,
-                                          mh, nh, kh-1,
-                                          -alpha,
-                                          ptmpA, ld_tmpA,
-                                          pB22, ldB,
-                                          zero,
-                                          pC12, ldC,
-                                          ptmp, size_tmp);
-        }
-    }
+        T *P = work;
 
-    // Step 12: C12 = C12 + C22;
-    cxxblas::geaxpy(order, NoTrans,
-                    mh, nh,
-                    one,
-                    pC22, ldC,
-                    pC12, ldC);
-
-    // Step 13: tmpC = alpha*op(A11)*op(B11);
-    cxxblas::gemm_strassen_kernel(order, transA, transB,
-                                  mh, nh, kh,
-                                  alpha,
-                                  pA11, ldA,
-                                  pB11, ldB,
-                                  zero,
-                                  ptmpC, ld_tmpC,
-                                  ptmp, size_tmp);
-
-    // Step 14: C11 = C11 + tmpC;
-    cxxblas::geaxpy(order, NoTrans,
-                    mh, nh,
-                    one,
-                    ptmpC, ld_tmpC,
-                   pC11, ldC);
-
-    // Step 15: C12 = C12 + C11;
-    cxxblas::geaxpy(order, NoTrans,
-                    mh, nh,
-                    one,
-                    pC11, ldC,
-                    pC12, ldC);
+        gemm_strassen_split(transA, transB, m2, n2, k2, alpha,
+                            A, ldA, B, ldB, P, m2,
+                            cutoff, taskDepth, work+std::size_t(m2)*n2);
+        gemm_strassen_add(m2, n2, P, m2, beta, C, ldC, C, ldC);
+    }
 
-    // Step 16: C11 = C11 + C21;
-    cxxblas::geaxpy(order, NoTrans,
-                    mh, nh,
-                    one,
-                    pC21, ldC,
-                    pC11, ldC);
+    if (k2<k) {
+        const T *a12 = (noTransA) ? A+k2*ldA : A+k2;
+        const T *b21 = (noTransB) ? B+k2     : B+k2*ldB;
 
-    // Step 17: tmpB = tmpB + B21;
-    if (!k_odd) {
+        gemm(ColMajor, transA, transB, m2, n2, IndexType(1),
+             alpha, a12, ldA, b21, ldB,
+             T(1), C, ldC);
+    }
+    if (m2<m) {
+        const T *a2 = (noTransA) ? A+m2 : A+m2*ldA;
 
-        cxxblas::geaxpy(order, NoTrans,
-                        B_numRows_h, B_numCols_h,
-                        one,
-                        pB21, ldB,
-                        ptmpB, ld_tmpB);
+        gemm(ColMajor, transA, transB, IndexType(1), n, k,
+             alpha, a2, ldA, B, ldB,
+             beta, C+m2, ldC);
+    }
+    if (n2<n) {
+        const T *b2 = (noTransB) ? B+n2*ldB : B+n2;
 
-    } else {
-        if (transB==NoTrans || transB==Conj) {
+        gemm(ColMajor, transA, transB, m2, IndexType(1), k,
+             alpha, A, ldA, b2, ldB,
+             beta, C+n2*ldC, ldC);
+    }
+}
 
-            cxxblas::geaxpy(order, NoTrans,
-                            B_numRows_h-1, B_numCols_h,
-                            one,
-                            pB21, ldB,
-                            ptmpB, ld_tmpB);
+template <typename IndexType, typename T>
+void
+gemm_strassen(StorageOrder order,
+              Transpose transA, Transpose transB,
+              IndexType m, IndexType n, IndexType k,
+              const T alpha,
+              const T *A, IndexType ldA,
+              const T *B, IndexType ldB,
+              const T beta,
+              T *C, IndexType ldC,
+              IndexType cutoff, int taskDepth)
+{
+    CXXBLAS_DEBUG_OUT("gemm strassen algorithm");
 
-        } else {
+    using std::min;
 
-            cxxblas::geaxpy(order, NoTrans,
-                            B_numRows_h, B_numCols_h-1,
-                            one,
-                            pB21, ldB,
-                            ptmpB, ld_tmpB);
-        }
+    if ((m==0) || (n==0)) {
+        return;
     }
 
-    // Step 18: C12 = -alpha*op(A22)*op(tmpB);
-    if (!k_odd) {
-        cxxblas::gemm_strassen_kernel(order, transA, transB,
-                                      mh, nh, kh,
-                                      alpha,
-                                      pA22, ldA,
-                                      ptmpB, ld_tmpB,
-                                      zero,
-                                      pC21, ldC,
-                                      ptmp, size_tmp);
-    } else {
-        if (transB==NoTrans || transB==Conj) {
-            cxxblas::gemm_strassen_kernel(order, transA, transB,
-                                          mh, nh, kh-1,
-                                          alpha,
-                                          pA22, ldA,
-                                          ptmpB, ld_tmpB,
-                                          zero,
-                                          pC21, ldC,
-                                          ptmp, size_tmp);
-        }  else {
-            cxxblas::gemm_strassen_kernel(order, transA, transB,
-                                          mh, nh, kh-1,
-                                          alpha,
-                                          pA22, ldA,
-                                          ptmpB, ld_tmpB,
-                                          zero,
-                                          pC21, ldC,
-                                          ptmp, size_tmp);
-        }
+    if (order==RowMajor) {
+        gemm_strassen(ColMajor, transB, transA, n, m, k,
+                      alpha, B, ldB, A, ldA,
+                      beta, C, ldC,
+                      cutoff, taskDepth);
+        return;
     }
-    // Step 19: C21 = C21  + C11;
-    cxxblas::geaxpy(order, NoTrans,
-                    mh, nh,
-                    one,
-                    pC11, ldC,
-                    pC21, ldC);
 
-    // Step 20: C22 = C22 + C11;
-    cxxblas::geaxpy(order, NoTrans,
-                    mh, nh,
-                    one,
-                    pC11, ldC,
-                    pC22, ldC);
-
-    // Step 21: C11 = alpha*op(A12)*op(B21);
-    if (!k_odd) {
-        cxxblas::gemm_strassen_kernel(order, transA, transB,
-                                      mh, nh, kh,
-                                      alpha,
-                                      pA12, ldA,
-                                      pB21, ldB,
-                                      zero,
-                                      pC11, ldC,
-                                      ptmp, size_tmp);
-    } else {
-        cxxblas::gemm_strassen_kernel(order, transA, transB,
-                                      mh, nh, kh-1,
-                                      alpha,
-                                      pA12, ldA,
-                                      pB21, ldB,
-                                      zero,
-                                      pC11, ldC,
-                                      ptmp, size_tmp);
+    if (min(m, min(n, k))<=cutoff) {
+        gemm(ColMajor, transA, transB, m, n, k,
+             alpha, A, ldA, B, ldB,
+             beta, C, ldC);
+        return;
     }
 
-    // Step 22: C11 = C11 + tmpC;
-    cxxblas::geaxpy(order, NoTrans,
-                    mh, nh,
-                    one,
-                    ptmpC, ld_tmpC,
-                    pC11, ldC);
+//
+//  Tasks only pay off if there is more than one thread and we are not
+//  already inside a parallel region.
+//
+#   ifdef _OPENMP
+    if (omp_get_max_threads()==1 || omp_in_parallel()) {
+        taskDepth = 0;
+    }
+#   else
+    taskDepth = 0;
+#   endif
+
+    CXXBLAS_PROFILE_SCOPE("gemm_strassen", ProfileGeneric, long(m)*n*k,
+                          (flens::IsComplex<T>::value ? 8. : 2.)*m*n*k,
+                          (double(k)*(m+n)+2.*m*n)*sizeof(T));
+
+//
+//  The workspace for the whole recursion is allocated once
+//
+    const std::size_t size = gemm_strassen_workspace<T>(m, n, k,
+                                                        beta==T(0),
+                                                        cutoff, taskDepth)
+                           * sizeof(T);
+    T *work = static_cast<T *>(flens::Workspace::allocate(size));
+
+#   ifdef _OPENMP
+    if (taskDepth>0) {
+#       pragma omp parallel
+#       pragma omp single
+        gemm_strassen_kernel(transA, transB, m, n, k,
+                             alpha, A, ldA, B, ldB,
+                             beta, C, ldC,
+                             cutoff, taskDepth, work);
+    } else
+#   endif
+    {
+        gemm_strassen_kernel(transA, transB, m, n, k,
+                             alpha, A, ldA, B, ldB,
+                             beta, C, ldC,
+                             cutoff, taskDepth, work);
+    }
 
+    flens::Workspace::deallocate(work, size);
 }
 
 template <typename IndexType, typename T>
@@ -736,172 +680,18 @@ void
 gemm_strassen(StorageOrder order,
               Transpose transA, Transpose transB,
               IndexType m, IndexType n, IndexType k,
-              T alpha,
+              const T alpha,
               const T *A, IndexType ldA,
               const T *B, IndexType ldB,
-              T beta,
+              const T beta,
               T *C, IndexType ldC)
 {
-        CXXBLAS_DEBUG_OUT("gemm strassen algorithm");
-
-        using std::min;
-
-        T one(1), zero(0);
-
-        IndexType min_mnk = min(m,min(n,k));
-
-        IndexType num_divides = 0;
-
-        IndexType test_min_mnk = min_mnk;
-        while (test_min_mnk>MINDIM) {
-                test_min_mnk = (test_min_mnk+1)/2;
-                ++num_divides;
-        }
-
-        IndexType mr = m-(m%IndexType(cxxblas::pow(IndexType(2),num_divides)));
-        IndexType nr = n-(n%IndexType(cxxblas::pow(IndexType(2),num_divides)));
-
-        num_divides = 0;
-
-        test_min_mnk = min(k, min(mr, nr));
-        while (test_min_mnk>MINDIM) {
-                test_min_mnk = (test_min_mnk+1)/2;
-                ++num_divides;
-        }
-
-
-        IndexType nh = nr/2;
-        IndexType mh = mr/2;
-        IndexType kh = (k+1)/2;
-
-        // Calculate Storage
-        size_t size_tmp = 0;
-        for (IndexType i=1; i<=num_divides; ++i)
-        {
-                size_tmp += nh*kh+mh*std::max(kh,nh);
-                mh = mh/2;
-                nh = nh/2;
-                kh = (kh+1)/2;
-        }
-
-#       ifdef USE_COMPLEX_3M
-            // Additional Storage for three-sum trick
-            if (flens::IsComplex<T>::value) {
-                size_tmp += ((mh+1)*(kh+1))*2 +((kh+1)*(nh+1))*2;
-            }
-#       endif
-
-        bool m_odd = !(m==mr);
-        bool n_odd = !(n==nr);
-
-        T *ptmp = new T[size_tmp];
-        if (beta==zero) {
-            cxxblas::gemm_strassen_kernel(order, transA, transB,
-                                          mr, nr, k,
-                                          alpha,
-                                          A, ldA,
-                                          B, ldB,
-                                          zero,
-                                          C, ldC,
-                                          ptmp, size_tmp);
-        } else {
-                T *tmp_C = new T[mr*nr];
-                cxxblas::gemm_strassen_kernel(order, transA, transB,
-                                              mr, nr, k,
-                                              alpha,
-                                              A, ldA,
-                                              B, ldB,
-                                              zero,
-                                              tmp_C, mr,
-                                              ptmp, size_tmp);
-                cxxblas::gescal(order, mr, nr, beta, C, ldC);
-                cxxblas::geaxpy(order, NoTrans,
-                                mr, nr,
-                                one,
-                                tmp_C, mr,
-                                C, ldC);
-                delete[] tmp_C;
-        }
-        delete[] ptmp;
-
-        // Handle rows and columns with were stripped off
-        if (n_odd && !m_odd) {
-                if ( (transB==NoTrans) || (transB==Conj) ) {
-                    cxxblas::gemm(order, transA, transB,
-                                  m, n-nr, k,
-                                  alpha,
-                                  A, ldA,
-                                  B+nr*ldB, ldB,
-                                  beta,
-                                  C+nr*ldC, ldC);
-                } else {
-                    cxxblas::gemm(order, transA, transB,
-                                  m, n-nr, k,
-                                  alpha,
-                                  A, ldA,
-                                  B+nr, ldB,
-                                  beta,
-                                  C+nr*ldC, ldC);
-                }
-        } else if (!n_odd && m_odd){
-                if ( (transA==NoTrans) || (transA==Conj) ) {
-                    cxxblas::gemm(order, transA, transB,
-                                  m-mr, n, k,
-                                  alpha,
-                                  A+mr, ldA,
-                                  B, ldB,
-                                  beta,
-                                  C+mr, ldC);
-                } else {
-                    cxxblas::gemm(order, transA, transB,
-                                  m-mr, n, k,
-                                  alpha,
-                                  A+mr*ldA, ldA,
-                                  B, ldB,
-                                  beta,
-                                  C+mr, ldC);
-                }
-        } else if (n_odd && m_odd) {
-                if ( (transB==NoTrans) || (transB==Conj) ) {
-                    cxxblas::gemm(order, transA, transB,
-                                  m, n-nr, k,
-                                  alpha,
-                                  A, ldA,
-                                  B+nr*ldB, ldB,
-                                  beta,
-                                  C+nr*ldC, ldC);
-                } else {
-                    cxxblas::gemm(order, transA, transB,
-                                  m, n-nr, k,
-                                  alpha,
-                                  A, ldA,
-                                  B+nr, ldB,
-                                  beta,
-                                  C+nr*ldC, ldC);
-                }
-                if ( (transA==NoTrans) || (transA==Conj) ) {
-                    cxxblas::gemm(order, transA, transB,
-                                  m-mr, nr, k,
-                                  alpha,
-                                  A+mr, ldA,
-                                  B, ldB,
-                                  beta,
-                                  C+mr, ldC);
-                } else {
-                    cxxblas::gemm(order, transA, transB,
-                                  m-mr, nr, k,
-                                  alpha,
-                                  A+mr*ldA, ldA,
-                                  B, ldB,
-                                  beta,
-                                  C+mr, ldC);
-                }
-        }
-
-        return;
+    gemm_strassen(order, transA, transB, m, n, k,
+                  alpha, A, ldA, B, ldB,
+                  beta, C, ldC,
+                  IndexType(STRASSEN_CUTOFF), STRASSEN_TASK_DEPTH);
 }
 
-
 } // namespace cxxblas
 
 #endif // PLAYGROUND_CXXBLAS_LEVEL3EXTENSION_GEMM_STASSEN_TCC
@@ -0,0 +1,70 @@
+#include <cxxstd/iostream.h>
+
+#define USE_PLAYGROUND
+#include <flens/flens.cxx>
+
+using namespace std;
+using namespace flens;
+
+typedef double   T;
+
+int
+main()
+{
+    ///
+    /// Define convenient matrix types ...
+    ///
+    typedef CoordStorage<T, CoordRowColCmp>     Coord;
+    typedef SyCRSMatrix<CRS<T> >                SparseMatrix;
+    typedef GeMatrix<FullStorage<T> >           Matrix;
+    typedef Matrix::IndexType                   IndexType;
+
+    ///
+    /// Setup the 1D Poisson matrix in coordinate storage (upper part only)
+    /// and convert it to compressed row storage
+    ///
+    const IndexType n    = 100;
+    const IndexType nRhs = 8;
+
+    SyCoordMatrix<Coord>  A_(n, Upper);
+    for (IndexType i=1; i<=n; ++i) {
+        A_(i,i) += 2;
+        if (i<n) {
+            A_(i,i+1) -= 1;
+        }
+    }
+    SparseMatrix  A = A_;
+
+    ///
+    /// All right-hand sides are solved at once.  Columns that converged
+    /// early get deflated.
+    ///
+    Matrix  X(n, nRhs), B(n, nRhs), R;
+
+    for (IndexType j=1; j<=nRhs; ++j) {
+        for (IndexType i=1; i<=n; ++i) {
+            B(i,j) = (i % (j+1)==0) ? T(1) : T(0);
+        }
+    }
+
+    IndexType it = solver::blockcg(A, X, B);
+    cout << "blockcg: " << ((it==0) ? "converged" : "not converged") << endl;
+
+    R  = A*X;
+    R -= B;
+    cout << "|A*X - B| = " << blas::asum(R.vectorView()) << endl;
+
+    ///
+    /// The same with BiCGStab
+    ///
+    X  = T(0);
+    it = solver::blockbicgstab(A, X, B, 1e-20);
+    cout << "blockbicgstab: " << ((it==0) ? "converged" : "not converged")
+         << endl;
+
+    R  = A*X;
+    R -= B;
+    cout << "|A*X - B| = " << blas::asum(R.vectorView()) << endl;
+
+    return 0;
+}
@@ -0,0 +1,128 @@
+#include <cxxstd/cstdlib.h>
+#include <cxxstd/iostream.h>
+
+#define USE_PLAYGROUND
+#define WITH_MPI
+#include <flens/flens.cxx>
+
+using namespace std;
+using namespace flens;
+using namespace mpi;
+
+typedef double   T;
+
+///
+///  Solves the 2D Poisson problem (5-point stencil on an n x n grid) with
+///  the solvers from playground/flens/solver on a row partitioned sparse
+///  matrix.  Run e.g. with
+///
+///      mpirun -np 4 ./example-mpi-cg [n]
+///
+void
+run(int n)
+{
+    typedef CoordStorage<T>                     Coord;
+    typedef DistGeCRSMatrix<T>                  Matrix;
+    typedef Matrix::Vector                      Vector;
+    typedef Matrix::IndexType                   IndexType;
+
+    const int rank     = MPI_rank();
+    const int numProcs = MPI_size();
+
+    ///
+    /// Each process sets up its rows of the matrix with global column
+    /// indices.
+    ///
+    const IndexType N        = IndexType(n)*n;
+    const IndexType first    = (N*rank)/numProcs + 1;
+    const IndexType last     = (N*(rank+1))/numProcs;
+    const IndexType numLocal = last-first+1;
+
+    GeCoordMatrix<Coord>  localCoord(numLocal, N);
+
+    for (IndexType k=first; k<=last; ++k) {
+        const IndexType i = (k-1)%n, j = (k-1)/n, r = k-first+1;
+
+        localCoord(r, k) += 4;
+        if (i>0) {
+            localCoord(r, k-1) += -1;
+        }
+        if (i<n-1) {
+            localCoord(r, k+1) += -1;
+        }
+        if (j>0) {
+            localCoord(r, k-n) += -1;
+        }
+        if (j<n-1) {
+            localCoord(r, k+n) += -1;
+        }
+    }
+    GeCRSMatrix<CRS<T> >  localRows = localCoord;
+
+    ///
+    /// Setting up the matrix is collective and creates the halo exchange
+    /// plan.
+    ///
+    Matrix A(MPI::COMM_WORLD, localRows);
+
+    IndexType numGhosts = A.halo().numGhosts();
+    int       neighbors = A.halo().numNeighbors();
+    cout << "rank " << rank << ": rows " << first << ".." << last
+         << ", ghosts = " << numGhosts
+         << ", neighbors = " << neighbors << endl;
+
+    ///
+    /// Vectors are partitioned like the rows of A.  Dot products and norms
+    /// are global.
+    ///
+    Vector xExact = A.vector(), x = A.vector(), b = A.vector(),
+           r = A.vector();
+
+    for (IndexType k=1; k<=numLocal; ++k) {
+        xExact(k) = T(first+k-1)/N;
+    }
+    b = A*xExact;
+
+    r = transpose(A)*xExact - b;
+    T transError = blas::nrm2(r);
+
+    IndexType it = solver::cg(A.symmetric(), x, b, 1e-20, 1000);
+
+    r = x - xExact;
+    T cgError = blas::nrm2(r);
+
+    x = 0;
+    IndexType itStab = solver::bicgstab(A, x, b, 1e-20, 1000);
+
+    r = x - xExact;
+    T bicgstabError = blas::nrm2(r);
+
+    if (rank==0) {
+        cout << "|A^T*x - A*x| = " << transError << endl;
+        cout << "cg:       " << it << " (0 = converged), |x - x*| = "
+             << cgError << endl;
+        cout << "bicgstab: " << itStab << " (0 = converged), |x - x*| = "
+             << bicgstabError << endl;
+    }
+}
+
+int
+main(int argc, char* argv[])
+{
+    const int n = (argc>1) ? atoi(argv[1]) : 20;
+
+    ///
+    /// Inititialize MPI enviroment
+    ///
+    MPI_init(argc, argv);
+
+    ///
+    /// The persistent requests of the halo exchange have to be freed before
+    /// MPI gets finalized.
+    ///
+    run(n);
+
+    MPI_finalize();
+
+    return 0;
+}
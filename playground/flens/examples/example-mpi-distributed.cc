@@ -0,0 +1,137 @@
+#include <cxxstd/cstdlib.h>
+#include <cxxstd/iostream.h>
+
+#define USE_PLAYGROUND
+#define WITH_MPI
+#include <flens/flens.cxx>
+
+using namespace std;
+using namespace flens;
+using namespace mpi;
+
+typedef double   T;
+
+///
+///  Largest absolute difference of two matrices
+///
+template <typename MA, typename MB>
+double
+maxDiff(const MA &A, const MB &B)
+{
+    double diff = 0;
+    for (int j=1; j<=A.numCols(); ++j) {
+        for (int i=1; i<=A.numRows(); ++i) {
+            diff = std::max(diff, std::abs(A(i,j)-B(i,j)));
+        }
+    }
+    return diff;
+}
+
+void
+run(int n, int nb)
+{
+    typedef GeMatrix<FullStorage<T> >           Matrix;
+    typedef DenseVector<Array<int> >            IndexVector;
+    typedef DistGeMatrix<T>                     DistMatrix;
+
+    int rank = MPI_rank();
+
+    ///
+    /// Processes get arranged in a grid that is as square as possible.
+    /// Matrices are distributed block cyclic over this grid.
+    ///
+    ProcessGrid grid;
+
+    if (rank==0) {
+        cout << "process grid: " << grid.numRows() << " x " << grid.numCols()
+             << endl;
+    }
+
+    ///
+    /// The root creates the matrices and distributes them
+    ///
+    Matrix A(n, n), B(n, n), C(n, n), H(n, n), X(n, 3),
+           Y(n, 3);
+
+    if (rank==0) {
+        fillRandom(A);
+        fillRandom(B);
+        fillRandom(X);
+        H = transpose(A)*A;
+        H.diag(0) += T(n);
+    }
+
+    DistMatrix dA(grid, n, n, nb, nb), dB(grid, n, n, nb, nb),
+               dC(grid, n, n, nb, nb), dH(grid, n, n, nb, nb),
+               dX(grid, n, 3, nb, nb);
+
+    dA.distribute(A);
+    dB.distribute(B);
+    dH.distribute(H);
+
+    ///
+    /// C = A*B (SUMMA)
+    ///
+    mm(T(1), dA, dB, T(0), dC);
+    dC.collect(C);
+
+    if (rank==0) {
+        Matrix R = A*B;
+        cout << "mm:          |C - A*B| = " << maxDiff(C, R) << endl;
+    }
+
+    ///
+    /// Cholesky factorization and solve H*X = B
+    ///
+    if (rank==0) {
+        Y = H*X;
+    }
+    dX.distribute(Y);
+    potrf(Lower, dH);
+    potrs(Lower, dH, dX);
+    dX.collect(Y);
+
+    if (rank==0) {
+        cout << "potrf/potrs: |X - H\\(H*X)| = " << maxDiff(Y, X) << endl;
+    }
+
+    ///
+    /// LU factorization and solve A*X = B
+    ///
+    IndexVector piv;
+
+    if (rank==0) {
+        Y = A*X;
+    }
+    dX.distribute(Y);
+    int info = trf(dA, piv);
+    trs(dA, piv, dX);
+    dX.collect(Y);
+
+    if (rank==0) {
+        cout << "trf/trs:     |X - A\\(A*X)| = " << maxDiff(Y, X)
+             << ", info = " << info << endl;
+    }
+}
+
+int
+main(int argc, char* argv[])
+{
+    const int n  = (argc>1) ? atoi(argv[1]) : 37;
+    const int nb = (argc>2) ? atoi(argv[2]) : 4;
+
+    ///
+    /// Inititialize MPI enviroment
+    ///
+    MPI_init(argc, argv);
+
+    ///
+    /// Communicators of the process grid have to be freed before MPI gets
+    /// finalized.
+    ///
+    run(n, nb);
+
+    MPI_finalize();
+
+    return 0;
+}
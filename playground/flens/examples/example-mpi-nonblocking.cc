@@ -0,0 +1,109 @@
+#include <cxxstd/iostream.h>
+
+#define USE_PLAYGROUND
+#define WITH_MPI
+#include <flens/flens.cxx>
+
+using namespace std;
+using namespace flens;
+using namespace mpi;
+
+typedef double   T;
+
+void
+run()
+{
+    typedef GeMatrix<FullStorage<T> >           Matrix;
+    typedef DenseVector<Array<T> >              Vector;
+    typedef Matrix::IndexType                   IndexType;
+
+    const Underscore<IndexType> _;
+
+    const int rank     = MPI_rank();
+    const int numProcs = MPI_size();
+
+    const IndexType m = 6, n = 5;
+
+    ///
+    /// Broadcast a sub-matrix and a matrix row without copying them into
+    /// temporaries.  Unlike MPI_bcast the dimensions are not communicated,
+    /// they have to be the same on all processes.
+    ///
+    Matrix A(m, n);
+
+    if (rank==0) {
+        for (IndexType j=1; j<=n; ++j) {
+            for (IndexType i=1; i<=m; ++i) {
+                A(i,j) = 10*i + j;
+            }
+        }
+    }
+
+    auto B   = A(_(2,4),_(2,5));
+    auto row = A(m,_);
+
+    MPI::Request requests[2];
+    requests[0] = MPI_ibcast(B);
+    requests[1] = MPI_ibcast(row);
+
+    ///
+    /// ... some work independent of B and row ...
+    ///
+    MPI::Request::Waitall(2, requests);
+
+    cout << "rank " << rank << ": B(3,4) = " << B(3,4)
+         << ", A(6,5) = " << row(n)
+         << ", A(1,1) = " << A(1,1) << endl;
+
+    ///
+    /// Pass a strided vector (the diagonal of A) around the ring
+    ///
+    Vector d(n);
+    d = rank;
+
+    const int next = (rank+1) % numProcs;
+    const int prev = (rank+numProcs-1) % numProcs;
+
+    auto diag = A.diag(0);
+    requests[0] = MPI_irecv(diag, prev);
+    requests[1] = MPI_isend(d, next);
+    MPI::Request::Waitall(2, requests);
+
+    cout << "rank " << rank << ": diag(A) = " << diag(1) << ", received from "
+         << prev << endl;
+
+    ///
+    /// Several dot products get summed up with one message
+    ///
+    T rho = rank, sigma = 1, tau = 2*rank;
+    MPI_allreduce_sum(rho, sigma, tau);
+
+    ///
+    /// Non-blocking global sum of a vector
+    ///
+    Vector x(n);
+    x = rank+1;
+
+    MPI::Request request = MPI_iallreduce_sum(x);
+    request.Wait();
+
+    if (rank==0) {
+        cout << "rho = " << rho << ", sigma = " << sigma << ", tau = " << tau
+             << ", x(1) = " << x(1) << endl;
+    }
+}
+
+int
+main(int argc, char* argv[])
+{
+    ///
+    /// Inititialize MPI enviroment
+    ///
+    MPI_init(argc, argv);
+
+    run();
+
+    MPI_finalize();
+
+    return 0;
+}
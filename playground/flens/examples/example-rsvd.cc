@@ -0,0 +1,101 @@
+#include <cxxstd/cmath.h>
+#include <cxxstd/cstdlib.h>
+#include <cxxstd/iostream.h>
+
+#define USE_PLAYGROUND
+#include <flens/flens.cxx>
+
+using namespace std;
+using namespace flens;
+using lapack::extensions::rsvd;
+using lapack::extensions::RsvdStream;
+namespace RSVD = lapack::extensions::RSVD;
+
+typedef double   T;
+
+///
+///  Largest absolute entry of A - U*diag(s)*VT
+///
+template <typename MA, typename VS>
+T
+residual(const MA &A, const VS &s, const MA &U, const MA &VT)
+{
+    typedef typename MA::IndexType              IndexType;
+
+    const Underscore<IndexType> _;
+
+    typename MA::NoView US = U;
+    for (IndexType j=1; j<=s.length(); ++j) {
+        US(_,j) *= s(j);
+    }
+    typename MA::NoView R = A - US*VT;
+
+    T r = 0;
+    for (IndexType j=1; j<=R.numCols(); ++j) {
+        for (IndexType i=1; i<=R.numRows(); ++i) {
+            r = std::max(r, std::abs(R(i,j)));
+        }
+    }
+    return r;
+}
+
+int
+main(int argc, char* argv[])
+{
+    typedef GeMatrix<FullStorage<T> >           Matrix;
+    typedef DenseVector<Array<T> >              Vector;
+    typedef Matrix::IndexType                   IndexType;
+
+    const IndexType m = (argc>1) ? atoi(argv[1]) : 2000;
+    const IndexType n = (argc>2) ? atoi(argv[2]) : 300;
+    const IndexType k = 10;
+
+    const Underscore<IndexType> _;
+
+    ///
+    /// A = X*diag(sigma)*Y^T with rapidly decaying singular values
+    /// sigma(j) = 2^(1-j) and orthonormal X, Y.
+    ///
+    Matrix X(m, n), Y(n, n), A(m, n);
+    Vector tau(n);
+
+    fillRandom(X);
+    fillRandom(Y);
+    lapack::qrf(X, tau);
+    lapack::orgqr(X, tau);
+    lapack::qrf(Y, tau);
+    lapack::orgqr(Y, tau);
+
+    for (IndexType j=1; j<=n; ++j) {
+        X(_,j) *= pow(T(2), T(1-j));
+    }
+    A = X*transpose(Y);
+
+    ///
+    /// Top k singular triplets with a Gaussian and a sparse sign sketch
+    ///
+    Vector s;
+    Matrix U, VT;
+
+    rsvd(k, A, s, U, VT);
+
+    cout << "s = " << s << endl;
+    cout << "Gaussian:    |A - U*S*VT| = " << residual(A, s, U, VT)
+         << ", sigma(k+1) = " << pow(T(2), T(-k)) << endl;
+
+    rsvd(k, A, s, U, VT, 2, 10, RSVD::SparseSign);
+    cout << "sparse sign: |A - U*S*VT| = " << residual(A, s, U, VT) << endl;
+
+    ///
+    /// Single pass over blocks of 128 rows, e.g. read from disk
+    ///
+    RsvdStream<T>  stream(m, n, k);
+
+    for (IndexType i=1; i<=m; i+=128) {
+        stream.addRows(A(_(i,std::min(i+127,m)),_));
+    }
+    stream.compute(s, U, VT);
+    cout << "single pass: |A - U*S*VT| = " << residual(A, s, U, VT) << endl;
+
+    return 0;
+}
@@ -0,0 +1,95 @@
+#include <cxxstd/iostream.h>
+
+#define USE_PLAYGROUND
+#include <flens/flens.cxx>
+
+using namespace std;
+using namespace flens;
+
+typedef double   T;
+
+int
+main()
+{
+    ///
+    /// Define convenient matrix/vector types ...
+    ///
+    typedef CoordStorage<T, CoordRowColCmp>     Coord;
+    typedef SyCRSMatrix<CRS<T> >                SparseMatrix;
+    typedef DenseVector<Array<T> >              Vector;
+    typedef SparseMatrix::IndexType             IndexType;
+
+    ///
+    /// Setup the 2D Poisson matrix for a k x k grid (upper part only)
+    ///
+    const IndexType k = 40;
+    const IndexType n = k*k;
+
+    SyCoordMatrix<Coord>  A_(n, Upper);
+    for (IndexType i=1; i<=k; ++i) {
+        for (IndexType j=1; j<=k; ++j) {
+            const IndexType p = (i-1)*k + j;
+            A_(p,p) += 4;
+            if (j<k) {
+                A_(p,p+1) -= 1;
+            }
+            if (i<k) {
+                A_(p,p+k) -= 1;
+            }
+        }
+    }
+    SparseMatrix  A = A_;
+
+    Vector x(n), b(n), r(n);
+    for (IndexType i=1; i<=n; ++i) {
+        b(i) = T(i % 7);
+    }
+
+    ///
+    /// Symbolic analysis with different fill-reducing orderings
+    ///
+    supernodal::Ordering  ordering[3] = { supernodal::Natural,
+                                          supernodal::MinimumDegree,
+                                          supernodal::NestedDissection };
+    const char            *name[3]    = { "natural", "minimum degree",
+                                          "nested dissection" };
+
+    for (int o=0; o<3; ++o) {
+        supernodal::Symbolic<IndexType>     S;
+        supernodal::Numeric<T, IndexType>   N;
+
+        supernodal::analyze(A, S, ordering[o]);
+        IndexType info = supernodal::factorize(A, S, N);
+
+        x = b;
+        supernodal::solve(S, N, x);
+
+        r = b - A*x;
+        cout << name[o] << ": info = " << info
+             << ", nnz(L) = " << S.numFactorNonZeros
+             << ", supernodes = " << S.numSupernodes()
+             << ", |b - A*x| = " << blas::asum(r) << endl;
+    }
+
+    ///
+    /// Values change but the pattern stays the same:  only the numeric
+    /// factorization gets recomputed.
+    ///
+    supernodal::Symbolic<IndexType>     S;
+    supernodal::Numeric<T, IndexType>   N(supernodal::LDLT);
+
+    supernodal::analyze(A, S, supernodal::NestedDissection);
+    for (int step=1; step<=3; ++step) {
+        A.engine().values() *= T(2);
+
+        IndexType info = supernodal::factorize(A, S, N);
+        x = b;
+        supernodal::solve(S, N, x);
+
+        r = b - A*x;
+        cout << "LDL^T step " << step << ": info = " << info
+             << ", |b - A*x| = " << blas::asum(r) << endl;
+    }
+
+    return 0;
+}
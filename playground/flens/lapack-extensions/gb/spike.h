@@ -0,0 +1,92 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn, Klaus Pototzky
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PLAYGROUND_FLENS_LAPACKEXTENSIONS_GB_SPIKE_H
+#define PLAYGROUND_FLENS_LAPACKEXTENSIONS_GB_SPIKE_H 1
+
+#include <flens/lapack/typedefs.h>
+#include <flens/matrixtypes/matrixtypes.h>
+#include <flens/vectortypes/vectortypes.h>
+
+//
+//  Partitioned solver for band systems following Polizzi, Sameh: "A
+//  parallel hybrid banded system solver: the SPIKE algorithm", Parallel
+//  Computing 32(2), 2006.  The rows of A are split into p partitions whose
+//  diagonal blocks A_j get factorized in parallel.  With the spikes
+//
+//      V_j = A_j^{-1} [0; B_j],    W_j = A_j^{-1} [C_j; 0]
+//
+//  of the coupling blocks B_j (ku x ku) and C_j (kl x kl) the interface
+//  values of the solution satisfy a band system of order (p-1)*(kl+ku).
+//  After solving it sequentially the partitions get updated in parallel
+//  with one gemm each.
+//
+namespace flens { namespace lapack { namespace extensions {
+
+//== spike_sv ==================================================================
+//
+//  Solves A*X = B.  A is not overwritten.  For a GbMatrix the band width
+//  is given by numSubDiags() and numSuperDiags(), no extra superdiagonals
+//  for pivoting are needed.  Diagonal blocks of a GbMatrix get factorized
+//  with trf (pivoting within the block), diagonal blocks of a SbMatrix or
+//  HbMatrix with pbtrf.
+//
+//  If numPartitions is zero the number of OpenMP threads gets used.  The
+//  number is reduced such that partitions have at least 2*(kl+ku) rows.
+//  With a single partition, or if a diagonal block is singular, the whole
+//  system is solved sequentially.  Returns the info of this sequential
+//  solve, zero on success.
+//
+template <typename MA, typename MB>
+    typename RestrictTo<(IsGbMatrix<MA>::value
+                      || IsRealSbMatrix<MA>::value
+                      || IsHbMatrix<MA>::value)
+                     && IsGeMatrix<MB>::value,
+             typename RemoveRef<MB>::Type::IndexType>::Type
+    spike_sv(const MA                                &A,
+             MB                                      &&B,
+             typename RemoveRef<MB>::Type::IndexType numPartitions = 0);
+
+//== spike_sv variant if rhs is vector =========================================
+template <typename MA, typename VB>
+    typename RestrictTo<(IsGbMatrix<MA>::value
+                      || IsRealSbMatrix<MA>::value
+                      || IsHbMatrix<MA>::value)
+                     && IsDenseVector<VB>::value,
+             typename RemoveRef<VB>::Type::IndexType>::Type
+    spike_sv(const MA                                &A,
+             VB                                      &&b,
+             typename RemoveRef<VB>::Type::IndexType numPartitions = 0);
+
+} } } // namespace extensions, lapack, flens
+
+#endif // PLAYGROUND_FLENS_LAPACKEXTENSIONS_GB_SPIKE_H
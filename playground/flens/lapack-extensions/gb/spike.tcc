@@ -0,0 +1,470 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn, Klaus Pototzky
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PLAYGROUND_FLENS_LAPACKEXTENSIONS_GB_SPIKE_TCC
+#define PLAYGROUND_FLENS_LAPACKEXTENSIONS_GB_SPIKE_TCC 1
+
+#include <cxxstd/algorithm.h>
+#include <cxxstd/complex.h>
+#include <cxxstd/vector.h>
+#include <playground/flens/lapack-extensions/gb/spike.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace flens { namespace lapack { namespace extensions {
+
+//-- spike_bandWidth -----------------------------------------------------------
+
+template <typename MA, typename IndexType>
+void
+spike_bandWidth(const GbMatrix<MA> &A, IndexType &kl, IndexType &ku)
+{
+    kl = A.numSubDiags();
+    ku = A.numSuperDiags();
+}
+
+template <typename MA, typename IndexType>
+void
+spike_bandWidth(const SbMatrix<MA> &A, IndexType &kl, IndexType &ku)
+{
+    kl = ku = A.numOffDiags();
+}
+
+template <typename MA, typename IndexType>
+void
+spike_bandWidth(const HbMatrix<MA> &A, IndexType &kl, IndexType &ku)
+{
+    kl = ku = A.numOffDiags();
+}
+
+//-- spike_entry ---------------------------------------------------------------
+//
+//  Entry (i,j) within the band.  For SbMatrix and HbMatrix also entries of
+//  the triangle that is not referenced.
+//
+template <typename MA, typename IndexType>
+typename GbMatrix<MA>::ElementType
+spike_entry(const GbMatrix<MA> &A, IndexType i, IndexType j)
+{
+    return A(i,j);
+}
+
+template <typename MA, typename IndexType>
+typename SbMatrix<MA>::ElementType
+spike_entry(const SbMatrix<MA> &A, IndexType i, IndexType j)
+{
+    return ((A.upLo()==Upper)==(i<=j)) ? A(i,j) : A(j,i);
+}
+
+template <typename MA, typename IndexType>
+typename HbMatrix<MA>::ElementType
+spike_entry(const HbMatrix<MA> &A, IndexType i, IndexType j)
+{
+    return ((A.upLo()==Upper)==(i<=j)) ? A(i,j) : std::conj(A(j,i));
+}
+
+//-- spike_block ---------------------------------------------------------------
+//
+//  Copies the diagonal block A(i1:i2,i1:i2), factorizes it and overwrites
+//  S with A(i1:i2,i1:i2)^{-1}*S.
+//
+template <typename MA, typename IndexType, typename MS>
+IndexType
+spike_block(const GbMatrix<MA> &A, IndexType i1, IndexType i2,
+            GeMatrix<MS> &S)
+{
+    using std::max;
+    using std::min;
+
+    typedef typename GbMatrix<MA>::ElementType                   T;
+    typedef BandStorage<T, ColMajor, IndexOptions<IndexType> >   Storage;
+    typedef DenseVector<Array<IndexType> >                       IndexVector;
+
+    const IndexType n  = i2-i1+1;
+    const IndexType kl = A.numSubDiags();
+    const IndexType ku = A.numSuperDiags();
+
+//
+//  The LU factorization needs kl extra superdiagonals for the fill-in
+//
+    GbMatrix<Storage>  Aj(n, n, kl, kl+ku);
+    IndexVector        piv(n);
+
+    for (IndexType j=1; j<=n; ++j) {
+        for (IndexType i=max(IndexType(1),j-ku); i<=min(n,j+kl); ++i) {
+            Aj(i,j) = A(i1+i-1,i1+j-1);
+        }
+    }
+
+    const IndexType info = trf(Aj, piv);
+    if (info==0) {
+        trs(NoTrans, Aj, piv, S);
+    }
+    return info;
+}
+
+template <typename MA, typename IndexType, typename MS>
+IndexType
+spike_block(const SbMatrix<MA> &A, IndexType i1, IndexType i2,
+            GeMatrix<MS> &S)
+{
+    using std::max;
+    using std::min;
+
+    typedef typename SbMatrix<MA>::ElementType                   T;
+    typedef BandStorage<T, ColMajor, IndexOptions<IndexType> >   Storage;
+
+    const IndexType n  = i2-i1+1;
+    const IndexType kd = A.numOffDiags();
+    const bool upper   = (A.upLo()==Upper);
+
+    SbMatrix<Storage>  Aj(n, A.upLo(), kd);
+
+    for (IndexType j=1; j<=n; ++j) {
+        const IndexType iFirst = upper ? max(IndexType(1),j-kd) : j;
+        const IndexType iLast  = upper ? j : min(n,j+kd);
+        for (IndexType i=iFirst; i<=iLast; ++i) {
+            Aj(i,j) = A(i1+i-1,i1+j-1);
+        }
+    }
+
+    const IndexType info = pbtrf(Aj);
+    if (info==0) {
+        pbtrs(Aj, S);
+    }
+    return info;
+}
+
+template <typename MA, typename IndexType, typename MS>
+IndexType
+spike_block(const HbMatrix<MA> &A, IndexType i1, IndexType i2,
+            GeMatrix<MS> &S)
+{
+    using std::max;
+    using std::min;
+
+    typedef typename HbMatrix<MA>::ElementType                   T;
+    typedef BandStorage<T, ColMajor, IndexOptions<IndexType> >   Storage;
+
+    const IndexType n  = i2-i1+1;
+    const IndexType kd = A.numOffDiags();
+    const bool upper   = (A.upLo()==Upper);
+
+    HbMatrix<Storage>  Aj(n, A.upLo(), kd);
+
+    for (IndexType j=1; j<=n; ++j) {
+        const IndexType iFirst = upper ? max(IndexType(1),j-kd) : j;
+        const IndexType iLast  = upper ? j : min(n,j+kd);
+        for (IndexType i=iFirst; i<=iLast; ++i) {
+            Aj(i,j) = A(i1+i-1,i1+j-1);
+        }
+    }
+
+    const IndexType info = pbtrf(Aj);
+    if (info==0) {
+        pbtrs(Aj, S);
+    }
+    return info;
+}
+
+//-- spike_numPartitions -------------------------------------------------------
+
+template <typename IndexType>
+IndexType
+spike_numPartitions(IndexType n, IndexType kl, IndexType ku,
+                    IndexType numPartitions)
+{
+    using std::max;
+    using std::min;
+
+    if (numPartitions<=0) {
+#       ifdef _OPENMP
+        numPartitions = omp_get_max_threads();
+#       else
+        numPartitions = 1;
+#       endif
+    }
+//
+//  Partitions need at least max(kl,ku) rows.  With less than 2*(kl+ku)
+//  rows the reduced system is not smaller than the partitions.
+//
+    const IndexType minRows = max(IndexType(1), 2*(kl+ku));
+
+    return max(IndexType(1), min(numPartitions, n/minRows));
+}
+
+//-- spike_sv_impl -------------------------------------------------------------
+
+template <typename MA, typename MB>
+typename GeMatrix<MB>::IndexType
+spike_sv_impl(const MA &A, GeMatrix<MB> &B,
+              typename GeMatrix<MB>::IndexType p)
+{
+    using std::max;
+    using std::min;
+
+    typedef typename GeMatrix<MB>::ElementType                    T;
+    typedef typename GeMatrix<MB>::IndexType                      IndexType;
+    typedef GeMatrix<FullStorage<T, ColMajor, IndexOptions<IndexType> > >
+                                                                  Matrix;
+    typedef GbMatrix<BandStorage<T, ColMajor, IndexOptions<IndexType> > >
+                                                                  BandMatrix;
+    typedef DenseVector<Array<IndexType> >                        IndexVector;
+
+    const Underscore<IndexType> _;
+
+    const T  One(1);
+
+    const IndexType n    = B.numRows();
+    const IndexType nRhs = B.numCols();
+
+    IndexType kl, ku;
+    spike_bandWidth(A, kl, ku);
+
+    const IndexType m = kl + ku;
+
+//
+//  Partition j has rows first[j], ..., first[j+1]-1
+//
+    std::vector<IndexType>  first(p+1);
+    for (IndexType j=0; j<=p; ++j) {
+        first[j] = 1 + j*(n/p) + min(j, n%p);
+    }
+
+//
+//  Factorize the diagonal blocks A_j and compute S_j = [g_j, V_j, W_j]
+//  where g_j = A_j^{-1} B_j.
+//
+    std::vector<Matrix>  S(p);
+    IndexType            info = 0;
+
+#   ifdef _OPENMP
+#   pragma omp parallel for schedule(static)
+#   endif
+    for (IndexType j=0; j<p; ++j) {
+        const IndexType i1 = first[j];
+        const IndexType i2 = first[j+1]-1;
+        const IndexType nj = i2-i1+1;
+
+        Matrix &Sj = S[j];
+        Sj.resize(nj, nRhs+m);
+        Sj(_,_(1,nRhs)) = B(_(i1,i2),_);
+//
+//      The coupling block B_j is lower triangular, C_j upper triangular
+//
+        if (j<p-1) {
+            for (IndexType c=1; c<=ku; ++c) {
+                for (IndexType r=c; r<=ku; ++r) {
+                    Sj(nj-ku+r,nRhs+c) = spike_entry(A, i2-ku+r, i2+c);
+                }
+            }
+        }
+        if (j>0) {
+            for (IndexType c=1; c<=kl; ++c) {
+                for (IndexType r=1; r<=c; ++r) {
+                    Sj(r,nRhs+ku+c) = spike_entry(A, i1+r-1, i1-kl+c-1);
+                }
+            }
+        }
+        if (spike_block(A, i1, i2, Sj)!=0) {
+#           ifdef _OPENMP
+#           pragma omp critical
+#           endif
+            info = 1;
+        }
+    }
+    if (info!=0) {
+        return spike_block(A, IndexType(1), n, B);
+    }
+
+//
+//  Reduced system for the unknowns z_k = [b_k; t_{k+1}], k=1,...,p-1, where
+//  b_k are the last kl entries of x_k and t_{k+1} the first ku entries of
+//  x_{k+1}:
+//
+//      b_k     + W_k^b b_{k-1}   + V_k^b t_{k+1}     = g_k^b
+//      t_{k+1} + W_{k+1}^t b_k   + V_{k+1}^t t_{k+2} = g_{k+1}^t
+//
+//  Superscripts b and t denote the last kl and the first ku rows.
+//
+    const IndexType N = (p-1)*m;
+
+    Matrix Z(N, nRhs);
+
+    if (N>0) {
+        const IndexType klR = min(N-1, max(IndexType(0), 2*kl+ku-1));
+        const IndexType kuR = min(N-1, max(IndexType(0), kl+2*ku-1));
+
+        BandMatrix   R(N, N, klR, klR+kuR);
+        IndexVector  pivR(N);
+
+        for (IndexType k=1; k<p; ++k) {
+            const Matrix    &Sk  = S[k-1];
+            const Matrix    &Sk1 = S[k];
+            const IndexType nk   = Sk.numRows();
+            const IndexType base = (k-1)*m;
+
+            for (IndexType i=1; i<=kl; ++i) {
+                const IndexType row = base+i;
+                const IndexType ik  = nk-kl+i;
+
+                R(row,row) = One;
+                for (IndexType l=1; l<=ku; ++l) {
+                    R(row,base+kl+l) = Sk(ik,nRhs+l);
+                }
+                if (k>1) {
+                    for (IndexType l=1; l<=kl; ++l) {
+                        R(row,base-m+l) = Sk(ik,nRhs+ku+l);
+                    }
+                }
+                Z(row,_) = Sk(ik,_(1,nRhs));
+            }
+            for (IndexType i=1; i<=ku; ++i) {
+                const IndexType row = base+kl+i;
+
+                R(row,row) = One;
+                for (IndexType l=1; l<=kl; ++l) {
+                    R(row,base+l) = Sk1(i,nRhs+ku+l);
+                }
+                if (k<p-1) {
+                    for (IndexType l=1; l<=ku; ++l) {
+                        R(row,base+m+kl+l) = Sk1(i,nRhs+l);
+                    }
+                }
+                Z(row,_) = Sk1(i,_(1,nRhs));
+            }
+        }
+        if (sv(R, pivR, Z)!=0) {
+            return spike_block(A, IndexType(1), n, B);
+        }
+    }
+
+//
+//  Retrieve the solution x_j = g_j - V_j t_{j+1} - W_j b_{j-1}
+//
+#   ifdef _OPENMP
+#   pragma omp parallel for schedule(static)
+#   endif
+    for (IndexType j=0; j<p; ++j) {
+        const IndexType i1 = first[j];
+        const IndexType i2 = first[j+1]-1;
+
+        const Matrix &Sj = S[j];
+        auto         Bj  = B(_(i1,i2),_);
+
+        Bj = Sj(_,_(1,nRhs));
+        if (j<p-1 && ku>0) {
+            const auto V = Sj(_,_(nRhs+1,nRhs+ku));
+            const auto t = Z(_(j*m+kl+1,j*m+m),_);
+
+            blas::mm(NoTrans, NoTrans, -One, V, t, One, Bj);
+        }
+        if (j>0 && kl>0) {
+            const auto W = Sj(_,_(nRhs+ku+1,nRhs+m));
+            const auto b = Z(_((j-1)*m+1,(j-1)*m+kl),_);
+
+            blas::mm(NoTrans, NoTrans, -One, W, b, One, Bj);
+        }
+    }
+    return 0;
+}
+
+//== spike_sv ==================================================================
+
+template <typename MA, typename MB>
+typename RestrictTo<(IsGbMatrix<MA>::value
+                  || IsRealSbMatrix<MA>::value
+                  || IsHbMatrix<MA>::value)
+                 && IsGeMatrix<MB>::value,
+         typename RemoveRef<MB>::Type::IndexType>::Type
+spike_sv(const MA                                &A,
+         MB                                      &&B,
+         typename RemoveRef<MB>::Type::IndexType numPartitions)
+{
+    typedef typename RemoveRef<MB>::Type::IndexType  IndexType;
+
+    const IndexType n = B.numRows();
+
+    ASSERT(A.numRows()==n);
+    ASSERT(A.numCols()==n);
+    ASSERT(B.firstRow()==1);
+
+    if (n==0) {
+        return 0;
+    }
+
+    IndexType kl, ku;
+    spike_bandWidth(A, kl, ku);
+
+    const IndexType p = spike_numPartitions(n, kl, ku, numPartitions);
+
+    if (p==1) {
+        return spike_block(A, IndexType(1), n, B);
+    }
+    return spike_sv_impl(A, B, p);
+}
+
+//== spike_sv variant if rhs is vector =========================================
+
+template <typename MA, typename VB>
+typename RestrictTo<(IsGbMatrix<MA>::value
+                  || IsRealSbMatrix<MA>::value
+                  || IsHbMatrix<MA>::value)
+                 && IsDenseVector<VB>::value,
+         typename RemoveRef<VB>::Type::IndexType>::Type
+spike_sv(const MA                                &A,
+         VB                                      &&b,
+         typename RemoveRef<VB>::Type::IndexType numPartitions)
+{
+//
+//  Remove references from rvalue types
+//
+    typedef typename RemoveRef<VB>::Type    VectorB;
+
+//
+//  Create matrix view from vector b and call above variant
+//
+    typedef typename VectorB::ElementType  ElementType;
+    typedef typename VectorB::IndexType    IndexType;
+
+    const IndexType    n     = b.length();
+
+    GeMatrix<FullStorageView<ElementType, ColMajor> >  B(n, 1, b, n);
+
+    return spike_sv(A, B, numPartitions);
+}
+
+} } } // namespace extensions, lapack, flens
+
+#endif // PLAYGROUND_FLENS_LAPACKEXTENSIONS_GB_SPIKE_TCC
@@ -0,0 +1,173 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn, Klaus Pototzky
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PLAYGROUND_FLENS_LAPACKEXTENSIONS_GE_RSVD_H
+#define PLAYGROUND_FLENS_LAPACKEXTENSIONS_GE_RSVD_H 1
+
+#include <cxxstd/random.h>
+#include <cxxstd/vector.h>
+#include <flens/lapack/typedefs.h>
+#include <flens/matrixtypes/matrixtypes.h>
+#include <flens/vectortypes/vectortypes.h>
+
+//
+//  Randomized range finder, SVD and symmetric eigensolver following
+//  Halko, Martinsson, Tropp: "Finding structure with randomness", SIAM
+//  Review 53(2), 2011.  The cost is O(mnl) for a sketch of size l instead
+//  of O(mn^2) for a full factorization.  A can be any matrix type for which
+//  A*X and transpose(A)*X are defined for a GeMatrix X, e.g. a GeCRSMatrix.
+//
+//  RsvdStream computes the SVD with a single pass over the rows of A
+//  (Tropp, Yurtsever, Udell, Cevher: "Practical sketching algorithms for
+//  low-rank matrix approximation", SIAM J. Matrix Anal. Appl. 38(4), 2017).
+//
+namespace flens { namespace lapack { namespace extensions {
+
+namespace RSVD {
+
+    enum Sketch {
+        Gaussian   = 'G',   // dense test matrix with N(0,1) entries
+        SparseSign = 'S'    // min(l,8) entries +-1 per row of the test
+                            // matrix, sketching costs O(mn) for GeMatrix
+    };
+
+}
+
+//== rrf =======================================================================
+//
+//  Computes Q with orthonormal columns such that Q*Q^T*A approximates A.
+//  The number of columns of Q is the sketch size l.  Each power iteration
+//  costs another two products with A and sharpens the approximation if the
+//  singular values of A decay slowly.
+//
+template <typename MA, typename MQ>
+    typename RestrictTo<IsRealGeMatrix<MQ>::value,
+             void>::Type
+    rrf(const MA                                &A,
+        MQ                                      &&Q,
+        typename RemoveRef<MQ>::Type::IndexType numPowerIterations = 1,
+        RSVD::Sketch                            sketch = RSVD::Gaussian);
+
+//== rsvd ======================================================================
+//
+//  Computes the k largest singular values s and the corresponding singular
+//  vectors U (m x k) and VT (k x n) of A.  The sketch has k+oversampling
+//  columns.  Empty s, U, VT get resized.
+//
+template <typename MA, typename VS, typename MU, typename MVT>
+    typename RestrictTo<IsRealDenseVector<VS>::value
+                     && IsRealGeMatrix<MU>::value
+                     && IsRealGeMatrix<MVT>::value,
+             void>::Type
+    rsvd(typename RemoveRef<MU>::Type::IndexType  k,
+         const MA                                 &A,
+         VS                                       &&s,
+         MU                                       &&U,
+         MVT                                      &&VT,
+         typename RemoveRef<MU>::Type::IndexType  numPowerIterations = 1,
+         typename RemoveRef<MU>::Type::IndexType  oversampling = 10,
+         RSVD::Sketch                             sketch = RSVD::Gaussian);
+
+#ifdef USE_CXXLAPACK
+
+//== rev =======================================================================
+//
+//  Computes the k eigenvalues of largest magnitude w and eigenvectors Z
+//  (n x k) of a symmetric matrix A.  Eigenvalues are in descending order
+//  of magnitude.
+//
+template <typename MA, typename VW, typename MZ>
+    typename RestrictTo<IsRealDenseVector<VW>::value
+                     && IsRealGeMatrix<MZ>::value,
+             void>::Type
+    rev(typename RemoveRef<MZ>::Type::IndexType  k,
+        const MA                                 &A,
+        VW                                       &&w,
+        MZ                                       &&Z,
+        typename RemoveRef<MZ>::Type::IndexType  numPowerIterations = 1,
+        typename RemoveRef<MZ>::Type::IndexType  oversampling = 10,
+        RSVD::Sketch                             sketch = RSVD::Gaussian);
+
+#endif // USE_CXXLAPACK
+
+//== RsvdStream ================================================================
+//
+//  Single pass SVD for matrices that are read in blocks of rows, e.g. from
+//  disk.  Only the sketches Y = A*Omega (m x k+p) and W = Psi*A (2(k+p)+1
+//  x n) are kept.  The test matrix Psi is regenerated block by block from
+//  a seed, so the blocks must be added in order.
+//
+//      RsvdStream<double>  stream(m, n, k);
+//      while (...) {
+//          stream.addRows(ABlock);
+//      }
+//      stream.compute(s, U, VT);
+//
+template <typename T>
+class RsvdStream
+{
+    public:
+        typedef GeMatrix<FullStorage<T> >   Matrix;
+        typedef DenseVector<Array<T> >      Vector;
+        typedef typename Matrix::IndexType  IndexType;
+
+        RsvdStream(IndexType m, IndexType n, IndexType k,
+                   IndexType oversampling = 10, unsigned int seed = 1);
+
+        template <typename MA>
+            typename RestrictTo<IsRealGeMatrix<MA>::value,
+                     void>::Type
+            addRows(const MA &A);
+
+        IndexType
+        numRowsAdded() const;
+
+        template <typename VS, typename MU, typename MVT>
+            typename RestrictTo<IsRealDenseVector<VS>::value
+                             && IsRealGeMatrix<MU>::value
+                             && IsRealGeMatrix<MVT>::value,
+                     void>::Type
+            compute(VS &&s, MU &&U, MVT &&VT) const;
+
+    private:
+        void
+        psi_(IndexType firstRow, IndexType numRows, Matrix &Psi) const;
+
+        IndexType               m_, n_, k_;
+        unsigned int            seed_;
+        Matrix                  Omega_, Y_, W_;
+        std::vector<IndexType>  blocks_;
+};
+
+} } } // namespace extensions, lapack, flens
+
+#endif // PLAYGROUND_FLENS_LAPACKEXTENSIONS_GE_RSVD_H
@@ -0,0 +1,474 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn, Klaus Pototzky
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PLAYGROUND_FLENS_LAPACKEXTENSIONS_GE_RSVD_TCC
+#define PLAYGROUND_FLENS_LAPACKEXTENSIONS_GE_RSVD_TCC 1
+
+#include <cxxstd/algorithm.h>
+#include <cxxstd/cmath.h>
+#include <playground/flens/lapack-extensions/ge/rsvd.h>
+
+namespace flens { namespace lapack { namespace extensions {
+
+//-- rsvd_engine ---------------------------------------------------------------
+//
+//  Random number engine for test matrices that are not regenerated
+//
+inline std::mt19937 &
+rsvd_engine()
+{
+    static std::mt19937 engine;
+    return engine;
+}
+
+//-- rsvd_orth -----------------------------------------------------------------
+//
+//  Overwrites the columns of Q with an orthonormal basis of their span
+//
+template <typename MQ>
+void
+rsvd_orth(MQ &Q)
+{
+    typedef typename MQ::ElementType   T;
+
+    DenseVector<Array<T> >  tau(Q.numCols());
+
+    qrf(Q, tau);
+    orgqr(Q, tau);
+}
+
+//-- rsvd_testMatrix -----------------------------------------------------------
+//
+//  Fills Omega with a test matrix of the given kind
+//
+template <typename MOMEGA>
+void
+rsvd_testMatrix(RSVD::Sketch sketch, MOMEGA &Omega, std::mt19937 &engine)
+{
+    typedef typename MOMEGA::ElementType   T;
+    typedef typename MOMEGA::IndexType     IndexType;
+
+    const IndexType l = Omega.numCols();
+
+    if (sketch==RSVD::Gaussian) {
+        std::normal_distribution<T>  normal;
+
+        for (IndexType j=Omega.firstCol(); j<=Omega.lastCol(); ++j) {
+            for (IndexType i=Omega.firstRow(); i<=Omega.lastRow(); ++i) {
+                Omega(i,j) = normal(engine);
+            }
+        }
+    } else {
+        std::uniform_int_distribution<IndexType>  col(Omega.firstCol(),
+                                                      Omega.lastCol());
+        std::bernoulli_distribution               sign;
+
+        const IndexType zeta = std::min(l, IndexType(8));
+
+        Omega = T(0);
+        for (IndexType i=Omega.firstRow(); i<=Omega.lastRow(); ++i) {
+            for (IndexType p=0; p<zeta; ++p) {
+                Omega(i,col(engine)) = sign(engine) ? T(1) : T(-1);
+            }
+        }
+    }
+}
+
+//-- rsvd_sketch ---------------------------------------------------------------
+//
+//  Y = A*Omega for a random test matrix Omega
+//
+template <typename MA, typename MY>
+typename RestrictTo<!IsGeMatrix<MA>::value,
+         void>::Type
+rsvd_sketch(const MA &A, RSVD::Sketch sketch, MY &Y)
+{
+    typedef typename MY::ElementType   T;
+
+    GeMatrix<FullStorage<T> >  Omega(A.numCols(), Y.numCols());
+
+    rsvd_testMatrix(sketch, Omega, rsvd_engine());
+    Y = A*Omega;
+}
+
+//
+//  For a GeMatrix the sparse sign sketch adds up signed columns of A and
+//  never forms Omega.
+//
+template <typename MA, typename MY>
+typename RestrictTo<IsGeMatrix<MA>::value,
+         void>::Type
+rsvd_sketch(const MA &A, RSVD::Sketch sketch, MY &Y)
+{
+    typedef typename MY::ElementType   T;
+    typedef typename MY::IndexType     IndexType;
+
+    const Underscore<IndexType>  _;
+
+    if (sketch==RSVD::Gaussian) {
+        GeMatrix<FullStorage<T> >  Omega(A.numCols(), Y.numCols());
+
+        rsvd_testMatrix(sketch, Omega, rsvd_engine());
+        blas::mm(NoTrans, NoTrans, T(1), A, Omega, T(0), Y);
+        return;
+    }
+
+    std::uniform_int_distribution<IndexType>  col(Y.firstCol(), Y.lastCol());
+    std::bernoulli_distribution               sign;
+
+    const IndexType zeta = std::min(Y.numCols(), IndexType(8));
+
+    Y = T(0);
+    for (IndexType j=A.firstCol(); j<=A.lastCol(); ++j) {
+        for (IndexType p=0; p<zeta; ++p) {
+            const IndexType c     = col(rsvd_engine());
+            const T         alpha = sign(rsvd_engine()) ? T(1) : T(-1);
+
+            blas::axpy(alpha, A(_,j), Y(_,c));
+        }
+    }
+}
+
+//-- rsvd_svd ------------------------------------------------------------------
+//
+//  Given Q with orthonormal columns and Bt = (Q^T*A)^T computes the SVD
+//  of Q*Q^T*A truncated to s.length() singular triplets.  Bt gets
+//  overwritten.
+//
+template <typename MQ, typename MBT, typename VS, typename MU, typename MVT>
+void
+rsvd_svd(const MQ &Q, MBT &Bt, VS &&s, MU &&U, MVT &&VT)
+{
+    typedef typename MQ::ElementType   T;
+    typedef typename MQ::IndexType     IndexType;
+
+    const Underscore<IndexType>  _;
+
+    const IndexType n = Bt.numRows();
+    const IndexType l = Bt.numCols();
+    const IndexType k = s.length();
+
+    DenseVector<Array<T> >     sva(l), work(std::max(IndexType(6), n+l));
+    GeMatrix<FullStorage<T> >  V(l, l);
+
+//
+//  Bt = Ub*S*V^T, so Q*Q^T*A = (Q*V)*S*Ub^T
+//
+    svj(SVJ::General, SVJ::ComputeU, SVJ::ComputeV, Bt, sva, V, work);
+
+    s = work(1)*sva(_(1,k));
+    blas::mm(NoTrans, NoTrans, T(1), Q, V(_,_(1,k)), T(0), U);
+    VT = transpose(Bt(_,_(1,k)));
+}
+
+//== rrf =======================================================================
+
+template <typename MA, typename MQ>
+typename RestrictTo<IsRealGeMatrix<MQ>::value,
+         void>::Type
+rrf(const MA                                &A,
+    MQ                                      &&Q,
+    typename RemoveRef<MQ>::Type::IndexType numPowerIterations,
+    RSVD::Sketch                            sketch)
+{
+    typedef typename RemoveRef<MQ>::Type    MatrixQ;
+    typedef typename MatrixQ::ElementType   T;
+    typedef typename MatrixQ::IndexType     IndexType;
+
+    const IndexType m = A.numRows();
+    const IndexType n = A.numCols();
+    const IndexType l = Q.numCols();
+
+    ASSERT(Q.numRows()==m);
+    ASSERT(l<=std::min(m, n));
+
+    rsvd_sketch(A, sketch, Q);
+    rsvd_orth(Q);
+
+//
+//  Power iterations with re-orthonormalization after each product.  Without
+//  it the columns of Q would all converge to the dominant singular vector.
+//
+    GeMatrix<FullStorage<T> >  Z(n, l);
+
+    for (IndexType it=0; it<numPowerIterations; ++it) {
+        Z = transpose(A)*Q;
+        rsvd_orth(Z);
+        Q = A*Z;
+        rsvd_orth(Q);
+    }
+}
+
+//== rsvd ======================================================================
+
+template <typename MA, typename VS, typename MU, typename MVT>
+typename RestrictTo<IsRealDenseVector<VS>::value
+                 && IsRealGeMatrix<MU>::value
+                 && IsRealGeMatrix<MVT>::value,
+         void>::Type
+rsvd(typename RemoveRef<MU>::Type::IndexType  k,
+     const MA                                 &A,
+     VS                                       &&s,
+     MU                                       &&U,
+     MVT                                      &&VT,
+     typename RemoveRef<MU>::Type::IndexType  numPowerIterations,
+     typename RemoveRef<MU>::Type::IndexType  oversampling,
+     RSVD::Sketch                             sketch)
+{
+    typedef typename RemoveRef<MU>::Type    MatrixU;
+    typedef typename MatrixU::ElementType   T;
+    typedef typename MatrixU::IndexType     IndexType;
+
+    const IndexType m = A.numRows();
+    const IndexType n = A.numCols();
+    const IndexType l = std::min(k+oversampling, std::min(m, n));
+
+    ASSERT(k<=l);
+
+    if (s.length()==0) {
+        s.resize(k);
+    }
+    if (U.numRows()==0 && U.numCols()==0) {
+        U.resize(m, k);
+    }
+    if (VT.numRows()==0 && VT.numCols()==0) {
+        VT.resize(k, n);
+    }
+    ASSERT(s.length()==k);
+    ASSERT(U.numRows()==m && U.numCols()==k);
+    ASSERT(VT.numRows()==k && VT.numCols()==n);
+
+    GeMatrix<FullStorage<T> >  Q(m, l), Bt(n, l);
+
+    rrf(A, Q, numPowerIterations, sketch);
+    Bt = transpose(A)*Q;
+    rsvd_svd(Q, Bt, s, U, VT);
+}
+
+#ifdef USE_CXXLAPACK
+
+//== rev =======================================================================
+
+template <typename MA, typename VW, typename MZ>
+typename RestrictTo<IsRealDenseVector<VW>::value
+                 && IsRealGeMatrix<MZ>::value,
+         void>::Type
+rev(typename RemoveRef<MZ>::Type::IndexType  k,
+    const MA                                 &A,
+    VW                                       &&w,
+    MZ                                       &&Z,
+    typename RemoveRef<MZ>::Type::IndexType  numPowerIterations,
+    typename RemoveRef<MZ>::Type::IndexType  oversampling,
+    RSVD::Sketch                             sketch)
+{
+    typedef typename RemoveRef<MZ>::Type    MatrixZ;
+    typedef typename MatrixZ::ElementType   T;
+    typedef typename MatrixZ::IndexType     IndexType;
+
+    const Underscore<IndexType>  _;
+
+    const IndexType n = A.numRows();
+    const IndexType l = std::min(k+oversampling, n);
+
+    ASSERT(A.numCols()==n);
+    ASSERT(k<=l);
+
+    if (w.length()==0) {
+        w.resize(k);
+    }
+    if (Z.numRows()==0 && Z.numCols()==0) {
+        Z.resize(n, k);
+    }
+    ASSERT(w.length()==k);
+    ASSERT(Z.numRows()==n && Z.numCols()==k);
+
+    GeMatrix<FullStorage<T> >  Q(n, l), AQ(n, l), C(l, l);
+    DenseVector<Array<T> >     lambda(l), work(3*l);
+
+    rrf(A, Q, numPowerIterations, sketch);
+
+//
+//  Rayleigh-Ritz:  C = Q^T*A*Q is symmetric, its eigenvalues are in
+//  ascending order.
+//
+    AQ = A*Q;
+    C  = transpose(Q)*AQ;
+    ev(true, C.upper().symmetric(), lambda, work);
+
+    DenseVector<Array<IndexType> >  order(l);
+    for (IndexType i=1; i<=l; ++i) {
+        order(i) = i;
+    }
+    std::stable_sort(order.data(), order.data()+l,
+                     [&](IndexType a, IndexType b) {
+                         return std::abs(lambda(a))>std::abs(lambda(b));
+                     });
+
+    for (IndexType i=1; i<=k; ++i) {
+        w(i) = lambda(order(i));
+        blas::mv(NoTrans, T(1), Q, C(_,order(i)), T(0), Z(_,i));
+    }
+}
+
+#endif // USE_CXXLAPACK
+
+//== RsvdStream ================================================================
+
+template <typename T>
+RsvdStream<T>::RsvdStream(IndexType m, IndexType n, IndexType k,
+                          IndexType oversampling, unsigned int seed)
+    : m_(m), n_(n), k_(k), seed_(seed)
+{
+    const IndexType kk = std::min(k+oversampling, std::min(m, n));
+    const IndexType l  = 2*kk+1;
+
+    ASSERT(k<=kk);
+
+    std::seed_seq  seq{seed_};
+    std::mt19937   engine(seq);
+
+    Omega_.resize(n, kk);
+    Y_.resize(m, kk);
+    W_.resize(l, n);
+
+    rsvd_testMatrix(RSVD::Gaussian, Omega_, engine);
+    W_ = T(0);
+}
+
+template <typename T>
+template <typename MA>
+typename RestrictTo<IsRealGeMatrix<MA>::value,
+         void>::Type
+RsvdStream<T>::addRows(const MA &A)
+{
+    const Underscore<IndexType>  _;
+
+    const IndexType first = numRowsAdded()+1;
+    const IndexType last  = first+A.numRows()-1;
+
+    ASSERT(A.numCols()==n_);
+    ASSERT(last<=m_);
+
+    Matrix Psi(W_.numRows(), A.numRows());
+    psi_(first, A.numRows(), Psi);
+
+    auto Y = Y_(_(first,last),_);
+
+    blas::mm(NoTrans, NoTrans, T(1), A, Omega_, T(0), Y);
+    blas::mm(NoTrans, NoTrans, T(1), Psi, A, T(1), W_);
+
+    blocks_.push_back(A.numRows());
+}
+
+template <typename T>
+typename RsvdStream<T>::IndexType
+RsvdStream<T>::numRowsAdded() const
+{
+    IndexType numRows = 0;
+    for (size_t b=0; b<blocks_.size(); ++b) {
+        numRows += blocks_[b];
+    }
+    return numRows;
+}
+
+template <typename T>
+template <typename VS, typename MU, typename MVT>
+typename RestrictTo<IsRealDenseVector<VS>::value
+                 && IsRealGeMatrix<MU>::value
+                 && IsRealGeMatrix<MVT>::value,
+         void>::Type
+RsvdStream<T>::compute(VS &&s, MU &&U, MVT &&VT) const
+{
+    const Underscore<IndexType>  _;
+
+    const IndexType kk = Y_.numCols();
+    const IndexType l  = W_.numRows();
+
+    ASSERT(numRowsAdded()==m_);
+
+    if (s.length()==0) {
+        s.resize(k_);
+    }
+    if (U.numRows()==0 && U.numCols()==0) {
+        U.resize(m_, k_);
+    }
+    if (VT.numRows()==0 && VT.numCols()==0) {
+        VT.resize(k_, n_);
+    }
+    ASSERT(s.length()==k_);
+    ASSERT(U.numRows()==m_ && U.numCols()==k_);
+    ASSERT(VT.numRows()==k_ && VT.numCols()==n_);
+
+    Matrix Q = Y_;
+    rsvd_orth(Q);
+
+//
+//  Psi*Q with Psi regenerated block by block
+//
+    Matrix PsiQ(l, kk);
+
+    IndexType first = 1;
+    for (size_t b=0; b<blocks_.size(); ++b) {
+        const IndexType last = first+blocks_[b]-1;
+        Matrix Psi(l, blocks_[b]);
+
+        psi_(first, blocks_[b], Psi);
+        blas::mm(NoTrans, NoTrans, T(1), Psi, Q(_(first,last),_),
+                 T(1), PsiQ);
+        first = last+1;
+    }
+
+//
+//  X = (Psi*Q)^+ * W approximates Q^T*A.  ls overwrites the first kk rows
+//  of W with X.
+//
+    Matrix W = W_;
+    ls(NoTrans, PsiQ, W);
+
+    Matrix Bt = transpose(W(_(1,kk),_));
+    rsvd_svd(Q, Bt, s, U, VT);
+}
+
+template <typename T>
+void
+RsvdStream<T>::psi_(IndexType firstRow, IndexType numRows, Matrix &Psi) const
+{
+    std::seed_seq  seq{seed_, unsigned(firstRow)};
+    std::mt19937   engine(seq);
+
+    ASSERT(Psi.numCols()==numRows);
+    rsvd_testMatrix(RSVD::Gaussian, Psi, engine);
+}
+
+} } } // namespace extensions, lapack, flens
+
+#endif // PLAYGROUND_FLENS_LAPACKEXTENSIONS_GE_RSVD_TCC
@@ -0,0 +1,104 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn, Klaus Pototzky
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PLAYGROUND_FLENS_LAPACKEXTENSIONS_GT_CYCLICREDUCTION_H
+#define PLAYGROUND_FLENS_LAPACKEXTENSIONS_GT_CYCLICREDUCTION_H 1
+
+#include <flens/matrixtypes/matrixtypes.h>
+#include <flens/vectortypes/vectortypes.h>
+
+//
+//  With OpenMP levels with at least this many equations get split among
+//  the threads
+//
+#ifndef CR_PARALLEL_MIN
+#define CR_PARALLEL_MIN  4096
+#endif
+
+//
+//  Cyclic reduction (CR) and parallel cyclic reduction (PCR) for single
+//  large tridiagonal systems, see Hockney, Jesshope: "Parallel Computers
+//  2", 1988.  Both eliminate without pivoting and require A to be
+//  diagonally dominant or symmetric positive definite.  Zero pivots are
+//  not detected.
+//
+//  CR halves the number of equations on each of the log2(n) levels.  The
+//  equations of a level are independent and get distributed over OpenMP
+//  threads.  PCR reduces all n equations on each level.  It needs about
+//  n*log2(n) operations instead of 2n but has no serial back substitution.
+//
+namespace flens { namespace lapack { namespace extensions {
+
+//== cr_sv =====================================================================
+//
+//  Solves A*x = b where A has subdiagonal dl, diagonal d and superdiagonal
+//  du (lengths n-1, n and n-1).  dl, d and du get overwritten by the
+//  reduced systems.  No memory gets allocated.
+//
+template <typename VDL, typename VD, typename VDU, typename VB>
+    typename RestrictTo<IsDenseVector<VDL>::value
+                     && IsDenseVector<VD>::value
+                     && IsDenseVector<VDU>::value
+                     && IsDenseVector<VB>::value,
+             void>::Type
+    cr_sv(VDL &&dl, VD &&d, VDU &&du, VB &&b);
+
+//== cr_sv variant for a GbMatrix with unit bandwidths =========================
+template <typename MA, typename VB>
+    typename RestrictTo<IsGbMatrix<MA>::value
+                     && IsDenseVector<VB>::value,
+             void>::Type
+    cr_sv(MA &&A, VB &&b);
+
+//== pcr_sv ====================================================================
+//
+//  Solves A*x = b as above.  A is not overwritten, a workspace of 8n
+//  entries gets allocated.
+//
+template <typename VDL, typename VD, typename VDU, typename VB>
+    typename RestrictTo<IsDenseVector<VDL>::value
+                     && IsDenseVector<VD>::value
+                     && IsDenseVector<VDU>::value
+                     && IsDenseVector<VB>::value,
+             void>::Type
+    pcr_sv(const VDL &dl, const VD &d, const VDU &du, VB &&b);
+
+//== pcr_sv variant for a GbMatrix with unit bandwidths ========================
+template <typename MA, typename VB>
+    typename RestrictTo<IsGbMatrix<MA>::value
+                     && IsDenseVector<VB>::value,
+             void>::Type
+    pcr_sv(const MA &A, VB &&b);
+
+} } } // namespace extensions, lapack, flens
+
+#endif // PLAYGROUND_FLENS_LAPACKEXTENSIONS_GT_CYCLICREDUCTION_H
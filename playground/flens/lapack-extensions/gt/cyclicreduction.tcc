@@ -0,0 +1,264 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn, Klaus Pototzky
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PLAYGROUND_FLENS_LAPACKEXTENSIONS_GT_CYCLICREDUCTION_TCC
+#define PLAYGROUND_FLENS_LAPACKEXTENSIONS_GT_CYCLICREDUCTION_TCC 1
+
+#include <cxxstd/utility.h>
+#include <cxxstd/vector.h>
+#include <playground/flens/lapack-extensions/gt/cyclicreduction.h>
+
+namespace flens { namespace lapack { namespace extensions {
+
+//-- cr_sv ---------------------------------------------------------------------
+
+template <typename VDL, typename VD, typename VDU, typename VB>
+typename RestrictTo<IsDenseVector<VDL>::value
+                 && IsDenseVector<VD>::value
+                 && IsDenseVector<VDU>::value
+                 && IsDenseVector<VB>::value,
+         void>::Type
+cr_sv(VDL &&dl, VD &&d, VDU &&du, VB &&b)
+{
+    typedef typename RemoveRef<VB>::Type::ElementType  T;
+    typedef typename RemoveRef<VB>::Type::IndexType    IndexType;
+
+    const T Zero(0);
+
+    const IndexType n = d.length();
+
+    ASSERT(dl.firstIndex()==1);
+    ASSERT(d.firstIndex()==1);
+    ASSERT(du.firstIndex()==1);
+    ASSERT(b.firstIndex()==1);
+
+    if (n==0) {
+        return;
+    }
+    ASSERT(dl.length()==n-1);
+    ASSERT(du.length()==n-1);
+    ASSERT(b.length()==n);
+
+//
+//  Equation i is coupled to x(i-s) by a(i) = dl(i-1) and to x(i+s) by
+//  c(i) = du(i).  On the level with stride s the equations i = 2s, 4s, ...
+//  eliminate x(i-s) and x(i+s), afterwards they are coupled to x(i-2s) and
+//  x(i+2s).  Equations i-s and i+s are not modified on this level.
+//
+    IndexType s = 1;
+    for (; 2*s<=n; s*=2) {
+        const IndexType count = n/(2*s);
+
+#       ifdef _OPENMP
+#       pragma omp parallel for schedule(static) if (count>=CR_PARALLEL_MIN)
+#       endif
+        for (IndexType l=1; l<=count; ++l) {
+            const IndexType i = 2*s*l;
+
+            const T alpha = -dl(i-1) / d(i-s);
+            const T aPrev = (i-s>1) ? T(dl(i-s-1)) : Zero;
+
+            d(i)    += alpha*du(i-s);
+            b(i)    += alpha*b(i-s);
+            dl(i-1)  = alpha*aPrev;
+
+            if (i+s<=n) {
+                const T gamma = -du(i) / d(i+s);
+
+                d(i)  += gamma*dl(i+s-1);
+                b(i)  += gamma*b(i+s);
+                du(i)  = (i+s<n) ? T(gamma*du(i+s)) : Zero;
+            }
+        }
+    }
+//
+//  Back substitution.  On the level with stride s the equations i = s, 3s,
+//  5s, ... get solved, x(i-s) and x(i+s) are already known.
+//
+    for (; s>=1; s/=2) {
+        const IndexType count = (n/s+1)/2;
+
+#       ifdef _OPENMP
+#       pragma omp parallel for schedule(static) if (count>=CR_PARALLEL_MIN)
+#       endif
+        for (IndexType l=1; l<=count; ++l) {
+            const IndexType i = s*(2*l-1);
+
+            T x = b(i);
+            if (i>s) {
+                x -= dl(i-1)*b(i-s);
+            }
+            if (i+s<=n) {
+                x -= du(i)*b(i+s);
+            }
+            b(i) = x / d(i);
+        }
+    }
+}
+
+//-- cr_sv [GbMatrix variant] --------------------------------------------------
+
+template <typename MA, typename VB>
+typename RestrictTo<IsGbMatrix<MA>::value
+                 && IsDenseVector<VB>::value,
+         void>::Type
+cr_sv(MA &&A, VB &&b)
+{
+    typedef typename RemoveRef<MA>::Type::IndexType  IndexType;
+
+    const Underscore<IndexType> _;
+
+    ASSERT(A.numRows()==A.numCols());
+    ASSERT(A.numSubDiags()==1);
+    ASSERT(A.numSuperDiags()==1);
+
+    auto d = A.diag(0);
+
+    if (A.numRows()==1) {
+        cr_sv(d(_(1,0)), d, d(_(1,0)), b);
+        return;
+    }
+    cr_sv(A.diag(-1), d, A.diag(1), b);
+}
+
+//-- pcr_sv --------------------------------------------------------------------
+
+template <typename VDL, typename VD, typename VDU, typename VB>
+typename RestrictTo<IsDenseVector<VDL>::value
+                 && IsDenseVector<VD>::value
+                 && IsDenseVector<VDU>::value
+                 && IsDenseVector<VB>::value,
+         void>::Type
+pcr_sv(const VDL &dl, const VD &d, const VDU &du, VB &&b)
+{
+    typedef typename RemoveRef<VB>::Type::ElementType  T;
+    typedef typename RemoveRef<VB>::Type::IndexType    IndexType;
+
+    const T Zero(0);
+
+    const IndexType n = d.length();
+
+    ASSERT(dl.firstIndex()==1);
+    ASSERT(d.firstIndex()==1);
+    ASSERT(du.firstIndex()==1);
+    ASSERT(b.firstIndex()==1);
+
+    if (n==0) {
+        return;
+    }
+    ASSERT(dl.length()==n-1);
+    ASSERT(du.length()==n-1);
+    ASSERT(b.length()==n);
+
+//
+//  Two copies of the coefficients a, d, c and the right hand side f (zero
+//  based).  Each level reads from the first and writes to the second copy.
+//
+    std::vector<T> work(8*n);
+
+    T *a0 = &work[0],   *d0 = a0 + n, *c0 = d0 + n, *f0 = c0 + n;
+    T *a1 = f0 + n,     *d1 = a1 + n, *c1 = d1 + n, *f1 = c1 + n;
+
+    for (IndexType i=0; i<n; ++i) {
+        a0[i] = (i>0)   ? T(dl(i))   : Zero;
+        c0[i] = (i<n-1) ? T(du(i+1)) : Zero;
+        d0[i] = d(i+1);
+        f0[i] = b(i+1);
+    }
+
+    for (IndexType s=1; s<n; s*=2) {
+#       ifdef _OPENMP
+#       pragma omp parallel for schedule(static) if (n>=CR_PARALLEL_MIN)
+#       endif
+        for (IndexType i=0; i<n; ++i) {
+            T ai = Zero, ci = Zero, di = d0[i], fi = f0[i];
+
+            if (i>=s) {
+                const T alpha = -a0[i] / d0[i-s];
+
+                ai  = alpha*a0[i-s];
+                di += alpha*c0[i-s];
+                fi += alpha*f0[i-s];
+            }
+            if (i+s<n) {
+                const T gamma = -c0[i] / d0[i+s];
+
+                ci  = gamma*c0[i+s];
+                di += gamma*a0[i+s];
+                fi += gamma*f0[i+s];
+            }
+            a1[i] = ai;
+            d1[i] = di;
+            c1[i] = ci;
+            f1[i] = fi;
+        }
+        std::swap(a0, a1);
+        std::swap(d0, d1);
+        std::swap(c0, c1);
+        std::swap(f0, f1);
+    }
+//
+//  All equations are decoupled now
+//
+    for (IndexType i=0; i<n; ++i) {
+        b(i+1) = f0[i] / d0[i];
+    }
+}
+
+//-- pcr_sv [GbMatrix variant] -------------------------------------------------
+
+template <typename MA, typename VB>
+typename RestrictTo<IsGbMatrix<MA>::value
+                 && IsDenseVector<VB>::value,
+         void>::Type
+pcr_sv(const MA &A, VB &&b)
+{
+    typedef typename MA::IndexType  IndexType;
+
+    const Underscore<IndexType> _;
+
+    ASSERT(A.numRows()==A.numCols());
+    ASSERT(A.numSubDiags()==1);
+    ASSERT(A.numSuperDiags()==1);
+
+    const auto d = A.diag(0);
+
+    if (A.numRows()==1) {
+        pcr_sv(d(_(1,0)), d, d(_(1,0)), b);
+        return;
+    }
+    pcr_sv(A.diag(-1), d, A.diag(1), b);
+}
+
+} } } // namespace extensions, lapack, flens
+
+#endif // PLAYGROUND_FLENS_LAPACKEXTENSIONS_GT_CYCLICREDUCTION_TCC
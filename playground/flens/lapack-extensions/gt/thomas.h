@@ -0,0 +1,124 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn, Klaus Pototzky
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PLAYGROUND_FLENS_LAPACKEXTENSIONS_GT_THOMAS_H
+#define PLAYGROUND_FLENS_LAPACKEXTENSIONS_GT_THOMAS_H 1
+
+#include <flens/matrixtypes/matrixtypes.h>
+#include <flens/vectortypes/vectortypes.h>
+
+//
+//  Number of systems eliminated at once by thomas_sv_batched
+//
+#ifndef THOMAS_BATCH_SIZE
+#define THOMAS_BATCH_SIZE  64
+#endif
+
+//
+//  Thomas algorithm, i.e. Gaussian elimination without pivoting, for
+//  tridiagonal systems.  Stable if A is diagonally dominant or symmetric
+//  positive definite, otherwise use lapack::gtsv.  The routines do not
+//  allocate memory, the caller provides the workspace.
+//
+namespace flens { namespace lapack { namespace extensions {
+
+//== thomas_sv =================================================================
+//
+//  Solves A*x = b where A has subdiagonal dl, diagonal d and superdiagonal
+//  du (lengths n-1, n and n-1).  A is not overwritten, work must have at
+//  least n-1 entries.  Returns zero on success or i if the i-th pivot is
+//  zero.
+//
+template <typename VDL, typename VD, typename VDU, typename VB, typename VW>
+    typename RestrictTo<IsDenseVector<VDL>::value
+                     && IsDenseVector<VD>::value
+                     && IsDenseVector<VDU>::value
+                     && IsDenseVector<VB>::value
+                     && IsDenseVector<VW>::value,
+             typename RemoveRef<VB>::Type::IndexType>::Type
+    thomas_sv(const VDL &dl, const VD &d, const VDU &du, VB &&b, VW &&work);
+
+//== thomas_sv for multiple right hand sides ===================================
+//
+//  The elimination is done once for all columns of B.  Rows of B get
+//  updated at once, so a RowMajor B is traversed with unit stride.
+//
+template <typename VDL, typename VD, typename VDU, typename MB, typename VW>
+    typename RestrictTo<IsDenseVector<VDL>::value
+                     && IsDenseVector<VD>::value
+                     && IsDenseVector<VDU>::value
+                     && IsGeMatrix<MB>::value
+                     && IsDenseVector<VW>::value,
+             typename RemoveRef<MB>::Type::IndexType>::Type
+    thomas_sv(const VDL &dl, const VD &d, const VDU &du, MB &&B, VW &&work);
+
+//== thomas_sv variants for a GbMatrix with unit bandwidths ====================
+template <typename MA, typename VB, typename VW>
+    typename RestrictTo<IsGbMatrix<MA>::value
+                     && IsDenseVector<VB>::value
+                     && IsDenseVector<VW>::value,
+             typename RemoveRef<VB>::Type::IndexType>::Type
+    thomas_sv(const MA &A, VB &&b, VW &&work);
+
+template <typename MA, typename MB, typename VW>
+    typename RestrictTo<IsGbMatrix<MA>::value
+                     && IsGeMatrix<MB>::value
+                     && IsDenseVector<VW>::value,
+             typename RemoveRef<MB>::Type::IndexType>::Type
+    thomas_sv(const MA &A, MB &&B, VW &&work);
+
+//== thomas_sv_batched =========================================================
+//
+//  Solves the m independent systems A_k*x_k = b_k, k=1..m.  Column k of the
+//  n x m matrices DL, D, DU and B contains the subdiagonal, diagonal,
+//  superdiagonal and right hand side of system k.  DL(1,_) and DU(n,_) are
+//  not used.  On exit B contains the solutions.  Work is a n x m matrix.
+//
+//  The elimination proceeds row by row for a block of systems at once.  If
+//  all matrices are stored RowMajor the systems are interleaved in memory
+//  and the inner loop runs with unit stride across SIMD lanes.  Blocks of
+//  systems get distributed over OpenMP threads.  Zero pivots are not
+//  detected.
+//
+template <typename MDL, typename MD, typename MDU, typename MB, typename MW>
+    typename RestrictTo<IsGeMatrix<MDL>::value
+                     && IsGeMatrix<MD>::value
+                     && IsGeMatrix<MDU>::value
+                     && IsGeMatrix<MB>::value
+                     && IsGeMatrix<MW>::value,
+             void>::Type
+    thomas_sv_batched(const MDL &DL, const MD &D, const MDU &DU, MB &&B,
+                      MW &&Work);
+
+} } } // namespace extensions, lapack, flens
+
+#endif // PLAYGROUND_FLENS_LAPACKEXTENSIONS_GT_THOMAS_H
@@ -0,0 +1,397 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn, Klaus Pototzky
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PLAYGROUND_FLENS_LAPACKEXTENSIONS_GT_THOMAS_TCC
+#define PLAYGROUND_FLENS_LAPACKEXTENSIONS_GT_THOMAS_TCC 1
+
+#include <cxxstd/algorithm.h>
+#include <playground/flens/lapack-extensions/gt/thomas.h>
+
+namespace flens { namespace lapack { namespace extensions {
+
+//-- thomas_rowUpdate ----------------------------------------------------------
+//
+//  b = (b - l*bPrev)*r for all right hand sides of a row
+//
+template <bool Unit, typename T, typename IndexType>
+void
+thomas_rowUpdate(IndexType nRhs, const T &l, const T &r,
+                 const T *bPrev, T *b, IndexType inc)
+{
+    const IndexType s = Unit ? IndexType(1) : inc;
+
+    for (IndexType j=0; j<nRhs; ++j) {
+        b[j*s] = (b[j*s] - l*bPrev[j*s])*r;
+    }
+}
+
+//-- thomas_rowBack ------------------------------------------------------------
+//
+//  b = b - c*bNext for all right hand sides of a row
+//
+template <bool Unit, typename T, typename IndexType>
+void
+thomas_rowBack(IndexType nRhs, const T &c, const T *bNext, T *b,
+               IndexType inc)
+{
+    const IndexType s = Unit ? IndexType(1) : inc;
+
+    for (IndexType j=0; j<nRhs; ++j) {
+        b[j*s] -= c*bNext[j*s];
+    }
+}
+
+//-- thomas_batchedKernel ------------------------------------------------------
+//
+//  Solves m systems.  Pointers refer to entry (1,1) of DL, D, DU, B and Work,
+//  rs[] and cs[] are the row and column strides of these matrices.
+//
+template <bool Unit, typename T, typename IndexType>
+void
+thomas_batchedKernel(IndexType n, IndexType m,
+                     const T *dl, const T *d, const T *du, T *b, T *c,
+                     const IndexType *rs, const IndexType *cs)
+{
+    const T One(1);
+
+    const IndexType sDL = Unit ? IndexType(1) : cs[0];
+    const IndexType sD  = Unit ? IndexType(1) : cs[1];
+    const IndexType sDU = Unit ? IndexType(1) : cs[2];
+    const IndexType sB  = Unit ? IndexType(1) : cs[3];
+    const IndexType sW  = Unit ? IndexType(1) : cs[4];
+
+    for (IndexType k=0; k<m; ++k) {
+        const T r = One / d[k*sD];
+        c[k*sW]  = du[k*sDU]*r;
+        b[k*sB] *= r;
+    }
+//
+//  Forward elimination, row i of all systems at once
+//
+    for (IndexType i=1; i<n; ++i) {
+        const T *dli = dl + i*rs[0];
+        const T *di  = d  + i*rs[1];
+        const T *dui = du + i*rs[2];
+        const T *bp  = b  + (i-1)*rs[3];
+        const T *cp  = c  + (i-1)*rs[4];
+        T       *bi  = b  + i*rs[3];
+        T       *ci  = c  + i*rs[4];
+
+        for (IndexType k=0; k<m; ++k) {
+            const T r = One / (di[k*sD] - dli[k*sDL]*cp[k*sW]);
+            ci[k*sW] = dui[k*sDU]*r;
+            bi[k*sB] = (bi[k*sB] - dli[k*sDL]*bp[k*sB])*r;
+        }
+    }
+//
+//  Back substitution
+//
+    for (IndexType i=n-2; i>=0; --i) {
+        const T *bn = b + (i+1)*rs[3];
+        const T *ci = c + i*rs[4];
+        T       *bi = b + i*rs[3];
+
+        for (IndexType k=0; k<m; ++k) {
+            bi[k*sB] -= ci[k*sW]*bn[k*sB];
+        }
+    }
+}
+
+//-- thomas_sv -----------------------------------------------------------------
+
+template <typename VDL, typename VD, typename VDU, typename VB, typename VW>
+typename RestrictTo<IsDenseVector<VDL>::value
+                 && IsDenseVector<VD>::value
+                 && IsDenseVector<VDU>::value
+                 && IsDenseVector<VB>::value
+                 && IsDenseVector<VW>::value,
+         typename RemoveRef<VB>::Type::IndexType>::Type
+thomas_sv(const VDL &dl, const VD &d, const VDU &du, VB &&b, VW &&work)
+{
+    typedef typename RemoveRef<VB>::Type::ElementType  T;
+    typedef typename RemoveRef<VB>::Type::IndexType    IndexType;
+
+    const T Zero(0), One(1);
+
+    const IndexType n = d.length();
+
+    ASSERT(dl.firstIndex()==1);
+    ASSERT(d.firstIndex()==1);
+    ASSERT(du.firstIndex()==1);
+    ASSERT(b.firstIndex()==1);
+    ASSERT(work.firstIndex()==1);
+
+    if (n==0) {
+        return 0;
+    }
+    ASSERT(dl.length()==n-1);
+    ASSERT(du.length()==n-1);
+    ASSERT(b.length()==n);
+    ASSERT(work.length()>=n-1);
+
+    if (d(1)==Zero) {
+        return 1;
+    }
+
+    T r = One / d(1);
+    if (n>1) {
+        work(1) = du(1)*r;
+    }
+    b(1) *= r;
+
+    for (IndexType i=2; i<=n; ++i) {
+        const T p = d(i) - dl(i-1)*work(i-1);
+        if (p==Zero) {
+            return i;
+        }
+        r = One / p;
+        if (i<n) {
+            work(i) = du(i)*r;
+        }
+        b(i) = (b(i) - dl(i-1)*b(i-1))*r;
+    }
+    for (IndexType i=n-1; i>=1; --i) {
+        b(i) -= work(i)*b(i+1);
+    }
+    return 0;
+}
+
+//-- thomas_sv [multiple right hand sides] -------------------------------------
+
+template <typename VDL, typename VD, typename VDU, typename MB, typename VW>
+typename RestrictTo<IsDenseVector<VDL>::value
+                 && IsDenseVector<VD>::value
+                 && IsDenseVector<VDU>::value
+                 && IsGeMatrix<MB>::value
+                 && IsDenseVector<VW>::value,
+         typename RemoveRef<MB>::Type::IndexType>::Type
+thomas_sv(const VDL &dl, const VD &d, const VDU &du, MB &&B, VW &&work)
+{
+    typedef typename RemoveRef<MB>::Type::ElementType  T;
+    typedef typename RemoveRef<MB>::Type::IndexType    IndexType;
+
+    const T Zero(0), One(1);
+
+    const IndexType n    = d.length();
+    const IndexType nRhs = B.numCols();
+
+    ASSERT(dl.firstIndex()==1);
+    ASSERT(d.firstIndex()==1);
+    ASSERT(du.firstIndex()==1);
+    ASSERT(work.firstIndex()==1);
+    ASSERT(B.firstRow()==1);
+    ASSERT(B.firstCol()==1);
+
+    if (n==0 || nRhs==0) {
+        return 0;
+    }
+    ASSERT(dl.length()==n-1);
+    ASSERT(du.length()==n-1);
+    ASSERT(B.numRows()==n);
+    ASSERT(work.length()>=n-1);
+
+    if (d(1)==Zero) {
+        return 1;
+    }
+
+    const IndexType inc  = (B.order()==RowMajor) ? 1 : B.leadingDimension();
+    const IndexType incI = (B.order()==RowMajor) ? B.leadingDimension() : 1;
+    const bool      unit = (inc==1);
+
+    T *b = B.data();
+
+    T r = One / d(1);
+    if (n>1) {
+        work(1) = du(1)*r;
+    }
+    for (IndexType j=0; j<nRhs; ++j) {
+        b[j*inc] *= r;
+    }
+
+    for (IndexType i=2; i<=n; ++i) {
+        const T p = d(i) - dl(i-1)*work(i-1);
+        if (p==Zero) {
+            return i;
+        }
+        r = One / p;
+        if (i<n) {
+            work(i) = du(i)*r;
+        }
+        T *bi = b + (i-1)*incI;
+        if (unit) {
+            thomas_rowUpdate<true>(nRhs, T(dl(i-1)), r, bi-incI, bi, inc);
+        } else {
+            thomas_rowUpdate<false>(nRhs, T(dl(i-1)), r, bi-incI, bi, inc);
+        }
+    }
+    for (IndexType i=n-1; i>=1; --i) {
+        T *bi = b + (i-1)*incI;
+        if (unit) {
+            thomas_rowBack<true>(nRhs, T(work(i)), bi+incI, bi, inc);
+        } else {
+            thomas_rowBack<false>(nRhs, T(work(i)), bi+incI, bi, inc);
+        }
+    }
+    return 0;
+}
+
+//-- thomas_sv [GbMatrix variants] ---------------------------------------------
+
+template <typename MA, typename VB, typename VW>
+typename RestrictTo<IsGbMatrix<MA>::value
+                 && IsDenseVector<VB>::value
+                 && IsDenseVector<VW>::value,
+         typename RemoveRef<VB>::Type::IndexType>::Type
+thomas_sv(const MA &A, VB &&b, VW &&work)
+{
+    typedef typename MA::IndexType  IndexType;
+
+    const Underscore<IndexType> _;
+
+    ASSERT(A.numRows()==A.numCols());
+    ASSERT(A.numSubDiags()==1);
+    ASSERT(A.numSuperDiags()==1);
+
+    const auto d = A.diag(0);
+
+    if (A.numRows()==1) {
+        return thomas_sv(d(_(1,0)), d, d(_(1,0)), b, work);
+    }
+    return thomas_sv(A.diag(-1), d, A.diag(1), b, work);
+}
+
+template <typename MA, typename MB, typename VW>
+typename RestrictTo<IsGbMatrix<MA>::value
+                 && IsGeMatrix<MB>::value
+                 && IsDenseVector<VW>::value,
+         typename RemoveRef<MB>::Type::IndexType>::Type
+thomas_sv(const MA &A, MB &&B, VW &&work)
+{
+    typedef typename MA::IndexType  IndexType;
+
+    const Underscore<IndexType> _;
+
+    ASSERT(A.numRows()==A.numCols());
+    ASSERT(A.numSubDiags()==1);
+    ASSERT(A.numSuperDiags()==1);
+
+    const auto d = A.diag(0);
+
+    if (A.numRows()==1) {
+        return thomas_sv(d(_(1,0)), d, d(_(1,0)), B, work);
+    }
+    return thomas_sv(A.diag(-1), d, A.diag(1), B, work);
+}
+
+//-- thomas_sv_batched ---------------------------------------------------------
+
+template <typename MDL, typename MD, typename MDU, typename MB, typename MW>
+typename RestrictTo<IsGeMatrix<MDL>::value
+                 && IsGeMatrix<MD>::value
+                 && IsGeMatrix<MDU>::value
+                 && IsGeMatrix<MB>::value
+                 && IsGeMatrix<MW>::value,
+         void>::Type
+thomas_sv_batched(const MDL &DL, const MD &D, const MDU &DU, MB &&B,
+                  MW &&Work)
+{
+    using std::min;
+
+    typedef typename RemoveRef<MB>::Type::ElementType  T;
+    typedef typename RemoveRef<MB>::Type::IndexType    IndexType;
+
+    const IndexType n = B.numRows();
+    const IndexType m = B.numCols();
+
+    ASSERT(DL.numRows()==n && DL.numCols()==m);
+    ASSERT(D.numRows()==n && D.numCols()==m);
+    ASSERT(DU.numRows()==n && DU.numCols()==m);
+    ASSERT(Work.numRows()==n && Work.numCols()==m);
+
+    if (n==0 || m==0) {
+        return;
+    }
+
+//
+//  Row and column strides of DL, D, DU, B and Work
+//
+    IndexType rs[5], cs[5];
+
+    const StorageOrder order[5] = { DL.order(), D.order(), DU.order(),
+                                    B.order(), Work.order() };
+    const IndexType    ld[5]    = { DL.leadingDimension(),
+                                    D.leadingDimension(),
+                                    DU.leadingDimension(),
+                                    B.leadingDimension(),
+                                    Work.leadingDimension() };
+    bool unit = true;
+    for (int l=0; l<5; ++l) {
+        rs[l] = (order[l]==RowMajor) ? ld[l] : 1;
+        cs[l] = (order[l]==RowMajor) ? 1 : ld[l];
+        unit  = unit && (cs[l]==1);
+    }
+
+//
+//  Blocks of systems, each thread eliminates its blocks row by row
+//
+    const IndexType bs        = THOMAS_BATCH_SIZE;
+    const IndexType numBlocks = (m+bs-1)/bs;
+
+    const T *dl = DL.data();
+    const T *d  = D.data();
+    const T *du = DU.data();
+    T       *b  = B.data();
+    T       *c  = Work.data();
+
+#   ifdef _OPENMP
+#   pragma omp parallel for schedule(static)
+#   endif
+    for (IndexType l=0; l<numBlocks; ++l) {
+        const IndexType k  = l*bs;
+        const IndexType mk = min(bs, m-k);
+
+        if (unit) {
+            thomas_batchedKernel<true>(n, mk,
+                                       dl+k, d+k, du+k, b+k, c+k,
+                                       rs, cs);
+        } else {
+            thomas_batchedKernel<false>(n, mk,
+                                        dl+k*cs[0], d+k*cs[1], du+k*cs[2],
+                                        b+k*cs[3], c+k*cs[4],
+                                        rs, cs);
+        }
+    }
+}
+
+} } } // namespace extensions, lapack, flens
+
+#endif // PLAYGROUND_FLENS_LAPACKEXTENSIONS_GT_THOMAS_TCC
@@ -34,9 +34,13 @@
 #define PLAYGROUND_FLENS_LAPACKEXTENSIONS_LAPACKEXTENSIONS_H 1
 
 #include<playground/flens/lapack-extensions/gb/determinant.tcc>
+#include<playground/flens/lapack-extensions/gb/spike.h>
 #include<playground/flens/lapack-extensions/gb/trace.tcc>
 #include<playground/flens/lapack-extensions/ge/determinant.h>
+#include<playground/flens/lapack-extensions/ge/rsvd.h>
 #include<playground/flens/lapack-extensions/ge/trace.h>
+#include<playground/flens/lapack-extensions/gt/cyclicreduction.h>
+#include<playground/flens/lapack-extensions/gt/thomas.h>
 #include<playground/flens/lapack-extensions/hb/trace.h>
 #include<playground/flens/lapack-extensions/he/determinant.h>
 #include<playground/flens/lapack-extensions/he/trace.h>
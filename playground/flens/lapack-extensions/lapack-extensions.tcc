@@ -34,9 +34,13 @@
 #define PLAYGROUND_FLENS_LAPACKEXTENSIONS_LAPACKEXTENSIONS_TCC 1
 
 #include<playground/flens/lapack-extensions/gb/determinant.tcc>
+#include<playground/flens/lapack-extensions/gb/spike.tcc>
 #include<playground/flens/lapack-extensions/gb/trace.tcc>
 #include<playground/flens/lapack-extensions/ge/determinant.tcc>
+#include<playground/flens/lapack-extensions/ge/rsvd.tcc>
 #include<playground/flens/lapack-extensions/ge/trace.tcc>
+#include<playground/flens/lapack-extensions/gt/cyclicreduction.tcc>
+#include<playground/flens/lapack-extensions/gt/thomas.tcc>
 #include<playground/flens/lapack-extensions/hb/trace.tcc>
 #include<playground/flens/lapack-extensions/he/determinant.tcc>
 #include<playground/flens/lapack-extensions/he/trace.tcc>
@@ -0,0 +1,112 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn, Klaus Pototzky
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PLAYGROUND_FLENS_MPI_ALLREDUCE_ALLREDUCE_TCC
+#define PLAYGROUND_FLENS_MPI_ALLREDUCE_ALLREDUCE_TCC 1
+
+#include<playground/flens/mpi/mpi-flens.h>
+
+namespace flens { namespace mpi {
+
+#ifdef WITH_MPI
+
+template <typename T, typename... TS>
+typename RestrictTo<MPI_Type<T>::Compatible,
+                    void>::Type
+MPI_allreduce_sum(const MPI::Comm &communicator, T &x, TS &... xs)
+{
+    typedef typename MPI_Type<T>::PrimitiveType  PT;
+
+    const int n  = 1 + sizeof...(TS);
+    T         *p[n] = { &x, &xs... };
+    T         buffer[n];
+
+    for (int i=0; i<n; ++i) {
+        buffer[i] = *p[i];
+    }
+    communicator.Allreduce(MPI::IN_PLACE, reinterpret_cast<PT *>(buffer),
+                           n*MPI_Type<T>::size, MPI_Type<T>::Type(),
+                           MPI::SUM);
+    for (int i=0; i<n; ++i) {
+        *p[i] = buffer[i];
+    }
+}
+
+template <typename T, typename... TS>
+typename RestrictTo<MPI_Type<T>::Compatible,
+                    void>::Type
+MPI_allreduce_sum(T &x, TS &... xs)
+{
+    MPI_allreduce_sum(MPI::COMM_WORLD, x, xs...);
+}
+
+template <typename T>
+typename RestrictTo<MPI_Type<T>::Compatible,
+                    MPI::Request>::Type
+MPI_iallreduce_sum(T &x, const MPI::Comm &communicator)
+{
+    MPI_Request request;
+
+    MPI_Iallreduce(MPI_IN_PLACE, &x, MPI_Type<T>::size, MPI_Type<T>::Type(),
+                   MPI_SUM, communicator, &request);
+    return request;
+}
+
+template <typename X>
+typename RestrictTo<IsDenseVector<X>::value ||
+                    IsGeMatrix<X>::value,
+                    MPI::Request>::Type
+MPI_iallreduce_sum(X &&x, const MPI::Comm &communicator)
+{
+    MPI_Buffer   buffer(x);
+    MPI_Request  request;
+
+    MPI_ASSERT( buffer.isContiguous() );
+
+    MPI_Iallreduce(MPI_IN_PLACE, buffer.data(), buffer.count(),
+                   buffer.type(), MPI_SUM, communicator, &request);
+    return request;
+}
+
+#else
+
+template <typename T, typename... TS>
+void
+MPI_allreduce_sum(T &, TS &...)
+{
+}
+
+#endif // WITH_MPI
+
+} }
+
+#endif // PLAYGROUND_FLENS_MPI_ALLREDUCE_ALLREDUCE_TCC
@@ -56,19 +56,9 @@ typename RestrictTo<MPI_Type<T>::Compatible,
 MPI_bcast(const IndexType n, T *x, const IndexType incX, const int root,
           const MPI::Comm &communicator)
 {
-    typedef typename MPI_Type<T>::PrimitiveType  PT;
-
-    if ( incX==1 ) {
-        communicator.Bcast(reinterpret_cast<PT *>(x),
-                           n*MPI_Type<T>::size, MPI_Type<T>::Type(), root);
-    } else {
-
-        for (IndexType i=0, iX=0; i<n; ++i, iX+=incX) {
-            MPI_bcast(x[iX], root, communicator);
-        }
-
-    }
+    MPI_Buffer  buffer(n, x, incX);
 
+    communicator.Bcast(buffer.data(), buffer.count(), buffer.type(), root);
 }
 
 template <typename VX>
@@ -111,8 +101,6 @@ MPI_bcast(MA &&A, const int root, const MPI::Comm &communicator)
     typedef typename RemoveRef<MA>::Type   MatrixA;
     typedef typename MatrixA::IndexType    IndexType;
 
-    const Underscore<IndexType> _;
-
     IndexType numRows = A.numRows();
     IndexType numCols = A.numCols();
 
@@ -126,17 +114,9 @@ MPI_bcast(MA &&A, const int root, const MPI::Comm &communicator)
     ASSERT( A.numRows()==numRows );
     ASSERT( A.numCols()==numCols );
 
-    if ( A.order() == ColMajor ) {
-        for (IndexType i=A.firstCol(); i<=A.lastCol(); ++i) {
-            auto x = A(_,i);
-            MPI_bcast(x.length(), x.data(), x.stride(), root, communicator);
-        }
-    } else {
-        for (IndexType i=A.firstRow(); i<=A.lastRow(); ++i) {
-            auto x = A(i,_);
-            MPI_bcast(x.length(), x.data(), x.stride(), root, communicator);
-        }
-    }
+    MPI_Buffer  buffer(A);
+
+    communicator.Bcast(buffer.data(), buffer.count(), buffer.type(), root);
 
 }
 
@@ -0,0 +1,114 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn, Klaus Pototzky
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PLAYGROUND_FLENS_MPI_BUFFER_H
+#define PLAYGROUND_FLENS_MPI_BUFFER_H 1
+
+#ifdef WITH_MPI
+#    include "mpi.h"
+#endif
+
+#include<flens/auxiliary/auxiliary.h>
+#include<flens/matrixtypes/matrixtypes.h>
+#include<flens/vectortypes/vectortypes.h>
+#include<playground/flens/mpi/types.h>
+
+namespace flens { namespace mpi {
+
+#ifdef WITH_MPI
+
+//
+//  Describes the memory of a FLENS vector or matrix (view) as an MPI buffer,
+//  i.e. the address of the first element, a count and a datatype.
+//
+//  Contiguous data uses the predefined datatype of the elements.  Strided
+//  vectors and matrices with a leading dimension larger than the number of
+//  rows (columns) get a derived datatype, so views can be communicated with
+//  one message and without copying them into a temporary.  The derived
+//  datatype gets freed by the destructor; this is allowed while
+//  non-blocking operations using it are still pending.
+//
+class MPI_Buffer
+{
+    public:
+        template <typename X>
+            explicit
+            MPI_Buffer(X &&x);
+
+        template <typename IndexType, typename T>
+            MPI_Buffer(IndexType n, const T *x, IndexType incX);
+
+        ~MPI_Buffer();
+
+        void *
+        data() const;
+
+        int
+        count() const;
+
+        MPI_Datatype
+        type() const;
+
+        bool
+        isContiguous() const;
+
+    private:
+        MPI_Buffer(const MPI_Buffer &rhs);
+
+        MPI_Buffer &
+        operator=(const MPI_Buffer &rhs);
+
+        template <typename VX>
+            typename RestrictTo<IsDenseVector<VX>::value,
+                                void>::Type
+            init_(const VX &x);
+
+        template <typename MA>
+            typename RestrictTo<IsGeMatrix<MA>::value,
+                                void>::Type
+            init_(const MA &A);
+
+        template <typename T>
+            void
+            init_(const T *x, int numBlocks, int blockLength, int blockStride);
+
+        void          *data_;
+        int           count_;
+        MPI_Datatype  type_;
+        bool          derived_;
+};
+
+#endif // WITH_MPI
+
+} }
+
+#endif // PLAYGROUND_FLENS_MPI_BUFFER_H
@@ -0,0 +1,142 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn, Klaus Pototzky
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PLAYGROUND_FLENS_MPI_BUFFER_TCC
+#define PLAYGROUND_FLENS_MPI_BUFFER_TCC 1
+
+#include<playground/flens/mpi/mpi-flens.h>
+
+namespace flens { namespace mpi {
+
+#ifdef WITH_MPI
+
+template <typename X>
+MPI_Buffer::MPI_Buffer(X &&x)
+    : data_(0), count_(0), type_(MPI_DATATYPE_NULL), derived_(false)
+{
+    init_(x);
+}
+
+template <typename IndexType, typename T>
+MPI_Buffer::MPI_Buffer(IndexType n, const T *x, IndexType incX)
+    : data_(0), count_(0), type_(MPI_DATATYPE_NULL), derived_(false)
+{
+    init_(x, n, 1, incX);
+}
+
+inline
+MPI_Buffer::~MPI_Buffer()
+{
+    if (derived_) {
+        MPI_Type_free(&type_);
+    }
+}
+
+inline void *
+MPI_Buffer::data() const
+{
+    return data_;
+}
+
+inline int
+MPI_Buffer::count() const
+{
+    return count_;
+}
+
+inline MPI_Datatype
+MPI_Buffer::type() const
+{
+    return type_;
+}
+
+inline bool
+MPI_Buffer::isContiguous() const
+{
+    return !derived_;
+}
+
+template <typename VX>
+typename RestrictTo<IsDenseVector<VX>::value,
+                    void>::Type
+MPI_Buffer::init_(const VX &x)
+{
+    init_(x.data(), x.length(), 1, x.stride());
+}
+
+template <typename MA>
+typename RestrictTo<IsGeMatrix<MA>::value,
+                    void>::Type
+MPI_Buffer::init_(const MA &A)
+{
+    if (A.order()==ColMajor) {
+        init_(A.data(), A.numCols(), A.numRows(), A.leadingDimension());
+    } else {
+        init_(A.data(), A.numRows(), A.numCols(), A.leadingDimension());
+    }
+}
+
+//
+//  numBlocks blocks of blockLength contiguous elements, the first elements
+//  of two consecutive blocks are blockStride elements apart.  Like in BLAS
+//  x points to the lowest address for a negative stride, i.e. to the last
+//  block.
+//
+template <typename T>
+void
+MPI_Buffer::init_(const T *x, int numBlocks, int blockLength,
+                  int blockStride)
+{
+    const int size = MPI_Type<T>::size;
+
+    if (blockStride<0 && numBlocks>1) {
+        x -= (numBlocks-1)*blockStride;
+    }
+    data_ = const_cast<T *>(x);
+    type_ = MPI_Type<T>::Type();
+
+    if (numBlocks<=1 || blockLength==blockStride) {
+        count_ = numBlocks*blockLength*size;
+        return;
+    }
+    MPI_Type_vector(numBlocks, blockLength*size, blockStride*size,
+                    MPI_Type<T>::Type(), &type_);
+    MPI_Type_commit(&type_);
+    count_   = 1;
+    derived_ = true;
+}
+
+#endif // WITH_MPI
+
+} }
+
+#endif // PLAYGROUND_FLENS_MPI_BUFFER_TCC
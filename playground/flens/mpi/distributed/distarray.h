@@ -0,0 +1,209 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn, Klaus Pototzky
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PLAYGROUND_FLENS_MPI_DISTRIBUTED_DISTARRAY_H
+#define PLAYGROUND_FLENS_MPI_DISTRIBUTED_DISTARRAY_H 1
+
+#ifdef WITH_MPI
+#    include "mpi.h"
+#endif
+
+#include<flens/auxiliary/auxiliary.h>
+#include<flens/storage/storage.h>
+
+namespace flens { namespace mpi {
+
+#ifdef WITH_MPI
+
+//
+//  Storage engine for DenseVector that is partitioned over the processes of
+//  a communicator.  Each process stores its part in a local Array; element
+//  access, views and all BLAS operations without reductions only work on
+//  this local part.  Reductions (dot, nrm2, asum) combine the local results
+//  over the communicator.
+//
+//  The communicator defaults to MPI::COMM_WORLD and gets inherited when a
+//  vector is initialized from another distributed vector (e.g. by
+//  r = b - A*x).  Views are plain local ArrayViews.
+//
+template <typename T>
+class DistArray
+{
+    public:
+        typedef Array<T>                             LocalArray;
+        typedef typename LocalArray::ElementType     ElementType;
+        typedef typename LocalArray::IndexType       IndexType;
+        typedef typename LocalArray::Allocator       Allocator;
+
+        // std:: typedefs
+        typedef typename LocalArray::allocator_type   allocator_type;
+        typedef typename LocalArray::size_type        size_type;
+        typedef typename LocalArray::value_type       value_type;
+        typedef typename LocalArray::pointer          pointer;
+        typedef typename LocalArray::const_pointer    const_pointer;
+        typedef typename LocalArray::reference        reference;
+        typedef typename LocalArray::const_reference  const_reference;
+
+        typedef typename LocalArray::ConstView       ConstView;
+        typedef typename LocalArray::View            View;
+        typedef DistArray                            NoView;
+
+        static const IndexType defaultIndexBase = LocalArray::defaultIndexBase;
+
+        DistArray();
+
+        explicit
+        DistArray(IndexType length,
+                  IndexType firstIndex = defaultIndexBase,
+                  const ElementType &value = ElementType());
+
+        DistArray(const MPI::Intracomm &communicator,
+                  IndexType length,
+                  IndexType firstIndex = defaultIndexBase,
+                  const ElementType &value = ElementType());
+
+        DistArray(const DistArray &rhs);
+
+        DistArray(DistArray &&rhs);
+
+        template <typename RHS,
+                  class = typename RestrictTo<!IsSame<RHS, DistArray>::value,
+                                              void>::Type>
+            DistArray(const RHS &rhs);
+
+        //-- operators ---------------------------------------------------------
+
+        const_reference
+        operator()(IndexType index) const;
+
+        reference
+        operator()(IndexType index);
+
+        //-- methods -----------------------------------------------------------
+
+        IndexType
+        firstIndex() const;
+
+        IndexType
+        lastIndex() const;
+
+        IndexType
+        length() const;
+
+        IndexType
+        stride() const;
+
+        const_pointer
+        data() const;
+
+        pointer
+        data();
+
+        const Allocator &
+        allocator() const;
+
+        bool
+        resize(IndexType length,
+               IndexType firstIndex = defaultIndexBase,
+               const ElementType &value = ElementType());
+
+        bool
+        resize(const DistArray &rhs, const ElementType &value = ElementType());
+
+        template <typename ARRAY>
+            bool
+            resize(const ARRAY &rhs, const ElementType &value = ElementType());
+
+        bool
+        reserve(IndexType length,
+                IndexType firstIndex = defaultIndexBase);
+
+        bool
+        reserve(const DistArray &rhs);
+
+        template <typename ARRAY>
+            bool
+            reserve(const ARRAY &rhs);
+
+        bool
+        fill(const ElementType &value = ElementType());
+
+        void
+        changeIndexBase(IndexType firstIndex);
+
+        void
+        swap(DistArray &rhs);
+
+        const ConstView
+        view(IndexType from, IndexType to,
+             IndexType stride = IndexType(1),
+             IndexType firstViewIndex = defaultIndexBase) const;
+
+        View
+        view(IndexType from, IndexType to,
+             IndexType stride = IndexType(1),
+             IndexType firstViewIndex = defaultIndexBase);
+
+        //-- distribution ------------------------------------------------------
+
+        const MPI::Intracomm &
+        communicator() const;
+
+        void
+        setCommunicator(const MPI::Intracomm &communicator);
+
+        const LocalArray &
+        local() const;
+
+        LocalArray &
+        local();
+
+    private:
+        const MPI::Intracomm  *communicator_;
+        LocalArray            local_;
+};
+
+//-- DistArray specific functions ----------------------------------------------
+
+//
+//  fillRandom
+//
+
+template <typename T>
+    bool
+    fillRandom(DistArray<T> &x);
+
+#endif // WITH_MPI
+
+} }
+
+#endif // PLAYGROUND_FLENS_MPI_DISTRIBUTED_DISTARRAY_H
@@ -0,0 +1,281 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn, Klaus Pototzky
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PLAYGROUND_FLENS_MPI_DISTRIBUTED_DISTARRAY_TCC
+#define PLAYGROUND_FLENS_MPI_DISTRIBUTED_DISTARRAY_TCC 1
+
+#include<playground/flens/mpi/mpi-flens.h>
+
+namespace flens { namespace mpi {
+
+#ifdef WITH_MPI
+
+template <typename T>
+DistArray<T>::DistArray()
+    : communicator_(&MPI::COMM_WORLD)
+{
+}
+
+template <typename T>
+DistArray<T>::DistArray(IndexType length, IndexType firstIndex,
+                        const ElementType &value)
+    : communicator_(&MPI::COMM_WORLD), local_(length, firstIndex, value)
+{
+}
+
+template <typename T>
+DistArray<T>::DistArray(const MPI::Intracomm &communicator,
+                        IndexType length, IndexType firstIndex,
+                        const ElementType &value)
+    : communicator_(&communicator), local_(length, firstIndex, value)
+{
+}
+
+template <typename T>
+DistArray<T>::DistArray(const DistArray &rhs)
+    : communicator_(rhs.communicator_), local_(rhs.local_)
+{
+}
+
+template <typename T>
+DistArray<T>::DistArray(DistArray &&rhs)
+    : communicator_(rhs.communicator_), local_(std::move(rhs.local_))
+{
+}
+
+template <typename T>
+template <typename RHS, class>
+DistArray<T>::DistArray(const RHS &rhs)
+    : communicator_(&MPI::COMM_WORLD), local_(rhs)
+{
+}
+
+//-- operators -----------------------------------------------------------------
+
+template <typename T>
+typename DistArray<T>::const_reference
+DistArray<T>::operator()(IndexType index) const
+{
+    return local_(index);
+}
+
+template <typename T>
+typename DistArray<T>::reference
+DistArray<T>::operator()(IndexType index)
+{
+    return local_(index);
+}
+
+//-- methods -------------------------------------------------------------------
+
+template <typename T>
+typename DistArray<T>::IndexType
+DistArray<T>::firstIndex() const
+{
+    return local_.firstIndex();
+}
+
+template <typename T>
+typename DistArray<T>::IndexType
+DistArray<T>::lastIndex() const
+{
+    return local_.lastIndex();
+}
+
+template <typename T>
+typename DistArray<T>::IndexType
+DistArray<T>::length() const
+{
+    return local_.length();
+}
+
+template <typename T>
+typename DistArray<T>::IndexType
+DistArray<T>::stride() const
+{
+    return local_.stride();
+}
+
+template <typename T>
+typename DistArray<T>::const_pointer
+DistArray<T>::data() const
+{
+    return local_.data();
+}
+
+template <typename T>
+typename DistArray<T>::pointer
+DistArray<T>::data()
+{
+    return local_.data();
+}
+
+template <typename T>
+const typename DistArray<T>::Allocator &
+DistArray<T>::allocator() const
+{
+    return local_.allocator();
+}
+
+template <typename T>
+bool
+DistArray<T>::resize(IndexType length, IndexType firstIndex,
+                     const ElementType &value)
+{
+    return local_.resize(length, firstIndex, value);
+}
+
+template <typename T>
+bool
+DistArray<T>::resize(const DistArray &rhs, const ElementType &value)
+{
+    communicator_ = rhs.communicator_;
+    return local_.resize(rhs.local_, value);
+}
+
+template <typename T>
+template <typename ARRAY>
+bool
+DistArray<T>::resize(const ARRAY &rhs, const ElementType &value)
+{
+    return local_.resize(rhs, value);
+}
+
+template <typename T>
+bool
+DistArray<T>::reserve(IndexType length, IndexType firstIndex)
+{
+    return local_.reserve(length, firstIndex);
+}
+
+template <typename T>
+bool
+DistArray<T>::reserve(const DistArray &rhs)
+{
+    communicator_ = rhs.communicator_;
+    return local_.reserve(rhs.local_);
+}
+
+template <typename T>
+template <typename ARRAY>
+bool
+DistArray<T>::reserve(const ARRAY &rhs)
+{
+    return local_.reserve(rhs);
+}
+
+template <typename T>
+bool
+DistArray<T>::fill(const ElementType &value)
+{
+    return local_.fill(value);
+}
+
+template <typename T>
+void
+DistArray<T>::changeIndexBase(IndexType firstIndex)
+{
+    local_.changeIndexBase(firstIndex);
+}
+
+template <typename T>
+void
+DistArray<T>::swap(DistArray &rhs)
+{
+    std::swap(communicator_, rhs.communicator_);
+    local_.swap(rhs.local_);
+}
+
+template <typename T>
+const typename DistArray<T>::ConstView
+DistArray<T>::view(IndexType from, IndexType to, IndexType stride,
+                   IndexType firstViewIndex) const
+{
+    return local_.view(from, to, stride, firstViewIndex);
+}
+
+template <typename T>
+typename DistArray<T>::View
+DistArray<T>::view(IndexType from, IndexType to, IndexType stride,
+                   IndexType firstViewIndex)
+{
+    return local_.view(from, to, stride, firstViewIndex);
+}
+
+//-- distribution --------------------------------------------------------------
+
+template <typename T>
+const MPI::Intracomm &
+DistArray<T>::communicator() const
+{
+    return *communicator_;
+}
+
+template <typename T>
+void
+DistArray<T>::setCommunicator(const MPI::Intracomm &communicator)
+{
+    communicator_ = &communicator;
+}
+
+template <typename T>
+const typename DistArray<T>::LocalArray &
+DistArray<T>::local() const
+{
+    return local_;
+}
+
+template <typename T>
+typename DistArray<T>::LocalArray &
+DistArray<T>::local()
+{
+    return local_;
+}
+
+//-- DistArray specific functions ----------------------------------------------
+
+//
+//  fillRandom
+//
+
+template <typename T>
+bool
+fillRandom(DistArray<T> &x)
+{
+    return fillRandom(x.local());
+}
+
+#endif // WITH_MPI
+
+} }
+
+#endif // PLAYGROUND_FLENS_MPI_DISTRIBUTED_DISTARRAY_TCC
@@ -0,0 +1,173 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn, Klaus Pototzky
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PLAYGROUND_FLENS_MPI_DISTRIBUTED_DISTGECRSMATRIX_H
+#define PLAYGROUND_FLENS_MPI_DISTRIBUTED_DISTGECRSMATRIX_H 1
+
+#ifdef WITH_MPI
+#    include "mpi.h"
+#endif
+
+#include<cxxstd/vector.h>
+#include<flens/matrixtypes/matrixtypes.h>
+#include<flens/storage/storage.h>
+#include<playground/flens/mpi/distributed/distarray.h>
+#include<playground/flens/mpi/distributed/haloexchange.h>
+
+namespace flens { namespace mpi {
+
+#ifdef WITH_MPI
+
+template <typename T>
+    class DistSyCRSMatrix;
+
+//
+//  Square sparse matrix partitioned by rows: each process owns a contiguous
+//  range of rows and the same range of the vectors it gets multiplied with
+//  (DenseVector<DistArray<T> >).
+//
+//  The local rows are split into a diagonal block (columns owned by this
+//  process) and an off-diagonal block whose columns are the ghosts, i.e. the
+//  off-process columns that actually occur.  Both blocks are GeCRSMatrix
+//  with local column indices.  A HaloExchange plan for the ghosts gets set
+//  up once by the constructor, so that blas::mv can overlap the product
+//  with the diagonal block with the ghost exchange.
+//
+template <typename T>
+class DistGeCRSMatrix
+    : public GeneralMatrix<DistGeCRSMatrix<T> >
+{
+    public:
+        typedef T                                   ElementType;
+        typedef GeCRSMatrix<CRS<T> >                LocalMatrix;
+        typedef typename LocalMatrix::IndexType     IndexType;
+        typedef DenseVector<DistArray<T> >          Vector;
+        typedef DistSyCRSMatrix<T>                  SymmetricView;
+
+        //
+        //  Collective.  localRows contains the rows owned by this process with
+        //  global column indices.  The global number of rows is the sum of
+        //  the local ones and must equal localRows.numCols().
+        //
+        template <typename CRS_>
+            DistGeCRSMatrix(const MPI::Intracomm &communicator,
+                            const GeCRSMatrix<CRS_> &localRows);
+
+        // -- views ------------------------------------------------------------
+
+        const SymmetricView
+        symmetric() const;
+
+        // -- methods ----------------------------------------------------------
+
+        IndexType
+        numRows() const;
+
+        IndexType
+        numCols() const;
+
+        IndexType
+        numLocalRows() const;
+
+        IndexType
+        firstLocalRow() const;
+
+        IndexType
+        lastLocalRow() const;
+
+        int
+        owner(IndexType i) const;
+
+        const MPI::Intracomm &
+        communicator() const;
+
+        Vector
+        vector() const;
+
+        // -- implementation ---------------------------------------------------
+
+        const LocalMatrix &
+        diagonalBlock() const;
+
+        const LocalMatrix &
+        offDiagonalBlock() const;
+
+        HaloExchange<T> &
+        halo() const;
+
+    private:
+        // Like GeCRSMatrix this matrix can not be copied.
+        DistGeCRSMatrix(const DistGeCRSMatrix &rhs);
+
+        const MPI::Intracomm     *communicator_;
+        IndexType                numRows_;
+        std::vector<IndexType>   offsets_;
+        LocalMatrix              diagonal_, offDiagonal_;
+        mutable HaloExchange<T>  halo_;
+};
+
+//
+//  View of a DistGeCRSMatrix that marks it as symmetric (or hermitian), e.g.
+//  for solver::cg.  All entries are stored and referenced.
+//
+template <typename T>
+class DistSyCRSMatrix
+    : public SymmetricMatrix<DistSyCRSMatrix<T> >
+{
+    public:
+        typedef T                                       ElementType;
+        typedef DistGeCRSMatrix<T>                      GeneralView;
+        typedef typename GeneralView::IndexType         IndexType;
+
+        DistSyCRSMatrix(const GeneralView &A);
+
+        IndexType
+        dim() const;
+
+        IndexType
+        numRows() const;
+
+        IndexType
+        numCols() const;
+
+        const GeneralView &
+        general() const;
+
+    private:
+        const GeneralView  &general_;
+};
+
+#endif // WITH_MPI
+
+} }
+
+#endif // PLAYGROUND_FLENS_MPI_DISTRIBUTED_DISTGECRSMATRIX_H
@@ -0,0 +1,254 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn, Klaus Pototzky
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PLAYGROUND_FLENS_MPI_DISTRIBUTED_DISTGECRSMATRIX_TCC
+#define PLAYGROUND_FLENS_MPI_DISTRIBUTED_DISTGECRSMATRIX_TCC 1
+
+#include<cxxstd/algorithm.h>
+#include<playground/flens/mpi/mpi-flens.h>
+
+namespace flens { namespace mpi {
+
+#ifdef WITH_MPI
+
+template <typename T>
+template <typename CRS_>
+DistGeCRSMatrix<T>::DistGeCRSMatrix(const MPI::Intracomm &communicator,
+                                    const GeCRSMatrix<CRS_> &localRows)
+    : communicator_(&communicator), numRows_(0),
+      offsets_(communicator.Get_size()+1, 0)
+{
+    typedef GeCoordMatrix<CoordStorage<T> >     CoordMatrix;
+    typedef typename CRS_::IndexType            CrsIndexType;
+
+    const int numProcs = communicator.Get_size();
+    const int rank     = communicator.Get_rank();
+
+//
+//  Row ranges of all processes
+//
+    const int  numLocal = localRows.numRows();
+    std::vector<int>  numLocalAll(numProcs);
+
+    communicator.Allgather(&numLocal, 1, MPI::INT,
+                           numLocalAll.data(), 1, MPI::INT);
+    for (int q=0; q<numProcs; ++q) {
+        offsets_[q+1] = offsets_[q] + numLocalAll[q];
+    }
+    numRows_ = offsets_[numProcs];
+    MPI_ASSERT(numRows_==localRows.numCols());
+
+    const IndexType first = offsets_[rank]+1;
+    const IndexType last  = offsets_[rank+1];
+
+    const auto &rows   = localRows.engine().rows();
+    const auto &cols   = localRows.engine().cols();
+    const auto &values = localRows.engine().values();
+
+    const CrsIndexType base = localRows.indexBase();
+
+//
+//  Ghosts: off-process columns sorted by global index
+//
+    std::vector<IndexType>  ghosts;
+
+    for (CrsIndexType k=cols.firstIndex(); k<=cols.lastIndex(); ++k) {
+        const IndexType j = cols(k)-base+1;
+        if (j<first || j>last) {
+            ghosts.push_back(j);
+        }
+    }
+    std::sort(ghosts.begin(), ghosts.end());
+    ghosts.erase(std::unique(ghosts.begin(), ghosts.end()), ghosts.end());
+
+    const IndexType numGhosts = ghosts.size();
+
+//
+//  Split the local rows into the diagonal and off-diagonal block
+//
+    CoordMatrix  D(numLocal, numLocal), O(numLocal, numGhosts);
+
+    for (IndexType i=1; i<=numLocal; ++i) {
+        const CrsIndexType r = rows.firstIndex()+i-1;
+
+        for (CrsIndexType k=rows(r); k<rows(r+1); ++k) {
+            const IndexType j = cols(k)-base+1;
+
+            if (j>=first && j<=last) {
+                D(i, j-first+1) += values(k);
+            } else {
+                const IndexType g = std::lower_bound(ghosts.begin(),
+                                                     ghosts.end(), j)
+                                  - ghosts.begin() + 1;
+                O(i, g) += values(k);
+            }
+        }
+    }
+    diagonal_    = D;
+    offDiagonal_ = O;
+
+    halo_.init(communicator, offsets_, ghosts);
+}
+
+// -- views --------------------------------------------------------------------
+
+template <typename T>
+const typename DistGeCRSMatrix<T>::SymmetricView
+DistGeCRSMatrix<T>::symmetric() const
+{
+    return SymmetricView(*this);
+}
+
+// -- methods ------------------------------------------------------------------
+
+template <typename T>
+typename DistGeCRSMatrix<T>::IndexType
+DistGeCRSMatrix<T>::numRows() const
+{
+    return numRows_;
+}
+
+template <typename T>
+typename DistGeCRSMatrix<T>::IndexType
+DistGeCRSMatrix<T>::numCols() const
+{
+    return numRows_;
+}
+
+template <typename T>
+typename DistGeCRSMatrix<T>::IndexType
+DistGeCRSMatrix<T>::numLocalRows() const
+{
+    return diagonal_.numRows();
+}
+
+template <typename T>
+typename DistGeCRSMatrix<T>::IndexType
+DistGeCRSMatrix<T>::firstLocalRow() const
+{
+    return offsets_[communicator_->Get_rank()]+1;
+}
+
+template <typename T>
+typename DistGeCRSMatrix<T>::IndexType
+DistGeCRSMatrix<T>::lastLocalRow() const
+{
+    return offsets_[communicator_->Get_rank()+1];
+}
+
+template <typename T>
+int
+DistGeCRSMatrix<T>::owner(IndexType i) const
+{
+    ASSERT(i>=1 && i<=numRows_);
+    return std::lower_bound(offsets_.begin(), offsets_.end(), i)
+         - offsets_.begin() - 1;
+}
+
+template <typename T>
+const MPI::Intracomm &
+DistGeCRSMatrix<T>::communicator() const
+{
+    return *communicator_;
+}
+
+template <typename T>
+typename DistGeCRSMatrix<T>::Vector
+DistGeCRSMatrix<T>::vector() const
+{
+    return Vector(DistArray<T>(*communicator_, numLocalRows()));
+}
+
+// -- implementation -----------------------------------------------------------
+
+template <typename T>
+const typename DistGeCRSMatrix<T>::LocalMatrix &
+DistGeCRSMatrix<T>::diagonalBlock() const
+{
+    return diagonal_;
+}
+
+template <typename T>
+const typename DistGeCRSMatrix<T>::LocalMatrix &
+DistGeCRSMatrix<T>::offDiagonalBlock() const
+{
+    return offDiagonal_;
+}
+
+template <typename T>
+HaloExchange<T> &
+DistGeCRSMatrix<T>::halo() const
+{
+    return halo_;
+}
+
+//== DistSyCRSMatrix ===========================================================
+
+template <typename T>
+DistSyCRSMatrix<T>::DistSyCRSMatrix(const GeneralView &A)
+    : general_(A)
+{
+}
+
+template <typename T>
+typename DistSyCRSMatrix<T>::IndexType
+DistSyCRSMatrix<T>::dim() const
+{
+    return general_.numRows();
+}
+
+template <typename T>
+typename DistSyCRSMatrix<T>::IndexType
+DistSyCRSMatrix<T>::numRows() const
+{
+    return general_.numRows();
+}
+
+template <typename T>
+typename DistSyCRSMatrix<T>::IndexType
+DistSyCRSMatrix<T>::numCols() const
+{
+    return general_.numCols();
+}
+
+template <typename T>
+const typename DistSyCRSMatrix<T>::GeneralView &
+DistSyCRSMatrix<T>::general() const
+{
+    return general_;
+}
+
+#endif // WITH_MPI
+
+} }
+
+#endif // PLAYGROUND_FLENS_MPI_DISTRIBUTED_DISTGECRSMATRIX_TCC
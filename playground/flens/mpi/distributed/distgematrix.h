@@ -0,0 +1,181 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn, Klaus Pototzky
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PLAYGROUND_FLENS_MPI_DISTRIBUTED_DISTGEMATRIX_H
+#define PLAYGROUND_FLENS_MPI_DISTRIBUTED_DISTGEMATRIX_H 1
+
+#ifdef WITH_MPI
+#    include "mpi.h"
+#endif
+
+#include<flens/matrixtypes/matrixtypes.h>
+#include<flens/storage/storage.h>
+#include<playground/flens/mpi/distributed/processgrid.h>
+#include<playground/flens/mpi/types.h>
+
+namespace flens { namespace mpi {
+
+#ifdef WITH_MPI
+
+//
+//  General matrix distributed 2D block cyclic over a process grid (like in
+//  ScaLAPACK with the first block at process (0,0)).  Global row i belongs to
+//  block row (i-1)/rowBlockSize and block row k is stored on process row
+//  k % grid.numRows().  Columns get distributed accordingly over the process
+//  columns.
+//
+//  Each process stores its blocks in a column major GeMatrix.  Global and
+//  local indices start at 1, local indices increase with global indices.
+//
+template <typename T>
+class DistGeMatrix
+{
+    public:
+        typedef T                                       ElementType;
+        typedef GeMatrix<FullStorage<T, ColMajor> >     LocalMatrix;
+        typedef typename LocalMatrix::IndexType         IndexType;
+        typedef typename LocalMatrix::View              LocalView;
+        typedef typename LocalMatrix::ConstView         LocalConstView;
+
+        DistGeMatrix(const ProcessGrid &grid,
+                     IndexType numRows, IndexType numCols,
+                     IndexType rowBlockSize = 64,
+                     IndexType colBlockSize = 64);
+
+        DistGeMatrix(const DistGeMatrix &rhs);
+
+        DistGeMatrix &
+        operator=(const DistGeMatrix &rhs);
+
+        DistGeMatrix &
+        operator=(const ElementType &value);
+
+        //-- global dimensions and distribution --------------------------------
+
+        const ProcessGrid &
+        grid() const;
+
+        IndexType
+        numRows() const;
+
+        IndexType
+        numCols() const;
+
+        IndexType
+        rowBlockSize() const;
+
+        IndexType
+        colBlockSize() const;
+
+        //  process row/column owning global row i/column j
+        int
+        rowOwner(IndexType i) const;
+
+        int
+        colOwner(IndexType j) const;
+
+        bool
+        isLocal(IndexType i, IndexType j) const;
+
+        //-- local part --------------------------------------------------------
+
+        IndexType
+        numLocalRows() const;
+
+        IndexType
+        numLocalCols() const;
+
+        //  local index of a global row/column owned by this process
+        IndexType
+        localRow(IndexType i) const;
+
+        IndexType
+        localCol(IndexType j) const;
+
+        //  first local row/column with global index >= i/j.  Returns
+        //  numLocalRows()+1/numLocalCols()+1 if there is none.
+        IndexType
+        firstLocalRow(IndexType i) const;
+
+        IndexType
+        firstLocalCol(IndexType j) const;
+
+        IndexType
+        globalRow(IndexType iLocal) const;
+
+        IndexType
+        globalCol(IndexType jLocal) const;
+
+        const LocalConstView
+        local() const;
+
+        LocalView
+        local();
+
+        //-- distribution of a matrix stored on a single process ---------------
+
+        //  scatter A from process root of the grid to all processes
+        template <typename MA>
+            void
+            distribute(const MA &A, int root = 0);
+
+        //  gather the matrix on process root of the grid, A gets resized
+        template <typename MA>
+            void
+            collect(MA &&A, int root = 0) const;
+
+        //-- number of rows/columns stored on process row/column p -------------
+
+        static IndexType
+        numLocal(IndexType n, IndexType blockSize, int p, int numProcs);
+
+    private:
+        static IndexType
+        toLocal_(IndexType i, IndexType blockSize, int numProcs);
+
+        static IndexType
+        toGlobal_(IndexType iLocal, IndexType blockSize, int p, int numProcs);
+
+        static IndexType
+        firstLocal_(IndexType i, IndexType n, IndexType blockSize, int p,
+                    int numProcs);
+
+        const ProcessGrid   *grid_;
+        IndexType           numRows_, numCols_, mb_, nb_;
+        LocalMatrix         local_;
+};
+
+#endif // WITH_MPI
+
+} }
+
+#endif // PLAYGROUND_FLENS_MPI_DISTRIBUTED_DISTGEMATRIX_H
@@ -0,0 +1,392 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn, Klaus Pototzky
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PLAYGROUND_FLENS_MPI_DISTRIBUTED_DISTGEMATRIX_TCC
+#define PLAYGROUND_FLENS_MPI_DISTRIBUTED_DISTGEMATRIX_TCC 1
+
+#include<playground/flens/mpi/mpi-flens.h>
+
+namespace flens { namespace mpi {
+
+#ifdef WITH_MPI
+
+template <typename T>
+DistGeMatrix<T>::DistGeMatrix(const ProcessGrid &grid,
+                              IndexType numRows, IndexType numCols,
+                              IndexType rowBlockSize, IndexType colBlockSize)
+    : grid_(&grid), numRows_(numRows), numCols_(numCols),
+      mb_(rowBlockSize), nb_(colBlockSize),
+      local_(numLocal(numRows, rowBlockSize, grid.row(), grid.numRows()),
+             numLocal(numCols, colBlockSize, grid.col(), grid.numCols()))
+{
+    MPI_ASSERT(mb_>0 && nb_>0);
+}
+
+template <typename T>
+DistGeMatrix<T>::DistGeMatrix(const DistGeMatrix &rhs)
+    : grid_(rhs.grid_), numRows_(rhs.numRows_), numCols_(rhs.numCols_),
+      mb_(rhs.mb_), nb_(rhs.nb_), local_(rhs.local_)
+{
+}
+
+template <typename T>
+DistGeMatrix<T> &
+DistGeMatrix<T>::operator=(const DistGeMatrix &rhs)
+{
+    if (this!=&rhs) {
+        MPI_ASSERT(grid_==rhs.grid_);
+        MPI_ASSERT(numRows_==rhs.numRows_ && numCols_==rhs.numCols_);
+        MPI_ASSERT(mb_==rhs.mb_ && nb_==rhs.nb_);
+
+        local_ = rhs.local_;
+    }
+    return *this;
+}
+
+template <typename T>
+DistGeMatrix<T> &
+DistGeMatrix<T>::operator=(const ElementType &value)
+{
+    if (local_.numRows()>0 && local_.numCols()>0) {
+        local_.fill(value);
+    }
+    return *this;
+}
+
+//-- global dimensions and distribution ----------------------------------------
+
+template <typename T>
+const ProcessGrid &
+DistGeMatrix<T>::grid() const
+{
+    return *grid_;
+}
+
+template <typename T>
+typename DistGeMatrix<T>::IndexType
+DistGeMatrix<T>::numRows() const
+{
+    return numRows_;
+}
+
+template <typename T>
+typename DistGeMatrix<T>::IndexType
+DistGeMatrix<T>::numCols() const
+{
+    return numCols_;
+}
+
+template <typename T>
+typename DistGeMatrix<T>::IndexType
+DistGeMatrix<T>::rowBlockSize() const
+{
+    return mb_;
+}
+
+template <typename T>
+typename DistGeMatrix<T>::IndexType
+DistGeMatrix<T>::colBlockSize() const
+{
+    return nb_;
+}
+
+template <typename T>
+int
+DistGeMatrix<T>::rowOwner(IndexType i) const
+{
+    return ((i-1)/mb_) % grid_->numRows();
+}
+
+template <typename T>
+int
+DistGeMatrix<T>::colOwner(IndexType j) const
+{
+    return ((j-1)/nb_) % grid_->numCols();
+}
+
+template <typename T>
+bool
+DistGeMatrix<T>::isLocal(IndexType i, IndexType j) const
+{
+    return rowOwner(i)==grid_->row() && colOwner(j)==grid_->col();
+}
+
+//-- local part ----------------------------------------------------------------
+
+template <typename T>
+typename DistGeMatrix<T>::IndexType
+DistGeMatrix<T>::numLocalRows() const
+{
+    return local_.numRows();
+}
+
+template <typename T>
+typename DistGeMatrix<T>::IndexType
+DistGeMatrix<T>::numLocalCols() const
+{
+    return local_.numCols();
+}
+
+template <typename T>
+typename DistGeMatrix<T>::IndexType
+DistGeMatrix<T>::localRow(IndexType i) const
+{
+    MPI_ASSERT(rowOwner(i)==grid_->row());
+    return toLocal_(i, mb_, grid_->numRows());
+}
+
+template <typename T>
+typename DistGeMatrix<T>::IndexType
+DistGeMatrix<T>::localCol(IndexType j) const
+{
+    MPI_ASSERT(colOwner(j)==grid_->col());
+    return toLocal_(j, nb_, grid_->numCols());
+}
+
+template <typename T>
+typename DistGeMatrix<T>::IndexType
+DistGeMatrix<T>::firstLocalRow(IndexType i) const
+{
+    return firstLocal_(i, numRows_, mb_, grid_->row(), grid_->numRows());
+}
+
+template <typename T>
+typename DistGeMatrix<T>::IndexType
+DistGeMatrix<T>::firstLocalCol(IndexType j) const
+{
+    return firstLocal_(j, numCols_, nb_, grid_->col(), grid_->numCols());
+}
+
+template <typename T>
+typename DistGeMatrix<T>::IndexType
+DistGeMatrix<T>::globalRow(IndexType iLocal) const
+{
+    return toGlobal_(iLocal, mb_, grid_->row(), grid_->numRows());
+}
+
+template <typename T>
+typename DistGeMatrix<T>::IndexType
+DistGeMatrix<T>::globalCol(IndexType jLocal) const
+{
+    return toGlobal_(jLocal, nb_, grid_->col(), grid_->numCols());
+}
+
+template <typename T>
+const typename DistGeMatrix<T>::LocalConstView
+DistGeMatrix<T>::local() const
+{
+    return local_(local_.rows(), local_.cols());
+}
+
+template <typename T>
+typename DistGeMatrix<T>::LocalView
+DistGeMatrix<T>::local()
+{
+    return local_(local_.rows(), local_.cols());
+}
+
+//-- distribution of a matrix stored on a single process -----------------------
+
+template <typename T>
+template <typename MA>
+void
+DistGeMatrix<T>::distribute(const MA &A, int root)
+{
+    typedef typename MPI_Type<T>::PrimitiveType  PT;
+
+    const MPI::Intracomm &comm = grid_->comm();
+    const int            size  = MPI_Type<T>::size;
+
+    if (comm.Get_rank()!=root) {
+        if (local_.numRows()>0 && local_.numCols()>0) {
+            comm.Recv(reinterpret_cast<PT *>(local_.data()),
+                      local_.numRows()*local_.numCols()*size,
+                      MPI_Type<T>::Type(), root, 0);
+        }
+        return;
+    }
+
+    MPI_ASSERT(A.numRows()==numRows_ && A.numCols()==numCols_);
+
+    const IndexType i0 = A.firstRow()-1;
+    const IndexType j0 = A.firstCol()-1;
+
+    for (int p=0; p<grid_->numRows(); ++p) {
+        for (int q=0; q<grid_->numCols(); ++q) {
+            const IndexType m = numLocal(numRows_, mb_, p, grid_->numRows());
+            const IndexType n = numLocal(numCols_, nb_, q, grid_->numCols());
+
+            if (m==0 || n==0) {
+                continue;
+            }
+
+            LocalMatrix  buffer(m, n);
+            for (IndexType j=1; j<=n; ++j) {
+                const IndexType jA = toGlobal_(j, nb_, q, grid_->numCols());
+                for (IndexType i=1; i<=m; ++i) {
+                    const IndexType iA = toGlobal_(i, mb_, p,
+                                                 grid_->numRows());
+                    buffer(i,j) = A(i0+iA, j0+jA);
+                }
+            }
+            if (grid_->rank(p, q)==root) {
+                local_ = buffer;
+            } else {
+                comm.Send(reinterpret_cast<const PT *>(buffer.data()),
+                          m*n*size, MPI_Type<T>::Type(), grid_->rank(p, q), 0);
+            }
+        }
+    }
+}
+
+template <typename T>
+template <typename MA>
+void
+DistGeMatrix<T>::collect(MA &&A, int root) const
+{
+    typedef typename MPI_Type<T>::PrimitiveType  PT;
+
+    const MPI::Intracomm &comm = grid_->comm();
+    const int            size  = MPI_Type<T>::size;
+
+    if (comm.Get_rank()!=root) {
+        if (local_.numRows()>0 && local_.numCols()>0) {
+            comm.Send(reinterpret_cast<const PT *>(local_.data()),
+                      local_.numRows()*local_.numCols()*size,
+                      MPI_Type<T>::Type(), root, 0);
+        }
+        return;
+    }
+
+    if (A.numRows()!=numRows_ || A.numCols()!=numCols_) {
+        A.resize(numRows_, numCols_);
+    }
+
+    const IndexType i0 = A.firstRow()-1;
+    const IndexType j0 = A.firstCol()-1;
+
+    for (int p=0; p<grid_->numRows(); ++p) {
+        for (int q=0; q<grid_->numCols(); ++q) {
+            const IndexType m = numLocal(numRows_, mb_, p, grid_->numRows());
+            const IndexType n = numLocal(numCols_, nb_, q, grid_->numCols());
+
+            if (m==0 || n==0) {
+                continue;
+            }
+
+            LocalMatrix  buffer(m, n);
+            if (grid_->rank(p, q)==root) {
+                buffer = local_;
+            } else {
+                comm.Recv(reinterpret_cast<PT *>(buffer.data()),
+                          m*n*size, MPI_Type<T>::Type(), grid_->rank(p, q), 0);
+            }
+            for (IndexType j=1; j<=n; ++j) {
+                const IndexType jA = toGlobal_(j, nb_, q, grid_->numCols());
+                for (IndexType i=1; i<=m; ++i) {
+                    const IndexType iA = toGlobal_(i, mb_, p,
+                                                 grid_->numRows());
+                    A(i0+iA, j0+jA) = buffer(i,j);
+                }
+            }
+        }
+    }
+}
+
+//-- index computations --------------------------------------------------------
+
+template <typename T>
+typename DistGeMatrix<T>::IndexType
+DistGeMatrix<T>::numLocal(IndexType n, IndexType blockSize, int p,
+                          int numProcs)
+{
+    const IndexType numBlocks = n / blockSize;
+
+    IndexType num = (numBlocks / numProcs) * blockSize;
+    const int rest = numBlocks % numProcs;
+
+    if (p<rest) {
+        num += blockSize;
+    } else if (p==rest) {
+        num += n % blockSize;
+    }
+    return num;
+}
+
+template <typename T>
+typename DistGeMatrix<T>::IndexType
+DistGeMatrix<T>::toLocal_(IndexType i, IndexType blockSize, int numProcs)
+{
+    const IndexType block = (i-1) / blockSize;
+
+    return (block / numProcs)*blockSize + (i-1) % blockSize + 1;
+}
+
+template <typename T>
+typename DistGeMatrix<T>::IndexType
+DistGeMatrix<T>::toGlobal_(IndexType iLocal, IndexType blockSize, int p,
+                         int numProcs)
+{
+    const IndexType block = (iLocal-1) / blockSize;
+
+    return (block*numProcs + p)*blockSize + (iLocal-1) % blockSize + 1;
+}
+
+template <typename T>
+typename DistGeMatrix<T>::IndexType
+DistGeMatrix<T>::firstLocal_(IndexType i, IndexType n, IndexType blockSize,
+                             int p, int numProcs)
+{
+    const IndexType numLocalIndices = numLocal(n, blockSize, p, numProcs);
+
+    if (i>n) {
+        return numLocalIndices+1;
+    }
+
+    const IndexType block = (i-1) / blockSize;
+    const int       owner = block % numProcs;
+
+    if (owner==p) {
+        return toLocal_(i, blockSize, numProcs);
+    }
+
+    const IndexType next = block + (p-owner+numProcs) % numProcs;
+    const IndexType iLocal = (next / numProcs)*blockSize + 1;
+
+    return (iLocal<=numLocalIndices) ? iLocal : numLocalIndices+1;
+}
+
+#endif // WITH_MPI
+
+} }
+
+#endif // PLAYGROUND_FLENS_MPI_DISTRIBUTED_DISTGEMATRIX_TCC
@@ -0,0 +1,139 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn, Klaus Pototzky
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PLAYGROUND_FLENS_MPI_DISTRIBUTED_HALOEXCHANGE_H
+#define PLAYGROUND_FLENS_MPI_DISTRIBUTED_HALOEXCHANGE_H 1
+
+#ifdef WITH_MPI
+#    include "mpi.h"
+#endif
+
+#include<cxxstd/vector.h>
+#include<flens/storage/storage.h>
+#include<flens/vectortypes/vectortypes.h>
+
+namespace flens { namespace mpi {
+
+#ifdef WITH_MPI
+
+//
+//  Communication plan for vectors whose global indices are partitioned in
+//  contiguous ranges: process q owns the indices offsets[q]+1, ...,
+//  offsets[q+1].  Each process needs copies ("ghosts") of some indices
+//  owned by other processes, e.g. the off-process columns of its rows of a
+//  sparse matrix.
+//
+//  init() is collective: processes exchange which of their indices are
+//  ghosts elsewhere and set up persistent send and receive requests for
+//  both directions.  Afterwards
+//
+//    - begin(x) / end() copy the owned values of x into the ghost buffer of
+//      the other processes,
+//    - beginReverse() / endReverse(y) send the ghost buffer back and add it
+//      to the owned values of y (as needed for transposed products).
+//
+//  Computations can be done between begin and end.  Requests get freed by
+//  the destructor which therefore must be called before MPI gets finalized.
+//
+template <typename T>
+class HaloExchange
+{
+    public:
+        typedef T                                   ElementType;
+        typedef typename Array<T>::IndexType        IndexType;
+        typedef DenseVector<Array<T> >              Buffer;
+        typedef DenseVector<Array<IndexType> >      IndexVector;
+
+        HaloExchange();
+
+        ~HaloExchange();
+
+        void
+        init(const MPI::Intracomm &communicator,
+             const std::vector<IndexType> &offsets,
+             const std::vector<IndexType> &ghosts);
+
+        //-- forward exchange --------------------------------------------------
+
+        template <typename VX>
+            void
+            begin(const VX &x);
+
+        void
+        end();
+
+        //-- reverse exchange --------------------------------------------------
+
+        void
+        beginReverse();
+
+        template <typename VY>
+            void
+            endReverse(VY &&y);
+
+        //-- methods -----------------------------------------------------------
+
+        IndexType
+        numGhosts() const;
+
+        IndexType
+        numSendValues() const;
+
+        int
+        numNeighbors() const;
+
+        const Buffer &
+        ghosts() const;
+
+        Buffer &
+        ghosts();
+
+    private:
+        HaloExchange(const HaloExchange &rhs);
+
+        HaloExchange &
+        operator=(const HaloExchange &rhs);
+
+        void
+        free_();
+
+        int                           numNeighbors_;
+        IndexVector                   sendIndices_;
+        Buffer                        sendBuffer_, ghosts_;
+        std::vector<MPI::Prequest>    forward_, reverse_;
+};
+
+#endif // WITH_MPI
+
+} }
+
+#endif // PLAYGROUND_FLENS_MPI_DISTRIBUTED_HALOEXCHANGE_H
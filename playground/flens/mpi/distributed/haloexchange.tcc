@@ -0,0 +1,259 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn, Klaus Pototzky
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PLAYGROUND_FLENS_MPI_DISTRIBUTED_HALOEXCHANGE_TCC
+#define PLAYGROUND_FLENS_MPI_DISTRIBUTED_HALOEXCHANGE_TCC 1
+
+#include<cxxstd/algorithm.h>
+#include<playground/flens/mpi/mpi-flens.h>
+
+namespace flens { namespace mpi {
+
+#ifdef WITH_MPI
+
+template <typename T>
+HaloExchange<T>::HaloExchange()
+    : numNeighbors_(0)
+{
+}
+
+template <typename T>
+HaloExchange<T>::~HaloExchange()
+{
+    free_();
+}
+
+template <typename T>
+void
+HaloExchange<T>::init(const MPI::Intracomm &communicator,
+                      const std::vector<IndexType> &offsets,
+                      const std::vector<IndexType> &ghosts)
+{
+    typedef typename MPI_Type<T>::PrimitiveType          PT;
+    typedef typename MPI_Type<IndexType>::PrimitiveType  PI;
+
+    const int numProcs = communicator.Get_size();
+    const int rank     = communicator.Get_rank();
+    const int size     = MPI_Type<T>::size;
+
+    MPI_ASSERT(int(offsets.size())==numProcs+1);
+
+    free_();
+
+//
+//  Ghosts are sorted, so the ghosts owned by process q are contiguous
+//
+    std::vector<int>  recvCounts(numProcs, 0), recvDispls(numProcs, 0);
+    std::vector<int>  sendCounts(numProcs, 0), sendDispls(numProcs, 0);
+
+    for (size_t k=0; k<ghosts.size(); ++k) {
+        MPI_ASSERT(k==0 || ghosts[k-1]<ghosts[k]);
+
+        const int q = std::lower_bound(offsets.begin(), offsets.end(),
+                                       ghosts[k]) - offsets.begin() - 1;
+        MPI_ASSERT(q!=rank);
+        ++recvCounts[q];
+    }
+    communicator.Alltoall(recvCounts.data(), 1, MPI::INT,
+                          sendCounts.data(), 1, MPI::INT);
+
+    for (int q=1; q<numProcs; ++q) {
+        recvDispls[q] = recvDispls[q-1] + recvCounts[q-1];
+        sendDispls[q] = sendDispls[q-1] + sendCounts[q-1];
+    }
+    const int numSend = sendDispls[numProcs-1] + sendCounts[numProcs-1];
+
+//
+//  Tell the owners which of their indices are needed
+//
+    std::vector<IndexType>  requested(numSend);
+
+    communicator.Alltoallv(reinterpret_cast<const PI *>(ghosts.data()),
+                           recvCounts.data(), recvDispls.data(),
+                           MPI_Type<IndexType>::Type(),
+                           reinterpret_cast<PI *>(requested.data()),
+                           sendCounts.data(), sendDispls.data(),
+                           MPI_Type<IndexType>::Type());
+
+    sendIndices_.resize(numSend);
+    for (int k=0; k<numSend; ++k) {
+        MPI_ASSERT(requested[k]>offsets[rank] && requested[k]<=offsets[rank+1]);
+        sendIndices_(k+1) = requested[k] - offsets[rank];
+    }
+    sendBuffer_.resize(numSend);
+    ghosts_.resize(IndexType(ghosts.size()));
+
+//
+//  Persistent requests for both directions
+//
+    const int forwardTag = 0;
+    const int reverseTag = 1;
+
+    numNeighbors_ = 0;
+    for (int q=0; q<numProcs; ++q) {
+        if (recvCounts[q]==0 && sendCounts[q]==0) {
+            continue;
+        }
+        ++numNeighbors_;
+        if (recvCounts[q]>0) {
+            PT *g = reinterpret_cast<PT *>(ghosts_.data()+recvDispls[q]);
+
+            forward_.push_back(communicator.Recv_init(g, recvCounts[q]*size,
+                                                      MPI_Type<T>::Type(),
+                                                      q, forwardTag));
+            reverse_.push_back(communicator.Send_init(g, recvCounts[q]*size,
+                                                      MPI_Type<T>::Type(),
+                                                      q, reverseTag));
+        }
+        if (sendCounts[q]>0) {
+            PT *s = reinterpret_cast<PT *>(sendBuffer_.data()+sendDispls[q]);
+
+            forward_.push_back(communicator.Send_init(s, sendCounts[q]*size,
+                                                      MPI_Type<T>::Type(),
+                                                      q, forwardTag));
+            reverse_.push_back(communicator.Recv_init(s, sendCounts[q]*size,
+                                                      MPI_Type<T>::Type(),
+                                                      q, reverseTag));
+        }
+    }
+}
+
+//-- forward exchange ----------------------------------------------------------
+
+template <typename T>
+template <typename VX>
+void
+HaloExchange<T>::begin(const VX &x)
+{
+    const IndexType i0 = x.firstIndex()-1;
+
+    for (IndexType k=1; k<=sendIndices_.length(); ++k) {
+        sendBuffer_(k) = x(i0+sendIndices_(k));
+    }
+    if (forward_.size()>0) {
+        MPI::Prequest::Startall(forward_.size(), forward_.data());
+    }
+}
+
+template <typename T>
+void
+HaloExchange<T>::end()
+{
+    for (size_t k=0; k<forward_.size(); ++k) {
+        forward_[k].Wait();
+    }
+}
+
+//-- reverse exchange ----------------------------------------------------------
+
+template <typename T>
+void
+HaloExchange<T>::beginReverse()
+{
+    if (reverse_.size()>0) {
+        MPI::Prequest::Startall(reverse_.size(), reverse_.data());
+    }
+}
+
+template <typename T>
+template <typename VY>
+void
+HaloExchange<T>::endReverse(VY &&y)
+{
+    for (size_t k=0; k<reverse_.size(); ++k) {
+        reverse_[k].Wait();
+    }
+
+    const IndexType i0 = y.firstIndex()-1;
+
+    for (IndexType k=1; k<=sendIndices_.length(); ++k) {
+        y(i0+sendIndices_(k)) += sendBuffer_(k);
+    }
+}
+
+//-- methods -------------------------------------------------------------------
+
+template <typename T>
+typename HaloExchange<T>::IndexType
+HaloExchange<T>::numGhosts() const
+{
+    return ghosts_.length();
+}
+
+template <typename T>
+typename HaloExchange<T>::IndexType
+HaloExchange<T>::numSendValues() const
+{
+    return sendIndices_.length();
+}
+
+template <typename T>
+int
+HaloExchange<T>::numNeighbors() const
+{
+    return numNeighbors_;
+}
+
+template <typename T>
+const typename HaloExchange<T>::Buffer &
+HaloExchange<T>::ghosts() const
+{
+    return ghosts_;
+}
+
+template <typename T>
+typename HaloExchange<T>::Buffer &
+HaloExchange<T>::ghosts()
+{
+    return ghosts_;
+}
+
+template <typename T>
+void
+HaloExchange<T>::free_()
+{
+    for (size_t k=0; k<forward_.size(); ++k) {
+        forward_[k].Free();
+    }
+    for (size_t k=0; k<reverse_.size(); ++k) {
+        reverse_[k].Free();
+    }
+    forward_.clear();
+    reverse_.clear();
+    numNeighbors_ = 0;
+}
+
+#endif // WITH_MPI
+
+} }
+
+#endif // PLAYGROUND_FLENS_MPI_DISTRIBUTED_HALOEXCHANGE_TCC
@@ -0,0 +1,86 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn, Klaus Pototzky
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PLAYGROUND_FLENS_MPI_DISTRIBUTED_MM_TCC
+#define PLAYGROUND_FLENS_MPI_DISTRIBUTED_MM_TCC 1
+
+#include<playground/flens/mpi/mpi-flens.h>
+
+namespace flens { namespace mpi {
+
+#ifdef WITH_MPI
+
+template <typename ALPHA, typename T, typename BETA>
+void
+mm(const ALPHA &alpha, const DistGeMatrix<T> &A, const DistGeMatrix<T> &B,
+   const BETA &beta, DistGeMatrix<T> &C)
+{
+    typedef typename DistGeMatrix<T>::IndexType     IndexType;
+    typedef typename DistGeMatrix<T>::LocalMatrix   LocalMatrix;
+
+    MPI_ASSERT(&A.grid()==&C.grid() && &B.grid()==&C.grid());
+    MPI_ASSERT(A.numRows()==C.numRows() && B.numCols()==C.numCols());
+    MPI_ASSERT(A.numCols()==B.numRows());
+    MPI_ASSERT(A.rowBlockSize()==C.rowBlockSize());
+    MPI_ASSERT(B.colBlockSize()==C.colBlockSize());
+    MPI_ASSERT(A.colBlockSize()==B.rowBlockSize());
+
+    auto localC = C.local();
+
+    if (beta==BETA(0)) {
+        C = T(0);
+    } else if (beta!=BETA(1) && localC.numRows()>0 && localC.numCols()>0) {
+        localC *= T(beta);
+    }
+
+    const IndexType k  = A.numCols();
+    const IndexType kb = A.colBlockSize();
+
+    LocalMatrix  AP, BP;
+
+    for (IndexType l=1; l<=k; l+=kb) {
+        const IndexType l2 = std::min(l+kb-1, k);
+
+        bcastColPanel(A, 1, A.numRows(), l, l2, AP);
+        bcastRowPanel(B, l, l2, 1, B.numCols(), BP);
+
+        if (localC.numRows()>0 && localC.numCols()>0) {
+            blas::mm(NoTrans, NoTrans, T(alpha), AP, BP, T(1), localC);
+        }
+    }
+}
+
+#endif // WITH_MPI
+
+} }
+
+#endif // PLAYGROUND_FLENS_MPI_DISTRIBUTED_MM_TCC
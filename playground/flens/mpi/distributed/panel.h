@@ -0,0 +1,134 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn, Klaus Pototzky
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PLAYGROUND_FLENS_MPI_DISTRIBUTED_PANEL_H
+#define PLAYGROUND_FLENS_MPI_DISTRIBUTED_PANEL_H 1
+
+#ifdef WITH_MPI
+#    include "mpi.h"
+#endif
+
+#include<playground/flens/mpi/distributed/distgematrix.h>
+
+namespace flens { namespace mpi {
+
+#ifdef WITH_MPI
+
+//
+//  Communication of panels used by the distributed BLAS and LAPACK
+//  functions.  Panels are column major GeMatrix buffers that get resized
+//  if necessary.  Global row and column ranges are given as first and last
+//  index.
+//
+
+//-- buffers -------------------------------------------------------------------
+
+template <typename T>
+    void
+    distBcast(T *x, int n, int root, const MPI::Intracomm &communicator);
+
+template <typename T>
+    void
+    distAllreduceSum(T *x, int n, const MPI::Intracomm &communicator);
+
+//-- panels --------------------------------------------------------------------
+
+//
+//  Local rows of A with global index in [i1, i2] of the columns [j1, j2].
+//  The columns must be within one column block.  The owning process column
+//  broadcasts the panel within each process row.
+//
+template <typename T, typename MP>
+    void
+    bcastColPanel(const DistGeMatrix<T> &A,
+                  typename DistGeMatrix<T>::IndexType i1,
+                  typename DistGeMatrix<T>::IndexType i2,
+                  typename DistGeMatrix<T>::IndexType j1,
+                  typename DistGeMatrix<T>::IndexType j2,
+                  MP &panel);
+
+//
+//  Rows [i1, i2] of the local columns of A with global index in [j1, j2].
+//  The rows must be within one row block.  The owning process row broadcasts
+//  the panel within each process column.
+//
+template <typename T, typename MP>
+    void
+    bcastRowPanel(const DistGeMatrix<T> &A,
+                  typename DistGeMatrix<T>::IndexType i1,
+                  typename DistGeMatrix<T>::IndexType i2,
+                  typename DistGeMatrix<T>::IndexType j1,
+                  typename DistGeMatrix<T>::IndexType j2,
+                  MP &panel);
+
+//
+//  Block A(i1:i2, j1:j2) on all processes where the columns are within one
+//  column block (replicateColPanel) or the rows are within one row block
+//  (replicateRowPanel).  Needed if a panel has to be combined with the
+//  distribution of the other dimension, e.g. for op(A)=A^T.
+//
+template <typename T, typename MP>
+    void
+    replicateColPanel(const DistGeMatrix<T> &A,
+                      typename DistGeMatrix<T>::IndexType i1,
+                      typename DistGeMatrix<T>::IndexType i2,
+                      typename DistGeMatrix<T>::IndexType j1,
+                      typename DistGeMatrix<T>::IndexType j2,
+                      MP &panel);
+
+template <typename T, typename MP>
+    void
+    replicateRowPanel(const DistGeMatrix<T> &A,
+                      typename DistGeMatrix<T>::IndexType i1,
+                      typename DistGeMatrix<T>::IndexType i2,
+                      typename DistGeMatrix<T>::IndexType j1,
+                      typename DistGeMatrix<T>::IndexType j2,
+                      MP &panel);
+
+//-- row interchanges ----------------------------------------------------------
+
+//
+//  Interchange the global rows i1 and i2 of A in the columns [j1, j2].
+//
+template <typename T>
+    void
+    swapRows(DistGeMatrix<T> &A,
+             typename DistGeMatrix<T>::IndexType i1,
+             typename DistGeMatrix<T>::IndexType i2,
+             typename DistGeMatrix<T>::IndexType j1,
+             typename DistGeMatrix<T>::IndexType j2);
+
+#endif // WITH_MPI
+
+} }
+
+#endif // PLAYGROUND_FLENS_MPI_DISTRIBUTED_PANEL_H
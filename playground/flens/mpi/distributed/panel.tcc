@@ -0,0 +1,292 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn, Klaus Pototzky
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PLAYGROUND_FLENS_MPI_DISTRIBUTED_PANEL_TCC
+#define PLAYGROUND_FLENS_MPI_DISTRIBUTED_PANEL_TCC 1
+
+#include<playground/flens/mpi/mpi-flens.h>
+
+namespace flens { namespace mpi {
+
+#ifdef WITH_MPI
+
+//-- buffers -------------------------------------------------------------------
+
+template <typename T>
+void
+distBcast(T *x, int n, int root, const MPI::Intracomm &communicator)
+{
+    typedef typename MPI_Type<T>::PrimitiveType  PT;
+
+    if (n>0) {
+        communicator.Bcast(reinterpret_cast<PT *>(x), n*MPI_Type<T>::size,
+                           MPI_Type<T>::Type(), root);
+    }
+}
+
+template <typename T>
+void
+distAllreduceSum(T *x, int n, const MPI::Intracomm &communicator)
+{
+    typedef typename MPI_Type<T>::PrimitiveType  PT;
+
+    if (n>0) {
+        communicator.Allreduce(MPI::IN_PLACE, reinterpret_cast<PT *>(x),
+                               n*MPI_Type<T>::size, MPI_Type<T>::Type(),
+                               MPI::SUM);
+    }
+}
+
+//-- panels --------------------------------------------------------------------
+
+template <typename T, typename MP>
+void
+bcastColPanel(const DistGeMatrix<T> &A,
+              typename DistGeMatrix<T>::IndexType i1,
+              typename DistGeMatrix<T>::IndexType i2,
+              typename DistGeMatrix<T>::IndexType j1,
+              typename DistGeMatrix<T>::IndexType j2,
+              MP &panel)
+{
+    typedef typename DistGeMatrix<T>::IndexType  IndexType;
+
+    const Underscore<IndexType> _;
+    const ProcessGrid &grid = A.grid();
+
+    MPI_ASSERT(A.colOwner(j1)==A.colOwner(j2));
+
+    const IndexType r1 = A.firstLocalRow(i1);
+    const IndexType r2 = A.firstLocalRow(i2+1)-1;
+    const IndexType m  = (r2>=r1) ? r2-r1+1 : 0;
+    const IndexType n  = j2-j1+1;
+
+    if (panel.numRows()!=m || panel.numCols()!=n) {
+        panel.resize(m, n);
+    }
+    if (m==0 || n==0) {
+        return;
+    }
+
+    const int root = A.colOwner(j1);
+
+    if (grid.col()==root) {
+        const IndexType c1 = A.localCol(j1);
+
+        panel = A.local()(_(r1,r2),_(c1,c1+n-1));
+    }
+    distBcast(panel.data(), m*n, root, grid.rowComm());
+}
+
+template <typename T, typename MP>
+void
+bcastRowPanel(const DistGeMatrix<T> &A,
+              typename DistGeMatrix<T>::IndexType i1,
+              typename DistGeMatrix<T>::IndexType i2,
+              typename DistGeMatrix<T>::IndexType j1,
+              typename DistGeMatrix<T>::IndexType j2,
+              MP &panel)
+{
+    typedef typename DistGeMatrix<T>::IndexType  IndexType;
+
+    const Underscore<IndexType> _;
+    const ProcessGrid &grid = A.grid();
+
+    MPI_ASSERT(A.rowOwner(i1)==A.rowOwner(i2));
+
+    const IndexType c1 = A.firstLocalCol(j1);
+    const IndexType c2 = A.firstLocalCol(j2+1)-1;
+    const IndexType m  = i2-i1+1;
+    const IndexType n  = (c2>=c1) ? c2-c1+1 : 0;
+
+    if (panel.numRows()!=m || panel.numCols()!=n) {
+        panel.resize(m, n);
+    }
+    if (m==0 || n==0) {
+        return;
+    }
+
+    const int root = A.rowOwner(i1);
+
+    if (grid.row()==root) {
+        const IndexType r1 = A.localRow(i1);
+
+        panel = A.local()(_(r1,r1+m-1),_(c1,c2));
+    }
+    distBcast(panel.data(), m*n, root, grid.colComm());
+}
+
+template <typename T, typename MP>
+void
+replicateColPanel(const DistGeMatrix<T> &A,
+                  typename DistGeMatrix<T>::IndexType i1,
+                  typename DistGeMatrix<T>::IndexType i2,
+                  typename DistGeMatrix<T>::IndexType j1,
+                  typename DistGeMatrix<T>::IndexType j2,
+                  MP &panel)
+{
+    typedef typename DistGeMatrix<T>::IndexType  IndexType;
+
+    const Underscore<IndexType> _;
+    const ProcessGrid &grid = A.grid();
+
+    MPI_ASSERT(A.colOwner(j1)==A.colOwner(j2));
+
+    const IndexType m = (i2>=i1) ? i2-i1+1 : 0;
+    const IndexType n = j2-j1+1;
+
+    if (panel.numRows()!=m || panel.numCols()!=n) {
+        panel.resize(m, n);
+    }
+    if (m==0 || n==0) {
+        return;
+    }
+
+    const int root = A.colOwner(j1);
+
+    if (grid.col()==root) {
+        const IndexType c1 = A.localCol(j1);
+        const IndexType r1 = A.firstLocalRow(i1);
+        const IndexType r2 = A.firstLocalRow(i2+1)-1;
+
+        panel = T(0);
+        for (IndexType r=r1; r<=r2; ++r) {
+            panel(A.globalRow(r)-i1+1,_) = A.local()(r,_(c1,c1+n-1));
+        }
+        distAllreduceSum(panel.data(), m*n, grid.colComm());
+    }
+    distBcast(panel.data(), m*n, root, grid.rowComm());
+}
+
+template <typename T, typename MP>
+void
+replicateRowPanel(const DistGeMatrix<T> &A,
+                  typename DistGeMatrix<T>::IndexType i1,
+                  typename DistGeMatrix<T>::IndexType i2,
+                  typename DistGeMatrix<T>::IndexType j1,
+                  typename DistGeMatrix<T>::IndexType j2,
+                  MP &panel)
+{
+    typedef typename DistGeMatrix<T>::IndexType  IndexType;
+
+    const Underscore<IndexType> _;
+    const ProcessGrid &grid = A.grid();
+
+    MPI_ASSERT(A.rowOwner(i1)==A.rowOwner(i2));
+
+    const IndexType m = i2-i1+1;
+    const IndexType n = (j2>=j1) ? j2-j1+1 : 0;
+
+    if (panel.numRows()!=m || panel.numCols()!=n) {
+        panel.resize(m, n);
+    }
+    if (m==0 || n==0) {
+        return;
+    }
+
+    const int root = A.rowOwner(i1);
+
+    if (grid.row()==root) {
+        const IndexType r1 = A.localRow(i1);
+        const IndexType c1 = A.firstLocalCol(j1);
+        const IndexType c2 = A.firstLocalCol(j2+1)-1;
+
+        panel = T(0);
+        for (IndexType c=c1; c<=c2; ++c) {
+            panel(_,A.globalCol(c)-j1+1) = A.local()(_(r1,r1+m-1),c);
+        }
+        distAllreduceSum(panel.data(), m*n, grid.rowComm());
+    }
+    distBcast(panel.data(), m*n, root, grid.colComm());
+}
+
+//-- row interchanges ----------------------------------------------------------
+
+template <typename T>
+void
+swapRows(DistGeMatrix<T> &A,
+         typename DistGeMatrix<T>::IndexType i1,
+         typename DistGeMatrix<T>::IndexType i2,
+         typename DistGeMatrix<T>::IndexType j1,
+         typename DistGeMatrix<T>::IndexType j2)
+{
+    typedef typename DistGeMatrix<T>::IndexType  IndexType;
+    typedef typename MPI_Type<T>::PrimitiveType  PT;
+
+    const ProcessGrid &grid = A.grid();
+
+    const IndexType c1 = A.firstLocalCol(j1);
+    const IndexType c2 = A.firstLocalCol(j2+1)-1;
+
+    if (i1==i2 || c2<c1) {
+        return;
+    }
+
+    const int p1 = A.rowOwner(i1);
+    const int p2 = A.rowOwner(i2);
+    const int me = grid.row();
+
+    auto local = A.local();
+
+    if (p1==me && p2==me) {
+        const IndexType r1 = A.localRow(i1);
+        const IndexType r2 = A.localRow(i2);
+
+        for (IndexType c=c1; c<=c2; ++c) {
+            std::swap(local(r1,c), local(r2,c));
+        }
+    } else if (p1==me || p2==me) {
+        const IndexType r     = A.localRow(p1==me ? i1 : i2);
+        const int       other = (p1==me) ? p2 : p1;
+        const IndexType n     = c2-c1+1;
+
+        DenseVector<Array<T> >  send(n), recv(n);
+
+        for (IndexType c=c1; c<=c2; ++c) {
+            send(c-c1+1) = local(r,c);
+        }
+        grid.colComm().Sendrecv(reinterpret_cast<const PT *>(send.data()),
+                                n*MPI_Type<T>::size, MPI_Type<T>::Type(),
+                                other, 0,
+                                reinterpret_cast<PT *>(recv.data()),
+                                n*MPI_Type<T>::size, MPI_Type<T>::Type(),
+                                other, 0);
+        for (IndexType c=c1; c<=c2; ++c) {
+            local(r,c) = recv(c-c1+1);
+        }
+    }
+}
+
+#endif // WITH_MPI
+
+} }
+
+#endif // PLAYGROUND_FLENS_MPI_DISTRIBUTED_PANEL_TCC
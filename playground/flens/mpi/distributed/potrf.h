@@ -0,0 +1,73 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn, Klaus Pototzky
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PLAYGROUND_FLENS_MPI_DISTRIBUTED_POTRF_H
+#define PLAYGROUND_FLENS_MPI_DISTRIBUTED_POTRF_H 1
+
+#include<flens/auxiliary/auxiliary.h>
+#include<playground/flens/mpi/distributed/distgematrix.h>
+
+namespace flens { namespace mpi {
+
+#ifdef WITH_MPI
+
+//
+//  Cholesky factorization A = L*L^H (upLo==Lower) or A = U^H*U (upLo==Upper)
+//  of a symmetric or hermitian positive definite matrix.  Only the triangle
+//  given by upLo gets referenced and overwritten.
+//
+//  Right looking blocked algorithm: the owner of the diagonal block
+//  factorizes it, the block column (row) gets solved by the owning process
+//  column (row), gets replicated and each process updates its part of the
+//  trailing triangle.  A must be square with the same row and column block
+//  size.
+//
+//  Returns 0 on success or, like lapack::potrf, the global index i for
+//  which the leading minor of order i is not positive definite.  All
+//  processes return the same value.
+//
+template <typename T>
+    typename DistGeMatrix<T>::IndexType
+    potrf(StorageUpLo upLo, DistGeMatrix<T> &A);
+
+//
+//  Solves A*X = B with the Cholesky factorization computed by potrf.
+//
+template <typename T>
+    void
+    potrs(StorageUpLo upLo, const DistGeMatrix<T> &A, DistGeMatrix<T> &B);
+
+#endif // WITH_MPI
+
+} }
+
+#endif // PLAYGROUND_FLENS_MPI_DISTRIBUTED_POTRF_H
@@ -0,0 +1,255 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn, Klaus Pototzky
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PLAYGROUND_FLENS_MPI_DISTRIBUTED_POTRF_TCC
+#define PLAYGROUND_FLENS_MPI_DISTRIBUTED_POTRF_TCC 1
+
+#include<playground/flens/mpi/mpi-flens.h>
+
+namespace flens { namespace mpi {
+
+#ifdef WITH_MPI
+
+//
+//  Local Cholesky factorization of the diagonal block.  lapack::potrf takes
+//  a hermitian matrix in the complex and a symmetric one in the real case.
+//
+template <typename MA>
+typename RestrictTo<!IsRealGeMatrix<MA>::value,
+                    typename RemoveRef<MA>::Type::IndexType>::Type
+potrfDiagBlock(StorageUpLo upLo, MA &&A)
+{
+    if (upLo==Lower) {
+        return lapack::potrf(A.lower().hermitian());
+    }
+    return lapack::potrf(A.upper().hermitian());
+}
+
+template <typename MA>
+typename RestrictTo<IsRealGeMatrix<MA>::value,
+                    typename RemoveRef<MA>::Type::IndexType>::Type
+potrfDiagBlock(StorageUpLo upLo, MA &&A)
+{
+    if (upLo==Lower) {
+        return lapack::potrf(A.lower().symmetric());
+    }
+    return lapack::potrf(A.upper().symmetric());
+}
+
+template <typename T>
+typename DistGeMatrix<T>::IndexType
+potrf(StorageUpLo upLo, DistGeMatrix<T> &A)
+{
+    typedef typename DistGeMatrix<T>::IndexType     IndexType;
+    typedef typename DistGeMatrix<T>::LocalMatrix   LocalMatrix;
+
+    const Underscore<IndexType> _;
+    const ProcessGrid &grid = A.grid();
+
+    MPI_ASSERT(A.numRows()==A.numCols());
+    MPI_ASSERT(A.rowBlockSize()==A.colBlockSize());
+
+    const IndexType n  = A.numRows();
+    const IndexType nb = A.rowBlockSize();
+    const IndexType mLocal = A.numLocalRows();
+    const IndexType nLocal = A.numLocalCols();
+
+    auto localA = A.local();
+
+    LocalMatrix  D, P, PR, PC, W;
+
+    for (IndexType k1=1; k1<=n; k1+=nb) {
+        const IndexType k2 = std::min(k1+nb-1, n);
+        const IndexType w  = k2-k1+1;
+        const int       pk = A.rowOwner(k1);
+        const int       qk = A.colOwner(k1);
+//
+//      Factorize the diagonal block
+//
+        IndexType info = 0;
+
+        if (grid.row()==pk && grid.col()==qk) {
+            const IndexType r = A.localRow(k1);
+            const IndexType c = A.localCol(k1);
+
+            info = potrfDiagBlock(upLo, localA(_(r,r+w-1),_(c,c+w-1)));
+        }
+        distBcast(&info, 1, grid.rank(pk, qk), grid.comm());
+        if (info>0) {
+            return k1-1+info;
+        }
+        if (k2==n) {
+            break;
+        }
+//
+//      Solve for the block column L21 = A21*L11^(-H) on process column qk
+//      or for the block row U12 = U11^(-H)*A12 on process row pk and
+//      replicate it.
+//
+        if (D.numRows()!=w) {
+            D.resize(w, w);
+        }
+        if (upLo==Lower) {
+            if (grid.col()==qk) {
+                const IndexType c  = A.localCol(k1);
+                const IndexType r1 = A.firstLocalRow(k2+1);
+
+                if (grid.row()==pk) {
+                    const IndexType r = A.localRow(k1);
+                    D = localA(_(r,r+w-1),_(c,c+w-1));
+                }
+                distBcast(D.data(), w*w, pk, grid.colComm());
+                if (r1<=mLocal) {
+                    blas::sm(Right, ConjTrans, T(1), D.lower(),
+                             localA(_(r1,mLocal),_(c,c+w-1)));
+                }
+            }
+            replicateColPanel(A, k2+1, n, k1, k2, P);
+        } else {
+            if (grid.row()==pk) {
+                const IndexType r  = A.localRow(k1);
+                const IndexType c1 = A.firstLocalCol(k2+1);
+
+                if (grid.col()==qk) {
+                    const IndexType c = A.localCol(k1);
+                    D = localA(_(r,r+w-1),_(c,c+w-1));
+                }
+                distBcast(D.data(), w*w, qk, grid.rowComm());
+                if (c1<=nLocal) {
+                    blas::sm(Left, ConjTrans, T(1), D.upper(),
+                             localA(_(r,r+w-1),_(c1,nLocal)));
+                }
+            }
+            replicateRowPanel(A, k1, k2, k2+1, n, P);
+        }
+//
+//      Update the local part of the trailing triangle
+//
+        const IndexType r1 = A.firstLocalRow(k2+1);
+        const IndexType c1 = A.firstLocalCol(k2+1);
+
+        if (r1>mLocal || c1>nLocal) {
+            continue;
+        }
+        if (upLo==Lower) {
+            PR.resize(mLocal-r1+1, w);
+            PC.resize(nLocal-c1+1, w);
+            for (IndexType r=r1; r<=mLocal; ++r) {
+                PR(r-r1+1,_) = P(A.globalRow(r)-k2,_);
+            }
+            for (IndexType c=c1; c<=nLocal; ++c) {
+                PC(c-c1+1,_) = P(A.globalCol(c)-k2,_);
+            }
+        } else {
+            PR.resize(w, mLocal-r1+1);
+            PC.resize(w, nLocal-c1+1);
+            for (IndexType r=r1; r<=mLocal; ++r) {
+                PR(_,r-r1+1) = P(_,A.globalRow(r)-k2);
+            }
+            for (IndexType c=c1; c<=nLocal; ++c) {
+                PC(_,c-c1+1) = P(_,A.globalCol(c)-k2);
+            }
+        }
+
+        for (IndexType c=c1; c<=nLocal; c+=nb) {
+            const IndexType c2 = std::min(c+nb-1, nLocal);
+            const IndexType wc = c2-c+1;
+            const IndexType gc = A.globalCol(c);
+            const IndexType rd = A.firstLocalRow(gc);
+            const bool      hasDiag = (rd<=mLocal && A.globalRow(rd)==gc);
+
+            const auto PCc = (upLo==Lower) ? PC(_(c-c1+1,c2-c1+1),_)
+                                           : PC(_,_(c-c1+1,c2-c1+1));
+//
+//          Block on the diagonal: only the triangle upLo gets updated
+//
+            if (hasDiag) {
+                if (W.numRows()!=wc) {
+                    W.resize(wc, wc);
+                }
+                if (upLo==Lower) {
+                    blas::mm(NoTrans, ConjTrans, T(1),
+                             PR(_(rd-r1+1,rd-r1+wc),_), PCc, T(0), W);
+                } else {
+                    blas::mm(ConjTrans, NoTrans, T(1),
+                             PR(_,_(rd-r1+1,rd-r1+wc)), PCc, T(0), W);
+                }
+                for (IndexType j=1; j<=wc; ++j) {
+                    const IndexType i1 = (upLo==Lower) ? j  : 1;
+                    const IndexType i2 = (upLo==Lower) ? wc : j;
+
+                    for (IndexType i=i1; i<=i2; ++i) {
+                        localA(rd+i-1,c+j-1) -= W(i,j);
+                    }
+                }
+            }
+//
+//          Blocks strictly below (Lower) or above (Upper) the diagonal
+//
+            if (upLo==Lower) {
+                const IndexType rs = hasDiag ? rd+wc : rd;
+
+                if (rs<=mLocal) {
+                    blas::mm(NoTrans, ConjTrans, T(-1),
+                             PR(_(rs-r1+1,mLocal-r1+1),_), PCc,
+                             T(1), localA(_(rs,mLocal),_(c,c2)));
+                }
+            } else {
+                if (rd>r1) {
+                    blas::mm(ConjTrans, NoTrans, T(-1),
+                             PR(_,_(1,rd-r1)), PCc,
+                             T(1), localA(_(r1,rd-1),_(c,c2)));
+                }
+            }
+        }
+    }
+    return 0;
+}
+
+template <typename T>
+void
+potrs(StorageUpLo upLo, const DistGeMatrix<T> &A, DistGeMatrix<T> &B)
+{
+    if (upLo==Lower) {
+        sm(Lower, NoTrans, NonUnit, T(1), A, B);
+        sm(Lower, ConjTrans, NonUnit, T(1), A, B);
+    } else {
+        sm(Upper, ConjTrans, NonUnit, T(1), A, B);
+        sm(Upper, NoTrans, NonUnit, T(1), A, B);
+    }
+}
+
+#endif // WITH_MPI
+
+} }
+
+#endif // PLAYGROUND_FLENS_MPI_DISTRIBUTED_POTRF_TCC
@@ -0,0 +1,108 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn, Klaus Pototzky
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PLAYGROUND_FLENS_MPI_DISTRIBUTED_PROCESSGRID_H
+#define PLAYGROUND_FLENS_MPI_DISTRIBUTED_PROCESSGRID_H 1
+
+#ifdef WITH_MPI
+#    include "mpi.h"
+#endif
+
+namespace flens { namespace mpi {
+
+#ifdef WITH_MPI
+
+//
+//  Two dimensional numRows x numCols grid of processes.  Processes get
+//  numbered row by row, i.e. process (row, col) has rank row*numCols+col
+//  in the communicator of the grid.  Besides the communicator for the whole
+//  grid each process has a communicator for its process row (the rank
+//  within equals col) and one for its process column (the rank within
+//  equals row).
+//
+//  The grid must cover all processes of the communicator.  As it owns MPI
+//  communicators it has to be destroyed before MPI_finalize gets called.
+//
+class ProcessGrid
+{
+    public:
+        ProcessGrid(int numRows, int numCols,
+                    const MPI::Intracomm &communicator = MPI::COMM_WORLD);
+
+        //  Grid as square as possible with numRows<=numCols
+        explicit
+        ProcessGrid(const MPI::Intracomm &communicator = MPI::COMM_WORLD);
+
+        ~ProcessGrid();
+
+        int
+        numRows() const;
+
+        int
+        numCols() const;
+
+        int
+        row() const;
+
+        int
+        col() const;
+
+        int
+        rank(int row, int col) const;
+
+        const MPI::Intracomm &
+        comm() const;
+
+        const MPI::Intracomm &
+        rowComm() const;
+
+        const MPI::Intracomm &
+        colComm() const;
+
+    private:
+        ProcessGrid(const ProcessGrid &rhs);
+
+        ProcessGrid &
+        operator=(const ProcessGrid &rhs);
+
+        void
+        init_(const MPI::Intracomm &communicator);
+
+        int             numRows_, numCols_, row_, col_;
+        MPI::Intracomm  comm_, rowComm_, colComm_;
+};
+
+#endif // WITH_MPI
+
+} }
+
+#endif // PLAYGROUND_FLENS_MPI_DISTRIBUTED_PROCESSGRID_H
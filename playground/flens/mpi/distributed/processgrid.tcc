@@ -0,0 +1,141 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn, Klaus Pototzky
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PLAYGROUND_FLENS_MPI_DISTRIBUTED_PROCESSGRID_TCC
+#define PLAYGROUND_FLENS_MPI_DISTRIBUTED_PROCESSGRID_TCC 1
+
+#include<playground/flens/mpi/mpi-flens.h>
+
+namespace flens { namespace mpi {
+
+#ifdef WITH_MPI
+
+inline
+ProcessGrid::ProcessGrid(int numRows, int numCols,
+                         const MPI::Intracomm &communicator)
+    : numRows_(numRows), numCols_(numCols)
+{
+    init_(communicator);
+}
+
+inline
+ProcessGrid::ProcessGrid(const MPI::Intracomm &communicator)
+{
+    const int size = communicator.Get_size();
+
+    numRows_ = 1;
+    for (int p=1; p*p<=size; ++p) {
+        if (size % p==0) {
+            numRows_ = p;
+        }
+    }
+    numCols_ = size / numRows_;
+    init_(communicator);
+}
+
+inline
+ProcessGrid::~ProcessGrid()
+{
+    colComm_.Free();
+    rowComm_.Free();
+    comm_.Free();
+}
+
+inline int
+ProcessGrid::numRows() const
+{
+    return numRows_;
+}
+
+inline int
+ProcessGrid::numCols() const
+{
+    return numCols_;
+}
+
+inline int
+ProcessGrid::row() const
+{
+    return row_;
+}
+
+inline int
+ProcessGrid::col() const
+{
+    return col_;
+}
+
+inline int
+ProcessGrid::rank(int row, int col) const
+{
+    return row*numCols_ + col;
+}
+
+inline const MPI::Intracomm &
+ProcessGrid::comm() const
+{
+    return comm_;
+}
+
+inline const MPI::Intracomm &
+ProcessGrid::rowComm() const
+{
+    return rowComm_;
+}
+
+inline const MPI::Intracomm &
+ProcessGrid::colComm() const
+{
+    return colComm_;
+}
+
+inline void
+ProcessGrid::init_(const MPI::Intracomm &communicator)
+{
+    MPI_ASSERT(numRows_*numCols_==communicator.Get_size());
+
+    comm_ = communicator.Dup();
+
+    const int rank = comm_.Get_rank();
+
+    row_ = rank / numCols_;
+    col_ = rank % numCols_;
+
+    rowComm_ = comm_.Split(row_, col_);
+    colComm_ = comm_.Split(col_, row_);
+}
+
+#endif // WITH_MPI
+
+} }
+
+#endif // PLAYGROUND_FLENS_MPI_DISTRIBUTED_PROCESSGRID_TCC
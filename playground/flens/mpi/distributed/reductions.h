@@ -0,0 +1,82 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn, Klaus Pototzky
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PLAYGROUND_FLENS_MPI_DISTRIBUTED_REDUCTIONS_H
+#define PLAYGROUND_FLENS_MPI_DISTRIBUTED_REDUCTIONS_H 1
+
+#include<flens/auxiliary/auxiliary.h>
+#include<flens/vectortypes/vectortypes.h>
+#include<playground/flens/mpi/distributed/distarray.h>
+
+namespace flens { namespace blas {
+
+#ifdef WITH_MPI
+
+//
+//  BLAS Level 1 reductions for vectors with DistArray storage: the local
+//  results get combined over the communicator of x, so that all processes
+//  get the same result.  These overloads are more specialized than the
+//  ones for DenseVector and get picked up by the vector closures (x*y) and
+//  hence by the solvers in playground/flens/solver.
+//
+
+template <typename T, typename RES>
+    void
+    dot(const DenseVector<mpi::DistArray<T> > &x,
+        const DenseVector<mpi::DistArray<T> > &y,
+        RES &result);
+
+template <typename T, typename RES>
+    void
+    dotc(const DenseVector<mpi::DistArray<T> > &x,
+         const DenseVector<mpi::DistArray<T> > &y,
+         RES &result);
+
+template <typename T, typename RES>
+    void
+    dotu(const DenseVector<mpi::DistArray<T> > &x,
+         const DenseVector<mpi::DistArray<T> > &y,
+         RES &result);
+
+template <typename T, typename RES>
+    typename RestrictTo<IsNotComplex<RES>::value, void>::Type
+    nrm2(const DenseVector<mpi::DistArray<T> > &x, RES &norm);
+
+template <typename T, typename RES>
+    typename RestrictTo<IsNotComplex<RES>::value, void>::Type
+    asum(const DenseVector<mpi::DistArray<T> > &x, RES &absoluteSum);
+
+#endif // WITH_MPI
+
+} } // namespace blas, flens
+
+#endif // PLAYGROUND_FLENS_MPI_DISTRIBUTED_REDUCTIONS_H
@@ -0,0 +1,131 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn, Klaus Pototzky
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PLAYGROUND_FLENS_MPI_DISTRIBUTED_REDUCTIONS_TCC
+#define PLAYGROUND_FLENS_MPI_DISTRIBUTED_REDUCTIONS_TCC 1
+
+#include<cxxstd/cmath.h>
+#include<cxxstd/vector.h>
+#include<playground/flens/mpi/mpi-flens.h>
+
+namespace flens { namespace blas {
+
+#ifdef WITH_MPI
+
+template <typename T, typename RES>
+void
+dot(const DenseVector<mpi::DistArray<T> > &x,
+    const DenseVector<mpi::DistArray<T> > &y,
+    RES &result)
+{
+    ASSERT(x.length()==y.length());
+
+    cxxblas::dot(x.length(),
+                 x.data(), x.stride(),
+                 y.data(), y.stride(), result);
+    mpi::distAllreduceSum(&result, 1, x.engine().communicator());
+}
+
+template <typename T, typename RES>
+void
+dotc(const DenseVector<mpi::DistArray<T> > &x,
+     const DenseVector<mpi::DistArray<T> > &y,
+     RES &result)
+{
+    dot(x, y, result);
+}
+
+template <typename T, typename RES>
+void
+dotu(const DenseVector<mpi::DistArray<T> > &x,
+     const DenseVector<mpi::DistArray<T> > &y,
+     RES &result)
+{
+    ASSERT(x.length()==y.length());
+
+    cxxblas::dotu(x.length(),
+                  x.data(), x.stride(),
+                  y.data(), y.stride(), result);
+    mpi::distAllreduceSum(&result, 1, x.engine().communicator());
+}
+
+//
+//  The local norms get gathered and combined in the order of the ranks with
+//  scaling by the largest one.  This avoids overflow and all processes get
+//  the same result.
+//
+template <typename T, typename RES>
+typename RestrictTo<IsNotComplex<RES>::value, void>::Type
+nrm2(const DenseVector<mpi::DistArray<T> > &x, RES &norm)
+{
+    typedef typename mpi::MPI_Type<RES>::PrimitiveType  PT;
+
+    const MPI::Intracomm &communicator = x.engine().communicator();
+
+    RES localNorm;
+    cxxblas::nrm2(x.length(), x.data(), x.stride(), localNorm);
+
+    std::vector<RES>  norms(communicator.Get_size());
+    communicator.Allgather(reinterpret_cast<const PT *>(&localNorm), 1,
+                           mpi::MPI_Type<RES>::Type(),
+                           reinterpret_cast<PT *>(norms.data()), 1,
+                           mpi::MPI_Type<RES>::Type());
+
+    RES scale = RES(0);
+    for (size_t q=0; q<norms.size(); ++q) {
+        scale = std::max(scale, norms[q]);
+    }
+    if (scale==RES(0)) {
+        norm = RES(0);
+        return;
+    }
+    RES sum = RES(0);
+    for (size_t q=0; q<norms.size(); ++q) {
+        sum += (norms[q]/scale)*(norms[q]/scale);
+    }
+    norm = scale*std::sqrt(sum);
+}
+
+template <typename T, typename RES>
+typename RestrictTo<IsNotComplex<RES>::value, void>::Type
+asum(const DenseVector<mpi::DistArray<T> > &x, RES &absoluteSum)
+{
+
+    cxxblas::asum(x.length(), x.data(), x.stride(), absoluteSum);
+    mpi::distAllreduceSum(&absoluteSum, 1, x.engine().communicator());
+}
+
+#endif // WITH_MPI
+
+} } // namespace blas, flens
+
+#endif // PLAYGROUND_FLENS_MPI_DISTRIBUTED_REDUCTIONS_TCC
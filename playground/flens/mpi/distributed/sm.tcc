@@ -0,0 +1,179 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn, Klaus Pototzky
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PLAYGROUND_FLENS_MPI_DISTRIBUTED_SM_TCC
+#define PLAYGROUND_FLENS_MPI_DISTRIBUTED_SM_TCC 1
+
+#include<playground/flens/mpi/mpi-flens.h>
+
+namespace flens { namespace mpi {
+
+#ifdef WITH_MPI
+
+//
+//  Local triangular solve with the diagonal block
+//
+template <typename MA, typename MB>
+void
+smDiagBlock(StorageUpLo upLo, Transpose trans, Diag diag,
+            const MA &A, MB &&B)
+{
+    typedef typename RemoveRef<MB>::Type::ElementType  T;
+
+    if (B.numRows()==0 || B.numCols()==0) {
+        return;
+    }
+    if (upLo==Lower) {
+        if (diag==Unit) {
+            blas::sm(Left, trans, T(1), A.lowerUnit(), B);
+        } else {
+            blas::sm(Left, trans, T(1), A.lower(), B);
+        }
+    } else {
+        if (diag==Unit) {
+            blas::sm(Left, trans, T(1), A.upperUnit(), B);
+        } else {
+            blas::sm(Left, trans, T(1), A.upper(), B);
+        }
+    }
+}
+
+template <typename ALPHA, typename T>
+void
+sm(StorageUpLo upLo, Transpose trans, Diag diag, const ALPHA &alpha,
+   const DistGeMatrix<T> &A, DistGeMatrix<T> &B)
+{
+    typedef typename DistGeMatrix<T>::IndexType     IndexType;
+    typedef typename DistGeMatrix<T>::LocalMatrix   LocalMatrix;
+
+    const Underscore<IndexType> _;
+    const ProcessGrid &grid = B.grid();
+
+    MPI_ASSERT(&A.grid()==&grid);
+    MPI_ASSERT(A.numRows()==A.numCols() && A.numRows()==B.numRows());
+    MPI_ASSERT(A.rowBlockSize()==A.colBlockSize());
+    MPI_ASSERT(A.rowBlockSize()==B.rowBlockSize());
+    MPI_ASSERT(trans!=Conj);
+
+    const IndexType n  = A.numRows();
+    const IndexType nb = A.rowBlockSize();
+    const IndexType N  = B.numCols();
+
+    const bool noTrans = (trans==NoTrans);
+    const bool forward = ((upLo==Lower)==noTrans);
+
+    auto localB = B.local();
+
+    const bool empty = (localB.numRows()==0 || localB.numCols()==0);
+
+    if (!empty && alpha!=ALPHA(1)) {
+        localB *= T(alpha);
+    }
+
+    const IndexType numBlocks = (n+nb-1)/nb;
+
+    LocalMatrix  AP, XP, AT;
+
+    for (IndexType b=0; b<numBlocks; ++b) {
+        const IndexType k1 = (forward ? b : numBlocks-1-b)*nb + 1;
+        const IndexType k2 = std::min(k1+nb-1, n);
+        const IndexType w  = k2-k1+1;
+        const int       pk = A.rowOwner(k1);
+//
+//      Rows [u1,u2] of B get updated with the solution of block k
+//
+        const IndexType u1 = forward ? k2+1 : 1;
+        const IndexType u2 = forward ? n    : k1-1;
+        const IndexType r1 = B.firstLocalRow(u1);
+        const IndexType r2 = B.firstLocalRow(u2+1)-1;
+//
+//      Panel of A containing the diagonal block and the update
+//
+        const IndexType i1 = forward ? k1 : 1;
+        const IndexType i2 = forward ? n  : k2;
+
+        if (noTrans) {
+            bcastColPanel(A, i1, i2, k1, k2, AP);
+        } else {
+            replicateRowPanel(A, k1, k2, i1, i2, AP);
+        }
+//
+//      Solve with the diagonal block on process row pk
+//
+        if (grid.row()==pk && !empty) {
+            const IndexType rk = B.localRow(k1);
+
+            if (noTrans) {
+                const IndexType d = rk - A.firstLocalRow(i1) + 1;
+
+                smDiagBlock(upLo, trans, diag, AP(_(d,d+w-1),_),
+                            localB(_(rk,rk+w-1),_));
+            } else {
+                const IndexType d = k1 - i1 + 1;
+
+                smDiagBlock(upLo, trans, diag, AP(_,_(d,d+w-1)),
+                            localB(_(rk,rk+w-1),_));
+            }
+        }
+//
+//      Broadcast the solution within the process columns and update
+//
+        bcastRowPanel(B, k1, k2, 1, N, XP);
+
+        if (r1>r2 || empty) {
+            continue;
+        }
+
+        auto localBU = localB(_(r1,r2),_);
+
+        if (noTrans) {
+            const IndexType d = r1 - A.firstLocalRow(i1) + 1;
+
+            blas::mm(NoTrans, NoTrans, T(-1), AP(_(d,d+r2-r1),_), XP,
+                     T(1), localBU);
+        } else {
+            if (AT.numRows()!=w || AT.numCols()!=r2-r1+1) {
+                AT.resize(w, r2-r1+1);
+            }
+            for (IndexType r=r1; r<=r2; ++r) {
+                AT(_,r-r1+1) = AP(_,B.globalRow(r)-i1+1);
+            }
+            blas::mm(trans, NoTrans, T(-1), AT, XP, T(1), localBU);
+        }
+    }
+}
+
+#endif // WITH_MPI
+
+} }
+
+#endif // PLAYGROUND_FLENS_MPI_DISTRIBUTED_SM_TCC
@@ -0,0 +1,74 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn, Klaus Pototzky
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PLAYGROUND_FLENS_MPI_DISTRIBUTED_SPMV_H
+#define PLAYGROUND_FLENS_MPI_DISTRIBUTED_SPMV_H 1
+
+#include<flens/auxiliary/auxiliary.h>
+#include<flens/typedefs.h>
+#include<flens/vectortypes/vectortypes.h>
+#include<playground/flens/mpi/distributed/distgecrsmatrix.h>
+
+namespace flens { namespace blas {
+
+#ifdef WITH_MPI
+
+//
+//  y = beta*y + alpha*op(A)*x for a row partitioned sparse matrix.  x and y
+//  are the local parts of vectors partitioned like the rows of A.
+//
+//  NoTrans, Conj: the ghost values of x get exchanged while the diagonal
+//  block is multiplied, then the off-diagonal block gets added.
+//
+//  Trans, ConjTrans: the off-diagonal block gives contributions to
+//  off-process entries of y.  These get sent to their owners while the
+//  diagonal block is multiplied and are added afterwards.
+//
+template <typename ALPHA, typename T, typename VX, typename BETA, typename VY>
+    typename RestrictTo<IsDenseVector<VX>::value
+                     && IsDenseVector<VY>::value,
+             void>::Type
+    mv(Transpose trans, const ALPHA &alpha, const mpi::DistGeCRSMatrix<T> &A,
+       const VX &x, const BETA &beta, VY &&y);
+
+template <typename ALPHA, typename T, typename VX, typename BETA, typename VY>
+    typename RestrictTo<IsDenseVector<VX>::value
+                     && IsDenseVector<VY>::value,
+             void>::Type
+    mv(const ALPHA &alpha, const mpi::DistSyCRSMatrix<T> &A,
+       const VX &x, const BETA &beta, VY &&y);
+
+#endif // WITH_MPI
+
+} } // namespace blas, flens
+
+#endif // PLAYGROUND_FLENS_MPI_DISTRIBUTED_SPMV_H
@@ -0,0 +1,100 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn, Klaus Pototzky
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PLAYGROUND_FLENS_MPI_DISTRIBUTED_SPMV_TCC
+#define PLAYGROUND_FLENS_MPI_DISTRIBUTED_SPMV_TCC 1
+
+#include<playground/flens/mpi/mpi-flens.h>
+
+namespace flens { namespace blas {
+
+#ifdef WITH_MPI
+
+template <typename ALPHA, typename T, typename VX, typename BETA, typename VY>
+typename RestrictTo<IsDenseVector<VX>::value
+                 && IsDenseVector<VY>::value,
+         void>::Type
+mv(Transpose trans, const ALPHA &alpha, const mpi::DistGeCRSMatrix<T> &A,
+   const VX &x, const BETA &beta, VY &&y)
+{
+    typedef typename mpi::DistGeCRSMatrix<T>::IndexType  IndexType;
+
+    const IndexType n = A.numLocalRows();
+
+    ASSERT(x.length()==n);
+    ASSERT(!DEBUGCLOSURE::identical(x, y));
+
+    if (y.length()!=n) {
+        ASSERT(beta==BETA(0));
+        y.reserve(x);
+    }
+
+    mpi::HaloExchange<T> &halo     = A.halo();
+    const bool           noTrans   = (trans==NoTrans || trans==Conj);
+    const bool           hasGhosts = (halo.numGhosts()>0);
+
+    if (noTrans) {
+        halo.begin(x);
+        if (n>0) {
+            mv(trans, alpha, A.diagonalBlock(), x, beta, y);
+        }
+        halo.end();
+        if (n>0 && hasGhosts) {
+            mv(trans, alpha, A.offDiagonalBlock(), halo.ghosts(), T(1), y);
+        }
+    } else {
+        if (n>0 && hasGhosts) {
+            mv(trans, alpha, A.offDiagonalBlock(), x, T(0), halo.ghosts());
+        }
+        halo.beginReverse();
+        if (n>0) {
+            mv(trans, alpha, A.diagonalBlock(), x, beta, y);
+        }
+        halo.endReverse(y);
+    }
+}
+
+template <typename ALPHA, typename T, typename VX, typename BETA, typename VY>
+typename RestrictTo<IsDenseVector<VX>::value
+                 && IsDenseVector<VY>::value,
+         void>::Type
+mv(const ALPHA &alpha, const mpi::DistSyCRSMatrix<T> &A,
+   const VX &x, const BETA &beta, VY &&y)
+{
+    mv(NoTrans, alpha, A.general(), x, beta, y);
+}
+
+#endif // WITH_MPI
+
+} } // namespace blas, flens
+
+#endif // PLAYGROUND_FLENS_MPI_DISTRIBUTED_SPMV_TCC
@@ -0,0 +1,76 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn, Klaus Pototzky
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PLAYGROUND_FLENS_MPI_DISTRIBUTED_TRF_H
+#define PLAYGROUND_FLENS_MPI_DISTRIBUTED_TRF_H 1
+
+#include<flens/auxiliary/auxiliary.h>
+#include<flens/vectortypes/vectortypes.h>
+#include<playground/flens/mpi/distributed/distgematrix.h>
+
+namespace flens { namespace mpi {
+
+#ifdef WITH_MPI
+
+//
+//  LU factorization A = P*L*U with partial pivoting.
+//
+//  Right looking blocked algorithm as in ScaLAPACK's pxgetrf: the owning
+//  process column factorizes the panel (pivot search with a MAXLOC
+//  reduction within the process column), all processes apply the row
+//  interchanges to the remaining columns, the owning process row computes
+//  the block row of U and each process updates its local part of the
+//  trailing matrix.  A must have the same row and column block size.
+//
+//  The pivot vector piv (global row indices like lapack::trf) is replicated
+//  on all processes and gets resized to min(m,n).  Returns 0 or, like
+//  lapack::trf, the index of the first zero diagonal element of U.  All
+//  processes return the same value.
+//
+template <typename T, typename VP>
+    typename RestrictTo<IsIntegerDenseVector<VP>::value,
+             typename DistGeMatrix<T>::IndexType>::Type
+    trf(DistGeMatrix<T> &A, VP &&piv);
+
+//
+//  Solves A*X = B with the LU factorization computed by trf.
+//
+template <typename T, typename VP>
+    typename RestrictTo<IsIntegerDenseVector<VP>::value,
+             void>::Type
+    trs(const DistGeMatrix<T> &A, const VP &piv, DistGeMatrix<T> &B);
+
+#endif // WITH_MPI
+
+} }
+
+#endif // PLAYGROUND_FLENS_MPI_DISTRIBUTED_TRF_H
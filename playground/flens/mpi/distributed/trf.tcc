@@ -0,0 +1,238 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn, Klaus Pototzky
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PLAYGROUND_FLENS_MPI_DISTRIBUTED_TRF_TCC
+#define PLAYGROUND_FLENS_MPI_DISTRIBUTED_TRF_TCC 1
+
+#include<cxxstd/cmath.h>
+#include<playground/flens/mpi/mpi-flens.h>
+
+namespace flens { namespace mpi {
+
+#ifdef WITH_MPI
+
+//
+//  Absolute value used for the pivot search (|Re|+|Im| for complex numbers
+//  like in blas::iamax).
+//
+template <typename T>
+double
+trfPivotAbs(const T &x)
+{
+    return std::abs(x);
+}
+
+template <typename T>
+double
+trfPivotAbs(const std::complex<T> &x)
+{
+    return cxxblas::abs1(x);
+}
+
+template <typename T, typename VP>
+typename RestrictTo<IsIntegerDenseVector<VP>::value,
+         typename DistGeMatrix<T>::IndexType>::Type
+trf(DistGeMatrix<T> &A, VP &&piv)
+{
+    typedef typename DistGeMatrix<T>::IndexType     IndexType;
+    typedef typename DistGeMatrix<T>::LocalMatrix   LocalMatrix;
+    typedef DenseVector<Array<T> >                  Vector;
+
+    const Underscore<IndexType> _;
+    const ProcessGrid &grid = A.grid();
+
+    MPI_ASSERT(A.rowBlockSize()==A.colBlockSize());
+
+    const IndexType m      = A.numRows();
+    const IndexType n      = A.numCols();
+    const IndexType mn     = std::min(m, n);
+    const IndexType nb     = A.rowBlockSize();
+    const IndexType mLocal = A.numLocalRows();
+    const IndexType nLocal = A.numLocalCols();
+
+    if (piv.length()!=mn) {
+        piv.resize(mn);
+    }
+
+    auto localA = A.local();
+
+    IndexType    info = 0;
+    LocalMatrix  D, L21, U12;
+    Vector       u;
+
+    for (IndexType k1=1; k1<=mn; k1+=nb) {
+        const IndexType k2 = std::min(k1+nb-1, mn);
+        const IndexType w  = k2-k1+1;
+        const int       pk = A.rowOwner(k1);
+        const int       qk = A.colOwner(k1);
+//
+//      Factorize the panel A(k1:m,k1:k2) on process column qk
+//
+        if (grid.col()==qk) {
+            const IndexType c0 = A.localCol(k1);
+
+            for (IndexType j=k1; j<=k2; ++j) {
+                const IndexType cj = c0+j-k1;
+                const IndexType r1 = A.firstLocalRow(j);
+//
+//              Pivot search
+//
+                struct {
+                    double  value;
+                    int     index;
+                } local, global;
+
+                local.value = -1;
+                local.index = j;
+                for (IndexType r=r1; r<=mLocal; ++r) {
+                    const double value = trfPivotAbs(localA(r,cj));
+                    if (value>local.value) {
+                        local.value = value;
+                        local.index = A.globalRow(r);
+                    }
+                }
+                grid.colComm().Allreduce(&local, &global, 1,
+                                         MPI::DOUBLE_INT, MPI::MAXLOC);
+                piv(j) = global.index;
+
+                if (global.value==0) {
+                    if (info==0) {
+                        info = j;
+                    }
+                } else {
+                    swapRows(A, j, piv(j), k1, k2);
+                }
+//
+//              Broadcast the pivot row, compute the column of L and update
+//              the rest of the panel
+//
+                const IndexType len = k2-j+1;
+                const int       pj  = A.rowOwner(j);
+
+                if (u.length()!=len) {
+                    u.resize(len);
+                }
+                if (grid.row()==pj) {
+                    u = localA(A.localRow(j),_(cj,cj+len-1));
+                }
+                distBcast(u.data(), len, pj, grid.colComm());
+
+                const IndexType rs = A.firstLocalRow(j+1);
+                if (rs>mLocal) {
+                    continue;
+                }
+                if (u(1)!=T(0)) {
+                    localA(_(rs,mLocal),cj) *= T(1)/u(1);
+                }
+                if (len>1) {
+                    blas::r(T(-1), localA(_(rs,mLocal),cj), u(_(2,len)),
+                            localA(_(rs,mLocal),_(cj+1,cj+len-1)));
+                }
+            }
+        }
+//
+//      All processes get the pivots of the panel and apply them to the
+//      columns left and right of the panel
+//
+        distBcast(&piv(k1), w, qk, grid.rowComm());
+        distBcast(&info, 1, qk, grid.rowComm());
+
+        for (IndexType j=k1; j<=k2; ++j) {
+            if (piv(j)!=j) {
+                swapRows(A, j, piv(j), 1, k1-1);
+                swapRows(A, j, piv(j), k2+1, n);
+            }
+        }
+        if (k2==n) {
+            continue;
+        }
+//
+//      Block row U12 = L11^(-1)*A12 on process row pk
+//
+        const IndexType c1 = A.firstLocalCol(k2+1);
+
+        if (grid.row()==pk) {
+            const IndexType r = A.localRow(k1);
+
+            if (D.numRows()!=w) {
+                D.resize(w, w);
+            }
+            if (grid.col()==qk) {
+                const IndexType c = A.localCol(k1);
+                D = localA(_(r,r+w-1),_(c,c+w-1));
+            }
+            distBcast(D.data(), w*w, qk, grid.rowComm());
+            if (c1<=nLocal) {
+                blas::sm(Left, NoTrans, T(1), D.lowerUnit(),
+                         localA(_(r,r+w-1),_(c1,nLocal)));
+            }
+        }
+//
+//      Trailing update A22 = A22 - L21*U12
+//
+        const IndexType r1 = A.firstLocalRow(k2+1);
+
+        bcastColPanel(A, k2+1, m, k1, k2, L21);
+        bcastRowPanel(A, k1, k2, k2+1, n, U12);
+
+        if (r1<=mLocal && c1<=nLocal) {
+            blas::mm(NoTrans, NoTrans, T(-1), L21, U12,
+                     T(1), localA(_(r1,mLocal),_(c1,nLocal)));
+        }
+    }
+    return info;
+}
+
+template <typename T, typename VP>
+typename RestrictTo<IsIntegerDenseVector<VP>::value,
+         void>::Type
+trs(const DistGeMatrix<T> &A, const VP &piv, DistGeMatrix<T> &B)
+{
+    typedef typename DistGeMatrix<T>::IndexType     IndexType;
+
+    MPI_ASSERT(A.numRows()==A.numCols());
+    MPI_ASSERT(piv.length()==A.numRows());
+
+    for (IndexType j=1; j<=piv.length(); ++j) {
+        if (piv(j)!=j) {
+            swapRows(B, j, piv(j), 1, B.numCols());
+        }
+    }
+    sm(Lower, NoTrans, Unit, T(1), A, B);
+    sm(Upper, NoTrans, NonUnit, T(1), A, B);
+}
+
+#endif // WITH_MPI
+
+} }
+
+#endif // PLAYGROUND_FLENS_MPI_DISTRIBUTED_TRF_TCC
@@ -43,10 +43,16 @@
 #include<playground/flens/mpi/finalize.h>
 #include<playground/flens/mpi/rank.h>
 #include<playground/flens/mpi/size.h>
+#include<playground/flens/mpi/buffer.h>
 #include<playground/flens/mpi/bcast/bcast.h>
 #include<playground/flens/mpi/recv/recv.h>
 #include<playground/flens/mpi/reduce/reduce.h>
 #include<playground/flens/mpi/send/send.h>
+#include<playground/flens/mpi/allreduce/allreduce.h>
+#include<playground/flens/mpi/ibcast/ibcast.h>
+#include<playground/flens/mpi/irecv/irecv.h>
+#include<playground/flens/mpi/isend/isend.h>
+#include<playground/flens/mpi/distributed/distributed.h>
 
 #ifdef WITH_MPI
 #    ifdef NDEBUG
@@ -37,9 +37,15 @@
 #include<playground/flens/mpi/finalize.tcc>
 #include<playground/flens/mpi/rank.tcc>
 #include<playground/flens/mpi/size.tcc>
+#include<playground/flens/mpi/buffer.tcc>
 #include<playground/flens/mpi/bcast/bcast.tcc>
 #include<playground/flens/mpi/recv/recv.tcc>
 #include<playground/flens/mpi/reduce/reduce.tcc>
 #include<playground/flens/mpi/send/send.tcc>
+#include<playground/flens/mpi/allreduce/allreduce.tcc>
+#include<playground/flens/mpi/ibcast/ibcast.tcc>
+#include<playground/flens/mpi/irecv/irecv.tcc>
+#include<playground/flens/mpi/isend/isend.tcc>
+#include<playground/flens/mpi/distributed/distributed.tcc>
 
 #endif // PLAYGROUND_FLENS_MPI_MPI_TCC
@@ -77,22 +77,11 @@ typename RestrictTo<MPI_Type<T>::Compatible,
 MPI_recv(const IndexType n, T *x, const IndexType incX, const int source,
          const MPI::Comm &communicator)
 {
-    using namespace MPI;
-
-    typedef typename MPI_Type<T>::PrimitiveType  PT;
+    MPI_Buffer  buffer(n, x, incX);
 
-    if ( incX==IndexType(1) ) {
-        Status status;
-        communicator.Recv(reinterpret_cast<PT *>(x),
-                          n*MPI_Type<T>::size, MPI_Type<T>::Type(),
-                          source, 0, status);
-    } else {
-
-        for (IndexType i=0, iX=0; i<n; ++i, iX+=incX) {
-             MPI_recv(x[iX], source, communicator);
-        }
-    }
-    return ;
+    MPI::Status status;
+    communicator.Recv(buffer.data(), buffer.count(), buffer.type(),
+                      source, 0, status);
 
 }
 
@@ -159,26 +148,11 @@ MPI_recv(MA &&A, const int source, const MPI::Comm &communicator)
     ASSERT( isColMajor == ( A.order() == ColMajor ) );
 #endif
 
-    if ( A.order() == ColMajor ) {
-
-      for (IndexType i=0; i<A.numCols(); ++i) {
-
-            MPI_recv(A.numRows(), A.data()+i*A.leadingDimension(), 1,
-                     source, communicator);
-
-        }
-
-    } else {
-
-        for (IndexType i=0; i<A.numRows(); ++i) {
-
-            MPI_recv(A.numCols(), A.data()+i*A.leadingDimension(), 1,
-                     source, communicator);
-
-
-        }
-    }
+    MPI_Buffer  buffer(A);
 
+    MPI::Status status;
+    communicator.Recv(buffer.data(), buffer.count(), buffer.type(),
+                      source, 0, status);
 
 }
 
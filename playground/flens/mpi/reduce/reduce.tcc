@@ -52,7 +52,7 @@ MPI_reduce_max(const T &x, const int root, const MPI::Comm &communicator)
     T sum(0);
     communicator.Reduce(reinterpret_cast<const PT *>(&x),
                         reinterpret_cast<PT *>(&sum),
-                        MPI_Type<T>::size, MPI_Type<T>::Type(), MPI_MAX, 0);
+                        MPI_Type<T>::size, MPI_Type<T>::Type(), MPI_MAX, root);
     return sum;
 
 }
@@ -70,7 +70,7 @@ MPI_reduce_min(const T &x, const int root, const MPI::Comm &communicator)
     T sum(0);
     communicator.Reduce(reinterpret_cast<const PT *>(&x),
                         reinterpret_cast<PT *>(&sum),
-                        MPI_Type<T>::size, MPI_Type<T>::Type(), MPI_MIN, 0);
+                        MPI_Type<T>::size, MPI_Type<T>::Type(), MPI_MIN, root);
     return sum;
 
 }
@@ -88,7 +88,7 @@ MPI_reduce_sum(const T &x, const int root, const MPI::Comm &communicator)
     T sum(0);
     communicator.Reduce(reinterpret_cast<const PT *>(&x),
                         reinterpret_cast<PT *>(&sum),
-                        MPI_Type<T>::size, MPI_Type<T>::Type(), MPI_SUM, 0);
+                        MPI_Type<T>::size, MPI_Type<T>::Type(), MPI_SUM, root);
     return sum;
 
 }
@@ -102,12 +102,12 @@ MPI_reduce_sum(VX &&x, VSUM &&sum, const int root,
 {
     using namespace MPI;
 
-    typedef typename MPI_Type<T>::PrimitiveType  PT;
-
     typedef typename RemoveRef<VX>::Type   VectorX;
     typedef typename VectorX::ElementType T;
     typedef typename VectorX::IndexType   IndexType;
 
+    typedef typename MPI_Type<T>::PrimitiveType  PT;
+
     const int rank = MPI_rank();
 
     ASSERT( sum.length()==x.length() || root!=MPI_rank() );
@@ -138,7 +138,7 @@ MPI_reduce_sum(VX &&x, VSUM &&sum, const int root,
         communicator.Reduce(reinterpret_cast<PT *>(x.data()),
                             reinterpret_cast<PT *>(psum),
                             x.length()*MPI_Type<T>::size,
-                            MPI_Type<T>::Type(), MPI_SUM, 0);
+                            MPI_Type<T>::Type(), MPI_SUM, root);
 
     } else {
 
@@ -156,7 +156,7 @@ MPI_reduce_sum(VX &&x, VSUM &&sum, const int root,
             communicator.Reduce(reinterpret_cast<PT *>(&x(i)),
                                 reinterpret_cast<PT *>(psum),
                                 MPI_Type<T>::size, MPI_Type<T>::Type(),
-                                MPI_SUM, 0);
+                                MPI_SUM, root);
 
 
         }
@@ -217,7 +217,7 @@ MPI_reduce_sum(MA &&A, MSUM &&Sum, const int root,
             auto sum = Sum(_, j);
             MPI_reduce_sum(x, sum, root, communicator);
         }
-    } else
+    } else {
         const IndexType i0 = A.firstRow(),
                         i1 = A.lastRow();
         const IndexType j0 = Sum.firstRow();
@@ -60,20 +60,9 @@ typename RestrictTo<MPI_Type<T>::Compatible,
 MPI_send(const IndexType n, const T *x, const IndexType incX, const int dest,
          const MPI::Comm &communicator)
 {
-    using namespace MPI;
-
-    typedef typename MPI_Type<T>::PrimitiveType  PT;
+    MPI_Buffer  buffer(n, x, incX);
 
-    if ( incX==1 ) {
-        communicator.Send(reinterpret_cast<const PT *>(x),
-                          n*MPI_Type<T>::size, MPI_Type<T>::Type(), dest, 0);
-    } else {
-        for (IndexType i=0, iX=0; i<n; ++i, iX+=incX) {
-            MPI_send(x[iX], dest, communicator);
-        }
-    }
-
-    return ;
+    communicator.Send(buffer.data(), buffer.count(), buffer.type(), dest, 0);
 
 }
 
@@ -124,23 +113,9 @@ MPI_send(MA &&A, const int dest, const MPI::Comm &communicator)
     MPI_send(isColMajor, dest, communicator);
 #endif
 
-    if ( A.order() == ColMajor ) {
-
-        for (IndexType i=0; i<A.numCols(); ++i) {
-            MPI_send(A.numRows(), A.data()+i*A.leadingDimension(), 1,
-                     dest, communicator);
-        }
-
-    } else {
-
-        for (IndexType i=0; i<A.numRows(); ++i) {
-
-            MPI_send(A.numCols(), A.data()+i*A.leadingDimension(), 1,
-                     dest, communicator);
-
+    MPI_Buffer  buffer(A);
 
-        }
-    }
+    communicator.Send(buffer.data(), buffer.count(), buffer.type(), dest, 0);
 
 }
 
@@ -0,0 +1,61 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn, Klaus Pototzky
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PLAYGROUND_FLENS_SOLVER_BLOCKBICGSTAB_H
+#define PLAYGROUND_FLENS_SOLVER_BLOCKBICGSTAB_H 1
+
+#include <cxxstd/limits.h>
+
+#include <flens/lapack/typedefs.h>
+#include <flens/matrixtypes/matrixtypes.h>
+#include <flens/vectortypes/vectortypes.h>
+
+namespace flens { namespace solver {
+
+//
+//  BiCGStab for all columns of B simultaneously.  Like blockcg each
+//  iteration applies A to all active columns through matrix-matrix products
+//  and converged columns get deflated.
+//
+template <typename MA, typename MX, typename MB>
+    typename RestrictTo<IsMatrix<MA>::value
+                     && IsGeMatrix<MX>::value
+                     && IsGeMatrix<MB>::value,
+             typename RemoveRef<MX>::Type::IndexType>::Type
+    blockbicgstab(const MA &A, MX &&X, const MB &B,
+                  typename ComplexTrait<typename RemoveRef<MX>::Type::ElementType>::PrimitiveType tol
+                           = std::numeric_limits<typename ComplexTrait<typename RemoveRef<MX>::Type::ElementType>::PrimitiveType>::epsilon(),
+                  typename RemoveRef<MX>::Type::IndexType maxIterations = std::numeric_limits<typename RemoveRef<MX>::Type::IndexType>::max());
+
+} } // namespace solver, flens
+
+#endif // PLAYGROUND_FLENS_SOLVER_BLOCKBICGSTAB_H
@@ -0,0 +1,163 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn, Klaus Pototzky
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* Based on
+ *
+ * Yousef Saad - Iterative methods for sparse linear systems  (2nd edition)
+ * Algorithm 7.7, applied to all right-hand sides simultaneously
+ *
+ */
+
+#ifndef PLAYGROUND_FLENS_SOLVER_BLOCKBICGSTAB_TCC
+#define PLAYGROUND_FLENS_SOLVER_BLOCKBICGSTAB_TCC 1
+
+#include <cxxstd/cmath.h>
+#include <playground/flens/solver/blockbicgstab.h>
+
+namespace flens { namespace solver {
+
+template <typename MA, typename MX, typename MB>
+typename RestrictTo<IsMatrix<MA>::value
+                 && IsGeMatrix<MX>::value
+                 && IsGeMatrix<MB>::value,
+         typename RemoveRef<MX>::Type::IndexType>::Type
+blockbicgstab(const MA                                               &A,
+              MX                                                     &&X,
+              const MB                                               &B,
+              typename ComplexTrait<
+                         typename RemoveRef<MX>::Type::ElementType
+                       >::PrimitiveType                              tol,
+              typename RemoveRef<MX>::Type::IndexType                maxIterations)
+{
+    using std::abs;
+
+    typedef typename RemoveRef<MX>::Type       MatrixX;
+    typedef typename MatrixX::NoView           Matrix;
+    typedef typename MatrixX::View             MatrixView;
+    typedef typename MatrixX::IndexType        IndexType;
+    typedef typename MatrixX::ElementType      ElementType;
+    typedef DenseVector<Array<ElementType> >   Vector;
+    typedef DenseVector<Array<IndexType> >     IndexVector;
+
+    const Underscore<IndexType> _;
+
+    const IndexType n    = X.numRows();
+    const IndexType nRhs = X.numCols();
+
+    ASSERT(B.numRows()==n);
+    ASSERT(B.numCols()==nRhs);
+
+//
+//  Working copies are one-based.  Active columns are kept in front, perm(l)
+//  is the column of X that corresponds to column l (see blockcg).
+//
+    Matrix       Xa(n, nRhs, 1, 1), R(n, nRhs, 1, 1), Rs(n, nRhs, 1, 1),
+                 P(n, nRhs, 1, 1), S(n, nRhs, 1, 1),
+                 AP(n, nRhs, 1, 1), AS(n, nRhs, 1, 1);
+    Vector       alpha(nRhs), rNormSquare(nRhs);
+    IndexVector  perm(nRhs);
+    ElementType  beta, omega;
+
+    const ElementType One(1);
+
+    Xa = X;
+    R  = B;
+    AP = A*Xa;
+    R -= AP;
+    Rs = R;
+    P  = R;
+
+    for (IndexType l=1; l<=nRhs; ++l) {
+        perm(l) = X.firstCol()+l-1;
+    }
+
+    IndexType nActive = nRhs;
+
+    for (IndexType k=1; k<=maxIterations; k++) {
+
+        for (IndexType l=nActive; l>=1; --l) {
+            rNormSquare(l) = R(_,l)*R(_,l);
+            if (abs(rNormSquare(l))<=tol) {
+                if (l!=nActive) {
+                    blas::swap(Xa(_,l), Xa(_,nActive));
+                    blas::swap(R(_,l), R(_,nActive));
+                    blas::swap(Rs(_,l), Rs(_,nActive));
+                    blas::swap(P(_,l), P(_,nActive));
+                    std::swap(perm(l), perm(nActive));
+                }
+                --nActive;
+            }
+        }
+        if (nActive==0) {
+            break;
+        }
+
+        const Range<IndexType> active = _(1,nActive);
+
+        const MatrixView Pa  = P(_,active);
+        const MatrixView Sa  = S(_,active);
+        MatrixView       APa = AP(_,active);
+        MatrixView       ASa = AS(_,active);
+
+        APa = A*Pa;
+
+        for (IndexType l=1; l<=nActive; ++l) {
+            alpha(l) = (R(_,l)*Rs(_,l))/(AP(_,l)*Rs(_,l));
+            S(_,l)   = R(_,l);
+            blas::axpy(-alpha(l), AP(_,l), S(_,l));
+        }
+
+        ASa = A*Sa;
+
+        for (IndexType l=1; l<=nActive; ++l) {
+            omega = (AS(_,l)*S(_,l))/(AS(_,l)*AS(_,l));
+            blas::axpy(alpha(l), P(_,l), Xa(_,l));
+            blas::axpy(omega, S(_,l), Xa(_,l));
+            beta  = One/(R(_,l)*Rs(_,l));
+            R(_,l) = S(_,l);
+            blas::axpy(-omega, AS(_,l), R(_,l));
+            beta  = beta*alpha(l)*(R(_,l)*Rs(_,l))/omega;
+            blas::scal(beta, P(_,l));
+            blas::axpy(-beta*omega, AP(_,l), P(_,l));
+            blas::axpy(One, R(_,l), P(_,l));
+        }
+    }
+
+    for (IndexType l=1; l<=nRhs; ++l) {
+        X(_,perm(l)) = Xa(_,l);
+    }
+    return (nActive==0) ? 0 : maxIterations;
+}
+
+} }// namespace solver, flens
+
+#endif // PLAYGROUND_FLENS_SOLVER_BLOCKBICGSTAB_TCC
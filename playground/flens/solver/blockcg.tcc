@@ -0,0 +1,144 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn, Klaus Pototzky
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* Based on
+ *
+ * Yousef Saad - Iterative methods for sparse linear systems  (2nd edition)
+ * Algorithm 6.18, applied to all right-hand sides simultaneously
+ *
+ */
+
+#ifndef PLAYGROUND_FLENS_SOLVER_BLOCKCG_TCC
+#define PLAYGROUND_FLENS_SOLVER_BLOCKCG_TCC 1
+
+#include <cxxstd/cmath.h>
+#include <playground/flens/solver/blockcg.h>
+
+namespace flens { namespace solver {
+
+template <typename MA, typename MX, typename MB>
+    typename RestrictTo<IsSymmetricMatrix<MA>::value
+                     && IsGeMatrix<MX>::value
+                     && IsGeMatrix<MB>::value,
+             typename RemoveRef<MX>::Type::IndexType>::Type
+blockcg(const MA &A, MX &&X, const MB &B,
+        typename ComplexTrait<typename RemoveRef<MX>::Type::ElementType>::PrimitiveType tol,
+        typename RemoveRef<MX>::Type::IndexType maxIterations)
+{
+    using std::abs;
+
+    typedef typename RemoveRef<MX>::Type       MatrixX;
+    typedef typename MatrixX::NoView           Matrix;
+    typedef typename MatrixX::View             MatrixView;
+    typedef typename MatrixX::IndexType        IndexType;
+    typedef typename MatrixX::ElementType      ElementType;
+    typedef DenseVector<Array<ElementType> >   Vector;
+    typedef DenseVector<Array<IndexType> >     IndexVector;
+
+    const Underscore<IndexType> _;
+
+    const IndexType n    = X.numRows();
+    const IndexType nRhs = X.numCols();
+
+    ASSERT(B.numRows()==n);
+    ASSERT(B.numCols()==nRhs);
+
+//
+//  Working copies are one-based.  Columns of Xa, R, P get permuted such that
+//  the active (not yet converged) columns are always stored in front.
+//  perm(l) is the column of X that corresponds to column l.
+//
+    Matrix       Xa(n, nRhs, 1, 1), R(n, nRhs, 1, 1), P(n, nRhs, 1, 1),
+                 AP(n, nRhs, 1, 1);
+    Vector       rNormSquare(nRhs);
+    IndexVector  perm(nRhs);
+    ElementType  alpha, beta, rNormSquarePrev;
+
+    Xa = X;
+    R  = B;
+    AP = A*Xa;
+    R -= AP;
+    P  = R;
+
+    for (IndexType l=1; l<=nRhs; ++l) {
+        perm(l)        = X.firstCol()+l-1;
+        rNormSquare(l) = R(_,l)*R(_,l);
+    }
+
+    IndexType nActive = nRhs;
+
+    for (IndexType k=1; k<=maxIterations; k++) {
+
+        for (IndexType l=nActive; l>=1; --l) {
+            if (abs(rNormSquare(l))<=tol) {
+                if (l!=nActive) {
+                    blas::swap(Xa(_,l), Xa(_,nActive));
+                    blas::swap(R(_,l), R(_,nActive));
+                    blas::swap(P(_,l), P(_,nActive));
+                    std::swap(rNormSquare(l), rNormSquare(nActive));
+                    std::swap(perm(l), perm(nActive));
+                }
+                --nActive;
+            }
+        }
+        if (nActive==0) {
+            break;
+        }
+
+        const MatrixView Pa  = P(_,_(1,nActive));
+        MatrixView       APa = AP(_,_(1,nActive));
+
+        APa = A*Pa;
+
+        for (IndexType l=1; l<=nActive; ++l) {
+            alpha = rNormSquare(l)/(P(_,l)*AP(_,l));
+            blas::axpy(alpha, P(_,l), Xa(_,l));
+            blas::axpy(-alpha, AP(_,l), R(_,l));
+
+            rNormSquarePrev = rNormSquare(l);
+            rNormSquare(l)  = R(_,l)*R(_,l);
+
+            beta = rNormSquare(l)/rNormSquarePrev;
+            blas::scal(beta, P(_,l));
+            blas::axpy(ElementType(1), R(_,l), P(_,l));
+        }
+    }
+
+    for (IndexType l=1; l<=nRhs; ++l) {
+        X(_,perm(l)) = Xa(_,l);
+    }
+    return (nActive==0) ? 0 : maxIterations;
+}
+
+} }// namespace solver, flens
+
+#endif // PLAYGROUND_FLENS_SOLVER_BLOCKCG_TCC
@@ -34,6 +34,8 @@
 #define PLAYGROUND_FLENS_SOLVER_SOLVER_H 1
 
 #include<playground/flens/solver/bicgstab.h>
+#include<playground/flens/solver/blockbicgstab.h>
+#include<playground/flens/solver/blockcg.h>
 #include<playground/flens/solver/cg.h>
 #include<playground/flens/solver/cgs.h>
 #include<playground/flens/solver/pcg.h>
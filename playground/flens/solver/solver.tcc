@@ -34,6 +34,8 @@
 #define PLAYGROUND_FLENS_SOLVER_SOLVER_TCC 1
 
 #include<playground/flens/solver/bicgstab.tcc>
+#include<playground/flens/solver/blockbicgstab.tcc>
+#include<playground/flens/solver/blockcg.tcc>
 #include<playground/flens/solver/cg.tcc>
 #include<playground/flens/solver/cgs.tcc>
 #include<playground/flens/solver/pcg.tcc>
@@ -33,6 +33,8 @@
 #ifndef PLAYGROUND_FLENS_SPARSE_SPARSE_H
 #define PLAYGROUND_FLENS_SPARSE_SPARSE_H 1
 
+#include<playground/flens/sparse/supernodal/supernodal.h>
+
 #ifdef WITH_SUITESPARSE
 #    include<playground/flens/sparse/suitesparse/suitesparse.h>
 #endif
@@ -33,6 +33,8 @@
 #ifndef PLAYGROUND_FLENS_SPARSE_SPARSE_TCC
 #define PLAYGROUND_FLENS_SPARSE_SPARSE_TCC 1
 
+#include<playground/flens/sparse/supernodal/supernodal.tcc>
+
 #ifdef WITH_SUITESPARSE
 #    include<playground/flens/sparse/suitesparse/suitesparse.tcc>
 #endif
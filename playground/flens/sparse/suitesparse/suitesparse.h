@@ -34,5 +34,6 @@
 #define PLAYGROUND_FLENS_SPARSE_SUITESPARSE_H 1
 
 #include<playground/flens/sparse/suitesparse/sv.h>
+#include<playground/flens/sparse/suitesparse/umfpacklu.h>
 
 #endif // PLAYGROUND_FLENS_SPARSE_SUITESPARSE_H
@@ -34,5 +34,6 @@
 #define PLAYGROUND_FLENS_SPARSE_SUITESPARSE_TCC 1
 
 #include<playground/flens/sparse/suitesparse/sv.tcc>
+#include<playground/flens/sparse/suitesparse/umfpacklu.tcc>
 
 #endif // PLAYGROUND_FLENS_SPARSE_SUITESPARSE_TCC
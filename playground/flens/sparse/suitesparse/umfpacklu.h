@@ -0,0 +1,125 @@
+/*
+ *   Copyright (c) 2013, Klaus Pototzky
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PLAYGROUND_FLENS_SPARSE_SUITESPARSE_UMFPACKLU_H
+#define PLAYGROUND_FLENS_SPARSE_SUITESPARSE_UMFPACKLU_H 1
+
+#ifdef WITH_UMFPACK
+
+#include<cxxstd/complex.h>
+#include<cxxstd/vector.h>
+#include<flens/auxiliary/auxiliary.h>
+#include<flens/matrixtypes/matrixtypes.h>
+#include<flens/vectortypes/vectortypes.h>
+
+namespace flens { namespace suitesparse {
+
+//
+//  LU factorization of a GeCCSMatrix with a frozen sparsity pattern.
+//
+//  analyze(A) copies the pattern (shifted to index base 0) and runs the
+//  symbolic analysis once.  Each later factorize(A) only redoes the numeric
+//  phase, so matrices with new values on the same pattern (e.g. in time
+//  stepping) skip coordinate assembly, compression and symbolic analysis.
+//  Values can be updated in place through A(i,j) or an ElementLocator.
+//
+template <typename T>
+class UmfpackLU
+{
+    public:
+        typedef T       ElementType;
+        typedef int     IndexType;
+
+        UmfpackLU();
+
+        ~UmfpackLU();
+
+        template <typename MA>
+            typename RestrictTo<IsGeCCSMatrix<MA>::value,
+                                void>::Type
+            analyze(const MA &A);
+
+        // calls analyze(A) if no symbolic analysis is available
+        template <typename MA>
+            typename RestrictTo<IsGeCCSMatrix<MA>::value,
+                                void>::Type
+            factorize(const MA &A);
+
+        template <typename MX, typename MB>
+            typename RestrictTo<IsGeMatrix<MX>::value &&
+                                IsGeMatrix<MB>::value,
+                                void>::Type
+            solve(MX &&X, const MB &B) const;
+
+        template <typename VX, typename VB>
+            typename RestrictTo<IsDenseVector<VX>::value &&
+                                IsDenseVector<VB>::value,
+                                void>::Type
+            solve(VX &&x, const VB &b) const;
+
+        bool
+        analyzed() const;
+
+        bool
+        factorized() const;
+
+        // drop symbolic and numeric data
+        void
+        clear();
+
+    private:
+        // forbidden, the symbolic and numeric handles can not be shared
+        UmfpackLU(const UmfpackLU &rhs);
+
+        UmfpackLU &
+        operator=(const UmfpackLU &rhs);
+
+        void
+        umfSymbolic_();
+
+        void
+        umfNumeric_();
+
+        void
+        umfSolve_(ElementType *x, const ElementType *b) const;
+
+        IndexType                   n_;
+        std::vector<IndexType>      colPtr_, rowIdx_;
+        std::vector<ElementType>    values_;
+        void                        *symbolic_, *numeric_;
+};
+
+} } // namespace suitesparse, flens
+
+#endif // WITH_UMFPACK
+
+#endif // PLAYGROUND_FLENS_SPARSE_SUITESPARSE_UMFPACKLU_H
@@ -0,0 +1,307 @@
+/*
+ *   Copyright (c) 2013, Klaus Pototzky
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PLAYGROUND_FLENS_SPARSE_SUITESPARSE_UMFPACKLU_TCC
+#define PLAYGROUND_FLENS_SPARSE_SUITESPARSE_UMFPACKLU_TCC 1
+
+#ifdef WITH_UMFPACK
+
+#include <umfpack.h>
+
+namespace flens { namespace suitesparse {
+
+template <typename T>
+UmfpackLU<T>::UmfpackLU()
+    : n_(0), symbolic_(0), numeric_(0)
+{
+}
+
+template <typename T>
+UmfpackLU<T>::~UmfpackLU()
+{
+    clear();
+}
+
+template <typename T>
+template <typename MA>
+typename RestrictTo<IsGeCCSMatrix<MA>::value,
+                    void>::Type
+UmfpackLU<T>::analyze(const MA &A)
+{
+    typedef typename MA::IndexType  IndexTypeA;
+
+    ASSERT(A.numRows()==A.numCols());
+
+    clear();
+
+    const auto &cols = A.engine().cols();
+    const auto &rows = A.engine().rows();
+    const auto &vals = A.engine().values();
+
+    const IndexTypeA base = A.indexBase();
+    const IndexTypeA nnz  = A.engine().numNonZeros();
+
+//
+//  Keep a copy of the pattern with index base 0.  In contrast to sv(..) the
+//  matrix engine does not get shifted temporarily and A can be const.
+//
+    n_ = A.numCols();
+    colPtr_.resize(n_+1);
+    rowIdx_.resize(nnz);
+    values_.resize(nnz);
+
+    for (IndexType j=0; j<=n_; ++j) {
+        colPtr_[j] = cols(base+j) - base;
+    }
+    for (IndexType k=0; k<nnz; ++k) {
+        rowIdx_[k] = rows(base+k) - base;
+        values_[k] = vals(base+k);
+    }
+
+    umfSymbolic_();
+}
+
+template <typename T>
+template <typename MA>
+typename RestrictTo<IsGeCCSMatrix<MA>::value,
+                    void>::Type
+UmfpackLU<T>::factorize(const MA &A)
+{
+    typedef typename MA::IndexType  IndexTypeA;
+
+    if (!symbolic_) {
+        analyze(A);
+    } else {
+        // pattern is frozen: only the values may have changed
+        ASSERT(A.numCols()==n_);
+        ASSERT(A.engine().numNonZeros()==IndexTypeA(values_.size()));
+
+        const auto &vals = A.engine().values();
+        const IndexTypeA base = A.indexBase();
+        for (std::size_t k=0; k<values_.size(); ++k) {
+            values_[k] = vals(base+k);
+        }
+    }
+    umfNumeric_();
+}
+
+template <typename T>
+template <typename MX, typename MB>
+typename RestrictTo<IsGeMatrix<MX>::value &&
+                    IsGeMatrix<MB>::value,
+                    void>::Type
+UmfpackLU<T>::solve(MX &&X, const MB &B) const
+{
+    typedef typename RemoveRef<MX>::Type    MatrixX;
+    typedef typename MatrixX::IndexType     IndexTypeX;
+
+    ASSERT(factorized());
+    ASSERT(B.order()==ColMajor);
+    ASSERT(B.numRows()==n_);
+
+    if (X.numRows()==IndexTypeX(0) || X.numCols()==IndexTypeX(0)) {
+        X.resize(B.numRows(), B.numCols(), B.firstRow(), B.firstCol());
+    }
+
+    ASSERT(X.order()==ColMajor);
+    ASSERT(X.numRows()==B.numRows());
+    ASSERT(X.numCols()==B.numCols());
+
+    for (IndexTypeX j=0; j<B.numCols(); ++j) {
+        umfSolve_(X.data() + j*X.leadingDimension(),
+                  B.data() + j*B.leadingDimension());
+    }
+}
+
+template <typename T>
+template <typename VX, typename VB>
+typename RestrictTo<IsDenseVector<VX>::value &&
+                    IsDenseVector<VB>::value,
+                    void>::Type
+UmfpackLU<T>::solve(VX &&x, const VB &b) const
+{
+    typedef typename RemoveRef<VX>::Type    VectorX;
+    typedef typename VectorX::IndexType     IndexTypeX;
+
+    ASSERT(factorized());
+    ASSERT(b.length()==n_);
+
+    if (x.length()==IndexTypeX(0)) {
+        x.resize(b.length(), b.firstIndex());
+    }
+    ASSERT(x.length()==b.length());
+    ASSERT(x.stride()==1);
+    ASSERT(b.stride()==1);
+
+    umfSolve_(x.data(), b.data());
+}
+
+template <typename T>
+bool
+UmfpackLU<T>::analyzed() const
+{
+    return symbolic_!=0;
+}
+
+template <typename T>
+bool
+UmfpackLU<T>::factorized() const
+{
+    return numeric_!=0;
+}
+
+//-- real ----------------------------------------------------------------------
+
+template <>
+inline void
+UmfpackLU<double>::clear()
+{
+    if (numeric_) {
+        umfpack_di_free_numeric(&numeric_);
+    }
+    if (symbolic_) {
+        umfpack_di_free_symbolic(&symbolic_);
+    }
+    numeric_  = 0;
+    symbolic_ = 0;
+}
+
+template <>
+inline void
+UmfpackLU<double>::umfSymbolic_()
+{
+    int status = umfpack_di_symbolic(n_, n_,
+                                     colPtr_.data(), rowIdx_.data(),
+                                     values_.data(),
+                                     &symbolic_,
+                                     NULL, NULL);
+    ASSERT(status==UMFPACK_OK);
+}
+
+template <>
+inline void
+UmfpackLU<double>::umfNumeric_()
+{
+    if (numeric_) {
+        umfpack_di_free_numeric(&numeric_);
+    }
+    int status = umfpack_di_numeric(colPtr_.data(), rowIdx_.data(),
+                                    values_.data(),
+                                    symbolic_,
+                                    &numeric_,
+                                    NULL, NULL);
+    ASSERT(status==UMFPACK_OK);
+}
+
+template <>
+inline void
+UmfpackLU<double>::umfSolve_(double *x, const double *b) const
+{
+    int status = umfpack_di_solve(UMFPACK_A,
+                                  colPtr_.data(), rowIdx_.data(),
+                                  values_.data(),
+                                  x, b,
+                                  numeric_,
+                                  NULL, NULL);
+    ASSERT(status==UMFPACK_OK);
+}
+
+//-- complex -------------------------------------------------------------------
+
+template <>
+inline void
+UmfpackLU<std::complex<double> >::clear()
+{
+    if (numeric_) {
+        umfpack_zi_free_numeric(&numeric_);
+    }
+    if (symbolic_) {
+        umfpack_zi_free_symbolic(&symbolic_);
+    }
+    numeric_  = 0;
+    symbolic_ = 0;
+}
+
+template <>
+inline void
+UmfpackLU<std::complex<double> >::umfSymbolic_()
+{
+    int status = umfpack_zi_symbolic(n_, n_,
+                                     colPtr_.data(), rowIdx_.data(),
+                                     reinterpret_cast<const double *>(
+                                                            values_.data()),
+                                     NULL,
+                                     &symbolic_,
+                                     NULL, NULL);
+    ASSERT(status==UMFPACK_OK);
+}
+
+template <>
+inline void
+UmfpackLU<std::complex<double> >::umfNumeric_()
+{
+    if (numeric_) {
+        umfpack_zi_free_numeric(&numeric_);
+    }
+    int status = umfpack_zi_numeric(colPtr_.data(), rowIdx_.data(),
+                                    reinterpret_cast<const double *>(
+                                                            values_.data()),
+                                    NULL,
+                                    symbolic_,
+                                    &numeric_,
+                                    NULL, NULL);
+    ASSERT(status==UMFPACK_OK);
+}
+
+template <>
+inline void
+UmfpackLU<std::complex<double> >::umfSolve_(std::complex<double> *x,
+                                            const std::complex<double> *b)
+                                                                        const
+{
+    int status = umfpack_zi_solve(UMFPACK_A,
+                                  colPtr_.data(), rowIdx_.data(),
+                                  reinterpret_cast<const double *>(
+                                                            values_.data()),
+                                  NULL,
+                                  reinterpret_cast<double *>(x), NULL,
+                                  reinterpret_cast<const double *>(b), NULL,
+                                  numeric_,
+                                  NULL, NULL);
+    ASSERT(status==UMFPACK_OK);
+}
+
+} } // namespace suitesparse, flens
+
+#endif // WITH_UMFPACK
+
+#endif // PLAYGROUND_FLENS_SPARSE_SUITESPARSE_UMFPACKLU_TCC
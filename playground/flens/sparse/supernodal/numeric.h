@@ -0,0 +1,100 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn, Klaus Pototzky
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PLAYGROUND_FLENS_SPARSE_SUPERNODAL_NUMERIC_H
+#define PLAYGROUND_FLENS_SPARSE_SUPERNODAL_NUMERIC_H 1
+
+#include <cxxstd/vector.h>
+
+#include <flens/auxiliary/auxiliary.h>
+#include <flens/matrixtypes/matrixtypes.h>
+#include <flens/vectortypes/vectortypes.h>
+#include <playground/flens/sparse/supernodal/symbolic.h>
+
+namespace flens { namespace supernodal {
+
+enum Factorization {
+    Cholesky,       // P*A*P^T = L*L^T   (A real, positive definite)
+    LDLT            // P*A*P^T = L*D*L^T (no pivoting, L unit lower)
+};
+
+//
+//  Numeric factor.  For each supernode s the dense panel L[s] has the
+//  rows S.rows[S.rowPtr[s]],... and the columns S.superPtr[s],... of L.  For
+//  LDLT the diagonal of the panel holds D.
+//
+template <typename T, typename IndexType>
+struct Numeric
+{
+    typedef GeMatrix<FullStorage<T, ColMajor> >   Matrix;
+
+    Numeric(Factorization factorization = Cholesky);
+
+    Factorization          factorization;
+    std::vector<Matrix>    L;
+};
+
+//
+//  Computes the numeric factorization of A based on the symbolic analysis S.
+//  Only values of A get accessed so S can be reused as long as the pattern
+//  of A does not change.  Returns 0 on success and otherwise the (one-based)
+//  position in P*A*P^T of the first pivot that was not positive (Cholesky)
+//  or zero (LDLT).
+//
+template <typename MA, typename T, typename IndexType>
+    typename RestrictTo<IsSyCRSMatrix<MA>::value
+                     || IsSyCCSMatrix<MA>::value,
+             IndexType>::Type
+    factorize(const MA                    &A,
+              const Symbolic<IndexType>   &S,
+              Numeric<T, IndexType>       &N);
+
+//
+//  Overwrites B with the solution of A*X = B.
+//
+template <typename T, typename IndexType, typename MB>
+    typename RestrictTo<IsGeMatrix<MB>::value,
+             void>::Type
+    solve(const Symbolic<IndexType>      &S,
+          const Numeric<T, IndexType>    &N,
+          MB                             &&B);
+
+template <typename T, typename IndexType, typename VB>
+    typename RestrictTo<IsDenseVector<VB>::value,
+             void>::Type
+    solve(const Symbolic<IndexType>      &S,
+          const Numeric<T, IndexType>    &N,
+          VB                             &&b);
+
+} } // namespace supernodal, flens
+
+#endif // PLAYGROUND_FLENS_SPARSE_SUPERNODAL_NUMERIC_H
@@ -0,0 +1,452 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn, Klaus Pototzky
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* Based on
+ *
+ * Joseph W. H. Liu - The multifrontal method for sparse matrix solution:
+ * Theory and practice, SIAM Review 34 (1992)
+ *
+ */
+
+#ifndef PLAYGROUND_FLENS_SPARSE_SUPERNODAL_NUMERIC_TCC
+#define PLAYGROUND_FLENS_SPARSE_SUPERNODAL_NUMERIC_TCC 1
+
+#include <cxxstd/algorithm.h>
+#include <flens/blas/blas.h>
+#include <flens/lapack/lapack.h>
+#include <playground/flens/sparse/supernodal/numeric.h>
+#include <playground/flens/sparse/supernodal/symbolic.tcc>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace flens { namespace supernodal {
+
+template <typename T, typename IndexType>
+Numeric<T, IndexType>::Numeric(Factorization factorization_)
+    : factorization(factorization_)
+{
+}
+
+//-- auxiliary functions -------------------------------------------------------
+
+//
+//  Factorizes the first nc columns of the frontal matrix F and computes the
+//  Schur complement in its trailing part.  Only the lower triangle of F gets
+//  referenced.
+//
+template <typename MF>
+typename RestrictTo<IsReal<typename MF::ElementType>::value,
+         typename MF::IndexType>::Type
+potrfFront_(typename MF::IndexType nc, MF &F)
+{
+    typedef typename MF::ElementType  T;
+    typedef typename MF::IndexType    IndexType;
+
+    const Underscore<IndexType> _;
+    const IndexType m = F.numRows();
+    const T         One(1);
+
+    IndexType info = lapack::potrf(F(_(1,nc),_(1,nc)).lower().symmetric());
+    if (info!=0) {
+        return info;
+    }
+    if (m>nc) {
+        const auto L11 = F(_(1,nc),_(1,nc)).lower();
+        auto       L21 = F(_(nc+1,m),_(1,nc));
+        auto       F22 = F(_(nc+1,m),_(nc+1,m)).lower().symmetric();
+
+        blas::sm(Right, Trans, One, L11, L21);
+        blas::rk(NoTrans, -One, L21, One, F22);
+    }
+    return 0;
+}
+
+template <typename MF>
+typename RestrictTo<!IsReal<typename MF::ElementType>::value,
+         typename MF::IndexType>::Type
+potrfFront_(typename MF::IndexType, MF &)
+{
+//  Cholesky is only supported for real symmetric matrices
+    ASSERT(0);
+    return 0;
+}
+
+template <typename MF>
+typename MF::IndexType
+ldltFront_(typename MF::IndexType nc, MF &F)
+{
+    typedef typename MF::ElementType  T;
+    typedef typename MF::IndexType    IndexType;
+    typedef typename MF::NoView       Matrix;
+
+    const Underscore<IndexType> _;
+    const IndexType m = F.numRows();
+    const T         Zero(0), One(1);
+//
+//  Unblocked right-looking LDL^T on the panel
+//
+    for (IndexType k=1; k<=nc; ++k) {
+        const T d = F(k,k);
+        if (d==Zero) {
+            return k;
+        }
+        for (IndexType j=k+1; j<=nc; ++j) {
+            blas::axpy(-F(j,k)/d, F(_(j,m),k), F(_(j,m),j));
+        }
+        if (k<m) {
+            blas::scal(One/d, F(_(k+1,m),k));
+        }
+    }
+//
+//  F22 = F22 - L21*D*L21^T
+//
+    if (m>nc) {
+        const auto L21 = F(_(nc+1,m),_(1,nc));
+        auto       F22 = F(_(nc+1,m),_(nc+1,m));
+
+        Matrix W = L21;
+        for (IndexType k=1; k<=nc; ++k) {
+            blas::scal(F(k,k), W(_,k));
+        }
+        blas::mm(NoTrans, Trans, -One, W, L21, One, F22);
+    }
+    return 0;
+}
+
+//
+//  Assembles, factorizes and stores the front of supernode s.  The update
+//  matrices of its children get released.
+//
+template <typename T, typename IndexType>
+IndexType
+factorizeFront_(IndexType                                             s,
+                const Symbolic<IndexType>                             &S,
+                const std::vector<T>                                  &Ax,
+                Numeric<T, IndexType>                                 &N,
+                std::vector<typename Numeric<T, IndexType>::Matrix>   &update)
+{
+    typedef typename Numeric<T, IndexType>::Matrix  Matrix;
+    typedef typename Matrix::IndexType              MIndexType;
+
+    const Underscore<MIndexType> _;
+
+    const IndexType first = S.superPtr[s];
+    const IndexType last  = S.superPtr[s+1]-1;
+    const IndexType nc    = last-first+1;
+    const IndexType *R    = &S.rows[S.rowPtr[s]];
+    const IndexType m     = S.rowPtr[s+1]-S.rowPtr[s];
+
+    Matrix F(m, m);
+//
+//  Entries of A.  Rows are sorted in both, the columns of A and R.
+//
+    for (IndexType j=first; j<=last; ++j) {
+        IndexType r = j-first;
+        for (IndexType p=S.colPtr[j]; p<S.colPtr[j+1]; ++p) {
+            while (R[r]!=S.rowIdx[p]) {
+                ++r;
+            }
+            F(r+1, j-first+1) += Ax[p];
+        }
+    }
+//
+//  Extend-add of the children's update matrices
+//
+    std::vector<IndexType> rel;
+    for (IndexType q=S.childPtr[s]; q<S.childPtr[s+1]; ++q) {
+        const IndexType c   = S.children[q];
+        const IndexType ncc = S.superPtr[c+1]-S.superPtr[c];
+        const IndexType *Rc = &S.rows[S.rowPtr[c]] + ncc;
+        const IndexType mu  = S.rowPtr[c+1]-S.rowPtr[c]-ncc;
+
+        rel.resize(mu);
+        for (IndexType a=0, r=0; a<mu; ++a) {
+            while (R[r]!=Rc[a]) {
+                ++r;
+            }
+            rel[a] = r+1;
+        }
+
+        const Matrix &U = update[c];
+        for (IndexType b=0; b<mu; ++b) {
+            for (IndexType a=b; a<mu; ++a) {
+                F(rel[a], rel[b]) += U(a+1, b+1);
+            }
+        }
+        update[c].resize(0, 0);
+    }
+
+    const IndexType info = (N.factorization==Cholesky) ? potrfFront_(nc, F)
+                                                       : ldltFront_(nc, F);
+    if (info!=0) {
+        return first+info;
+    }
+
+    N.L[s] = F(_,_(1,nc));
+    if (m>nc) {
+        update[s] = F(_(nc+1,m),_(nc+1,m));
+    }
+    return 0;
+}
+
+//-- factorize -----------------------------------------------------------------
+
+template <typename MA, typename T, typename IndexType>
+typename RestrictTo<IsSyCRSMatrix<MA>::value
+                 || IsSyCCSMatrix<MA>::value,
+         IndexType>::Type
+factorize(const MA                    &A,
+          const Symbolic<IndexType>   &S,
+          Numeric<T, IndexType>       &N)
+{
+    typedef typename Numeric<T, IndexType>::Matrix  Matrix;
+
+    ASSERT(A.dim()==S.n);
+    ASSERT(A.engine().values().length()==S.numNonZeros);
+
+    const IndexType ns = S.numSupernodes();
+//
+//  Values of the permuted lower triangle.  This is the only place where A
+//  gets accessed.
+//
+    const auto *values = A.engine().values().data();
+
+    std::vector<T> Ax(S.valueIndex.size());
+    for (std::size_t p=0; p<Ax.size(); ++p) {
+        Ax[p] = values[S.valueIndex[p]];
+    }
+
+    N.L.resize(ns);
+    std::vector<Matrix> update(ns);
+//
+//  Independent subtrees of the supernodal elimination tree get factorized in
+//  parallel.  A subtree gets split as long as it contains more than a
+//  fraction of the total work and has children.  Remaining supernodes near
+//  the roots ('top') get factorized afterwards.
+//
+    int numThreads = 1;
+#   ifdef _OPENMP
+    numThreads = omp_get_max_threads();
+#   endif
+
+    std::vector<double> work(ns);
+    double totalWork = 0;
+    for (IndexType s=0; s<ns; ++s) {
+        const double nc = S.superPtr[s+1]-S.superPtr[s];
+        const double m  = S.rowPtr[s+1]-S.rowPtr[s];
+        work[s]   += nc*m*m;
+        totalWork += nc*m*m;
+        if (S.superParent[s]!=-1) {
+            work[S.superParent[s]] += work[s];
+        }
+    }
+
+    const double maxWork = (numThreads>1) ? totalWork/(4*numThreads)
+                                          : totalWork;
+
+    std::vector<IndexType>  subtrees, top, candidates;
+    for (IndexType s=0; s<ns; ++s) {
+        if (S.superParent[s]==-1) {
+            candidates.push_back(s);
+        }
+    }
+    while (!candidates.empty()) {
+        const IndexType s = candidates.back();
+        candidates.pop_back();
+        if (work[s]<=maxWork || S.childPtr[s]==S.childPtr[s+1]) {
+            subtrees.push_back(s);
+        } else {
+            top.push_back(s);
+            for (IndexType q=S.childPtr[s]; q<S.childPtr[s+1]; ++q) {
+                candidates.push_back(S.children[q]);
+            }
+        }
+    }
+    std::sort(top.begin(), top.end());
+
+    IndexType info = 0;
+
+#   ifdef _OPENMP
+#   pragma omp parallel for schedule(dynamic)
+#   endif
+    for (IndexType q=0; q<IndexType(subtrees.size()); ++q) {
+        const IndexType root = subtrees[q];
+        for (IndexType s=S.firstDesc[root]; s<=root; ++s) {
+            const IndexType i = factorizeFront_(s, S, Ax, N, update);
+            if (i!=0) {
+#               ifdef _OPENMP
+#               pragma omp critical
+#               endif
+                if (info==0 || i<info) {
+                    info = i;
+                }
+                break;
+            }
+        }
+    }
+//
+//  Supernodes in 'top' can precede a failed subtree.  They get factorized
+//  as long as their columns come before the failed pivot such that info
+//  is the first one.  Ancestors of a failed subtree never qualify.
+//
+    for (std::size_t q=0; q<top.size(); ++q) {
+        if (info!=0 && S.superPtr[top[q]]>=info) {
+            break;
+        }
+        const IndexType i = factorizeFront_(top[q], S, Ax, N, update);
+        if (i!=0) {
+            info = i;
+            break;
+        }
+    }
+    return info;
+}
+
+//-- solve ---------------------------------------------------------------------
+
+template <typename T, typename IndexType, typename MB>
+typename RestrictTo<IsGeMatrix<MB>::value,
+         void>::Type
+solve(const Symbolic<IndexType>      &S,
+      const Numeric<T, IndexType>    &N,
+      MB                             &&B)
+{
+    typedef typename Numeric<T, IndexType>::Matrix  Matrix;
+    typedef typename Matrix::IndexType              MIndexType;
+
+    const Underscore<MIndexType> _;
+
+    const IndexType n    = S.n;
+    const IndexType nRhs = B.numCols();
+    const IndexType ns   = S.numSupernodes();
+    const T         One(1);
+
+    ASSERT(B.numRows()==n);
+//
+//  Y = P*B
+//
+    Matrix Y(n, nRhs), W;
+    for (IndexType k=0; k<n; ++k) {
+        Y(k+1,_) = B(B.firstRow()+S.perm[k],_);
+    }
+//
+//  Forward substitution
+//
+    for (IndexType s=0; s<ns; ++s) {
+        const IndexType first = S.superPtr[s];
+        const IndexType nc    = S.superPtr[s+1]-first;
+        const IndexType *R    = &S.rows[S.rowPtr[s]];
+        const IndexType m     = S.rowPtr[s+1]-S.rowPtr[s];
+
+        const auto L11 = N.L[s](_(1,nc),_(1,nc));
+        auto       Ys  = Y(_(first+1,first+nc),_);
+
+        if (N.factorization==Cholesky) {
+            blas::sm(Left, NoTrans, One, L11.lower(), Ys);
+        } else {
+            blas::sm(Left, NoTrans, One, L11.lowerUnit(), Ys);
+        }
+        if (m>nc) {
+            W.resize(m-nc, nRhs);
+            W = N.L[s](_(nc+1,m),_) * Ys;
+            for (IndexType a=nc; a<m; ++a) {
+                Y(R[a]+1,_) -= W(a-nc+1,_);
+            }
+        }
+    }
+//
+//  Diagonal
+//
+    if (N.factorization==LDLT) {
+        for (IndexType s=0; s<ns; ++s) {
+            const IndexType first = S.superPtr[s];
+            for (IndexType k=1; k<=S.superPtr[s+1]-first; ++k) {
+                blas::scal(One/N.L[s](k,k), Y(first+k,_));
+            }
+        }
+    }
+//
+//  Backward substitution
+//
+    for (IndexType s=ns-1; s>=0; --s) {
+        const IndexType first = S.superPtr[s];
+        const IndexType nc    = S.superPtr[s+1]-first;
+        const IndexType *R    = &S.rows[S.rowPtr[s]];
+        const IndexType m     = S.rowPtr[s+1]-S.rowPtr[s];
+
+        const auto L11 = N.L[s](_(1,nc),_(1,nc));
+        auto       Ys  = Y(_(first+1,first+nc),_);
+
+        if (m>nc) {
+            W.resize(m-nc, nRhs);
+            for (IndexType a=nc; a<m; ++a) {
+                W(a-nc+1,_) = Y(R[a]+1,_);
+            }
+            blas::mm(Trans, NoTrans, -One, N.L[s](_(nc+1,m),_), W, One, Ys);
+        }
+        if (N.factorization==Cholesky) {
+            blas::sm(Left, Trans, One, L11.lower(), Ys);
+        } else {
+            blas::sm(Left, Trans, One, L11.lowerUnit(), Ys);
+        }
+    }
+//
+//  B = P^T*Y
+//
+    for (IndexType k=0; k<n; ++k) {
+        B(B.firstRow()+S.perm[k],_) = Y(k+1,_);
+    }
+}
+
+template <typename T, typename IndexType, typename VB>
+typename RestrictTo<IsDenseVector<VB>::value,
+         void>::Type
+solve(const Symbolic<IndexType>      &S,
+      const Numeric<T, IndexType>    &N,
+      VB                             &&b)
+{
+    typedef typename RemoveRef<VB>::Type    VectorB;
+    typedef typename VectorB::ElementType   ElementType;
+
+    ASSERT(b.stride()==1);
+
+    const IndexType n = b.length();
+    GeMatrix<FullStorageView<ElementType, ColMajor> >  B(n, 1, b, n);
+
+    solve(S, N, B);
+}
+
+} } // namespace supernodal, flens
+
+#endif // PLAYGROUND_FLENS_SPARSE_SUPERNODAL_NUMERIC_TCC
@@ -0,0 +1,62 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn, Klaus Pototzky
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PLAYGROUND_FLENS_SPARSE_SUPERNODAL_ORDERING_H
+#define PLAYGROUND_FLENS_SPARSE_SUPERNODAL_ORDERING_H 1
+
+#include <cxxstd/vector.h>
+
+namespace flens { namespace supernodal {
+
+enum Ordering {
+    Natural,
+    MinimumDegree,
+    NestedDissection
+};
+
+//
+//  Computes a fill-reducing permutation for the symmetric pattern given as
+//  adjacency graph (xadj, adj).  Indices are zero-based, self-loops must not
+//  be contained.  On exit perm[k] is the vertex that gets eliminated in
+//  step k.
+//
+template <typename IndexType>
+    void
+    order(Ordering                       ordering,
+          IndexType                      n,
+          const std::vector<IndexType>   &xadj,
+          const std::vector<IndexType>   &adj,
+          std::vector<IndexType>         &perm);
+
+} } // namespace supernodal, flens
+
+#endif // PLAYGROUND_FLENS_SPARSE_SUPERNODAL_ORDERING_H
@@ -0,0 +1,402 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn, Klaus Pototzky
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* Based on
+ *
+ * Alan George, Joseph W. H. Liu - Computer Solution of Large Sparse Positive
+ * Definite Systems, Chapters 5 and 8 (minimum degree, automatic nested
+ * dissection)
+ *
+ */
+
+#ifndef PLAYGROUND_FLENS_SPARSE_SUPERNODAL_ORDERING_TCC
+#define PLAYGROUND_FLENS_SPARSE_SUPERNODAL_ORDERING_TCC 1
+
+#include <cxxstd/algorithm.h>
+#include <cxxstd/cstddef.h>
+#include <cxxstd/vector.h>
+#include <playground/flens/sparse/supernodal/ordering.h>
+
+namespace flens { namespace supernodal {
+
+//
+//  Minimum degree on the explicit elimination graph.  Vertices with equal
+//  degree are kept in doubly linked buckets.
+//
+template <typename IndexType>
+void
+minimumDegree_(IndexType                      n,
+               const std::vector<IndexType>   &xadj,
+               const std::vector<IndexType>   &adj,
+               std::vector<IndexType>         &perm)
+{
+    std::vector<std::vector<IndexType> >  g(n);
+    std::vector<IndexType>                degree(n), head(n+1, -1),
+                                          next(n), prev(n), nb;
+    std::vector<std::size_t>              mark(n, 0);
+    std::vector<char>                     eliminated(n, 0);
+    std::size_t                           stamp = 0;
+
+    perm.resize(n);
+
+    for (IndexType v=0; v<n; ++v) {
+        g[v].assign(adj.begin()+xadj[v], adj.begin()+xadj[v+1]);
+        degree[v] = g[v].size();
+
+        next[v] = head[degree[v]];
+        prev[v] = -1;
+        if (head[degree[v]]!=-1) {
+            prev[head[degree[v]]] = v;
+        }
+        head[degree[v]] = v;
+    }
+
+    IndexType minDegree = 0;
+
+    for (IndexType k=0; k<n; ++k) {
+        while (head[minDegree]==-1) {
+            ++minDegree;
+        }
+//
+//      Eliminate v and remove it from its bucket
+//
+        const IndexType v = head[minDegree];
+        head[minDegree] = next[v];
+        if (next[v]!=-1) {
+            prev[next[v]] = -1;
+        }
+        eliminated[v] = 1;
+        perm[k] = v;
+
+        nb.clear();
+        for (std::size_t p=0; p<g[v].size(); ++p) {
+            if (!eliminated[g[v][p]]) {
+                nb.push_back(g[v][p]);
+            }
+        }
+        std::vector<IndexType>().swap(g[v]);
+//
+//      The remaining neighbours of v become a clique
+//
+        for (std::size_t q=0; q<nb.size(); ++q) {
+            const IndexType u = nb[q];
+
+            if (prev[u]!=-1) {
+                next[prev[u]] = next[u];
+            } else {
+                head[degree[u]] = next[u];
+            }
+            if (next[u]!=-1) {
+                prev[next[u]] = prev[u];
+            }
+
+            ++stamp;
+            mark[u] = stamp;
+
+            std::vector<IndexType> gu;
+            gu.reserve(g[u].size()+nb.size());
+            for (std::size_t p=0; p<g[u].size(); ++p) {
+                const IndexType w = g[u][p];
+                if (!eliminated[w] && mark[w]!=stamp) {
+                    mark[w] = stamp;
+                    gu.push_back(w);
+                }
+            }
+            for (std::size_t p=0; p<nb.size(); ++p) {
+                const IndexType w = nb[p];
+                if (mark[w]!=stamp) {
+                    mark[w] = stamp;
+                    gu.push_back(w);
+                }
+            }
+            g[u].swap(gu);
+            degree[u] = g[u].size();
+
+            next[u] = head[degree[u]];
+            prev[u] = -1;
+            if (head[degree[u]]!=-1) {
+                prev[head[degree[u]]] = u;
+            }
+            head[degree[u]] = u;
+
+            minDegree = std::min(minDegree, degree[u]);
+        }
+    }
+}
+
+//
+//  Breadth first search restricted to vertices v with part[v]==tag.  Returns
+//  the number of levels, visited vertices are stored level by level in
+//  'queue'.
+//
+template <typename IndexType>
+IndexType
+levelStructure_(IndexType                      root,
+                IndexType                      tag,
+                const std::vector<IndexType>   &xadj,
+                const std::vector<IndexType>   &adj,
+                const std::vector<IndexType>   &part,
+                std::vector<IndexType>         &level,
+                std::vector<IndexType>         &queue)
+{
+    queue.clear();
+    queue.push_back(root);
+    level[root] = 0;
+
+    IndexType numLevels = 1;
+    for (std::size_t i=0; i<queue.size(); ++i) {
+        const IndexType v = queue[i];
+        for (IndexType p=xadj[v]; p<xadj[v+1]; ++p) {
+            const IndexType w = adj[p];
+            if (part[w]==tag && level[w]<0) {
+                level[w]  = level[v]+1;
+                numLevels = level[w]+1;
+                queue.push_back(w);
+            }
+        }
+    }
+    return numLevels;
+}
+
+//
+//  Automatic nested dissection:  each part gets split by the middle level of
+//  a level structure rooted at a pseudo-peripheral vertex.  Separators are
+//  numbered last.  Parts below 'minPartSize' get ordered by minimum degree.
+//
+template <typename IndexType>
+void
+nestedDissection_(IndexType                      n,
+                  const std::vector<IndexType>   &xadj,
+                  const std::vector<IndexType>   &adj,
+                  std::vector<IndexType>         &perm,
+                  IndexType                      minPartSize = 64)
+{
+    struct Part {
+        std::vector<IndexType>  vertices;
+        IndexType               tag, offset;
+    };
+
+    std::vector<IndexType>  part(n, 0), level(n, -1), queue, local(n, -1);
+    std::vector<Part>       stack(1);
+    IndexType               numTags = 1;
+
+    perm.resize(n);
+
+    stack[0].vertices.resize(n);
+    for (IndexType v=0; v<n; ++v) {
+        stack[0].vertices[v] = v;
+    }
+    stack[0].tag    = 0;
+    stack[0].offset = 0;
+
+    while (!stack.empty()) {
+        Part P;
+        P.vertices.swap(stack.back().vertices);
+        P.tag    = stack.back().tag;
+        P.offset = stack.back().offset;
+        stack.pop_back();
+
+        const IndexType size = P.vertices.size();
+
+        IndexType numLevels = 0;
+        if (size>minPartSize) {
+//
+//          Find a pseudo-peripheral vertex
+//
+            IndexType root = P.vertices[0];
+            for (int it=0; it<5; ++it) {
+                const IndexType nl = levelStructure_(root, P.tag, xadj, adj,
+                                                     part, level, queue);
+                IndexType last = queue.back();
+                for (IndexType i=queue.size()-1;
+                     i>=0 && level[queue[i]]==nl-1; --i)
+                {
+                    if (xadj[queue[i]+1]-xadj[queue[i]]
+                      < xadj[last+1]-xadj[last])
+                    {
+                        last = queue[i];
+                    }
+                }
+                for (std::size_t i=0; i<queue.size(); ++i) {
+                    level[queue[i]] = -1;
+                }
+                if (nl<=numLevels) {
+                    break;
+                }
+                numLevels = nl;
+                root      = last;
+            }
+            numLevels = levelStructure_(root, P.tag, xadj, adj,
+                                        part, level, queue);
+        }
+
+        if (numLevels<3) {
+//
+//          Order this part by minimum degree on its induced subgraph
+//
+            for (std::size_t i=0; i<queue.size(); ++i) {
+                level[queue[i]] = -1;
+            }
+            std::vector<IndexType> sxadj(size+1, 0), sadj, sperm;
+            for (IndexType i=0; i<size; ++i) {
+                local[P.vertices[i]] = i;
+            }
+            for (IndexType i=0; i<size; ++i) {
+                const IndexType v = P.vertices[i];
+                for (IndexType p=xadj[v]; p<xadj[v+1]; ++p) {
+                    if (part[adj[p]]==P.tag) {
+                        sadj.push_back(local[adj[p]]);
+                    }
+                }
+                sxadj[i+1] = sadj.size();
+            }
+            minimumDegree_(size, sxadj, sadj, sperm);
+            for (IndexType i=0; i<size; ++i) {
+                perm[P.offset+i] = P.vertices[sperm[i]];
+                part[P.vertices[i]] = -1;
+            }
+            continue;
+        }
+//
+//      Separator is the first level where at least half of the reached
+//      vertices are covered.
+//
+        IndexType sep = 1;
+        {
+            IndexType count = 0;
+            const IndexType half = queue.size()/2;
+            for (std::size_t i=0; i<queue.size(); ++i) {
+                ++count;
+                if (count>=half) {
+                    sep = level[queue[i]];
+                    break;
+                }
+            }
+            sep = std::max(IndexType(1), std::min(sep, numLevels-2));
+        }
+
+        Part A, B;
+        std::vector<IndexType> S;
+
+        A.tag = numTags++;
+        B.tag = numTags++;
+
+        for (std::size_t i=0; i<queue.size(); ++i) {
+            const IndexType v = queue[i];
+            if (level[v]<sep) {
+                A.vertices.push_back(v);
+            } else if (level[v]>sep) {
+                B.vertices.push_back(v);
+            } else {
+//
+//              Separator vertices without neighbours in the next level
+//              can be moved to A
+//
+                bool needed = false;
+                for (IndexType p=xadj[v]; p<xadj[v+1]; ++p) {
+                    const IndexType w = adj[p];
+                    if (part[w]==P.tag && level[w]==sep+1) {
+                        needed = true;
+                        break;
+                    }
+                }
+                if (needed) {
+                    S.push_back(v);
+                } else {
+                    A.vertices.push_back(v);
+                }
+            }
+        }
+        for (IndexType i=0; i<size; ++i) {
+            const IndexType v = P.vertices[i];
+            if (level[v]<0) {
+                B.vertices.push_back(v);
+            }
+        }
+        for (std::size_t i=0; i<queue.size(); ++i) {
+            level[queue[i]] = -1;
+        }
+
+        for (std::size_t i=0; i<A.vertices.size(); ++i) {
+            part[A.vertices[i]] = A.tag;
+        }
+        for (std::size_t i=0; i<B.vertices.size(); ++i) {
+            part[B.vertices[i]] = B.tag;
+        }
+        for (std::size_t i=0; i<S.size(); ++i) {
+            part[S[i]] = -1;
+            perm[P.offset+size-S.size()+i] = S[i];
+        }
+
+        A.offset = P.offset;
+        B.offset = P.offset + A.vertices.size();
+
+        if (B.vertices.size()>0) {
+            stack.push_back(Part());
+            stack.back().vertices.swap(B.vertices);
+            stack.back().tag    = B.tag;
+            stack.back().offset = B.offset;
+        }
+        if (A.vertices.size()>0) {
+            stack.push_back(Part());
+            stack.back().vertices.swap(A.vertices);
+            stack.back().tag    = A.tag;
+            stack.back().offset = A.offset;
+        }
+    }
+}
+
+template <typename IndexType>
+void
+order(Ordering                       ordering,
+      IndexType                      n,
+      const std::vector<IndexType>   &xadj,
+      const std::vector<IndexType>   &adj,
+      std::vector<IndexType>         &perm)
+{
+    ASSERT(IndexType(xadj.size())==n+1);
+
+    if (ordering==MinimumDegree) {
+        minimumDegree_(n, xadj, adj, perm);
+    } else if (ordering==NestedDissection) {
+        nestedDissection_(n, xadj, adj, perm);
+    } else {
+        perm.resize(n);
+        for (IndexType k=0; k<n; ++k) {
+            perm[k] = k;
+        }
+    }
+}
+
+} } // namespace supernodal, flens
+
+#endif // PLAYGROUND_FLENS_SPARSE_SUPERNODAL_ORDERING_TCC
@@ -0,0 +1,105 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn, Klaus Pototzky
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PLAYGROUND_FLENS_SPARSE_SUPERNODAL_SV_TCC
+#define PLAYGROUND_FLENS_SPARSE_SUPERNODAL_SV_TCC 1
+
+#include <playground/flens/sparse/supernodal/numeric.tcc>
+#include <playground/flens/sparse/supernodal/sv.h>
+
+namespace flens { namespace supernodal {
+
+template <typename MA, typename MX, typename MB>
+typename
+RestrictTo<(IsSyCRSMatrix<MA>::value || IsSyCCSMatrix<MA>::value) &&
+           IsGeMatrix<MX>::value &&
+           IsGeMatrix<MB>::value,
+           typename RemoveRef<MA>::Type::IndexType>::Type
+sv(const MA       &A,
+   MX             &&X,
+   const MB       &B,
+   Factorization  factorization,
+   Ordering       ordering)
+{
+    typedef typename RemoveRef<MA>::Type    MatrixA;
+    typedef typename MatrixA::IndexType     IndexType;
+    typedef typename MatrixA::ElementType   ElementType;
+
+    ASSERT(A.dim()==B.numRows());
+
+    Symbolic<IndexType>               S;
+    Numeric<ElementType, IndexType>   N(factorization);
+
+    analyze(A, S, ordering);
+    const IndexType info = factorize(A, S, N);
+    if (info!=0) {
+        return info;
+    }
+    X = B;
+    solve(S, N, X);
+    return 0;
+}
+
+template <typename MA, typename VX, typename VB>
+typename
+RestrictTo<(IsSyCRSMatrix<MA>::value || IsSyCCSMatrix<MA>::value) &&
+           IsDenseVector<VX>::value &&
+           IsDenseVector<VB>::value,
+           typename RemoveRef<MA>::Type::IndexType>::Type
+sv(const MA       &A,
+   VX             &&x,
+   const VB       &b,
+   Factorization  factorization,
+   Ordering       ordering)
+{
+    typedef typename RemoveRef<MA>::Type    MatrixA;
+    typedef typename MatrixA::IndexType     IndexType;
+    typedef typename MatrixA::ElementType   ElementType;
+
+    ASSERT(A.dim()==b.length());
+
+    Symbolic<IndexType>               S;
+    Numeric<ElementType, IndexType>   N(factorization);
+
+    analyze(A, S, ordering);
+    const IndexType info = factorize(A, S, N);
+    if (info!=0) {
+        return info;
+    }
+    x = b;
+    solve(S, N, x);
+    return 0;
+}
+
+} } // namespace supernodal, flens
+
+#endif // PLAYGROUND_FLENS_SPARSE_SUPERNODAL_SV_TCC
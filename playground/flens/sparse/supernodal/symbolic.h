@@ -0,0 +1,89 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn, Klaus Pototzky
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef PLAYGROUND_FLENS_SPARSE_SUPERNODAL_SYMBOLIC_H
+#define PLAYGROUND_FLENS_SPARSE_SUPERNODAL_SYMBOLIC_H 1
+
+#include <cxxstd/cstddef.h>
+#include <cxxstd/vector.h>
+
+#include <flens/auxiliary/auxiliary.h>
+#include <flens/matrixtypes/matrixtypes.h>
+#include <playground/flens/sparse/supernodal/ordering.h>
+
+namespace flens { namespace supernodal {
+
+//
+//  Result of the symbolic analysis.  It only depends on the sparsity pattern
+//  of A and can be reused for all matrices with the same pattern.  All
+//  indices are zero-based and refer to the permuted matrix P*A*P^T.
+//
+template <typename IndexType>
+struct Symbolic
+{
+    // dimension and number of stored entries of A
+    IndexType                n, numNonZeros;
+
+    // perm[k] is the (zero-based) row/column of A that becomes row/column k
+    std::vector<IndexType>   perm;
+
+    // lower triangle of P*A*P^T in compressed column storage (rows sorted).
+    // valueIndex[p] is the position of the corresponding value in A.
+    std::vector<IndexType>   colPtr, rowIdx, valueIndex;
+
+    // supernode s has columns superPtr[s],...,superPtr[s+1]-1.  Its row
+    // structure (including the dense diagonal block) is
+    // rows[rowPtr[s]],...,rows[rowPtr[s+1]-1].
+    std::vector<IndexType>   superPtr, rowPtr, rows;
+
+    // supernodal elimination tree in postorder.  The subtree rooted at s
+    // consists of the supernodes firstDesc[s],...,s.
+    std::vector<IndexType>   superParent, firstDesc, childPtr, children;
+
+    // number of nonzeros in the Cholesky factor L
+    std::size_t              numFactorNonZeros;
+
+    IndexType
+    numSupernodes() const;
+};
+
+template <typename MA>
+    typename RestrictTo<IsSyCRSMatrix<MA>::value
+                     || IsSyCCSMatrix<MA>::value,
+             void>::Type
+    analyze(const MA                                                  &A,
+            Symbolic<typename RemoveRef<MA>::Type::IndexType>         &S,
+            Ordering                                  ordering = MinimumDegree);
+
+} } // namespace supernodal, flens
+
+#endif // PLAYGROUND_FLENS_SPARSE_SUPERNODAL_SYMBOLIC_H
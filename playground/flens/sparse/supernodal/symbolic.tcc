@@ -0,0 +1,481 @@
+/*
+ *   Copyright (c) 2012, Michael Lehn, Klaus Pototzky
+ *
+ *   All rights reserved.
+ *
+ *   Redistribution and use in source and binary forms, with or without
+ *   modification, are permitted provided that the following conditions
+ *   are met:
+ *
+ *   1) Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *   2) Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in
+ *      the documentation and/or other materials provided with the
+ *      distribution.
+ *   3) Neither the name of the FLENS development group nor the names of
+ *      its contributors may be used to endorse or promote products derived
+ *      from this software without specific prior written permission.
+ *
+ *   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *   "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *   LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ *   A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ *   OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ *   SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ *   LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ *   DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ *   THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ *   (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ *   OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* Based on
+ *
+ * Joseph W. H. Liu - The role of elimination trees in sparse factorization,
+ * SIAM J. Matrix Anal. Appl. 11 (1990)
+ *
+ * Timothy A. Davis - Direct Methods for Sparse Linear Systems, Chapter 4
+ *
+ */
+
+#ifndef PLAYGROUND_FLENS_SPARSE_SUPERNODAL_SYMBOLIC_TCC
+#define PLAYGROUND_FLENS_SPARSE_SUPERNODAL_SYMBOLIC_TCC 1
+
+#include <cxxstd/algorithm.h>
+#include <playground/flens/sparse/supernodal/ordering.tcc>
+#include <playground/flens/sparse/supernodal/symbolic.h>
+
+namespace flens { namespace supernodal {
+
+template <typename IndexType>
+IndexType
+Symbolic<IndexType>::numSupernodes() const
+{
+    return IndexType(superPtr.size())-1;
+}
+
+//-- auxiliary functions -------------------------------------------------------
+
+//
+//  Zero-based coordinates of the stored entries (in the order of the values
+//  array)
+//
+template <typename CRS, typename IndexType>
+void
+coordinates_(const SyCRSMatrix<CRS>   &A,
+             std::vector<IndexType>   &row,
+             std::vector<IndexType>   &col)
+{
+    const IndexType *ia = A.engine().rows().data();
+    const IndexType *ja = A.engine().cols().data();
+    const IndexType base = ia[0];
+    const IndexType n    = A.dim();
+
+    row.resize(ia[n]-base);
+    col.resize(ia[n]-base);
+    for (IndexType i=0; i<n; ++i) {
+        for (IndexType p=ia[i]-base; p<ia[i+1]-base; ++p) {
+            row[p] = i;
+            col[p] = ja[p]-base;
+        }
+    }
+}
+
+template <typename CCS, typename IndexType>
+void
+coordinates_(const SyCCSMatrix<CCS>   &A,
+             std::vector<IndexType>   &row,
+             std::vector<IndexType>   &col)
+{
+    const IndexType *ia = A.engine().rows().data();
+    const IndexType *ja = A.engine().cols().data();
+    const IndexType base = ja[0];
+    const IndexType n    = A.dim();
+
+    row.resize(ja[n]-base);
+    col.resize(ja[n]-base);
+    for (IndexType j=0; j<n; ++j) {
+        for (IndexType p=ja[j]-base; p<ja[j+1]-base; ++p) {
+            row[p] = ia[p]-base;
+            col[p] = j;
+        }
+    }
+}
+
+//
+//  Lower triangle of P*A*P^T in compressed column storage with sorted rows.
+//  iperm is the inverse permutation.
+//
+template <typename IndexType>
+void
+permutedLower_(IndexType                      n,
+               const std::vector<IndexType>   &row,
+               const std::vector<IndexType>   &col,
+               const std::vector<IndexType>   &iperm,
+               std::vector<IndexType>         &colPtr,
+               std::vector<IndexType>         &rowIdx,
+               std::vector<IndexType>         &valueIndex)
+{
+    const IndexType nnz = row.size();
+
+    std::vector<IndexType>  r(nnz), c(nnz), byRow(nnz), ptr(n+1, 0);
+
+    for (IndexType p=0; p<nnz; ++p) {
+        const IndexType i = iperm[row[p]];
+        const IndexType j = iperm[col[p]];
+        r[p] = std::max(i, j);
+        c[p] = std::min(i, j);
+        ++ptr[r[p]+1];
+    }
+//
+//  Bucket entries by row first such that a stable distribution into the
+//  columns leaves the rows sorted.
+//
+    for (IndexType i=0; i<n; ++i) {
+        ptr[i+1] += ptr[i];
+    }
+    for (IndexType p=0; p<nnz; ++p) {
+        byRow[ptr[r[p]]++] = p;
+    }
+
+    colPtr.assign(n+1, 0);
+    rowIdx.resize(nnz);
+    valueIndex.resize(nnz);
+
+    for (IndexType p=0; p<nnz; ++p) {
+        ++colPtr[c[p]+1];
+    }
+    for (IndexType j=0; j<n; ++j) {
+        colPtr[j+1] += colPtr[j];
+    }
+    std::vector<IndexType> pos(colPtr.begin(), colPtr.end()-1);
+    for (IndexType q=0; q<nnz; ++q) {
+        const IndexType p = byRow[q];
+        rowIdx[pos[c[p]]]     = r[p];
+        valueIndex[pos[c[p]]] = p;
+        ++pos[c[p]];
+    }
+}
+
+//
+//  Elimination tree from the lower triangle in compressed column storage.
+//
+template <typename IndexType>
+void
+eliminationTree_(IndexType                      n,
+                 const std::vector<IndexType>   &colPtr,
+                 const std::vector<IndexType>   &rowIdx,
+                 std::vector<IndexType>         &parent)
+{
+//
+//  Liu's algorithm needs the rows of the lower triangle
+//
+    std::vector<IndexType>  rowPtr(n+1, 0), colIdx(rowIdx.size()),
+                            ancestor(n, -1);
+
+    for (std::size_t p=0; p<rowIdx.size(); ++p) {
+        ++rowPtr[rowIdx[p]+1];
+    }
+    for (IndexType i=0; i<n; ++i) {
+        rowPtr[i+1] += rowPtr[i];
+    }
+    std::vector<IndexType> pos(rowPtr.begin(), rowPtr.end()-1);
+    for (IndexType j=0; j<n; ++j) {
+        for (IndexType p=colPtr[j]; p<colPtr[j+1]; ++p) {
+            colIdx[pos[rowIdx[p]]++] = j;
+        }
+    }
+
+    parent.assign(n, -1);
+    for (IndexType i=0; i<n; ++i) {
+        for (IndexType p=rowPtr[i]; p<rowPtr[i+1]; ++p) {
+            IndexType r = colIdx[p];
+            if (r>=i) {
+                continue;
+            }
+            while (ancestor[r]!=-1 && ancestor[r]!=i) {
+                const IndexType t = ancestor[r];
+                ancestor[r] = i;
+                r = t;
+            }
+            if (ancestor[r]==-1) {
+                ancestor[r] = i;
+                parent[r]   = i;
+            }
+        }
+    }
+}
+
+template <typename IndexType>
+void
+postorder_(IndexType                      n,
+           const std::vector<IndexType>   &parent,
+           std::vector<IndexType>         &post)
+{
+    std::vector<IndexType>  head(n, -1), next(n, -1), stack;
+
+    for (IndexType j=n-1; j>=0; --j) {
+        if (parent[j]!=-1) {
+            next[j] = head[parent[j]];
+            head[parent[j]] = j;
+        }
+    }
+    post.resize(n);
+
+    IndexType k = 0;
+    for (IndexType j=0; j<n; ++j) {
+        if (parent[j]!=-1) {
+            continue;
+        }
+        stack.push_back(j);
+        while (!stack.empty()) {
+            const IndexType p = stack.back();
+            const IndexType c = head[p];
+            if (c==-1) {
+                stack.pop_back();
+                post[k++] = p;
+            } else {
+                head[p] = next[c];
+                stack.push_back(c);
+            }
+        }
+    }
+}
+
+//
+//  Column counts of L (including the diagonal) by traversing row subtrees.
+//
+template <typename IndexType>
+void
+columnCounts_(IndexType                      n,
+              const std::vector<IndexType>   &colPtr,
+              const std::vector<IndexType>   &rowIdx,
+              const std::vector<IndexType>   &parent,
+              std::vector<IndexType>         &count)
+{
+    std::vector<IndexType>  mark(n, -1);
+
+    count.assign(n, 1);
+
+    std::vector<IndexType>  rowPtr(n+1, 0), colIdx(rowIdx.size());
+    for (std::size_t p=0; p<rowIdx.size(); ++p) {
+        ++rowPtr[rowIdx[p]+1];
+    }
+    for (IndexType i=0; i<n; ++i) {
+        rowPtr[i+1] += rowPtr[i];
+    }
+    std::vector<IndexType> pos(rowPtr.begin(), rowPtr.end()-1);
+    for (IndexType j=0; j<n; ++j) {
+        for (IndexType p=colPtr[j]; p<colPtr[j+1]; ++p) {
+            colIdx[pos[rowIdx[p]]++] = j;
+        }
+    }
+
+    for (IndexType i=0; i<n; ++i) {
+        mark[i] = i;
+        for (IndexType p=rowPtr[i]; p<rowPtr[i+1]; ++p) {
+            for (IndexType k=colIdx[p]; k!=-1 && mark[k]!=i; k=parent[k]) {
+                ++count[k];
+                mark[k] = i;
+            }
+        }
+    }
+}
+
+//-- analyze -------------------------------------------------------------------
+
+template <typename MA>
+typename RestrictTo<IsSyCRSMatrix<MA>::value
+                 || IsSyCCSMatrix<MA>::value,
+         void>::Type
+analyze(const MA                                                  &A,
+        Symbolic<typename RemoveRef<MA>::Type::IndexType>         &S,
+        Ordering                                                  ordering)
+{
+    typedef typename RemoveRef<MA>::Type::IndexType  IndexType;
+
+    const IndexType n = A.dim();
+
+    std::vector<IndexType>  row, col, iperm(n), parent, post, count;
+
+    coordinates_(A, row, col);
+
+    S.n           = n;
+    S.numNonZeros = row.size();
+//
+//  Adjacency graph of A (without diagonal)
+//
+    {
+        std::vector<IndexType>  xadj(n+1, 0), adj, mark(n, -1);
+
+        for (std::size_t p=0; p<row.size(); ++p) {
+            if (row[p]!=col[p]) {
+                ++xadj[row[p]+1];
+                ++xadj[col[p]+1];
+            }
+        }
+        for (IndexType i=0; i<n; ++i) {
+            xadj[i+1] += xadj[i];
+        }
+        adj.resize(xadj[n]);
+        std::vector<IndexType> pos(xadj.begin(), xadj.end()-1);
+        for (std::size_t p=0; p<row.size(); ++p) {
+            if (row[p]!=col[p]) {
+                adj[pos[row[p]]++] = col[p];
+                adj[pos[col[p]]++] = row[p];
+            }
+        }
+//
+//      Remove duplicates
+//
+        IndexType k = 0;
+        for (IndexType i=0; i<n; ++i) {
+            const IndexType begin = xadj[i];
+            xadj[i] = k;
+            mark[i] = i;
+            for (IndexType p=begin; p<xadj[i+1]; ++p) {
+                if (mark[adj[p]]!=i) {
+                    mark[adj[p]] = i;
+                    adj[k++] = adj[p];
+                }
+            }
+        }
+        xadj[n] = k;
+        adj.resize(k);
+
+        order(ordering, n, xadj, adj, S.perm);
+    }
+//
+//  Postorder the elimination tree such that each subtree gets numbered
+//  contiguously.  This does not change the fill.
+//
+    for (IndexType k=0; k<n; ++k) {
+        iperm[S.perm[k]] = k;
+    }
+    permutedLower_(n, row, col, iperm, S.colPtr, S.rowIdx, S.valueIndex);
+    eliminationTree_(n, S.colPtr, S.rowIdx, parent);
+    postorder_(n, parent, post);
+
+    {
+        std::vector<IndexType> perm(n);
+        for (IndexType k=0; k<n; ++k) {
+            perm[k] = S.perm[post[k]];
+        }
+        S.perm.swap(perm);
+    }
+    for (IndexType k=0; k<n; ++k) {
+        iperm[S.perm[k]] = k;
+    }
+    permutedLower_(n, row, col, iperm, S.colPtr, S.rowIdx, S.valueIndex);
+    eliminationTree_(n, S.colPtr, S.rowIdx, parent);
+    columnCounts_(n, S.colPtr, S.rowIdx, parent, count);
+//
+//  Fundamental supernodes:  column j+1 gets merged with j if it is the
+//  only child of j+1 and the structures coincide.
+//
+    std::vector<IndexType>  numChildren(n, 0), superOf(n);
+
+    for (IndexType j=0; j<n; ++j) {
+        if (parent[j]!=-1) {
+            ++numChildren[parent[j]];
+        }
+    }
+
+    S.superPtr.clear();
+    S.superPtr.push_back(0);
+    for (IndexType j=1; j<n; ++j) {
+        if (parent[j-1]!=j || count[j-1]!=count[j]+1 || numChildren[j]!=1) {
+            S.superPtr.push_back(j);
+        }
+    }
+    if (n>0) {
+        S.superPtr.push_back(n);
+    }
+
+    const IndexType ns = S.numSupernodes();
+
+    for (IndexType s=0; s<ns; ++s) {
+        for (IndexType j=S.superPtr[s]; j<S.superPtr[s+1]; ++j) {
+            superOf[j] = s;
+        }
+    }
+
+    S.superParent.assign(ns, -1);
+    S.firstDesc.resize(ns);
+    S.childPtr.assign(ns+1, 0);
+    for (IndexType s=0; s<ns; ++s) {
+        const IndexType j = parent[S.superPtr[s+1]-1];
+        S.firstDesc[s] = s;
+        if (j!=-1) {
+            S.superParent[s] = superOf[j];
+            ++S.childPtr[superOf[j]+1];
+        }
+    }
+    for (IndexType s=0; s<ns; ++s) {
+        S.childPtr[s+1] += S.childPtr[s];
+        if (S.superParent[s]!=-1) {
+            IndexType &first = S.firstDesc[S.superParent[s]];
+            first = std::min(first, S.firstDesc[s]);
+        }
+    }
+    S.children.resize(S.childPtr[ns]);
+    {
+        std::vector<IndexType> pos(S.childPtr.begin(), S.childPtr.end()-1);
+        for (IndexType s=0; s<ns; ++s) {
+            if (S.superParent[s]!=-1) {
+                S.children[pos[S.superParent[s]]++] = s;
+            }
+        }
+    }
+//
+//  Row structure of each supernode: union of the structure of A in its
+//  columns and the structures of its children.
+//
+    S.rowPtr.assign(ns+1, 0);
+    S.rows.clear();
+    S.numFactorNonZeros = 0;
+
+    std::vector<IndexType>  mark(n, -1), offDiag;
+
+    for (IndexType s=0; s<ns; ++s) {
+        const IndexType first = S.superPtr[s];
+        const IndexType last  = S.superPtr[s+1]-1;
+
+        offDiag.clear();
+        for (IndexType j=first; j<=last; ++j) {
+            for (IndexType p=S.colPtr[j]; p<S.colPtr[j+1]; ++p) {
+                const IndexType i = S.rowIdx[p];
+                if (i>last && mark[i]!=s) {
+                    mark[i] = s;
+                    offDiag.push_back(i);
+                }
+            }
+        }
+        for (IndexType q=S.childPtr[s]; q<S.childPtr[s+1]; ++q) {
+            const IndexType c = S.children[q];
+            for (IndexType p=S.rowPtr[c]; p<S.rowPtr[c+1]; ++p) {
+                const IndexType i = S.rows[p];
+                if (i>last && mark[i]!=s) {
+                    mark[i] = s;
+                    offDiag.push_back(i);
+                }
+            }
+        }
+        std::sort(offDiag.begin(), offDiag.end());
+
+        for (IndexType j=first; j<=last; ++j) {
+            S.rows.push_back(j);
+        }
+        S.rows.insert(S.rows.end(), offDiag.begin(), offDiag.end());
+        S.rowPtr[s+1] = S.rows.size();
+
+        const std::size_t m  = S.rowPtr[s+1]-S.rowPtr[s];
+        const std::size_t nc = last-first+1;
+        S.numFactorNonZeros += nc*m - (nc*(nc-1))/2;
+    }
+}
+
+} } // namespace supernodal, flens
+
+#endif // PLAYGROUND_FLENS_SPARSE_SUPERNODAL_SYMBOLIC_TCC